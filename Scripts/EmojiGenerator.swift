@@ -274,7 +274,16 @@ extension EmojiGenerator {
                 // Start skinToneToEmoji
                 fileHandle.writeLine("static func emojiToSkinToneComponents(emoji: String) -> (Emoji, [Emoji.SkinTone])? {")
                 fileHandle.indent {
-                    fileHandle.writeLine("switch emoji {")
+                    fileHandle.writeLine("return skinToneComponentsByEmoji[emoji]")
+                }
+                fileHandle.writeLine("}")
+                fileHandle.writeLine("")
+
+                // Start skinToneComponentsByEmoji
+                // A dictionary rather than a `switch`, which compares the string
+                // against each case in turn.
+                fileHandle.writeLine("private static let skinToneComponentsByEmoji: [String: (Emoji, [Emoji.SkinTone])] = [")
+                fileHandle.indent {
                     emojiModel.definitions.forEach { emojiDef in
                         let skintoneVariants = emojiDef.variants.filter({ $0.skintoneSequence != .none})
                         if skintoneVariants.isEmpty {
@@ -284,13 +293,11 @@ extension EmojiGenerator {
 
                         skintoneVariants.forEach { variant in
                             let skintoneSequenceKey = variant.skintoneSequence.map({ ".\($0)" }).joined(separator: ", ")
-                            fileHandle.writeLine("case \"\(variant.emojiChar)\": return (.\(emojiDef.enumName), [\(skintoneSequenceKey)])")
+                            fileHandle.writeLine("\"\(variant.emojiChar)\": (.\(emojiDef.enumName), [\(skintoneSequenceKey)]),")
                         }
                     }
-                    fileHandle.writeLine("default: return nil")
-                    fileHandle.writeLine("}")
                 }
-                fileHandle.writeLine("}")
+                fileHandle.writeLine("]")
             }
             fileHandle.writeLine("}")
         }
@@ -578,6 +578,7 @@ class MessageContext(BaseContext):
         # Prepare fields
         explict_fields = []
         implict_fields = []
+        lazy_fields = []
         for field in self.fields():
             field.type_swift = self.swift_type_for_field(field)
             field.type_swift_not_optional = self.swift_type_for_field(
@@ -590,7 +591,18 @@ class MessageContext(BaseContext):
                 is_explicit = True
             elif self.is_field_a_proto(field):
                 is_explicit = True
-            if is_explicit:
+            # Nested wrappers that can't fail to build are built on first
+            # access instead of in init; ones that can fail are still built
+            # eagerly so that invalid protos are rejected at parse time.
+            is_lazy = (
+                is_explicit
+                and writer.needs_objc()
+                and not field.is_required
+                and not self.is_field_a_proto_whose_init_throws(field)
+            )
+            if is_lazy:
+                lazy_fields.append(field)
+            elif is_explicit:
                 explict_fields.append(field)
             else:
                 implict_fields.append(field)
@@ -612,9 +624,53 @@ class MessageContext(BaseContext):
         writer.add("fileprivate let proto: %s" % wrapped_swift_name)
         writer.newline()
 
+        def write_lazy_field_getter(field):
+            cache_name = "_%s" % field.name_swift
+            base_type = self.base_swift_type_for_field(field)
+            writer.add_objc()
+            writer.add("public var %s: %s {" % (field.name_swift, field.type_swift))
+            writer.push_indent()
+            if field.rules == "repeated":
+                writer.add("guard !proto.%s.isEmpty else {" % field.name_swift)
+                writer.push_indent()
+                writer.add("return []")
+            else:
+                writer.add("guard proto.%s else {" % field.has_accessor_name())
+                writer.push_indent()
+                writer.add("return nil")
+            writer.pop_indent()
+            writer.add("}")
+            writer.add("return ProtoWrapperCache.withLock(for: self) {")
+            writer.push_indent()
+            writer.add("if let %s = %s {" % (field.name_swift, cache_name))
+            writer.push_indent()
+            writer.add("return %s" % field.name_swift)
+            writer.pop_indent()
+            writer.add("}")
+            if field.rules == "repeated":
+                writer.add(
+                    "let %s = proto.%s.map { %s($0) }"
+                    % (field.name_swift, field.name_swift, base_type)
+                )
+            else:
+                writer.add(
+                    "let %s = %s(proto.%s)"
+                    % (field.name_swift, base_type, field.name_swift)
+                )
+            writer.add("%s = %s" % (cache_name, field.name_swift))
+            writer.add("return %s" % field.name_swift)
+            writer.pop_indent()
+            writer.add("}")
+            writer.pop_indent()
+            writer.add("}")
+            writer.add("private var %s: %s?" % (cache_name, field.type_swift_not_optional))
+            writer.newline()
+
         # Property Declarations
-        if len(explict_fields) > 0:
-            for field in explict_fields:
+        for field in self.fields():
+            if field in lazy_fields:
+                write_lazy_field_getter(field)
+            elif field in explict_fields:
                 type_name = (
                     field.type_swift_not_optional
                     if field.is_required
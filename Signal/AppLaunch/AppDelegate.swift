@@ -104,6 +104,8 @@ final class AppDelegate: UIResponder, UIApplicationDelegate {
 
     private let flushQueue = DispatchQueue(label: "org.signal.flush", qos: .utility)
 
+    private var databaseMaintenanceScheduler: DatabaseMaintenanceScheduler?
+
     func applicationWillResignActive(_ application: UIApplication) {
         AssertIsOnMainThread()
 
@@ -170,12 +172,22 @@ final class AppDelegate: UIResponder, UIApplicationDelegate {
         if DebugFlags.audibleErrorLogging {
             debugLogger.enableErrorReporting()
         }
+        MemoryProfiler.shared.start(persistingTo: DebugLogger.mainAppDebugLogsDirPath)
 
         Logger.warn("Synchronous launch started")
         defer { Logger.info("Synchronous launch finished") }
 
+        let launchTimeline = LaunchTimeline.shared
+        launchTimeline.start(launchStartedAt: launchStartedAt)
+        let synchronousLaunchStep = launchTimeline.beginStep("Synchronous launch")
+        defer { synchronousLaunchStep.end() }
+
         BenchEventStart(title: "Presenting HomeView", eventId: "AppStart", logInProduction: true)
-        AppReadiness.runNowOrWhenUIDidBecomeReadySync { BenchEventComplete(eventId: "AppStart") }
+        AppReadiness.runNowOrWhenUIDidBecomeReadySync {
+            BenchEventComplete(eventId: "AppStart")
+            // Let the steps that are running now (e.g. "Set app ready") end first.
+            DispatchQueue.main.async { launchTimeline.logReport() }
+        }
 
         MessageFetchBGRefreshTask.register()
 
@@ -199,10 +211,12 @@ final class AppDelegate: UIResponder, UIApplicationDelegate {
 
         let databaseStorage: SDSDatabaseStorage
         do {
-            databaseStorage = try SDSDatabaseStorage(
-                databaseFileUrl: SDSDatabaseStorage.grdbDatabaseFileUrl,
-                keychainStorage: keychainStorage
-            )
+            databaseStorage = try launchTimeline.measure("Open database") {
+                try SDSDatabaseStorage(
+                    databaseFileUrl: SDSDatabaseStorage.grdbDatabaseFileUrl,
+                    keychainStorage: keychainStorage
+                )
+            }
         } catch KeychainError.notAllowed where application.applicationState == .background {
             notifyThatPhoneMustBeUnlocked()
         } catch let error as DatabaseError where error.resultCode == .SQLITE_CORRUPT {
@@ -371,16 +385,19 @@ final class AppDelegate: UIResponder, UIApplicationDelegate {
         let _currentCall = AtomicValue<SignalCall?>(nil, lock: .init())
         let currentCall = CurrentCall(rawValue: _currentCall)
 
-        let databaseContinuation = AppSetup().start(
-            appContext: launchContext.appContext,
-            databaseStorage: launchContext.databaseStorage,
-            paymentsEvents: PaymentsEventsMainApp(),
-            mobileCoinHelper: MobileCoinHelperSDK(),
-            callMessageHandler: WebRTCCallMessageHandler(),
-            currentCallProvider: currentCall,
-            notificationPresenter: NotificationPresenterImpl(),
-            incrementalTSAttachmentMigrator: launchContext.incrementalMessageTSAttachmentMigrator
-        )
+        let launchTimeline = LaunchTimeline.shared
+        let databaseContinuation = launchTimeline.measure("Set up dependencies") {
+            AppSetup().start(
+                appContext: launchContext.appContext,
+                databaseStorage: launchContext.databaseStorage,
+                paymentsEvents: PaymentsEventsMainApp(),
+                mobileCoinHelper: MobileCoinHelperSDK(),
+                callMessageHandler: WebRTCCallMessageHandler(),
+                currentCallProvider: currentCall,
+                notificationPresenter: NotificationPresenterImpl(),
+                incrementalTSAttachmentMigrator: launchContext.incrementalMessageTSAttachmentMigrator
+            )
+        }
         setupNSEInteroperation()
         SUIEnvironment.shared.setUp(authCredentialManager: databaseContinuation.authCredentialManager)
         AppEnvironment.shared.setUp(
@@ -393,8 +410,12 @@ final class AppDelegate: UIResponder, UIApplicationDelegate {
                 tsAccountManager: DependenciesBridge.shared.tsAccountManager
             )
         )
+        let prepareDatabaseStep = launchTimeline.beginStep("Prepare database")
         let result = databaseContinuation.prepareDatabase()
-        return result.map(on: SyncScheduler()) { ($0, sleepBlockObject) }
+        return result.map(on: SyncScheduler()) {
+            prepareDatabaseStep.end()
+            return ($0, sleepBlockObject)
+        }
     }
 
     private func checkSomeDiskSpaceAvailable() -> Bool {
@@ -488,7 +509,9 @@ final class AppDelegate: UIResponder, UIApplicationDelegate {
             Task { @MainActor in
                 defer { backgroundTask.end() }
                 if !hasInProgressRegistration {
-                    await LaunchJobs.run(databaseStorage: databaseStorage)
+                    await LaunchTimeline.shared.measure("Launch jobs") {
+                        await LaunchJobs.run(databaseStorage: databaseStorage)
+                    }
                 }
                 DispatchQueue.main.async {
                     self.setAppIsReady(
@@ -510,6 +533,9 @@ final class AppDelegate: UIResponder, UIApplicationDelegate {
         owsPrecondition(!AppReadiness.isAppReady)
         owsPrecondition(!CurrentAppContext().isRunningTests)
 
+        let launchStep = LaunchTimeline.shared.beginStep("Set app ready")
+        defer { launchStep.end() }
+
         let appContext = launchContext.appContext
 
         if DebugFlags.internalLogging {
@@ -522,7 +548,7 @@ final class AppDelegate: UIResponder, UIApplicationDelegate {
             messageSendLog.cleanUpAndScheduleNextOccurrence(on: DependenciesBridge.shared.schedulers)
         }
 
-        AppReadiness.runNowOrWhenAppDidBecomeReadyAsync {
+        AppReadiness.runNowOrWhenAppDidBecomeReadyAsync(priority: .low) {
             OWSOrphanDataCleaner.auditOnLaunchIfNecessary()
         }
 
@@ -536,6 +562,36 @@ final class AppDelegate: UIResponder, UIApplicationDelegate {
             }
         }
 
+        AppReadiness.runNowOrWhenMainAppDidBecomeReadyAsync {
+            Task.detached(priority: .utility) {
+                await GRDBSchemaMigrator.runDeferredDataMigrations(databaseStorage: SSKEnvironment.shared.databaseStorageRef)
+            }
+        }
+
+        AppReadiness.runNowOrWhenMainAppDidBecomeReadyAsync {
+            let databaseMaintenanceScheduler = DatabaseMaintenanceScheduler(
+                appContext: appContext,
+                databaseStorage: SSKEnvironment.shared.databaseStorageRef
+            )
+            databaseMaintenanceScheduler.start()
+            self.databaseMaintenanceScheduler = databaseMaintenanceScheduler
+        }
+
+        AppReadiness.runNowOrWhenAppDidBecomeReadyAsync {
+            Task.detached(priority: .low) {
+                await LegacySessionMigrator(
+                    appContext: appContext,
+                    db: DependenciesBridge.shared.db,
+                    keyValueStoreFactory: DependenciesBridge.shared.keyValueStoreFactory
+                ).run()
+            }
+        }
+
+        AppReadiness.runNowOrWhenAppDidBecomeReadyAsync {
+            // Index anything an extension (or a previous launch) queued.
+            FullTextSearchIndexingQueue.shared.scheduleDrain()
+        }
+
         AppReadiness.runNowOrWhenAppDidBecomeReadyAsync {
             Task.detached(priority: .low) {
                 await AuthorMergeHelperBuilder(
@@ -573,7 +629,7 @@ final class AppDelegate: UIResponder, UIApplicationDelegate {
             }
         }
 
-        AppReadiness.runNowOrWhenAppDidBecomeReadyAsync {
+        AppReadiness.runNowOrWhenAppDidBecomeReadyInBackground {
             StaleProfileFetcher(
                 db: DependenciesBridge.shared.db,
                 profileFetcher: SSKEnvironment.shared.profileFetcherRef,
@@ -581,7 +637,7 @@ final class AppDelegate: UIResponder, UIApplicationDelegate {
             ).scheduleProfileFetches()
         }
 
-        AppReadiness.runNowOrWhenAppDidBecomeReadyAsync {
+        AppReadiness.runNowOrWhenAppDidBecomeReadyAsync(priority: .low) {
             Task.detached(priority: .low) {
                 YDBStorage.deleteYDBStorage()
                 SSKPreferences.clearLegacyDatabaseFlags(from: appContext.appUserDefaults())
@@ -685,7 +741,9 @@ final class AppDelegate: UIResponder, UIApplicationDelegate {
 
         checkDatabaseIntegrityIfNecessary(isRegistered: tsRegistrationState.isRegistered)
 
-        SignalApp.shared.showLaunchInterface(launchInterface, launchStartedAt: launchContext.launchStartedAt)
+        LaunchTimeline.shared.measure("Show launch interface") {
+            SignalApp.shared.showLaunchInterface(launchInterface, launchStartedAt: launchContext.launchStartedAt)
+        }
     }
 
     private func scheduleBgAppRefresh() {
@@ -28,6 +28,13 @@ class GroupCallRemoteVideoManager {
     // MARK: - Remote Video Views
     private var videoViews = [UInt32: [CallMemberVisualContext: GroupCallRemoteVideoView]]()
 
+    /// Renderers that were taken out of the view hierarchy (e.g. their tile
+    /// scrolled out of the overflow), kept so that the next tile to appear
+    /// can reuse one. In a large call only the visible tiles hold renderers,
+    /// rather than one for everyone who has been on screen.
+    private var reusableVideoViews = [GroupCallRemoteVideoView]()
+    private static let maxReusableVideoViews = 4
+
     func remoteVideoView(for device: RemoteDeviceState, context: CallMemberVisualContext) -> GroupCallRemoteVideoView {
         AssertIsOnMainThread()
 
@@ -35,9 +42,15 @@ class GroupCallRemoteVideoManager {
 
         if let current = currentVideoViewsDevice[context] { return current }
 
-        let videoView = GroupCallRemoteVideoView(demuxId: device.demuxId)
-        videoView.sizeDelegate = self
-        videoView.isGroupCall = true
+        let videoView: GroupCallRemoteVideoView
+        if let reusableVideoView = reusableVideoViews.popLast() {
+            videoView = reusableVideoView
+            videoView.prepareForReuse(demuxId: device.demuxId)
+        } else {
+            videoView = GroupCallRemoteVideoView(demuxId: device.demuxId)
+            videoView.sizeDelegate = self
+            videoView.isGroupCall = true
+        }
 
         if context == .speaker { videoView.isFullScreen = true }
 
@@ -54,6 +67,25 @@ class GroupCallRemoteVideoManager {
         videoViews[demuxId] = nil
     }
 
+    /// Moves views that are no longer in the view hierarchy into the reuse
+    /// pool, or releases them if it's full.
+    private func recycleDetachedVideoViews() {
+        AssertIsOnMainThread()
+
+        for (demuxId, videoViewsForDevice) in videoViews {
+            for (context, videoView) in videoViewsForDevice where videoView.superview == nil {
+                videoViews[demuxId]?[context] = nil
+                if reusableVideoViews.count < Self.maxReusableVideoViews {
+                    videoView.prepareForReuse(demuxId: nil)
+                    reusableVideoViews.append(videoView)
+                }
+            }
+            if videoViews[demuxId]?.isEmpty == true {
+                videoViews[demuxId] = nil
+            }
+        }
+    }
+
     private var updateVideoRequestsDebounceTimer: Timer?
     private func updateVideoRequests() {
         updateVideoRequestsDebounceTimer?.invalidate()
@@ -62,9 +94,15 @@ class GroupCallRemoteVideoManager {
             guard let self = self else { return }
             guard let groupCall = self.currentRingRtcCall else { return }
 
+            self.recycleDetachedVideoViews()
+
             var activeSpeakerHeight: UInt16 = 0
 
-            let videoRequests: [VideoRequest] = groupCall.remoteDeviceStates.map { demuxId, _ in
+            // Only ask for video for members whose tiles are on screen, at the
+            // size of their largest visible tile. Everyone else gets a request
+            // for no video, so the SFU doesn't send it and we don't decode it.
+            let videoRequests: [VideoRequest] = groupCall.remoteDeviceStates.map { demuxId, device in
+                self.videoViews[demuxId]?.values.forEach { $0.configure(for: device) }
                 guard
                     let renderingVideoViews = self.videoViews[demuxId]?.filter({ $0.value.isRenderingVideo }),
                     !renderingVideoViews.isEmpty
@@ -101,7 +139,12 @@ extension GroupCallRemoteVideoManager: GroupCallRemoteVideoViewSizeDelegate {
 
     func groupCallRemoteVideoViewDidChangeSuperview(remoteVideoView: GroupCallRemoteVideoView) {
         AssertIsOnMainThread()
-        guard let device = currentRingRtcCall?.remoteDeviceStates[remoteVideoView.demuxId] else { return }
+        guard
+            let demuxId = remoteVideoView.demuxId,
+            let device = currentRingRtcCall?.remoteDeviceStates[demuxId]
+        else {
+            return
+        }
         remoteVideoView.configure(for: device)
         updateVideoRequests()
     }
@@ -134,10 +177,13 @@ extension GroupCallRemoteVideoManager: GroupCallObserver {
             }
             videoViews.values.forEach { $0.configure(for: device) }
         }
+        // Tiles may have been hidden or shown without changing superviews.
+        updateVideoRequests()
     }
 
     func groupCallEnded(_ call: GroupCall, reason: GroupCallEndReason) {
         videoViews.keys.forEach { destroyRemoteVideoView(for: $0) }
+        reusableVideoViews = []
     }
 }
 
@@ -181,6 +227,10 @@ class GroupCallRemoteVideoView: UIView {
         sizeDelegate?.groupCallRemoteVideoViewDidChangeSuperview(remoteVideoView: self)
     }
 
+    override func didMoveToWindow() {
+        sizeDelegate?.groupCallRemoteVideoViewDidChangeSuperview(remoteVideoView: self)
+    }
+
     var isGroupCall: Bool {
         get { remoteVideoView.isGroupCall }
         set { remoteVideoView.isGroupCall = newValue }
@@ -198,13 +248,46 @@ class GroupCallRemoteVideoView: UIView {
 
     var isRenderingVideo: Bool { videoTrack != nil }
 
-    fileprivate let demuxId: UInt32
+    /// Whether any of this view could be on screen: it's in a window, it and
+    /// its superviews aren't hidden, and it isn't clipped out of view (e.g.
+    /// scrolled out of the overflow).
+    private var isVisible: Bool {
+        guard superview != nil, window != nil else {
+            return false
+        }
+        var view: UIView? = self
+        while let currentView = view {
+            if currentView.isHidden || currentView.alpha < 0.01 {
+                return false
+            }
+            if
+                currentView !== self,
+                currentView.clipsToBounds,
+                currentSize != .zero,
+                !convert(bounds, to: currentView).intersects(currentView.bounds)
+            {
+                return false
+            }
+            view = currentView.superview
+        }
+        return true
+    }
+
+    /// Nil while the view is in the reuse pool.
+    fileprivate private(set) var demuxId: UInt32?
     fileprivate init(demuxId: UInt32) {
         self.demuxId = demuxId
         super.init(frame: .zero)
         addSubview(remoteVideoView)
     }
 
+    fileprivate func prepareForReuse(demuxId: UInt32?) {
+        videoTrack = nil
+        self.demuxId = demuxId
+        isFullScreen = false
+        isScreenShare = false
+    }
+
     required init?(coder: NSCoder) {
         fatalError("init(coder:) has not been implemented")
     }
@@ -216,6 +299,6 @@ class GroupCallRemoteVideoView: UIView {
             return owsFailDebug("Tried to configure with incorrect device")
         }
 
-        videoTrack = superview == nil ? nil : device.videoTrack
+        videoTrack = isVisible ? device.videoTrack : nil
     }
 }
@@ -47,6 +47,7 @@ extension CallsListViewController {
         private let createCallViewModelBlock: CreateCallViewModelBlock
         private let fetchCallRecordBlock: FetchCallRecordBlock
         private let viewModelPageSize: UInt
+        private let firstPageSize: UInt
         private let maxCachedViewModelCount: Int
         private let maxCoalescedCallsInOneViewModel: UInt
 
@@ -55,18 +56,22 @@ extension CallsListViewController {
             createCallViewModelBlock: @escaping CreateCallViewModelBlock,
             fetchCallRecordBlock: @escaping FetchCallRecordBlock,
             viewModelPageSize: UInt = 50,
+            firstPageSize: UInt? = nil,
             maxCachedViewModelCount: Int = 150,
             maxCoalescedCallsInOneViewModel: UInt = 50
         ) {
+            let firstPageSize = min(firstPageSize ?? viewModelPageSize, viewModelPageSize)
             owsPrecondition(
                 maxCachedViewModelCount >= viewModelPageSize,
                 "Must be able to cache at least one page of view models!"
             )
+            owsPrecondition(firstPageSize > 0, "First page must load something!")
 
             self.callRecordLoader = callRecordLoader
             self.createCallViewModelBlock = createCallViewModelBlock
             self.fetchCallRecordBlock = fetchCallRecordBlock
             self.viewModelPageSize = viewModelPageSize
+            self.firstPageSize = firstPageSize
             self.maxCachedViewModelCount = maxCachedViewModelCount
             self.maxCoalescedCallsInOneViewModel = maxCoalescedCallsInOneViewModel
 
@@ -250,6 +255,10 @@ extension CallsListViewController {
         /// into this loader's cache for view model references it had loaded in
         /// the past; or it may do a combination of both.
         ///
+        /// The first load is only `firstPageSize` calls, typically enough to
+        /// fill the screen, so that opening the list doesn't wait on building
+        /// view models for calls that aren't visible.
+        ///
         /// - Returns
         /// Whether changes were made to ``loadedViewModelReferences`` as a
         /// result of this load.
@@ -257,7 +266,7 @@ extension CallsListViewController {
             direction loadDirection: LoadDirection,
             tx: DBReadTransaction
         ) -> Bool {
-            var viewModelsToLoadCount = viewModelPageSize
+            var viewModelsToLoadCount = loadedViewModelReferences.isEmpty ? firstPageSize : viewModelPageSize
 
             let rehydratedCount = rehydrateLoadedViewModelReferencesIntoCache(
                 maxCount: viewModelsToLoadCount,
@@ -28,6 +28,10 @@ class CallsListViewController: OWSViewController, HomeTabViewController, CallSer
         /// An interval to wait after the search term changes before actually
         /// issuing a search.
         static let searchDebounceInterval: TimeInterval = 0.1
+
+        /// Used to size the first page of calls; err on the small side so the
+        /// first page always fills the screen.
+        static let estimatedCallCellHeight: CGFloat = 56
     }
 
     // MARK: - Dependencies
@@ -617,11 +621,15 @@ class CallsListViewController: OWSViewController, HomeTabViewController, CallSer
     /// Asynchronously resets our current ``LoadedCalls`` for the current UI
     /// state, then kicks off an initial page load.
     ///
+    /// - Parameter reloadAllRows
+    /// Whether to reload every row once the new calls are loaded, in case the
+    /// calls we'd already loaded have changed.
+    ///
     /// - Note
     /// This method will perform an FTS search for our current search term, if
     /// we have one. That operation can be painfully slow for users with a large
     /// FTS index, so we need to do it asynchronously.
-    private func loadCallRecordsAnew(animated: Bool) {
+    private func loadCallRecordsAnew(animated: Bool, reloadAllRows: Bool = false) {
         let searchTerm = self.searchTerm
         let onlyLoadMissedCalls: Bool = {
             switch self.currentFilterMode {
@@ -699,6 +707,7 @@ class CallsListViewController: OWSViewController, HomeTabViewController, CallSer
                 /// instead we'll early-capture just the dependencies those
                 /// blocks actually need and give them a copy.
                 let capturedDeps = self.deps
+                let threadCache = CallThreadCache()
 
                 // Reset our loaded calls.
                 self.viewModelLoader = ViewModelLoader(
@@ -708,6 +717,7 @@ class CallsListViewController: OWSViewController, HomeTabViewController, CallSer
                             primaryCallRecord: primaryCallRecord,
                             coalescedCallRecords: coalescedCallRecords,
                             deps: capturedDeps,
+                            threadCache: threadCache,
                             tx: SDSDB.shimOnlyBridge(tx)
                         )
                     },
@@ -716,7 +726,8 @@ class CallsListViewController: OWSViewController, HomeTabViewController, CallSer
                             callRecordId: callRecordId,
                             tx: SDSDB.shimOnlyBridge(tx)
                         ).unwrapped
-                    }
+                    },
+                    firstPageSize: self.firstPageSize
                 )
 
                 // Load the initial page of records. We've thrown away all our
@@ -726,6 +737,13 @@ class CallsListViewController: OWSViewController, HomeTabViewController, CallSer
                     animated: animated,
                     forceUpdateSnapshot: true
                 )
+
+                if reloadAllRows {
+                    // Runs after the snapshot update enqueued above.
+                    DispatchQueue.main.async {
+                        self.reloadAllRows()
+                    }
+                }
             }
         )
     }
@@ -803,6 +821,30 @@ class CallsListViewController: OWSViewController, HomeTabViewController, CallSer
         }
     }
 
+    /// Enough rows to fill the screen, so that the first load doesn't build
+    /// view models for calls the user may never scroll to. Later pages are
+    /// loaded as rows are displayed.
+    private var firstPageSize: UInt {
+        let screenHeight = max(UIScreen.main.bounds.width, UIScreen.main.bounds.height)
+        return UInt((screenHeight / Constants.estimatedCallCellHeight).rounded(.up)) + 4
+    }
+
+    /// The threads, and their titles, that the current ``ViewModelLoader`` has
+    /// already resolved. Calls are mostly with the same few people, so this
+    /// saves fetching the same thread and display name for each of their
+    /// view models. It's rebuilt whenever we load calls anew (including when
+    /// the database changes externally).
+    ///
+    /// Only used on the main thread.
+    private final class CallThreadCache {
+        struct Entry {
+            let thread: TSThread
+            let title: String
+        }
+
+        var entries = [Int64: Entry]()
+    }
+
     /// Converts ``CallRecord``s into a ``CallViewModel``.
     ///
     /// - Important
@@ -812,6 +854,7 @@ class CallsListViewController: OWSViewController, HomeTabViewController, CallSer
         primaryCallRecord: CallRecord,
         coalescedCallRecords: [CallRecord],
         deps: Dependencies,
+        threadCache: CallThreadCache,
         tx: SDSAnyReadTransaction
     ) -> CallViewModel {
         owsPrecondition(
@@ -831,12 +874,32 @@ class CallsListViewController: OWSViewController, HomeTabViewController, CallSer
             "Primary and coalesced call records were not ordered descending by timestamp!"
         )
 
-        guard let callThread = deps.threadStore.fetchThread(
-            rowId: primaryCallRecord.threadRowId,
-            tx: tx.asV2Read
-        ) else {
-            owsFail("Missing thread for call record! This should be impossible, per the DB schema.")
+        let threadEntry: CallThreadCache.Entry
+        if let cachedEntry = threadCache.entries[primaryCallRecord.threadRowId] {
+            threadEntry = cachedEntry
+        } else {
+            guard let callThread = deps.threadStore.fetchThread(
+                rowId: primaryCallRecord.threadRowId,
+                tx: tx.asV2Read
+            ) else {
+                owsFail("Missing thread for call record! This should be impossible, per the DB schema.")
+            }
+
+            let title: String
+            if let contactThread = callThread as? TSContactThread {
+                title = deps.contactsManager.displayName(
+                    for: contactThread.contactAddress, tx: tx
+                ).resolvedValue()
+            } else if let groupThread = callThread as? TSGroupThread {
+                title = groupThread.groupModel.groupNameOrDefault
+            } else {
+                owsFail("Call thread was neither contact nor group! This should be impossible.")
+            }
+
+            threadEntry = CallThreadCache.Entry(thread: callThread, title: title)
+            threadCache.entries[primaryCallRecord.threadRowId] = threadEntry
         }
+        let callThread = threadEntry.thread
 
         let callDirection: CallViewModel.Direction = {
             if primaryCallRecord.callStatus.isMissedCall {
@@ -903,9 +966,7 @@ class CallsListViewController: OWSViewController, HomeTabViewController, CallSer
             return CallViewModel(
                 primaryCallRecord: primaryCallRecord,
                 coalescedCallRecords: coalescedCallRecords,
-                title: deps.contactsManager.displayName(
-                    for: contactThread.contactAddress, tx: tx
-                ).resolvedValue(),
+                title: threadEntry.title,
                 recipientType: .individual(type: callType, contactThread: contactThread),
                 direction: callDirection,
                 state: callState
@@ -914,7 +975,7 @@ class CallsListViewController: OWSViewController, HomeTabViewController, CallSer
             return CallViewModel(
                 primaryCallRecord: primaryCallRecord,
                 coalescedCallRecords: coalescedCallRecords,
-                title: groupThread.groupModel.groupNameOrDefault,
+                title: threadEntry.title,
                 recipientType: .group(groupThread: groupThread),
                 direction: callDirection,
                 state: callState
@@ -1724,8 +1785,7 @@ extension CallsListViewController: DatabaseChangeDelegate {
     func databaseChangesDidUpdateExternally() {
         logger.info("Database changed externally, loading calls anew and reloading all rows.")
 
-        loadCallRecordsAnew(animated: false)
-        reloadAllRows()
+        loadCallRecordsAnew(animated: false, reloadAllRows: true)
     }
 
     func databaseChangesDidUpdate(databaseChanges: DatabaseChanges) {}
@@ -45,6 +45,11 @@ public class CVAudioPlayer: NSObject {
 
     private var autoplayAttachmentId: TSResourceId?
 
+    // Playbacks for the audio attachments likely to be autoplayed next,
+    // already loaded so that they start right away. Oldest first.
+    private var preloadedAudioPlaybacks = [CVAudioPlayback]()
+    private static let maxPreloadedAudioPlaybackCount = 2
+
     // Views need to update to reflect playback progress, state changes.
     private var listeners = WeakArray<CVAudioPlayerListener>()
 
@@ -101,7 +106,12 @@ public class CVAudioPlayer: NSObject {
            audioPlayback.attachmentId == attachmentId {
             return audioPlayback
         }
-        guard let audioPlayback = CVAudioPlayback(attachment: attachment) else {
+        let audioPlayback: CVAudioPlayback
+        if let preloadedIndex = preloadedAudioPlaybacks.firstIndex(where: { $0.attachmentId == attachmentId }) {
+            audioPlayback = preloadedAudioPlaybacks.remove(at: preloadedIndex)
+        } else if let newAudioPlayback = CVAudioPlayback(attachment: attachment) {
+            audioPlayback = newAudioPlayback
+        } else {
             owsFailDebug("Could not play audio attachment.")
             return nil
         }
@@ -149,6 +159,34 @@ public class CVAudioPlayer: NSObject {
         audioPlayback.togglePlayState()
     }
 
+    /// Loads an audio attachment that may be autoplayed soon, e.g. the one
+    /// after the attachment that's playing, so that it starts right away.
+    public func preloadAudioAttachment(_ audioAttachment: AudioAttachment?) {
+        AssertIsOnMainThread()
+
+        guard shouldAutoplayNextAudioAttachment?() ?? true else {
+            return
+        }
+        guard let audioAttachment, let attachmentId = audioAttachment.attachmentStream?.attachmentStream.resourceId else {
+            return
+        }
+        guard
+            audioPlayback?.attachmentId != attachmentId,
+            !preloadedAudioPlaybacks.contains(where: { $0.attachmentId == attachmentId })
+        else {
+            return
+        }
+        guard let audioPlayback = CVAudioPlayback(attachment: audioAttachment) else {
+            return
+        }
+        audioPlayback.preload()
+
+        preloadedAudioPlaybacks.append(audioPlayback)
+        if preloadedAudioPlaybacks.count > Self.maxPreloadedAudioPlaybackCount {
+            preloadedAudioPlaybacks.removeFirst()
+        }
+    }
+
     public var audioPlaybackState: AudioPlaybackState = .stopped
     private var soundPlayer: AudioPlayer?
     private var soundComplete: (() -> Void)?
@@ -242,6 +280,8 @@ public class CVAudioPlayer: NSObject {
     }
 
     public func stopAll() {
+        preloadedAudioPlaybacks = []
+
         guard let audioPlayback = self.audioPlayback else {
             return
         }
@@ -403,6 +443,12 @@ private class CVAudioPlayback: NSObject, AudioPlayerDelegate {
         audioPlayer.stop()
     }
 
+    fileprivate func preload() {
+        AssertIsOnMainThread()
+
+        audioPlayer.preload()
+    }
+
     public func togglePlayState() {
         AssertIsOnMainThread()
 
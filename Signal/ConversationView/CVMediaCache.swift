@@ -13,12 +13,20 @@ public class CVMediaCache: NSObject {
         case attachment(TSResourceId)
         case attachmentThumbnail(TSResourceId, quality: AttachmentThumbnailQuality)
         case backupThumbnail(TSResourceId)
+        /// Stickers are keyed by the sticker rather than the attachment, so
+        /// every message that sends the same sticker shares one decoded image.
+        /// They're always shown at `CVComponentSticker.stickerSize`.
+        case sticker(String)
     }
 
-    private let stillMediaCache = LRUCache<CacheKey, AnyObject>(maxSize: 16,
-                                                              shouldEvacuateInBackground: true)
-    private let animatedMediaCache = LRUCache<CacheKey, AnyObject>(maxSize: 8,
-                                                                 shouldEvacuateInBackground: true)
+    // These are bounded by the decoded size of their images, so the count
+    // limits only matter for small media (e.g. stickers).
+    private let stillMediaCache = LRUCache<CacheKey, AnyObject>(maxSize: 64,
+                                                              shouldEvacuateInBackground: true,
+                                                              maxCost: 32 * 1024 * 1024)
+    private let animatedMediaCache = LRUCache<CacheKey, AnyObject>(maxSize: 24,
+                                                                 shouldEvacuateInBackground: true,
+                                                                 maxCost: 16 * 1024 * 1024)
 
     private typealias MediaViewCache = LRUCache<CacheKey, ThreadSafeCacheHandle<ReusableMediaView>>
     private let stillMediaViewCache = MediaViewCache(maxSize: 12, shouldEvacuateInBackground: true)
@@ -31,6 +39,11 @@ public class CVMediaCache: NSObject {
         AssertIsOnMainThread()
 
         super.init()
+
+        MemoryProfiler.shared.registerCache(stillMediaCache, named: "CVMediaCache.stillMedia")
+        MemoryProfiler.shared.registerCache(animatedMediaCache, named: "CVMediaCache.animatedMedia")
+        MemoryProfiler.shared.registerCache(stillMediaViewCache, named: "CVMediaCache.stillMediaView")
+        MemoryProfiler.shared.registerCache(animatedMediaViewCache, named: "CVMediaCache.animatedMediaView")
     }
 
     public func getMedia(_ key: CacheKey, isAnimated: Bool) -> AnyObject? {
@@ -40,7 +53,19 @@ public class CVMediaCache: NSObject {
 
     public func setMedia(_ value: AnyObject, forKey key: CacheKey, isAnimated: Bool) {
         let cache = isAnimated ? animatedMediaCache : stillMediaCache
-        cache.set(key: key, value: value)
+        cache.set(key: key, value: value, cost: Self.byteCost(of: value))
+    }
+
+    /// Estimates the memory used by a decoded image. Animated images only
+    /// count their first frame, since frames are decoded as they're shown.
+    private static func byteCost(of media: AnyObject) -> Int {
+        guard let image = media as? UIImage else {
+            return 0
+        }
+        if let cgImage = image.cgImage {
+            return cgImage.bytesPerRow * cgImage.height
+        }
+        return Int(image.size.width * image.scale * image.size.height * image.scale * 4)
     }
 
     public func getMediaView(_ key: CacheKey, isAnimated: Bool) -> ReusableMediaView? {
@@ -0,0 +1,192 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import SignalServiceKit
+
+/// Decodes media for the items the user is about to scroll to, so that their
+/// cells can show it as soon as they're configured.
+///
+/// CVMediaCache is otherwise only filled when a cell loads its media, so when
+/// fling-scrolling a media-heavy chat, tiles are blank until decodes catch up.
+/// The prefetcher follows the scroll direction, looks further ahead the
+/// faster the user scrolls, and drops queued work when the direction reverses.
+public class CVMediaPrefetcher {
+
+    private enum Direction {
+        /// Towards the top of the conversation, i.e. lower indices.
+        case older
+        case newer
+    }
+
+    private static let minLookaheadCount = 4
+    private static let maxLookaheadCount = 16
+    /// Scroll speed (points per second) per extra item of lookahead.
+    private static let pointsPerSecondPerItem: CGFloat = 600
+    /// Items closer than this also get a ReusableMediaView built ahead of
+    /// time. The view caches are small and these views are built on the main
+    /// thread, so this is kept well below the lookahead.
+    private static let maxViewBuildDistance = 3
+
+    private let mediaCache: CVMediaCache
+
+    private static let decodeQueue = DispatchQueue(label: "org.signal.cv-media-prefetcher", qos: .utility)
+
+    /// Queued decodes are skipped if this changes before they run.
+    private let generation = AtomicUInt(0, lock: .sharedGlobal)
+
+    private var lastContentOffsetY: CGFloat?
+    private var lastScrollTime: CFTimeInterval = 0
+    /// Smoothed, in points per second.
+    private var scrollSpeed: CGFloat = 0
+    private var direction: Direction?
+    /// Items we've already prefetched for in the current direction.
+    private var prefetchedItemIds = Set<String>()
+
+    public init(mediaCache: CVMediaCache) {
+        self.mediaCache = mediaCache
+    }
+
+    public func scrollViewDidScroll(_ collectionView: UICollectionView, renderItems: [CVRenderItem]) {
+        AssertIsOnMainThread()
+
+        let now = CACurrentMediaTime()
+        let contentOffsetY = collectionView.contentOffset.y
+        defer {
+            lastContentOffsetY = contentOffsetY
+            lastScrollTime = now
+        }
+        guard let lastContentOffsetY, now > lastScrollTime else {
+            return
+        }
+        let delta = contentOffsetY - lastContentOffsetY
+        guard delta != 0 else {
+            return
+        }
+        let instantaneousSpeed = abs(delta) / CGFloat(now - lastScrollTime)
+        scrollSpeed = scrollSpeed * 0.5 + instantaneousSpeed * 0.5
+
+        let newDirection: Direction = delta < 0 ? .older : .newer
+        if newDirection != direction {
+            cancel()
+            direction = newDirection
+        }
+
+        let visibleRows = collectionView.indexPathsForVisibleItems.map { $0.row }
+        guard let firstVisibleRow = visibleRows.min(), let lastVisibleRow = visibleRows.max() else {
+            return
+        }
+        let lookaheadCount = (Self.minLookaheadCount + Int(scrollSpeed / Self.pointsPerSecondPerItem))
+            .clamp(Self.minLookaheadCount, Self.maxLookaheadCount)
+        let rows: [Int]
+        switch newDirection {
+        case .older:
+            rows = Array((max(0, firstVisibleRow - lookaheadCount)..<firstVisibleRow).reversed())
+        case .newer:
+            rows = Array((lastVisibleRow + 1)..<min(renderItems.count, lastVisibleRow + 1 + lookaheadCount))
+        }
+
+        for (distance, row) in rows.enumerated() {
+            guard let renderItem = renderItems[safe: row] else {
+                continue
+            }
+            guard prefetchedItemIds.insert(renderItem.interactionUniqueId).inserted else {
+                continue
+            }
+            prefetch(renderItem: renderItem, shouldBuildViews: distance < Self.maxViewBuildDistance)
+        }
+    }
+
+    /// Drops any decodes that haven't started yet.
+    public func cancel() {
+        AssertIsOnMainThread()
+
+        _ = generation.increment()
+        prefetchedItemIds.removeAll()
+    }
+
+    /// Forgets the scroll position, e.g. once scrolling stops, so that the
+    /// next scroll's speed isn't computed against a stale offset.
+    public func reset() {
+        AssertIsOnMainThread()
+
+        cancel()
+        lastContentOffsetY = nil
+        scrollSpeed = 0
+        direction = nil
+    }
+
+    private func prefetch(renderItem: CVRenderItem, shouldBuildViews: Bool) {
+        let componentState = renderItem.componentState
+
+        if let bodyMedia = componentState.bodyMedia {
+            guard let displayedItems = CVMediaAlbumView.displayedItems(
+                forItems: bodyMedia.items,
+                cellMeasurement: renderItem.cellMeasurement,
+                conversationStyle: renderItem.itemModel.conversationStyle
+            ) else {
+                return
+            }
+            for (item, thumbnailQuality) in displayedItems {
+                guard let prefetchable = CVMediaView.mediaViewAdapterForPrefetch(
+                    attachment: item.attachment,
+                    isLoopingVideo: item.renderingFlag == .shouldLoop,
+                    thumbnailQuality: thumbnailQuality
+                ) else {
+                    continue
+                }
+                prefetch(
+                    mediaViewAdapter: prefetchable.adapter,
+                    isAnimated: prefetchable.isAnimated,
+                    shouldBuildView: shouldBuildViews
+                )
+            }
+        }
+
+        if case .available(let stickerMetadata, let attachmentStream) = componentState.sticker {
+            let isAnimated = attachmentStream.attachmentStream.computeContentType().isAnimatedImage
+            let adapter = MediaViewAdapterSticker(
+                stickerInfo: stickerMetadata.stickerInfo,
+                attachmentStream: attachmentStream.attachmentStream
+            )
+            prefetch(mediaViewAdapter: adapter, isAnimated: isAnimated, shouldBuildView: shouldBuildViews)
+        }
+    }
+
+    private func prefetch(mediaViewAdapter: MediaViewAdapterSwift, isAnimated: Bool, shouldBuildView: Bool) {
+        let cacheKey = mediaViewAdapter.cacheKey
+        let isMediaAnimated = mediaViewAdapter.shouldBeRenderedByYY
+
+        if shouldBuildView, mediaCache.getMediaView(cacheKey, isAnimated: isAnimated) == nil {
+            // CVMediaView and CVComponentSticker pick this up instead of
+            // building their own.
+            let reusableMediaView = ReusableMediaView(mediaViewAdapter: mediaViewAdapter, mediaCache: mediaCache)
+            mediaCache.setMediaView(reusableMediaView, forKey: cacheKey, isAnimated: isAnimated)
+        }
+
+        guard mediaCache.getMedia(cacheKey, isAnimated: isMediaAnimated) == nil else {
+            return
+        }
+
+        let mediaCache = self.mediaCache
+        let generation = self.generation
+        let expectedGeneration = generation.get()
+        firstly(on: Self.decodeQueue) { () -> Promise<AnyObject> in
+            guard generation.get() == expectedGeneration else {
+                throw ReusableMediaError.redundantLoad
+            }
+            return mediaViewAdapter.loadMedia()
+        }.done(on: DispatchQueue.main) { (media: AnyObject) in
+            // A visible cell may have loaded it in the meantime.
+            if mediaCache.getMedia(cacheKey, isAnimated: isMediaAnimated) == nil {
+                mediaCache.setMedia(media, forKey: cacheKey, isAnimated: isMediaAnimated)
+            }
+        }.ensure(on: DispatchQueue.main) {
+            // The adapter owns a view, so make sure it's released on main.
+            withExtendedLifetime(mediaViewAdapter) {}
+        }.catch(on: DispatchQueue.main) { _ in
+            // The cell will retry (and report any errors) when it loads.
+        }
+    }
+}
@@ -87,6 +87,7 @@ public class CVViewState: NSObject {
     public var sendMessageController: SendMessageController?
 
     public let mediaCache = CVMediaCache()
+    public lazy var mediaPrefetcher = CVMediaPrefetcher(mediaCache: mediaCache)
 
     let contactShareViewHelper = ContactShareViewHelper()
 
@@ -276,6 +277,8 @@ extension ConversationViewController {
 
     var mediaCache: CVMediaCache { viewState.mediaCache }
 
+    var mediaPrefetcher: CVMediaPrefetcher { viewState.mediaPrefetcher }
+
     var groupCallBarButtonItem: UIBarButtonItem? {
         get { viewState.groupCallBarButtonItem }
         set { viewState.groupCallBarButtonItem = newValue }
@@ -44,12 +44,11 @@ public class CVMediaAlbumView: ManualStackViewWithLayer {
 
         self.items = items
 
-        let viewSizePoints = imageArrangement.worstCaseMediaRenderSizePoints(conversationStyle: conversationStyle)
-        self.itemViews = CVMediaAlbumView.itemsToDisplay(forItems: items).map { item in
-            let thumbnailQuality = Self.thumbnailQuality(
-                mediaSizePoints: item.mediaSize,
-                viewSizePoints: viewSizePoints
-            )
+        self.itemViews = Self.displayedItems(
+            forItems: items,
+            imageArrangement: imageArrangement,
+            conversationStyle: conversationStyle
+        ).map { item, thumbnailQuality in
             return CVMediaView(
                 mediaCache: mediaCache,
                 attachment: item.attachment,
@@ -510,6 +509,36 @@ public class CVMediaAlbumView: ManualStackViewWithLayer {
         return moreItemsView == mediaView
     }
 
+    /// The items that are displayed, with the thumbnail quality each is
+    /// rendered at.
+    private static func displayedItems(
+        forItems items: [CVMediaAlbumItem],
+        imageArrangement: ImageArrangement,
+        conversationStyle: ConversationStyle
+    ) -> [(CVMediaAlbumItem, AttachmentThumbnailQuality)] {
+        let viewSizePoints = imageArrangement.worstCaseMediaRenderSizePoints(conversationStyle: conversationStyle)
+        return itemsToDisplay(forItems: items).map { item in
+            (item, thumbnailQuality(mediaSizePoints: item.mediaSize, viewSizePoints: viewSizePoints))
+        }
+    }
+
+    /// Same as `displayedItems(forItems:imageArrangement:conversationStyle:)`,
+    /// for callers that only have the cell's measurement (e.g. prefetching).
+    static func displayedItems(
+        forItems items: [CVMediaAlbumItem],
+        cellMeasurement: CVCellMeasurement,
+        conversationStyle: ConversationStyle
+    ) -> [(CVMediaAlbumItem, AttachmentThumbnailQuality)]? {
+        guard let imageArrangementWrapper: CVMeasurementImageArrangement = cellMeasurement.object(key: Self.measurementKey_imageArrangement) else {
+            return nil
+        }
+        return displayedItems(
+            forItems: items,
+            imageArrangement: imageArrangementWrapper.imageArrangement,
+            conversationStyle: conversationStyle
+        )
+    }
+
     private static func thumbnailQuality(
         mediaSizePoints: CGSize,
         viewSizePoints: CGSize
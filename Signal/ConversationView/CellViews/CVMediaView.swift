@@ -248,6 +248,39 @@ public class CVMediaView: ManualLayoutViewWithLayer {
         createNewReusableMediaView(mediaViewAdapter: mediaViewAdapter, isAnimated: false)
     }
 
+    /// The adapter (and which media cache it uses) that this view would build
+    /// for `attachment`, so that CVMediaPrefetcher fills the same cache
+    /// entries. This must stay in sync with the `configureFor…` methods above.
+    static func mediaViewAdapterForPrefetch(
+        attachment: CVAttachment,
+        isLoopingVideo: Bool,
+        thumbnailQuality: AttachmentThumbnailQuality
+    ) -> (adapter: MediaViewAdapterSwift, isAnimated: Bool)? {
+        switch attachment {
+        case .backupThumbnail(let thumbnail):
+            return (MediaViewAdapterBackupThumbnail(attachmentBackupThumbnail: thumbnail.attachmentBackupThumbnail), false)
+        case .pointer(let pointer, _):
+            guard let blurHash = pointer.attachmentPointer.resource.resourceBlurHash?.nilIfEmpty else {
+                return nil
+            }
+            return (MediaViewAdapterBlurHash(blurHash: blurHash), false)
+        case .stream(let attachmentStream):
+            let attachmentStream = attachmentStream.attachmentStream
+            switch attachmentStream.computeContentType() {
+            case .image:
+                return (MediaViewAdapterStill(attachmentStream: attachmentStream, thumbnailQuality: thumbnailQuality), false)
+            case .animatedImage:
+                return (MediaViewAdapterAnimated(attachmentStream: attachmentStream), true)
+            case .video where isLoopingVideo:
+                return (MediaViewAdapterLoopingVideo(attachmentStream: attachmentStream), true)
+            case .video:
+                return (MediaViewAdapterVideo(attachmentStream: attachmentStream, thumbnailQuality: thumbnailQuality), false)
+            case .audio, .file, .invalid:
+                return nil
+            }
+        }
+    }
+
     private func addVideoPlayButton() {
 
         let playVideoButtonWidth: CGFloat = 44
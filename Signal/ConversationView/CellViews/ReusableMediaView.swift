@@ -370,13 +370,24 @@ class MediaViewAdapterStill: MediaViewAdapterSwift {
         .attachmentThumbnail(attachmentStream.resourceId, quality: thumbnailQuality)
     }
 
+    // Cancelled on unload so that cells that have scrolled off screen don't
+    // hold up loading thumbnails for the ones that are visible.
+    private let thumbnailTask = AtomicOptional<Task<UIImage?, Never>>(nil, lock: .sharedGlobal)
+
     func loadMedia() -> Promise<AnyObject> {
         guard attachmentStream.computeContentType().isImage else {
             return Promise(error: ReusableMediaError.invalidMedia)
         }
+        let task = Task { [attachmentStream, thumbnailQuality] in
+            await attachmentStream.thumbnailImage(quality: thumbnailQuality)
+        }
+        thumbnailTask.set(task)
         return Promise.wrapAsync {
-            let image = await self.attachmentStream.thumbnailImage(quality: self.thumbnailQuality)
+            let image = await task.value
             guard let image else {
+                if task.isCancelled {
+                    throw ReusableMediaError.redundantLoad
+                }
                 throw OWSAssertionError("Could not load thumbnail")
             }
             return image
@@ -396,6 +407,7 @@ class MediaViewAdapterStill: MediaViewAdapterSwift {
     func unloadMedia() {
         AssertIsOnMainThread()
 
+        thumbnailTask.swap(nil)?.cancel()
         imageView.image = nil
     }
 }
@@ -477,13 +489,24 @@ class MediaViewAdapterVideo: MediaViewAdapterSwift {
         .attachmentThumbnail(attachmentStream.resourceId, quality: thumbnailQuality)
     }
 
+    // Cancelled on unload so that cells that have scrolled off screen don't
+    // hold up loading thumbnails for the ones that are visible.
+    private let thumbnailTask = AtomicOptional<Task<UIImage?, Never>>(nil, lock: .sharedGlobal)
+
     func loadMedia() -> Promise<AnyObject> {
         guard attachmentStream.computeContentType().isVideo else {
             return Promise(error: ReusableMediaError.invalidMedia)
         }
+        let task = Task { [attachmentStream, thumbnailQuality] in
+            await attachmentStream.thumbnailImage(quality: thumbnailQuality)
+        }
+        thumbnailTask.set(task)
         return Promise.wrapAsync {
-            let image = await self.attachmentStream.thumbnailImage(quality: self.thumbnailQuality)
+            let image = await task.value
             guard let image else {
+                if task.isCancelled {
+                    throw ReusableMediaError.redundantLoad
+                }
                 throw OWSAssertionError("Could not load thumbnail")
             }
             return image
@@ -503,6 +526,7 @@ class MediaViewAdapterVideo: MediaViewAdapterSwift {
     func unloadMedia() {
         AssertIsOnMainThread()
 
+        thumbnailTask.swap(nil)?.cancel()
         imageView.image = nil
     }
 }
@@ -512,11 +536,13 @@ class MediaViewAdapterVideo: MediaViewAdapterSwift {
 public class MediaViewAdapterSticker: NSObject, MediaViewAdapterSwift {
 
     public let shouldBeRenderedByYY: Bool
+    let stickerInfo: StickerInfo
     let attachmentStream: TSResourceStream
     let imageView: UIImageView
 
-    public init(attachmentStream: TSResourceStream) {
+    public init(stickerInfo: StickerInfo, attachmentStream: TSResourceStream) {
         self.shouldBeRenderedByYY = attachmentStream.computeContentType().isAnimatedImage
+        self.stickerInfo = stickerInfo
         self.attachmentStream = attachmentStream
 
         if shouldBeRenderedByYY {
@@ -537,7 +563,7 @@ public class MediaViewAdapterSticker: NSObject, MediaViewAdapterSwift {
     }
 
     public var cacheKey: CVMediaCache.CacheKey {
-        .attachment(attachmentStream.resourceId)
+        .sticker(stickerInfo.asKey())
     }
 
     public func loadMedia() -> Promise<AnyObject> {
@@ -79,7 +79,7 @@ public class CVComponentAudioAttachment: CVComponentBase, CVComponent {
         if let incomingMessage = interaction as? TSIncomingMessage {
             audioMessageView.setViewed(incomingMessage.wasViewed, animated: false)
         } else if let outgoingMessage = interaction as? TSOutgoingMessage {
-            audioMessageView.setViewed(!outgoingMessage.viewedRecipientAddresses().isEmpty, animated: false)
+            audioMessageView.setViewed(outgoingMessage.wasViewedByAnyRecipient, animated: false)
         }
         audioMessageView.configureForRendering(
             cellMeasurement: cellMeasurement,
@@ -310,7 +310,14 @@ public class CVComponentAudioAttachment: CVComponentBase, CVComponent {
 // MARK: - CVAudioPlayerListener
 
 extension CVComponentAudioAttachment: CVAudioPlayerListener {
-    func audioPlayerStateDidChange(attachmentId: TSResourceId) {}
+    func audioPlayerStateDidChange(attachmentId: TSResourceId) {
+        guard attachmentId == audioAttachment.attachment.resourceId else { return }
+        // Load the next attachment while this one plays, so autoplay can
+        // start it right away.
+        if cvAudioPlayer.audioPlaybackState(forAttachmentId: attachmentId) == .playing {
+            cvAudioPlayer.preloadAudioAttachment(nextAudioAttachment)
+        }
+    }
 
     func audioPlayerDidFinish(attachmentId: TSResourceId) {
         guard attachmentId == audioAttachment.attachment.resourceId else { return }
@@ -1148,11 +1148,7 @@ fileprivate extension CVComponentState.Builder {
             let renderingFlag = mediaAttachment.reference.renderingFlag
             if let attachmentStream = mediaAttachment.attachment.asResourceStream() {
                 if attachmentStream.computeIsValidVisualMedia()
-                    && (
-                        MimeTypeUtil.isSupportedImageMimeType(attachmentStream.mimeType)
-                        || MimeTypeUtil.isSupportedMaybeAnimatedMimeType(attachmentStream.mimeType)
-                        || MimeTypeUtil.isSupportedVideoMimeType(attachmentStream.mimeType)
-                    )
+                    && MimeTypeUtil.isSupportedVisualMediaMimeType(attachmentStream.mimeType)
                 {
                     return buildViewOnce(viewOnceState: .incomingAvailable(
                         attachmentStream: attachmentStream,
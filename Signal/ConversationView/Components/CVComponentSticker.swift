@@ -48,14 +48,17 @@ public class CVComponentSticker: CVComponentBase, CVComponent {
         let stackView = componentView.stackView
 
         switch sticker {
-        case .available(_, let attachmentStream):
-            let cacheKey = CVMediaCache.CacheKey.attachment(attachmentStream.attachment.resourceId)
+        case .available(let stickerMetadata, let attachmentStream):
+            let cacheKey = CVMediaCache.CacheKey.sticker(stickerMetadata.stickerInfo.asKey())
             let isAnimated = attachmentStream.attachmentStream.computeContentType().isAnimatedImage
             let reusableMediaView: ReusableMediaView
             if let cachedView = mediaCache.getMediaView(cacheKey, isAnimated: isAnimated) {
                 reusableMediaView = cachedView
             } else {
-                let mediaViewAdapter = MediaViewAdapterSticker(attachmentStream: attachmentStream.attachmentStream)
+                let mediaViewAdapter = MediaViewAdapterSticker(
+                    stickerInfo: stickerMetadata.stickerInfo,
+                    attachmentStream: attachmentStream.attachmentStream
+                )
                 reusableMediaView = ReusableMediaView(mediaViewAdapter: mediaViewAdapter, mediaCache: mediaCache)
                 mediaCache.setMediaView(reusableMediaView, forKey: cacheKey, isAnimated: isAnimated)
             }
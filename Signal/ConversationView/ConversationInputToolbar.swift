@@ -294,6 +294,7 @@ public class ConversationInputToolbar: UIView, LinkPreviewViewDraftDelegate, Quo
         let view = RightEdgeControlsView()
         view.sendButton.addTarget(self, action: #selector(sendButtonPressed), for: .touchUpInside)
         view.cameraButton.addTarget(self, action: #selector(cameraButtonPressed), for: .touchUpInside)
+        view.cameraButton.addTarget(self, action: #selector(cameraButtonTouchDown), for: .touchDown)
         // We want to be permissive about the voice message gesture, so we hang
         // the long press GR on the button's wrapper, not the button itself.
         let longPressGestureRecognizer = UILongPressGestureRecognizer(target: self, action: #selector(handleVoiceMemoLongPress(gesture:)))
@@ -1949,6 +1950,11 @@ public class ConversationInputToolbar: UIView, LinkPreviewViewDraftDelegate, Quo
             }
 
             setDesiredKeyboardType(keyboardType, animated: animated)
+
+            if keyboardType == .attachment {
+                // The attachment keyboard offers the camera.
+                CameraCaptureSessionWarmer.shared.warmUp()
+            }
         }
 
         beginEditingMessage()
@@ -2088,6 +2094,12 @@ extension ConversationInputToolbar {
         inputToolbarDelegate.cameraButtonPressed()
     }
 
+    @objc
+    private func cameraButtonTouchDown() {
+        // Get the camera going while the button is still held.
+        CameraCaptureSessionWarmer.shared.warmUp()
+    }
+
     @objc
     private func addOrCancelButtonPressed() {
         ImpactHapticFeedback.impactOccurred(style: .light)
@@ -2201,6 +2213,9 @@ extension ConversationInputToolbar: ConversationTextViewToolbarDelegate {
         ensureButtonVisibility(withAnimation: true, doLayout: true)
         updateInputLinkPreview()
 
+        // Composing a message makes sending a photo with it more likely.
+        CameraCaptureSessionWarmer.shared.warmUp()
+
         if editTarget != nil {
             rightEdgeControlsView.sendButton.isEnabled = textView.hasText
         }
@@ -150,6 +150,10 @@ extension ConversationViewController: UIScrollViewDelegate {
         updateScrollingContent()
 
         updateContextMenuInteractionIfNeeded()
+
+        if isUserScrolling || isWaitingForDeceleration {
+            mediaPrefetcher.scrollViewDidScroll(collectionView, renderItems: renderItems)
+        }
     }
 
     private func scheduleScrollUpdateTimer() {
@@ -204,6 +208,7 @@ extension ConversationViewController: UIScrollViewDelegate {
 
         if !willDecelerate {
             scrollingAnimationDidComplete()
+            mediaPrefetcher.reset()
         }
 
         if !isUserScrolling {
@@ -224,6 +229,8 @@ extension ConversationViewController: UIScrollViewDelegate {
 
         scrollingAnimationDidComplete()
 
+        mediaPrefetcher.reset()
+
         if !isWaitingForDeceleration {
             return
         }
@@ -406,7 +406,7 @@ public final class ConversationViewController: OWSViewController {
             Task {
                 let profileFetcher = SSKEnvironment.shared.profileFetcherRef
                 for serviceId in serviceIds {
-                    _ = try? await profileFetcher.fetchProfile(for: serviceId, options: [.opportunistic])
+                    _ = try? await profileFetcher.fetchProfile(for: serviceId, options: [.opportunistic, .userVisible])
                 }
             }
             self.updateV2GroupIfNecessary()
@@ -483,11 +483,13 @@ public final class ConversationViewController: OWSViewController {
         self.shouldAnimateKeyboardChanges = false
 
         self.cvAudioPlayer.stopAll()
+        CameraCaptureSessionWarmer.shared.coolDown()
 
         self.cancelReadTimer()
         self.saveDraft()
         self.markVisibleMessagesAsRead()
         self.finishRecordingVoiceMessage(sendImmediately: false)
+        self.mediaPrefetcher.reset()
         self.mediaCache.removeAllObjects()
         inputToolbar?.clearDesiredKeyboard()
 
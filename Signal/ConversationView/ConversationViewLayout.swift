@@ -101,6 +101,12 @@ public class ConversationViewLayout: UICollectionViewLayout {
         let footerLayoutAttributes: UICollectionViewLayoutAttributes?
         let itemLayouts: [ItemLayout]
         let renderStateId: UInt
+        // The rows whose frames were moved for sticky date headers, and
+        // therefore may not be in order. Empty for "at rest" layouts.
+        let translatedRows: [Int]
+
+        // Built lazily; only "at rest" layouts need it.
+        private(set) lazy var dateHeaderItemLayouts: [ItemLayout] = itemLayouts.filter { $0.isStickyHeader }
 
         required init(viewWidth: CGFloat,
                       contentSize: CGSize,
@@ -108,7 +114,8 @@ public class ConversationViewLayout: UICollectionViewLayout {
                       headerLayoutAttributes: UICollectionViewLayoutAttributes?,
                       footerLayoutAttributes: UICollectionViewLayoutAttributes?,
                       itemLayouts: [ItemLayout],
-                      renderStateId: UInt) {
+                      renderStateId: UInt,
+                      translatedRows: [Int] = []) {
             self.viewWidth = viewWidth
             self.contentSize = contentSize
             self.layoutAttributesMap = layoutAttributesMap
@@ -116,6 +123,31 @@ public class ConversationViewLayout: UICollectionViewLayout {
             self.footerLayoutAttributes = footerLayoutAttributes
             self.itemLayouts = itemLayouts
             self.renderStateId = renderStateId
+            self.translatedRows = translatedRows
+        }
+
+        // Items are laid out top to bottom, so in an "at rest" layout both
+        // the tops and the bottoms of their frames are in order and we can
+        // binary search for the items near a rect.
+        func rowsOfItems(near rect: CGRect) -> Range<Int> {
+            owsAssertDebug(translatedRows.isEmpty)
+
+            func firstRow(where predicate: (CGRect) -> Bool) -> Int {
+                var lowerBound = 0
+                var upperBound = itemLayouts.count
+                while lowerBound < upperBound {
+                    let middle = (lowerBound + upperBound) / 2
+                    if predicate(itemLayouts[middle].frame) {
+                        upperBound = middle
+                    } else {
+                        lowerBound = middle + 1
+                    }
+                }
+                return lowerBound
+            }
+            let startRow = firstRow { $0.maxY >= rect.minY }
+            let endRow = firstRow { $0.minY > rect.maxY }
+            return startRow..<max(startRow, endRow)
         }
 
         func layoutAttributesForItem(at indexPath: IndexPath, assertIfMissing: Bool) -> UICollectionViewLayoutAttributes? {
@@ -174,6 +206,9 @@ public class ConversationViewLayout: UICollectionViewLayout {
             translatedLayoutInfo = nil
         }
     }
+    // The last "at rest" layout, kept after it is invalidated so that
+    // the next layout can reuse the attributes of items that didn't move.
+    private var staleLayoutInfo: LayoutInfo?
 
     private func ensureCurrentLayoutInfo() -> LayoutInfo {
         AssertIsOnMainThread()
@@ -184,7 +219,8 @@ public class ConversationViewLayout: UICollectionViewLayout {
 
         ensureState()
 
-        let layoutInfo = Self.buildLayoutInfo(state: currentState)
+        let layoutInfo = Self.buildLayoutInfo(state: currentState, staleLayoutInfo: staleLayoutInfo)
+        staleLayoutInfo = nil
         currentLayoutInfo = layoutInfo
         hasEverHadLayout = true
         return layoutInfo
@@ -262,18 +298,8 @@ public class ConversationViewLayout: UICollectionViewLayout {
             return frame.y >= topOfViewportY
         }
 
-        // Find all date headers.
-        var dateHeaderItemLayouts = [ItemLayout]()
-        for itemLayout in layoutInfo.itemLayouts {
-            guard itemLayout.isStickyHeader else {
-                continue
-            }
-            dateHeaderItemLayouts.append(itemLayout)
-        }
-        // Sort the date headers.
-        dateHeaderItemLayouts.sort { (left, right) in
-            left.frame.y < right.frame.y
-        }
+        // Find all date headers. They are already sorted by y.
+        var dateHeaderItemLayouts = layoutInfo.dateHeaderItemLayouts
         // The sticky date header is either:
         //
         // * The last date header if no date headers are in or below the viewport.
@@ -368,20 +394,19 @@ public class ConversationViewLayout: UICollectionViewLayout {
 
         var layoutAttributesMap = layoutInfo.layoutAttributesMap
         var itemLayouts = layoutInfo.itemLayouts
+        var translatedRows = [Int]()
 
         func updateItemLayout(_ newItemLayout: ItemLayout) {
+            let row = newItemLayout.indexPath.row
+
             // Update layoutAttributesMap.
-            layoutAttributesMap[newItemLayout.indexPath.row] = newItemLayout.layoutAttributes
+            layoutAttributesMap[row] = newItemLayout.layoutAttributes
 
-            // Update itemLayouts.
-            itemLayouts = itemLayouts.map { (itemLayout: ItemLayout) -> ItemLayout in
-                if itemLayout.indexPath == newItemLayout.indexPath {
-                    // Replace this itemLayout with the stickyItemLayout
-                    return newItemLayout
-                } else {
-                    return itemLayout
-                }
-            }
+            // Update itemLayouts. Each item's row is its index.
+            owsAssertDebug(itemLayouts[row].indexPath == newItemLayout.indexPath)
+            itemLayouts[row] = newItemLayout
+
+            translatedRows.append(row)
         }
 
         // "At rest", the sticky header should be aligned with the top of the viewport,
@@ -442,7 +467,8 @@ public class ConversationViewLayout: UICollectionViewLayout {
                                             headerLayoutAttributes: layoutInfo.headerLayoutAttributes,
                                             footerLayoutAttributes: layoutInfo.footerLayoutAttributes,
                                             itemLayouts: itemLayouts,
-                                            renderStateId: layoutInfo.renderStateId)
+                                            renderStateId: layoutInfo.renderStateId,
+                                            translatedRows: translatedRows)
         // Update the cache.
         self.translatedLayoutInfo = TranslatedLayoutInfo(layoutInfo: adjustedLayoutInfo,
                                                          collectionViewSize: collectionViewSize,
@@ -506,6 +532,9 @@ public class ConversationViewLayout: UICollectionViewLayout {
 
         currentState = newState
 
+        if let currentLayoutInfo {
+            staleLayoutInfo = currentLayoutInfo
+        }
         currentLayoutInfo = nil
     }
 
@@ -551,7 +580,12 @@ public class ConversationViewLayout: UICollectionViewLayout {
         }
     }
 
-    private static func buildLayoutInfo(state: State?) -> LayoutInfo {
+    // Item frames are a running sum of the item heights and spacings, so
+    // they're cheap to recompute. Allocating new layout attributes for every
+    // item is not, so we reuse the stale layout's attributes for any item
+    // whose row, frame and z-index haven't changed, e.g. every item above a
+    // new message, typing indicator or reaction.
+    private static func buildLayoutInfo(state: State?, staleLayoutInfo: LayoutInfo?) -> LayoutInfo {
         AssertIsOnMainThread()
 
         func buildEmptyLayoutInfo() -> LayoutInfo {
@@ -579,9 +613,15 @@ public class ConversationViewLayout: UICollectionViewLayout {
             return buildEmptyLayoutInfo()
         }
 
+        // Reused attributes must have the same width.
+        let staleItemLayouts = (staleLayoutInfo?.viewWidth == viewWidth
+                                    ? staleLayoutInfo?.itemLayouts ?? []
+                                    : [])
+
         var y: CGFloat = 0
 
         var layoutAttributesMap = [Int: UICollectionViewLayoutAttributes]()
+        layoutAttributesMap.reserveCapacity(layoutItems.count)
         var headerLayoutAttributes: UICollectionViewLayoutAttributes?
         var footerLayoutAttributes: UICollectionViewLayoutAttributes?
 
@@ -621,12 +661,17 @@ public class ConversationViewLayout: UICollectionViewLayout {
             let itemFrame = CGRect(x: 0, y: y, width: viewWidth, height: layoutSize.height)
 
             let indexPath = IndexPath(row: row, section: 0)
-            let layoutAttributes = CVCollectionViewLayoutAttributes(forCellWith: indexPath)
-            layoutAttributes.frame = itemFrame
-            if layoutItem.isDateHeader {
-                layoutAttributes.zIndex = Self.zIndexStickyHeader
+            let zIndex = layoutItem.isDateHeader ? Self.zIndexStickyHeader : Self.zIndexDefault
+            let layoutAttributes: UICollectionViewLayoutAttributes
+            if let staleItemLayout = staleItemLayouts[safe: row],
+               staleItemLayout.interactionUniqueId == layoutItem.interactionUniqueId,
+               staleItemLayout.frame == itemFrame,
+               staleItemLayout.layoutAttributes.zIndex == zIndex {
+                layoutAttributes = staleItemLayout.layoutAttributes
             } else {
-                layoutAttributes.zIndex = Self.zIndexDefault
+                layoutAttributes = CVCollectionViewLayoutAttributes(forCellWith: indexPath)
+                layoutAttributes.frame = itemFrame
+                layoutAttributes.zIndex = zIndex
             }
             layoutAttributesMap[row] = layoutAttributes
 
@@ -681,11 +726,23 @@ public class ConversationViewLayout: UICollectionViewLayout {
         // Return values from the "translated" layout info.
         let layoutInfo = ensureTranslatedLayoutInfo()
 
+        // Find the candidate rows in the "at rest" layout, which is sorted,
+        // plus any rows moved for sticky headers.
+        var rows = Array(ensureCurrentLayoutInfo().rowsOfItems(near: rect))
+        for translatedRow in layoutInfo.translatedRows where !rows.contains(translatedRow) {
+            rows.append(translatedRow)
+        }
+        rows.sort()
+
         var result = [UICollectionViewLayoutAttributes]()
         if let headerLayoutAttributes = layoutInfo.headerLayoutAttributes {
             result.append(headerLayoutAttributes)
         }
-        for itemLayout in layoutInfo.itemLayouts {
+        for row in rows {
+            guard let itemLayout = layoutInfo.itemLayouts[safe: row] else {
+                owsFailDebug("Missing item layout for row: \(row)")
+                continue
+            }
             result.append(itemLayout.layoutAttributes)
         }
         if let footerLayoutAttributes = layoutInfo.footerLayoutAttributes {
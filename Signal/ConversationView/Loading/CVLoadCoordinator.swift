@@ -561,6 +561,9 @@ public class CVLoadCoordinator: NSObject {
             return
         }
 
+        let applyInterval = Tracing.beginInterval(.conversationView, "Apply", metadata: "\(loadRequest.requestId)")
+        defer { applyInterval.end() }
+
         let renderState = update.renderState
         let updateToken = delegate.willUpdateWithNewRenderState(renderState)
 
@@ -585,6 +588,12 @@ extension CVLoadCoordinator: DatabaseChangeDelegate {
         guard databaseChanges.threadUniqueIds.contains(threadUniqueId) else {
             return
         }
+        if let threadChanges = databaseChanges.interactionChangesByThreadUniqueId?[threadUniqueId] {
+            // Only reload this thread's interactions.
+            enqueueReload(updatedInteractionIds: threadChanges.insertedInteractionUniqueIds.union(threadChanges.updatedInteractionUniqueIds),
+                          deletedInteractionIds: threadChanges.deletedInteractionUniqueIds)
+            return
+        }
         enqueueReload(updatedInteractionIds: databaseChanges.interactionUniqueIds,
                       deletedInteractionIds: databaseChanges.interactionDeletedUniqueIds)
     }
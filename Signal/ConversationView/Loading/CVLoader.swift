@@ -47,6 +47,9 @@ public class CVLoader: NSObject {
         }
 
         return firstly(on: CVUtils.workQueue(isInitialLoad: loadRequest.isInitialLoad)) { () -> CVUpdate in
+            let loadInterval = Tracing.beginInterval(.conversationView, "Load", metadata: "\(loadRequest.requestId)")
+            defer { loadInterval.end() }
+
             // To ensure coherency, the entire load should be done with a single transaction.
             let loadState: LoadState = try Self.databaseStorage.read { transaction in
                 let thread = TSThread.anyFetch(uniqueId: threadUniqueId, transaction: transaction)
@@ -166,7 +169,9 @@ public class CVLoader: NSObject {
                 return LoadState(
                     threadViewModel: threadViewModel,
                     conversationViewModel: conversationViewModel,
-                    items: self.buildRenderItems(loadContext: loadContext, updatedInteractionIds: updatedInteractionIds)
+                    items: Tracing.withInterval(.conversationView, "BuildRenderItems", metadata: "\(loadRequest.requestId)") {
+                        self.buildRenderItems(loadContext: loadContext, updatedInteractionIds: updatedInteractionIds)
+                    }
                 )
             }
 
@@ -181,11 +186,13 @@ public class CVLoader: NSObject {
                 loadType: loadRequest.loadType
             )
 
-            let update = CVUpdate.build(
-                renderState: renderState,
-                prevRenderState: prevRenderState,
-                loadRequest: loadRequest
-            )
+            let update = Tracing.withInterval(.conversationView, "BuildUpdate", metadata: "\(loadRequest.requestId)") {
+                CVUpdate.build(
+                    renderState: renderState,
+                    prevRenderState: prevRenderState,
+                    loadRequest: loadRequest
+                )
+            }
 
             return update
         }
@@ -216,8 +223,26 @@ public class CVLoader: NSObject {
         }
         let itemModels: [CVItemModel] = itemModelBuilder.buildItems()
 
+        // Building the root component and measuring it is most of the cost of
+        // a render item, but most loads (e.g. a message arriving in an active
+        // group) only affect a few items. We reuse previous render items that
+        // would render identically. Item view state is rebuilt for every item
+        // above and reflects its neighbors (clustering, date breaks, footers),
+        // so the neighbors of a changed item are rebuilt too.
+        var reusableRenderItems = [String: CVRenderItem]()
+        if canReuseState {
+            for renderItem in prevRenderState.items where !updatedInteractionIds.contains(renderItem.interactionUniqueId) {
+                reusableRenderItems[renderItem.interactionUniqueId] = renderItem
+            }
+        }
+
         var renderItems = [CVRenderItem]()
         for itemModel in itemModels {
+            if let prevRenderItem = reusableRenderItems[itemModel.interaction.uniqueId],
+               Self.canReuseRenderItem(prevRenderItem, for: itemModel) {
+                renderItems.append(prevRenderItem)
+                continue
+            }
             guard let renderItem = buildRenderItem(itemBuildingContext: loadContext,
                                                    itemModel: itemModel) else {
                 continue
@@ -228,6 +253,16 @@ public class CVLoader: NSObject {
         return renderItems
     }
 
+    private static func canReuseRenderItem(_ renderItem: CVRenderItem, for itemModel: CVItemModel) -> Bool {
+        // The interaction and component state are only the same instances if
+        // they were reused (i.e. the interaction wasn't updated). Synthetic
+        // interactions like date headers are rebuilt every load, so they're
+        // never reused, but they're cheap to build.
+        return (renderItem.interaction === itemModel.interaction &&
+                    renderItem.componentState === itemModel.componentState &&
+                    renderItem.itemViewState == itemModel.itemViewState)
+    }
+
     private func buildRenderItem(itemBuildingContext: CVItemBuildingContext,
                                  itemModel: CVItemModel) -> CVRenderItem? {
         Self.buildRenderItem(itemBuildingContext: itemBuildingContext,
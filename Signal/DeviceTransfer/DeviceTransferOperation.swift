@@ -16,6 +16,7 @@ class DeviceTransferOperation: OWSOperation, @unchecked Sendable {
 
     class func scheduleTransfer(file: DeviceTransferProtoFile, priority: Operation.QueuePriority = .normal) -> Promise<Void> {
         let operation = DeviceTransferOperation(file: file)
+        operation.queuePriority = priority
         operationQueue.addOperation(operation)
         return operation.promise
     }
@@ -62,7 +63,7 @@ class DeviceTransferOperation: OWSOperation, @unchecked Sendable {
 
     private var progress: Progress?
     private func prepareForSending() {
-        guard case .outgoing(let newDevicePeerId, _, _, let transferredFiles, let progress) = deviceTransferService.transferState else {
+        guard case .outgoing(_, _, _, let transferredFiles, let progress) = deviceTransferService.transferState else {
             return reportError(OWSAssertionError("Tried to transfer file while in unexpected state: \(deviceTransferService.transferState)"))
         }
 
@@ -96,8 +97,20 @@ class DeviceTransferOperation: OWSOperation, @unchecked Sendable {
             }
         }
 
-        guard let sha256Digest = try? Cryptography.computeSHA256DigestOfFile(at: url) else {
-            return reportError(OWSAssertionError("Failed to calculate sha256 for file"))
+        // Hashing reads the whole file, so keep it off the main thread. Otherwise
+        // every concurrent transfer waits on the main thread to hash its file
+        // before it can start sending.
+        DispatchQueue.global(qos: .userInitiated).async {
+            guard let sha256Digest = try? Cryptography.computeSHA256DigestOfFile(at: url) else {
+                return self.reportError(OWSAssertionError("Failed to calculate sha256 for file"))
+            }
+            DispatchQueue.main.async { self.send(url: url, sha256Digest: sha256Digest, progress: progress) }
+        }
+    }
+
+    private func send(url: URL, sha256Digest: Data, progress: Progress) {
+        guard case .outgoing(let newDevicePeerId, _, _, _, _) = deviceTransferService.transferState else {
+            return reportError(OWSAssertionError("Tried to transfer file while in unexpected state: \(deviceTransferService.transferState)"))
         }
 
         guard let session = deviceTransferService.session else {
@@ -63,7 +63,34 @@ class EmojiPickerCollectionView: UICollectionView {
 
     private var emojiSearchResults: [EmojiWithSkinTones] = []
     private var emojiSearchLocalization: String?
-    private var emojiSearchIndex: [String: [String]]?
+    private var emojiSearchIndex: [String: [String]]? {
+        didSet {
+            searchableEmoji = nil
+            lastSearch = nil
+        }
+    }
+
+    private struct SearchableEmoji {
+        let emoji: EmojiWithSkinTones
+        /// Lowercased once, rather than on every keystroke.
+        let terms: [String]
+    }
+
+    /// The search terms for every sendable emoji, built on first search and
+    /// whenever the search index changes.
+    private var searchableEmoji: [SearchableEmoji]?
+
+    private struct Search {
+        let text: String
+        /// Indexes into `searchableEmoji` of every emoji that matched, in
+        /// ascending order.
+        let matchingIndexes: [Int]
+    }
+
+    /// Typing narrows a search, and every emoji that matches the longer text
+    /// also matched the shorter one, so each keystroke only needs to check
+    /// the previous keystroke's matches.
+    private var lastSearch: Search?
 
     public var isSearching: Bool {
         if let searchText = searchText, !searchText.isEmpty {
@@ -318,7 +345,7 @@ class EmojiPickerCollectionView: UICollectionView {
     }
 
     private func searchResults(_ searchText: String?) -> [EmojiWithSkinTones] {
-        guard let searchText = searchText?.stripped else {
+        guard let searchText = searchText?.stripped, !searchText.isEmpty else {
             return []
         }
 
@@ -329,32 +356,58 @@ class EmojiPickerCollectionView: UICollectionView {
             return [searchEmoji]
         }
 
+        let searchableEmoji: [SearchableEmoji]
+        if let existingSearchableEmoji = self.searchableEmoji {
+            searchableEmoji = existingSearchableEmoji
+        } else {
+            searchableEmoji = allSendableEmoji.map { emoji in
+                let terms = emojiSearchIndex?[emoji.baseEmoji.rawValue] ?? [emoji.baseEmoji.name]
+                return SearchableEmoji(emoji: emoji, terms: terms.map { $0.lowercased() })
+            }
+            self.searchableEmoji = searchableEmoji
+        }
+
+        let lowercasedSearchText = searchText.lowercased()
+        let candidateIndexes: [Int]
+        if let lastSearch, lowercasedSearchText.hasPrefix(lastSearch.text) {
+            candidateIndexes = lastSearch.matchingIndexes
+        } else {
+            candidateIndexes = Array(searchableEmoji.indices)
+        }
+
         // Anchored matches are emoji that have a term that starts with the
         // search text. Unanchored matches are emoji that have a term that
         // contains the search text elsewhere.
-        let initialResult = (anchoredMatches: [EmojiWithSkinTones](), unanchoredMatches: [EmojiWithSkinTones]())
-        let result = allSendableEmoji.reduce(into: initialResult) { partialResult, emoji in
-            let terms = emojiSearchIndex?[emoji.baseEmoji.rawValue] ?? [emoji.baseEmoji.name]
+        var anchoredMatches = [EmojiWithSkinTones]()
+        var unanchoredMatches = [EmojiWithSkinTones]()
+        var matchingIndexes = [Int]()
+        for index in candidateIndexes {
+            let candidate = searchableEmoji[index]
 
+            var anchoredMatch = false
             var unanchoredMatch = false
-            for term in terms {
-                if let range = term.range(of: searchText, options: [.caseInsensitive]) {
-                    if range.lowerBound == term.startIndex {
-                        partialResult.anchoredMatches.append(emoji)
-                        return
-                    } else {
-                        unanchoredMatch = true
-                        // Don't break here to continue to check for anchored matches
-                    }
+            for term in candidate.terms {
+                if term.hasPrefix(lowercasedSearchText) {
+                    anchoredMatch = true
+                    break
+                } else if !unanchoredMatch, term.contains(lowercasedSearchText) {
+                    unanchoredMatch = true
+                    // Don't break here to continue to check for anchored matches
                 }
             }
 
-            if unanchoredMatch {
-                partialResult.unanchoredMatches.append(emoji)
+            if anchoredMatch {
+                anchoredMatches.append(candidate.emoji)
+            } else if unanchoredMatch {
+                unanchoredMatches.append(candidate.emoji)
+            } else {
+                continue
             }
+            matchingIndexes.append(index)
         }
+        lastSearch = Search(text: lowercasedSearchText, matchingIndexes: matchingIndexes)
 
-        return result.anchoredMatches + result.unanchoredMatches
+        return anchoredMatches + unanchoredMatches
     }
 
     @objc
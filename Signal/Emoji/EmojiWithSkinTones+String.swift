@@ -7,1883 +7,1884 @@
 
 extension EmojiWithSkinTones {
     static func emojiToSkinToneComponents(emoji: String) -> (Emoji, [Emoji.SkinTone])? {
-        switch emoji {
-        case "👋🏻": return (.wave, [.light])
-        case "👋🏼": return (.wave, [.mediumLight])
-        case "👋🏽": return (.wave, [.medium])
-        case "👋🏾": return (.wave, [.mediumDark])
-        case "👋🏿": return (.wave, [.dark])
-        case "🤚🏻": return (.raisedBackOfHand, [.light])
-        case "🤚🏼": return (.raisedBackOfHand, [.mediumLight])
-        case "🤚🏽": return (.raisedBackOfHand, [.medium])
-        case "🤚🏾": return (.raisedBackOfHand, [.mediumDark])
-        case "🤚🏿": return (.raisedBackOfHand, [.dark])
-        case "🖐🏻": return (.raisedHandWithFingersSplayed, [.light])
-        case "🖐🏼": return (.raisedHandWithFingersSplayed, [.mediumLight])
-        case "🖐🏽": return (.raisedHandWithFingersSplayed, [.medium])
-        case "🖐🏾": return (.raisedHandWithFingersSplayed, [.mediumDark])
-        case "🖐🏿": return (.raisedHandWithFingersSplayed, [.dark])
-        case "✋🏻": return (.hand, [.light])
-        case "✋🏼": return (.hand, [.mediumLight])
-        case "✋🏽": return (.hand, [.medium])
-        case "✋🏾": return (.hand, [.mediumDark])
-        case "✋🏿": return (.hand, [.dark])
-        case "🖖🏻": return (.spockHand, [.light])
-        case "🖖🏼": return (.spockHand, [.mediumLight])
-        case "🖖🏽": return (.spockHand, [.medium])
-        case "🖖🏾": return (.spockHand, [.mediumDark])
-        case "🖖🏿": return (.spockHand, [.dark])
-        case "🫱🏻": return (.rightwardsHand, [.light])
-        case "🫱🏼": return (.rightwardsHand, [.mediumLight])
-        case "🫱🏽": return (.rightwardsHand, [.medium])
-        case "🫱🏾": return (.rightwardsHand, [.mediumDark])
-        case "🫱🏿": return (.rightwardsHand, [.dark])
-        case "🫲🏻": return (.leftwardsHand, [.light])
-        case "🫲🏼": return (.leftwardsHand, [.mediumLight])
-        case "🫲🏽": return (.leftwardsHand, [.medium])
-        case "🫲🏾": return (.leftwardsHand, [.mediumDark])
-        case "🫲🏿": return (.leftwardsHand, [.dark])
-        case "🫳🏻": return (.palmDownHand, [.light])
-        case "🫳🏼": return (.palmDownHand, [.mediumLight])
-        case "🫳🏽": return (.palmDownHand, [.medium])
-        case "🫳🏾": return (.palmDownHand, [.mediumDark])
-        case "🫳🏿": return (.palmDownHand, [.dark])
-        case "🫴🏻": return (.palmUpHand, [.light])
-        case "🫴🏼": return (.palmUpHand, [.mediumLight])
-        case "🫴🏽": return (.palmUpHand, [.medium])
-        case "🫴🏾": return (.palmUpHand, [.mediumDark])
-        case "🫴🏿": return (.palmUpHand, [.dark])
-        case "🫷🏻": return (.leftwardsPushingHand, [.light])
-        case "🫷🏼": return (.leftwardsPushingHand, [.mediumLight])
-        case "🫷🏽": return (.leftwardsPushingHand, [.medium])
-        case "🫷🏾": return (.leftwardsPushingHand, [.mediumDark])
-        case "🫷🏿": return (.leftwardsPushingHand, [.dark])
-        case "🫸🏻": return (.rightwardsPushingHand, [.light])
-        case "🫸🏼": return (.rightwardsPushingHand, [.mediumLight])
-        case "🫸🏽": return (.rightwardsPushingHand, [.medium])
-        case "🫸🏾": return (.rightwardsPushingHand, [.mediumDark])
-        case "🫸🏿": return (.rightwardsPushingHand, [.dark])
-        case "👌🏻": return (.okHand, [.light])
-        case "👌🏼": return (.okHand, [.mediumLight])
-        case "👌🏽": return (.okHand, [.medium])
-        case "👌🏾": return (.okHand, [.mediumDark])
-        case "👌🏿": return (.okHand, [.dark])
-        case "🤌🏻": return (.pinchedFingers, [.light])
-        case "🤌🏼": return (.pinchedFingers, [.mediumLight])
-        case "🤌🏽": return (.pinchedFingers, [.medium])
-        case "🤌🏾": return (.pinchedFingers, [.mediumDark])
-        case "🤌🏿": return (.pinchedFingers, [.dark])
-        case "🤏🏻": return (.pinchingHand, [.light])
-        case "🤏🏼": return (.pinchingHand, [.mediumLight])
-        case "🤏🏽": return (.pinchingHand, [.medium])
-        case "🤏🏾": return (.pinchingHand, [.mediumDark])
-        case "🤏🏿": return (.pinchingHand, [.dark])
-        case "✌🏻": return (.v, [.light])
-        case "✌🏼": return (.v, [.mediumLight])
-        case "✌🏽": return (.v, [.medium])
-        case "✌🏾": return (.v, [.mediumDark])
-        case "✌🏿": return (.v, [.dark])
-        case "🤞🏻": return (.crossedFingers, [.light])
-        case "🤞🏼": return (.crossedFingers, [.mediumLight])
-        case "🤞🏽": return (.crossedFingers, [.medium])
-        case "🤞🏾": return (.crossedFingers, [.mediumDark])
-        case "🤞🏿": return (.crossedFingers, [.dark])
-        case "🫰🏻": return (.handWithIndexFingerAndThumbCrossed, [.light])
-        case "🫰🏼": return (.handWithIndexFingerAndThumbCrossed, [.mediumLight])
-        case "🫰🏽": return (.handWithIndexFingerAndThumbCrossed, [.medium])
-        case "🫰🏾": return (.handWithIndexFingerAndThumbCrossed, [.mediumDark])
-        case "🫰🏿": return (.handWithIndexFingerAndThumbCrossed, [.dark])
-        case "🤟🏻": return (.iLoveYouHandSign, [.light])
-        case "🤟🏼": return (.iLoveYouHandSign, [.mediumLight])
-        case "🤟🏽": return (.iLoveYouHandSign, [.medium])
-        case "🤟🏾": return (.iLoveYouHandSign, [.mediumDark])
-        case "🤟🏿": return (.iLoveYouHandSign, [.dark])
-        case "🤘🏻": return (.theHorns, [.light])
-        case "🤘🏼": return (.theHorns, [.mediumLight])
-        case "🤘🏽": return (.theHorns, [.medium])
-        case "🤘🏾": return (.theHorns, [.mediumDark])
-        case "🤘🏿": return (.theHorns, [.dark])
-        case "🤙🏻": return (.callMeHand, [.light])
-        case "🤙🏼": return (.callMeHand, [.mediumLight])
-        case "🤙🏽": return (.callMeHand, [.medium])
-        case "🤙🏾": return (.callMeHand, [.mediumDark])
-        case "🤙🏿": return (.callMeHand, [.dark])
-        case "👈🏻": return (.pointLeft, [.light])
-        case "👈🏼": return (.pointLeft, [.mediumLight])
-        case "👈🏽": return (.pointLeft, [.medium])
-        case "👈🏾": return (.pointLeft, [.mediumDark])
-        case "👈🏿": return (.pointLeft, [.dark])
-        case "👉🏻": return (.pointRight, [.light])
-        case "👉🏼": return (.pointRight, [.mediumLight])
-        case "👉🏽": return (.pointRight, [.medium])
-        case "👉🏾": return (.pointRight, [.mediumDark])
-        case "👉🏿": return (.pointRight, [.dark])
-        case "👆🏻": return (.pointUp2, [.light])
-        case "👆🏼": return (.pointUp2, [.mediumLight])
-        case "👆🏽": return (.pointUp2, [.medium])
-        case "👆🏾": return (.pointUp2, [.mediumDark])
-        case "👆🏿": return (.pointUp2, [.dark])
-        case "🖕🏻": return (.middleFinger, [.light])
-        case "🖕🏼": return (.middleFinger, [.mediumLight])
-        case "🖕🏽": return (.middleFinger, [.medium])
-        case "🖕🏾": return (.middleFinger, [.mediumDark])
-        case "🖕🏿": return (.middleFinger, [.dark])
-        case "👇🏻": return (.pointDown, [.light])
-        case "👇🏼": return (.pointDown, [.mediumLight])
-        case "👇🏽": return (.pointDown, [.medium])
-        case "👇🏾": return (.pointDown, [.mediumDark])
-        case "👇🏿": return (.pointDown, [.dark])
-        case "☝🏻": return (.pointUp, [.light])
-        case "☝🏼": return (.pointUp, [.mediumLight])
-        case "☝🏽": return (.pointUp, [.medium])
-        case "☝🏾": return (.pointUp, [.mediumDark])
-        case "☝🏿": return (.pointUp, [.dark])
-        case "🫵🏻": return (.indexPointingAtTheViewer, [.light])
-        case "🫵🏼": return (.indexPointingAtTheViewer, [.mediumLight])
-        case "🫵🏽": return (.indexPointingAtTheViewer, [.medium])
-        case "🫵🏾": return (.indexPointingAtTheViewer, [.mediumDark])
-        case "🫵🏿": return (.indexPointingAtTheViewer, [.dark])
-        case "👍🏻": return (.plusOne, [.light])
-        case "👍🏼": return (.plusOne, [.mediumLight])
-        case "👍🏽": return (.plusOne, [.medium])
-        case "👍🏾": return (.plusOne, [.mediumDark])
-        case "👍🏿": return (.plusOne, [.dark])
-        case "👎🏻": return (.negativeOne, [.light])
-        case "👎🏼": return (.negativeOne, [.mediumLight])
-        case "👎🏽": return (.negativeOne, [.medium])
-        case "👎🏾": return (.negativeOne, [.mediumDark])
-        case "👎🏿": return (.negativeOne, [.dark])
-        case "✊🏻": return (.fist, [.light])
-        case "✊🏼": return (.fist, [.mediumLight])
-        case "✊🏽": return (.fist, [.medium])
-        case "✊🏾": return (.fist, [.mediumDark])
-        case "✊🏿": return (.fist, [.dark])
-        case "👊🏻": return (.facepunch, [.light])
-        case "👊🏼": return (.facepunch, [.mediumLight])
-        case "👊🏽": return (.facepunch, [.medium])
-        case "👊🏾": return (.facepunch, [.mediumDark])
-        case "👊🏿": return (.facepunch, [.dark])
-        case "🤛🏻": return (.leftFacingFist, [.light])
-        case "🤛🏼": return (.leftFacingFist, [.mediumLight])
-        case "🤛🏽": return (.leftFacingFist, [.medium])
-        case "🤛🏾": return (.leftFacingFist, [.mediumDark])
-        case "🤛🏿": return (.leftFacingFist, [.dark])
-        case "🤜🏻": return (.rightFacingFist, [.light])
-        case "🤜🏼": return (.rightFacingFist, [.mediumLight])
-        case "🤜🏽": return (.rightFacingFist, [.medium])
-        case "🤜🏾": return (.rightFacingFist, [.mediumDark])
-        case "🤜🏿": return (.rightFacingFist, [.dark])
-        case "👏🏻": return (.clap, [.light])
-        case "👏🏼": return (.clap, [.mediumLight])
-        case "👏🏽": return (.clap, [.medium])
-        case "👏🏾": return (.clap, [.mediumDark])
-        case "👏🏿": return (.clap, [.dark])
-        case "🙌🏻": return (.raisedHands, [.light])
-        case "🙌🏼": return (.raisedHands, [.mediumLight])
-        case "🙌🏽": return (.raisedHands, [.medium])
-        case "🙌🏾": return (.raisedHands, [.mediumDark])
-        case "🙌🏿": return (.raisedHands, [.dark])
-        case "🫶🏻": return (.heartHands, [.light])
-        case "🫶🏼": return (.heartHands, [.mediumLight])
-        case "🫶🏽": return (.heartHands, [.medium])
-        case "🫶🏾": return (.heartHands, [.mediumDark])
-        case "🫶🏿": return (.heartHands, [.dark])
-        case "👐🏻": return (.openHands, [.light])
-        case "👐🏼": return (.openHands, [.mediumLight])
-        case "👐🏽": return (.openHands, [.medium])
-        case "👐🏾": return (.openHands, [.mediumDark])
-        case "👐🏿": return (.openHands, [.dark])
-        case "🤲🏻": return (.palmsUpTogether, [.light])
-        case "🤲🏼": return (.palmsUpTogether, [.mediumLight])
-        case "🤲🏽": return (.palmsUpTogether, [.medium])
-        case "🤲🏾": return (.palmsUpTogether, [.mediumDark])
-        case "🤲🏿": return (.palmsUpTogether, [.dark])
-        case "🤝🏻": return (.handshake, [.light])
-        case "🫱🏻‍🫲🏼": return (.handshake, [.light, .mediumLight])
-        case "🫱🏻‍🫲🏽": return (.handshake, [.light, .medium])
-        case "🫱🏻‍🫲🏾": return (.handshake, [.light, .mediumDark])
-        case "🫱🏻‍🫲🏿": return (.handshake, [.light, .dark])
-        case "🤝🏼": return (.handshake, [.mediumLight])
-        case "🫱🏼‍🫲🏻": return (.handshake, [.mediumLight, .light])
-        case "🫱🏼‍🫲🏽": return (.handshake, [.mediumLight, .medium])
-        case "🫱🏼‍🫲🏾": return (.handshake, [.mediumLight, .mediumDark])
-        case "🫱🏼‍🫲🏿": return (.handshake, [.mediumLight, .dark])
-        case "🤝🏽": return (.handshake, [.medium])
-        case "🫱🏽‍🫲🏻": return (.handshake, [.medium, .light])
-        case "🫱🏽‍🫲🏼": return (.handshake, [.medium, .mediumLight])
-        case "🫱🏽‍🫲🏾": return (.handshake, [.medium, .mediumDark])
-        case "🫱🏽‍🫲🏿": return (.handshake, [.medium, .dark])
-        case "🤝🏾": return (.handshake, [.mediumDark])
-        case "🫱🏾‍🫲🏻": return (.handshake, [.mediumDark, .light])
-        case "🫱🏾‍🫲🏼": return (.handshake, [.mediumDark, .mediumLight])
-        case "🫱🏾‍🫲🏽": return (.handshake, [.mediumDark, .medium])
-        case "🫱🏾‍🫲🏿": return (.handshake, [.mediumDark, .dark])
-        case "🤝🏿": return (.handshake, [.dark])
-        case "🫱🏿‍🫲🏻": return (.handshake, [.dark, .light])
-        case "🫱🏿‍🫲🏼": return (.handshake, [.dark, .mediumLight])
-        case "🫱🏿‍🫲🏽": return (.handshake, [.dark, .medium])
-        case "🫱🏿‍🫲🏾": return (.handshake, [.dark, .mediumDark])
-        case "🙏🏻": return (.pray, [.light])
-        case "🙏🏼": return (.pray, [.mediumLight])
-        case "🙏🏽": return (.pray, [.medium])
-        case "🙏🏾": return (.pray, [.mediumDark])
-        case "🙏🏿": return (.pray, [.dark])
-        case "✍🏻": return (.writingHand, [.light])
-        case "✍🏼": return (.writingHand, [.mediumLight])
-        case "✍🏽": return (.writingHand, [.medium])
-        case "✍🏾": return (.writingHand, [.mediumDark])
-        case "✍🏿": return (.writingHand, [.dark])
-        case "💅🏻": return (.nailCare, [.light])
-        case "💅🏼": return (.nailCare, [.mediumLight])
-        case "💅🏽": return (.nailCare, [.medium])
-        case "💅🏾": return (.nailCare, [.mediumDark])
-        case "💅🏿": return (.nailCare, [.dark])
-        case "🤳🏻": return (.selfie, [.light])
-        case "🤳🏼": return (.selfie, [.mediumLight])
-        case "🤳🏽": return (.selfie, [.medium])
-        case "🤳🏾": return (.selfie, [.mediumDark])
-        case "🤳🏿": return (.selfie, [.dark])
-        case "💪🏻": return (.muscle, [.light])
-        case "💪🏼": return (.muscle, [.mediumLight])
-        case "💪🏽": return (.muscle, [.medium])
-        case "💪🏾": return (.muscle, [.mediumDark])
-        case "💪🏿": return (.muscle, [.dark])
-        case "🦵🏻": return (.leg, [.light])
-        case "🦵🏼": return (.leg, [.mediumLight])
-        case "🦵🏽": return (.leg, [.medium])
-        case "🦵🏾": return (.leg, [.mediumDark])
-        case "🦵🏿": return (.leg, [.dark])
-        case "🦶🏻": return (.foot, [.light])
-        case "🦶🏼": return (.foot, [.mediumLight])
-        case "🦶🏽": return (.foot, [.medium])
-        case "🦶🏾": return (.foot, [.mediumDark])
-        case "🦶🏿": return (.foot, [.dark])
-        case "👂🏻": return (.ear, [.light])
-        case "👂🏼": return (.ear, [.mediumLight])
-        case "👂🏽": return (.ear, [.medium])
-        case "👂🏾": return (.ear, [.mediumDark])
-        case "👂🏿": return (.ear, [.dark])
-        case "🦻🏻": return (.earWithHearingAid, [.light])
-        case "🦻🏼": return (.earWithHearingAid, [.mediumLight])
-        case "🦻🏽": return (.earWithHearingAid, [.medium])
-        case "🦻🏾": return (.earWithHearingAid, [.mediumDark])
-        case "🦻🏿": return (.earWithHearingAid, [.dark])
-        case "👃🏻": return (.nose, [.light])
-        case "👃🏼": return (.nose, [.mediumLight])
-        case "👃🏽": return (.nose, [.medium])
-        case "👃🏾": return (.nose, [.mediumDark])
-        case "👃🏿": return (.nose, [.dark])
-        case "👶🏻": return (.baby, [.light])
-        case "👶🏼": return (.baby, [.mediumLight])
-        case "👶🏽": return (.baby, [.medium])
-        case "👶🏾": return (.baby, [.mediumDark])
-        case "👶🏿": return (.baby, [.dark])
-        case "🧒🏻": return (.child, [.light])
-        case "🧒🏼": return (.child, [.mediumLight])
-        case "🧒🏽": return (.child, [.medium])
-        case "🧒🏾": return (.child, [.mediumDark])
-        case "🧒🏿": return (.child, [.dark])
-        case "👦🏻": return (.boy, [.light])
-        case "👦🏼": return (.boy, [.mediumLight])
-        case "👦🏽": return (.boy, [.medium])
-        case "👦🏾": return (.boy, [.mediumDark])
-        case "👦🏿": return (.boy, [.dark])
-        case "👧🏻": return (.girl, [.light])
-        case "👧🏼": return (.girl, [.mediumLight])
-        case "👧🏽": return (.girl, [.medium])
-        case "👧🏾": return (.girl, [.mediumDark])
-        case "👧🏿": return (.girl, [.dark])
-        case "🧑🏻": return (.adult, [.light])
-        case "🧑🏼": return (.adult, [.mediumLight])
-        case "🧑🏽": return (.adult, [.medium])
-        case "🧑🏾": return (.adult, [.mediumDark])
-        case "🧑🏿": return (.adult, [.dark])
-        case "👱🏻": return (.personWithBlondHair, [.light])
-        case "👱🏼": return (.personWithBlondHair, [.mediumLight])
-        case "👱🏽": return (.personWithBlondHair, [.medium])
-        case "👱🏾": return (.personWithBlondHair, [.mediumDark])
-        case "👱🏿": return (.personWithBlondHair, [.dark])
-        case "👨🏻": return (.man, [.light])
-        case "👨🏼": return (.man, [.mediumLight])
-        case "👨🏽": return (.man, [.medium])
-        case "👨🏾": return (.man, [.mediumDark])
-        case "👨🏿": return (.man, [.dark])
-        case "🧔🏻": return (.beardedPerson, [.light])
-        case "🧔🏼": return (.beardedPerson, [.mediumLight])
-        case "🧔🏽": return (.beardedPerson, [.medium])
-        case "🧔🏾": return (.beardedPerson, [.mediumDark])
-        case "🧔🏿": return (.beardedPerson, [.dark])
-        case "🧔🏻‍♂️": return (.manWithBeard, [.light])
-        case "🧔🏼‍♂️": return (.manWithBeard, [.mediumLight])
-        case "🧔🏽‍♂️": return (.manWithBeard, [.medium])
-        case "🧔🏾‍♂️": return (.manWithBeard, [.mediumDark])
-        case "🧔🏿‍♂️": return (.manWithBeard, [.dark])
-        case "🧔🏻‍♀️": return (.womanWithBeard, [.light])
-        case "🧔🏼‍♀️": return (.womanWithBeard, [.mediumLight])
-        case "🧔🏽‍♀️": return (.womanWithBeard, [.medium])
-        case "🧔🏾‍♀️": return (.womanWithBeard, [.mediumDark])
-        case "🧔🏿‍♀️": return (.womanWithBeard, [.dark])
-        case "👨🏻‍🦰": return (.redHairedMan, [.light])
-        case "👨🏼‍🦰": return (.redHairedMan, [.mediumLight])
-        case "👨🏽‍🦰": return (.redHairedMan, [.medium])
-        case "👨🏾‍🦰": return (.redHairedMan, [.mediumDark])
-        case "👨🏿‍🦰": return (.redHairedMan, [.dark])
-        case "👨🏻‍🦱": return (.curlyHairedMan, [.light])
-        case "👨🏼‍🦱": return (.curlyHairedMan, [.mediumLight])
-        case "👨🏽‍🦱": return (.curlyHairedMan, [.medium])
-        case "👨🏾‍🦱": return (.curlyHairedMan, [.mediumDark])
-        case "👨🏿‍🦱": return (.curlyHairedMan, [.dark])
-        case "👨🏻‍🦳": return (.whiteHairedMan, [.light])
-        case "👨🏼‍🦳": return (.whiteHairedMan, [.mediumLight])
-        case "👨🏽‍🦳": return (.whiteHairedMan, [.medium])
-        case "👨🏾‍🦳": return (.whiteHairedMan, [.mediumDark])
-        case "👨🏿‍🦳": return (.whiteHairedMan, [.dark])
-        case "👨🏻‍🦲": return (.baldMan, [.light])
-        case "👨🏼‍🦲": return (.baldMan, [.mediumLight])
-        case "👨🏽‍🦲": return (.baldMan, [.medium])
-        case "👨🏾‍🦲": return (.baldMan, [.mediumDark])
-        case "👨🏿‍🦲": return (.baldMan, [.dark])
-        case "👩🏻": return (.woman, [.light])
-        case "👩🏼": return (.woman, [.mediumLight])
-        case "👩🏽": return (.woman, [.medium])
-        case "👩🏾": return (.woman, [.mediumDark])
-        case "👩🏿": return (.woman, [.dark])
-        case "👩🏻‍🦰": return (.redHairedWoman, [.light])
-        case "👩🏼‍🦰": return (.redHairedWoman, [.mediumLight])
-        case "👩🏽‍🦰": return (.redHairedWoman, [.medium])
-        case "👩🏾‍🦰": return (.redHairedWoman, [.mediumDark])
-        case "👩🏿‍🦰": return (.redHairedWoman, [.dark])
-        case "🧑🏻‍🦰": return (.redHairedPerson, [.light])
-        case "🧑🏼‍🦰": return (.redHairedPerson, [.mediumLight])
-        case "🧑🏽‍🦰": return (.redHairedPerson, [.medium])
-        case "🧑🏾‍🦰": return (.redHairedPerson, [.mediumDark])
-        case "🧑🏿‍🦰": return (.redHairedPerson, [.dark])
-        case "👩🏻‍🦱": return (.curlyHairedWoman, [.light])
-        case "👩🏼‍🦱": return (.curlyHairedWoman, [.mediumLight])
-        case "👩🏽‍🦱": return (.curlyHairedWoman, [.medium])
-        case "👩🏾‍🦱": return (.curlyHairedWoman, [.mediumDark])
-        case "👩🏿‍🦱": return (.curlyHairedWoman, [.dark])
-        case "🧑🏻‍🦱": return (.curlyHairedPerson, [.light])
-        case "🧑🏼‍🦱": return (.curlyHairedPerson, [.mediumLight])
-        case "🧑🏽‍🦱": return (.curlyHairedPerson, [.medium])
-        case "🧑🏾‍🦱": return (.curlyHairedPerson, [.mediumDark])
-        case "🧑🏿‍🦱": return (.curlyHairedPerson, [.dark])
-        case "👩🏻‍🦳": return (.whiteHairedWoman, [.light])
-        case "👩🏼‍🦳": return (.whiteHairedWoman, [.mediumLight])
-        case "👩🏽‍🦳": return (.whiteHairedWoman, [.medium])
-        case "👩🏾‍🦳": return (.whiteHairedWoman, [.mediumDark])
-        case "👩🏿‍🦳": return (.whiteHairedWoman, [.dark])
-        case "🧑🏻‍🦳": return (.whiteHairedPerson, [.light])
-        case "🧑🏼‍🦳": return (.whiteHairedPerson, [.mediumLight])
-        case "🧑🏽‍🦳": return (.whiteHairedPerson, [.medium])
-        case "🧑🏾‍🦳": return (.whiteHairedPerson, [.mediumDark])
-        case "🧑🏿‍🦳": return (.whiteHairedPerson, [.dark])
-        case "👩🏻‍🦲": return (.baldWoman, [.light])
-        case "👩🏼‍🦲": return (.baldWoman, [.mediumLight])
-        case "👩🏽‍🦲": return (.baldWoman, [.medium])
-        case "👩🏾‍🦲": return (.baldWoman, [.mediumDark])
-        case "👩🏿‍🦲": return (.baldWoman, [.dark])
-        case "🧑🏻‍🦲": return (.baldPerson, [.light])
-        case "🧑🏼‍🦲": return (.baldPerson, [.mediumLight])
-        case "🧑🏽‍🦲": return (.baldPerson, [.medium])
-        case "🧑🏾‍🦲": return (.baldPerson, [.mediumDark])
-        case "🧑🏿‍🦲": return (.baldPerson, [.dark])
-        case "👱🏻‍♀️": return (.blondHairedWoman, [.light])
-        case "👱🏼‍♀️": return (.blondHairedWoman, [.mediumLight])
-        case "👱🏽‍♀️": return (.blondHairedWoman, [.medium])
-        case "👱🏾‍♀️": return (.blondHairedWoman, [.mediumDark])
-        case "👱🏿‍♀️": return (.blondHairedWoman, [.dark])
-        case "👱🏻‍♂️": return (.blondHairedMan, [.light])
-        case "👱🏼‍♂️": return (.blondHairedMan, [.mediumLight])
-        case "👱🏽‍♂️": return (.blondHairedMan, [.medium])
-        case "👱🏾‍♂️": return (.blondHairedMan, [.mediumDark])
-        case "👱🏿‍♂️": return (.blondHairedMan, [.dark])
-        case "🧓🏻": return (.olderAdult, [.light])
-        case "🧓🏼": return (.olderAdult, [.mediumLight])
-        case "🧓🏽": return (.olderAdult, [.medium])
-        case "🧓🏾": return (.olderAdult, [.mediumDark])
-        case "🧓🏿": return (.olderAdult, [.dark])
-        case "👴🏻": return (.olderMan, [.light])
-        case "👴🏼": return (.olderMan, [.mediumLight])
-        case "👴🏽": return (.olderMan, [.medium])
-        case "👴🏾": return (.olderMan, [.mediumDark])
-        case "👴🏿": return (.olderMan, [.dark])
-        case "👵🏻": return (.olderWoman, [.light])
-        case "👵🏼": return (.olderWoman, [.mediumLight])
-        case "👵🏽": return (.olderWoman, [.medium])
-        case "👵🏾": return (.olderWoman, [.mediumDark])
-        case "👵🏿": return (.olderWoman, [.dark])
-        case "🙍🏻": return (.personFrowning, [.light])
-        case "🙍🏼": return (.personFrowning, [.mediumLight])
-        case "🙍🏽": return (.personFrowning, [.medium])
-        case "🙍🏾": return (.personFrowning, [.mediumDark])
-        case "🙍🏿": return (.personFrowning, [.dark])
-        case "🙍🏻‍♂️": return (.manFrowning, [.light])
-        case "🙍🏼‍♂️": return (.manFrowning, [.mediumLight])
-        case "🙍🏽‍♂️": return (.manFrowning, [.medium])
-        case "🙍🏾‍♂️": return (.manFrowning, [.mediumDark])
-        case "🙍🏿‍♂️": return (.manFrowning, [.dark])
-        case "🙍🏻‍♀️": return (.womanFrowning, [.light])
-        case "🙍🏼‍♀️": return (.womanFrowning, [.mediumLight])
-        case "🙍🏽‍♀️": return (.womanFrowning, [.medium])
-        case "🙍🏾‍♀️": return (.womanFrowning, [.mediumDark])
-        case "🙍🏿‍♀️": return (.womanFrowning, [.dark])
-        case "🙎🏻": return (.personWithPoutingFace, [.light])
-        case "🙎🏼": return (.personWithPoutingFace, [.mediumLight])
-        case "🙎🏽": return (.personWithPoutingFace, [.medium])
-        case "🙎🏾": return (.personWithPoutingFace, [.mediumDark])
-        case "🙎🏿": return (.personWithPoutingFace, [.dark])
-        case "🙎🏻‍♂️": return (.manPouting, [.light])
-        case "🙎🏼‍♂️": return (.manPouting, [.mediumLight])
-        case "🙎🏽‍♂️": return (.manPouting, [.medium])
-        case "🙎🏾‍♂️": return (.manPouting, [.mediumDark])
-        case "🙎🏿‍♂️": return (.manPouting, [.dark])
-        case "🙎🏻‍♀️": return (.womanPouting, [.light])
-        case "🙎🏼‍♀️": return (.womanPouting, [.mediumLight])
-        case "🙎🏽‍♀️": return (.womanPouting, [.medium])
-        case "🙎🏾‍♀️": return (.womanPouting, [.mediumDark])
-        case "🙎🏿‍♀️": return (.womanPouting, [.dark])
-        case "🙅🏻": return (.noGood, [.light])
-        case "🙅🏼": return (.noGood, [.mediumLight])
-        case "🙅🏽": return (.noGood, [.medium])
-        case "🙅🏾": return (.noGood, [.mediumDark])
-        case "🙅🏿": return (.noGood, [.dark])
-        case "🙅🏻‍♂️": return (.manGesturingNo, [.light])
-        case "🙅🏼‍♂️": return (.manGesturingNo, [.mediumLight])
-        case "🙅🏽‍♂️": return (.manGesturingNo, [.medium])
-        case "🙅🏾‍♂️": return (.manGesturingNo, [.mediumDark])
-        case "🙅🏿‍♂️": return (.manGesturingNo, [.dark])
-        case "🙅🏻‍♀️": return (.womanGesturingNo, [.light])
-        case "🙅🏼‍♀️": return (.womanGesturingNo, [.mediumLight])
-        case "🙅🏽‍♀️": return (.womanGesturingNo, [.medium])
-        case "🙅🏾‍♀️": return (.womanGesturingNo, [.mediumDark])
-        case "🙅🏿‍♀️": return (.womanGesturingNo, [.dark])
-        case "🙆🏻": return (.okWoman, [.light])
-        case "🙆🏼": return (.okWoman, [.mediumLight])
-        case "🙆🏽": return (.okWoman, [.medium])
-        case "🙆🏾": return (.okWoman, [.mediumDark])
-        case "🙆🏿": return (.okWoman, [.dark])
-        case "🙆🏻‍♂️": return (.manGesturingOk, [.light])
-        case "🙆🏼‍♂️": return (.manGesturingOk, [.mediumLight])
-        case "🙆🏽‍♂️": return (.manGesturingOk, [.medium])
-        case "🙆🏾‍♂️": return (.manGesturingOk, [.mediumDark])
-        case "🙆🏿‍♂️": return (.manGesturingOk, [.dark])
-        case "🙆🏻‍♀️": return (.womanGesturingOk, [.light])
-        case "🙆🏼‍♀️": return (.womanGesturingOk, [.mediumLight])
-        case "🙆🏽‍♀️": return (.womanGesturingOk, [.medium])
-        case "🙆🏾‍♀️": return (.womanGesturingOk, [.mediumDark])
-        case "🙆🏿‍♀️": return (.womanGesturingOk, [.dark])
-        case "💁🏻": return (.informationDeskPerson, [.light])
-        case "💁🏼": return (.informationDeskPerson, [.mediumLight])
-        case "💁🏽": return (.informationDeskPerson, [.medium])
-        case "💁🏾": return (.informationDeskPerson, [.mediumDark])
-        case "💁🏿": return (.informationDeskPerson, [.dark])
-        case "💁🏻‍♂️": return (.manTippingHand, [.light])
-        case "💁🏼‍♂️": return (.manTippingHand, [.mediumLight])
-        case "💁🏽‍♂️": return (.manTippingHand, [.medium])
-        case "💁🏾‍♂️": return (.manTippingHand, [.mediumDark])
-        case "💁🏿‍♂️": return (.manTippingHand, [.dark])
-        case "💁🏻‍♀️": return (.womanTippingHand, [.light])
-        case "💁🏼‍♀️": return (.womanTippingHand, [.mediumLight])
-        case "💁🏽‍♀️": return (.womanTippingHand, [.medium])
-        case "💁🏾‍♀️": return (.womanTippingHand, [.mediumDark])
-        case "💁🏿‍♀️": return (.womanTippingHand, [.dark])
-        case "🙋🏻": return (.raisingHand, [.light])
-        case "🙋🏼": return (.raisingHand, [.mediumLight])
-        case "🙋🏽": return (.raisingHand, [.medium])
-        case "🙋🏾": return (.raisingHand, [.mediumDark])
-        case "🙋🏿": return (.raisingHand, [.dark])
-        case "🙋🏻‍♂️": return (.manRaisingHand, [.light])
-        case "🙋🏼‍♂️": return (.manRaisingHand, [.mediumLight])
-        case "🙋🏽‍♂️": return (.manRaisingHand, [.medium])
-        case "🙋🏾‍♂️": return (.manRaisingHand, [.mediumDark])
-        case "🙋🏿‍♂️": return (.manRaisingHand, [.dark])
-        case "🙋🏻‍♀️": return (.womanRaisingHand, [.light])
-        case "🙋🏼‍♀️": return (.womanRaisingHand, [.mediumLight])
-        case "🙋🏽‍♀️": return (.womanRaisingHand, [.medium])
-        case "🙋🏾‍♀️": return (.womanRaisingHand, [.mediumDark])
-        case "🙋🏿‍♀️": return (.womanRaisingHand, [.dark])
-        case "🧏🏻": return (.deafPerson, [.light])
-        case "🧏🏼": return (.deafPerson, [.mediumLight])
-        case "🧏🏽": return (.deafPerson, [.medium])
-        case "🧏🏾": return (.deafPerson, [.mediumDark])
-        case "🧏🏿": return (.deafPerson, [.dark])
-        case "🧏🏻‍♂️": return (.deafMan, [.light])
-        case "🧏🏼‍♂️": return (.deafMan, [.mediumLight])
-        case "🧏🏽‍♂️": return (.deafMan, [.medium])
-        case "🧏🏾‍♂️": return (.deafMan, [.mediumDark])
-        case "🧏🏿‍♂️": return (.deafMan, [.dark])
-        case "🧏🏻‍♀️": return (.deafWoman, [.light])
-        case "🧏🏼‍♀️": return (.deafWoman, [.mediumLight])
-        case "🧏🏽‍♀️": return (.deafWoman, [.medium])
-        case "🧏🏾‍♀️": return (.deafWoman, [.mediumDark])
-        case "🧏🏿‍♀️": return (.deafWoman, [.dark])
-        case "🙇🏻": return (.bow, [.light])
-        case "🙇🏼": return (.bow, [.mediumLight])
-        case "🙇🏽": return (.bow, [.medium])
-        case "🙇🏾": return (.bow, [.mediumDark])
-        case "🙇🏿": return (.bow, [.dark])
-        case "🙇🏻‍♂️": return (.manBowing, [.light])
-        case "🙇🏼‍♂️": return (.manBowing, [.mediumLight])
-        case "🙇🏽‍♂️": return (.manBowing, [.medium])
-        case "🙇🏾‍♂️": return (.manBowing, [.mediumDark])
-        case "🙇🏿‍♂️": return (.manBowing, [.dark])
-        case "🙇🏻‍♀️": return (.womanBowing, [.light])
-        case "🙇🏼‍♀️": return (.womanBowing, [.mediumLight])
-        case "🙇🏽‍♀️": return (.womanBowing, [.medium])
-        case "🙇🏾‍♀️": return (.womanBowing, [.mediumDark])
-        case "🙇🏿‍♀️": return (.womanBowing, [.dark])
-        case "🤦🏻": return (.facePalm, [.light])
-        case "🤦🏼": return (.facePalm, [.mediumLight])
-        case "🤦🏽": return (.facePalm, [.medium])
-        case "🤦🏾": return (.facePalm, [.mediumDark])
-        case "🤦🏿": return (.facePalm, [.dark])
-        case "🤦🏻‍♂️": return (.manFacepalming, [.light])
-        case "🤦🏼‍♂️": return (.manFacepalming, [.mediumLight])
-        case "🤦🏽‍♂️": return (.manFacepalming, [.medium])
-        case "🤦🏾‍♂️": return (.manFacepalming, [.mediumDark])
-        case "🤦🏿‍♂️": return (.manFacepalming, [.dark])
-        case "🤦🏻‍♀️": return (.womanFacepalming, [.light])
-        case "🤦🏼‍♀️": return (.womanFacepalming, [.mediumLight])
-        case "🤦🏽‍♀️": return (.womanFacepalming, [.medium])
-        case "🤦🏾‍♀️": return (.womanFacepalming, [.mediumDark])
-        case "🤦🏿‍♀️": return (.womanFacepalming, [.dark])
-        case "🤷🏻": return (.shrug, [.light])
-        case "🤷🏼": return (.shrug, [.mediumLight])
-        case "🤷🏽": return (.shrug, [.medium])
-        case "🤷🏾": return (.shrug, [.mediumDark])
-        case "🤷🏿": return (.shrug, [.dark])
-        case "🤷🏻‍♂️": return (.manShrugging, [.light])
-        case "🤷🏼‍♂️": return (.manShrugging, [.mediumLight])
-        case "🤷🏽‍♂️": return (.manShrugging, [.medium])
-        case "🤷🏾‍♂️": return (.manShrugging, [.mediumDark])
-        case "🤷🏿‍♂️": return (.manShrugging, [.dark])
-        case "🤷🏻‍♀️": return (.womanShrugging, [.light])
-        case "🤷🏼‍♀️": return (.womanShrugging, [.mediumLight])
-        case "🤷🏽‍♀️": return (.womanShrugging, [.medium])
-        case "🤷🏾‍♀️": return (.womanShrugging, [.mediumDark])
-        case "🤷🏿‍♀️": return (.womanShrugging, [.dark])
-        case "🧑🏻‍⚕️": return (.healthWorker, [.light])
-        case "🧑🏼‍⚕️": return (.healthWorker, [.mediumLight])
-        case "🧑🏽‍⚕️": return (.healthWorker, [.medium])
-        case "🧑🏾‍⚕️": return (.healthWorker, [.mediumDark])
-        case "🧑🏿‍⚕️": return (.healthWorker, [.dark])
-        case "👨🏻‍⚕️": return (.maleDoctor, [.light])
-        case "👨🏼‍⚕️": return (.maleDoctor, [.mediumLight])
-        case "👨🏽‍⚕️": return (.maleDoctor, [.medium])
-        case "👨🏾‍⚕️": return (.maleDoctor, [.mediumDark])
-        case "👨🏿‍⚕️": return (.maleDoctor, [.dark])
-        case "👩🏻‍⚕️": return (.femaleDoctor, [.light])
-        case "👩🏼‍⚕️": return (.femaleDoctor, [.mediumLight])
-        case "👩🏽‍⚕️": return (.femaleDoctor, [.medium])
-        case "👩🏾‍⚕️": return (.femaleDoctor, [.mediumDark])
-        case "👩🏿‍⚕️": return (.femaleDoctor, [.dark])
-        case "🧑🏻‍🎓": return (.student, [.light])
-        case "🧑🏼‍🎓": return (.student, [.mediumLight])
-        case "🧑🏽‍🎓": return (.student, [.medium])
-        case "🧑🏾‍🎓": return (.student, [.mediumDark])
-        case "🧑🏿‍🎓": return (.student, [.dark])
-        case "👨🏻‍🎓": return (.maleStudent, [.light])
-        case "👨🏼‍🎓": return (.maleStudent, [.mediumLight])
-        case "👨🏽‍🎓": return (.maleStudent, [.medium])
-        case "👨🏾‍🎓": return (.maleStudent, [.mediumDark])
-        case "👨🏿‍🎓": return (.maleStudent, [.dark])
-        case "👩🏻‍🎓": return (.femaleStudent, [.light])
-        case "👩🏼‍🎓": return (.femaleStudent, [.mediumLight])
-        case "👩🏽‍🎓": return (.femaleStudent, [.medium])
-        case "👩🏾‍🎓": return (.femaleStudent, [.mediumDark])
-        case "👩🏿‍🎓": return (.femaleStudent, [.dark])
-        case "🧑🏻‍🏫": return (.teacher, [.light])
-        case "🧑🏼‍🏫": return (.teacher, [.mediumLight])
-        case "🧑🏽‍🏫": return (.teacher, [.medium])
-        case "🧑🏾‍🏫": return (.teacher, [.mediumDark])
-        case "🧑🏿‍🏫": return (.teacher, [.dark])
-        case "👨🏻‍🏫": return (.maleTeacher, [.light])
-        case "👨🏼‍🏫": return (.maleTeacher, [.mediumLight])
-        case "👨🏽‍🏫": return (.maleTeacher, [.medium])
-        case "👨🏾‍🏫": return (.maleTeacher, [.mediumDark])
-        case "👨🏿‍🏫": return (.maleTeacher, [.dark])
-        case "👩🏻‍🏫": return (.femaleTeacher, [.light])
-        case "👩🏼‍🏫": return (.femaleTeacher, [.mediumLight])
-        case "👩🏽‍🏫": return (.femaleTeacher, [.medium])
-        case "👩🏾‍🏫": return (.femaleTeacher, [.mediumDark])
-        case "👩🏿‍🏫": return (.femaleTeacher, [.dark])
-        case "🧑🏻‍⚖️": return (.judge, [.light])
-        case "🧑🏼‍⚖️": return (.judge, [.mediumLight])
-        case "🧑🏽‍⚖️": return (.judge, [.medium])
-        case "🧑🏾‍⚖️": return (.judge, [.mediumDark])
-        case "🧑🏿‍⚖️": return (.judge, [.dark])
-        case "👨🏻‍⚖️": return (.maleJudge, [.light])
-        case "👨🏼‍⚖️": return (.maleJudge, [.mediumLight])
-        case "👨🏽‍⚖️": return (.maleJudge, [.medium])
-        case "👨🏾‍⚖️": return (.maleJudge, [.mediumDark])
-        case "👨🏿‍⚖️": return (.maleJudge, [.dark])
-        case "👩🏻‍⚖️": return (.femaleJudge, [.light])
-        case "👩🏼‍⚖️": return (.femaleJudge, [.mediumLight])
-        case "👩🏽‍⚖️": return (.femaleJudge, [.medium])
-        case "👩🏾‍⚖️": return (.femaleJudge, [.mediumDark])
-        case "👩🏿‍⚖️": return (.femaleJudge, [.dark])
-        case "🧑🏻‍🌾": return (.farmer, [.light])
-        case "🧑🏼‍🌾": return (.farmer, [.mediumLight])
-        case "🧑🏽‍🌾": return (.farmer, [.medium])
-        case "🧑🏾‍🌾": return (.farmer, [.mediumDark])
-        case "🧑🏿‍🌾": return (.farmer, [.dark])
-        case "👨🏻‍🌾": return (.maleFarmer, [.light])
-        case "👨🏼‍🌾": return (.maleFarmer, [.mediumLight])
-        case "👨🏽‍🌾": return (.maleFarmer, [.medium])
-        case "👨🏾‍🌾": return (.maleFarmer, [.mediumDark])
-        case "👨🏿‍🌾": return (.maleFarmer, [.dark])
-        case "👩🏻‍🌾": return (.femaleFarmer, [.light])
-        case "👩🏼‍🌾": return (.femaleFarmer, [.mediumLight])
-        case "👩🏽‍🌾": return (.femaleFarmer, [.medium])
-        case "👩🏾‍🌾": return (.femaleFarmer, [.mediumDark])
-        case "👩🏿‍🌾": return (.femaleFarmer, [.dark])
-        case "🧑🏻‍🍳": return (.cook, [.light])
-        case "🧑🏼‍🍳": return (.cook, [.mediumLight])
-        case "🧑🏽‍🍳": return (.cook, [.medium])
-        case "🧑🏾‍🍳": return (.cook, [.mediumDark])
-        case "🧑🏿‍🍳": return (.cook, [.dark])
-        case "👨🏻‍🍳": return (.maleCook, [.light])
-        case "👨🏼‍🍳": return (.maleCook, [.mediumLight])
-        case "👨🏽‍🍳": return (.maleCook, [.medium])
-        case "👨🏾‍🍳": return (.maleCook, [.mediumDark])
-        case "👨🏿‍🍳": return (.maleCook, [.dark])
-        case "👩🏻‍🍳": return (.femaleCook, [.light])
-        case "👩🏼‍🍳": return (.femaleCook, [.mediumLight])
-        case "👩🏽‍🍳": return (.femaleCook, [.medium])
-        case "👩🏾‍🍳": return (.femaleCook, [.mediumDark])
-        case "👩🏿‍🍳": return (.femaleCook, [.dark])
-        case "🧑🏻‍🔧": return (.mechanic, [.light])
-        case "🧑🏼‍🔧": return (.mechanic, [.mediumLight])
-        case "🧑🏽‍🔧": return (.mechanic, [.medium])
-        case "🧑🏾‍🔧": return (.mechanic, [.mediumDark])
-        case "🧑🏿‍🔧": return (.mechanic, [.dark])
-        case "👨🏻‍🔧": return (.maleMechanic, [.light])
-        case "👨🏼‍🔧": return (.maleMechanic, [.mediumLight])
-        case "👨🏽‍🔧": return (.maleMechanic, [.medium])
-        case "👨🏾‍🔧": return (.maleMechanic, [.mediumDark])
-        case "👨🏿‍🔧": return (.maleMechanic, [.dark])
-        case "👩🏻‍🔧": return (.femaleMechanic, [.light])
-        case "👩🏼‍🔧": return (.femaleMechanic, [.mediumLight])
-        case "👩🏽‍🔧": return (.femaleMechanic, [.medium])
-        case "👩🏾‍🔧": return (.femaleMechanic, [.mediumDark])
-        case "👩🏿‍🔧": return (.femaleMechanic, [.dark])
-        case "🧑🏻‍🏭": return (.factoryWorker, [.light])
-        case "🧑🏼‍🏭": return (.factoryWorker, [.mediumLight])
-        case "🧑🏽‍🏭": return (.factoryWorker, [.medium])
-        case "🧑🏾‍🏭": return (.factoryWorker, [.mediumDark])
-        case "🧑🏿‍🏭": return (.factoryWorker, [.dark])
-        case "👨🏻‍🏭": return (.maleFactoryWorker, [.light])
-        case "👨🏼‍🏭": return (.maleFactoryWorker, [.mediumLight])
-        case "👨🏽‍🏭": return (.maleFactoryWorker, [.medium])
-        case "👨🏾‍🏭": return (.maleFactoryWorker, [.mediumDark])
-        case "👨🏿‍🏭": return (.maleFactoryWorker, [.dark])
-        case "👩🏻‍🏭": return (.femaleFactoryWorker, [.light])
-        case "👩🏼‍🏭": return (.femaleFactoryWorker, [.mediumLight])
-        case "👩🏽‍🏭": return (.femaleFactoryWorker, [.medium])
-        case "👩🏾‍🏭": return (.femaleFactoryWorker, [.mediumDark])
-        case "👩🏿‍🏭": return (.femaleFactoryWorker, [.dark])
-        case "🧑🏻‍💼": return (.officeWorker, [.light])
-        case "🧑🏼‍💼": return (.officeWorker, [.mediumLight])
-        case "🧑🏽‍💼": return (.officeWorker, [.medium])
-        case "🧑🏾‍💼": return (.officeWorker, [.mediumDark])
-        case "🧑🏿‍💼": return (.officeWorker, [.dark])
-        case "👨🏻‍💼": return (.maleOfficeWorker, [.light])
-        case "👨🏼‍💼": return (.maleOfficeWorker, [.mediumLight])
-        case "👨🏽‍💼": return (.maleOfficeWorker, [.medium])
-        case "👨🏾‍💼": return (.maleOfficeWorker, [.mediumDark])
-        case "👨🏿‍💼": return (.maleOfficeWorker, [.dark])
-        case "👩🏻‍💼": return (.femaleOfficeWorker, [.light])
-        case "👩🏼‍💼": return (.femaleOfficeWorker, [.mediumLight])
-        case "👩🏽‍💼": return (.femaleOfficeWorker, [.medium])
-        case "👩🏾‍💼": return (.femaleOfficeWorker, [.mediumDark])
-        case "👩🏿‍💼": return (.femaleOfficeWorker, [.dark])
-        case "🧑🏻‍🔬": return (.scientist, [.light])
-        case "🧑🏼‍🔬": return (.scientist, [.mediumLight])
-        case "🧑🏽‍🔬": return (.scientist, [.medium])
-        case "🧑🏾‍🔬": return (.scientist, [.mediumDark])
-        case "🧑🏿‍🔬": return (.scientist, [.dark])
-        case "👨🏻‍🔬": return (.maleScientist, [.light])
-        case "👨🏼‍🔬": return (.maleScientist, [.mediumLight])
-        case "👨🏽‍🔬": return (.maleScientist, [.medium])
-        case "👨🏾‍🔬": return (.maleScientist, [.mediumDark])
-        case "👨🏿‍🔬": return (.maleScientist, [.dark])
-        case "👩🏻‍🔬": return (.femaleScientist, [.light])
-        case "👩🏼‍🔬": return (.femaleScientist, [.mediumLight])
-        case "👩🏽‍🔬": return (.femaleScientist, [.medium])
-        case "👩🏾‍🔬": return (.femaleScientist, [.mediumDark])
-        case "👩🏿‍🔬": return (.femaleScientist, [.dark])
-        case "🧑🏻‍💻": return (.technologist, [.light])
-        case "🧑🏼‍💻": return (.technologist, [.mediumLight])
-        case "🧑🏽‍💻": return (.technologist, [.medium])
-        case "🧑🏾‍💻": return (.technologist, [.mediumDark])
-        case "🧑🏿‍💻": return (.technologist, [.dark])
-        case "👨🏻‍💻": return (.maleTechnologist, [.light])
-        case "👨🏼‍💻": return (.maleTechnologist, [.mediumLight])
-        case "👨🏽‍💻": return (.maleTechnologist, [.medium])
-        case "👨🏾‍💻": return (.maleTechnologist, [.mediumDark])
-        case "👨🏿‍💻": return (.maleTechnologist, [.dark])
-        case "👩🏻‍💻": return (.femaleTechnologist, [.light])
-        case "👩🏼‍💻": return (.femaleTechnologist, [.mediumLight])
-        case "👩🏽‍💻": return (.femaleTechnologist, [.medium])
-        case "👩🏾‍💻": return (.femaleTechnologist, [.mediumDark])
-        case "👩🏿‍💻": return (.femaleTechnologist, [.dark])
-        case "🧑🏻‍🎤": return (.singer, [.light])
-        case "🧑🏼‍🎤": return (.singer, [.mediumLight])
-        case "🧑🏽‍🎤": return (.singer, [.medium])
-        case "🧑🏾‍🎤": return (.singer, [.mediumDark])
-        case "🧑🏿‍🎤": return (.singer, [.dark])
-        case "👨🏻‍🎤": return (.maleSinger, [.light])
-        case "👨🏼‍🎤": return (.maleSinger, [.mediumLight])
-        case "👨🏽‍🎤": return (.maleSinger, [.medium])
-        case "👨🏾‍🎤": return (.maleSinger, [.mediumDark])
-        case "👨🏿‍🎤": return (.maleSinger, [.dark])
-        case "👩🏻‍🎤": return (.femaleSinger, [.light])
-        case "👩🏼‍🎤": return (.femaleSinger, [.mediumLight])
-        case "👩🏽‍🎤": return (.femaleSinger, [.medium])
-        case "👩🏾‍🎤": return (.femaleSinger, [.mediumDark])
-        case "👩🏿‍🎤": return (.femaleSinger, [.dark])
-        case "🧑🏻‍🎨": return (.artist, [.light])
-        case "🧑🏼‍🎨": return (.artist, [.mediumLight])
-        case "🧑🏽‍🎨": return (.artist, [.medium])
-        case "🧑🏾‍🎨": return (.artist, [.mediumDark])
-        case "🧑🏿‍🎨": return (.artist, [.dark])
-        case "👨🏻‍🎨": return (.maleArtist, [.light])
-        case "👨🏼‍🎨": return (.maleArtist, [.mediumLight])
-        case "👨🏽‍🎨": return (.maleArtist, [.medium])
-        case "👨🏾‍🎨": return (.maleArtist, [.mediumDark])
-        case "👨🏿‍🎨": return (.maleArtist, [.dark])
-        case "👩🏻‍🎨": return (.femaleArtist, [.light])
-        case "👩🏼‍🎨": return (.femaleArtist, [.mediumLight])
-        case "👩🏽‍🎨": return (.femaleArtist, [.medium])
-        case "👩🏾‍🎨": return (.femaleArtist, [.mediumDark])
-        case "👩🏿‍🎨": return (.femaleArtist, [.dark])
-        case "🧑🏻‍✈️": return (.pilot, [.light])
-        case "🧑🏼‍✈️": return (.pilot, [.mediumLight])
-        case "🧑🏽‍✈️": return (.pilot, [.medium])
-        case "🧑🏾‍✈️": return (.pilot, [.mediumDark])
-        case "🧑🏿‍✈️": return (.pilot, [.dark])
-        case "👨🏻‍✈️": return (.malePilot, [.light])
-        case "👨🏼‍✈️": return (.malePilot, [.mediumLight])
-        case "👨🏽‍✈️": return (.malePilot, [.medium])
-        case "👨🏾‍✈️": return (.malePilot, [.mediumDark])
-        case "👨🏿‍✈️": return (.malePilot, [.dark])
-        case "👩🏻‍✈️": return (.femalePilot, [.light])
-        case "👩🏼‍✈️": return (.femalePilot, [.mediumLight])
-        case "👩🏽‍✈️": return (.femalePilot, [.medium])
-        case "👩🏾‍✈️": return (.femalePilot, [.mediumDark])
-        case "👩🏿‍✈️": return (.femalePilot, [.dark])
-        case "🧑🏻‍🚀": return (.astronaut, [.light])
-        case "🧑🏼‍🚀": return (.astronaut, [.mediumLight])
-        case "🧑🏽‍🚀": return (.astronaut, [.medium])
-        case "🧑🏾‍🚀": return (.astronaut, [.mediumDark])
-        case "🧑🏿‍🚀": return (.astronaut, [.dark])
-        case "👨🏻‍🚀": return (.maleAstronaut, [.light])
-        case "👨🏼‍🚀": return (.maleAstronaut, [.mediumLight])
-        case "👨🏽‍🚀": return (.maleAstronaut, [.medium])
-        case "👨🏾‍🚀": return (.maleAstronaut, [.mediumDark])
-        case "👨🏿‍🚀": return (.maleAstronaut, [.dark])
-        case "👩🏻‍🚀": return (.femaleAstronaut, [.light])
-        case "👩🏼‍🚀": return (.femaleAstronaut, [.mediumLight])
-        case "👩🏽‍🚀": return (.femaleAstronaut, [.medium])
-        case "👩🏾‍🚀": return (.femaleAstronaut, [.mediumDark])
-        case "👩🏿‍🚀": return (.femaleAstronaut, [.dark])
-        case "🧑🏻‍🚒": return (.firefighter, [.light])
-        case "🧑🏼‍🚒": return (.firefighter, [.mediumLight])
-        case "🧑🏽‍🚒": return (.firefighter, [.medium])
-        case "🧑🏾‍🚒": return (.firefighter, [.mediumDark])
-        case "🧑🏿‍🚒": return (.firefighter, [.dark])
-        case "👨🏻‍🚒": return (.maleFirefighter, [.light])
-        case "👨🏼‍🚒": return (.maleFirefighter, [.mediumLight])
-        case "👨🏽‍🚒": return (.maleFirefighter, [.medium])
-        case "👨🏾‍🚒": return (.maleFirefighter, [.mediumDark])
-        case "👨🏿‍🚒": return (.maleFirefighter, [.dark])
-        case "👩🏻‍🚒": return (.femaleFirefighter, [.light])
-        case "👩🏼‍🚒": return (.femaleFirefighter, [.mediumLight])
-        case "👩🏽‍🚒": return (.femaleFirefighter, [.medium])
-        case "👩🏾‍🚒": return (.femaleFirefighter, [.mediumDark])
-        case "👩🏿‍🚒": return (.femaleFirefighter, [.dark])
-        case "👮🏻": return (.cop, [.light])
-        case "👮🏼": return (.cop, [.mediumLight])
-        case "👮🏽": return (.cop, [.medium])
-        case "👮🏾": return (.cop, [.mediumDark])
-        case "👮🏿": return (.cop, [.dark])
-        case "👮🏻‍♂️": return (.malePoliceOfficer, [.light])
-        case "👮🏼‍♂️": return (.malePoliceOfficer, [.mediumLight])
-        case "👮🏽‍♂️": return (.malePoliceOfficer, [.medium])
-        case "👮🏾‍♂️": return (.malePoliceOfficer, [.mediumDark])
-        case "👮🏿‍♂️": return (.malePoliceOfficer, [.dark])
-        case "👮🏻‍♀️": return (.femalePoliceOfficer, [.light])
-        case "👮🏼‍♀️": return (.femalePoliceOfficer, [.mediumLight])
-        case "👮🏽‍♀️": return (.femalePoliceOfficer, [.medium])
-        case "👮🏾‍♀️": return (.femalePoliceOfficer, [.mediumDark])
-        case "👮🏿‍♀️": return (.femalePoliceOfficer, [.dark])
-        case "🕵🏻": return (.sleuthOrSpy, [.light])
-        case "🕵🏼": return (.sleuthOrSpy, [.mediumLight])
-        case "🕵🏽": return (.sleuthOrSpy, [.medium])
-        case "🕵🏾": return (.sleuthOrSpy, [.mediumDark])
-        case "🕵🏿": return (.sleuthOrSpy, [.dark])
-        case "🕵🏻‍♂️": return (.maleDetective, [.light])
-        case "🕵🏼‍♂️": return (.maleDetective, [.mediumLight])
-        case "🕵🏽‍♂️": return (.maleDetective, [.medium])
-        case "🕵🏾‍♂️": return (.maleDetective, [.mediumDark])
-        case "🕵🏿‍♂️": return (.maleDetective, [.dark])
-        case "🕵🏻‍♀️": return (.femaleDetective, [.light])
-        case "🕵🏼‍♀️": return (.femaleDetective, [.mediumLight])
-        case "🕵🏽‍♀️": return (.femaleDetective, [.medium])
-        case "🕵🏾‍♀️": return (.femaleDetective, [.mediumDark])
-        case "🕵🏿‍♀️": return (.femaleDetective, [.dark])
-        case "💂🏻": return (.guardsman, [.light])
-        case "💂🏼": return (.guardsman, [.mediumLight])
-        case "💂🏽": return (.guardsman, [.medium])
-        case "💂🏾": return (.guardsman, [.mediumDark])
-        case "💂🏿": return (.guardsman, [.dark])
-        case "💂🏻‍♂️": return (.maleGuard, [.light])
-        case "💂🏼‍♂️": return (.maleGuard, [.mediumLight])
-        case "💂🏽‍♂️": return (.maleGuard, [.medium])
-        case "💂🏾‍♂️": return (.maleGuard, [.mediumDark])
-        case "💂🏿‍♂️": return (.maleGuard, [.dark])
-        case "💂🏻‍♀️": return (.femaleGuard, [.light])
-        case "💂🏼‍♀️": return (.femaleGuard, [.mediumLight])
-        case "💂🏽‍♀️": return (.femaleGuard, [.medium])
-        case "💂🏾‍♀️": return (.femaleGuard, [.mediumDark])
-        case "💂🏿‍♀️": return (.femaleGuard, [.dark])
-        case "🥷🏻": return (.ninja, [.light])
-        case "🥷🏼": return (.ninja, [.mediumLight])
-        case "🥷🏽": return (.ninja, [.medium])
-        case "🥷🏾": return (.ninja, [.mediumDark])
-        case "🥷🏿": return (.ninja, [.dark])
-        case "👷🏻": return (.constructionWorker, [.light])
-        case "👷🏼": return (.constructionWorker, [.mediumLight])
-        case "👷🏽": return (.constructionWorker, [.medium])
-        case "👷🏾": return (.constructionWorker, [.mediumDark])
-        case "👷🏿": return (.constructionWorker, [.dark])
-        case "👷🏻‍♂️": return (.maleConstructionWorker, [.light])
-        case "👷🏼‍♂️": return (.maleConstructionWorker, [.mediumLight])
-        case "👷🏽‍♂️": return (.maleConstructionWorker, [.medium])
-        case "👷🏾‍♂️": return (.maleConstructionWorker, [.mediumDark])
-        case "👷🏿‍♂️": return (.maleConstructionWorker, [.dark])
-        case "👷🏻‍♀️": return (.femaleConstructionWorker, [.light])
-        case "👷🏼‍♀️": return (.femaleConstructionWorker, [.mediumLight])
-        case "👷🏽‍♀️": return (.femaleConstructionWorker, [.medium])
-        case "👷🏾‍♀️": return (.femaleConstructionWorker, [.mediumDark])
-        case "👷🏿‍♀️": return (.femaleConstructionWorker, [.dark])
-        case "🫅🏻": return (.personWithCrown, [.light])
-        case "🫅🏼": return (.personWithCrown, [.mediumLight])
-        case "🫅🏽": return (.personWithCrown, [.medium])
-        case "🫅🏾": return (.personWithCrown, [.mediumDark])
-        case "🫅🏿": return (.personWithCrown, [.dark])
-        case "🤴🏻": return (.prince, [.light])
-        case "🤴🏼": return (.prince, [.mediumLight])
-        case "🤴🏽": return (.prince, [.medium])
-        case "🤴🏾": return (.prince, [.mediumDark])
-        case "🤴🏿": return (.prince, [.dark])
-        case "👸🏻": return (.princess, [.light])
-        case "👸🏼": return (.princess, [.mediumLight])
-        case "👸🏽": return (.princess, [.medium])
-        case "👸🏾": return (.princess, [.mediumDark])
-        case "👸🏿": return (.princess, [.dark])
-        case "👳🏻": return (.manWithTurban, [.light])
-        case "👳🏼": return (.manWithTurban, [.mediumLight])
-        case "👳🏽": return (.manWithTurban, [.medium])
-        case "👳🏾": return (.manWithTurban, [.mediumDark])
-        case "👳🏿": return (.manWithTurban, [.dark])
-        case "👳🏻‍♂️": return (.manWearingTurban, [.light])
-        case "👳🏼‍♂️": return (.manWearingTurban, [.mediumLight])
-        case "👳🏽‍♂️": return (.manWearingTurban, [.medium])
-        case "👳🏾‍♂️": return (.manWearingTurban, [.mediumDark])
-        case "👳🏿‍♂️": return (.manWearingTurban, [.dark])
-        case "👳🏻‍♀️": return (.womanWearingTurban, [.light])
-        case "👳🏼‍♀️": return (.womanWearingTurban, [.mediumLight])
-        case "👳🏽‍♀️": return (.womanWearingTurban, [.medium])
-        case "👳🏾‍♀️": return (.womanWearingTurban, [.mediumDark])
-        case "👳🏿‍♀️": return (.womanWearingTurban, [.dark])
-        case "👲🏻": return (.manWithGuaPiMao, [.light])
-        case "👲🏼": return (.manWithGuaPiMao, [.mediumLight])
-        case "👲🏽": return (.manWithGuaPiMao, [.medium])
-        case "👲🏾": return (.manWithGuaPiMao, [.mediumDark])
-        case "👲🏿": return (.manWithGuaPiMao, [.dark])
-        case "🧕🏻": return (.personWithHeadscarf, [.light])
-        case "🧕🏼": return (.personWithHeadscarf, [.mediumLight])
-        case "🧕🏽": return (.personWithHeadscarf, [.medium])
-        case "🧕🏾": return (.personWithHeadscarf, [.mediumDark])
-        case "🧕🏿": return (.personWithHeadscarf, [.dark])
-        case "🤵🏻": return (.personInTuxedo, [.light])
-        case "🤵🏼": return (.personInTuxedo, [.mediumLight])
-        case "🤵🏽": return (.personInTuxedo, [.medium])
-        case "🤵🏾": return (.personInTuxedo, [.mediumDark])
-        case "🤵🏿": return (.personInTuxedo, [.dark])
-        case "🤵🏻‍♂️": return (.manInTuxedo, [.light])
-        case "🤵🏼‍♂️": return (.manInTuxedo, [.mediumLight])
-        case "🤵🏽‍♂️": return (.manInTuxedo, [.medium])
-        case "🤵🏾‍♂️": return (.manInTuxedo, [.mediumDark])
-        case "🤵🏿‍♂️": return (.manInTuxedo, [.dark])
-        case "🤵🏻‍♀️": return (.womanInTuxedo, [.light])
-        case "🤵🏼‍♀️": return (.womanInTuxedo, [.mediumLight])
-        case "🤵🏽‍♀️": return (.womanInTuxedo, [.medium])
-        case "🤵🏾‍♀️": return (.womanInTuxedo, [.mediumDark])
-        case "🤵🏿‍♀️": return (.womanInTuxedo, [.dark])
-        case "👰🏻": return (.brideWithVeil, [.light])
-        case "👰🏼": return (.brideWithVeil, [.mediumLight])
-        case "👰🏽": return (.brideWithVeil, [.medium])
-        case "👰🏾": return (.brideWithVeil, [.mediumDark])
-        case "👰🏿": return (.brideWithVeil, [.dark])
-        case "👰🏻‍♂️": return (.manWithVeil, [.light])
-        case "👰🏼‍♂️": return (.manWithVeil, [.mediumLight])
-        case "👰🏽‍♂️": return (.manWithVeil, [.medium])
-        case "👰🏾‍♂️": return (.manWithVeil, [.mediumDark])
-        case "👰🏿‍♂️": return (.manWithVeil, [.dark])
-        case "👰🏻‍♀️": return (.womanWithVeil, [.light])
-        case "👰🏼‍♀️": return (.womanWithVeil, [.mediumLight])
-        case "👰🏽‍♀️": return (.womanWithVeil, [.medium])
-        case "👰🏾‍♀️": return (.womanWithVeil, [.mediumDark])
-        case "👰🏿‍♀️": return (.womanWithVeil, [.dark])
-        case "🤰🏻": return (.pregnantWoman, [.light])
-        case "🤰🏼": return (.pregnantWoman, [.mediumLight])
-        case "🤰🏽": return (.pregnantWoman, [.medium])
-        case "🤰🏾": return (.pregnantWoman, [.mediumDark])
-        case "🤰🏿": return (.pregnantWoman, [.dark])
-        case "🫃🏻": return (.pregnantMan, [.light])
-        case "🫃🏼": return (.pregnantMan, [.mediumLight])
-        case "🫃🏽": return (.pregnantMan, [.medium])
-        case "🫃🏾": return (.pregnantMan, [.mediumDark])
-        case "🫃🏿": return (.pregnantMan, [.dark])
-        case "🫄🏻": return (.pregnantPerson, [.light])
-        case "🫄🏼": return (.pregnantPerson, [.mediumLight])
-        case "🫄🏽": return (.pregnantPerson, [.medium])
-        case "🫄🏾": return (.pregnantPerson, [.mediumDark])
-        case "🫄🏿": return (.pregnantPerson, [.dark])
-        case "🤱🏻": return (.breastFeeding, [.light])
-        case "🤱🏼": return (.breastFeeding, [.mediumLight])
-        case "🤱🏽": return (.breastFeeding, [.medium])
-        case "🤱🏾": return (.breastFeeding, [.mediumDark])
-        case "🤱🏿": return (.breastFeeding, [.dark])
-        case "👩🏻‍🍼": return (.womanFeedingBaby, [.light])
-        case "👩🏼‍🍼": return (.womanFeedingBaby, [.mediumLight])
-        case "👩🏽‍🍼": return (.womanFeedingBaby, [.medium])
-        case "👩🏾‍🍼": return (.womanFeedingBaby, [.mediumDark])
-        case "👩🏿‍🍼": return (.womanFeedingBaby, [.dark])
-        case "👨🏻‍🍼": return (.manFeedingBaby, [.light])
-        case "👨🏼‍🍼": return (.manFeedingBaby, [.mediumLight])
-        case "👨🏽‍🍼": return (.manFeedingBaby, [.medium])
-        case "👨🏾‍🍼": return (.manFeedingBaby, [.mediumDark])
-        case "👨🏿‍🍼": return (.manFeedingBaby, [.dark])
-        case "🧑🏻‍🍼": return (.personFeedingBaby, [.light])
-        case "🧑🏼‍🍼": return (.personFeedingBaby, [.mediumLight])
-        case "🧑🏽‍🍼": return (.personFeedingBaby, [.medium])
-        case "🧑🏾‍🍼": return (.personFeedingBaby, [.mediumDark])
-        case "🧑🏿‍🍼": return (.personFeedingBaby, [.dark])
-        case "👼🏻": return (.angel, [.light])
-        case "👼🏼": return (.angel, [.mediumLight])
-        case "👼🏽": return (.angel, [.medium])
-        case "👼🏾": return (.angel, [.mediumDark])
-        case "👼🏿": return (.angel, [.dark])
-        case "🎅🏻": return (.santa, [.light])
-        case "🎅🏼": return (.santa, [.mediumLight])
-        case "🎅🏽": return (.santa, [.medium])
-        case "🎅🏾": return (.santa, [.mediumDark])
-        case "🎅🏿": return (.santa, [.dark])
-        case "🤶🏻": return (.mrsClaus, [.light])
-        case "🤶🏼": return (.mrsClaus, [.mediumLight])
-        case "🤶🏽": return (.mrsClaus, [.medium])
-        case "🤶🏾": return (.mrsClaus, [.mediumDark])
-        case "🤶🏿": return (.mrsClaus, [.dark])
-        case "🧑🏻‍🎄": return (.mxClaus, [.light])
-        case "🧑🏼‍🎄": return (.mxClaus, [.mediumLight])
-        case "🧑🏽‍🎄": return (.mxClaus, [.medium])
-        case "🧑🏾‍🎄": return (.mxClaus, [.mediumDark])
-        case "🧑🏿‍🎄": return (.mxClaus, [.dark])
-        case "🦸🏻": return (.superhero, [.light])
-        case "🦸🏼": return (.superhero, [.mediumLight])
-        case "🦸🏽": return (.superhero, [.medium])
-        case "🦸🏾": return (.superhero, [.mediumDark])
-        case "🦸🏿": return (.superhero, [.dark])
-        case "🦸🏻‍♂️": return (.maleSuperhero, [.light])
-        case "🦸🏼‍♂️": return (.maleSuperhero, [.mediumLight])
-        case "🦸🏽‍♂️": return (.maleSuperhero, [.medium])
-        case "🦸🏾‍♂️": return (.maleSuperhero, [.mediumDark])
-        case "🦸🏿‍♂️": return (.maleSuperhero, [.dark])
-        case "🦸🏻‍♀️": return (.femaleSuperhero, [.light])
-        case "🦸🏼‍♀️": return (.femaleSuperhero, [.mediumLight])
-        case "🦸🏽‍♀️": return (.femaleSuperhero, [.medium])
-        case "🦸🏾‍♀️": return (.femaleSuperhero, [.mediumDark])
-        case "🦸🏿‍♀️": return (.femaleSuperhero, [.dark])
-        case "🦹🏻": return (.supervillain, [.light])
-        case "🦹🏼": return (.supervillain, [.mediumLight])
-        case "🦹🏽": return (.supervillain, [.medium])
-        case "🦹🏾": return (.supervillain, [.mediumDark])
-        case "🦹🏿": return (.supervillain, [.dark])
-        case "🦹🏻‍♂️": return (.maleSupervillain, [.light])
-        case "🦹🏼‍♂️": return (.maleSupervillain, [.mediumLight])
-        case "🦹🏽‍♂️": return (.maleSupervillain, [.medium])
-        case "🦹🏾‍♂️": return (.maleSupervillain, [.mediumDark])
-        case "🦹🏿‍♂️": return (.maleSupervillain, [.dark])
-        case "🦹🏻‍♀️": return (.femaleSupervillain, [.light])
-        case "🦹🏼‍♀️": return (.femaleSupervillain, [.mediumLight])
-        case "🦹🏽‍♀️": return (.femaleSupervillain, [.medium])
-        case "🦹🏾‍♀️": return (.femaleSupervillain, [.mediumDark])
-        case "🦹🏿‍♀️": return (.femaleSupervillain, [.dark])
-        case "🧙🏻": return (.mage, [.light])
-        case "🧙🏼": return (.mage, [.mediumLight])
-        case "🧙🏽": return (.mage, [.medium])
-        case "🧙🏾": return (.mage, [.mediumDark])
-        case "🧙🏿": return (.mage, [.dark])
-        case "🧙🏻‍♂️": return (.maleMage, [.light])
-        case "🧙🏼‍♂️": return (.maleMage, [.mediumLight])
-        case "🧙🏽‍♂️": return (.maleMage, [.medium])
-        case "🧙🏾‍♂️": return (.maleMage, [.mediumDark])
-        case "🧙🏿‍♂️": return (.maleMage, [.dark])
-        case "🧙🏻‍♀️": return (.femaleMage, [.light])
-        case "🧙🏼‍♀️": return (.femaleMage, [.mediumLight])
-        case "🧙🏽‍♀️": return (.femaleMage, [.medium])
-        case "🧙🏾‍♀️": return (.femaleMage, [.mediumDark])
-        case "🧙🏿‍♀️": return (.femaleMage, [.dark])
-        case "🧚🏻": return (.fairy, [.light])
-        case "🧚🏼": return (.fairy, [.mediumLight])
-        case "🧚🏽": return (.fairy, [.medium])
-        case "🧚🏾": return (.fairy, [.mediumDark])
-        case "🧚🏿": return (.fairy, [.dark])
-        case "🧚🏻‍♂️": return (.maleFairy, [.light])
-        case "🧚🏼‍♂️": return (.maleFairy, [.mediumLight])
-        case "🧚🏽‍♂️": return (.maleFairy, [.medium])
-        case "🧚🏾‍♂️": return (.maleFairy, [.mediumDark])
-        case "🧚🏿‍♂️": return (.maleFairy, [.dark])
-        case "🧚🏻‍♀️": return (.femaleFairy, [.light])
-        case "🧚🏼‍♀️": return (.femaleFairy, [.mediumLight])
-        case "🧚🏽‍♀️": return (.femaleFairy, [.medium])
-        case "🧚🏾‍♀️": return (.femaleFairy, [.mediumDark])
-        case "🧚🏿‍♀️": return (.femaleFairy, [.dark])
-        case "🧛🏻": return (.vampire, [.light])
-        case "🧛🏼": return (.vampire, [.mediumLight])
-        case "🧛🏽": return (.vampire, [.medium])
-        case "🧛🏾": return (.vampire, [.mediumDark])
-        case "🧛🏿": return (.vampire, [.dark])
-        case "🧛🏻‍♂️": return (.maleVampire, [.light])
-        case "🧛🏼‍♂️": return (.maleVampire, [.mediumLight])
-        case "🧛🏽‍♂️": return (.maleVampire, [.medium])
-        case "🧛🏾‍♂️": return (.maleVampire, [.mediumDark])
-        case "🧛🏿‍♂️": return (.maleVampire, [.dark])
-        case "🧛🏻‍♀️": return (.femaleVampire, [.light])
-        case "🧛🏼‍♀️": return (.femaleVampire, [.mediumLight])
-        case "🧛🏽‍♀️": return (.femaleVampire, [.medium])
-        case "🧛🏾‍♀️": return (.femaleVampire, [.mediumDark])
-        case "🧛🏿‍♀️": return (.femaleVampire, [.dark])
-        case "🧜🏻": return (.merperson, [.light])
-        case "🧜🏼": return (.merperson, [.mediumLight])
-        case "🧜🏽": return (.merperson, [.medium])
-        case "🧜🏾": return (.merperson, [.mediumDark])
-        case "🧜🏿": return (.merperson, [.dark])
-        case "🧜🏻‍♂️": return (.merman, [.light])
-        case "🧜🏼‍♂️": return (.merman, [.mediumLight])
-        case "🧜🏽‍♂️": return (.merman, [.medium])
-        case "🧜🏾‍♂️": return (.merman, [.mediumDark])
-        case "🧜🏿‍♂️": return (.merman, [.dark])
-        case "🧜🏻‍♀️": return (.mermaid, [.light])
-        case "🧜🏼‍♀️": return (.mermaid, [.mediumLight])
-        case "🧜🏽‍♀️": return (.mermaid, [.medium])
-        case "🧜🏾‍♀️": return (.mermaid, [.mediumDark])
-        case "🧜🏿‍♀️": return (.mermaid, [.dark])
-        case "🧝🏻": return (.elf, [.light])
-        case "🧝🏼": return (.elf, [.mediumLight])
-        case "🧝🏽": return (.elf, [.medium])
-        case "🧝🏾": return (.elf, [.mediumDark])
-        case "🧝🏿": return (.elf, [.dark])
-        case "🧝🏻‍♂️": return (.maleElf, [.light])
-        case "🧝🏼‍♂️": return (.maleElf, [.mediumLight])
-        case "🧝🏽‍♂️": return (.maleElf, [.medium])
-        case "🧝🏾‍♂️": return (.maleElf, [.mediumDark])
-        case "🧝🏿‍♂️": return (.maleElf, [.dark])
-        case "🧝🏻‍♀️": return (.femaleElf, [.light])
-        case "🧝🏼‍♀️": return (.femaleElf, [.mediumLight])
-        case "🧝🏽‍♀️": return (.femaleElf, [.medium])
-        case "🧝🏾‍♀️": return (.femaleElf, [.mediumDark])
-        case "🧝🏿‍♀️": return (.femaleElf, [.dark])
-        case "💆🏻": return (.massage, [.light])
-        case "💆🏼": return (.massage, [.mediumLight])
-        case "💆🏽": return (.massage, [.medium])
-        case "💆🏾": return (.massage, [.mediumDark])
-        case "💆🏿": return (.massage, [.dark])
-        case "💆🏻‍♂️": return (.manGettingMassage, [.light])
-        case "💆🏼‍♂️": return (.manGettingMassage, [.mediumLight])
-        case "💆🏽‍♂️": return (.manGettingMassage, [.medium])
-        case "💆🏾‍♂️": return (.manGettingMassage, [.mediumDark])
-        case "💆🏿‍♂️": return (.manGettingMassage, [.dark])
-        case "💆🏻‍♀️": return (.womanGettingMassage, [.light])
-        case "💆🏼‍♀️": return (.womanGettingMassage, [.mediumLight])
-        case "💆🏽‍♀️": return (.womanGettingMassage, [.medium])
-        case "💆🏾‍♀️": return (.womanGettingMassage, [.mediumDark])
-        case "💆🏿‍♀️": return (.womanGettingMassage, [.dark])
-        case "💇🏻": return (.haircut, [.light])
-        case "💇🏼": return (.haircut, [.mediumLight])
-        case "💇🏽": return (.haircut, [.medium])
-        case "💇🏾": return (.haircut, [.mediumDark])
-        case "💇🏿": return (.haircut, [.dark])
-        case "💇🏻‍♂️": return (.manGettingHaircut, [.light])
-        case "💇🏼‍♂️": return (.manGettingHaircut, [.mediumLight])
-        case "💇🏽‍♂️": return (.manGettingHaircut, [.medium])
-        case "💇🏾‍♂️": return (.manGettingHaircut, [.mediumDark])
-        case "💇🏿‍♂️": return (.manGettingHaircut, [.dark])
-        case "💇🏻‍♀️": return (.womanGettingHaircut, [.light])
-        case "💇🏼‍♀️": return (.womanGettingHaircut, [.mediumLight])
-        case "💇🏽‍♀️": return (.womanGettingHaircut, [.medium])
-        case "💇🏾‍♀️": return (.womanGettingHaircut, [.mediumDark])
-        case "💇🏿‍♀️": return (.womanGettingHaircut, [.dark])
-        case "🚶🏻": return (.walking, [.light])
-        case "🚶🏼": return (.walking, [.mediumLight])
-        case "🚶🏽": return (.walking, [.medium])
-        case "🚶🏾": return (.walking, [.mediumDark])
-        case "🚶🏿": return (.walking, [.dark])
-        case "🚶🏻‍♂️": return (.manWalking, [.light])
-        case "🚶🏼‍♂️": return (.manWalking, [.mediumLight])
-        case "🚶🏽‍♂️": return (.manWalking, [.medium])
-        case "🚶🏾‍♂️": return (.manWalking, [.mediumDark])
-        case "🚶🏿‍♂️": return (.manWalking, [.dark])
-        case "🚶🏻‍♀️": return (.womanWalking, [.light])
-        case "🚶🏼‍♀️": return (.womanWalking, [.mediumLight])
-        case "🚶🏽‍♀️": return (.womanWalking, [.medium])
-        case "🚶🏾‍♀️": return (.womanWalking, [.mediumDark])
-        case "🚶🏿‍♀️": return (.womanWalking, [.dark])
-        case "🚶🏻‍➡️": return (.personWalkingFacingRight, [.light])
-        case "🚶🏼‍➡️": return (.personWalkingFacingRight, [.mediumLight])
-        case "🚶🏽‍➡️": return (.personWalkingFacingRight, [.medium])
-        case "🚶🏾‍➡️": return (.personWalkingFacingRight, [.mediumDark])
-        case "🚶🏿‍➡️": return (.personWalkingFacingRight, [.dark])
-        case "🚶🏻‍♀️‍➡️": return (.womanWalkingFacingRight, [.light])
-        case "🚶🏼‍♀️‍➡️": return (.womanWalkingFacingRight, [.mediumLight])
-        case "🚶🏽‍♀️‍➡️": return (.womanWalkingFacingRight, [.medium])
-        case "🚶🏾‍♀️‍➡️": return (.womanWalkingFacingRight, [.mediumDark])
-        case "🚶🏿‍♀️‍➡️": return (.womanWalkingFacingRight, [.dark])
-        case "🚶🏻‍♂️‍➡️": return (.manWalkingFacingRight, [.light])
-        case "🚶🏼‍♂️‍➡️": return (.manWalkingFacingRight, [.mediumLight])
-        case "🚶🏽‍♂️‍➡️": return (.manWalkingFacingRight, [.medium])
-        case "🚶🏾‍♂️‍➡️": return (.manWalkingFacingRight, [.mediumDark])
-        case "🚶🏿‍♂️‍➡️": return (.manWalkingFacingRight, [.dark])
-        case "🧍🏻": return (.standingPerson, [.light])
-        case "🧍🏼": return (.standingPerson, [.mediumLight])
-        case "🧍🏽": return (.standingPerson, [.medium])
-        case "🧍🏾": return (.standingPerson, [.mediumDark])
-        case "🧍🏿": return (.standingPerson, [.dark])
-        case "🧍🏻‍♂️": return (.manStanding, [.light])
-        case "🧍🏼‍♂️": return (.manStanding, [.mediumLight])
-        case "🧍🏽‍♂️": return (.manStanding, [.medium])
-        case "🧍🏾‍♂️": return (.manStanding, [.mediumDark])
-        case "🧍🏿‍♂️": return (.manStanding, [.dark])
-        case "🧍🏻‍♀️": return (.womanStanding, [.light])
-        case "🧍🏼‍♀️": return (.womanStanding, [.mediumLight])
-        case "🧍🏽‍♀️": return (.womanStanding, [.medium])
-        case "🧍🏾‍♀️": return (.womanStanding, [.mediumDark])
-        case "🧍🏿‍♀️": return (.womanStanding, [.dark])
-        case "🧎🏻": return (.kneelingPerson, [.light])
-        case "🧎🏼": return (.kneelingPerson, [.mediumLight])
-        case "🧎🏽": return (.kneelingPerson, [.medium])
-        case "🧎🏾": return (.kneelingPerson, [.mediumDark])
-        case "🧎🏿": return (.kneelingPerson, [.dark])
-        case "🧎🏻‍♂️": return (.manKneeling, [.light])
-        case "🧎🏼‍♂️": return (.manKneeling, [.mediumLight])
-        case "🧎🏽‍♂️": return (.manKneeling, [.medium])
-        case "🧎🏾‍♂️": return (.manKneeling, [.mediumDark])
-        case "🧎🏿‍♂️": return (.manKneeling, [.dark])
-        case "🧎🏻‍♀️": return (.womanKneeling, [.light])
-        case "🧎🏼‍♀️": return (.womanKneeling, [.mediumLight])
-        case "🧎🏽‍♀️": return (.womanKneeling, [.medium])
-        case "🧎🏾‍♀️": return (.womanKneeling, [.mediumDark])
-        case "🧎🏿‍♀️": return (.womanKneeling, [.dark])
-        case "🧎🏻‍➡️": return (.personKneelingFacingRight, [.light])
-        case "🧎🏼‍➡️": return (.personKneelingFacingRight, [.mediumLight])
-        case "🧎🏽‍➡️": return (.personKneelingFacingRight, [.medium])
-        case "🧎🏾‍➡️": return (.personKneelingFacingRight, [.mediumDark])
-        case "🧎🏿‍➡️": return (.personKneelingFacingRight, [.dark])
-        case "🧎🏻‍♀️‍➡️": return (.womanKneelingFacingRight, [.light])
-        case "🧎🏼‍♀️‍➡️": return (.womanKneelingFacingRight, [.mediumLight])
-        case "🧎🏽‍♀️‍➡️": return (.womanKneelingFacingRight, [.medium])
-        case "🧎🏾‍♀️‍➡️": return (.womanKneelingFacingRight, [.mediumDark])
-        case "🧎🏿‍♀️‍➡️": return (.womanKneelingFacingRight, [.dark])
-        case "🧎🏻‍♂️‍➡️": return (.manKneelingFacingRight, [.light])
-        case "🧎🏼‍♂️‍➡️": return (.manKneelingFacingRight, [.mediumLight])
-        case "🧎🏽‍♂️‍➡️": return (.manKneelingFacingRight, [.medium])
-        case "🧎🏾‍♂️‍➡️": return (.manKneelingFacingRight, [.mediumDark])
-        case "🧎🏿‍♂️‍➡️": return (.manKneelingFacingRight, [.dark])
-        case "🧑🏻‍🦯": return (.personWithProbingCane, [.light])
-        case "🧑🏼‍🦯": return (.personWithProbingCane, [.mediumLight])
-        case "🧑🏽‍🦯": return (.personWithProbingCane, [.medium])
-        case "🧑🏾‍🦯": return (.personWithProbingCane, [.mediumDark])
-        case "🧑🏿‍🦯": return (.personWithProbingCane, [.dark])
-        case "🧑🏻‍🦯‍➡️": return (.personWithWhiteCaneFacingRight, [.light])
-        case "🧑🏼‍🦯‍➡️": return (.personWithWhiteCaneFacingRight, [.mediumLight])
-        case "🧑🏽‍🦯‍➡️": return (.personWithWhiteCaneFacingRight, [.medium])
-        case "🧑🏾‍🦯‍➡️": return (.personWithWhiteCaneFacingRight, [.mediumDark])
-        case "🧑🏿‍🦯‍➡️": return (.personWithWhiteCaneFacingRight, [.dark])
-        case "👨🏻‍🦯": return (.manWithProbingCane, [.light])
-        case "👨🏼‍🦯": return (.manWithProbingCane, [.mediumLight])
-        case "👨🏽‍🦯": return (.manWithProbingCane, [.medium])
-        case "👨🏾‍🦯": return (.manWithProbingCane, [.mediumDark])
-        case "👨🏿‍🦯": return (.manWithProbingCane, [.dark])
-        case "👨🏻‍🦯‍➡️": return (.manWithWhiteCaneFacingRight, [.light])
-        case "👨🏼‍🦯‍➡️": return (.manWithWhiteCaneFacingRight, [.mediumLight])
-        case "👨🏽‍🦯‍➡️": return (.manWithWhiteCaneFacingRight, [.medium])
-        case "👨🏾‍🦯‍➡️": return (.manWithWhiteCaneFacingRight, [.mediumDark])
-        case "👨🏿‍🦯‍➡️": return (.manWithWhiteCaneFacingRight, [.dark])
-        case "👩🏻‍🦯": return (.womanWithProbingCane, [.light])
-        case "👩🏼‍🦯": return (.womanWithProbingCane, [.mediumLight])
-        case "👩🏽‍🦯": return (.womanWithProbingCane, [.medium])
-        case "👩🏾‍🦯": return (.womanWithProbingCane, [.mediumDark])
-        case "👩🏿‍🦯": return (.womanWithProbingCane, [.dark])
-        case "👩🏻‍🦯‍➡️": return (.womanWithWhiteCaneFacingRight, [.light])
-        case "👩🏼‍🦯‍➡️": return (.womanWithWhiteCaneFacingRight, [.mediumLight])
-        case "👩🏽‍🦯‍➡️": return (.womanWithWhiteCaneFacingRight, [.medium])
-        case "👩🏾‍🦯‍➡️": return (.womanWithWhiteCaneFacingRight, [.mediumDark])
-        case "👩🏿‍🦯‍➡️": return (.womanWithWhiteCaneFacingRight, [.dark])
-        case "🧑🏻‍🦼": return (.personInMotorizedWheelchair, [.light])
-        case "🧑🏼‍🦼": return (.personInMotorizedWheelchair, [.mediumLight])
-        case "🧑🏽‍🦼": return (.personInMotorizedWheelchair, [.medium])
-        case "🧑🏾‍🦼": return (.personInMotorizedWheelchair, [.mediumDark])
-        case "🧑🏿‍🦼": return (.personInMotorizedWheelchair, [.dark])
-        case "🧑🏻‍🦼‍➡️": return (.personInMotorizedWheelchairFacingRight, [.light])
-        case "🧑🏼‍🦼‍➡️": return (.personInMotorizedWheelchairFacingRight, [.mediumLight])
-        case "🧑🏽‍🦼‍➡️": return (.personInMotorizedWheelchairFacingRight, [.medium])
-        case "🧑🏾‍🦼‍➡️": return (.personInMotorizedWheelchairFacingRight, [.mediumDark])
-        case "🧑🏿‍🦼‍➡️": return (.personInMotorizedWheelchairFacingRight, [.dark])
-        case "👨🏻‍🦼": return (.manInMotorizedWheelchair, [.light])
-        case "👨🏼‍🦼": return (.manInMotorizedWheelchair, [.mediumLight])
-        case "👨🏽‍🦼": return (.manInMotorizedWheelchair, [.medium])
-        case "👨🏾‍🦼": return (.manInMotorizedWheelchair, [.mediumDark])
-        case "👨🏿‍🦼": return (.manInMotorizedWheelchair, [.dark])
-        case "👨🏻‍🦼‍➡️": return (.manInMotorizedWheelchairFacingRight, [.light])
-        case "👨🏼‍🦼‍➡️": return (.manInMotorizedWheelchairFacingRight, [.mediumLight])
-        case "👨🏽‍🦼‍➡️": return (.manInMotorizedWheelchairFacingRight, [.medium])
-        case "👨🏾‍🦼‍➡️": return (.manInMotorizedWheelchairFacingRight, [.mediumDark])
-        case "👨🏿‍🦼‍➡️": return (.manInMotorizedWheelchairFacingRight, [.dark])
-        case "👩🏻‍🦼": return (.womanInMotorizedWheelchair, [.light])
-        case "👩🏼‍🦼": return (.womanInMotorizedWheelchair, [.mediumLight])
-        case "👩🏽‍🦼": return (.womanInMotorizedWheelchair, [.medium])
-        case "👩🏾‍🦼": return (.womanInMotorizedWheelchair, [.mediumDark])
-        case "👩🏿‍🦼": return (.womanInMotorizedWheelchair, [.dark])
-        case "👩🏻‍🦼‍➡️": return (.womanInMotorizedWheelchairFacingRight, [.light])
-        case "👩🏼‍🦼‍➡️": return (.womanInMotorizedWheelchairFacingRight, [.mediumLight])
-        case "👩🏽‍🦼‍➡️": return (.womanInMotorizedWheelchairFacingRight, [.medium])
-        case "👩🏾‍🦼‍➡️": return (.womanInMotorizedWheelchairFacingRight, [.mediumDark])
-        case "👩🏿‍🦼‍➡️": return (.womanInMotorizedWheelchairFacingRight, [.dark])
-        case "🧑🏻‍🦽": return (.personInManualWheelchair, [.light])
-        case "🧑🏼‍🦽": return (.personInManualWheelchair, [.mediumLight])
-        case "🧑🏽‍🦽": return (.personInManualWheelchair, [.medium])
-        case "🧑🏾‍🦽": return (.personInManualWheelchair, [.mediumDark])
-        case "🧑🏿‍🦽": return (.personInManualWheelchair, [.dark])
-        case "🧑🏻‍🦽‍➡️": return (.personInManualWheelchairFacingRight, [.light])
-        case "🧑🏼‍🦽‍➡️": return (.personInManualWheelchairFacingRight, [.mediumLight])
-        case "🧑🏽‍🦽‍➡️": return (.personInManualWheelchairFacingRight, [.medium])
-        case "🧑🏾‍🦽‍➡️": return (.personInManualWheelchairFacingRight, [.mediumDark])
-        case "🧑🏿‍🦽‍➡️": return (.personInManualWheelchairFacingRight, [.dark])
-        case "👨🏻‍🦽": return (.manInManualWheelchair, [.light])
-        case "👨🏼‍🦽": return (.manInManualWheelchair, [.mediumLight])
-        case "👨🏽‍🦽": return (.manInManualWheelchair, [.medium])
-        case "👨🏾‍🦽": return (.manInManualWheelchair, [.mediumDark])
-        case "👨🏿‍🦽": return (.manInManualWheelchair, [.dark])
-        case "👨🏻‍🦽‍➡️": return (.manInManualWheelchairFacingRight, [.light])
-        case "👨🏼‍🦽‍➡️": return (.manInManualWheelchairFacingRight, [.mediumLight])
-        case "👨🏽‍🦽‍➡️": return (.manInManualWheelchairFacingRight, [.medium])
-        case "👨🏾‍🦽‍➡️": return (.manInManualWheelchairFacingRight, [.mediumDark])
-        case "👨🏿‍🦽‍➡️": return (.manInManualWheelchairFacingRight, [.dark])
-        case "👩🏻‍🦽": return (.womanInManualWheelchair, [.light])
-        case "👩🏼‍🦽": return (.womanInManualWheelchair, [.mediumLight])
-        case "👩🏽‍🦽": return (.womanInManualWheelchair, [.medium])
-        case "👩🏾‍🦽": return (.womanInManualWheelchair, [.mediumDark])
-        case "👩🏿‍🦽": return (.womanInManualWheelchair, [.dark])
-        case "👩🏻‍🦽‍➡️": return (.womanInManualWheelchairFacingRight, [.light])
-        case "👩🏼‍🦽‍➡️": return (.womanInManualWheelchairFacingRight, [.mediumLight])
-        case "👩🏽‍🦽‍➡️": return (.womanInManualWheelchairFacingRight, [.medium])
-        case "👩🏾‍🦽‍➡️": return (.womanInManualWheelchairFacingRight, [.mediumDark])
-        case "👩🏿‍🦽‍➡️": return (.womanInManualWheelchairFacingRight, [.dark])
-        case "🏃🏻": return (.runner, [.light])
-        case "🏃🏼": return (.runner, [.mediumLight])
-        case "🏃🏽": return (.runner, [.medium])
-        case "🏃🏾": return (.runner, [.mediumDark])
-        case "🏃🏿": return (.runner, [.dark])
-        case "🏃🏻‍♂️": return (.manRunning, [.light])
-        case "🏃🏼‍♂️": return (.manRunning, [.mediumLight])
-        case "🏃🏽‍♂️": return (.manRunning, [.medium])
-        case "🏃🏾‍♂️": return (.manRunning, [.mediumDark])
-        case "🏃🏿‍♂️": return (.manRunning, [.dark])
-        case "🏃🏻‍♀️": return (.womanRunning, [.light])
-        case "🏃🏼‍♀️": return (.womanRunning, [.mediumLight])
-        case "🏃🏽‍♀️": return (.womanRunning, [.medium])
-        case "🏃🏾‍♀️": return (.womanRunning, [.mediumDark])
-        case "🏃🏿‍♀️": return (.womanRunning, [.dark])
-        case "🏃🏻‍➡️": return (.personRunningFacingRight, [.light])
-        case "🏃🏼‍➡️": return (.personRunningFacingRight, [.mediumLight])
-        case "🏃🏽‍➡️": return (.personRunningFacingRight, [.medium])
-        case "🏃🏾‍➡️": return (.personRunningFacingRight, [.mediumDark])
-        case "🏃🏿‍➡️": return (.personRunningFacingRight, [.dark])
-        case "🏃🏻‍♀️‍➡️": return (.womanRunningFacingRight, [.light])
-        case "🏃🏼‍♀️‍➡️": return (.womanRunningFacingRight, [.mediumLight])
-        case "🏃🏽‍♀️‍➡️": return (.womanRunningFacingRight, [.medium])
-        case "🏃🏾‍♀️‍➡️": return (.womanRunningFacingRight, [.mediumDark])
-        case "🏃🏿‍♀️‍➡️": return (.womanRunningFacingRight, [.dark])
-        case "🏃🏻‍♂️‍➡️": return (.manRunningFacingRight, [.light])
-        case "🏃🏼‍♂️‍➡️": return (.manRunningFacingRight, [.mediumLight])
-        case "🏃🏽‍♂️‍➡️": return (.manRunningFacingRight, [.medium])
-        case "🏃🏾‍♂️‍➡️": return (.manRunningFacingRight, [.mediumDark])
-        case "🏃🏿‍♂️‍➡️": return (.manRunningFacingRight, [.dark])
-        case "💃🏻": return (.dancer, [.light])
-        case "💃🏼": return (.dancer, [.mediumLight])
-        case "💃🏽": return (.dancer, [.medium])
-        case "💃🏾": return (.dancer, [.mediumDark])
-        case "💃🏿": return (.dancer, [.dark])
-        case "🕺🏻": return (.manDancing, [.light])
-        case "🕺🏼": return (.manDancing, [.mediumLight])
-        case "🕺🏽": return (.manDancing, [.medium])
-        case "🕺🏾": return (.manDancing, [.mediumDark])
-        case "🕺🏿": return (.manDancing, [.dark])
-        case "🕴🏻": return (.manInBusinessSuitLevitating, [.light])
-        case "🕴🏼": return (.manInBusinessSuitLevitating, [.mediumLight])
-        case "🕴🏽": return (.manInBusinessSuitLevitating, [.medium])
-        case "🕴🏾": return (.manInBusinessSuitLevitating, [.mediumDark])
-        case "🕴🏿": return (.manInBusinessSuitLevitating, [.dark])
-        case "🧖🏻": return (.personInSteamyRoom, [.light])
-        case "🧖🏼": return (.personInSteamyRoom, [.mediumLight])
-        case "🧖🏽": return (.personInSteamyRoom, [.medium])
-        case "🧖🏾": return (.personInSteamyRoom, [.mediumDark])
-        case "🧖🏿": return (.personInSteamyRoom, [.dark])
-        case "🧖🏻‍♂️": return (.manInSteamyRoom, [.light])
-        case "🧖🏼‍♂️": return (.manInSteamyRoom, [.mediumLight])
-        case "🧖🏽‍♂️": return (.manInSteamyRoom, [.medium])
-        case "🧖🏾‍♂️": return (.manInSteamyRoom, [.mediumDark])
-        case "🧖🏿‍♂️": return (.manInSteamyRoom, [.dark])
-        case "🧖🏻‍♀️": return (.womanInSteamyRoom, [.light])
-        case "🧖🏼‍♀️": return (.womanInSteamyRoom, [.mediumLight])
-        case "🧖🏽‍♀️": return (.womanInSteamyRoom, [.medium])
-        case "🧖🏾‍♀️": return (.womanInSteamyRoom, [.mediumDark])
-        case "🧖🏿‍♀️": return (.womanInSteamyRoom, [.dark])
-        case "🧗🏻": return (.personClimbing, [.light])
-        case "🧗🏼": return (.personClimbing, [.mediumLight])
-        case "🧗🏽": return (.personClimbing, [.medium])
-        case "🧗🏾": return (.personClimbing, [.mediumDark])
-        case "🧗🏿": return (.personClimbing, [.dark])
-        case "🧗🏻‍♂️": return (.manClimbing, [.light])
-        case "🧗🏼‍♂️": return (.manClimbing, [.mediumLight])
-        case "🧗🏽‍♂️": return (.manClimbing, [.medium])
-        case "🧗🏾‍♂️": return (.manClimbing, [.mediumDark])
-        case "🧗🏿‍♂️": return (.manClimbing, [.dark])
-        case "🧗🏻‍♀️": return (.womanClimbing, [.light])
-        case "🧗🏼‍♀️": return (.womanClimbing, [.mediumLight])
-        case "🧗🏽‍♀️": return (.womanClimbing, [.medium])
-        case "🧗🏾‍♀️": return (.womanClimbing, [.mediumDark])
-        case "🧗🏿‍♀️": return (.womanClimbing, [.dark])
-        case "🏇🏻": return (.horseRacing, [.light])
-        case "🏇🏼": return (.horseRacing, [.mediumLight])
-        case "🏇🏽": return (.horseRacing, [.medium])
-        case "🏇🏾": return (.horseRacing, [.mediumDark])
-        case "🏇🏿": return (.horseRacing, [.dark])
-        case "🏂🏻": return (.snowboarder, [.light])
-        case "🏂🏼": return (.snowboarder, [.mediumLight])
-        case "🏂🏽": return (.snowboarder, [.medium])
-        case "🏂🏾": return (.snowboarder, [.mediumDark])
-        case "🏂🏿": return (.snowboarder, [.dark])
-        case "🏌🏻": return (.golfer, [.light])
-        case "🏌🏼": return (.golfer, [.mediumLight])
-        case "🏌🏽": return (.golfer, [.medium])
-        case "🏌🏾": return (.golfer, [.mediumDark])
-        case "🏌🏿": return (.golfer, [.dark])
-        case "🏌🏻‍♂️": return (.manGolfing, [.light])
-        case "🏌🏼‍♂️": return (.manGolfing, [.mediumLight])
-        case "🏌🏽‍♂️": return (.manGolfing, [.medium])
-        case "🏌🏾‍♂️": return (.manGolfing, [.mediumDark])
-        case "🏌🏿‍♂️": return (.manGolfing, [.dark])
-        case "🏌🏻‍♀️": return (.womanGolfing, [.light])
-        case "🏌🏼‍♀️": return (.womanGolfing, [.mediumLight])
-        case "🏌🏽‍♀️": return (.womanGolfing, [.medium])
-        case "🏌🏾‍♀️": return (.womanGolfing, [.mediumDark])
-        case "🏌🏿‍♀️": return (.womanGolfing, [.dark])
-        case "🏄🏻": return (.surfer, [.light])
-        case "🏄🏼": return (.surfer, [.mediumLight])
-        case "🏄🏽": return (.surfer, [.medium])
-        case "🏄🏾": return (.surfer, [.mediumDark])
-        case "🏄🏿": return (.surfer, [.dark])
-        case "🏄🏻‍♂️": return (.manSurfing, [.light])
-        case "🏄🏼‍♂️": return (.manSurfing, [.mediumLight])
-        case "🏄🏽‍♂️": return (.manSurfing, [.medium])
-        case "🏄🏾‍♂️": return (.manSurfing, [.mediumDark])
-        case "🏄🏿‍♂️": return (.manSurfing, [.dark])
-        case "🏄🏻‍♀️": return (.womanSurfing, [.light])
-        case "🏄🏼‍♀️": return (.womanSurfing, [.mediumLight])
-        case "🏄🏽‍♀️": return (.womanSurfing, [.medium])
-        case "🏄🏾‍♀️": return (.womanSurfing, [.mediumDark])
-        case "🏄🏿‍♀️": return (.womanSurfing, [.dark])
-        case "🚣🏻": return (.rowboat, [.light])
-        case "🚣🏼": return (.rowboat, [.mediumLight])
-        case "🚣🏽": return (.rowboat, [.medium])
-        case "🚣🏾": return (.rowboat, [.mediumDark])
-        case "🚣🏿": return (.rowboat, [.dark])
-        case "🚣🏻‍♂️": return (.manRowingBoat, [.light])
-        case "🚣🏼‍♂️": return (.manRowingBoat, [.mediumLight])
-        case "🚣🏽‍♂️": return (.manRowingBoat, [.medium])
-        case "🚣🏾‍♂️": return (.manRowingBoat, [.mediumDark])
-        case "🚣🏿‍♂️": return (.manRowingBoat, [.dark])
-        case "🚣🏻‍♀️": return (.womanRowingBoat, [.light])
-        case "🚣🏼‍♀️": return (.womanRowingBoat, [.mediumLight])
-        case "🚣🏽‍♀️": return (.womanRowingBoat, [.medium])
-        case "🚣🏾‍♀️": return (.womanRowingBoat, [.mediumDark])
-        case "🚣🏿‍♀️": return (.womanRowingBoat, [.dark])
-        case "🏊🏻": return (.swimmer, [.light])
-        case "🏊🏼": return (.swimmer, [.mediumLight])
-        case "🏊🏽": return (.swimmer, [.medium])
-        case "🏊🏾": return (.swimmer, [.mediumDark])
-        case "🏊🏿": return (.swimmer, [.dark])
-        case "🏊🏻‍♂️": return (.manSwimming, [.light])
-        case "🏊🏼‍♂️": return (.manSwimming, [.mediumLight])
-        case "🏊🏽‍♂️": return (.manSwimming, [.medium])
-        case "🏊🏾‍♂️": return (.manSwimming, [.mediumDark])
-        case "🏊🏿‍♂️": return (.manSwimming, [.dark])
-        case "🏊🏻‍♀️": return (.womanSwimming, [.light])
-        case "🏊🏼‍♀️": return (.womanSwimming, [.mediumLight])
-        case "🏊🏽‍♀️": return (.womanSwimming, [.medium])
-        case "🏊🏾‍♀️": return (.womanSwimming, [.mediumDark])
-        case "🏊🏿‍♀️": return (.womanSwimming, [.dark])
-        case "⛹🏻": return (.personWithBall, [.light])
-        case "⛹🏼": return (.personWithBall, [.mediumLight])
-        case "⛹🏽": return (.personWithBall, [.medium])
-        case "⛹🏾": return (.personWithBall, [.mediumDark])
-        case "⛹🏿": return (.personWithBall, [.dark])
-        case "⛹🏻‍♂️": return (.manBouncingBall, [.light])
-        case "⛹🏼‍♂️": return (.manBouncingBall, [.mediumLight])
-        case "⛹🏽‍♂️": return (.manBouncingBall, [.medium])
-        case "⛹🏾‍♂️": return (.manBouncingBall, [.mediumDark])
-        case "⛹🏿‍♂️": return (.manBouncingBall, [.dark])
-        case "⛹🏻‍♀️": return (.womanBouncingBall, [.light])
-        case "⛹🏼‍♀️": return (.womanBouncingBall, [.mediumLight])
-        case "⛹🏽‍♀️": return (.womanBouncingBall, [.medium])
-        case "⛹🏾‍♀️": return (.womanBouncingBall, [.mediumDark])
-        case "⛹🏿‍♀️": return (.womanBouncingBall, [.dark])
-        case "🏋🏻": return (.weightLifter, [.light])
-        case "🏋🏼": return (.weightLifter, [.mediumLight])
-        case "🏋🏽": return (.weightLifter, [.medium])
-        case "🏋🏾": return (.weightLifter, [.mediumDark])
-        case "🏋🏿": return (.weightLifter, [.dark])
-        case "🏋🏻‍♂️": return (.manLiftingWeights, [.light])
-        case "🏋🏼‍♂️": return (.manLiftingWeights, [.mediumLight])
-        case "🏋🏽‍♂️": return (.manLiftingWeights, [.medium])
-        case "🏋🏾‍♂️": return (.manLiftingWeights, [.mediumDark])
-        case "🏋🏿‍♂️": return (.manLiftingWeights, [.dark])
-        case "🏋🏻‍♀️": return (.womanLiftingWeights, [.light])
-        case "🏋🏼‍♀️": return (.womanLiftingWeights, [.mediumLight])
-        case "🏋🏽‍♀️": return (.womanLiftingWeights, [.medium])
-        case "🏋🏾‍♀️": return (.womanLiftingWeights, [.mediumDark])
-        case "🏋🏿‍♀️": return (.womanLiftingWeights, [.dark])
-        case "🚴🏻": return (.bicyclist, [.light])
-        case "🚴🏼": return (.bicyclist, [.mediumLight])
-        case "🚴🏽": return (.bicyclist, [.medium])
-        case "🚴🏾": return (.bicyclist, [.mediumDark])
-        case "🚴🏿": return (.bicyclist, [.dark])
-        case "🚴🏻‍♂️": return (.manBiking, [.light])
-        case "🚴🏼‍♂️": return (.manBiking, [.mediumLight])
-        case "🚴🏽‍♂️": return (.manBiking, [.medium])
-        case "🚴🏾‍♂️": return (.manBiking, [.mediumDark])
-        case "🚴🏿‍♂️": return (.manBiking, [.dark])
-        case "🚴🏻‍♀️": return (.womanBiking, [.light])
-        case "🚴🏼‍♀️": return (.womanBiking, [.mediumLight])
-        case "🚴🏽‍♀️": return (.womanBiking, [.medium])
-        case "🚴🏾‍♀️": return (.womanBiking, [.mediumDark])
-        case "🚴🏿‍♀️": return (.womanBiking, [.dark])
-        case "🚵🏻": return (.mountainBicyclist, [.light])
-        case "🚵🏼": return (.mountainBicyclist, [.mediumLight])
-        case "🚵🏽": return (.mountainBicyclist, [.medium])
-        case "🚵🏾": return (.mountainBicyclist, [.mediumDark])
-        case "🚵🏿": return (.mountainBicyclist, [.dark])
-        case "🚵🏻‍♂️": return (.manMountainBiking, [.light])
-        case "🚵🏼‍♂️": return (.manMountainBiking, [.mediumLight])
-        case "🚵🏽‍♂️": return (.manMountainBiking, [.medium])
-        case "🚵🏾‍♂️": return (.manMountainBiking, [.mediumDark])
-        case "🚵🏿‍♂️": return (.manMountainBiking, [.dark])
-        case "🚵🏻‍♀️": return (.womanMountainBiking, [.light])
-        case "🚵🏼‍♀️": return (.womanMountainBiking, [.mediumLight])
-        case "🚵🏽‍♀️": return (.womanMountainBiking, [.medium])
-        case "🚵🏾‍♀️": return (.womanMountainBiking, [.mediumDark])
-        case "🚵🏿‍♀️": return (.womanMountainBiking, [.dark])
-        case "🤸🏻": return (.personDoingCartwheel, [.light])
-        case "🤸🏼": return (.personDoingCartwheel, [.mediumLight])
-        case "🤸🏽": return (.personDoingCartwheel, [.medium])
-        case "🤸🏾": return (.personDoingCartwheel, [.mediumDark])
-        case "🤸🏿": return (.personDoingCartwheel, [.dark])
-        case "🤸🏻‍♂️": return (.manCartwheeling, [.light])
-        case "🤸🏼‍♂️": return (.manCartwheeling, [.mediumLight])
-        case "🤸🏽‍♂️": return (.manCartwheeling, [.medium])
-        case "🤸🏾‍♂️": return (.manCartwheeling, [.mediumDark])
-        case "🤸🏿‍♂️": return (.manCartwheeling, [.dark])
-        case "🤸🏻‍♀️": return (.womanCartwheeling, [.light])
-        case "🤸🏼‍♀️": return (.womanCartwheeling, [.mediumLight])
-        case "🤸🏽‍♀️": return (.womanCartwheeling, [.medium])
-        case "🤸🏾‍♀️": return (.womanCartwheeling, [.mediumDark])
-        case "🤸🏿‍♀️": return (.womanCartwheeling, [.dark])
-        case "🤽🏻": return (.waterPolo, [.light])
-        case "🤽🏼": return (.waterPolo, [.mediumLight])
-        case "🤽🏽": return (.waterPolo, [.medium])
-        case "🤽🏾": return (.waterPolo, [.mediumDark])
-        case "🤽🏿": return (.waterPolo, [.dark])
-        case "🤽🏻‍♂️": return (.manPlayingWaterPolo, [.light])
-        case "🤽🏼‍♂️": return (.manPlayingWaterPolo, [.mediumLight])
-        case "🤽🏽‍♂️": return (.manPlayingWaterPolo, [.medium])
-        case "🤽🏾‍♂️": return (.manPlayingWaterPolo, [.mediumDark])
-        case "🤽🏿‍♂️": return (.manPlayingWaterPolo, [.dark])
-        case "🤽🏻‍♀️": return (.womanPlayingWaterPolo, [.light])
-        case "🤽🏼‍♀️": return (.womanPlayingWaterPolo, [.mediumLight])
-        case "🤽🏽‍♀️": return (.womanPlayingWaterPolo, [.medium])
-        case "🤽🏾‍♀️": return (.womanPlayingWaterPolo, [.mediumDark])
-        case "🤽🏿‍♀️": return (.womanPlayingWaterPolo, [.dark])
-        case "🤾🏻": return (.handball, [.light])
-        case "🤾🏼": return (.handball, [.mediumLight])
-        case "🤾🏽": return (.handball, [.medium])
-        case "🤾🏾": return (.handball, [.mediumDark])
-        case "🤾🏿": return (.handball, [.dark])
-        case "🤾🏻‍♂️": return (.manPlayingHandball, [.light])
-        case "🤾🏼‍♂️": return (.manPlayingHandball, [.mediumLight])
-        case "🤾🏽‍♂️": return (.manPlayingHandball, [.medium])
-        case "🤾🏾‍♂️": return (.manPlayingHandball, [.mediumDark])
-        case "🤾🏿‍♂️": return (.manPlayingHandball, [.dark])
-        case "🤾🏻‍♀️": return (.womanPlayingHandball, [.light])
-        case "🤾🏼‍♀️": return (.womanPlayingHandball, [.mediumLight])
-        case "🤾🏽‍♀️": return (.womanPlayingHandball, [.medium])
-        case "🤾🏾‍♀️": return (.womanPlayingHandball, [.mediumDark])
-        case "🤾🏿‍♀️": return (.womanPlayingHandball, [.dark])
-        case "🤹🏻": return (.juggling, [.light])
-        case "🤹🏼": return (.juggling, [.mediumLight])
-        case "🤹🏽": return (.juggling, [.medium])
-        case "🤹🏾": return (.juggling, [.mediumDark])
-        case "🤹🏿": return (.juggling, [.dark])
-        case "🤹🏻‍♂️": return (.manJuggling, [.light])
-        case "🤹🏼‍♂️": return (.manJuggling, [.mediumLight])
-        case "🤹🏽‍♂️": return (.manJuggling, [.medium])
-        case "🤹🏾‍♂️": return (.manJuggling, [.mediumDark])
-        case "🤹🏿‍♂️": return (.manJuggling, [.dark])
-        case "🤹🏻‍♀️": return (.womanJuggling, [.light])
-        case "🤹🏼‍♀️": return (.womanJuggling, [.mediumLight])
-        case "🤹🏽‍♀️": return (.womanJuggling, [.medium])
-        case "🤹🏾‍♀️": return (.womanJuggling, [.mediumDark])
-        case "🤹🏿‍♀️": return (.womanJuggling, [.dark])
-        case "🧘🏻": return (.personInLotusPosition, [.light])
-        case "🧘🏼": return (.personInLotusPosition, [.mediumLight])
-        case "🧘🏽": return (.personInLotusPosition, [.medium])
-        case "🧘🏾": return (.personInLotusPosition, [.mediumDark])
-        case "🧘🏿": return (.personInLotusPosition, [.dark])
-        case "🧘🏻‍♂️": return (.manInLotusPosition, [.light])
-        case "🧘🏼‍♂️": return (.manInLotusPosition, [.mediumLight])
-        case "🧘🏽‍♂️": return (.manInLotusPosition, [.medium])
-        case "🧘🏾‍♂️": return (.manInLotusPosition, [.mediumDark])
-        case "🧘🏿‍♂️": return (.manInLotusPosition, [.dark])
-        case "🧘🏻‍♀️": return (.womanInLotusPosition, [.light])
-        case "🧘🏼‍♀️": return (.womanInLotusPosition, [.mediumLight])
-        case "🧘🏽‍♀️": return (.womanInLotusPosition, [.medium])
-        case "🧘🏾‍♀️": return (.womanInLotusPosition, [.mediumDark])
-        case "🧘🏿‍♀️": return (.womanInLotusPosition, [.dark])
-        case "🛀🏻": return (.bath, [.light])
-        case "🛀🏼": return (.bath, [.mediumLight])
-        case "🛀🏽": return (.bath, [.medium])
-        case "🛀🏾": return (.bath, [.mediumDark])
-        case "🛀🏿": return (.bath, [.dark])
-        case "🛌🏻": return (.sleepingAccommodation, [.light])
-        case "🛌🏼": return (.sleepingAccommodation, [.mediumLight])
-        case "🛌🏽": return (.sleepingAccommodation, [.medium])
-        case "🛌🏾": return (.sleepingAccommodation, [.mediumDark])
-        case "🛌🏿": return (.sleepingAccommodation, [.dark])
-        case "🧑🏻‍🤝‍🧑🏻": return (.peopleHoldingHands, [.light])
-        case "🧑🏻‍🤝‍🧑🏼": return (.peopleHoldingHands, [.light, .mediumLight])
-        case "🧑🏻‍🤝‍🧑🏽": return (.peopleHoldingHands, [.light, .medium])
-        case "🧑🏻‍🤝‍🧑🏾": return (.peopleHoldingHands, [.light, .mediumDark])
-        case "🧑🏻‍🤝‍🧑🏿": return (.peopleHoldingHands, [.light, .dark])
-        case "🧑🏼‍🤝‍🧑🏼": return (.peopleHoldingHands, [.mediumLight])
-        case "🧑🏼‍🤝‍🧑🏻": return (.peopleHoldingHands, [.mediumLight, .light])
-        case "🧑🏼‍🤝‍🧑🏽": return (.peopleHoldingHands, [.mediumLight, .medium])
-        case "🧑🏼‍🤝‍🧑🏾": return (.peopleHoldingHands, [.mediumLight, .mediumDark])
-        case "🧑🏼‍🤝‍🧑🏿": return (.peopleHoldingHands, [.mediumLight, .dark])
-        case "🧑🏽‍🤝‍🧑🏽": return (.peopleHoldingHands, [.medium])
-        case "🧑🏽‍🤝‍🧑🏻": return (.peopleHoldingHands, [.medium, .light])
-        case "🧑🏽‍🤝‍🧑🏼": return (.peopleHoldingHands, [.medium, .mediumLight])
-        case "🧑🏽‍🤝‍🧑🏾": return (.peopleHoldingHands, [.medium, .mediumDark])
-        case "🧑🏽‍🤝‍🧑🏿": return (.peopleHoldingHands, [.medium, .dark])
-        case "🧑🏾‍🤝‍🧑🏾": return (.peopleHoldingHands, [.mediumDark])
-        case "🧑🏾‍🤝‍🧑🏻": return (.peopleHoldingHands, [.mediumDark, .light])
-        case "🧑🏾‍🤝‍🧑🏼": return (.peopleHoldingHands, [.mediumDark, .mediumLight])
-        case "🧑🏾‍🤝‍🧑🏽": return (.peopleHoldingHands, [.mediumDark, .medium])
-        case "🧑🏾‍🤝‍🧑🏿": return (.peopleHoldingHands, [.mediumDark, .dark])
-        case "🧑🏿‍🤝‍🧑🏿": return (.peopleHoldingHands, [.dark])
-        case "🧑🏿‍🤝‍🧑🏻": return (.peopleHoldingHands, [.dark, .light])
-        case "🧑🏿‍🤝‍🧑🏼": return (.peopleHoldingHands, [.dark, .mediumLight])
-        case "🧑🏿‍🤝‍🧑🏽": return (.peopleHoldingHands, [.dark, .medium])
-        case "🧑🏿‍🤝‍🧑🏾": return (.peopleHoldingHands, [.dark, .mediumDark])
-        case "👭🏻": return (.twoWomenHoldingHands, [.light])
-        case "👩🏻‍🤝‍👩🏼": return (.twoWomenHoldingHands, [.light, .mediumLight])
-        case "👩🏻‍🤝‍👩🏽": return (.twoWomenHoldingHands, [.light, .medium])
-        case "👩🏻‍🤝‍👩🏾": return (.twoWomenHoldingHands, [.light, .mediumDark])
-        case "👩🏻‍🤝‍👩🏿": return (.twoWomenHoldingHands, [.light, .dark])
-        case "👭🏼": return (.twoWomenHoldingHands, [.mediumLight])
-        case "👩🏼‍🤝‍👩🏻": return (.twoWomenHoldingHands, [.mediumLight, .light])
-        case "👩🏼‍🤝‍👩🏽": return (.twoWomenHoldingHands, [.mediumLight, .medium])
-        case "👩🏼‍🤝‍👩🏾": return (.twoWomenHoldingHands, [.mediumLight, .mediumDark])
-        case "👩🏼‍🤝‍👩🏿": return (.twoWomenHoldingHands, [.mediumLight, .dark])
-        case "👭🏽": return (.twoWomenHoldingHands, [.medium])
-        case "👩🏽‍🤝‍👩🏻": return (.twoWomenHoldingHands, [.medium, .light])
-        case "👩🏽‍🤝‍👩🏼": return (.twoWomenHoldingHands, [.medium, .mediumLight])
-        case "👩🏽‍🤝‍👩🏾": return (.twoWomenHoldingHands, [.medium, .mediumDark])
-        case "👩🏽‍🤝‍👩🏿": return (.twoWomenHoldingHands, [.medium, .dark])
-        case "👭🏾": return (.twoWomenHoldingHands, [.mediumDark])
-        case "👩🏾‍🤝‍👩🏻": return (.twoWomenHoldingHands, [.mediumDark, .light])
-        case "👩🏾‍🤝‍👩🏼": return (.twoWomenHoldingHands, [.mediumDark, .mediumLight])
-        case "👩🏾‍🤝‍👩🏽": return (.twoWomenHoldingHands, [.mediumDark, .medium])
-        case "👩🏾‍🤝‍👩🏿": return (.twoWomenHoldingHands, [.mediumDark, .dark])
-        case "👭🏿": return (.twoWomenHoldingHands, [.dark])
-        case "👩🏿‍🤝‍👩🏻": return (.twoWomenHoldingHands, [.dark, .light])
-        case "👩🏿‍🤝‍👩🏼": return (.twoWomenHoldingHands, [.dark, .mediumLight])
-        case "👩🏿‍🤝‍👩🏽": return (.twoWomenHoldingHands, [.dark, .medium])
-        case "👩🏿‍🤝‍👩🏾": return (.twoWomenHoldingHands, [.dark, .mediumDark])
-        case "👫🏻": return (.manAndWomanHoldingHands, [.light])
-        case "👩🏻‍🤝‍👨🏼": return (.manAndWomanHoldingHands, [.light, .mediumLight])
-        case "👩🏻‍🤝‍👨🏽": return (.manAndWomanHoldingHands, [.light, .medium])
-        case "👩🏻‍🤝‍👨🏾": return (.manAndWomanHoldingHands, [.light, .mediumDark])
-        case "👩🏻‍🤝‍👨🏿": return (.manAndWomanHoldingHands, [.light, .dark])
-        case "👫🏼": return (.manAndWomanHoldingHands, [.mediumLight])
-        case "👩🏼‍🤝‍👨🏻": return (.manAndWomanHoldingHands, [.mediumLight, .light])
-        case "👩🏼‍🤝‍👨🏽": return (.manAndWomanHoldingHands, [.mediumLight, .medium])
-        case "👩🏼‍🤝‍👨🏾": return (.manAndWomanHoldingHands, [.mediumLight, .mediumDark])
-        case "👩🏼‍🤝‍👨🏿": return (.manAndWomanHoldingHands, [.mediumLight, .dark])
-        case "👫🏽": return (.manAndWomanHoldingHands, [.medium])
-        case "👩🏽‍🤝‍👨🏻": return (.manAndWomanHoldingHands, [.medium, .light])
-        case "👩🏽‍🤝‍👨🏼": return (.manAndWomanHoldingHands, [.medium, .mediumLight])
-        case "👩🏽‍🤝‍👨🏾": return (.manAndWomanHoldingHands, [.medium, .mediumDark])
-        case "👩🏽‍🤝‍👨🏿": return (.manAndWomanHoldingHands, [.medium, .dark])
-        case "👫🏾": return (.manAndWomanHoldingHands, [.mediumDark])
-        case "👩🏾‍🤝‍👨🏻": return (.manAndWomanHoldingHands, [.mediumDark, .light])
-        case "👩🏾‍🤝‍👨🏼": return (.manAndWomanHoldingHands, [.mediumDark, .mediumLight])
-        case "👩🏾‍🤝‍👨🏽": return (.manAndWomanHoldingHands, [.mediumDark, .medium])
-        case "👩🏾‍🤝‍👨🏿": return (.manAndWomanHoldingHands, [.mediumDark, .dark])
-        case "👫🏿": return (.manAndWomanHoldingHands, [.dark])
-        case "👩🏿‍🤝‍👨🏻": return (.manAndWomanHoldingHands, [.dark, .light])
-        case "👩🏿‍🤝‍👨🏼": return (.manAndWomanHoldingHands, [.dark, .mediumLight])
-        case "👩🏿‍🤝‍👨🏽": return (.manAndWomanHoldingHands, [.dark, .medium])
-        case "👩🏿‍🤝‍👨🏾": return (.manAndWomanHoldingHands, [.dark, .mediumDark])
-        case "👬🏻": return (.twoMenHoldingHands, [.light])
-        case "👨🏻‍🤝‍👨🏼": return (.twoMenHoldingHands, [.light, .mediumLight])
-        case "👨🏻‍🤝‍👨🏽": return (.twoMenHoldingHands, [.light, .medium])
-        case "👨🏻‍🤝‍👨🏾": return (.twoMenHoldingHands, [.light, .mediumDark])
-        case "👨🏻‍🤝‍👨🏿": return (.twoMenHoldingHands, [.light, .dark])
-        case "👬🏼": return (.twoMenHoldingHands, [.mediumLight])
-        case "👨🏼‍🤝‍👨🏻": return (.twoMenHoldingHands, [.mediumLight, .light])
-        case "👨🏼‍🤝‍👨🏽": return (.twoMenHoldingHands, [.mediumLight, .medium])
-        case "👨🏼‍🤝‍👨🏾": return (.twoMenHoldingHands, [.mediumLight, .mediumDark])
-        case "👨🏼‍🤝‍👨🏿": return (.twoMenHoldingHands, [.mediumLight, .dark])
-        case "👬🏽": return (.twoMenHoldingHands, [.medium])
-        case "👨🏽‍🤝‍👨🏻": return (.twoMenHoldingHands, [.medium, .light])
-        case "👨🏽‍🤝‍👨🏼": return (.twoMenHoldingHands, [.medium, .mediumLight])
-        case "👨🏽‍🤝‍👨🏾": return (.twoMenHoldingHands, [.medium, .mediumDark])
-        case "👨🏽‍🤝‍👨🏿": return (.twoMenHoldingHands, [.medium, .dark])
-        case "👬🏾": return (.twoMenHoldingHands, [.mediumDark])
-        case "👨🏾‍🤝‍👨🏻": return (.twoMenHoldingHands, [.mediumDark, .light])
-        case "👨🏾‍🤝‍👨🏼": return (.twoMenHoldingHands, [.mediumDark, .mediumLight])
-        case "👨🏾‍🤝‍👨🏽": return (.twoMenHoldingHands, [.mediumDark, .medium])
-        case "👨🏾‍🤝‍👨🏿": return (.twoMenHoldingHands, [.mediumDark, .dark])
-        case "👬🏿": return (.twoMenHoldingHands, [.dark])
-        case "👨🏿‍🤝‍👨🏻": return (.twoMenHoldingHands, [.dark, .light])
-        case "👨🏿‍🤝‍👨🏼": return (.twoMenHoldingHands, [.dark, .mediumLight])
-        case "👨🏿‍🤝‍👨🏽": return (.twoMenHoldingHands, [.dark, .medium])
-        case "👨🏿‍🤝‍👨🏾": return (.twoMenHoldingHands, [.dark, .mediumDark])
-        case "💏🏻": return (.personKissPerson, [.light])
-        case "🧑🏻‍❤️‍💋‍🧑🏼": return (.personKissPerson, [.light, .mediumLight])
-        case "🧑🏻‍❤️‍💋‍🧑🏽": return (.personKissPerson, [.light, .medium])
-        case "🧑🏻‍❤️‍💋‍🧑🏾": return (.personKissPerson, [.light, .mediumDark])
-        case "🧑🏻‍❤️‍💋‍🧑🏿": return (.personKissPerson, [.light, .dark])
-        case "💏🏼": return (.personKissPerson, [.mediumLight])
-        case "🧑🏼‍❤️‍💋‍🧑🏻": return (.personKissPerson, [.mediumLight, .light])
-        case "🧑🏼‍❤️‍💋‍🧑🏽": return (.personKissPerson, [.mediumLight, .medium])
-        case "🧑🏼‍❤️‍💋‍🧑🏾": return (.personKissPerson, [.mediumLight, .mediumDark])
-        case "🧑🏼‍❤️‍💋‍🧑🏿": return (.personKissPerson, [.mediumLight, .dark])
-        case "💏🏽": return (.personKissPerson, [.medium])
-        case "🧑🏽‍❤️‍💋‍🧑🏻": return (.personKissPerson, [.medium, .light])
-        case "🧑🏽‍❤️‍💋‍🧑🏼": return (.personKissPerson, [.medium, .mediumLight])
-        case "🧑🏽‍❤️‍💋‍🧑🏾": return (.personKissPerson, [.medium, .mediumDark])
-        case "🧑🏽‍❤️‍💋‍🧑🏿": return (.personKissPerson, [.medium, .dark])
-        case "💏🏾": return (.personKissPerson, [.mediumDark])
-        case "🧑🏾‍❤️‍💋‍🧑🏻": return (.personKissPerson, [.mediumDark, .light])
-        case "🧑🏾‍❤️‍💋‍🧑🏼": return (.personKissPerson, [.mediumDark, .mediumLight])
-        case "🧑🏾‍❤️‍💋‍🧑🏽": return (.personKissPerson, [.mediumDark, .medium])
-        case "🧑🏾‍❤️‍💋‍🧑🏿": return (.personKissPerson, [.mediumDark, .dark])
-        case "💏🏿": return (.personKissPerson, [.dark])
-        case "🧑🏿‍❤️‍💋‍🧑🏻": return (.personKissPerson, [.dark, .light])
-        case "🧑🏿‍❤️‍💋‍🧑🏼": return (.personKissPerson, [.dark, .mediumLight])
-        case "🧑🏿‍❤️‍💋‍🧑🏽": return (.personKissPerson, [.dark, .medium])
-        case "🧑🏿‍❤️‍💋‍🧑🏾": return (.personKissPerson, [.dark, .mediumDark])
-        case "👩🏻‍❤️‍💋‍👨🏻": return (.womanKissMan, [.light])
-        case "👩🏻‍❤️‍💋‍👨🏼": return (.womanKissMan, [.light, .mediumLight])
-        case "👩🏻‍❤️‍💋‍👨🏽": return (.womanKissMan, [.light, .medium])
-        case "👩🏻‍❤️‍💋‍👨🏾": return (.womanKissMan, [.light, .mediumDark])
-        case "👩🏻‍❤️‍💋‍👨🏿": return (.womanKissMan, [.light, .dark])
-        case "👩🏼‍❤️‍💋‍👨🏼": return (.womanKissMan, [.mediumLight])
-        case "👩🏼‍❤️‍💋‍👨🏻": return (.womanKissMan, [.mediumLight, .light])
-        case "👩🏼‍❤️‍💋‍👨🏽": return (.womanKissMan, [.mediumLight, .medium])
-        case "👩🏼‍❤️‍💋‍👨🏾": return (.womanKissMan, [.mediumLight, .mediumDark])
-        case "👩🏼‍❤️‍💋‍👨🏿": return (.womanKissMan, [.mediumLight, .dark])
-        case "👩🏽‍❤️‍💋‍👨🏽": return (.womanKissMan, [.medium])
-        case "👩🏽‍❤️‍💋‍👨🏻": return (.womanKissMan, [.medium, .light])
-        case "👩🏽‍❤️‍💋‍👨🏼": return (.womanKissMan, [.medium, .mediumLight])
-        case "👩🏽‍❤️‍💋‍👨🏾": return (.womanKissMan, [.medium, .mediumDark])
-        case "👩🏽‍❤️‍💋‍👨🏿": return (.womanKissMan, [.medium, .dark])
-        case "👩🏾‍❤️‍💋‍👨🏾": return (.womanKissMan, [.mediumDark])
-        case "👩🏾‍❤️‍💋‍👨🏻": return (.womanKissMan, [.mediumDark, .light])
-        case "👩🏾‍❤️‍💋‍👨🏼": return (.womanKissMan, [.mediumDark, .mediumLight])
-        case "👩🏾‍❤️‍💋‍👨🏽": return (.womanKissMan, [.mediumDark, .medium])
-        case "👩🏾‍❤️‍💋‍👨🏿": return (.womanKissMan, [.mediumDark, .dark])
-        case "👩🏿‍❤️‍💋‍👨🏿": return (.womanKissMan, [.dark])
-        case "👩🏿‍❤️‍💋‍👨🏻": return (.womanKissMan, [.dark, .light])
-        case "👩🏿‍❤️‍💋‍👨🏼": return (.womanKissMan, [.dark, .mediumLight])
-        case "👩🏿‍❤️‍💋‍👨🏽": return (.womanKissMan, [.dark, .medium])
-        case "👩🏿‍❤️‍💋‍👨🏾": return (.womanKissMan, [.dark, .mediumDark])
-        case "👨🏻‍❤️‍💋‍👨🏻": return (.manKissMan, [.light])
-        case "👨🏻‍❤️‍💋‍👨🏼": return (.manKissMan, [.light, .mediumLight])
-        case "👨🏻‍❤️‍💋‍👨🏽": return (.manKissMan, [.light, .medium])
-        case "👨🏻‍❤️‍💋‍👨🏾": return (.manKissMan, [.light, .mediumDark])
-        case "👨🏻‍❤️‍💋‍👨🏿": return (.manKissMan, [.light, .dark])
-        case "👨🏼‍❤️‍💋‍👨🏼": return (.manKissMan, [.mediumLight])
-        case "👨🏼‍❤️‍💋‍👨🏻": return (.manKissMan, [.mediumLight, .light])
-        case "👨🏼‍❤️‍💋‍👨🏽": return (.manKissMan, [.mediumLight, .medium])
-        case "👨🏼‍❤️‍💋‍👨🏾": return (.manKissMan, [.mediumLight, .mediumDark])
-        case "👨🏼‍❤️‍💋‍👨🏿": return (.manKissMan, [.mediumLight, .dark])
-        case "👨🏽‍❤️‍💋‍👨🏽": return (.manKissMan, [.medium])
-        case "👨🏽‍❤️‍💋‍👨🏻": return (.manKissMan, [.medium, .light])
-        case "👨🏽‍❤️‍💋‍👨🏼": return (.manKissMan, [.medium, .mediumLight])
-        case "👨🏽‍❤️‍💋‍👨🏾": return (.manKissMan, [.medium, .mediumDark])
-        case "👨🏽‍❤️‍💋‍👨🏿": return (.manKissMan, [.medium, .dark])
-        case "👨🏾‍❤️‍💋‍👨🏾": return (.manKissMan, [.mediumDark])
-        case "👨🏾‍❤️‍💋‍👨🏻": return (.manKissMan, [.mediumDark, .light])
-        case "👨🏾‍❤️‍💋‍👨🏼": return (.manKissMan, [.mediumDark, .mediumLight])
-        case "👨🏾‍❤️‍💋‍👨🏽": return (.manKissMan, [.mediumDark, .medium])
-        case "👨🏾‍❤️‍💋‍👨🏿": return (.manKissMan, [.mediumDark, .dark])
-        case "👨🏿‍❤️‍💋‍👨🏿": return (.manKissMan, [.dark])
-        case "👨🏿‍❤️‍💋‍👨🏻": return (.manKissMan, [.dark, .light])
-        case "👨🏿‍❤️‍💋‍👨🏼": return (.manKissMan, [.dark, .mediumLight])
-        case "👨🏿‍❤️‍💋‍👨🏽": return (.manKissMan, [.dark, .medium])
-        case "👨🏿‍❤️‍💋‍👨🏾": return (.manKissMan, [.dark, .mediumDark])
-        case "👩🏻‍❤️‍💋‍👩🏻": return (.womanKissWoman, [.light])
-        case "👩🏻‍❤️‍💋‍👩🏼": return (.womanKissWoman, [.light, .mediumLight])
-        case "👩🏻‍❤️‍💋‍👩🏽": return (.womanKissWoman, [.light, .medium])
-        case "👩🏻‍❤️‍💋‍👩🏾": return (.womanKissWoman, [.light, .mediumDark])
-        case "👩🏻‍❤️‍💋‍👩🏿": return (.womanKissWoman, [.light, .dark])
-        case "👩🏼‍❤️‍💋‍👩🏼": return (.womanKissWoman, [.mediumLight])
-        case "👩🏼‍❤️‍💋‍👩🏻": return (.womanKissWoman, [.mediumLight, .light])
-        case "👩🏼‍❤️‍💋‍👩🏽": return (.womanKissWoman, [.mediumLight, .medium])
-        case "👩🏼‍❤️‍💋‍👩🏾": return (.womanKissWoman, [.mediumLight, .mediumDark])
-        case "👩🏼‍❤️‍💋‍👩🏿": return (.womanKissWoman, [.mediumLight, .dark])
-        case "👩🏽‍❤️‍💋‍👩🏽": return (.womanKissWoman, [.medium])
-        case "👩🏽‍❤️‍💋‍👩🏻": return (.womanKissWoman, [.medium, .light])
-        case "👩🏽‍❤️‍💋‍👩🏼": return (.womanKissWoman, [.medium, .mediumLight])
-        case "👩🏽‍❤️‍💋‍👩🏾": return (.womanKissWoman, [.medium, .mediumDark])
-        case "👩🏽‍❤️‍💋‍👩🏿": return (.womanKissWoman, [.medium, .dark])
-        case "👩🏾‍❤️‍💋‍👩🏾": return (.womanKissWoman, [.mediumDark])
-        case "👩🏾‍❤️‍💋‍👩🏻": return (.womanKissWoman, [.mediumDark, .light])
-        case "👩🏾‍❤️‍💋‍👩🏼": return (.womanKissWoman, [.mediumDark, .mediumLight])
-        case "👩🏾‍❤️‍💋‍👩🏽": return (.womanKissWoman, [.mediumDark, .medium])
-        case "👩🏾‍❤️‍💋‍👩🏿": return (.womanKissWoman, [.mediumDark, .dark])
-        case "👩🏿‍❤️‍💋‍👩🏿": return (.womanKissWoman, [.dark])
-        case "👩🏿‍❤️‍💋‍👩🏻": return (.womanKissWoman, [.dark, .light])
-        case "👩🏿‍❤️‍💋‍👩🏼": return (.womanKissWoman, [.dark, .mediumLight])
-        case "👩🏿‍❤️‍💋‍👩🏽": return (.womanKissWoman, [.dark, .medium])
-        case "👩🏿‍❤️‍💋‍👩🏾": return (.womanKissWoman, [.dark, .mediumDark])
-        case "💑🏻": return (.personHeartPerson, [.light])
-        case "🧑🏻‍❤️‍🧑🏼": return (.personHeartPerson, [.light, .mediumLight])
-        case "🧑🏻‍❤️‍🧑🏽": return (.personHeartPerson, [.light, .medium])
-        case "🧑🏻‍❤️‍🧑🏾": return (.personHeartPerson, [.light, .mediumDark])
-        case "🧑🏻‍❤️‍🧑🏿": return (.personHeartPerson, [.light, .dark])
-        case "💑🏼": return (.personHeartPerson, [.mediumLight])
-        case "🧑🏼‍❤️‍🧑🏻": return (.personHeartPerson, [.mediumLight, .light])
-        case "🧑🏼‍❤️‍🧑🏽": return (.personHeartPerson, [.mediumLight, .medium])
-        case "🧑🏼‍❤️‍🧑🏾": return (.personHeartPerson, [.mediumLight, .mediumDark])
-        case "🧑🏼‍❤️‍🧑🏿": return (.personHeartPerson, [.mediumLight, .dark])
-        case "💑🏽": return (.personHeartPerson, [.medium])
-        case "🧑🏽‍❤️‍🧑🏻": return (.personHeartPerson, [.medium, .light])
-        case "🧑🏽‍❤️‍🧑🏼": return (.personHeartPerson, [.medium, .mediumLight])
-        case "🧑🏽‍❤️‍🧑🏾": return (.personHeartPerson, [.medium, .mediumDark])
-        case "🧑🏽‍❤️‍🧑🏿": return (.personHeartPerson, [.medium, .dark])
-        case "💑🏾": return (.personHeartPerson, [.mediumDark])
-        case "🧑🏾‍❤️‍🧑🏻": return (.personHeartPerson, [.mediumDark, .light])
-        case "🧑🏾‍❤️‍🧑🏼": return (.personHeartPerson, [.mediumDark, .mediumLight])
-        case "🧑🏾‍❤️‍🧑🏽": return (.personHeartPerson, [.mediumDark, .medium])
-        case "🧑🏾‍❤️‍🧑🏿": return (.personHeartPerson, [.mediumDark, .dark])
-        case "💑🏿": return (.personHeartPerson, [.dark])
-        case "🧑🏿‍❤️‍🧑🏻": return (.personHeartPerson, [.dark, .light])
-        case "🧑🏿‍❤️‍🧑🏼": return (.personHeartPerson, [.dark, .mediumLight])
-        case "🧑🏿‍❤️‍🧑🏽": return (.personHeartPerson, [.dark, .medium])
-        case "🧑🏿‍❤️‍🧑🏾": return (.personHeartPerson, [.dark, .mediumDark])
-        case "👩🏻‍❤️‍👨🏻": return (.womanHeartMan, [.light])
-        case "👩🏻‍❤️‍👨🏼": return (.womanHeartMan, [.light, .mediumLight])
-        case "👩🏻‍❤️‍👨🏽": return (.womanHeartMan, [.light, .medium])
-        case "👩🏻‍❤️‍👨🏾": return (.womanHeartMan, [.light, .mediumDark])
-        case "👩🏻‍❤️‍👨🏿": return (.womanHeartMan, [.light, .dark])
-        case "👩🏼‍❤️‍👨🏼": return (.womanHeartMan, [.mediumLight])
-        case "👩🏼‍❤️‍👨🏻": return (.womanHeartMan, [.mediumLight, .light])
-        case "👩🏼‍❤️‍👨🏽": return (.womanHeartMan, [.mediumLight, .medium])
-        case "👩🏼‍❤️‍👨🏾": return (.womanHeartMan, [.mediumLight, .mediumDark])
-        case "👩🏼‍❤️‍👨🏿": return (.womanHeartMan, [.mediumLight, .dark])
-        case "👩🏽‍❤️‍👨🏽": return (.womanHeartMan, [.medium])
-        case "👩🏽‍❤️‍👨🏻": return (.womanHeartMan, [.medium, .light])
-        case "👩🏽‍❤️‍👨🏼": return (.womanHeartMan, [.medium, .mediumLight])
-        case "👩🏽‍❤️‍👨🏾": return (.womanHeartMan, [.medium, .mediumDark])
-        case "👩🏽‍❤️‍👨🏿": return (.womanHeartMan, [.medium, .dark])
-        case "👩🏾‍❤️‍👨🏾": return (.womanHeartMan, [.mediumDark])
-        case "👩🏾‍❤️‍👨🏻": return (.womanHeartMan, [.mediumDark, .light])
-        case "👩🏾‍❤️‍👨🏼": return (.womanHeartMan, [.mediumDark, .mediumLight])
-        case "👩🏾‍❤️‍👨🏽": return (.womanHeartMan, [.mediumDark, .medium])
-        case "👩🏾‍❤️‍👨🏿": return (.womanHeartMan, [.mediumDark, .dark])
-        case "👩🏿‍❤️‍👨🏿": return (.womanHeartMan, [.dark])
-        case "👩🏿‍❤️‍👨🏻": return (.womanHeartMan, [.dark, .light])
-        case "👩🏿‍❤️‍👨🏼": return (.womanHeartMan, [.dark, .mediumLight])
-        case "👩🏿‍❤️‍👨🏽": return (.womanHeartMan, [.dark, .medium])
-        case "👩🏿‍❤️‍👨🏾": return (.womanHeartMan, [.dark, .mediumDark])
-        case "👨🏻‍❤️‍👨🏻": return (.manHeartMan, [.light])
-        case "👨🏻‍❤️‍👨🏼": return (.manHeartMan, [.light, .mediumLight])
-        case "👨🏻‍❤️‍👨🏽": return (.manHeartMan, [.light, .medium])
-        case "👨🏻‍❤️‍👨🏾": return (.manHeartMan, [.light, .mediumDark])
-        case "👨🏻‍❤️‍👨🏿": return (.manHeartMan, [.light, .dark])
-        case "👨🏼‍❤️‍👨🏼": return (.manHeartMan, [.mediumLight])
-        case "👨🏼‍❤️‍👨🏻": return (.manHeartMan, [.mediumLight, .light])
-        case "👨🏼‍❤️‍👨🏽": return (.manHeartMan, [.mediumLight, .medium])
-        case "👨🏼‍❤️‍👨🏾": return (.manHeartMan, [.mediumLight, .mediumDark])
-        case "👨🏼‍❤️‍👨🏿": return (.manHeartMan, [.mediumLight, .dark])
-        case "👨🏽‍❤️‍👨🏽": return (.manHeartMan, [.medium])
-        case "👨🏽‍❤️‍👨🏻": return (.manHeartMan, [.medium, .light])
-        case "👨🏽‍❤️‍👨🏼": return (.manHeartMan, [.medium, .mediumLight])
-        case "👨🏽‍❤️‍👨🏾": return (.manHeartMan, [.medium, .mediumDark])
-        case "👨🏽‍❤️‍👨🏿": return (.manHeartMan, [.medium, .dark])
-        case "👨🏾‍❤️‍👨🏾": return (.manHeartMan, [.mediumDark])
-        case "👨🏾‍❤️‍👨🏻": return (.manHeartMan, [.mediumDark, .light])
-        case "👨🏾‍❤️‍👨🏼": return (.manHeartMan, [.mediumDark, .mediumLight])
-        case "👨🏾‍❤️‍👨🏽": return (.manHeartMan, [.mediumDark, .medium])
-        case "👨🏾‍❤️‍👨🏿": return (.manHeartMan, [.mediumDark, .dark])
-        case "👨🏿‍❤️‍👨🏿": return (.manHeartMan, [.dark])
-        case "👨🏿‍❤️‍👨🏻": return (.manHeartMan, [.dark, .light])
-        case "👨🏿‍❤️‍👨🏼": return (.manHeartMan, [.dark, .mediumLight])
-        case "👨🏿‍❤️‍👨🏽": return (.manHeartMan, [.dark, .medium])
-        case "👨🏿‍❤️‍👨🏾": return (.manHeartMan, [.dark, .mediumDark])
-        case "👩🏻‍❤️‍👩🏻": return (.womanHeartWoman, [.light])
-        case "👩🏻‍❤️‍👩🏼": return (.womanHeartWoman, [.light, .mediumLight])
-        case "👩🏻‍❤️‍👩🏽": return (.womanHeartWoman, [.light, .medium])
-        case "👩🏻‍❤️‍👩🏾": return (.womanHeartWoman, [.light, .mediumDark])
-        case "👩🏻‍❤️‍👩🏿": return (.womanHeartWoman, [.light, .dark])
-        case "👩🏼‍❤️‍👩🏼": return (.womanHeartWoman, [.mediumLight])
-        case "👩🏼‍❤️‍👩🏻": return (.womanHeartWoman, [.mediumLight, .light])
-        case "👩🏼‍❤️‍👩🏽": return (.womanHeartWoman, [.mediumLight, .medium])
-        case "👩🏼‍❤️‍👩🏾": return (.womanHeartWoman, [.mediumLight, .mediumDark])
-        case "👩🏼‍❤️‍👩🏿": return (.womanHeartWoman, [.mediumLight, .dark])
-        case "👩🏽‍❤️‍👩🏽": return (.womanHeartWoman, [.medium])
-        case "👩🏽‍❤️‍👩🏻": return (.womanHeartWoman, [.medium, .light])
-        case "👩🏽‍❤️‍👩🏼": return (.womanHeartWoman, [.medium, .mediumLight])
-        case "👩🏽‍❤️‍👩🏾": return (.womanHeartWoman, [.medium, .mediumDark])
-        case "👩🏽‍❤️‍👩🏿": return (.womanHeartWoman, [.medium, .dark])
-        case "👩🏾‍❤️‍👩🏾": return (.womanHeartWoman, [.mediumDark])
-        case "👩🏾‍❤️‍👩🏻": return (.womanHeartWoman, [.mediumDark, .light])
-        case "👩🏾‍❤️‍👩🏼": return (.womanHeartWoman, [.mediumDark, .mediumLight])
-        case "👩🏾‍❤️‍👩🏽": return (.womanHeartWoman, [.mediumDark, .medium])
-        case "👩🏾‍❤️‍👩🏿": return (.womanHeartWoman, [.mediumDark, .dark])
-        case "👩🏿‍❤️‍👩🏿": return (.womanHeartWoman, [.dark])
-        case "👩🏿‍❤️‍👩🏻": return (.womanHeartWoman, [.dark, .light])
-        case "👩🏿‍❤️‍👩🏼": return (.womanHeartWoman, [.dark, .mediumLight])
-        case "👩🏿‍❤️‍👩🏽": return (.womanHeartWoman, [.dark, .medium])
-        case "👩🏿‍❤️‍👩🏾": return (.womanHeartWoman, [.dark, .mediumDark])
-        default: return nil
-        }
+        return skinToneComponentsByEmoji[emoji]
     }
+
+    private static let skinToneComponentsByEmoji: [String: (Emoji, [Emoji.SkinTone])] = [
+        "👋🏻": (.wave, [.light]),
+        "👋🏼": (.wave, [.mediumLight]),
+        "👋🏽": (.wave, [.medium]),
+        "👋🏾": (.wave, [.mediumDark]),
+        "👋🏿": (.wave, [.dark]),
+        "🤚🏻": (.raisedBackOfHand, [.light]),
+        "🤚🏼": (.raisedBackOfHand, [.mediumLight]),
+        "🤚🏽": (.raisedBackOfHand, [.medium]),
+        "🤚🏾": (.raisedBackOfHand, [.mediumDark]),
+        "🤚🏿": (.raisedBackOfHand, [.dark]),
+        "🖐🏻": (.raisedHandWithFingersSplayed, [.light]),
+        "🖐🏼": (.raisedHandWithFingersSplayed, [.mediumLight]),
+        "🖐🏽": (.raisedHandWithFingersSplayed, [.medium]),
+        "🖐🏾": (.raisedHandWithFingersSplayed, [.mediumDark]),
+        "🖐🏿": (.raisedHandWithFingersSplayed, [.dark]),
+        "✋🏻": (.hand, [.light]),
+        "✋🏼": (.hand, [.mediumLight]),
+        "✋🏽": (.hand, [.medium]),
+        "✋🏾": (.hand, [.mediumDark]),
+        "✋🏿": (.hand, [.dark]),
+        "🖖🏻": (.spockHand, [.light]),
+        "🖖🏼": (.spockHand, [.mediumLight]),
+        "🖖🏽": (.spockHand, [.medium]),
+        "🖖🏾": (.spockHand, [.mediumDark]),
+        "🖖🏿": (.spockHand, [.dark]),
+        "🫱🏻": (.rightwardsHand, [.light]),
+        "🫱🏼": (.rightwardsHand, [.mediumLight]),
+        "🫱🏽": (.rightwardsHand, [.medium]),
+        "🫱🏾": (.rightwardsHand, [.mediumDark]),
+        "🫱🏿": (.rightwardsHand, [.dark]),
+        "🫲🏻": (.leftwardsHand, [.light]),
+        "🫲🏼": (.leftwardsHand, [.mediumLight]),
+        "🫲🏽": (.leftwardsHand, [.medium]),
+        "🫲🏾": (.leftwardsHand, [.mediumDark]),
+        "🫲🏿": (.leftwardsHand, [.dark]),
+        "🫳🏻": (.palmDownHand, [.light]),
+        "🫳🏼": (.palmDownHand, [.mediumLight]),
+        "🫳🏽": (.palmDownHand, [.medium]),
+        "🫳🏾": (.palmDownHand, [.mediumDark]),
+        "🫳🏿": (.palmDownHand, [.dark]),
+        "🫴🏻": (.palmUpHand, [.light]),
+        "🫴🏼": (.palmUpHand, [.mediumLight]),
+        "🫴🏽": (.palmUpHand, [.medium]),
+        "🫴🏾": (.palmUpHand, [.mediumDark]),
+        "🫴🏿": (.palmUpHand, [.dark]),
+        "🫷🏻": (.leftwardsPushingHand, [.light]),
+        "🫷🏼": (.leftwardsPushingHand, [.mediumLight]),
+        "🫷🏽": (.leftwardsPushingHand, [.medium]),
+        "🫷🏾": (.leftwardsPushingHand, [.mediumDark]),
+        "🫷🏿": (.leftwardsPushingHand, [.dark]),
+        "🫸🏻": (.rightwardsPushingHand, [.light]),
+        "🫸🏼": (.rightwardsPushingHand, [.mediumLight]),
+        "🫸🏽": (.rightwardsPushingHand, [.medium]),
+        "🫸🏾": (.rightwardsPushingHand, [.mediumDark]),
+        "🫸🏿": (.rightwardsPushingHand, [.dark]),
+        "👌🏻": (.okHand, [.light]),
+        "👌🏼": (.okHand, [.mediumLight]),
+        "👌🏽": (.okHand, [.medium]),
+        "👌🏾": (.okHand, [.mediumDark]),
+        "👌🏿": (.okHand, [.dark]),
+        "🤌🏻": (.pinchedFingers, [.light]),
+        "🤌🏼": (.pinchedFingers, [.mediumLight]),
+        "🤌🏽": (.pinchedFingers, [.medium]),
+        "🤌🏾": (.pinchedFingers, [.mediumDark]),
+        "🤌🏿": (.pinchedFingers, [.dark]),
+        "🤏🏻": (.pinchingHand, [.light]),
+        "🤏🏼": (.pinchingHand, [.mediumLight]),
+        "🤏🏽": (.pinchingHand, [.medium]),
+        "🤏🏾": (.pinchingHand, [.mediumDark]),
+        "🤏🏿": (.pinchingHand, [.dark]),
+        "✌🏻": (.v, [.light]),
+        "✌🏼": (.v, [.mediumLight]),
+        "✌🏽": (.v, [.medium]),
+        "✌🏾": (.v, [.mediumDark]),
+        "✌🏿": (.v, [.dark]),
+        "🤞🏻": (.crossedFingers, [.light]),
+        "🤞🏼": (.crossedFingers, [.mediumLight]),
+        "🤞🏽": (.crossedFingers, [.medium]),
+        "🤞🏾": (.crossedFingers, [.mediumDark]),
+        "🤞🏿": (.crossedFingers, [.dark]),
+        "🫰🏻": (.handWithIndexFingerAndThumbCrossed, [.light]),
+        "🫰🏼": (.handWithIndexFingerAndThumbCrossed, [.mediumLight]),
+        "🫰🏽": (.handWithIndexFingerAndThumbCrossed, [.medium]),
+        "🫰🏾": (.handWithIndexFingerAndThumbCrossed, [.mediumDark]),
+        "🫰🏿": (.handWithIndexFingerAndThumbCrossed, [.dark]),
+        "🤟🏻": (.iLoveYouHandSign, [.light]),
+        "🤟🏼": (.iLoveYouHandSign, [.mediumLight]),
+        "🤟🏽": (.iLoveYouHandSign, [.medium]),
+        "🤟🏾": (.iLoveYouHandSign, [.mediumDark]),
+        "🤟🏿": (.iLoveYouHandSign, [.dark]),
+        "🤘🏻": (.theHorns, [.light]),
+        "🤘🏼": (.theHorns, [.mediumLight]),
+        "🤘🏽": (.theHorns, [.medium]),
+        "🤘🏾": (.theHorns, [.mediumDark]),
+        "🤘🏿": (.theHorns, [.dark]),
+        "🤙🏻": (.callMeHand, [.light]),
+        "🤙🏼": (.callMeHand, [.mediumLight]),
+        "🤙🏽": (.callMeHand, [.medium]),
+        "🤙🏾": (.callMeHand, [.mediumDark]),
+        "🤙🏿": (.callMeHand, [.dark]),
+        "👈🏻": (.pointLeft, [.light]),
+        "👈🏼": (.pointLeft, [.mediumLight]),
+        "👈🏽": (.pointLeft, [.medium]),
+        "👈🏾": (.pointLeft, [.mediumDark]),
+        "👈🏿": (.pointLeft, [.dark]),
+        "👉🏻": (.pointRight, [.light]),
+        "👉🏼": (.pointRight, [.mediumLight]),
+        "👉🏽": (.pointRight, [.medium]),
+        "👉🏾": (.pointRight, [.mediumDark]),
+        "👉🏿": (.pointRight, [.dark]),
+        "👆🏻": (.pointUp2, [.light]),
+        "👆🏼": (.pointUp2, [.mediumLight]),
+        "👆🏽": (.pointUp2, [.medium]),
+        "👆🏾": (.pointUp2, [.mediumDark]),
+        "👆🏿": (.pointUp2, [.dark]),
+        "🖕🏻": (.middleFinger, [.light]),
+        "🖕🏼": (.middleFinger, [.mediumLight]),
+        "🖕🏽": (.middleFinger, [.medium]),
+        "🖕🏾": (.middleFinger, [.mediumDark]),
+        "🖕🏿": (.middleFinger, [.dark]),
+        "👇🏻": (.pointDown, [.light]),
+        "👇🏼": (.pointDown, [.mediumLight]),
+        "👇🏽": (.pointDown, [.medium]),
+        "👇🏾": (.pointDown, [.mediumDark]),
+        "👇🏿": (.pointDown, [.dark]),
+        "☝🏻": (.pointUp, [.light]),
+        "☝🏼": (.pointUp, [.mediumLight]),
+        "☝🏽": (.pointUp, [.medium]),
+        "☝🏾": (.pointUp, [.mediumDark]),
+        "☝🏿": (.pointUp, [.dark]),
+        "🫵🏻": (.indexPointingAtTheViewer, [.light]),
+        "🫵🏼": (.indexPointingAtTheViewer, [.mediumLight]),
+        "🫵🏽": (.indexPointingAtTheViewer, [.medium]),
+        "🫵🏾": (.indexPointingAtTheViewer, [.mediumDark]),
+        "🫵🏿": (.indexPointingAtTheViewer, [.dark]),
+        "👍🏻": (.plusOne, [.light]),
+        "👍🏼": (.plusOne, [.mediumLight]),
+        "👍🏽": (.plusOne, [.medium]),
+        "👍🏾": (.plusOne, [.mediumDark]),
+        "👍🏿": (.plusOne, [.dark]),
+        "👎🏻": (.negativeOne, [.light]),
+        "👎🏼": (.negativeOne, [.mediumLight]),
+        "👎🏽": (.negativeOne, [.medium]),
+        "👎🏾": (.negativeOne, [.mediumDark]),
+        "👎🏿": (.negativeOne, [.dark]),
+        "✊🏻": (.fist, [.light]),
+        "✊🏼": (.fist, [.mediumLight]),
+        "✊🏽": (.fist, [.medium]),
+        "✊🏾": (.fist, [.mediumDark]),
+        "✊🏿": (.fist, [.dark]),
+        "👊🏻": (.facepunch, [.light]),
+        "👊🏼": (.facepunch, [.mediumLight]),
+        "👊🏽": (.facepunch, [.medium]),
+        "👊🏾": (.facepunch, [.mediumDark]),
+        "👊🏿": (.facepunch, [.dark]),
+        "🤛🏻": (.leftFacingFist, [.light]),
+        "🤛🏼": (.leftFacingFist, [.mediumLight]),
+        "🤛🏽": (.leftFacingFist, [.medium]),
+        "🤛🏾": (.leftFacingFist, [.mediumDark]),
+        "🤛🏿": (.leftFacingFist, [.dark]),
+        "🤜🏻": (.rightFacingFist, [.light]),
+        "🤜🏼": (.rightFacingFist, [.mediumLight]),
+        "🤜🏽": (.rightFacingFist, [.medium]),
+        "🤜🏾": (.rightFacingFist, [.mediumDark]),
+        "🤜🏿": (.rightFacingFist, [.dark]),
+        "👏🏻": (.clap, [.light]),
+        "👏🏼": (.clap, [.mediumLight]),
+        "👏🏽": (.clap, [.medium]),
+        "👏🏾": (.clap, [.mediumDark]),
+        "👏🏿": (.clap, [.dark]),
+        "🙌🏻": (.raisedHands, [.light]),
+        "🙌🏼": (.raisedHands, [.mediumLight]),
+        "🙌🏽": (.raisedHands, [.medium]),
+        "🙌🏾": (.raisedHands, [.mediumDark]),
+        "🙌🏿": (.raisedHands, [.dark]),
+        "🫶🏻": (.heartHands, [.light]),
+        "🫶🏼": (.heartHands, [.mediumLight]),
+        "🫶🏽": (.heartHands, [.medium]),
+        "🫶🏾": (.heartHands, [.mediumDark]),
+        "🫶🏿": (.heartHands, [.dark]),
+        "👐🏻": (.openHands, [.light]),
+        "👐🏼": (.openHands, [.mediumLight]),
+        "👐🏽": (.openHands, [.medium]),
+        "👐🏾": (.openHands, [.mediumDark]),
+        "👐🏿": (.openHands, [.dark]),
+        "🤲🏻": (.palmsUpTogether, [.light]),
+        "🤲🏼": (.palmsUpTogether, [.mediumLight]),
+        "🤲🏽": (.palmsUpTogether, [.medium]),
+        "🤲🏾": (.palmsUpTogether, [.mediumDark]),
+        "🤲🏿": (.palmsUpTogether, [.dark]),
+        "🤝🏻": (.handshake, [.light]),
+        "🫱🏻‍🫲🏼": (.handshake, [.light, .mediumLight]),
+        "🫱🏻‍🫲🏽": (.handshake, [.light, .medium]),
+        "🫱🏻‍🫲🏾": (.handshake, [.light, .mediumDark]),
+        "🫱🏻‍🫲🏿": (.handshake, [.light, .dark]),
+        "🤝🏼": (.handshake, [.mediumLight]),
+        "🫱🏼‍🫲🏻": (.handshake, [.mediumLight, .light]),
+        "🫱🏼‍🫲🏽": (.handshake, [.mediumLight, .medium]),
+        "🫱🏼‍🫲🏾": (.handshake, [.mediumLight, .mediumDark]),
+        "🫱🏼‍🫲🏿": (.handshake, [.mediumLight, .dark]),
+        "🤝🏽": (.handshake, [.medium]),
+        "🫱🏽‍🫲🏻": (.handshake, [.medium, .light]),
+        "🫱🏽‍🫲🏼": (.handshake, [.medium, .mediumLight]),
+        "🫱🏽‍🫲🏾": (.handshake, [.medium, .mediumDark]),
+        "🫱🏽‍🫲🏿": (.handshake, [.medium, .dark]),
+        "🤝🏾": (.handshake, [.mediumDark]),
+        "🫱🏾‍🫲🏻": (.handshake, [.mediumDark, .light]),
+        "🫱🏾‍🫲🏼": (.handshake, [.mediumDark, .mediumLight]),
+        "🫱🏾‍🫲🏽": (.handshake, [.mediumDark, .medium]),
+        "🫱🏾‍🫲🏿": (.handshake, [.mediumDark, .dark]),
+        "🤝🏿": (.handshake, [.dark]),
+        "🫱🏿‍🫲🏻": (.handshake, [.dark, .light]),
+        "🫱🏿‍🫲🏼": (.handshake, [.dark, .mediumLight]),
+        "🫱🏿‍🫲🏽": (.handshake, [.dark, .medium]),
+        "🫱🏿‍🫲🏾": (.handshake, [.dark, .mediumDark]),
+        "🙏🏻": (.pray, [.light]),
+        "🙏🏼": (.pray, [.mediumLight]),
+        "🙏🏽": (.pray, [.medium]),
+        "🙏🏾": (.pray, [.mediumDark]),
+        "🙏🏿": (.pray, [.dark]),
+        "✍🏻": (.writingHand, [.light]),
+        "✍🏼": (.writingHand, [.mediumLight]),
+        "✍🏽": (.writingHand, [.medium]),
+        "✍🏾": (.writingHand, [.mediumDark]),
+        "✍🏿": (.writingHand, [.dark]),
+        "💅🏻": (.nailCare, [.light]),
+        "💅🏼": (.nailCare, [.mediumLight]),
+        "💅🏽": (.nailCare, [.medium]),
+        "💅🏾": (.nailCare, [.mediumDark]),
+        "💅🏿": (.nailCare, [.dark]),
+        "🤳🏻": (.selfie, [.light]),
+        "🤳🏼": (.selfie, [.mediumLight]),
+        "🤳🏽": (.selfie, [.medium]),
+        "🤳🏾": (.selfie, [.mediumDark]),
+        "🤳🏿": (.selfie, [.dark]),
+        "💪🏻": (.muscle, [.light]),
+        "💪🏼": (.muscle, [.mediumLight]),
+        "💪🏽": (.muscle, [.medium]),
+        "💪🏾": (.muscle, [.mediumDark]),
+        "💪🏿": (.muscle, [.dark]),
+        "🦵🏻": (.leg, [.light]),
+        "🦵🏼": (.leg, [.mediumLight]),
+        "🦵🏽": (.leg, [.medium]),
+        "🦵🏾": (.leg, [.mediumDark]),
+        "🦵🏿": (.leg, [.dark]),
+        "🦶🏻": (.foot, [.light]),
+        "🦶🏼": (.foot, [.mediumLight]),
+        "🦶🏽": (.foot, [.medium]),
+        "🦶🏾": (.foot, [.mediumDark]),
+        "🦶🏿": (.foot, [.dark]),
+        "👂🏻": (.ear, [.light]),
+        "👂🏼": (.ear, [.mediumLight]),
+        "👂🏽": (.ear, [.medium]),
+        "👂🏾": (.ear, [.mediumDark]),
+        "👂🏿": (.ear, [.dark]),
+        "🦻🏻": (.earWithHearingAid, [.light]),
+        "🦻🏼": (.earWithHearingAid, [.mediumLight]),
+        "🦻🏽": (.earWithHearingAid, [.medium]),
+        "🦻🏾": (.earWithHearingAid, [.mediumDark]),
+        "🦻🏿": (.earWithHearingAid, [.dark]),
+        "👃🏻": (.nose, [.light]),
+        "👃🏼": (.nose, [.mediumLight]),
+        "👃🏽": (.nose, [.medium]),
+        "👃🏾": (.nose, [.mediumDark]),
+        "👃🏿": (.nose, [.dark]),
+        "👶🏻": (.baby, [.light]),
+        "👶🏼": (.baby, [.mediumLight]),
+        "👶🏽": (.baby, [.medium]),
+        "👶🏾": (.baby, [.mediumDark]),
+        "👶🏿": (.baby, [.dark]),
+        "🧒🏻": (.child, [.light]),
+        "🧒🏼": (.child, [.mediumLight]),
+        "🧒🏽": (.child, [.medium]),
+        "🧒🏾": (.child, [.mediumDark]),
+        "🧒🏿": (.child, [.dark]),
+        "👦🏻": (.boy, [.light]),
+        "👦🏼": (.boy, [.mediumLight]),
+        "👦🏽": (.boy, [.medium]),
+        "👦🏾": (.boy, [.mediumDark]),
+        "👦🏿": (.boy, [.dark]),
+        "👧🏻": (.girl, [.light]),
+        "👧🏼": (.girl, [.mediumLight]),
+        "👧🏽": (.girl, [.medium]),
+        "👧🏾": (.girl, [.mediumDark]),
+        "👧🏿": (.girl, [.dark]),
+        "🧑🏻": (.adult, [.light]),
+        "🧑🏼": (.adult, [.mediumLight]),
+        "🧑🏽": (.adult, [.medium]),
+        "🧑🏾": (.adult, [.mediumDark]),
+        "🧑🏿": (.adult, [.dark]),
+        "👱🏻": (.personWithBlondHair, [.light]),
+        "👱🏼": (.personWithBlondHair, [.mediumLight]),
+        "👱🏽": (.personWithBlondHair, [.medium]),
+        "👱🏾": (.personWithBlondHair, [.mediumDark]),
+        "👱🏿": (.personWithBlondHair, [.dark]),
+        "👨🏻": (.man, [.light]),
+        "👨🏼": (.man, [.mediumLight]),
+        "👨🏽": (.man, [.medium]),
+        "👨🏾": (.man, [.mediumDark]),
+        "👨🏿": (.man, [.dark]),
+        "🧔🏻": (.beardedPerson, [.light]),
+        "🧔🏼": (.beardedPerson, [.mediumLight]),
+        "🧔🏽": (.beardedPerson, [.medium]),
+        "🧔🏾": (.beardedPerson, [.mediumDark]),
+        "🧔🏿": (.beardedPerson, [.dark]),
+        "🧔🏻‍♂️": (.manWithBeard, [.light]),
+        "🧔🏼‍♂️": (.manWithBeard, [.mediumLight]),
+        "🧔🏽‍♂️": (.manWithBeard, [.medium]),
+        "🧔🏾‍♂️": (.manWithBeard, [.mediumDark]),
+        "🧔🏿‍♂️": (.manWithBeard, [.dark]),
+        "🧔🏻‍♀️": (.womanWithBeard, [.light]),
+        "🧔🏼‍♀️": (.womanWithBeard, [.mediumLight]),
+        "🧔🏽‍♀️": (.womanWithBeard, [.medium]),
+        "🧔🏾‍♀️": (.womanWithBeard, [.mediumDark]),
+        "🧔🏿‍♀️": (.womanWithBeard, [.dark]),
+        "👨🏻‍🦰": (.redHairedMan, [.light]),
+        "👨🏼‍🦰": (.redHairedMan, [.mediumLight]),
+        "👨🏽‍🦰": (.redHairedMan, [.medium]),
+        "👨🏾‍🦰": (.redHairedMan, [.mediumDark]),
+        "👨🏿‍🦰": (.redHairedMan, [.dark]),
+        "👨🏻‍🦱": (.curlyHairedMan, [.light]),
+        "👨🏼‍🦱": (.curlyHairedMan, [.mediumLight]),
+        "👨🏽‍🦱": (.curlyHairedMan, [.medium]),
+        "👨🏾‍🦱": (.curlyHairedMan, [.mediumDark]),
+        "👨🏿‍🦱": (.curlyHairedMan, [.dark]),
+        "👨🏻‍🦳": (.whiteHairedMan, [.light]),
+        "👨🏼‍🦳": (.whiteHairedMan, [.mediumLight]),
+        "👨🏽‍🦳": (.whiteHairedMan, [.medium]),
+        "👨🏾‍🦳": (.whiteHairedMan, [.mediumDark]),
+        "👨🏿‍🦳": (.whiteHairedMan, [.dark]),
+        "👨🏻‍🦲": (.baldMan, [.light]),
+        "👨🏼‍🦲": (.baldMan, [.mediumLight]),
+        "👨🏽‍🦲": (.baldMan, [.medium]),
+        "👨🏾‍🦲": (.baldMan, [.mediumDark]),
+        "👨🏿‍🦲": (.baldMan, [.dark]),
+        "👩🏻": (.woman, [.light]),
+        "👩🏼": (.woman, [.mediumLight]),
+        "👩🏽": (.woman, [.medium]),
+        "👩🏾": (.woman, [.mediumDark]),
+        "👩🏿": (.woman, [.dark]),
+        "👩🏻‍🦰": (.redHairedWoman, [.light]),
+        "👩🏼‍🦰": (.redHairedWoman, [.mediumLight]),
+        "👩🏽‍🦰": (.redHairedWoman, [.medium]),
+        "👩🏾‍🦰": (.redHairedWoman, [.mediumDark]),
+        "👩🏿‍🦰": (.redHairedWoman, [.dark]),
+        "🧑🏻‍🦰": (.redHairedPerson, [.light]),
+        "🧑🏼‍🦰": (.redHairedPerson, [.mediumLight]),
+        "🧑🏽‍🦰": (.redHairedPerson, [.medium]),
+        "🧑🏾‍🦰": (.redHairedPerson, [.mediumDark]),
+        "🧑🏿‍🦰": (.redHairedPerson, [.dark]),
+        "👩🏻‍🦱": (.curlyHairedWoman, [.light]),
+        "👩🏼‍🦱": (.curlyHairedWoman, [.mediumLight]),
+        "👩🏽‍🦱": (.curlyHairedWoman, [.medium]),
+        "👩🏾‍🦱": (.curlyHairedWoman, [.mediumDark]),
+        "👩🏿‍🦱": (.curlyHairedWoman, [.dark]),
+        "🧑🏻‍🦱": (.curlyHairedPerson, [.light]),
+        "🧑🏼‍🦱": (.curlyHairedPerson, [.mediumLight]),
+        "🧑🏽‍🦱": (.curlyHairedPerson, [.medium]),
+        "🧑🏾‍🦱": (.curlyHairedPerson, [.mediumDark]),
+        "🧑🏿‍🦱": (.curlyHairedPerson, [.dark]),
+        "👩🏻‍🦳": (.whiteHairedWoman, [.light]),
+        "👩🏼‍🦳": (.whiteHairedWoman, [.mediumLight]),
+        "👩🏽‍🦳": (.whiteHairedWoman, [.medium]),
+        "👩🏾‍🦳": (.whiteHairedWoman, [.mediumDark]),
+        "👩🏿‍🦳": (.whiteHairedWoman, [.dark]),
+        "🧑🏻‍🦳": (.whiteHairedPerson, [.light]),
+        "🧑🏼‍🦳": (.whiteHairedPerson, [.mediumLight]),
+        "🧑🏽‍🦳": (.whiteHairedPerson, [.medium]),
+        "🧑🏾‍🦳": (.whiteHairedPerson, [.mediumDark]),
+        "🧑🏿‍🦳": (.whiteHairedPerson, [.dark]),
+        "👩🏻‍🦲": (.baldWoman, [.light]),
+        "👩🏼‍🦲": (.baldWoman, [.mediumLight]),
+        "👩🏽‍🦲": (.baldWoman, [.medium]),
+        "👩🏾‍🦲": (.baldWoman, [.mediumDark]),
+        "👩🏿‍🦲": (.baldWoman, [.dark]),
+        "🧑🏻‍🦲": (.baldPerson, [.light]),
+        "🧑🏼‍🦲": (.baldPerson, [.mediumLight]),
+        "🧑🏽‍🦲": (.baldPerson, [.medium]),
+        "🧑🏾‍🦲": (.baldPerson, [.mediumDark]),
+        "🧑🏿‍🦲": (.baldPerson, [.dark]),
+        "👱🏻‍♀️": (.blondHairedWoman, [.light]),
+        "👱🏼‍♀️": (.blondHairedWoman, [.mediumLight]),
+        "👱🏽‍♀️": (.blondHairedWoman, [.medium]),
+        "👱🏾‍♀️": (.blondHairedWoman, [.mediumDark]),
+        "👱🏿‍♀️": (.blondHairedWoman, [.dark]),
+        "👱🏻‍♂️": (.blondHairedMan, [.light]),
+        "👱🏼‍♂️": (.blondHairedMan, [.mediumLight]),
+        "👱🏽‍♂️": (.blondHairedMan, [.medium]),
+        "👱🏾‍♂️": (.blondHairedMan, [.mediumDark]),
+        "👱🏿‍♂️": (.blondHairedMan, [.dark]),
+        "🧓🏻": (.olderAdult, [.light]),
+        "🧓🏼": (.olderAdult, [.mediumLight]),
+        "🧓🏽": (.olderAdult, [.medium]),
+        "🧓🏾": (.olderAdult, [.mediumDark]),
+        "🧓🏿": (.olderAdult, [.dark]),
+        "👴🏻": (.olderMan, [.light]),
+        "👴🏼": (.olderMan, [.mediumLight]),
+        "👴🏽": (.olderMan, [.medium]),
+        "👴🏾": (.olderMan, [.mediumDark]),
+        "👴🏿": (.olderMan, [.dark]),
+        "👵🏻": (.olderWoman, [.light]),
+        "👵🏼": (.olderWoman, [.mediumLight]),
+        "👵🏽": (.olderWoman, [.medium]),
+        "👵🏾": (.olderWoman, [.mediumDark]),
+        "👵🏿": (.olderWoman, [.dark]),
+        "🙍🏻": (.personFrowning, [.light]),
+        "🙍🏼": (.personFrowning, [.mediumLight]),
+        "🙍🏽": (.personFrowning, [.medium]),
+        "🙍🏾": (.personFrowning, [.mediumDark]),
+        "🙍🏿": (.personFrowning, [.dark]),
+        "🙍🏻‍♂️": (.manFrowning, [.light]),
+        "🙍🏼‍♂️": (.manFrowning, [.mediumLight]),
+        "🙍🏽‍♂️": (.manFrowning, [.medium]),
+        "🙍🏾‍♂️": (.manFrowning, [.mediumDark]),
+        "🙍🏿‍♂️": (.manFrowning, [.dark]),
+        "🙍🏻‍♀️": (.womanFrowning, [.light]),
+        "🙍🏼‍♀️": (.womanFrowning, [.mediumLight]),
+        "🙍🏽‍♀️": (.womanFrowning, [.medium]),
+        "🙍🏾‍♀️": (.womanFrowning, [.mediumDark]),
+        "🙍🏿‍♀️": (.womanFrowning, [.dark]),
+        "🙎🏻": (.personWithPoutingFace, [.light]),
+        "🙎🏼": (.personWithPoutingFace, [.mediumLight]),
+        "🙎🏽": (.personWithPoutingFace, [.medium]),
+        "🙎🏾": (.personWithPoutingFace, [.mediumDark]),
+        "🙎🏿": (.personWithPoutingFace, [.dark]),
+        "🙎🏻‍♂️": (.manPouting, [.light]),
+        "🙎🏼‍♂️": (.manPouting, [.mediumLight]),
+        "🙎🏽‍♂️": (.manPouting, [.medium]),
+        "🙎🏾‍♂️": (.manPouting, [.mediumDark]),
+        "🙎🏿‍♂️": (.manPouting, [.dark]),
+        "🙎🏻‍♀️": (.womanPouting, [.light]),
+        "🙎🏼‍♀️": (.womanPouting, [.mediumLight]),
+        "🙎🏽‍♀️": (.womanPouting, [.medium]),
+        "🙎🏾‍♀️": (.womanPouting, [.mediumDark]),
+        "🙎🏿‍♀️": (.womanPouting, [.dark]),
+        "🙅🏻": (.noGood, [.light]),
+        "🙅🏼": (.noGood, [.mediumLight]),
+        "🙅🏽": (.noGood, [.medium]),
+        "🙅🏾": (.noGood, [.mediumDark]),
+        "🙅🏿": (.noGood, [.dark]),
+        "🙅🏻‍♂️": (.manGesturingNo, [.light]),
+        "🙅🏼‍♂️": (.manGesturingNo, [.mediumLight]),
+        "🙅🏽‍♂️": (.manGesturingNo, [.medium]),
+        "🙅🏾‍♂️": (.manGesturingNo, [.mediumDark]),
+        "🙅🏿‍♂️": (.manGesturingNo, [.dark]),
+        "🙅🏻‍♀️": (.womanGesturingNo, [.light]),
+        "🙅🏼‍♀️": (.womanGesturingNo, [.mediumLight]),
+        "🙅🏽‍♀️": (.womanGesturingNo, [.medium]),
+        "🙅🏾‍♀️": (.womanGesturingNo, [.mediumDark]),
+        "🙅🏿‍♀️": (.womanGesturingNo, [.dark]),
+        "🙆🏻": (.okWoman, [.light]),
+        "🙆🏼": (.okWoman, [.mediumLight]),
+        "🙆🏽": (.okWoman, [.medium]),
+        "🙆🏾": (.okWoman, [.mediumDark]),
+        "🙆🏿": (.okWoman, [.dark]),
+        "🙆🏻‍♂️": (.manGesturingOk, [.light]),
+        "🙆🏼‍♂️": (.manGesturingOk, [.mediumLight]),
+        "🙆🏽‍♂️": (.manGesturingOk, [.medium]),
+        "🙆🏾‍♂️": (.manGesturingOk, [.mediumDark]),
+        "🙆🏿‍♂️": (.manGesturingOk, [.dark]),
+        "🙆🏻‍♀️": (.womanGesturingOk, [.light]),
+        "🙆🏼‍♀️": (.womanGesturingOk, [.mediumLight]),
+        "🙆🏽‍♀️": (.womanGesturingOk, [.medium]),
+        "🙆🏾‍♀️": (.womanGesturingOk, [.mediumDark]),
+        "🙆🏿‍♀️": (.womanGesturingOk, [.dark]),
+        "💁🏻": (.informationDeskPerson, [.light]),
+        "💁🏼": (.informationDeskPerson, [.mediumLight]),
+        "💁🏽": (.informationDeskPerson, [.medium]),
+        "💁🏾": (.informationDeskPerson, [.mediumDark]),
+        "💁🏿": (.informationDeskPerson, [.dark]),
+        "💁🏻‍♂️": (.manTippingHand, [.light]),
+        "💁🏼‍♂️": (.manTippingHand, [.mediumLight]),
+        "💁🏽‍♂️": (.manTippingHand, [.medium]),
+        "💁🏾‍♂️": (.manTippingHand, [.mediumDark]),
+        "💁🏿‍♂️": (.manTippingHand, [.dark]),
+        "💁🏻‍♀️": (.womanTippingHand, [.light]),
+        "💁🏼‍♀️": (.womanTippingHand, [.mediumLight]),
+        "💁🏽‍♀️": (.womanTippingHand, [.medium]),
+        "💁🏾‍♀️": (.womanTippingHand, [.mediumDark]),
+        "💁🏿‍♀️": (.womanTippingHand, [.dark]),
+        "🙋🏻": (.raisingHand, [.light]),
+        "🙋🏼": (.raisingHand, [.mediumLight]),
+        "🙋🏽": (.raisingHand, [.medium]),
+        "🙋🏾": (.raisingHand, [.mediumDark]),
+        "🙋🏿": (.raisingHand, [.dark]),
+        "🙋🏻‍♂️": (.manRaisingHand, [.light]),
+        "🙋🏼‍♂️": (.manRaisingHand, [.mediumLight]),
+        "🙋🏽‍♂️": (.manRaisingHand, [.medium]),
+        "🙋🏾‍♂️": (.manRaisingHand, [.mediumDark]),
+        "🙋🏿‍♂️": (.manRaisingHand, [.dark]),
+        "🙋🏻‍♀️": (.womanRaisingHand, [.light]),
+        "🙋🏼‍♀️": (.womanRaisingHand, [.mediumLight]),
+        "🙋🏽‍♀️": (.womanRaisingHand, [.medium]),
+        "🙋🏾‍♀️": (.womanRaisingHand, [.mediumDark]),
+        "🙋🏿‍♀️": (.womanRaisingHand, [.dark]),
+        "🧏🏻": (.deafPerson, [.light]),
+        "🧏🏼": (.deafPerson, [.mediumLight]),
+        "🧏🏽": (.deafPerson, [.medium]),
+        "🧏🏾": (.deafPerson, [.mediumDark]),
+        "🧏🏿": (.deafPerson, [.dark]),
+        "🧏🏻‍♂️": (.deafMan, [.light]),
+        "🧏🏼‍♂️": (.deafMan, [.mediumLight]),
+        "🧏🏽‍♂️": (.deafMan, [.medium]),
+        "🧏🏾‍♂️": (.deafMan, [.mediumDark]),
+        "🧏🏿‍♂️": (.deafMan, [.dark]),
+        "🧏🏻‍♀️": (.deafWoman, [.light]),
+        "🧏🏼‍♀️": (.deafWoman, [.mediumLight]),
+        "🧏🏽‍♀️": (.deafWoman, [.medium]),
+        "🧏🏾‍♀️": (.deafWoman, [.mediumDark]),
+        "🧏🏿‍♀️": (.deafWoman, [.dark]),
+        "🙇🏻": (.bow, [.light]),
+        "🙇🏼": (.bow, [.mediumLight]),
+        "🙇🏽": (.bow, [.medium]),
+        "🙇🏾": (.bow, [.mediumDark]),
+        "🙇🏿": (.bow, [.dark]),
+        "🙇🏻‍♂️": (.manBowing, [.light]),
+        "🙇🏼‍♂️": (.manBowing, [.mediumLight]),
+        "🙇🏽‍♂️": (.manBowing, [.medium]),
+        "🙇🏾‍♂️": (.manBowing, [.mediumDark]),
+        "🙇🏿‍♂️": (.manBowing, [.dark]),
+        "🙇🏻‍♀️": (.womanBowing, [.light]),
+        "🙇🏼‍♀️": (.womanBowing, [.mediumLight]),
+        "🙇🏽‍♀️": (.womanBowing, [.medium]),
+        "🙇🏾‍♀️": (.womanBowing, [.mediumDark]),
+        "🙇🏿‍♀️": (.womanBowing, [.dark]),
+        "🤦🏻": (.facePalm, [.light]),
+        "🤦🏼": (.facePalm, [.mediumLight]),
+        "🤦🏽": (.facePalm, [.medium]),
+        "🤦🏾": (.facePalm, [.mediumDark]),
+        "🤦🏿": (.facePalm, [.dark]),
+        "🤦🏻‍♂️": (.manFacepalming, [.light]),
+        "🤦🏼‍♂️": (.manFacepalming, [.mediumLight]),
+        "🤦🏽‍♂️": (.manFacepalming, [.medium]),
+        "🤦🏾‍♂️": (.manFacepalming, [.mediumDark]),
+        "🤦🏿‍♂️": (.manFacepalming, [.dark]),
+        "🤦🏻‍♀️": (.womanFacepalming, [.light]),
+        "🤦🏼‍♀️": (.womanFacepalming, [.mediumLight]),
+        "🤦🏽‍♀️": (.womanFacepalming, [.medium]),
+        "🤦🏾‍♀️": (.womanFacepalming, [.mediumDark]),
+        "🤦🏿‍♀️": (.womanFacepalming, [.dark]),
+        "🤷🏻": (.shrug, [.light]),
+        "🤷🏼": (.shrug, [.mediumLight]),
+        "🤷🏽": (.shrug, [.medium]),
+        "🤷🏾": (.shrug, [.mediumDark]),
+        "🤷🏿": (.shrug, [.dark]),
+        "🤷🏻‍♂️": (.manShrugging, [.light]),
+        "🤷🏼‍♂️": (.manShrugging, [.mediumLight]),
+        "🤷🏽‍♂️": (.manShrugging, [.medium]),
+        "🤷🏾‍♂️": (.manShrugging, [.mediumDark]),
+        "🤷🏿‍♂️": (.manShrugging, [.dark]),
+        "🤷🏻‍♀️": (.womanShrugging, [.light]),
+        "🤷🏼‍♀️": (.womanShrugging, [.mediumLight]),
+        "🤷🏽‍♀️": (.womanShrugging, [.medium]),
+        "🤷🏾‍♀️": (.womanShrugging, [.mediumDark]),
+        "🤷🏿‍♀️": (.womanShrugging, [.dark]),
+        "🧑🏻‍⚕️": (.healthWorker, [.light]),
+        "🧑🏼‍⚕️": (.healthWorker, [.mediumLight]),
+        "🧑🏽‍⚕️": (.healthWorker, [.medium]),
+        "🧑🏾‍⚕️": (.healthWorker, [.mediumDark]),
+        "🧑🏿‍⚕️": (.healthWorker, [.dark]),
+        "👨🏻‍⚕️": (.maleDoctor, [.light]),
+        "👨🏼‍⚕️": (.maleDoctor, [.mediumLight]),
+        "👨🏽‍⚕️": (.maleDoctor, [.medium]),
+        "👨🏾‍⚕️": (.maleDoctor, [.mediumDark]),
+        "👨🏿‍⚕️": (.maleDoctor, [.dark]),
+        "👩🏻‍⚕️": (.femaleDoctor, [.light]),
+        "👩🏼‍⚕️": (.femaleDoctor, [.mediumLight]),
+        "👩🏽‍⚕️": (.femaleDoctor, [.medium]),
+        "👩🏾‍⚕️": (.femaleDoctor, [.mediumDark]),
+        "👩🏿‍⚕️": (.femaleDoctor, [.dark]),
+        "🧑🏻‍🎓": (.student, [.light]),
+        "🧑🏼‍🎓": (.student, [.mediumLight]),
+        "🧑🏽‍🎓": (.student, [.medium]),
+        "🧑🏾‍🎓": (.student, [.mediumDark]),
+        "🧑🏿‍🎓": (.student, [.dark]),
+        "👨🏻‍🎓": (.maleStudent, [.light]),
+        "👨🏼‍🎓": (.maleStudent, [.mediumLight]),
+        "👨🏽‍🎓": (.maleStudent, [.medium]),
+        "👨🏾‍🎓": (.maleStudent, [.mediumDark]),
+        "👨🏿‍🎓": (.maleStudent, [.dark]),
+        "👩🏻‍🎓": (.femaleStudent, [.light]),
+        "👩🏼‍🎓": (.femaleStudent, [.mediumLight]),
+        "👩🏽‍🎓": (.femaleStudent, [.medium]),
+        "👩🏾‍🎓": (.femaleStudent, [.mediumDark]),
+        "👩🏿‍🎓": (.femaleStudent, [.dark]),
+        "🧑🏻‍🏫": (.teacher, [.light]),
+        "🧑🏼‍🏫": (.teacher, [.mediumLight]),
+        "🧑🏽‍🏫": (.teacher, [.medium]),
+        "🧑🏾‍🏫": (.teacher, [.mediumDark]),
+        "🧑🏿‍🏫": (.teacher, [.dark]),
+        "👨🏻‍🏫": (.maleTeacher, [.light]),
+        "👨🏼‍🏫": (.maleTeacher, [.mediumLight]),
+        "👨🏽‍🏫": (.maleTeacher, [.medium]),
+        "👨🏾‍🏫": (.maleTeacher, [.mediumDark]),
+        "👨🏿‍🏫": (.maleTeacher, [.dark]),
+        "👩🏻‍🏫": (.femaleTeacher, [.light]),
+        "👩🏼‍🏫": (.femaleTeacher, [.mediumLight]),
+        "👩🏽‍🏫": (.femaleTeacher, [.medium]),
+        "👩🏾‍🏫": (.femaleTeacher, [.mediumDark]),
+        "👩🏿‍🏫": (.femaleTeacher, [.dark]),
+        "🧑🏻‍⚖️": (.judge, [.light]),
+        "🧑🏼‍⚖️": (.judge, [.mediumLight]),
+        "🧑🏽‍⚖️": (.judge, [.medium]),
+        "🧑🏾‍⚖️": (.judge, [.mediumDark]),
+        "🧑🏿‍⚖️": (.judge, [.dark]),
+        "👨🏻‍⚖️": (.maleJudge, [.light]),
+        "👨🏼‍⚖️": (.maleJudge, [.mediumLight]),
+        "👨🏽‍⚖️": (.maleJudge, [.medium]),
+        "👨🏾‍⚖️": (.maleJudge, [.mediumDark]),
+        "👨🏿‍⚖️": (.maleJudge, [.dark]),
+        "👩🏻‍⚖️": (.femaleJudge, [.light]),
+        "👩🏼‍⚖️": (.femaleJudge, [.mediumLight]),
+        "👩🏽‍⚖️": (.femaleJudge, [.medium]),
+        "👩🏾‍⚖️": (.femaleJudge, [.mediumDark]),
+        "👩🏿‍⚖️": (.femaleJudge, [.dark]),
+        "🧑🏻‍🌾": (.farmer, [.light]),
+        "🧑🏼‍🌾": (.farmer, [.mediumLight]),
+        "🧑🏽‍🌾": (.farmer, [.medium]),
+        "🧑🏾‍🌾": (.farmer, [.mediumDark]),
+        "🧑🏿‍🌾": (.farmer, [.dark]),
+        "👨🏻‍🌾": (.maleFarmer, [.light]),
+        "👨🏼‍🌾": (.maleFarmer, [.mediumLight]),
+        "👨🏽‍🌾": (.maleFarmer, [.medium]),
+        "👨🏾‍🌾": (.maleFarmer, [.mediumDark]),
+        "👨🏿‍🌾": (.maleFarmer, [.dark]),
+        "👩🏻‍🌾": (.femaleFarmer, [.light]),
+        "👩🏼‍🌾": (.femaleFarmer, [.mediumLight]),
+        "👩🏽‍🌾": (.femaleFarmer, [.medium]),
+        "👩🏾‍🌾": (.femaleFarmer, [.mediumDark]),
+        "👩🏿‍🌾": (.femaleFarmer, [.dark]),
+        "🧑🏻‍🍳": (.cook, [.light]),
+        "🧑🏼‍🍳": (.cook, [.mediumLight]),
+        "🧑🏽‍🍳": (.cook, [.medium]),
+        "🧑🏾‍🍳": (.cook, [.mediumDark]),
+        "🧑🏿‍🍳": (.cook, [.dark]),
+        "👨🏻‍🍳": (.maleCook, [.light]),
+        "👨🏼‍🍳": (.maleCook, [.mediumLight]),
+        "👨🏽‍🍳": (.maleCook, [.medium]),
+        "👨🏾‍🍳": (.maleCook, [.mediumDark]),
+        "👨🏿‍🍳": (.maleCook, [.dark]),
+        "👩🏻‍🍳": (.femaleCook, [.light]),
+        "👩🏼‍🍳": (.femaleCook, [.mediumLight]),
+        "👩🏽‍🍳": (.femaleCook, [.medium]),
+        "👩🏾‍🍳": (.femaleCook, [.mediumDark]),
+        "👩🏿‍🍳": (.femaleCook, [.dark]),
+        "🧑🏻‍🔧": (.mechanic, [.light]),
+        "🧑🏼‍🔧": (.mechanic, [.mediumLight]),
+        "🧑🏽‍🔧": (.mechanic, [.medium]),
+        "🧑🏾‍🔧": (.mechanic, [.mediumDark]),
+        "🧑🏿‍🔧": (.mechanic, [.dark]),
+        "👨🏻‍🔧": (.maleMechanic, [.light]),
+        "👨🏼‍🔧": (.maleMechanic, [.mediumLight]),
+        "👨🏽‍🔧": (.maleMechanic, [.medium]),
+        "👨🏾‍🔧": (.maleMechanic, [.mediumDark]),
+        "👨🏿‍🔧": (.maleMechanic, [.dark]),
+        "👩🏻‍🔧": (.femaleMechanic, [.light]),
+        "👩🏼‍🔧": (.femaleMechanic, [.mediumLight]),
+        "👩🏽‍🔧": (.femaleMechanic, [.medium]),
+        "👩🏾‍🔧": (.femaleMechanic, [.mediumDark]),
+        "👩🏿‍🔧": (.femaleMechanic, [.dark]),
+        "🧑🏻‍🏭": (.factoryWorker, [.light]),
+        "🧑🏼‍🏭": (.factoryWorker, [.mediumLight]),
+        "🧑🏽‍🏭": (.factoryWorker, [.medium]),
+        "🧑🏾‍🏭": (.factoryWorker, [.mediumDark]),
+        "🧑🏿‍🏭": (.factoryWorker, [.dark]),
+        "👨🏻‍🏭": (.maleFactoryWorker, [.light]),
+        "👨🏼‍🏭": (.maleFactoryWorker, [.mediumLight]),
+        "👨🏽‍🏭": (.maleFactoryWorker, [.medium]),
+        "👨🏾‍🏭": (.maleFactoryWorker, [.mediumDark]),
+        "👨🏿‍🏭": (.maleFactoryWorker, [.dark]),
+        "👩🏻‍🏭": (.femaleFactoryWorker, [.light]),
+        "👩🏼‍🏭": (.femaleFactoryWorker, [.mediumLight]),
+        "👩🏽‍🏭": (.femaleFactoryWorker, [.medium]),
+        "👩🏾‍🏭": (.femaleFactoryWorker, [.mediumDark]),
+        "👩🏿‍🏭": (.femaleFactoryWorker, [.dark]),
+        "🧑🏻‍💼": (.officeWorker, [.light]),
+        "🧑🏼‍💼": (.officeWorker, [.mediumLight]),
+        "🧑🏽‍💼": (.officeWorker, [.medium]),
+        "🧑🏾‍💼": (.officeWorker, [.mediumDark]),
+        "🧑🏿‍💼": (.officeWorker, [.dark]),
+        "👨🏻‍💼": (.maleOfficeWorker, [.light]),
+        "👨🏼‍💼": (.maleOfficeWorker, [.mediumLight]),
+        "👨🏽‍💼": (.maleOfficeWorker, [.medium]),
+        "👨🏾‍💼": (.maleOfficeWorker, [.mediumDark]),
+        "👨🏿‍💼": (.maleOfficeWorker, [.dark]),
+        "👩🏻‍💼": (.femaleOfficeWorker, [.light]),
+        "👩🏼‍💼": (.femaleOfficeWorker, [.mediumLight]),
+        "👩🏽‍💼": (.femaleOfficeWorker, [.medium]),
+        "👩🏾‍💼": (.femaleOfficeWorker, [.mediumDark]),
+        "👩🏿‍💼": (.femaleOfficeWorker, [.dark]),
+        "🧑🏻‍🔬": (.scientist, [.light]),
+        "🧑🏼‍🔬": (.scientist, [.mediumLight]),
+        "🧑🏽‍🔬": (.scientist, [.medium]),
+        "🧑🏾‍🔬": (.scientist, [.mediumDark]),
+        "🧑🏿‍🔬": (.scientist, [.dark]),
+        "👨🏻‍🔬": (.maleScientist, [.light]),
+        "👨🏼‍🔬": (.maleScientist, [.mediumLight]),
+        "👨🏽‍🔬": (.maleScientist, [.medium]),
+        "👨🏾‍🔬": (.maleScientist, [.mediumDark]),
+        "👨🏿‍🔬": (.maleScientist, [.dark]),
+        "👩🏻‍🔬": (.femaleScientist, [.light]),
+        "👩🏼‍🔬": (.femaleScientist, [.mediumLight]),
+        "👩🏽‍🔬": (.femaleScientist, [.medium]),
+        "👩🏾‍🔬": (.femaleScientist, [.mediumDark]),
+        "👩🏿‍🔬": (.femaleScientist, [.dark]),
+        "🧑🏻‍💻": (.technologist, [.light]),
+        "🧑🏼‍💻": (.technologist, [.mediumLight]),
+        "🧑🏽‍💻": (.technologist, [.medium]),
+        "🧑🏾‍💻": (.technologist, [.mediumDark]),
+        "🧑🏿‍💻": (.technologist, [.dark]),
+        "👨🏻‍💻": (.maleTechnologist, [.light]),
+        "👨🏼‍💻": (.maleTechnologist, [.mediumLight]),
+        "👨🏽‍💻": (.maleTechnologist, [.medium]),
+        "👨🏾‍💻": (.maleTechnologist, [.mediumDark]),
+        "👨🏿‍💻": (.maleTechnologist, [.dark]),
+        "👩🏻‍💻": (.femaleTechnologist, [.light]),
+        "👩🏼‍💻": (.femaleTechnologist, [.mediumLight]),
+        "👩🏽‍💻": (.femaleTechnologist, [.medium]),
+        "👩🏾‍💻": (.femaleTechnologist, [.mediumDark]),
+        "👩🏿‍💻": (.femaleTechnologist, [.dark]),
+        "🧑🏻‍🎤": (.singer, [.light]),
+        "🧑🏼‍🎤": (.singer, [.mediumLight]),
+        "🧑🏽‍🎤": (.singer, [.medium]),
+        "🧑🏾‍🎤": (.singer, [.mediumDark]),
+        "🧑🏿‍🎤": (.singer, [.dark]),
+        "👨🏻‍🎤": (.maleSinger, [.light]),
+        "👨🏼‍🎤": (.maleSinger, [.mediumLight]),
+        "👨🏽‍🎤": (.maleSinger, [.medium]),
+        "👨🏾‍🎤": (.maleSinger, [.mediumDark]),
+        "👨🏿‍🎤": (.maleSinger, [.dark]),
+        "👩🏻‍🎤": (.femaleSinger, [.light]),
+        "👩🏼‍🎤": (.femaleSinger, [.mediumLight]),
+        "👩🏽‍🎤": (.femaleSinger, [.medium]),
+        "👩🏾‍🎤": (.femaleSinger, [.mediumDark]),
+        "👩🏿‍🎤": (.femaleSinger, [.dark]),
+        "🧑🏻‍🎨": (.artist, [.light]),
+        "🧑🏼‍🎨": (.artist, [.mediumLight]),
+        "🧑🏽‍🎨": (.artist, [.medium]),
+        "🧑🏾‍🎨": (.artist, [.mediumDark]),
+        "🧑🏿‍🎨": (.artist, [.dark]),
+        "👨🏻‍🎨": (.maleArtist, [.light]),
+        "👨🏼‍🎨": (.maleArtist, [.mediumLight]),
+        "👨🏽‍🎨": (.maleArtist, [.medium]),
+        "👨🏾‍🎨": (.maleArtist, [.mediumDark]),
+        "👨🏿‍🎨": (.maleArtist, [.dark]),
+        "👩🏻‍🎨": (.femaleArtist, [.light]),
+        "👩🏼‍🎨": (.femaleArtist, [.mediumLight]),
+        "👩🏽‍🎨": (.femaleArtist, [.medium]),
+        "👩🏾‍🎨": (.femaleArtist, [.mediumDark]),
+        "👩🏿‍🎨": (.femaleArtist, [.dark]),
+        "🧑🏻‍✈️": (.pilot, [.light]),
+        "🧑🏼‍✈️": (.pilot, [.mediumLight]),
+        "🧑🏽‍✈️": (.pilot, [.medium]),
+        "🧑🏾‍✈️": (.pilot, [.mediumDark]),
+        "🧑🏿‍✈️": (.pilot, [.dark]),
+        "👨🏻‍✈️": (.malePilot, [.light]),
+        "👨🏼‍✈️": (.malePilot, [.mediumLight]),
+        "👨🏽‍✈️": (.malePilot, [.medium]),
+        "👨🏾‍✈️": (.malePilot, [.mediumDark]),
+        "👨🏿‍✈️": (.malePilot, [.dark]),
+        "👩🏻‍✈️": (.femalePilot, [.light]),
+        "👩🏼‍✈️": (.femalePilot, [.mediumLight]),
+        "👩🏽‍✈️": (.femalePilot, [.medium]),
+        "👩🏾‍✈️": (.femalePilot, [.mediumDark]),
+        "👩🏿‍✈️": (.femalePilot, [.dark]),
+        "🧑🏻‍🚀": (.astronaut, [.light]),
+        "🧑🏼‍🚀": (.astronaut, [.mediumLight]),
+        "🧑🏽‍🚀": (.astronaut, [.medium]),
+        "🧑🏾‍🚀": (.astronaut, [.mediumDark]),
+        "🧑🏿‍🚀": (.astronaut, [.dark]),
+        "👨🏻‍🚀": (.maleAstronaut, [.light]),
+        "👨🏼‍🚀": (.maleAstronaut, [.mediumLight]),
+        "👨🏽‍🚀": (.maleAstronaut, [.medium]),
+        "👨🏾‍🚀": (.maleAstronaut, [.mediumDark]),
+        "👨🏿‍🚀": (.maleAstronaut, [.dark]),
+        "👩🏻‍🚀": (.femaleAstronaut, [.light]),
+        "👩🏼‍🚀": (.femaleAstronaut, [.mediumLight]),
+        "👩🏽‍🚀": (.femaleAstronaut, [.medium]),
+        "👩🏾‍🚀": (.femaleAstronaut, [.mediumDark]),
+        "👩🏿‍🚀": (.femaleAstronaut, [.dark]),
+        "🧑🏻‍🚒": (.firefighter, [.light]),
+        "🧑🏼‍🚒": (.firefighter, [.mediumLight]),
+        "🧑🏽‍🚒": (.firefighter, [.medium]),
+        "🧑🏾‍🚒": (.firefighter, [.mediumDark]),
+        "🧑🏿‍🚒": (.firefighter, [.dark]),
+        "👨🏻‍🚒": (.maleFirefighter, [.light]),
+        "👨🏼‍🚒": (.maleFirefighter, [.mediumLight]),
+        "👨🏽‍🚒": (.maleFirefighter, [.medium]),
+        "👨🏾‍🚒": (.maleFirefighter, [.mediumDark]),
+        "👨🏿‍🚒": (.maleFirefighter, [.dark]),
+        "👩🏻‍🚒": (.femaleFirefighter, [.light]),
+        "👩🏼‍🚒": (.femaleFirefighter, [.mediumLight]),
+        "👩🏽‍🚒": (.femaleFirefighter, [.medium]),
+        "👩🏾‍🚒": (.femaleFirefighter, [.mediumDark]),
+        "👩🏿‍🚒": (.femaleFirefighter, [.dark]),
+        "👮🏻": (.cop, [.light]),
+        "👮🏼": (.cop, [.mediumLight]),
+        "👮🏽": (.cop, [.medium]),
+        "👮🏾": (.cop, [.mediumDark]),
+        "👮🏿": (.cop, [.dark]),
+        "👮🏻‍♂️": (.malePoliceOfficer, [.light]),
+        "👮🏼‍♂️": (.malePoliceOfficer, [.mediumLight]),
+        "👮🏽‍♂️": (.malePoliceOfficer, [.medium]),
+        "👮🏾‍♂️": (.malePoliceOfficer, [.mediumDark]),
+        "👮🏿‍♂️": (.malePoliceOfficer, [.dark]),
+        "👮🏻‍♀️": (.femalePoliceOfficer, [.light]),
+        "👮🏼‍♀️": (.femalePoliceOfficer, [.mediumLight]),
+        "👮🏽‍♀️": (.femalePoliceOfficer, [.medium]),
+        "👮🏾‍♀️": (.femalePoliceOfficer, [.mediumDark]),
+        "👮🏿‍♀️": (.femalePoliceOfficer, [.dark]),
+        "🕵🏻": (.sleuthOrSpy, [.light]),
+        "🕵🏼": (.sleuthOrSpy, [.mediumLight]),
+        "🕵🏽": (.sleuthOrSpy, [.medium]),
+        "🕵🏾": (.sleuthOrSpy, [.mediumDark]),
+        "🕵🏿": (.sleuthOrSpy, [.dark]),
+        "🕵🏻‍♂️": (.maleDetective, [.light]),
+        "🕵🏼‍♂️": (.maleDetective, [.mediumLight]),
+        "🕵🏽‍♂️": (.maleDetective, [.medium]),
+        "🕵🏾‍♂️": (.maleDetective, [.mediumDark]),
+        "🕵🏿‍♂️": (.maleDetective, [.dark]),
+        "🕵🏻‍♀️": (.femaleDetective, [.light]),
+        "🕵🏼‍♀️": (.femaleDetective, [.mediumLight]),
+        "🕵🏽‍♀️": (.femaleDetective, [.medium]),
+        "🕵🏾‍♀️": (.femaleDetective, [.mediumDark]),
+        "🕵🏿‍♀️": (.femaleDetective, [.dark]),
+        "💂🏻": (.guardsman, [.light]),
+        "💂🏼": (.guardsman, [.mediumLight]),
+        "💂🏽": (.guardsman, [.medium]),
+        "💂🏾": (.guardsman, [.mediumDark]),
+        "💂🏿": (.guardsman, [.dark]),
+        "💂🏻‍♂️": (.maleGuard, [.light]),
+        "💂🏼‍♂️": (.maleGuard, [.mediumLight]),
+        "💂🏽‍♂️": (.maleGuard, [.medium]),
+        "💂🏾‍♂️": (.maleGuard, [.mediumDark]),
+        "💂🏿‍♂️": (.maleGuard, [.dark]),
+        "💂🏻‍♀️": (.femaleGuard, [.light]),
+        "💂🏼‍♀️": (.femaleGuard, [.mediumLight]),
+        "💂🏽‍♀️": (.femaleGuard, [.medium]),
+        "💂🏾‍♀️": (.femaleGuard, [.mediumDark]),
+        "💂🏿‍♀️": (.femaleGuard, [.dark]),
+        "🥷🏻": (.ninja, [.light]),
+        "🥷🏼": (.ninja, [.mediumLight]),
+        "🥷🏽": (.ninja, [.medium]),
+        "🥷🏾": (.ninja, [.mediumDark]),
+        "🥷🏿": (.ninja, [.dark]),
+        "👷🏻": (.constructionWorker, [.light]),
+        "👷🏼": (.constructionWorker, [.mediumLight]),
+        "👷🏽": (.constructionWorker, [.medium]),
+        "👷🏾": (.constructionWorker, [.mediumDark]),
+        "👷🏿": (.constructionWorker, [.dark]),
+        "👷🏻‍♂️": (.maleConstructionWorker, [.light]),
+        "👷🏼‍♂️": (.maleConstructionWorker, [.mediumLight]),
+        "👷🏽‍♂️": (.maleConstructionWorker, [.medium]),
+        "👷🏾‍♂️": (.maleConstructionWorker, [.mediumDark]),
+        "👷🏿‍♂️": (.maleConstructionWorker, [.dark]),
+        "👷🏻‍♀️": (.femaleConstructionWorker, [.light]),
+        "👷🏼‍♀️": (.femaleConstructionWorker, [.mediumLight]),
+        "👷🏽‍♀️": (.femaleConstructionWorker, [.medium]),
+        "👷🏾‍♀️": (.femaleConstructionWorker, [.mediumDark]),
+        "👷🏿‍♀️": (.femaleConstructionWorker, [.dark]),
+        "🫅🏻": (.personWithCrown, [.light]),
+        "🫅🏼": (.personWithCrown, [.mediumLight]),
+        "🫅🏽": (.personWithCrown, [.medium]),
+        "🫅🏾": (.personWithCrown, [.mediumDark]),
+        "🫅🏿": (.personWithCrown, [.dark]),
+        "🤴🏻": (.prince, [.light]),
+        "🤴🏼": (.prince, [.mediumLight]),
+        "🤴🏽": (.prince, [.medium]),
+        "🤴🏾": (.prince, [.mediumDark]),
+        "🤴🏿": (.prince, [.dark]),
+        "👸🏻": (.princess, [.light]),
+        "👸🏼": (.princess, [.mediumLight]),
+        "👸🏽": (.princess, [.medium]),
+        "👸🏾": (.princess, [.mediumDark]),
+        "👸🏿": (.princess, [.dark]),
+        "👳🏻": (.manWithTurban, [.light]),
+        "👳🏼": (.manWithTurban, [.mediumLight]),
+        "👳🏽": (.manWithTurban, [.medium]),
+        "👳🏾": (.manWithTurban, [.mediumDark]),
+        "👳🏿": (.manWithTurban, [.dark]),
+        "👳🏻‍♂️": (.manWearingTurban, [.light]),
+        "👳🏼‍♂️": (.manWearingTurban, [.mediumLight]),
+        "👳🏽‍♂️": (.manWearingTurban, [.medium]),
+        "👳🏾‍♂️": (.manWearingTurban, [.mediumDark]),
+        "👳🏿‍♂️": (.manWearingTurban, [.dark]),
+        "👳🏻‍♀️": (.womanWearingTurban, [.light]),
+        "👳🏼‍♀️": (.womanWearingTurban, [.mediumLight]),
+        "👳🏽‍♀️": (.womanWearingTurban, [.medium]),
+        "👳🏾‍♀️": (.womanWearingTurban, [.mediumDark]),
+        "👳🏿‍♀️": (.womanWearingTurban, [.dark]),
+        "👲🏻": (.manWithGuaPiMao, [.light]),
+        "👲🏼": (.manWithGuaPiMao, [.mediumLight]),
+        "👲🏽": (.manWithGuaPiMao, [.medium]),
+        "👲🏾": (.manWithGuaPiMao, [.mediumDark]),
+        "👲🏿": (.manWithGuaPiMao, [.dark]),
+        "🧕🏻": (.personWithHeadscarf, [.light]),
+        "🧕🏼": (.personWithHeadscarf, [.mediumLight]),
+        "🧕🏽": (.personWithHeadscarf, [.medium]),
+        "🧕🏾": (.personWithHeadscarf, [.mediumDark]),
+        "🧕🏿": (.personWithHeadscarf, [.dark]),
+        "🤵🏻": (.personInTuxedo, [.light]),
+        "🤵🏼": (.personInTuxedo, [.mediumLight]),
+        "🤵🏽": (.personInTuxedo, [.medium]),
+        "🤵🏾": (.personInTuxedo, [.mediumDark]),
+        "🤵🏿": (.personInTuxedo, [.dark]),
+        "🤵🏻‍♂️": (.manInTuxedo, [.light]),
+        "🤵🏼‍♂️": (.manInTuxedo, [.mediumLight]),
+        "🤵🏽‍♂️": (.manInTuxedo, [.medium]),
+        "🤵🏾‍♂️": (.manInTuxedo, [.mediumDark]),
+        "🤵🏿‍♂️": (.manInTuxedo, [.dark]),
+        "🤵🏻‍♀️": (.womanInTuxedo, [.light]),
+        "🤵🏼‍♀️": (.womanInTuxedo, [.mediumLight]),
+        "🤵🏽‍♀️": (.womanInTuxedo, [.medium]),
+        "🤵🏾‍♀️": (.womanInTuxedo, [.mediumDark]),
+        "🤵🏿‍♀️": (.womanInTuxedo, [.dark]),
+        "👰🏻": (.brideWithVeil, [.light]),
+        "👰🏼": (.brideWithVeil, [.mediumLight]),
+        "👰🏽": (.brideWithVeil, [.medium]),
+        "👰🏾": (.brideWithVeil, [.mediumDark]),
+        "👰🏿": (.brideWithVeil, [.dark]),
+        "👰🏻‍♂️": (.manWithVeil, [.light]),
+        "👰🏼‍♂️": (.manWithVeil, [.mediumLight]),
+        "👰🏽‍♂️": (.manWithVeil, [.medium]),
+        "👰🏾‍♂️": (.manWithVeil, [.mediumDark]),
+        "👰🏿‍♂️": (.manWithVeil, [.dark]),
+        "👰🏻‍♀️": (.womanWithVeil, [.light]),
+        "👰🏼‍♀️": (.womanWithVeil, [.mediumLight]),
+        "👰🏽‍♀️": (.womanWithVeil, [.medium]),
+        "👰🏾‍♀️": (.womanWithVeil, [.mediumDark]),
+        "👰🏿‍♀️": (.womanWithVeil, [.dark]),
+        "🤰🏻": (.pregnantWoman, [.light]),
+        "🤰🏼": (.pregnantWoman, [.mediumLight]),
+        "🤰🏽": (.pregnantWoman, [.medium]),
+        "🤰🏾": (.pregnantWoman, [.mediumDark]),
+        "🤰🏿": (.pregnantWoman, [.dark]),
+        "🫃🏻": (.pregnantMan, [.light]),
+        "🫃🏼": (.pregnantMan, [.mediumLight]),
+        "🫃🏽": (.pregnantMan, [.medium]),
+        "🫃🏾": (.pregnantMan, [.mediumDark]),
+        "🫃🏿": (.pregnantMan, [.dark]),
+        "🫄🏻": (.pregnantPerson, [.light]),
+        "🫄🏼": (.pregnantPerson, [.mediumLight]),
+        "🫄🏽": (.pregnantPerson, [.medium]),
+        "🫄🏾": (.pregnantPerson, [.mediumDark]),
+        "🫄🏿": (.pregnantPerson, [.dark]),
+        "🤱🏻": (.breastFeeding, [.light]),
+        "🤱🏼": (.breastFeeding, [.mediumLight]),
+        "🤱🏽": (.breastFeeding, [.medium]),
+        "🤱🏾": (.breastFeeding, [.mediumDark]),
+        "🤱🏿": (.breastFeeding, [.dark]),
+        "👩🏻‍🍼": (.womanFeedingBaby, [.light]),
+        "👩🏼‍🍼": (.womanFeedingBaby, [.mediumLight]),
+        "👩🏽‍🍼": (.womanFeedingBaby, [.medium]),
+        "👩🏾‍🍼": (.womanFeedingBaby, [.mediumDark]),
+        "👩🏿‍🍼": (.womanFeedingBaby, [.dark]),
+        "👨🏻‍🍼": (.manFeedingBaby, [.light]),
+        "👨🏼‍🍼": (.manFeedingBaby, [.mediumLight]),
+        "👨🏽‍🍼": (.manFeedingBaby, [.medium]),
+        "👨🏾‍🍼": (.manFeedingBaby, [.mediumDark]),
+        "👨🏿‍🍼": (.manFeedingBaby, [.dark]),
+        "🧑🏻‍🍼": (.personFeedingBaby, [.light]),
+        "🧑🏼‍🍼": (.personFeedingBaby, [.mediumLight]),
+        "🧑🏽‍🍼": (.personFeedingBaby, [.medium]),
+        "🧑🏾‍🍼": (.personFeedingBaby, [.mediumDark]),
+        "🧑🏿‍🍼": (.personFeedingBaby, [.dark]),
+        "👼🏻": (.angel, [.light]),
+        "👼🏼": (.angel, [.mediumLight]),
+        "👼🏽": (.angel, [.medium]),
+        "👼🏾": (.angel, [.mediumDark]),
+        "👼🏿": (.angel, [.dark]),
+        "🎅🏻": (.santa, [.light]),
+        "🎅🏼": (.santa, [.mediumLight]),
+        "🎅🏽": (.santa, [.medium]),
+        "🎅🏾": (.santa, [.mediumDark]),
+        "🎅🏿": (.santa, [.dark]),
+        "🤶🏻": (.mrsClaus, [.light]),
+        "🤶🏼": (.mrsClaus, [.mediumLight]),
+        "🤶🏽": (.mrsClaus, [.medium]),
+        "🤶🏾": (.mrsClaus, [.mediumDark]),
+        "🤶🏿": (.mrsClaus, [.dark]),
+        "🧑🏻‍🎄": (.mxClaus, [.light]),
+        "🧑🏼‍🎄": (.mxClaus, [.mediumLight]),
+        "🧑🏽‍🎄": (.mxClaus, [.medium]),
+        "🧑🏾‍🎄": (.mxClaus, [.mediumDark]),
+        "🧑🏿‍🎄": (.mxClaus, [.dark]),
+        "🦸🏻": (.superhero, [.light]),
+        "🦸🏼": (.superhero, [.mediumLight]),
+        "🦸🏽": (.superhero, [.medium]),
+        "🦸🏾": (.superhero, [.mediumDark]),
+        "🦸🏿": (.superhero, [.dark]),
+        "🦸🏻‍♂️": (.maleSuperhero, [.light]),
+        "🦸🏼‍♂️": (.maleSuperhero, [.mediumLight]),
+        "🦸🏽‍♂️": (.maleSuperhero, [.medium]),
+        "🦸🏾‍♂️": (.maleSuperhero, [.mediumDark]),
+        "🦸🏿‍♂️": (.maleSuperhero, [.dark]),
+        "🦸🏻‍♀️": (.femaleSuperhero, [.light]),
+        "🦸🏼‍♀️": (.femaleSuperhero, [.mediumLight]),
+        "🦸🏽‍♀️": (.femaleSuperhero, [.medium]),
+        "🦸🏾‍♀️": (.femaleSuperhero, [.mediumDark]),
+        "🦸🏿‍♀️": (.femaleSuperhero, [.dark]),
+        "🦹🏻": (.supervillain, [.light]),
+        "🦹🏼": (.supervillain, [.mediumLight]),
+        "🦹🏽": (.supervillain, [.medium]),
+        "🦹🏾": (.supervillain, [.mediumDark]),
+        "🦹🏿": (.supervillain, [.dark]),
+        "🦹🏻‍♂️": (.maleSupervillain, [.light]),
+        "🦹🏼‍♂️": (.maleSupervillain, [.mediumLight]),
+        "🦹🏽‍♂️": (.maleSupervillain, [.medium]),
+        "🦹🏾‍♂️": (.maleSupervillain, [.mediumDark]),
+        "🦹🏿‍♂️": (.maleSupervillain, [.dark]),
+        "🦹🏻‍♀️": (.femaleSupervillain, [.light]),
+        "🦹🏼‍♀️": (.femaleSupervillain, [.mediumLight]),
+        "🦹🏽‍♀️": (.femaleSupervillain, [.medium]),
+        "🦹🏾‍♀️": (.femaleSupervillain, [.mediumDark]),
+        "🦹🏿‍♀️": (.femaleSupervillain, [.dark]),
+        "🧙🏻": (.mage, [.light]),
+        "🧙🏼": (.mage, [.mediumLight]),
+        "🧙🏽": (.mage, [.medium]),
+        "🧙🏾": (.mage, [.mediumDark]),
+        "🧙🏿": (.mage, [.dark]),
+        "🧙🏻‍♂️": (.maleMage, [.light]),
+        "🧙🏼‍♂️": (.maleMage, [.mediumLight]),
+        "🧙🏽‍♂️": (.maleMage, [.medium]),
+        "🧙🏾‍♂️": (.maleMage, [.mediumDark]),
+        "🧙🏿‍♂️": (.maleMage, [.dark]),
+        "🧙🏻‍♀️": (.femaleMage, [.light]),
+        "🧙🏼‍♀️": (.femaleMage, [.mediumLight]),
+        "🧙🏽‍♀️": (.femaleMage, [.medium]),
+        "🧙🏾‍♀️": (.femaleMage, [.mediumDark]),
+        "🧙🏿‍♀️": (.femaleMage, [.dark]),
+        "🧚🏻": (.fairy, [.light]),
+        "🧚🏼": (.fairy, [.mediumLight]),
+        "🧚🏽": (.fairy, [.medium]),
+        "🧚🏾": (.fairy, [.mediumDark]),
+        "🧚🏿": (.fairy, [.dark]),
+        "🧚🏻‍♂️": (.maleFairy, [.light]),
+        "🧚🏼‍♂️": (.maleFairy, [.mediumLight]),
+        "🧚🏽‍♂️": (.maleFairy, [.medium]),
+        "🧚🏾‍♂️": (.maleFairy, [.mediumDark]),
+        "🧚🏿‍♂️": (.maleFairy, [.dark]),
+        "🧚🏻‍♀️": (.femaleFairy, [.light]),
+        "🧚🏼‍♀️": (.femaleFairy, [.mediumLight]),
+        "🧚🏽‍♀️": (.femaleFairy, [.medium]),
+        "🧚🏾‍♀️": (.femaleFairy, [.mediumDark]),
+        "🧚🏿‍♀️": (.femaleFairy, [.dark]),
+        "🧛🏻": (.vampire, [.light]),
+        "🧛🏼": (.vampire, [.mediumLight]),
+        "🧛🏽": (.vampire, [.medium]),
+        "🧛🏾": (.vampire, [.mediumDark]),
+        "🧛🏿": (.vampire, [.dark]),
+        "🧛🏻‍♂️": (.maleVampire, [.light]),
+        "🧛🏼‍♂️": (.maleVampire, [.mediumLight]),
+        "🧛🏽‍♂️": (.maleVampire, [.medium]),
+        "🧛🏾‍♂️": (.maleVampire, [.mediumDark]),
+        "🧛🏿‍♂️": (.maleVampire, [.dark]),
+        "🧛🏻‍♀️": (.femaleVampire, [.light]),
+        "🧛🏼‍♀️": (.femaleVampire, [.mediumLight]),
+        "🧛🏽‍♀️": (.femaleVampire, [.medium]),
+        "🧛🏾‍♀️": (.femaleVampire, [.mediumDark]),
+        "🧛🏿‍♀️": (.femaleVampire, [.dark]),
+        "🧜🏻": (.merperson, [.light]),
+        "🧜🏼": (.merperson, [.mediumLight]),
+        "🧜🏽": (.merperson, [.medium]),
+        "🧜🏾": (.merperson, [.mediumDark]),
+        "🧜🏿": (.merperson, [.dark]),
+        "🧜🏻‍♂️": (.merman, [.light]),
+        "🧜🏼‍♂️": (.merman, [.mediumLight]),
+        "🧜🏽‍♂️": (.merman, [.medium]),
+        "🧜🏾‍♂️": (.merman, [.mediumDark]),
+        "🧜🏿‍♂️": (.merman, [.dark]),
+        "🧜🏻‍♀️": (.mermaid, [.light]),
+        "🧜🏼‍♀️": (.mermaid, [.mediumLight]),
+        "🧜🏽‍♀️": (.mermaid, [.medium]),
+        "🧜🏾‍♀️": (.mermaid, [.mediumDark]),
+        "🧜🏿‍♀️": (.mermaid, [.dark]),
+        "🧝🏻": (.elf, [.light]),
+        "🧝🏼": (.elf, [.mediumLight]),
+        "🧝🏽": (.elf, [.medium]),
+        "🧝🏾": (.elf, [.mediumDark]),
+        "🧝🏿": (.elf, [.dark]),
+        "🧝🏻‍♂️": (.maleElf, [.light]),
+        "🧝🏼‍♂️": (.maleElf, [.mediumLight]),
+        "🧝🏽‍♂️": (.maleElf, [.medium]),
+        "🧝🏾‍♂️": (.maleElf, [.mediumDark]),
+        "🧝🏿‍♂️": (.maleElf, [.dark]),
+        "🧝🏻‍♀️": (.femaleElf, [.light]),
+        "🧝🏼‍♀️": (.femaleElf, [.mediumLight]),
+        "🧝🏽‍♀️": (.femaleElf, [.medium]),
+        "🧝🏾‍♀️": (.femaleElf, [.mediumDark]),
+        "🧝🏿‍♀️": (.femaleElf, [.dark]),
+        "💆🏻": (.massage, [.light]),
+        "💆🏼": (.massage, [.mediumLight]),
+        "💆🏽": (.massage, [.medium]),
+        "💆🏾": (.massage, [.mediumDark]),
+        "💆🏿": (.massage, [.dark]),
+        "💆🏻‍♂️": (.manGettingMassage, [.light]),
+        "💆🏼‍♂️": (.manGettingMassage, [.mediumLight]),
+        "💆🏽‍♂️": (.manGettingMassage, [.medium]),
+        "💆🏾‍♂️": (.manGettingMassage, [.mediumDark]),
+        "💆🏿‍♂️": (.manGettingMassage, [.dark]),
+        "💆🏻‍♀️": (.womanGettingMassage, [.light]),
+        "💆🏼‍♀️": (.womanGettingMassage, [.mediumLight]),
+        "💆🏽‍♀️": (.womanGettingMassage, [.medium]),
+        "💆🏾‍♀️": (.womanGettingMassage, [.mediumDark]),
+        "💆🏿‍♀️": (.womanGettingMassage, [.dark]),
+        "💇🏻": (.haircut, [.light]),
+        "💇🏼": (.haircut, [.mediumLight]),
+        "💇🏽": (.haircut, [.medium]),
+        "💇🏾": (.haircut, [.mediumDark]),
+        "💇🏿": (.haircut, [.dark]),
+        "💇🏻‍♂️": (.manGettingHaircut, [.light]),
+        "💇🏼‍♂️": (.manGettingHaircut, [.mediumLight]),
+        "💇🏽‍♂️": (.manGettingHaircut, [.medium]),
+        "💇🏾‍♂️": (.manGettingHaircut, [.mediumDark]),
+        "💇🏿‍♂️": (.manGettingHaircut, [.dark]),
+        "💇🏻‍♀️": (.womanGettingHaircut, [.light]),
+        "💇🏼‍♀️": (.womanGettingHaircut, [.mediumLight]),
+        "💇🏽‍♀️": (.womanGettingHaircut, [.medium]),
+        "💇🏾‍♀️": (.womanGettingHaircut, [.mediumDark]),
+        "💇🏿‍♀️": (.womanGettingHaircut, [.dark]),
+        "🚶🏻": (.walking, [.light]),
+        "🚶🏼": (.walking, [.mediumLight]),
+        "🚶🏽": (.walking, [.medium]),
+        "🚶🏾": (.walking, [.mediumDark]),
+        "🚶🏿": (.walking, [.dark]),
+        "🚶🏻‍♂️": (.manWalking, [.light]),
+        "🚶🏼‍♂️": (.manWalking, [.mediumLight]),
+        "🚶🏽‍♂️": (.manWalking, [.medium]),
+        "🚶🏾‍♂️": (.manWalking, [.mediumDark]),
+        "🚶🏿‍♂️": (.manWalking, [.dark]),
+        "🚶🏻‍♀️": (.womanWalking, [.light]),
+        "🚶🏼‍♀️": (.womanWalking, [.mediumLight]),
+        "🚶🏽‍♀️": (.womanWalking, [.medium]),
+        "🚶🏾‍♀️": (.womanWalking, [.mediumDark]),
+        "🚶🏿‍♀️": (.womanWalking, [.dark]),
+        "🚶🏻‍➡️": (.personWalkingFacingRight, [.light]),
+        "🚶🏼‍➡️": (.personWalkingFacingRight, [.mediumLight]),
+        "🚶🏽‍➡️": (.personWalkingFacingRight, [.medium]),
+        "🚶🏾‍➡️": (.personWalkingFacingRight, [.mediumDark]),
+        "🚶🏿‍➡️": (.personWalkingFacingRight, [.dark]),
+        "🚶🏻‍♀️‍➡️": (.womanWalkingFacingRight, [.light]),
+        "🚶🏼‍♀️‍➡️": (.womanWalkingFacingRight, [.mediumLight]),
+        "🚶🏽‍♀️‍➡️": (.womanWalkingFacingRight, [.medium]),
+        "🚶🏾‍♀️‍➡️": (.womanWalkingFacingRight, [.mediumDark]),
+        "🚶🏿‍♀️‍➡️": (.womanWalkingFacingRight, [.dark]),
+        "🚶🏻‍♂️‍➡️": (.manWalkingFacingRight, [.light]),
+        "🚶🏼‍♂️‍➡️": (.manWalkingFacingRight, [.mediumLight]),
+        "🚶🏽‍♂️‍➡️": (.manWalkingFacingRight, [.medium]),
+        "🚶🏾‍♂️‍➡️": (.manWalkingFacingRight, [.mediumDark]),
+        "🚶🏿‍♂️‍➡️": (.manWalkingFacingRight, [.dark]),
+        "🧍🏻": (.standingPerson, [.light]),
+        "🧍🏼": (.standingPerson, [.mediumLight]),
+        "🧍🏽": (.standingPerson, [.medium]),
+        "🧍🏾": (.standingPerson, [.mediumDark]),
+        "🧍🏿": (.standingPerson, [.dark]),
+        "🧍🏻‍♂️": (.manStanding, [.light]),
+        "🧍🏼‍♂️": (.manStanding, [.mediumLight]),
+        "🧍🏽‍♂️": (.manStanding, [.medium]),
+        "🧍🏾‍♂️": (.manStanding, [.mediumDark]),
+        "🧍🏿‍♂️": (.manStanding, [.dark]),
+        "🧍🏻‍♀️": (.womanStanding, [.light]),
+        "🧍🏼‍♀️": (.womanStanding, [.mediumLight]),
+        "🧍🏽‍♀️": (.womanStanding, [.medium]),
+        "🧍🏾‍♀️": (.womanStanding, [.mediumDark]),
+        "🧍🏿‍♀️": (.womanStanding, [.dark]),
+        "🧎🏻": (.kneelingPerson, [.light]),
+        "🧎🏼": (.kneelingPerson, [.mediumLight]),
+        "🧎🏽": (.kneelingPerson, [.medium]),
+        "🧎🏾": (.kneelingPerson, [.mediumDark]),
+        "🧎🏿": (.kneelingPerson, [.dark]),
+        "🧎🏻‍♂️": (.manKneeling, [.light]),
+        "🧎🏼‍♂️": (.manKneeling, [.mediumLight]),
+        "🧎🏽‍♂️": (.manKneeling, [.medium]),
+        "🧎🏾‍♂️": (.manKneeling, [.mediumDark]),
+        "🧎🏿‍♂️": (.manKneeling, [.dark]),
+        "🧎🏻‍♀️": (.womanKneeling, [.light]),
+        "🧎🏼‍♀️": (.womanKneeling, [.mediumLight]),
+        "🧎🏽‍♀️": (.womanKneeling, [.medium]),
+        "🧎🏾‍♀️": (.womanKneeling, [.mediumDark]),
+        "🧎🏿‍♀️": (.womanKneeling, [.dark]),
+        "🧎🏻‍➡️": (.personKneelingFacingRight, [.light]),
+        "🧎🏼‍➡️": (.personKneelingFacingRight, [.mediumLight]),
+        "🧎🏽‍➡️": (.personKneelingFacingRight, [.medium]),
+        "🧎🏾‍➡️": (.personKneelingFacingRight, [.mediumDark]),
+        "🧎🏿‍➡️": (.personKneelingFacingRight, [.dark]),
+        "🧎🏻‍♀️‍➡️": (.womanKneelingFacingRight, [.light]),
+        "🧎🏼‍♀️‍➡️": (.womanKneelingFacingRight, [.mediumLight]),
+        "🧎🏽‍♀️‍➡️": (.womanKneelingFacingRight, [.medium]),
+        "🧎🏾‍♀️‍➡️": (.womanKneelingFacingRight, [.mediumDark]),
+        "🧎🏿‍♀️‍➡️": (.womanKneelingFacingRight, [.dark]),
+        "🧎🏻‍♂️‍➡️": (.manKneelingFacingRight, [.light]),
+        "🧎🏼‍♂️‍➡️": (.manKneelingFacingRight, [.mediumLight]),
+        "🧎🏽‍♂️‍➡️": (.manKneelingFacingRight, [.medium]),
+        "🧎🏾‍♂️‍➡️": (.manKneelingFacingRight, [.mediumDark]),
+        "🧎🏿‍♂️‍➡️": (.manKneelingFacingRight, [.dark]),
+        "🧑🏻‍🦯": (.personWithProbingCane, [.light]),
+        "🧑🏼‍🦯": (.personWithProbingCane, [.mediumLight]),
+        "🧑🏽‍🦯": (.personWithProbingCane, [.medium]),
+        "🧑🏾‍🦯": (.personWithProbingCane, [.mediumDark]),
+        "🧑🏿‍🦯": (.personWithProbingCane, [.dark]),
+        "🧑🏻‍🦯‍➡️": (.personWithWhiteCaneFacingRight, [.light]),
+        "🧑🏼‍🦯‍➡️": (.personWithWhiteCaneFacingRight, [.mediumLight]),
+        "🧑🏽‍🦯‍➡️": (.personWithWhiteCaneFacingRight, [.medium]),
+        "🧑🏾‍🦯‍➡️": (.personWithWhiteCaneFacingRight, [.mediumDark]),
+        "🧑🏿‍🦯‍➡️": (.personWithWhiteCaneFacingRight, [.dark]),
+        "👨🏻‍🦯": (.manWithProbingCane, [.light]),
+        "👨🏼‍🦯": (.manWithProbingCane, [.mediumLight]),
+        "👨🏽‍🦯": (.manWithProbingCane, [.medium]),
+        "👨🏾‍🦯": (.manWithProbingCane, [.mediumDark]),
+        "👨🏿‍🦯": (.manWithProbingCane, [.dark]),
+        "👨🏻‍🦯‍➡️": (.manWithWhiteCaneFacingRight, [.light]),
+        "👨🏼‍🦯‍➡️": (.manWithWhiteCaneFacingRight, [.mediumLight]),
+        "👨🏽‍🦯‍➡️": (.manWithWhiteCaneFacingRight, [.medium]),
+        "👨🏾‍🦯‍➡️": (.manWithWhiteCaneFacingRight, [.mediumDark]),
+        "👨🏿‍🦯‍➡️": (.manWithWhiteCaneFacingRight, [.dark]),
+        "👩🏻‍🦯": (.womanWithProbingCane, [.light]),
+        "👩🏼‍🦯": (.womanWithProbingCane, [.mediumLight]),
+        "👩🏽‍🦯": (.womanWithProbingCane, [.medium]),
+        "👩🏾‍🦯": (.womanWithProbingCane, [.mediumDark]),
+        "👩🏿‍🦯": (.womanWithProbingCane, [.dark]),
+        "👩🏻‍🦯‍➡️": (.womanWithWhiteCaneFacingRight, [.light]),
+        "👩🏼‍🦯‍➡️": (.womanWithWhiteCaneFacingRight, [.mediumLight]),
+        "👩🏽‍🦯‍➡️": (.womanWithWhiteCaneFacingRight, [.medium]),
+        "👩🏾‍🦯‍➡️": (.womanWithWhiteCaneFacingRight, [.mediumDark]),
+        "👩🏿‍🦯‍➡️": (.womanWithWhiteCaneFacingRight, [.dark]),
+        "🧑🏻‍🦼": (.personInMotorizedWheelchair, [.light]),
+        "🧑🏼‍🦼": (.personInMotorizedWheelchair, [.mediumLight]),
+        "🧑🏽‍🦼": (.personInMotorizedWheelchair, [.medium]),
+        "🧑🏾‍🦼": (.personInMotorizedWheelchair, [.mediumDark]),
+        "🧑🏿‍🦼": (.personInMotorizedWheelchair, [.dark]),
+        "🧑🏻‍🦼‍➡️": (.personInMotorizedWheelchairFacingRight, [.light]),
+        "🧑🏼‍🦼‍➡️": (.personInMotorizedWheelchairFacingRight, [.mediumLight]),
+        "🧑🏽‍🦼‍➡️": (.personInMotorizedWheelchairFacingRight, [.medium]),
+        "🧑🏾‍🦼‍➡️": (.personInMotorizedWheelchairFacingRight, [.mediumDark]),
+        "🧑🏿‍🦼‍➡️": (.personInMotorizedWheelchairFacingRight, [.dark]),
+        "👨🏻‍🦼": (.manInMotorizedWheelchair, [.light]),
+        "👨🏼‍🦼": (.manInMotorizedWheelchair, [.mediumLight]),
+        "👨🏽‍🦼": (.manInMotorizedWheelchair, [.medium]),
+        "👨🏾‍🦼": (.manInMotorizedWheelchair, [.mediumDark]),
+        "👨🏿‍🦼": (.manInMotorizedWheelchair, [.dark]),
+        "👨🏻‍🦼‍➡️": (.manInMotorizedWheelchairFacingRight, [.light]),
+        "👨🏼‍🦼‍➡️": (.manInMotorizedWheelchairFacingRight, [.mediumLight]),
+        "👨🏽‍🦼‍➡️": (.manInMotorizedWheelchairFacingRight, [.medium]),
+        "👨🏾‍🦼‍➡️": (.manInMotorizedWheelchairFacingRight, [.mediumDark]),
+        "👨🏿‍🦼‍➡️": (.manInMotorizedWheelchairFacingRight, [.dark]),
+        "👩🏻‍🦼": (.womanInMotorizedWheelchair, [.light]),
+        "👩🏼‍🦼": (.womanInMotorizedWheelchair, [.mediumLight]),
+        "👩🏽‍🦼": (.womanInMotorizedWheelchair, [.medium]),
+        "👩🏾‍🦼": (.womanInMotorizedWheelchair, [.mediumDark]),
+        "👩🏿‍🦼": (.womanInMotorizedWheelchair, [.dark]),
+        "👩🏻‍🦼‍➡️": (.womanInMotorizedWheelchairFacingRight, [.light]),
+        "👩🏼‍🦼‍➡️": (.womanInMotorizedWheelchairFacingRight, [.mediumLight]),
+        "👩🏽‍🦼‍➡️": (.womanInMotorizedWheelchairFacingRight, [.medium]),
+        "👩🏾‍🦼‍➡️": (.womanInMotorizedWheelchairFacingRight, [.mediumDark]),
+        "👩🏿‍🦼‍➡️": (.womanInMotorizedWheelchairFacingRight, [.dark]),
+        "🧑🏻‍🦽": (.personInManualWheelchair, [.light]),
+        "🧑🏼‍🦽": (.personInManualWheelchair, [.mediumLight]),
+        "🧑🏽‍🦽": (.personInManualWheelchair, [.medium]),
+        "🧑🏾‍🦽": (.personInManualWheelchair, [.mediumDark]),
+        "🧑🏿‍🦽": (.personInManualWheelchair, [.dark]),
+        "🧑🏻‍🦽‍➡️": (.personInManualWheelchairFacingRight, [.light]),
+        "🧑🏼‍🦽‍➡️": (.personInManualWheelchairFacingRight, [.mediumLight]),
+        "🧑🏽‍🦽‍➡️": (.personInManualWheelchairFacingRight, [.medium]),
+        "🧑🏾‍🦽‍➡️": (.personInManualWheelchairFacingRight, [.mediumDark]),
+        "🧑🏿‍🦽‍➡️": (.personInManualWheelchairFacingRight, [.dark]),
+        "👨🏻‍🦽": (.manInManualWheelchair, [.light]),
+        "👨🏼‍🦽": (.manInManualWheelchair, [.mediumLight]),
+        "👨🏽‍🦽": (.manInManualWheelchair, [.medium]),
+        "👨🏾‍🦽": (.manInManualWheelchair, [.mediumDark]),
+        "👨🏿‍🦽": (.manInManualWheelchair, [.dark]),
+        "👨🏻‍🦽‍➡️": (.manInManualWheelchairFacingRight, [.light]),
+        "👨🏼‍🦽‍➡️": (.manInManualWheelchairFacingRight, [.mediumLight]),
+        "👨🏽‍🦽‍➡️": (.manInManualWheelchairFacingRight, [.medium]),
+        "👨🏾‍🦽‍➡️": (.manInManualWheelchairFacingRight, [.mediumDark]),
+        "👨🏿‍🦽‍➡️": (.manInManualWheelchairFacingRight, [.dark]),
+        "👩🏻‍🦽": (.womanInManualWheelchair, [.light]),
+        "👩🏼‍🦽": (.womanInManualWheelchair, [.mediumLight]),
+        "👩🏽‍🦽": (.womanInManualWheelchair, [.medium]),
+        "👩🏾‍🦽": (.womanInManualWheelchair, [.mediumDark]),
+        "👩🏿‍🦽": (.womanInManualWheelchair, [.dark]),
+        "👩🏻‍🦽‍➡️": (.womanInManualWheelchairFacingRight, [.light]),
+        "👩🏼‍🦽‍➡️": (.womanInManualWheelchairFacingRight, [.mediumLight]),
+        "👩🏽‍🦽‍➡️": (.womanInManualWheelchairFacingRight, [.medium]),
+        "👩🏾‍🦽‍➡️": (.womanInManualWheelchairFacingRight, [.mediumDark]),
+        "👩🏿‍🦽‍➡️": (.womanInManualWheelchairFacingRight, [.dark]),
+        "🏃🏻": (.runner, [.light]),
+        "🏃🏼": (.runner, [.mediumLight]),
+        "🏃🏽": (.runner, [.medium]),
+        "🏃🏾": (.runner, [.mediumDark]),
+        "🏃🏿": (.runner, [.dark]),
+        "🏃🏻‍♂️": (.manRunning, [.light]),
+        "🏃🏼‍♂️": (.manRunning, [.mediumLight]),
+        "🏃🏽‍♂️": (.manRunning, [.medium]),
+        "🏃🏾‍♂️": (.manRunning, [.mediumDark]),
+        "🏃🏿‍♂️": (.manRunning, [.dark]),
+        "🏃🏻‍♀️": (.womanRunning, [.light]),
+        "🏃🏼‍♀️": (.womanRunning, [.mediumLight]),
+        "🏃🏽‍♀️": (.womanRunning, [.medium]),
+        "🏃🏾‍♀️": (.womanRunning, [.mediumDark]),
+        "🏃🏿‍♀️": (.womanRunning, [.dark]),
+        "🏃🏻‍➡️": (.personRunningFacingRight, [.light]),
+        "🏃🏼‍➡️": (.personRunningFacingRight, [.mediumLight]),
+        "🏃🏽‍➡️": (.personRunningFacingRight, [.medium]),
+        "🏃🏾‍➡️": (.personRunningFacingRight, [.mediumDark]),
+        "🏃🏿‍➡️": (.personRunningFacingRight, [.dark]),
+        "🏃🏻‍♀️‍➡️": (.womanRunningFacingRight, [.light]),
+        "🏃🏼‍♀️‍➡️": (.womanRunningFacingRight, [.mediumLight]),
+        "🏃🏽‍♀️‍➡️": (.womanRunningFacingRight, [.medium]),
+        "🏃🏾‍♀️‍➡️": (.womanRunningFacingRight, [.mediumDark]),
+        "🏃🏿‍♀️‍➡️": (.womanRunningFacingRight, [.dark]),
+        "🏃🏻‍♂️‍➡️": (.manRunningFacingRight, [.light]),
+        "🏃🏼‍♂️‍➡️": (.manRunningFacingRight, [.mediumLight]),
+        "🏃🏽‍♂️‍➡️": (.manRunningFacingRight, [.medium]),
+        "🏃🏾‍♂️‍➡️": (.manRunningFacingRight, [.mediumDark]),
+        "🏃🏿‍♂️‍➡️": (.manRunningFacingRight, [.dark]),
+        "💃🏻": (.dancer, [.light]),
+        "💃🏼": (.dancer, [.mediumLight]),
+        "💃🏽": (.dancer, [.medium]),
+        "💃🏾": (.dancer, [.mediumDark]),
+        "💃🏿": (.dancer, [.dark]),
+        "🕺🏻": (.manDancing, [.light]),
+        "🕺🏼": (.manDancing, [.mediumLight]),
+        "🕺🏽": (.manDancing, [.medium]),
+        "🕺🏾": (.manDancing, [.mediumDark]),
+        "🕺🏿": (.manDancing, [.dark]),
+        "🕴🏻": (.manInBusinessSuitLevitating, [.light]),
+        "🕴🏼": (.manInBusinessSuitLevitating, [.mediumLight]),
+        "🕴🏽": (.manInBusinessSuitLevitating, [.medium]),
+        "🕴🏾": (.manInBusinessSuitLevitating, [.mediumDark]),
+        "🕴🏿": (.manInBusinessSuitLevitating, [.dark]),
+        "🧖🏻": (.personInSteamyRoom, [.light]),
+        "🧖🏼": (.personInSteamyRoom, [.mediumLight]),
+        "🧖🏽": (.personInSteamyRoom, [.medium]),
+        "🧖🏾": (.personInSteamyRoom, [.mediumDark]),
+        "🧖🏿": (.personInSteamyRoom, [.dark]),
+        "🧖🏻‍♂️": (.manInSteamyRoom, [.light]),
+        "🧖🏼‍♂️": (.manInSteamyRoom, [.mediumLight]),
+        "🧖🏽‍♂️": (.manInSteamyRoom, [.medium]),
+        "🧖🏾‍♂️": (.manInSteamyRoom, [.mediumDark]),
+        "🧖🏿‍♂️": (.manInSteamyRoom, [.dark]),
+        "🧖🏻‍♀️": (.womanInSteamyRoom, [.light]),
+        "🧖🏼‍♀️": (.womanInSteamyRoom, [.mediumLight]),
+        "🧖🏽‍♀️": (.womanInSteamyRoom, [.medium]),
+        "🧖🏾‍♀️": (.womanInSteamyRoom, [.mediumDark]),
+        "🧖🏿‍♀️": (.womanInSteamyRoom, [.dark]),
+        "🧗🏻": (.personClimbing, [.light]),
+        "🧗🏼": (.personClimbing, [.mediumLight]),
+        "🧗🏽": (.personClimbing, [.medium]),
+        "🧗🏾": (.personClimbing, [.mediumDark]),
+        "🧗🏿": (.personClimbing, [.dark]),
+        "🧗🏻‍♂️": (.manClimbing, [.light]),
+        "🧗🏼‍♂️": (.manClimbing, [.mediumLight]),
+        "🧗🏽‍♂️": (.manClimbing, [.medium]),
+        "🧗🏾‍♂️": (.manClimbing, [.mediumDark]),
+        "🧗🏿‍♂️": (.manClimbing, [.dark]),
+        "🧗🏻‍♀️": (.womanClimbing, [.light]),
+        "🧗🏼‍♀️": (.womanClimbing, [.mediumLight]),
+        "🧗🏽‍♀️": (.womanClimbing, [.medium]),
+        "🧗🏾‍♀️": (.womanClimbing, [.mediumDark]),
+        "🧗🏿‍♀️": (.womanClimbing, [.dark]),
+        "🏇🏻": (.horseRacing, [.light]),
+        "🏇🏼": (.horseRacing, [.mediumLight]),
+        "🏇🏽": (.horseRacing, [.medium]),
+        "🏇🏾": (.horseRacing, [.mediumDark]),
+        "🏇🏿": (.horseRacing, [.dark]),
+        "🏂🏻": (.snowboarder, [.light]),
+        "🏂🏼": (.snowboarder, [.mediumLight]),
+        "🏂🏽": (.snowboarder, [.medium]),
+        "🏂🏾": (.snowboarder, [.mediumDark]),
+        "🏂🏿": (.snowboarder, [.dark]),
+        "🏌🏻": (.golfer, [.light]),
+        "🏌🏼": (.golfer, [.mediumLight]),
+        "🏌🏽": (.golfer, [.medium]),
+        "🏌🏾": (.golfer, [.mediumDark]),
+        "🏌🏿": (.golfer, [.dark]),
+        "🏌🏻‍♂️": (.manGolfing, [.light]),
+        "🏌🏼‍♂️": (.manGolfing, [.mediumLight]),
+        "🏌🏽‍♂️": (.manGolfing, [.medium]),
+        "🏌🏾‍♂️": (.manGolfing, [.mediumDark]),
+        "🏌🏿‍♂️": (.manGolfing, [.dark]),
+        "🏌🏻‍♀️": (.womanGolfing, [.light]),
+        "🏌🏼‍♀️": (.womanGolfing, [.mediumLight]),
+        "🏌🏽‍♀️": (.womanGolfing, [.medium]),
+        "🏌🏾‍♀️": (.womanGolfing, [.mediumDark]),
+        "🏌🏿‍♀️": (.womanGolfing, [.dark]),
+        "🏄🏻": (.surfer, [.light]),
+        "🏄🏼": (.surfer, [.mediumLight]),
+        "🏄🏽": (.surfer, [.medium]),
+        "🏄🏾": (.surfer, [.mediumDark]),
+        "🏄🏿": (.surfer, [.dark]),
+        "🏄🏻‍♂️": (.manSurfing, [.light]),
+        "🏄🏼‍♂️": (.manSurfing, [.mediumLight]),
+        "🏄🏽‍♂️": (.manSurfing, [.medium]),
+        "🏄🏾‍♂️": (.manSurfing, [.mediumDark]),
+        "🏄🏿‍♂️": (.manSurfing, [.dark]),
+        "🏄🏻‍♀️": (.womanSurfing, [.light]),
+        "🏄🏼‍♀️": (.womanSurfing, [.mediumLight]),
+        "🏄🏽‍♀️": (.womanSurfing, [.medium]),
+        "🏄🏾‍♀️": (.womanSurfing, [.mediumDark]),
+        "🏄🏿‍♀️": (.womanSurfing, [.dark]),
+        "🚣🏻": (.rowboat, [.light]),
+        "🚣🏼": (.rowboat, [.mediumLight]),
+        "🚣🏽": (.rowboat, [.medium]),
+        "🚣🏾": (.rowboat, [.mediumDark]),
+        "🚣🏿": (.rowboat, [.dark]),
+        "🚣🏻‍♂️": (.manRowingBoat, [.light]),
+        "🚣🏼‍♂️": (.manRowingBoat, [.mediumLight]),
+        "🚣🏽‍♂️": (.manRowingBoat, [.medium]),
+        "🚣🏾‍♂️": (.manRowingBoat, [.mediumDark]),
+        "🚣🏿‍♂️": (.manRowingBoat, [.dark]),
+        "🚣🏻‍♀️": (.womanRowingBoat, [.light]),
+        "🚣🏼‍♀️": (.womanRowingBoat, [.mediumLight]),
+        "🚣🏽‍♀️": (.womanRowingBoat, [.medium]),
+        "🚣🏾‍♀️": (.womanRowingBoat, [.mediumDark]),
+        "🚣🏿‍♀️": (.womanRowingBoat, [.dark]),
+        "🏊🏻": (.swimmer, [.light]),
+        "🏊🏼": (.swimmer, [.mediumLight]),
+        "🏊🏽": (.swimmer, [.medium]),
+        "🏊🏾": (.swimmer, [.mediumDark]),
+        "🏊🏿": (.swimmer, [.dark]),
+        "🏊🏻‍♂️": (.manSwimming, [.light]),
+        "🏊🏼‍♂️": (.manSwimming, [.mediumLight]),
+        "🏊🏽‍♂️": (.manSwimming, [.medium]),
+        "🏊🏾‍♂️": (.manSwimming, [.mediumDark]),
+        "🏊🏿‍♂️": (.manSwimming, [.dark]),
+        "🏊🏻‍♀️": (.womanSwimming, [.light]),
+        "🏊🏼‍♀️": (.womanSwimming, [.mediumLight]),
+        "🏊🏽‍♀️": (.womanSwimming, [.medium]),
+        "🏊🏾‍♀️": (.womanSwimming, [.mediumDark]),
+        "🏊🏿‍♀️": (.womanSwimming, [.dark]),
+        "⛹🏻": (.personWithBall, [.light]),
+        "⛹🏼": (.personWithBall, [.mediumLight]),
+        "⛹🏽": (.personWithBall, [.medium]),
+        "⛹🏾": (.personWithBall, [.mediumDark]),
+        "⛹🏿": (.personWithBall, [.dark]),
+        "⛹🏻‍♂️": (.manBouncingBall, [.light]),
+        "⛹🏼‍♂️": (.manBouncingBall, [.mediumLight]),
+        "⛹🏽‍♂️": (.manBouncingBall, [.medium]),
+        "⛹🏾‍♂️": (.manBouncingBall, [.mediumDark]),
+        "⛹🏿‍♂️": (.manBouncingBall, [.dark]),
+        "⛹🏻‍♀️": (.womanBouncingBall, [.light]),
+        "⛹🏼‍♀️": (.womanBouncingBall, [.mediumLight]),
+        "⛹🏽‍♀️": (.womanBouncingBall, [.medium]),
+        "⛹🏾‍♀️": (.womanBouncingBall, [.mediumDark]),
+        "⛹🏿‍♀️": (.womanBouncingBall, [.dark]),
+        "🏋🏻": (.weightLifter, [.light]),
+        "🏋🏼": (.weightLifter, [.mediumLight]),
+        "🏋🏽": (.weightLifter, [.medium]),
+        "🏋🏾": (.weightLifter, [.mediumDark]),
+        "🏋🏿": (.weightLifter, [.dark]),
+        "🏋🏻‍♂️": (.manLiftingWeights, [.light]),
+        "🏋🏼‍♂️": (.manLiftingWeights, [.mediumLight]),
+        "🏋🏽‍♂️": (.manLiftingWeights, [.medium]),
+        "🏋🏾‍♂️": (.manLiftingWeights, [.mediumDark]),
+        "🏋🏿‍♂️": (.manLiftingWeights, [.dark]),
+        "🏋🏻‍♀️": (.womanLiftingWeights, [.light]),
+        "🏋🏼‍♀️": (.womanLiftingWeights, [.mediumLight]),
+        "🏋🏽‍♀️": (.womanLiftingWeights, [.medium]),
+        "🏋🏾‍♀️": (.womanLiftingWeights, [.mediumDark]),
+        "🏋🏿‍♀️": (.womanLiftingWeights, [.dark]),
+        "🚴🏻": (.bicyclist, [.light]),
+        "🚴🏼": (.bicyclist, [.mediumLight]),
+        "🚴🏽": (.bicyclist, [.medium]),
+        "🚴🏾": (.bicyclist, [.mediumDark]),
+        "🚴🏿": (.bicyclist, [.dark]),
+        "🚴🏻‍♂️": (.manBiking, [.light]),
+        "🚴🏼‍♂️": (.manBiking, [.mediumLight]),
+        "🚴🏽‍♂️": (.manBiking, [.medium]),
+        "🚴🏾‍♂️": (.manBiking, [.mediumDark]),
+        "🚴🏿‍♂️": (.manBiking, [.dark]),
+        "🚴🏻‍♀️": (.womanBiking, [.light]),
+        "🚴🏼‍♀️": (.womanBiking, [.mediumLight]),
+        "🚴🏽‍♀️": (.womanBiking, [.medium]),
+        "🚴🏾‍♀️": (.womanBiking, [.mediumDark]),
+        "🚴🏿‍♀️": (.womanBiking, [.dark]),
+        "🚵🏻": (.mountainBicyclist, [.light]),
+        "🚵🏼": (.mountainBicyclist, [.mediumLight]),
+        "🚵🏽": (.mountainBicyclist, [.medium]),
+        "🚵🏾": (.mountainBicyclist, [.mediumDark]),
+        "🚵🏿": (.mountainBicyclist, [.dark]),
+        "🚵🏻‍♂️": (.manMountainBiking, [.light]),
+        "🚵🏼‍♂️": (.manMountainBiking, [.mediumLight]),
+        "🚵🏽‍♂️": (.manMountainBiking, [.medium]),
+        "🚵🏾‍♂️": (.manMountainBiking, [.mediumDark]),
+        "🚵🏿‍♂️": (.manMountainBiking, [.dark]),
+        "🚵🏻‍♀️": (.womanMountainBiking, [.light]),
+        "🚵🏼‍♀️": (.womanMountainBiking, [.mediumLight]),
+        "🚵🏽‍♀️": (.womanMountainBiking, [.medium]),
+        "🚵🏾‍♀️": (.womanMountainBiking, [.mediumDark]),
+        "🚵🏿‍♀️": (.womanMountainBiking, [.dark]),
+        "🤸🏻": (.personDoingCartwheel, [.light]),
+        "🤸🏼": (.personDoingCartwheel, [.mediumLight]),
+        "🤸🏽": (.personDoingCartwheel, [.medium]),
+        "🤸🏾": (.personDoingCartwheel, [.mediumDark]),
+        "🤸🏿": (.personDoingCartwheel, [.dark]),
+        "🤸🏻‍♂️": (.manCartwheeling, [.light]),
+        "🤸🏼‍♂️": (.manCartwheeling, [.mediumLight]),
+        "🤸🏽‍♂️": (.manCartwheeling, [.medium]),
+        "🤸🏾‍♂️": (.manCartwheeling, [.mediumDark]),
+        "🤸🏿‍♂️": (.manCartwheeling, [.dark]),
+        "🤸🏻‍♀️": (.womanCartwheeling, [.light]),
+        "🤸🏼‍♀️": (.womanCartwheeling, [.mediumLight]),
+        "🤸🏽‍♀️": (.womanCartwheeling, [.medium]),
+        "🤸🏾‍♀️": (.womanCartwheeling, [.mediumDark]),
+        "🤸🏿‍♀️": (.womanCartwheeling, [.dark]),
+        "🤽🏻": (.waterPolo, [.light]),
+        "🤽🏼": (.waterPolo, [.mediumLight]),
+        "🤽🏽": (.waterPolo, [.medium]),
+        "🤽🏾": (.waterPolo, [.mediumDark]),
+        "🤽🏿": (.waterPolo, [.dark]),
+        "🤽🏻‍♂️": (.manPlayingWaterPolo, [.light]),
+        "🤽🏼‍♂️": (.manPlayingWaterPolo, [.mediumLight]),
+        "🤽🏽‍♂️": (.manPlayingWaterPolo, [.medium]),
+        "🤽🏾‍♂️": (.manPlayingWaterPolo, [.mediumDark]),
+        "🤽🏿‍♂️": (.manPlayingWaterPolo, [.dark]),
+        "🤽🏻‍♀️": (.womanPlayingWaterPolo, [.light]),
+        "🤽🏼‍♀️": (.womanPlayingWaterPolo, [.mediumLight]),
+        "🤽🏽‍♀️": (.womanPlayingWaterPolo, [.medium]),
+        "🤽🏾‍♀️": (.womanPlayingWaterPolo, [.mediumDark]),
+        "🤽🏿‍♀️": (.womanPlayingWaterPolo, [.dark]),
+        "🤾🏻": (.handball, [.light]),
+        "🤾🏼": (.handball, [.mediumLight]),
+        "🤾🏽": (.handball, [.medium]),
+        "🤾🏾": (.handball, [.mediumDark]),
+        "🤾🏿": (.handball, [.dark]),
+        "🤾🏻‍♂️": (.manPlayingHandball, [.light]),
+        "🤾🏼‍♂️": (.manPlayingHandball, [.mediumLight]),
+        "🤾🏽‍♂️": (.manPlayingHandball, [.medium]),
+        "🤾🏾‍♂️": (.manPlayingHandball, [.mediumDark]),
+        "🤾🏿‍♂️": (.manPlayingHandball, [.dark]),
+        "🤾🏻‍♀️": (.womanPlayingHandball, [.light]),
+        "🤾🏼‍♀️": (.womanPlayingHandball, [.mediumLight]),
+        "🤾🏽‍♀️": (.womanPlayingHandball, [.medium]),
+        "🤾🏾‍♀️": (.womanPlayingHandball, [.mediumDark]),
+        "🤾🏿‍♀️": (.womanPlayingHandball, [.dark]),
+        "🤹🏻": (.juggling, [.light]),
+        "🤹🏼": (.juggling, [.mediumLight]),
+        "🤹🏽": (.juggling, [.medium]),
+        "🤹🏾": (.juggling, [.mediumDark]),
+        "🤹🏿": (.juggling, [.dark]),
+        "🤹🏻‍♂️": (.manJuggling, [.light]),
+        "🤹🏼‍♂️": (.manJuggling, [.mediumLight]),
+        "🤹🏽‍♂️": (.manJuggling, [.medium]),
+        "🤹🏾‍♂️": (.manJuggling, [.mediumDark]),
+        "🤹🏿‍♂️": (.manJuggling, [.dark]),
+        "🤹🏻‍♀️": (.womanJuggling, [.light]),
+        "🤹🏼‍♀️": (.womanJuggling, [.mediumLight]),
+        "🤹🏽‍♀️": (.womanJuggling, [.medium]),
+        "🤹🏾‍♀️": (.womanJuggling, [.mediumDark]),
+        "🤹🏿‍♀️": (.womanJuggling, [.dark]),
+        "🧘🏻": (.personInLotusPosition, [.light]),
+        "🧘🏼": (.personInLotusPosition, [.mediumLight]),
+        "🧘🏽": (.personInLotusPosition, [.medium]),
+        "🧘🏾": (.personInLotusPosition, [.mediumDark]),
+        "🧘🏿": (.personInLotusPosition, [.dark]),
+        "🧘🏻‍♂️": (.manInLotusPosition, [.light]),
+        "🧘🏼‍♂️": (.manInLotusPosition, [.mediumLight]),
+        "🧘🏽‍♂️": (.manInLotusPosition, [.medium]),
+        "🧘🏾‍♂️": (.manInLotusPosition, [.mediumDark]),
+        "🧘🏿‍♂️": (.manInLotusPosition, [.dark]),
+        "🧘🏻‍♀️": (.womanInLotusPosition, [.light]),
+        "🧘🏼‍♀️": (.womanInLotusPosition, [.mediumLight]),
+        "🧘🏽‍♀️": (.womanInLotusPosition, [.medium]),
+        "🧘🏾‍♀️": (.womanInLotusPosition, [.mediumDark]),
+        "🧘🏿‍♀️": (.womanInLotusPosition, [.dark]),
+        "🛀🏻": (.bath, [.light]),
+        "🛀🏼": (.bath, [.mediumLight]),
+        "🛀🏽": (.bath, [.medium]),
+        "🛀🏾": (.bath, [.mediumDark]),
+        "🛀🏿": (.bath, [.dark]),
+        "🛌🏻": (.sleepingAccommodation, [.light]),
+        "🛌🏼": (.sleepingAccommodation, [.mediumLight]),
+        "🛌🏽": (.sleepingAccommodation, [.medium]),
+        "🛌🏾": (.sleepingAccommodation, [.mediumDark]),
+        "🛌🏿": (.sleepingAccommodation, [.dark]),
+        "🧑🏻‍🤝‍🧑🏻": (.peopleHoldingHands, [.light]),
+        "🧑🏻‍🤝‍🧑🏼": (.peopleHoldingHands, [.light, .mediumLight]),
+        "🧑🏻‍🤝‍🧑🏽": (.peopleHoldingHands, [.light, .medium]),
+        "🧑🏻‍🤝‍🧑🏾": (.peopleHoldingHands, [.light, .mediumDark]),
+        "🧑🏻‍🤝‍🧑🏿": (.peopleHoldingHands, [.light, .dark]),
+        "🧑🏼‍🤝‍🧑🏼": (.peopleHoldingHands, [.mediumLight]),
+        "🧑🏼‍🤝‍🧑🏻": (.peopleHoldingHands, [.mediumLight, .light]),
+        "🧑🏼‍🤝‍🧑🏽": (.peopleHoldingHands, [.mediumLight, .medium]),
+        "🧑🏼‍🤝‍🧑🏾": (.peopleHoldingHands, [.mediumLight, .mediumDark]),
+        "🧑🏼‍🤝‍🧑🏿": (.peopleHoldingHands, [.mediumLight, .dark]),
+        "🧑🏽‍🤝‍🧑🏽": (.peopleHoldingHands, [.medium]),
+        "🧑🏽‍🤝‍🧑🏻": (.peopleHoldingHands, [.medium, .light]),
+        "🧑🏽‍🤝‍🧑🏼": (.peopleHoldingHands, [.medium, .mediumLight]),
+        "🧑🏽‍🤝‍🧑🏾": (.peopleHoldingHands, [.medium, .mediumDark]),
+        "🧑🏽‍🤝‍🧑🏿": (.peopleHoldingHands, [.medium, .dark]),
+        "🧑🏾‍🤝‍🧑🏾": (.peopleHoldingHands, [.mediumDark]),
+        "🧑🏾‍🤝‍🧑🏻": (.peopleHoldingHands, [.mediumDark, .light]),
+        "🧑🏾‍🤝‍🧑🏼": (.peopleHoldingHands, [.mediumDark, .mediumLight]),
+        "🧑🏾‍🤝‍🧑🏽": (.peopleHoldingHands, [.mediumDark, .medium]),
+        "🧑🏾‍🤝‍🧑🏿": (.peopleHoldingHands, [.mediumDark, .dark]),
+        "🧑🏿‍🤝‍🧑🏿": (.peopleHoldingHands, [.dark]),
+        "🧑🏿‍🤝‍🧑🏻": (.peopleHoldingHands, [.dark, .light]),
+        "🧑🏿‍🤝‍🧑🏼": (.peopleHoldingHands, [.dark, .mediumLight]),
+        "🧑🏿‍🤝‍🧑🏽": (.peopleHoldingHands, [.dark, .medium]),
+        "🧑🏿‍🤝‍🧑🏾": (.peopleHoldingHands, [.dark, .mediumDark]),
+        "👭🏻": (.twoWomenHoldingHands, [.light]),
+        "👩🏻‍🤝‍👩🏼": (.twoWomenHoldingHands, [.light, .mediumLight]),
+        "👩🏻‍🤝‍👩🏽": (.twoWomenHoldingHands, [.light, .medium]),
+        "👩🏻‍🤝‍👩🏾": (.twoWomenHoldingHands, [.light, .mediumDark]),
+        "👩🏻‍🤝‍👩🏿": (.twoWomenHoldingHands, [.light, .dark]),
+        "👭🏼": (.twoWomenHoldingHands, [.mediumLight]),
+        "👩🏼‍🤝‍👩🏻": (.twoWomenHoldingHands, [.mediumLight, .light]),
+        "👩🏼‍🤝‍👩🏽": (.twoWomenHoldingHands, [.mediumLight, .medium]),
+        "👩🏼‍🤝‍👩🏾": (.twoWomenHoldingHands, [.mediumLight, .mediumDark]),
+        "👩🏼‍🤝‍👩🏿": (.twoWomenHoldingHands, [.mediumLight, .dark]),
+        "👭🏽": (.twoWomenHoldingHands, [.medium]),
+        "👩🏽‍🤝‍👩🏻": (.twoWomenHoldingHands, [.medium, .light]),
+        "👩🏽‍🤝‍👩🏼": (.twoWomenHoldingHands, [.medium, .mediumLight]),
+        "👩🏽‍🤝‍👩🏾": (.twoWomenHoldingHands, [.medium, .mediumDark]),
+        "👩🏽‍🤝‍👩🏿": (.twoWomenHoldingHands, [.medium, .dark]),
+        "👭🏾": (.twoWomenHoldingHands, [.mediumDark]),
+        "👩🏾‍🤝‍👩🏻": (.twoWomenHoldingHands, [.mediumDark, .light]),
+        "👩🏾‍🤝‍👩🏼": (.twoWomenHoldingHands, [.mediumDark, .mediumLight]),
+        "👩🏾‍🤝‍👩🏽": (.twoWomenHoldingHands, [.mediumDark, .medium]),
+        "👩🏾‍🤝‍👩🏿": (.twoWomenHoldingHands, [.mediumDark, .dark]),
+        "👭🏿": (.twoWomenHoldingHands, [.dark]),
+        "👩🏿‍🤝‍👩🏻": (.twoWomenHoldingHands, [.dark, .light]),
+        "👩🏿‍🤝‍👩🏼": (.twoWomenHoldingHands, [.dark, .mediumLight]),
+        "👩🏿‍🤝‍👩🏽": (.twoWomenHoldingHands, [.dark, .medium]),
+        "👩🏿‍🤝‍👩🏾": (.twoWomenHoldingHands, [.dark, .mediumDark]),
+        "👫🏻": (.manAndWomanHoldingHands, [.light]),
+        "👩🏻‍🤝‍👨🏼": (.manAndWomanHoldingHands, [.light, .mediumLight]),
+        "👩🏻‍🤝‍👨🏽": (.manAndWomanHoldingHands, [.light, .medium]),
+        "👩🏻‍🤝‍👨🏾": (.manAndWomanHoldingHands, [.light, .mediumDark]),
+        "👩🏻‍🤝‍👨🏿": (.manAndWomanHoldingHands, [.light, .dark]),
+        "👫🏼": (.manAndWomanHoldingHands, [.mediumLight]),
+        "👩🏼‍🤝‍👨🏻": (.manAndWomanHoldingHands, [.mediumLight, .light]),
+        "👩🏼‍🤝‍👨🏽": (.manAndWomanHoldingHands, [.mediumLight, .medium]),
+        "👩🏼‍🤝‍👨🏾": (.manAndWomanHoldingHands, [.mediumLight, .mediumDark]),
+        "👩🏼‍🤝‍👨🏿": (.manAndWomanHoldingHands, [.mediumLight, .dark]),
+        "👫🏽": (.manAndWomanHoldingHands, [.medium]),
+        "👩🏽‍🤝‍👨🏻": (.manAndWomanHoldingHands, [.medium, .light]),
+        "👩🏽‍🤝‍👨🏼": (.manAndWomanHoldingHands, [.medium, .mediumLight]),
+        "👩🏽‍🤝‍👨🏾": (.manAndWomanHoldingHands, [.medium, .mediumDark]),
+        "👩🏽‍🤝‍👨🏿": (.manAndWomanHoldingHands, [.medium, .dark]),
+        "👫🏾": (.manAndWomanHoldingHands, [.mediumDark]),
+        "👩🏾‍🤝‍👨🏻": (.manAndWomanHoldingHands, [.mediumDark, .light]),
+        "👩🏾‍🤝‍👨🏼": (.manAndWomanHoldingHands, [.mediumDark, .mediumLight]),
+        "👩🏾‍🤝‍👨🏽": (.manAndWomanHoldingHands, [.mediumDark, .medium]),
+        "👩🏾‍🤝‍👨🏿": (.manAndWomanHoldingHands, [.mediumDark, .dark]),
+        "👫🏿": (.manAndWomanHoldingHands, [.dark]),
+        "👩🏿‍🤝‍👨🏻": (.manAndWomanHoldingHands, [.dark, .light]),
+        "👩🏿‍🤝‍👨🏼": (.manAndWomanHoldingHands, [.dark, .mediumLight]),
+        "👩🏿‍🤝‍👨🏽": (.manAndWomanHoldingHands, [.dark, .medium]),
+        "👩🏿‍🤝‍👨🏾": (.manAndWomanHoldingHands, [.dark, .mediumDark]),
+        "👬🏻": (.twoMenHoldingHands, [.light]),
+        "👨🏻‍🤝‍👨🏼": (.twoMenHoldingHands, [.light, .mediumLight]),
+        "👨🏻‍🤝‍👨🏽": (.twoMenHoldingHands, [.light, .medium]),
+        "👨🏻‍🤝‍👨🏾": (.twoMenHoldingHands, [.light, .mediumDark]),
+        "👨🏻‍🤝‍👨🏿": (.twoMenHoldingHands, [.light, .dark]),
+        "👬🏼": (.twoMenHoldingHands, [.mediumLight]),
+        "👨🏼‍🤝‍👨🏻": (.twoMenHoldingHands, [.mediumLight, .light]),
+        "👨🏼‍🤝‍👨🏽": (.twoMenHoldingHands, [.mediumLight, .medium]),
+        "👨🏼‍🤝‍👨🏾": (.twoMenHoldingHands, [.mediumLight, .mediumDark]),
+        "👨🏼‍🤝‍👨🏿": (.twoMenHoldingHands, [.mediumLight, .dark]),
+        "👬🏽": (.twoMenHoldingHands, [.medium]),
+        "👨🏽‍🤝‍👨🏻": (.twoMenHoldingHands, [.medium, .light]),
+        "👨🏽‍🤝‍👨🏼": (.twoMenHoldingHands, [.medium, .mediumLight]),
+        "👨🏽‍🤝‍👨🏾": (.twoMenHoldingHands, [.medium, .mediumDark]),
+        "👨🏽‍🤝‍👨🏿": (.twoMenHoldingHands, [.medium, .dark]),
+        "👬🏾": (.twoMenHoldingHands, [.mediumDark]),
+        "👨🏾‍🤝‍👨🏻": (.twoMenHoldingHands, [.mediumDark, .light]),
+        "👨🏾‍🤝‍👨🏼": (.twoMenHoldingHands, [.mediumDark, .mediumLight]),
+        "👨🏾‍🤝‍👨🏽": (.twoMenHoldingHands, [.mediumDark, .medium]),
+        "👨🏾‍🤝‍👨🏿": (.twoMenHoldingHands, [.mediumDark, .dark]),
+        "👬🏿": (.twoMenHoldingHands, [.dark]),
+        "👨🏿‍🤝‍👨🏻": (.twoMenHoldingHands, [.dark, .light]),
+        "👨🏿‍🤝‍👨🏼": (.twoMenHoldingHands, [.dark, .mediumLight]),
+        "👨🏿‍🤝‍👨🏽": (.twoMenHoldingHands, [.dark, .medium]),
+        "👨🏿‍🤝‍👨🏾": (.twoMenHoldingHands, [.dark, .mediumDark]),
+        "💏🏻": (.personKissPerson, [.light]),
+        "🧑🏻‍❤️‍💋‍🧑🏼": (.personKissPerson, [.light, .mediumLight]),
+        "🧑🏻‍❤️‍💋‍🧑🏽": (.personKissPerson, [.light, .medium]),
+        "🧑🏻‍❤️‍💋‍🧑🏾": (.personKissPerson, [.light, .mediumDark]),
+        "🧑🏻‍❤️‍💋‍🧑🏿": (.personKissPerson, [.light, .dark]),
+        "💏🏼": (.personKissPerson, [.mediumLight]),
+        "🧑🏼‍❤️‍💋‍🧑🏻": (.personKissPerson, [.mediumLight, .light]),
+        "🧑🏼‍❤️‍💋‍🧑🏽": (.personKissPerson, [.mediumLight, .medium]),
+        "🧑🏼‍❤️‍💋‍🧑🏾": (.personKissPerson, [.mediumLight, .mediumDark]),
+        "🧑🏼‍❤️‍💋‍🧑🏿": (.personKissPerson, [.mediumLight, .dark]),
+        "💏🏽": (.personKissPerson, [.medium]),
+        "🧑🏽‍❤️‍💋‍🧑🏻": (.personKissPerson, [.medium, .light]),
+        "🧑🏽‍❤️‍💋‍🧑🏼": (.personKissPerson, [.medium, .mediumLight]),
+        "🧑🏽‍❤️‍💋‍🧑🏾": (.personKissPerson, [.medium, .mediumDark]),
+        "🧑🏽‍❤️‍💋‍🧑🏿": (.personKissPerson, [.medium, .dark]),
+        "💏🏾": (.personKissPerson, [.mediumDark]),
+        "🧑🏾‍❤️‍💋‍🧑🏻": (.personKissPerson, [.mediumDark, .light]),
+        "🧑🏾‍❤️‍💋‍🧑🏼": (.personKissPerson, [.mediumDark, .mediumLight]),
+        "🧑🏾‍❤️‍💋‍🧑🏽": (.personKissPerson, [.mediumDark, .medium]),
+        "🧑🏾‍❤️‍💋‍🧑🏿": (.personKissPerson, [.mediumDark, .dark]),
+        "💏🏿": (.personKissPerson, [.dark]),
+        "🧑🏿‍❤️‍💋‍🧑🏻": (.personKissPerson, [.dark, .light]),
+        "🧑🏿‍❤️‍💋‍🧑🏼": (.personKissPerson, [.dark, .mediumLight]),
+        "🧑🏿‍❤️‍💋‍🧑🏽": (.personKissPerson, [.dark, .medium]),
+        "🧑🏿‍❤️‍💋‍🧑🏾": (.personKissPerson, [.dark, .mediumDark]),
+        "👩🏻‍❤️‍💋‍👨🏻": (.womanKissMan, [.light]),
+        "👩🏻‍❤️‍💋‍👨🏼": (.womanKissMan, [.light, .mediumLight]),
+        "👩🏻‍❤️‍💋‍👨🏽": (.womanKissMan, [.light, .medium]),
+        "👩🏻‍❤️‍💋‍👨🏾": (.womanKissMan, [.light, .mediumDark]),
+        "👩🏻‍❤️‍💋‍👨🏿": (.womanKissMan, [.light, .dark]),
+        "👩🏼‍❤️‍💋‍👨🏼": (.womanKissMan, [.mediumLight]),
+        "👩🏼‍❤️‍💋‍👨🏻": (.womanKissMan, [.mediumLight, .light]),
+        "👩🏼‍❤️‍💋‍👨🏽": (.womanKissMan, [.mediumLight, .medium]),
+        "👩🏼‍❤️‍💋‍👨🏾": (.womanKissMan, [.mediumLight, .mediumDark]),
+        "👩🏼‍❤️‍💋‍👨🏿": (.womanKissMan, [.mediumLight, .dark]),
+        "👩🏽‍❤️‍💋‍👨🏽": (.womanKissMan, [.medium]),
+        "👩🏽‍❤️‍💋‍👨🏻": (.womanKissMan, [.medium, .light]),
+        "👩🏽‍❤️‍💋‍👨🏼": (.womanKissMan, [.medium, .mediumLight]),
+        "👩🏽‍❤️‍💋‍👨🏾": (.womanKissMan, [.medium, .mediumDark]),
+        "👩🏽‍❤️‍💋‍👨🏿": (.womanKissMan, [.medium, .dark]),
+        "👩🏾‍❤️‍💋‍👨🏾": (.womanKissMan, [.mediumDark]),
+        "👩🏾‍❤️‍💋‍👨🏻": (.womanKissMan, [.mediumDark, .light]),
+        "👩🏾‍❤️‍💋‍👨🏼": (.womanKissMan, [.mediumDark, .mediumLight]),
+        "👩🏾‍❤️‍💋‍👨🏽": (.womanKissMan, [.mediumDark, .medium]),
+        "👩🏾‍❤️‍💋‍👨🏿": (.womanKissMan, [.mediumDark, .dark]),
+        "👩🏿‍❤️‍💋‍👨🏿": (.womanKissMan, [.dark]),
+        "👩🏿‍❤️‍💋‍👨🏻": (.womanKissMan, [.dark, .light]),
+        "👩🏿‍❤️‍💋‍👨🏼": (.womanKissMan, [.dark, .mediumLight]),
+        "👩🏿‍❤️‍💋‍👨🏽": (.womanKissMan, [.dark, .medium]),
+        "👩🏿‍❤️‍💋‍👨🏾": (.womanKissMan, [.dark, .mediumDark]),
+        "👨🏻‍❤️‍💋‍👨🏻": (.manKissMan, [.light]),
+        "👨🏻‍❤️‍💋‍👨🏼": (.manKissMan, [.light, .mediumLight]),
+        "👨🏻‍❤️‍💋‍👨🏽": (.manKissMan, [.light, .medium]),
+        "👨🏻‍❤️‍💋‍👨🏾": (.manKissMan, [.light, .mediumDark]),
+        "👨🏻‍❤️‍💋‍👨🏿": (.manKissMan, [.light, .dark]),
+        "👨🏼‍❤️‍💋‍👨🏼": (.manKissMan, [.mediumLight]),
+        "👨🏼‍❤️‍💋‍👨🏻": (.manKissMan, [.mediumLight, .light]),
+        "👨🏼‍❤️‍💋‍👨🏽": (.manKissMan, [.mediumLight, .medium]),
+        "👨🏼‍❤️‍💋‍👨🏾": (.manKissMan, [.mediumLight, .mediumDark]),
+        "👨🏼‍❤️‍💋‍👨🏿": (.manKissMan, [.mediumLight, .dark]),
+        "👨🏽‍❤️‍💋‍👨🏽": (.manKissMan, [.medium]),
+        "👨🏽‍❤️‍💋‍👨🏻": (.manKissMan, [.medium, .light]),
+        "👨🏽‍❤️‍💋‍👨🏼": (.manKissMan, [.medium, .mediumLight]),
+        "👨🏽‍❤️‍💋‍👨🏾": (.manKissMan, [.medium, .mediumDark]),
+        "👨🏽‍❤️‍💋‍👨🏿": (.manKissMan, [.medium, .dark]),
+        "👨🏾‍❤️‍💋‍👨🏾": (.manKissMan, [.mediumDark]),
+        "👨🏾‍❤️‍💋‍👨🏻": (.manKissMan, [.mediumDark, .light]),
+        "👨🏾‍❤️‍💋‍👨🏼": (.manKissMan, [.mediumDark, .mediumLight]),
+        "👨🏾‍❤️‍💋‍👨🏽": (.manKissMan, [.mediumDark, .medium]),
+        "👨🏾‍❤️‍💋‍👨🏿": (.manKissMan, [.mediumDark, .dark]),
+        "👨🏿‍❤️‍💋‍👨🏿": (.manKissMan, [.dark]),
+        "👨🏿‍❤️‍💋‍👨🏻": (.manKissMan, [.dark, .light]),
+        "👨🏿‍❤️‍💋‍👨🏼": (.manKissMan, [.dark, .mediumLight]),
+        "👨🏿‍❤️‍💋‍👨🏽": (.manKissMan, [.dark, .medium]),
+        "👨🏿‍❤️‍💋‍👨🏾": (.manKissMan, [.dark, .mediumDark]),
+        "👩🏻‍❤️‍💋‍👩🏻": (.womanKissWoman, [.light]),
+        "👩🏻‍❤️‍💋‍👩🏼": (.womanKissWoman, [.light, .mediumLight]),
+        "👩🏻‍❤️‍💋‍👩🏽": (.womanKissWoman, [.light, .medium]),
+        "👩🏻‍❤️‍💋‍👩🏾": (.womanKissWoman, [.light, .mediumDark]),
+        "👩🏻‍❤️‍💋‍👩🏿": (.womanKissWoman, [.light, .dark]),
+        "👩🏼‍❤️‍💋‍👩🏼": (.womanKissWoman, [.mediumLight]),
+        "👩🏼‍❤️‍💋‍👩🏻": (.womanKissWoman, [.mediumLight, .light]),
+        "👩🏼‍❤️‍💋‍👩🏽": (.womanKissWoman, [.mediumLight, .medium]),
+        "👩🏼‍❤️‍💋‍👩🏾": (.womanKissWoman, [.mediumLight, .mediumDark]),
+        "👩🏼‍❤️‍💋‍👩🏿": (.womanKissWoman, [.mediumLight, .dark]),
+        "👩🏽‍❤️‍💋‍👩🏽": (.womanKissWoman, [.medium]),
+        "👩🏽‍❤️‍💋‍👩🏻": (.womanKissWoman, [.medium, .light]),
+        "👩🏽‍❤️‍💋‍👩🏼": (.womanKissWoman, [.medium, .mediumLight]),
+        "👩🏽‍❤️‍💋‍👩🏾": (.womanKissWoman, [.medium, .mediumDark]),
+        "👩🏽‍❤️‍💋‍👩🏿": (.womanKissWoman, [.medium, .dark]),
+        "👩🏾‍❤️‍💋‍👩🏾": (.womanKissWoman, [.mediumDark]),
+        "👩🏾‍❤️‍💋‍👩🏻": (.womanKissWoman, [.mediumDark, .light]),
+        "👩🏾‍❤️‍💋‍👩🏼": (.womanKissWoman, [.mediumDark, .mediumLight]),
+        "👩🏾‍❤️‍💋‍👩🏽": (.womanKissWoman, [.mediumDark, .medium]),
+        "👩🏾‍❤️‍💋‍👩🏿": (.womanKissWoman, [.mediumDark, .dark]),
+        "👩🏿‍❤️‍💋‍👩🏿": (.womanKissWoman, [.dark]),
+        "👩🏿‍❤️‍💋‍👩🏻": (.womanKissWoman, [.dark, .light]),
+        "👩🏿‍❤️‍💋‍👩🏼": (.womanKissWoman, [.dark, .mediumLight]),
+        "👩🏿‍❤️‍💋‍👩🏽": (.womanKissWoman, [.dark, .medium]),
+        "👩🏿‍❤️‍💋‍👩🏾": (.womanKissWoman, [.dark, .mediumDark]),
+        "💑🏻": (.personHeartPerson, [.light]),
+        "🧑🏻‍❤️‍🧑🏼": (.personHeartPerson, [.light, .mediumLight]),
+        "🧑🏻‍❤️‍🧑🏽": (.personHeartPerson, [.light, .medium]),
+        "🧑🏻‍❤️‍🧑🏾": (.personHeartPerson, [.light, .mediumDark]),
+        "🧑🏻‍❤️‍🧑🏿": (.personHeartPerson, [.light, .dark]),
+        "💑🏼": (.personHeartPerson, [.mediumLight]),
+        "🧑🏼‍❤️‍🧑🏻": (.personHeartPerson, [.mediumLight, .light]),
+        "🧑🏼‍❤️‍🧑🏽": (.personHeartPerson, [.mediumLight, .medium]),
+        "🧑🏼‍❤️‍🧑🏾": (.personHeartPerson, [.mediumLight, .mediumDark]),
+        "🧑🏼‍❤️‍🧑🏿": (.personHeartPerson, [.mediumLight, .dark]),
+        "💑🏽": (.personHeartPerson, [.medium]),
+        "🧑🏽‍❤️‍🧑🏻": (.personHeartPerson, [.medium, .light]),
+        "🧑🏽‍❤️‍🧑🏼": (.personHeartPerson, [.medium, .mediumLight]),
+        "🧑🏽‍❤️‍🧑🏾": (.personHeartPerson, [.medium, .mediumDark]),
+        "🧑🏽‍❤️‍🧑🏿": (.personHeartPerson, [.medium, .dark]),
+        "💑🏾": (.personHeartPerson, [.mediumDark]),
+        "🧑🏾‍❤️‍🧑🏻": (.personHeartPerson, [.mediumDark, .light]),
+        "🧑🏾‍❤️‍🧑🏼": (.personHeartPerson, [.mediumDark, .mediumLight]),
+        "🧑🏾‍❤️‍🧑🏽": (.personHeartPerson, [.mediumDark, .medium]),
+        "🧑🏾‍❤️‍🧑🏿": (.personHeartPerson, [.mediumDark, .dark]),
+        "💑🏿": (.personHeartPerson, [.dark]),
+        "🧑🏿‍❤️‍🧑🏻": (.personHeartPerson, [.dark, .light]),
+        "🧑🏿‍❤️‍🧑🏼": (.personHeartPerson, [.dark, .mediumLight]),
+        "🧑🏿‍❤️‍🧑🏽": (.personHeartPerson, [.dark, .medium]),
+        "🧑🏿‍❤️‍🧑🏾": (.personHeartPerson, [.dark, .mediumDark]),
+        "👩🏻‍❤️‍👨🏻": (.womanHeartMan, [.light]),
+        "👩🏻‍❤️‍👨🏼": (.womanHeartMan, [.light, .mediumLight]),
+        "👩🏻‍❤️‍👨🏽": (.womanHeartMan, [.light, .medium]),
+        "👩🏻‍❤️‍👨🏾": (.womanHeartMan, [.light, .mediumDark]),
+        "👩🏻‍❤️‍👨🏿": (.womanHeartMan, [.light, .dark]),
+        "👩🏼‍❤️‍👨🏼": (.womanHeartMan, [.mediumLight]),
+        "👩🏼‍❤️‍👨🏻": (.womanHeartMan, [.mediumLight, .light]),
+        "👩🏼‍❤️‍👨🏽": (.womanHeartMan, [.mediumLight, .medium]),
+        "👩🏼‍❤️‍👨🏾": (.womanHeartMan, [.mediumLight, .mediumDark]),
+        "👩🏼‍❤️‍👨🏿": (.womanHeartMan, [.mediumLight, .dark]),
+        "👩🏽‍❤️‍👨🏽": (.womanHeartMan, [.medium]),
+        "👩🏽‍❤️‍👨🏻": (.womanHeartMan, [.medium, .light]),
+        "👩🏽‍❤️‍👨🏼": (.womanHeartMan, [.medium, .mediumLight]),
+        "👩🏽‍❤️‍👨🏾": (.womanHeartMan, [.medium, .mediumDark]),
+        "👩🏽‍❤️‍👨🏿": (.womanHeartMan, [.medium, .dark]),
+        "👩🏾‍❤️‍👨🏾": (.womanHeartMan, [.mediumDark]),
+        "👩🏾‍❤️‍👨🏻": (.womanHeartMan, [.mediumDark, .light]),
+        "👩🏾‍❤️‍👨🏼": (.womanHeartMan, [.mediumDark, .mediumLight]),
+        "👩🏾‍❤️‍👨🏽": (.womanHeartMan, [.mediumDark, .medium]),
+        "👩🏾‍❤️‍👨🏿": (.womanHeartMan, [.mediumDark, .dark]),
+        "👩🏿‍❤️‍👨🏿": (.womanHeartMan, [.dark]),
+        "👩🏿‍❤️‍👨🏻": (.womanHeartMan, [.dark, .light]),
+        "👩🏿‍❤️‍👨🏼": (.womanHeartMan, [.dark, .mediumLight]),
+        "👩🏿‍❤️‍👨🏽": (.womanHeartMan, [.dark, .medium]),
+        "👩🏿‍❤️‍👨🏾": (.womanHeartMan, [.dark, .mediumDark]),
+        "👨🏻‍❤️‍👨🏻": (.manHeartMan, [.light]),
+        "👨🏻‍❤️‍👨🏼": (.manHeartMan, [.light, .mediumLight]),
+        "👨🏻‍❤️‍👨🏽": (.manHeartMan, [.light, .medium]),
+        "👨🏻‍❤️‍👨🏾": (.manHeartMan, [.light, .mediumDark]),
+        "👨🏻‍❤️‍👨🏿": (.manHeartMan, [.light, .dark]),
+        "👨🏼‍❤️‍👨🏼": (.manHeartMan, [.mediumLight]),
+        "👨🏼‍❤️‍👨🏻": (.manHeartMan, [.mediumLight, .light]),
+        "👨🏼‍❤️‍👨🏽": (.manHeartMan, [.mediumLight, .medium]),
+        "👨🏼‍❤️‍👨🏾": (.manHeartMan, [.mediumLight, .mediumDark]),
+        "👨🏼‍❤️‍👨🏿": (.manHeartMan, [.mediumLight, .dark]),
+        "👨🏽‍❤️‍👨🏽": (.manHeartMan, [.medium]),
+        "👨🏽‍❤️‍👨🏻": (.manHeartMan, [.medium, .light]),
+        "👨🏽‍❤️‍👨🏼": (.manHeartMan, [.medium, .mediumLight]),
+        "👨🏽‍❤️‍👨🏾": (.manHeartMan, [.medium, .mediumDark]),
+        "👨🏽‍❤️‍👨🏿": (.manHeartMan, [.medium, .dark]),
+        "👨🏾‍❤️‍👨🏾": (.manHeartMan, [.mediumDark]),
+        "👨🏾‍❤️‍👨🏻": (.manHeartMan, [.mediumDark, .light]),
+        "👨🏾‍❤️‍👨🏼": (.manHeartMan, [.mediumDark, .mediumLight]),
+        "👨🏾‍❤️‍👨🏽": (.manHeartMan, [.mediumDark, .medium]),
+        "👨🏾‍❤️‍👨🏿": (.manHeartMan, [.mediumDark, .dark]),
+        "👨🏿‍❤️‍👨🏿": (.manHeartMan, [.dark]),
+        "👨🏿‍❤️‍👨🏻": (.manHeartMan, [.dark, .light]),
+        "👨🏿‍❤️‍👨🏼": (.manHeartMan, [.dark, .mediumLight]),
+        "👨🏿‍❤️‍👨🏽": (.manHeartMan, [.dark, .medium]),
+        "👨🏿‍❤️‍👨🏾": (.manHeartMan, [.dark, .mediumDark]),
+        "👩🏻‍❤️‍👩🏻": (.womanHeartWoman, [.light]),
+        "👩🏻‍❤️‍👩🏼": (.womanHeartWoman, [.light, .mediumLight]),
+        "👩🏻‍❤️‍👩🏽": (.womanHeartWoman, [.light, .medium]),
+        "👩🏻‍❤️‍👩🏾": (.womanHeartWoman, [.light, .mediumDark]),
+        "👩🏻‍❤️‍👩🏿": (.womanHeartWoman, [.light, .dark]),
+        "👩🏼‍❤️‍👩🏼": (.womanHeartWoman, [.mediumLight]),
+        "👩🏼‍❤️‍👩🏻": (.womanHeartWoman, [.mediumLight, .light]),
+        "👩🏼‍❤️‍👩🏽": (.womanHeartWoman, [.mediumLight, .medium]),
+        "👩🏼‍❤️‍👩🏾": (.womanHeartWoman, [.mediumLight, .mediumDark]),
+        "👩🏼‍❤️‍👩🏿": (.womanHeartWoman, [.mediumLight, .dark]),
+        "👩🏽‍❤️‍👩🏽": (.womanHeartWoman, [.medium]),
+        "👩🏽‍❤️‍👩🏻": (.womanHeartWoman, [.medium, .light]),
+        "👩🏽‍❤️‍👩🏼": (.womanHeartWoman, [.medium, .mediumLight]),
+        "👩🏽‍❤️‍👩🏾": (.womanHeartWoman, [.medium, .mediumDark]),
+        "👩🏽‍❤️‍👩🏿": (.womanHeartWoman, [.medium, .dark]),
+        "👩🏾‍❤️‍👩🏾": (.womanHeartWoman, [.mediumDark]),
+        "👩🏾‍❤️‍👩🏻": (.womanHeartWoman, [.mediumDark, .light]),
+        "👩🏾‍❤️‍👩🏼": (.womanHeartWoman, [.mediumDark, .mediumLight]),
+        "👩🏾‍❤️‍👩🏽": (.womanHeartWoman, [.mediumDark, .medium]),
+        "👩🏾‍❤️‍👩🏿": (.womanHeartWoman, [.mediumDark, .dark]),
+        "👩🏿‍❤️‍👩🏿": (.womanHeartWoman, [.dark]),
+        "👩🏿‍❤️‍👩🏻": (.womanHeartWoman, [.dark, .light]),
+        "👩🏿‍❤️‍👩🏼": (.womanHeartWoman, [.dark, .mediumLight]),
+        "👩🏿‍❤️‍👩🏽": (.womanHeartWoman, [.dark, .medium]),
+        "👩🏿‍❤️‍👩🏾": (.womanHeartWoman, [.dark, .mediumDark]),
+    ]
 }
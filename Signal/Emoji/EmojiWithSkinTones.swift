@@ -36,10 +36,21 @@ extension EmojiWithSkinTones {
         guard rawValue.isSingleEmoji else { return nil }
         if let result = Self.emojiToSkinToneComponents(emoji: rawValue) {
             self.init(baseEmoji: result.0, skinTones: result.1)
-        } else if let emoji = Emoji(rawValue: rawValue) {
+        } else if let emoji = Self.baseEmojiByRawValue[rawValue] {
             self.init(baseEmoji: emoji, skinTones: nil)
         } else { return nil }
     }
+
+    /// `Emoji(rawValue:)` compares the string against each case in turn, and
+    /// this runs for every reaction that's rendered, so look them up by hash
+    /// instead.
+    private static let baseEmojiByRawValue: [String: Emoji] = {
+        var result = [String: Emoji](minimumCapacity: Emoji.allCases.count)
+        for emoji in Emoji.allCases {
+            result[emoji.rawValue] = emoji
+        }
+        return result
+    }()
 }
 
 extension Emoji {
@@ -419,13 +419,11 @@ enum OWSOrphanDataCleaner {
         var attachmentStreamCount: Int = 0
         var allAttachmentFilePaths: Set<String> = []
         var allAttachmentIds: Set<String> = []
-        var allReactionIds: Set<String> = []
-        var allMentionIds: Set<String> = []
         var orphanInteractionIds: Set<String> = []
+        var orphanReactionIds: Set<String> = []
+        var orphanMentionIds: Set<String> = []
         var allMessageAttachmentIds: Set<String> = []
         var allStoryAttachmentIds: Set<String> = []
-        var allMessageReactionIds: Set<String> = []
-        var allMessageMentionIds: Set<String> = []
         var activeStickerFilePaths: Set<String> = []
         var hasOrphanedPacksOrStickers = false
         databaseStorage.read { transaction in
@@ -453,84 +451,95 @@ enum OWSOrphanDataCleaner {
                 return
             }
 
-            let threadIds: Set<String> = Set(TSThread.anyAllUniqueIds(transaction: transaction))
-
-            var allInteractionIds: Set<String> = []
-            TSInteraction.anyEnumerate(transaction: transaction, batched: true) { interaction, stop in
-                guard isMainAppAndActive else {
-                    shouldAbort = true
-                    stop.pointee = true
-                    return
-                }
-                if interaction.uniqueThreadId.isEmpty || !threadIds.contains(interaction.uniqueThreadId) {
-                    orphanInteractionIds.insert(interaction.uniqueId)
-                }
-
-                allInteractionIds.insert(interaction.uniqueId)
-                guard let message = interaction as? TSMessage else {
-                    return
-                }
-                allMessageAttachmentIds.formUnion(legacyAttachmentUniqueIds(message))
-            }
-
-            if shouldAbort {
+            // Rows whose parent is gone can be found with an indexed lookup per
+            // row, without decoding any models.
+            guard
+                let interactionIds = fetchUniqueIds(
+                    sql: """
+                        SELECT \(interactionColumn: .uniqueId)
+                        FROM \(InteractionRecord.databaseTableName)
+                        WHERE \(interactionColumn: .threadUniqueId) = ''
+                        OR NOT EXISTS (
+                            SELECT 1 FROM \(ThreadRecord.databaseTableName)
+                            WHERE \(threadColumnFullyQualified: .uniqueId) = \(interactionColumnFullyQualified: .threadUniqueId)
+                        )
+                        """,
+                    transaction: transaction
+                ),
+                let reactionIds = fetchUniqueIds(
+                    sql: """
+                        SELECT \(OWSReaction.columnName(.uniqueId))
+                        FROM \(OWSReaction.databaseTableName)
+                        WHERE NOT EXISTS (
+                            SELECT 1 FROM \(InteractionRecord.databaseTableName)
+                            WHERE \(interactionColumnFullyQualified: .uniqueId) = \(OWSReaction.columnName(.uniqueMessageId, fullyQualified: true))
+                        )
+                        """,
+                    transaction: transaction
+                ),
+                let mentionIds = fetchUniqueIds(
+                    sql: """
+                        SELECT \(TSMention.columnName(.uniqueId))
+                        FROM \(TSMention.databaseTableName)
+                        WHERE NOT EXISTS (
+                            SELECT 1 FROM \(InteractionRecord.databaseTableName)
+                            WHERE \(interactionColumnFullyQualified: .uniqueId) = \(TSMention.columnName(.uniqueMessageId, fullyQualified: true))
+                        )
+                        """,
+                    transaction: transaction
+                ),
+                isMainAppAndActive
+            else {
+                shouldAbort = true
                 return
             }
+            orphanInteractionIds = interactionIds
+            orphanReactionIds = reactionIds
+            orphanMentionIds = mentionIds
+
+            // Finding the legacy attachments that are still referenced means
+            // decoding every message, story and job record, which is only worth
+            // doing if there are legacy attachments left to clean up.
+            if !allAttachmentIds.isEmpty {
+                TSInteraction.anyEnumerate(transaction: transaction, batched: true) { interaction, stop in
+                    guard isMainAppAndActive else {
+                        shouldAbort = true
+                        stop.pointee = true
+                        return
+                    }
+                    guard let message = interaction as? TSMessage else {
+                        return
+                    }
+                    allMessageAttachmentIds.formUnion(legacyAttachmentUniqueIds(message))
+                }
 
-            OWSReaction.anyEnumerate(transaction: transaction, batchingPreference: .batched()) { reaction, stop in
-                guard isMainAppAndActive else {
-                    shouldAbort = true
-                    stop.pointee = true
+                if shouldAbort {
                     return
                 }
-                allReactionIds.insert(reaction.uniqueId)
-                if allInteractionIds.contains(reaction.uniqueMessageId) {
-                    allMessageReactionIds.insert(reaction.uniqueId)
-                }
-            }
 
-            if shouldAbort {
-                return
-            }
+                StoryMessage.anyEnumerate(transaction: transaction, batchingPreference: .batched()) { message, stop in
+                    guard isMainAppAndActive else {
+                        shouldAbort = true
+                        stop.pointee = true
+                        return
+                    }
+                    if let attachmentUniqueId = legacyAttachmentUniqueId(message) {
+                        allStoryAttachmentIds.insert(attachmentUniqueId)
+                    }
+                }
 
-            TSMention.anyEnumerate(transaction: transaction, batchingPreference: .batched()) { mention, stop in
-                guard isMainAppAndActive else {
-                    shouldAbort = true
-                    stop.pointee = true
+                if shouldAbort {
                     return
                 }
-                allMentionIds.insert(mention.uniqueId)
-                if allInteractionIds.contains(mention.uniqueMessageId) {
-                    allMessageMentionIds.insert(mention.uniqueId)
-                }
-            }
-
-            if shouldAbort {
-                return
-            }
 
-            StoryMessage.anyEnumerate(transaction: transaction, batchingPreference: .batched()) { message, stop in
-                guard isMainAppAndActive else {
+                guard let jobRecordAttachmentIds = findJobRecordAttachmentIds(transaction: transaction) else {
                     shouldAbort = true
-                    stop.pointee = true
                     return
                 }
-                if let attachmentUniqueId = legacyAttachmentUniqueId(message) {
-                    allStoryAttachmentIds.insert(attachmentUniqueId)
-                }
-            }
-
-            if shouldAbort {
-                return
-            }
 
-            guard let jobRecordAttachmentIds = findJobRecordAttachmentIds(transaction: transaction) else {
-                shouldAbort = true
-                return
+                allMessageAttachmentIds.formUnion(jobRecordAttachmentIds)
             }
 
-            allMessageAttachmentIds.formUnion(jobRecordAttachmentIds)
-
             activeStickerFilePaths.formUnion(StickerManager.filePathsForAllInstalledStickers(transaction: transaction))
 
             hasOrphanedPacksOrStickers = StickerManager.hasOrphanedData(tx: transaction)
@@ -553,16 +562,6 @@ enum OWSOrphanDataCleaner {
         var missingAttachmentIds = allMessageAttachmentIds
         missingAttachmentIds.subtract(allAttachmentIds)
 
-        var orphanReactionIds = allReactionIds
-        orphanReactionIds.subtract(allMessageReactionIds)
-        var missingReactionIds = allMessageReactionIds
-        missingReactionIds.subtract(allReactionIds)
-
-        var orphanMentionIds = allMentionIds
-        orphanMentionIds.subtract(allMessageMentionIds)
-        var missingMentionIds = allMessageMentionIds
-        missingMentionIds.subtract(allMentionIds)
-
         var orphanFileAndDirectoryPaths: Set<String> = []
         orphanFileAndDirectoryPaths.formUnion(voiceMessageDraftOrphanedPaths)
 
@@ -575,6 +574,15 @@ enum OWSOrphanDataCleaner {
                              hasOrphanedPacksOrStickers: hasOrphanedPacksOrStickers)
     }
 
+    private static func fetchUniqueIds(sql: String, transaction: SDSAnyReadTransaction) -> Set<String>? {
+        do {
+            return Set(try String.fetchAll(transaction.unwrapGrdbRead.database, sql: sql))
+        } catch {
+            owsFailDebug("Couldn't fetch unique ids: \(error)")
+            return nil
+        }
+    }
+
     /// Finds paths in `baseUrl` not present in `fetchExpectedRelativePaths()`.
     private static func findOrphanedPaths(
         baseUrl: URL,
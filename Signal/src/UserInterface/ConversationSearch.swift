@@ -122,6 +122,38 @@ extension ConversationSearchController: SearchResultsBarDelegate {
         }
 
         self.delegate?.conversationSearchController(self, didSelectMessageId: searchResult.messageId)
+
+        prefetchAdjacentResults(currentIndex: currentIndex, resultSet: resultSet)
+    }
+
+    /// How many messages on each side of a result to prefetch. Roughly what
+    /// the conversation view loads around a message it scrolls to.
+    private static let prefetchedMessageCountAroundResult = 16
+
+    /// Reads the messages around the results before and after the current
+    /// one, so that stepping to either doesn't wait on the database.
+    private func prefetchAdjacentResults(currentIndex: Int, resultSet: ConversationScreenSearchResultSet) {
+        let adjacentResults = [currentIndex - 1, currentIndex + 1].compactMap { resultSet.messages[safe: $0] }
+        guard !adjacentResults.isEmpty else {
+            return
+        }
+        let interactionFinder = InteractionFinder(threadUniqueId: thread.uniqueId)
+        let count = Self.prefetchedMessageCountAroundResult
+        databaseStorage.asyncRead { transaction in
+            for searchResult in adjacentResults {
+                let rowId = Int64(searchResult.sortId)
+                do {
+                    let olderIds = try interactionFinder.fetchUniqueIdsForConversationView(rowIdFilter: .before(rowId), limit: count, tx: transaction)
+                    let newerIds = try interactionFinder.fetchUniqueIdsForConversationView(rowIdFilter: .after(rowId), limit: count, tx: transaction)
+                    self.modelReadCaches.interactionReadCache.prefetchInteractions(
+                        uniqueIds: olderIds + [searchResult.messageId] + newerIds,
+                        transaction: transaction
+                    )
+                } catch {
+                    Logger.warn("Couldn't prefetch search result: \(error.grdbErrorForLogging)")
+                }
+            }
+        }
     }
 }
 
@@ -70,7 +70,12 @@ public class CLVLoader: Dependencies {
         }
     }
 
-    private static func loadRenderStateInternal(viewInfo: CLVViewInfo, transaction: SDSAnyReadTransaction) throws -> CLVRenderState {
+    /// - Parameter currentThreads: Threads whose instances are known to be up
+    /// to date, keyed by uniqueId. They're used in preference to the model
+    /// cache, which only holds a few dozen threads, and to the database.
+    private static func loadRenderStateInternal(viewInfo: CLVViewInfo,
+                                                currentThreads: [String: TSThread] = [:],
+                                                transaction: SDSAnyReadTransaction) throws -> CLVRenderState {
         let threadFinder = ThreadFinder()
         let isViewingArchive = viewInfo.chatListMode == .archive
 
@@ -108,10 +113,23 @@ public class CLVLoader: Dependencies {
                 break loading
             }
 
-            // 2. Try to pull as many threads as possible from the cache.
-            var threadIdToModelMap: [String: TSThread] = modelReadCaches.threadReadCache.getThreadsIfInCache(forUniqueIds: threadIds,
-                                                                                                             transaction: transaction)
-            var threadsToLoad = Set(threadIds)
+            // 2. Try to pull as many threads as possible from the current
+            //    threads, then from the cache.
+            var threadIdToModelMap = [String: TSThread]()
+            var threadIdsToLookUp = [String]()
+            for threadId in threadIds {
+                if let thread = currentThreads[threadId] {
+                    threadIdToModelMap[threadId] = thread
+                } else {
+                    threadIdsToLookUp.append(threadId)
+                }
+            }
+            if !threadIdsToLookUp.isEmpty {
+                let cachedThreads = modelReadCaches.threadReadCache.getThreadsIfInCache(forUniqueIds: threadIdsToLookUp,
+                                                                                        transaction: transaction)
+                threadIdToModelMap.merge(cachedThreads) { current, _ in current }
+            }
+            var threadsToLoad = Set(threadIdsToLookUp)
             threadsToLoad.subtract(threadIdToModelMap.keys)
 
             // 3. Bulk load any threads that are not in the cache in a
@@ -198,6 +216,16 @@ public class CLVLoader: Dependencies {
                                                        lastRenderState: CLVRenderState,
                                                        transaction: SDSAnyReadTransaction) throws -> CLVLoadResult {
 
+        // Threads that haven't been updated are unchanged since the last
+        // render state, so we reuse those instances rather than loading every
+        // visible thread again. Updated threads use the instances we fetch
+        // below.
+        var currentThreads = [String: TSThread]()
+        for thread in lastRenderState.pinnedThreads + lastRenderState.unpinnedThreads
+        where !allUpdatedItemIds.contains(thread.uniqueId) {
+            currentThreads[thread.uniqueId] = thread
+        }
+
         // Ignore updates to non-visible threads.
         var updatedItemIds = Set<String>()
         for threadId in allUpdatedItemIds {
@@ -205,12 +233,15 @@ public class CLVLoader: Dependencies {
                 // Missing thread, it was deleted and should no longer be visible.
                 continue
             }
+            currentThreads[threadId] = thread
             if thread.shouldThreadBeVisible {
                 updatedItemIds.insert(threadId)
             }
         }
 
-        let newRenderState = try Self.loadRenderStateInternal(viewInfo: viewInfo, transaction: transaction)
+        let newRenderState = try Self.loadRenderStateInternal(viewInfo: viewInfo,
+                                                              currentThreads: currentThreads,
+                                                              transaction: transaction)
 
         let oldPinnedThreadIds: [String] = lastRenderState.pinnedThreads.map(\.uniqueId)
         let oldUnpinnedThreadIds: [String] = lastRenderState.unpinnedThreads.map(\.uniqueId)
@@ -583,19 +583,32 @@ public class ConversationSearchViewController: UITableViewController {
 
         let isCanceled: () -> Bool = { [weak currentSearchCounter] in currentSearchCounter?.get() != searchCounter }
 
-        fetchSearchResults(
-            searchText: searchText,
-            isCanceled: isCanceled
-        ).done(on: DispatchQueue.main) { [weak self] searchResultSet in
+        let showSearchResults: (HomeScreenSearchResultSet?) -> Void = { [weak self] searchResultSet in
             guard let self, let searchResultSet, !isCanceled() else {
                 return
             }
             self.searchResultSet = searchResultSet
             self.reloadTableData()
         }
+
+        fetchSearchResults(
+            searchText: searchText,
+            isCanceled: isCanceled,
+            onPartialResults: { partialResultSet in
+                // Show chats and contacts while messages are still being
+                // searched, which can take a while in large databases.
+                // These are delivered to the main queue ahead of the final
+                // results, so they never replace them.
+                DispatchQueue.main.async { showSearchResults(partialResultSet) }
+            }
+        ).done(on: DispatchQueue.main, showSearchResults)
     }
 
-    private func fetchSearchResults(searchText: String, isCanceled: @escaping () -> Bool) -> Guarantee<HomeScreenSearchResultSet?> {
+    private func fetchSearchResults(
+        searchText: String,
+        isCanceled: @escaping () -> Bool,
+        onPartialResults: @escaping (HomeScreenSearchResultSet) -> Void
+    ) -> Guarantee<HomeScreenSearchResultSet?> {
         if searchText.isEmpty {
             return .value(.empty)
         }
@@ -605,6 +618,7 @@ public class ConversationSearchViewController: UITableViewController {
             future.resolve(searcher.searchForHomeScreen(
                 searchText: searchText,
                 isCanceled: isCanceled,
+                onPartialResults: onPartialResults,
                 transaction: transaction
             ))
         }
@@ -709,7 +709,10 @@ class StoryContextViewController: OWSViewController {
                 context = nextContext
             }
 
-            subsequentItems.forEach { $0.startAttachmentDownloadIfNecessary() }
+            subsequentItems.forEach { item in
+                item.startAttachmentDownloadIfNecessary()
+                StoryMediaPreloader.shared.preloadMedia(for: item)
+            }
         }
     }
 
@@ -844,7 +844,11 @@ class StoryItemMediaView: UIView {
         case .stream(let stream):
             let container = UIView()
 
-            guard let thumbnailImage = stream.attachment.attachmentStream.thumbnailImageSync(quality: .small) else {
+            let preloadedMedia = StoryMediaPreloader.shared.preloadedMedia(for: stream.attachment.attachmentStream)
+            guard
+                let thumbnailImage = preloadedMedia?.thumbnailImage
+                    ?? stream.attachment.attachmentStream.thumbnailImageSync(quality: .small)
+            else {
                 owsFailDebug("Failed to generate thumbnail for attachment stream")
                 return buildContentUnavailableView()
             }
@@ -863,7 +867,10 @@ class StoryItemMediaView: UIView {
                 container.addSubview(yyImageView)
                 yyImageView.autoPinEdgesToSuperviewEdges()
             case .image:
-                let imageView = buildImageView(attachment: stream.attachment.attachmentStream)
+                let imageView = buildImageView(
+                    attachment: stream.attachment.attachmentStream,
+                    preloadedImage: preloadedMedia?.image
+                )
                 container.addSubview(imageView)
                 imageView.autoPinEdgesToSuperviewEdges()
             case .audio, .file, .invalid:
@@ -945,8 +952,8 @@ class StoryItemMediaView: UIView {
         return animatedImageView
     }
 
-    private func buildImageView(attachment: TSResourceStream) -> UIView {
-        guard let image = try? attachment.decryptedImage() else {
+    private func buildImageView(attachment: TSResourceStream, preloadedImage: UIImage?) -> UIView {
+        guard let image = preloadedImage ?? (try? attachment.decryptedImage()) else {
             owsFailDebug("Could not load attachment.")
             return buildContentUnavailableView()
         }
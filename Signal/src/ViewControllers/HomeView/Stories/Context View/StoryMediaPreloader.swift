@@ -0,0 +1,95 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import SignalServiceKit
+
+/// Decodes the images of the stories that are about to be shown, so that
+/// `StoryItemMediaView` can show them as soon as the viewer reaches them
+/// rather than decrypting and decoding them on the main thread.
+///
+/// `StoryContextViewController` already enqueues downloads for the next few
+/// stories (which respect the user's media download settings); this picks up
+/// those that have finished downloading. Images are scaled down to the
+/// screen's size, and only a few are kept so that preloading a long run of
+/// stories can't use much memory.
+final class StoryMediaPreloader {
+    static let shared = StoryMediaPreloader()
+
+    struct PreloadedMedia {
+        /// The blurred background behind the story.
+        let thumbnailImage: UIImage
+        /// The decoded image, or nil for videos and animated images, which
+        /// are decoded as they play.
+        let image: UIImage?
+    }
+
+    private let cache = LRUCache<TSResourceId, PreloadedMedia>(
+        maxSize: 8,
+        shouldEvacuateInBackground: true,
+        maxCost: 48 * 1024 * 1024
+    )
+
+    private let queue = DispatchQueue(label: "org.signal.story-media-preloader", qos: .utility)
+
+    private let maxPixelSize: CGSize = {
+        let screenSize = UIScreen.main.nativeBounds.size
+        let maxDimension = max(screenSize.width, screenSize.height)
+        return CGSize(square: maxDimension)
+    }()
+
+    private init() {}
+
+    func preloadedMedia(for attachment: TSResourceStream) -> PreloadedMedia? {
+        return cache.get(key: attachment.resourceId)
+    }
+
+    func preloadMedia(for item: StoryItem) {
+        guard case .stream(let stream) = item.attachment else {
+            return
+        }
+        let attachmentStream = stream.attachment.attachmentStream
+        queue.async {
+            guard self.cache.get(key: attachmentStream.resourceId) == nil else {
+                return
+            }
+            guard let thumbnailImage = attachmentStream.thumbnailImageSync(quality: .small) else {
+                return
+            }
+            var image: UIImage?
+            if attachmentStream.computeContentType().isImage {
+                guard let decryptedImage = try? attachmentStream.decryptedImage() else {
+                    return
+                }
+                image = self.prepareForDisplay(decryptedImage)
+            }
+            let preloadedMedia = PreloadedMedia(thumbnailImage: thumbnailImage, image: image)
+            self.cache.set(
+                key: attachmentStream.resourceId,
+                value: preloadedMedia,
+                cost: Self.byteCost(of: thumbnailImage) + (image.map(Self.byteCost(of:)) ?? 0)
+            )
+        }
+    }
+
+    private func prepareForDisplay(_ image: UIImage) -> UIImage {
+        let pixelSize = CGSize(width: image.size.width * image.scale, height: image.size.height * image.scale)
+        guard pixelSize.width > 0, pixelSize.height > 0 else {
+            return image
+        }
+        let fitScale = min(maxPixelSize.width / pixelSize.width, maxPixelSize.height / pixelSize.height)
+        if fitScale < 1 {
+            let targetSize = CGSize(
+                width: (pixelSize.width * fitScale).rounded(.up),
+                height: (pixelSize.height * fitScale).rounded(.up)
+            )
+            return image.preparingThumbnail(of: targetSize) ?? image
+        }
+        return image.preparingForDisplay() ?? image
+    }
+
+    private static func byteCost(of image: UIImage) -> Int {
+        return Int(image.size.width * image.scale * image.size.height * image.scale) * 4
+    }
+}
@@ -180,7 +180,7 @@ class AudioCell: MediaTileListModeCell {
         if let incomingMessage = audioItem.interaction as? TSIncomingMessage {
             view.setViewed(incomingMessage.wasViewed, animated: false)
         } else if let outgoingMessage = audioItem.interaction as? TSOutgoingMessage {
-            view.setViewed(!outgoingMessage.viewedRecipientAddresses().isEmpty, animated: false)
+            view.setViewed(outgoingMessage.wasViewedByAnyRecipient, animated: false)
         }
 
         let measurementBuilder = CVCellMeasurement.Builder()
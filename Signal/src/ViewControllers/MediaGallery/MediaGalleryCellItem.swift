@@ -86,9 +86,16 @@ struct MediaGalleryCellItemAudio {
 
 class MediaGalleryCellItemPhotoVideo: PhotoGridItem {
     let galleryItem: MediaGalleryItem
+    /// If set, thumbnails are decoded at this size by `thumbnailLoader`.
+    private let thumbnailPixelSize: CGSize?
+    private let thumbnailLoader: MediaTileThumbnailLoader?
 
-    init(galleryItem: MediaGalleryItem) {
+    init(galleryItem: MediaGalleryItem,
+         thumbnailPixelSize: CGSize? = nil,
+         thumbnailLoader: MediaTileThumbnailLoader? = nil) {
         self.galleryItem = galleryItem
+        self.thumbnailPixelSize = thumbnailPixelSize
+        self.thumbnailLoader = thumbnailLoader
     }
 
     var type: PhotoGridItemType {
@@ -104,7 +111,11 @@ class MediaGalleryCellItemPhotoVideo: PhotoGridItem {
     var isFavorite: Bool { false }
 
     func asyncThumbnail(completion: @escaping (UIImage?) -> Void) {
-        galleryItem.thumbnailImage(completion: completion)
+        if let thumbnailLoader, let thumbnailPixelSize {
+            thumbnailLoader.loadThumbnail(for: galleryItem, pixelSize: thumbnailPixelSize, completion: completion)
+        } else {
+            galleryItem.thumbnailImage(completion: completion)
+        }
     }
 
     private var videoDurationPromise: Promise<TimeInterval> {
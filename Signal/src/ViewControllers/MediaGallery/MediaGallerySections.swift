@@ -318,6 +318,9 @@ internal struct MediaGallerySections<Loader: MediaGallerySectionLoader, UpdateUs
             }
         }
 
+        // Generic types can't have static stored properties.
+        private static var maxReplaceLoaderBatchSize: Int { 10_000 }
+
         internal mutating func replaceLoader(loader: Loader,
                                              batchSize: Int,
                                              loadUntil: GalleryDate,
@@ -327,10 +330,13 @@ internal struct MediaGallerySections<Loader: MediaGallerySectionLoader, UpdateUs
             // Ensure there is a journal.
             itemsBySection.removeAll()
 
-            // Load sections until `loadUntil` is all loaded.
-            // TODO: Load it all at once rather than in batches.
+            // Load sections until `loadUntil` is all loaded. Each batch is
+            // twice as big as the last so that reaching an old date takes a
+            // logarithmic number of queries.
+            var batchSize = batchSize
             while !hasFetchedOldest && (itemsBySection.orderedKeys.first ?? GalleryDate(date: .distantFuture)) > loadUntil {
                 _ = loadEarlierSections(batchSize: batchSize, transaction: transaction)
+                batchSize = min(batchSize * 2, Self.maxReplaceLoaderBatchSize)
             }
         }
 
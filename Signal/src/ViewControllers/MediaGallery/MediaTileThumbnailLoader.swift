@@ -0,0 +1,137 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import SignalServiceKit
+
+/// Loads the thumbnails shown in the media grid, decoded at the tiles'
+/// pixel size.
+///
+/// Decoded thumbnails are kept in memory, so a tile that scrolls back into
+/// view shows its image immediately rather than a placeholder, and the
+/// collection view's prefetching decodes the tiles that are about to appear.
+/// Prefetches run at a lower priority than loads for visible tiles, and are
+/// cancelled if their tiles are scrolled past before they start.
+class MediaTileThumbnailLoader {
+    private struct CacheKey: Hashable {
+        let attachmentId: MediaGalleryResourceId
+        let pixelWidth: Int
+        let pixelHeight: Int
+    }
+
+    /// Shared by every media grid, e.g. "All Media" for several chats.
+    private static let cache = LRUCache<CacheKey, UIImage>(
+        maxSize: 2000,
+        maxCost: 48 * 1024 * 1024
+    )
+
+    private let prefetchQueue = DispatchQueue(label: "org.signal.media-tile-thumbnail-prefetch", qos: .utility)
+
+    /// Only accessed on the main thread.
+    private var prefetchWorkItems = [CacheKey: DispatchWorkItem]()
+
+    func cachedThumbnail(for galleryItem: MediaGalleryItem, pixelSize: CGSize) -> UIImage? {
+        return Self.cache.get(key: Self.cacheKey(for: galleryItem, pixelSize: pixelSize))
+    }
+
+    /// Calls `completion` on the main thread with the thumbnail, immediately
+    /// if it's cached. Isn't called if there is no thumbnail.
+    func loadThumbnail(
+        for galleryItem: MediaGalleryItem,
+        pixelSize: CGSize,
+        completion: @escaping (UIImage) -> Void
+    ) {
+        AssertIsOnMainThread()
+
+        let cacheKey = Self.cacheKey(for: galleryItem, pixelSize: pixelSize)
+        if let image = Self.cache.get(key: cacheKey) {
+            completion(image)
+            return
+        }
+        // The tile is visible now, so don't also wait for its prefetch.
+        prefetchWorkItems.removeValue(forKey: cacheKey)?.cancel()
+
+        let attachmentStream = galleryItem.attachmentStream.attachmentStream
+        Task.detached(priority: .userInitiated) {
+            guard let image = await attachmentStream.thumbnailImage(quality: .small) else {
+                return
+            }
+            let preparedImage = Self.prepareAndCache(image, cacheKey: cacheKey)
+            DispatchQueue.main.async {
+                completion(preparedImage)
+            }
+        }
+    }
+
+    func prefetchThumbnails(for galleryItems: [MediaGalleryItem], pixelSize: CGSize) {
+        AssertIsOnMainThread()
+
+        for galleryItem in galleryItems {
+            let cacheKey = Self.cacheKey(for: galleryItem, pixelSize: pixelSize)
+            guard prefetchWorkItems[cacheKey] == nil, Self.cache.get(key: cacheKey) == nil else {
+                continue
+            }
+            let workItem = DispatchWorkItem { [weak self] in
+                if let image = galleryItem.thumbnailImageSync() {
+                    _ = Self.prepareAndCache(image, cacheKey: cacheKey)
+                }
+                DispatchQueue.main.async {
+                    self?.prefetchWorkItems[cacheKey] = nil
+                }
+            }
+            prefetchWorkItems[cacheKey] = workItem
+            prefetchQueue.async(execute: workItem)
+        }
+    }
+
+    func cancelPrefetching(for galleryItems: [MediaGalleryItem], pixelSize: CGSize) {
+        AssertIsOnMainThread()
+
+        for galleryItem in galleryItems {
+            prefetchWorkItems.removeValue(forKey: Self.cacheKey(for: galleryItem, pixelSize: pixelSize))?.cancel()
+        }
+    }
+
+    func cancelAllPrefetching() {
+        AssertIsOnMainThread()
+
+        prefetchWorkItems.values.forEach { $0.cancel() }
+        prefetchWorkItems.removeAll()
+    }
+
+    private static func cacheKey(for galleryItem: MediaGalleryItem, pixelSize: CGSize) -> CacheKey {
+        return CacheKey(
+            attachmentId: galleryItem.attachmentId,
+            pixelWidth: Int(pixelSize.width.rounded(.up)),
+            pixelHeight: Int(pixelSize.height.rounded(.up))
+        )
+    }
+
+    /// Scales `image` down to the smallest size that still fills the tile,
+    /// decoding it so that the main thread doesn't have to when it's first
+    /// drawn.
+    private static func prepareAndCache(_ image: UIImage, cacheKey: CacheKey) -> UIImage {
+        let imagePixelSize = CGSize(width: image.size.width * image.scale, height: image.size.height * image.scale)
+        var preparedImage: UIImage?
+        if imagePixelSize.width > 0, imagePixelSize.height > 0 {
+            let fillScale = max(
+                CGFloat(cacheKey.pixelWidth) / imagePixelSize.width,
+                CGFloat(cacheKey.pixelHeight) / imagePixelSize.height
+            )
+            if fillScale < 1 {
+                let targetSize = CGSize(
+                    width: (imagePixelSize.width * fillScale).rounded(.up),
+                    height: (imagePixelSize.height * fillScale).rounded(.up)
+                )
+                preparedImage = image.preparingThumbnail(of: targetSize)
+            } else {
+                preparedImage = image.preparingForDisplay()
+            }
+        }
+        let result = preparedImage ?? image
+        let cost = Int(result.size.width * result.scale * result.size.height * result.scale) * 4
+        cache.set(key: cacheKey, value: result, cost: cost)
+        return result
+    }
+}
@@ -104,6 +104,7 @@ class MediaTileViewController: UICollectionViewController, MediaGalleryDelegate,
             var indexPath: IndexPath?
             if layoutChanged || mediaCategoryChanged {
                 self.layout = layout
+                thumbnailLoader.cancelAllPrefetching()
                 indexPath = oldestVisibleIndexPath
                 rebuildLayout()
             }
@@ -245,6 +246,7 @@ class MediaTileViewController: UICollectionViewController, MediaGalleryDelegate,
             withReuseIdentifier: MediaGalleryEmptyContentView.reuseIdentifier
         )
         collectionView.delegate = self
+        collectionView.prefetchDataSource = self
         collectionView.alwaysBounceVertical = true
         collectionView.preservesSuperviewLayoutMargins = true
         collectionView.backgroundColor = UIColor(dynamicProvider: { _ in Theme.tableView2PresentedBackgroundColor })
@@ -786,11 +788,31 @@ class MediaTileViewController: UICollectionViewController, MediaGalleryDelegate,
     }
 
     private let mediaCache = CVMediaCache()
+    private let thumbnailLoader = MediaTileThumbnailLoader()
+
+    /// The pixel size of grid tiles, or nil if thumbnails aren't shown in
+    /// tiles. Cells that only show a small thumbnail (list mode) load it
+    /// at its default size.
+    private var thumbnailPixelSize: CGSize? {
+        guard layout == .grid, mediaCategory == .photoVideo else {
+            return nil
+        }
+        let itemSize = currentCollectionViewLayout.itemSize
+        guard itemSize != Self.invalidLayoutItemSize, itemSize.isNonEmpty else {
+            return nil
+        }
+        let scale = UIScreen.main.scale
+        return CGSize(width: itemSize.width * scale, height: itemSize.height * scale)
+    }
 
     private func cellItem(for galleryItem: MediaGalleryItem) -> MediaGalleryCellItem {
         switch mediaCategory {
         case .photoVideo:
-            return .photoVideo(MediaGalleryCellItemPhotoVideo(galleryItem: galleryItem))
+            return .photoVideo(MediaGalleryCellItemPhotoVideo(
+                galleryItem: galleryItem,
+                thumbnailPixelSize: thumbnailPixelSize,
+                thumbnailLoader: thumbnailLoader
+            ))
         case .audio:
             return .audio(MediaGalleryCellItemAudio(
                 message: galleryItem.message,
@@ -1128,6 +1150,11 @@ class MediaTileViewController: UICollectionViewController, MediaGalleryDelegate,
 
     var isFetchingMoreData = false
     let kLoadBatchSize: Int = 100
+    // Eager loads start at kLoadBatchSize and load as many items as are
+    // already loaded, up to this limit, so a gallery with tens of thousands
+    // of items is measured in a handful of loads and collection view updates
+    // rather than hundreds.
+    let kMaxEagerLoadBatchSize: Int = 10_000
 
     let kLoadOlderSectionIdx: Int = 0
     var loadNewerSectionIdx: Int {
@@ -1153,7 +1180,11 @@ class MediaTileViewController: UICollectionViewController, MediaGalleryDelegate,
         // This is a low priority update because we never want eager loads to starve user-initiated
         // loads (such as loading more sections because of scrolling or loading items to display).
         Logger.debug("Will eagerly load earlier sections")
-        mediaGallery.asyncLoadEarlierSections(batchSize: kLoadBatchSize,
+        let loadedItemCount = (0..<mediaGallery.galleryDates.count).reduce(0) { count, sectionIndex in
+            count + mediaGallery.numberOfItemsInSection(sectionIndex)
+        }
+        let batchSize = loadedItemCount.clamp(kLoadBatchSize, kMaxEagerLoadBatchSize)
+        mediaGallery.asyncLoadEarlierSections(batchSize: batchSize,
                                               highPriority: false,
                                               userData: userData) { [weak self] newSections in
             Logger.debug("Eagerly loaded \(newSections)")
@@ -1216,6 +1247,48 @@ class MediaTileViewController: UICollectionViewController, MediaGalleryDelegate,
     }
 }
 
+// MARK: -
+
+extension MediaTileViewController: UICollectionViewDataSourcePrefetching {
+
+    private func galleryItemsForPrefetching(at indexPaths: [IndexPath]) -> [MediaGalleryItem] {
+        guard !mediaGallery.galleryDates.isEmpty else {
+            return []
+        }
+        return indexPaths.compactMap { indexPath in
+            guard indexPath.section != kLoadOlderSectionIdx, indexPath.section != loadNewerSectionIdx else {
+                return nil
+            }
+            // This also starts loading the items that haven't been loaded yet;
+            // their thumbnails are requested when their cells are configured.
+            return galleryItem(at: indexPath, loadAsync: true)
+        }
+    }
+
+    func collectionView(_ collectionView: UICollectionView, prefetchItemsAt indexPaths: [IndexPath]) {
+        let galleryItems = galleryItemsForPrefetching(at: indexPaths)
+        guard let thumbnailPixelSize, !galleryItems.isEmpty else {
+            return
+        }
+        thumbnailLoader.prefetchThumbnails(for: galleryItems, pixelSize: thumbnailPixelSize)
+    }
+
+    func collectionView(_ collectionView: UICollectionView, cancelPrefetchingForItemsAt indexPaths: [IndexPath]) {
+        guard let thumbnailPixelSize, !mediaGallery.galleryDates.isEmpty else {
+            return
+        }
+        let galleryItems = indexPaths.compactMap { indexPath -> MediaGalleryItem? in
+            guard indexPath.section != kLoadOlderSectionIdx, indexPath.section != loadNewerSectionIdx else {
+                return nil
+            }
+            return mediaGallery.galleryItemWithoutLoading(at: mediaGalleryIndexPath(indexPath))
+        }
+        thumbnailLoader.cancelPrefetching(for: galleryItems, pixelSize: thumbnailPixelSize)
+    }
+}
+
+// MARK: -
+
 extension MediaTileViewController: MediaPresentationContextProvider {
 
     func mediaPresentationContext(item: Media, in coordinateSpace: UICoordinateSpace) -> MediaPresentationContext? {
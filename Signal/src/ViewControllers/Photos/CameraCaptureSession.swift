@@ -69,7 +69,9 @@ protocol CameraCaptureSessionDelegate: AnyObject {
 
 class CameraCaptureSession: NSObject {
 
-    private weak var delegate: CameraCaptureSessionDelegate?
+    /// Set on the main thread; may be set later (see ``CameraCaptureSessionWarmer``),
+    /// but before the session starts running.
+    weak var delegate: CameraCaptureSessionDelegate?
 
     // There can only ever be one `CapturePreviewView` per AVCaptureSession
     lazy var previewView = CapturePreviewView(session: avCaptureSession)
@@ -90,12 +92,17 @@ class CameraCaptureSession: NSObject {
 
     private let photoCapture = PhotoCapture()
     private let videoCapture: VideoCapture
+    let qrCodeSampleBufferScanner: QRCodeSampleBufferScanner
+
+    /// Main thread only.
+    private var configurationPromise: Promise<Void>?
 
     init(
-        delegate: CameraCaptureSessionDelegate,
+        delegate: CameraCaptureSessionDelegate?,
         qrCodeSampleBufferScanner: QRCodeSampleBufferScanner
     ) {
         self.delegate = delegate
+        self.qrCodeSampleBufferScanner = qrCodeSampleBufferScanner
         self.videoCapture = VideoCapture(qrCodeSampleBufferScanner: qrCodeSampleBufferScanner)
 
         super.init()
@@ -125,15 +132,35 @@ class CameraCaptureSession: NSObject {
         // If the session is already running, no need to do anything.
         guard !avCaptureSession.isRunning else { return Promise.value(()) }
 
-        let initialCaptureOrientation = beginObservingOrientationChanges()
+        if let initialCaptureOrientation = beginObservingOrientationChanges() {
+            sessionQueue.async {
+                self.captureOrientation = initialCaptureOrientation
+            }
+        }
 
-        return sessionQueue.async(.promise) { [weak self] in
+        return configure()
+    }
+
+    /// Adds the session's inputs and outputs, on the session queue.
+    ///
+    /// This is most of the cost of opening the camera, and doesn't start the
+    /// session running, so it can be done before the camera is shown. Only
+    /// configures the session once; later calls return the same promise.
+    func configure() -> Promise<Void> {
+        AssertIsOnMainThread()
+        guard !Platform.isSimulator else {
+            return Promise.value(())
+        }
+        if let configurationPromise {
+            return configurationPromise
+        }
+
+        let configurationPromise = sessionQueue.async(.promise) { [weak self] in
             guard let self else { return }
 
             self.avCaptureSession.beginConfiguration()
             defer { self.avCaptureSession.commitConfiguration() }
 
-            self.captureOrientation = initialCaptureOrientation ?? self.captureOrientation
             self.avCaptureSession.sessionPreset = .high
 
             // 1. Reconfigure which camera to use.
@@ -164,6 +191,8 @@ class CameraCaptureSession: NSObject {
                 owsFailDebug("Could not add AVCaptureAudioDataOutput.")
             }
         }
+        self.configurationPromise = configurationPromise
+        return configurationPromise
     }
 
     @discardableResult
@@ -186,6 +215,12 @@ class CameraCaptureSession: NSObject {
         assertOnQueue(sessionQueue)
     }
 
+    /// Calls `block` (on a capture queue) when the next video frame is captured,
+    /// e.g. to measure how long the camera takes to show its preview.
+    func onNextVideoFrame(_ block: @escaping () -> Void) {
+        videoCapture.onNextVideoFrame(block)
+    }
+
     // This method should be called on the serial queue, and between calls to session.beginConfiguration/commitConfiguration
     func reconfigureVideoCaptureInput() throws {
         assertIsOnSessionQueue()
@@ -1179,6 +1214,9 @@ private class VideoCapture: NSObject, AVCaptureVideoDataOutputSampleBufferDelega
     private var timeOfFirstAppendedVideoSampleBuffer = CMTime.invalid
     private var timeOfLastAppendedVideoSampleBuffer = CMTime.invalid
 
+    private let nextVideoFrameBlockLock = UnfairLock()
+    private var nextVideoFrameBlock: (() -> Void)?
+
     init(qrCodeSampleBufferScanner: QRCodeSampleBufferScanner) {
         self.qrCodeSampleBufferScanner = qrCodeSampleBufferScanner
         super.init()
@@ -1268,6 +1306,12 @@ private class VideoCapture: NSObject, AVCaptureVideoDataOutputSampleBufferDelega
         }
     }
 
+    func onNextVideoFrame(_ block: @escaping () -> Void) {
+        nextVideoFrameBlockLock.withLock {
+            nextVideoFrameBlock = block
+        }
+    }
+
     // main thread
     func stopRecording() {
         AssertIsOnMainThread()
@@ -1399,6 +1443,14 @@ private class VideoCapture: NSObject, AVCaptureVideoDataOutputSampleBufferDelega
 
     // `videoCaptureQueue` or `audioCaptureQueue`
     func captureOutput(_ output: AVCaptureOutput, didOutput sampleBuffer: CMSampleBuffer, from connection: AVCaptureConnection) {
+        if output === videoDataOutput {
+            let nextVideoFrameBlock = nextVideoFrameBlockLock.withLock {
+                defer { self.nextVideoFrameBlock = nil }
+                return self.nextVideoFrameBlock
+            }
+            nextVideoFrameBlock?()
+        }
+
         guard assetWriter != nil else {
             // Scan for QR codes when _not_ recording.
             qrCodeSampleBufferScanner.captureOutput(output, didOutput: sampleBuffer, from: connection)
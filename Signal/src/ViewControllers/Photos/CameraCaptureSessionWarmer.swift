@@ -0,0 +1,108 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import AVFoundation
+import SignalServiceKit
+import SignalUI
+
+/// Configures a `CameraCaptureSession` before the camera is shown, so that
+/// `PhotoCaptureViewController` opens quickly from the conversation input
+/// toolbar.
+///
+/// Adding the camera input and the outputs to the capture session is most of
+/// the cost of opening the camera, and doesn't need the session to be
+/// running. So that's done as soon as the user looks likely to take a photo,
+/// and the session is only started once the camera is shown (which also
+/// keeps the system's camera indicator off until then). A session that isn't
+/// used is released when the app is backgrounded or memory runs low.
+final class CameraCaptureSessionWarmer {
+    static let shared = CameraCaptureSessionWarmer()
+
+    /// Don't warm up again this soon after a memory warning.
+    private static let memoryWarningCooldown: TimeInterval = 60
+
+    private var warmSession: CameraCaptureSession?
+    private var lastMemoryWarningDate: MonotonicDate?
+
+    private init() {
+        NotificationCenter.default.addObserver(
+            self,
+            selector: #selector(didReceiveMemoryWarning),
+            name: UIApplication.didReceiveMemoryWarningNotification,
+            object: nil
+        )
+        NotificationCenter.default.addObserver(
+            self,
+            selector: #selector(applicationDidEnterBackground),
+            name: .OWSApplicationDidEnterBackground,
+            object: nil
+        )
+    }
+
+    /// Configures a session if there isn't one waiting already. Cheap to call
+    /// repeatedly, e.g. while the user is typing.
+    func warmUp() {
+        AssertIsOnMainThread()
+
+        guard warmSession == nil, !Platform.isSimulator else {
+            return
+        }
+        // Configuring the session would otherwise prompt for, or fail
+        // without, camera access; `takePictureOrVideo` asks for it first.
+        guard AVCaptureDevice.authorizationStatus(for: .video) == .authorized else {
+            return
+        }
+        if
+            let lastMemoryWarningDate,
+            MonotonicDate() < lastMemoryWarningDate.adding(Self.memoryWarningCooldown)
+        {
+            return
+        }
+
+        let session = CameraCaptureSession(
+            delegate: nil,
+            qrCodeSampleBufferScanner: QRCodeSampleBufferScanner(delegate: nil)
+        )
+        warmSession = session
+        session.configure().catch { [weak self, weak session] error in
+            Logger.warn("Couldn't configure camera ahead of time: \(error)")
+            guard let self, let session, self.warmSession === session else {
+                return
+            }
+            self.warmSession = nil
+        }
+    }
+
+    /// Hands over the configured session, if any; it's then the caller's to
+    /// start. Each session is only handed over once.
+    func takeWarmSession() -> CameraCaptureSession? {
+        AssertIsOnMainThread()
+
+        defer { warmSession = nil }
+        return warmSession
+    }
+
+    func coolDown() {
+        AssertIsOnMainThread()
+
+        warmSession = nil
+    }
+
+    @objc
+    private func didReceiveMemoryWarning() {
+        AssertIsOnMainThread()
+
+        lastMemoryWarningDate = MonotonicDate()
+        if warmSession != nil {
+            Logger.info("Releasing warm camera session after memory warning.")
+        }
+        coolDown()
+    }
+
+    @objc
+    private func applicationDidEnterBackground() {
+        coolDown()
+    }
+}
@@ -38,11 +38,21 @@ class PhotoCaptureViewController: OWSViewController, OWSNavigationChildControlle
     weak var dataSource: PhotoCaptureViewControllerDataSource?
     private var interactiveDismiss: PhotoCaptureInteractiveDismiss?
 
-    private lazy var qrCodeSampleBufferScanner = QRCodeSampleBufferScanner(delegate: self)
-    lazy var cameraCaptureSession = CameraCaptureSession(
-        delegate: self,
-        qrCodeSampleBufferScanner: qrCodeSampleBufferScanner
-    )
+    /// Whether `cameraCaptureSession` was configured before we were shown.
+    private var isCameraCaptureSessionWarm = false
+
+    lazy var cameraCaptureSession: CameraCaptureSession = {
+        if let warmSession = CameraCaptureSessionWarmer.shared.takeWarmSession() {
+            isCameraCaptureSessionWarm = true
+            warmSession.delegate = self
+            warmSession.qrCodeSampleBufferScanner.delegate = self
+            return warmSession
+        }
+        return CameraCaptureSession(
+            delegate: self,
+            qrCodeSampleBufferScanner: QRCodeSampleBufferScanner(delegate: self)
+        )
+    }()
 
     private var qrCodeScanned = false {
         didSet {
@@ -1208,6 +1218,13 @@ extension PhotoCaptureViewController {
             return
         }
 
+        let setupDate = MonotonicDate()
+        let sessionDescription = isCameraCaptureSessionWarm ? "pre-configured" : "new"
+        cameraCaptureSession.onNextVideoFrame {
+            let elapsedMs = (MonotonicDate() - setupDate) / NSEC_PER_MSEC
+            Logger.info("First camera frame after \(elapsedMs)ms (\(sessionDescription) session).")
+        }
+
         firstly {
             cameraCaptureSession.prepare()
         }.catch { [weak self] error in
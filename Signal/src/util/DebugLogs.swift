@@ -168,6 +168,8 @@ class DebugLogs: NSObject {
         let zipDirPath = zipDirUrl.path
         OWSFileSystem.ensureDirectoryExists(zipDirPath)
 
+        MemoryProfiler.shared.writeProfileNow()
+
         let logFilePaths = DebugLogger.shared.allLogFilePaths
         if logFilePaths.isEmpty {
             return .failure(NoLogsError())
@@ -215,6 +217,9 @@ class DebugLogs: NSObject {
         }
 
         // Phase 0. Flush any pending logs to disk.
+        if AppReadiness.isAppReady {
+            SlowQueryLog.shared.logReport(databaseStorage: SSKEnvironment.shared.databaseStorageRef)
+        }
         Logger.info("About to zip debug logs")
         Logger.flush()
 
@@ -238,10 +238,10 @@ public class DisplayableText: NSObject {
     ) -> DisplayableText {
         let textValue: CVTextValue
         if messageBody.ranges.hasRanges {
-            let hydrated = messageBody
-                .hydrating(
-                    mentionHydrator: ContactsMentionHydrator.mentionHydrator(transaction: transaction.asV2Read)
-                )
+            let hydrated = HydratedMessageBodyCache.shared.hydratedBody(
+                for: messageBody,
+                tx: transaction.asV2Read
+            )
             textValue = .messageBody(hydrated)
         } else {
             textValue = .text(messageBody.text)
@@ -258,6 +258,8 @@ private class MockOutgoingMessage: TSOutgoingMessage {
 
     override var messageState: TSOutgoingMessageState { .sent }
 
+    override var wasReadByAnyRecipient: Bool { true }
+
     override func readRecipientAddresses() -> [SignalServiceAddress] {
         // makes message appear as read
         return [MockConversationView.mockAddress]
@@ -40,6 +40,11 @@ class TransferProgressView: UIStackView {
         formatter.includesTimeRemainingPhrase = true
         return formatter
     }()
+    let byteCountFormatter: ByteCountFormatter = {
+        let formatter = ByteCountFormatter()
+        formatter.countStyle = .file
+        return formatter
+    }()
 
     init(progress: Progress) {
         self.progress = progress
@@ -99,14 +104,31 @@ class TransferProgressView: UIStackView {
             return super.observeValue(forKeyPath: keyPath, of: object, change: change, context: context)
         }
 
-        DispatchMainThreadSafe {
+        // Progress can tick far more often than we can redraw, so only the
+        // latest update needs to run.
+        MainThreadScheduler.shared.schedule(coalescingKey: "TransferProgressView-\(ObjectIdentifier(self).hashValue)") {
             guard self.isObservingProgress else { return }
 
             self.topLabel.text = "\(Int(self.progress.fractionCompleted * 100))%"
             self.progressBar.setProgress(Float(self.progress.fractionCompleted), animated: true)
 
-            if let estimatedTime = self.progress.estimatedTimeRemaining, estimatedTime.isFinite {
-                self.bottomLabel.text = self.dateComponentsFormatter.string(from: estimatedTime)
+            if
+                let estimatedTime = self.progress.estimatedTimeRemaining,
+                estimatedTime.isFinite,
+                let formattedTime = self.dateComponentsFormatter.string(from: estimatedTime)
+            {
+                if let throughput = self.progress.throughput, throughput > 0 {
+                    self.bottomLabel.text = String(
+                        format: OWSLocalizedString(
+                            "DEVICE_TRANSFER_TRANSFERRING_TIME_REMAINING_AND_THROUGHPUT_FORMAT",
+                            comment: "Format for the time remaining and the current transfer speed on the action sheet that shows transfer progress. Embeds {{ %1$@ the time remaining, e.g. 'About 5 minutes remaining', %2$@ the amount of data transferred per second, e.g. '12 MB' }}."
+                        ),
+                        formattedTime,
+                        self.byteCountFormatter.string(fromByteCount: Int64(throughput))
+                    )
+                } else {
+                    self.bottomLabel.text = formattedTime
+                }
             } else {
                 self.bottomLabel.text = nil
             }
@@ -63,6 +63,7 @@ final class CallsListViewControllerViewModelLoaderTest: XCTestCase {
 
     private func setUpViewModelLoader(
         viewModelPageSize: UInt,
+        firstPageSize: UInt? = nil,
         maxCachedViewModelCount: Int,
         maxCoalescedCallsInOneViewModel: UInt = 100
     ) {
@@ -71,6 +72,7 @@ final class CallsListViewControllerViewModelLoaderTest: XCTestCase {
             createCallViewModelBlock: { self.createCallViewModelBlock($0, $1, $2) },
             fetchCallRecordBlock: { self.fetchCallRecordBlock($0, $1) },
             viewModelPageSize: viewModelPageSize,
+            firstPageSize: firstPageSize,
             maxCachedViewModelCount: maxCachedViewModelCount,
             maxCoalescedCallsInOneViewModel: maxCoalescedCallsInOneViewModel
         )
@@ -282,6 +284,24 @@ final class CallsListViewControllerViewModelLoaderTest: XCTestCase {
         assertCachedCallIds([6, 6000], atLoadedViewModelReferenceIndex: 5)
     }
 
+    func testSmallerFirstPage() {
+        var timestamp = SequentialTimestampBuilder()
+
+        mockCallRecordLoader.callRecords = (1...6).map { idx -> CallRecord in
+            return .fixture(callId: UInt64(idx), timestamp: timestamp.uncoalescable(), threadRowId: Int64(idx))
+        }
+
+        setUpViewModelLoader(viewModelPageSize: 4, firstPageSize: 2, maxCachedViewModelCount: 8)
+
+        XCTAssertTrue(loadMore(direction: .older))
+        assertLoadedCallIds([1], [2])
+        assertCached(loadedViewModelReferenceIndices: 0..<2)
+
+        XCTAssertTrue(loadMore(direction: .older))
+        assertLoadedCallIds([1], [2], [3], [4], [5], [6])
+        assertCached(loadedViewModelReferenceIndices: 0..<6)
+    }
+
     /// Load a ton of calls, such that the cached view models have long ago
     /// dropped the first-loaded calls, and then simulate a super-fast scroll to
     /// the top, then the bottom, by loading until the first, then the last,
@@ -139,6 +139,28 @@ class PaymentsReconciliationTest: SignalBaseTest {
         }
     }
 
+    func test_reconcileAccountActivity_reconciledBlocksAreSkipped() {
+        do {
+            try databaseStorage.read { (transaction) -> Void in
+                let buildItem2a_incomingUnspent = Self.buildItem2a_incomingUnspent()
+                let transactionHistory = MockTransactionHistory(items: [
+                    buildItem2a_incomingUnspent
+                ],
+                blockCount: 3)
+                let databaseState = Self.buildPaymentsDatabaseState_empty()
+                // The item's block has already been reconciled, so there's
+                // nothing to fill in.
+                try PaymentsReconciliation.reconcile(transactionHistory: transactionHistory,
+                                                     databaseState: databaseState,
+                                                     reconciledBlockIndex: buildItem2a_incomingUnspent.receivedBlock.index,
+                                                     transaction: transaction)
+            }
+        } catch {
+            owsFailDebug("Error: \(error)")
+            XCTFail("Error: \(error)")
+        }
+    }
+
     func test_reconcileAccountActivity_fillIn1() {
         do {
             try databaseStorage.write { (transaction) -> Void in
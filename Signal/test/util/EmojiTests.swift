@@ -185,6 +185,26 @@ class EmojiTests: XCTestCase {
         }
     }
 
+    func testRawValueRoundTrip() {
+        for emoji in Emoji.allCases {
+            XCTAssertEqual(EmojiWithSkinTones(rawValue: emoji.rawValue), EmojiWithSkinTones(baseEmoji: emoji), emoji.rawValue)
+            for (skinTones, rawValue) in emoji.emojiPerSkinTonePermutation ?? [:] {
+                XCTAssertEqual(EmojiWithSkinTones(rawValue: rawValue), EmojiWithSkinTones(baseEmoji: emoji, skinTones: skinTones), rawValue)
+            }
+        }
+    }
+
+    func testRawValueParsingPerformance() {
+        let rawValues = Emoji.allCases.flatMap { emoji in
+            [emoji.rawValue] + (emoji.emojiPerSkinTonePermutation.map { Array($0.values) } ?? [])
+        }
+        measure {
+            for rawValue in rawValues {
+                XCTAssertNotNil(EmojiWithSkinTones(rawValue: rawValue))
+            }
+        }
+    }
+
     func testMoreEmojiCases() {
         let moreEmojis = [
             "😍",
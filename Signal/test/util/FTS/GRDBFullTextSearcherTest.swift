@@ -533,6 +533,126 @@ class GRDBFullTextSearcherTest: SignalBaseTest {
         AssertValidResultSet(query: "DEFEAT", expectedResultCount: 0)
     }
 
+    func testPartialResults() {
+        var partialResultSets = [HomeScreenSearchResultSet]()
+        let resultSet = self.read { transaction in
+            self.searcher.searchForHomeScreen(
+                searchText: "Club",
+                isCanceled: { false },
+                onPartialResults: { partialResultSets.append($0) },
+                transaction: transaction
+            )!
+        }
+
+        // Chats are reported before any messages are searched.
+        XCTAssertEqual(partialResultSets.count, 1)
+        AssertEqualThreadLists(
+            [bookClubThreadViewModel, snackClubThreadViewModel],
+            partialResultSets.first?.groupThreadResults.map { $0.threadViewModel } ?? []
+        )
+        XCTAssertEqual(partialResultSets.first?.messageResults.count, 0)
+
+        XCTAssertEqual(resultSet.groupThreadResults.count, 2)
+        XCTAssertEqual(["Goodbye Book Club", "Hello Book Club"], bodies(forMessageResults: resultSet.messageResults))
+    }
+
+    func testMaxMessageResults() {
+        let resultSet = self.read { transaction in
+            self.searcher.searchForHomeScreen(
+                searchText: "Club",
+                maxMessageResults: 1,
+                isCanceled: { false },
+                transaction: transaction
+            )!
+        }
+        XCTAssertEqual(resultSet.groupThreadResults.count, 2)
+        XCTAssertEqual(resultSet.messageResults.count, 1)
+    }
+
+    func testCanceledSearch() {
+        var partialResultSets = [HomeScreenSearchResultSet]()
+        let resultSet = self.read { transaction in
+            self.searcher.searchForHomeScreen(
+                searchText: "Club",
+                isCanceled: { true },
+                onPartialResults: { partialResultSets.append($0) },
+                transaction: transaction
+            )
+        }
+        XCTAssertNil(resultSet)
+        XCTAssertEqual(partialResultSets.count, 0)
+    }
+
+    func testDeferredIndexing() {
+        var thread: TSGroupThread! = nil
+        self.write { transaction in
+            thread = try! GroupManager.createGroupForTests(
+                members: [self.aliceRecipient.address, self.bobRecipient.address, DependenciesBridge.shared.tsAccountManager.localIdentifiers(tx: transaction.asV2Read)!.aciAddress],
+                shouldInsertInfoMessage: true,
+                name: "Deferred",
+                transaction: transaction
+            )
+        }
+
+        let message = TSOutgoingMessage(in: thread, messageBody: "Some thoughts on serendipity and such.")
+        self.write { transaction in
+            message.anyInsert(transaction: transaction)
+        }
+
+        // Queued messages are found before they're indexed...
+        AssertValidResultSet(query: "serendipity", expectedResultCount: 1)
+        AssertValidResultSet(query: "SEREN thought", expectedResultCount: 1)
+        AssertValidResultSet(query: "serendipity unrelated", expectedResultCount: 0)
+
+        var indexedCount = 0
+        self.write { transaction in
+            indexedCount = try! FullTextSearchIndexer.indexPendingMessages(limit: 1000, tx: transaction)
+        }
+        XCTAssertGreaterThan(indexedCount, 0)
+        self.write { transaction in
+            XCTAssertEqual(try! FullTextSearchIndexer.indexPendingMessages(limit: 1000, tx: transaction), 0)
+        }
+
+        // ...and aren't found twice afterwards.
+        AssertValidResultSet(query: "serendipity", expectedResultCount: 1)
+        AssertValidResultSet(query: "SEREN thought", expectedResultCount: 1)
+
+        self.write { transaction in
+            message.update(withMessageBody: "Some thoughts on luck.", transaction: transaction)
+        }
+        AssertValidResultSet(query: "serendipity", expectedResultCount: 0)
+        AssertValidResultSet(query: "luck", expectedResultCount: 1)
+    }
+
+    func testSearchWithinConversation() {
+        let thread = bookClubThreadViewModel.threadRecord
+
+        func search(_ searchText: String) -> ConversationScreenSearchResultSet {
+            self.read { transaction in
+                self.searcher.searchWithinConversation(thread: thread, searchText: searchText, transaction: transaction)
+            }
+        }
+
+        func assertResults(file: StaticString = #file, line: UInt = #line) {
+            let resultSet = search("Book Club")
+            XCTAssertEqual(resultSet.messages.count, 2, file: file, line: line)
+            // Newest first.
+            XCTAssertEqual(resultSet.messageSortIds, resultSet.messageSortIds.sorted(by: >), file: file, line: line)
+            XCTAssertTrue(resultSet.messages.allSatisfy { $0.snippet?.contains("<\(FullTextSearchIndexer.matchTag)>") == true }, file: file, line: line)
+
+            // Messages in other threads don't match.
+            XCTAssertEqual(search("Alice").messages.count, 0, file: file, line: line)
+            XCTAssertEqual(search("Goodbye").messages.count, 1, file: file, line: line)
+        }
+
+        // Queued messages, and then indexed ones, are found.
+        assertResults()
+        self.write { transaction in
+            _ = try! FullTextSearchIndexer.indexPendingMessages(limit: 1000, tx: transaction)
+        }
+        assertResults()
+    }
+
     // MARK: - Perf
 
     func testPerf() {
@@ -568,7 +688,7 @@ class GRDBFullTextSearcherTest: SignalBaseTest {
             }
         }
 
-        Bench(title: "Search", memorySamplerRatio: 1) { _ in
+        measure(metrics: [XCTClockMetric(), XCTCPUMetric(), XCTMemoryMetric()]) {
             self.read { transaction in
                 let getMatchCount = { (searchText: String) -> UInt in
                     var count: UInt = 0
@@ -585,6 +705,8 @@ class GRDBFullTextSearcherTest: SignalBaseTest {
                 XCTAssertEqual(1, getMatchCount(string2))
                 XCTAssertEqual(0, getMatchCount(UUID().uuidString))
             }
+            // The home screen search also matches threads and contacts.
+            XCTAssertFalse(self.getResultSet(searchText: string1).messageResults.isEmpty)
         }
     }
 
@@ -72,6 +72,7 @@ internal struct PreKeyTaskManager {
     /// ALWAYS changes the targeted keys (regardless of current key state)
     internal func createForRegistration() async throws -> RegistrationPreKeyUploadBundles {
         PreKey.logger.info("Create for registration")
+        PreKeyPairPool.shared.prepare()
 
         try Task.checkCancellation()
         let (aciBundle, pniBundle) = try await db.awaitableWrite { tx in
@@ -92,6 +93,7 @@ internal struct PreKeyTaskManager {
         pniIdentityKeyPair: ECKeyPair
     ) async throws -> RegistrationPreKeyUploadBundles {
         PreKey.logger.info("Create for provisioning")
+        PreKeyPairPool.shared.prepare()
 
         try Task.checkCancellation()
         let (aciBundle, pniBundle) = try await db.awaitableWrite { tx in
@@ -143,6 +145,10 @@ internal struct PreKeyTaskManager {
         force: Bool = false,
         auth: ChatServiceAuth
     ) async throws {
+        // Generate key pairs while we wait for message processing and check
+        // what needs refreshing, so they're ready if we do need new keys.
+        PreKeyPairPool.shared.prepare()
+
         try Task.checkCancellation()
         try await waitForMessageProcessing(identity: identity)
         try Task.checkCancellation()
@@ -197,6 +203,7 @@ internal struct PreKeyTaskManager {
         auth: ChatServiceAuth
     ) async throws {
         PreKey.logger.info("[\(identity)] Rotate [\(targets)]")
+        PreKeyPairPool.shared.prepare()
         try Task.checkCancellation()
         try await waitForMessageProcessing(identity: identity)
         try Task.checkCancellation()
@@ -218,6 +225,7 @@ internal struct PreKeyTaskManager {
         auth: ChatServiceAuth
     ) async throws {
         PreKey.logger.info("[\(identity)] Create one-time prekeys")
+        PreKeyPairPool.shared.prepare()
         try Task.checkCancellation()
         let bundle = try await db.awaitableWrite { tx in
             let identityKeyPair = try self.requireIdentityKeyPair(for: identity, tx: tx)
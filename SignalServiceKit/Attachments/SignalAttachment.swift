@@ -1063,15 +1063,31 @@ public class SignalAttachment: NSObject {
     private func removingImageMetadata() throws -> SignalAttachment {
         owsAssertDebug(isImage)
 
+        // Write the cleaned image to disk rather than keeping it in memory;
+        // the share extension may prepare many large images at once.
+        guard let fileExtension = MimeTypeUtil.fileExtensionForUtiType(dataUTI) else {
+            throw SignalAttachmentError.couldNotRemoveMetadata
+        }
+        let outputUrl = OWSFileSystem.temporaryFileUrl(fileExtension: fileExtension)
+
         if dataUTI == UTType.png.identifier {
             let cleanedData = try Self.removeMetadata(fromPng: data)
-            guard let dataSource = DataSourceValue(cleanedData, utiType: dataUTI) else {
+            do {
+                try cleanedData.write(to: outputUrl)
+                return replacingDataSource(with: try DataSourcePath(fileUrl: outputUrl, shouldDeleteOnDeallocation: true))
+            } catch {
+                Logger.warn("Could not write cleaned PNG: \(error)")
                 throw SignalAttachmentError.couldNotRemoveMetadata
             }
-            return replacingDataSource(with: dataSource)
         }
 
-        guard let source = CGImageSourceCreateWithData(data as CFData, nil) else {
+        let source: CGImageSource?
+        if let dataUrl = dataSource.dataUrl {
+            source = CGImageSourceCreateWithURL(dataUrl as CFURL, [kCGImageSourceShouldCache: false] as CFDictionary)
+        } else {
+            source = CGImageSourceCreateWithData(data as CFData, nil)
+        }
+        guard let source else {
             throw SignalAttachmentError.missingData
         }
 
@@ -1080,8 +1096,7 @@ public class SignalAttachment: NSObject {
         }
 
         let count = CGImageSourceGetCount(source)
-        let mutableData = NSMutableData()
-        guard let destination = CGImageDestinationCreateWithData(mutableData as CFMutableData, type, count, nil) else {
+        guard let destination = CGImageDestinationCreateWithURL(outputUrl as CFURL, type, count, nil) else {
             throw SignalAttachmentError.couldNotRemoveMetadata
         }
 
@@ -1120,7 +1135,7 @@ public class SignalAttachment: NSObject {
             throw SignalAttachmentError.couldNotRemoveMetadata
         }
 
-        guard let dataSource = DataSourceValue(mutableData as Data, utiType: dataUTI) else {
+        guard let dataSource = try? DataSourcePath(fileUrl: outputUrl, shouldDeleteOnDeallocation: true) else {
             throw SignalAttachmentError.couldNotRemoveMetadata
         }
 
@@ -1184,7 +1199,8 @@ public class SignalAttachment: NSObject {
     @MainActor
     public static func compressVideoAsMp4(asset: AVAsset, baseFilename: String?, dataUTI: String, sessionCallback: (@MainActor (AVAssetExportSession) -> Void)? = nil) async throws -> SignalAttachment {
         Logger.debug("")
-        guard let exportSession = AVAssetExportSession(asset: asset, presetName: AVAssetExportPreset640x480) else {
+        let presetName = canExportWithoutReencoding(asset: asset) ? AVAssetExportPresetPassthrough : AVAssetExportPreset640x480
+        guard let exportSession = AVAssetExportSession(asset: asset, presetName: presetName) else {
             let attachment = SignalAttachment(dataSource: DataSourceValue(), dataUTI: dataUTI)
             attachment.error = .couldNotConvertToMpeg4
             return attachment
@@ -1250,6 +1266,54 @@ public class SignalAttachment: NSObject {
         }
     }
 
+    /// The highest video bit rate that's sent without re-encoding. This is
+    /// roughly what `AVAssetExportPreset640x480` produces.
+    private static let kMaxPassthroughVideoBitRate: Float = 2_000_000
+
+    /// Whether `asset` already looks like what `AVAssetExportPreset640x480`
+    /// would produce, so re-encoding it would only cost time and quality.
+    ///
+    /// Such videos still go through a passthrough export, which rewrites the
+    /// container (so the moov atom comes first) and filters the metadata
+    /// without touching the samples.
+    private static func canExportWithoutReencoding(asset: AVAsset) -> Bool {
+        guard let urlAsset = asset as? AVURLAsset, OWSMediaUtils.isVideoOfValidSize(path: urlAsset.url.path) else {
+            return false
+        }
+        let tracks = asset.tracks
+        let videoTracks = tracks.filter { $0.mediaType == .video }
+        guard videoTracks.count == 1, tracks.allSatisfy({ $0.mediaType == .video || $0.mediaType == .audio }) else {
+            return false
+        }
+        func hasOnlyCodec(_ track: AVAssetTrack, _ codec: FourCharCode) -> Bool {
+            guard let formatDescriptions = track.formatDescriptions as? [CMFormatDescription], !formatDescriptions.isEmpty else {
+                return false
+            }
+            return formatDescriptions.allSatisfy { CMFormatDescriptionGetMediaSubType($0) == codec }
+        }
+        for track in tracks {
+            switch track.mediaType {
+            case .video:
+                let size = track.naturalSize.applying(track.preferredTransform)
+                let longSide = max(abs(size.width), abs(size.height))
+                let shortSide = min(abs(size.width), abs(size.height))
+                guard
+                    hasOnlyCodec(track, kCMVideoCodecType_H264),
+                    longSide <= 640,
+                    shortSide <= 480,
+                    track.estimatedDataRate <= kMaxPassthroughVideoBitRate
+                else {
+                    return false
+                }
+            default:
+                guard hasOnlyCodec(track, kAudioFormatMPEG4AAC) else {
+                    return false
+                }
+            }
+        }
+        return true
+    }
+
     public func isVideoThatNeedsCompression() -> Bool {
         Self.isVideoThatNeedsCompression(dataSource: self.dataSource, dataUTI: self.dataUTI)
     }
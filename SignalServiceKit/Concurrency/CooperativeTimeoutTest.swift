@@ -44,4 +44,37 @@ final class CooperativeTimeoutTest: XCTestCase {
             // this is fine
         }
     }
+
+    func testDeadline() async throws {
+        let deadline = WorkDeadline(secondsFromNow: kDayInterval, qos: .utility)
+        let current = try await withCooperativeTimeout(
+            deadline: deadline,
+            operation: { WorkDeadline.current }
+        )
+        XCTAssertEqual(current?.date, deadline.date)
+    }
+
+    func testExpiredDeadline() async throws {
+        do {
+            try await withCooperativeTimeout(
+                deadline: WorkDeadline(secondsFromNow: -1),
+                operation: { XCTFail("Shouldn't run expired work.") }
+            )
+            throw OWSGenericError("")
+        } catch is WorkDeadlineExpiredError {
+            // this is fine
+        }
+    }
+
+    func testDeadlineTimeout() async throws {
+        do {
+            try await withCooperativeTimeout(
+                deadline: WorkDeadline(secondsFromNow: 0.01),
+                operation: { try await Task.sleep(nanoseconds: 1_000_000 * NSEC_PER_SEC) }
+            )
+            throw OWSGenericError("")
+        } catch is CooperativeTimeoutError {
+            // this is fine
+        }
+    }
 }
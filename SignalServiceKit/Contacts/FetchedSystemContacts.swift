@@ -22,20 +22,63 @@ public struct FetchedSystemContacts {
         self.cnContactIdToContact = cnContactIdToContact
     }
 
+    /// Remembers what each phone number string parsed to.
+    ///
+    /// Most of the address book is unchanged from one fetch to the next, and
+    /// parsing is what makes reprocessing a large address book expensive, so
+    /// reusing a cache across fetches means only new or edited numbers are
+    /// parsed again. Parsing depends on the local number, so after that
+    /// changes the cache starts over.
+    ///
+    /// This class isn't thread-safe.
+    final class ParsedPhoneNumberCache {
+        private var localPhoneNumber: CanonicalPhoneNumber?
+        private var parsedPhoneNumbers = [String: [CanonicalPhoneNumber]]()
+        private var previouslyParsedPhoneNumbers = [String: [CanonicalPhoneNumber]]()
+
+        init() {}
+
+        fileprivate func beginParsing(localPhoneNumber: CanonicalPhoneNumber?) {
+            if localPhoneNumber != self.localPhoneNumber {
+                self.localPhoneNumber = localPhoneNumber
+                parsedPhoneNumbers = [:]
+            }
+            // Only carry over numbers that are still in the address book.
+            previouslyParsedPhoneNumbers = parsedPhoneNumbers
+            parsedPhoneNumbers = [:]
+        }
+
+        fileprivate func phoneNumbers(for userTextPhoneNumber: String, parse: () -> [CanonicalPhoneNumber]) -> [CanonicalPhoneNumber] {
+            let phoneNumbers = parsedPhoneNumbers[userTextPhoneNumber]
+                ?? previouslyParsedPhoneNumbers[userTextPhoneNumber]
+                ?? parse()
+            parsedPhoneNumbers[userTextPhoneNumber] = phoneNumbers
+            return phoneNumbers
+        }
+
+        fileprivate func endParsing() {
+            previouslyParsedPhoneNumbers = [:]
+        }
+    }
+
     static func parseContacts(
         _ orderedContacts: [SystemContact],
         phoneNumberUtil: PhoneNumberUtil,
-        localPhoneNumber: String?
+        localPhoneNumber: String?,
+        parsedPhoneNumberCache: ParsedPhoneNumberCache? = nil
     ) -> FetchedSystemContacts {
         // A given Contact may have multiple phone numbers.
         var phoneNumberToContactRef = [CanonicalPhoneNumber: SystemContactRef]()
         var cnContactIdToContact = [String: SystemContact]()
         let localPhoneNumber = E164(localPhoneNumber).map(CanonicalPhoneNumber.init(nonCanonicalPhoneNumber:))
+        parsedPhoneNumberCache?.beginParsing(localPhoneNumber: localPhoneNumber)
+        defer { parsedPhoneNumberCache?.endParsing() }
         for systemContact in orderedContacts {
             var parsedPhoneNumbers = Self._parsePhoneNumbers(
                 for: systemContact,
                 phoneNumberUtil: phoneNumberUtil,
-                localPhoneNumber: localPhoneNumber
+                localPhoneNumber: localPhoneNumber,
+                parsedPhoneNumberCache: parsedPhoneNumberCache
             )
             // Ignore any system contact records for the local contact. For the local
             // user we never want to show the avatar / name that you have entered for
@@ -84,15 +127,19 @@ public struct FetchedSystemContacts {
     private static func _parsePhoneNumbers(
         for systemContact: SystemContact,
         phoneNumberUtil: PhoneNumberUtil,
-        localPhoneNumber: CanonicalPhoneNumber?
+        localPhoneNumber: CanonicalPhoneNumber?,
+        parsedPhoneNumberCache: ParsedPhoneNumberCache? = nil
     ) -> [ParsedPhoneNumber] {
         var results = [ParsedPhoneNumber]()
         for (phoneNumber, phoneNumberLabel) in systemContact.phoneNumbers {
-            let parsedPhoneNumbers = parsePhoneNumber(
-                phoneNumber,
-                phoneNumberUtil: phoneNumberUtil,
-                localPhoneNumber: localPhoneNumber
-            )
+            let parse = {
+                return parsePhoneNumber(
+                    phoneNumber,
+                    phoneNumberUtil: phoneNumberUtil,
+                    localPhoneNumber: localPhoneNumber
+                )
+            }
+            let parsedPhoneNumbers = parsedPhoneNumberCache?.phoneNumbers(for: phoneNumber, parse: parse) ?? parse()
             for parsedPhoneNumber in parsedPhoneNumbers {
                 results.append(ParsedPhoneNumber(
                     canonicalValue: parsedPhoneNumber,
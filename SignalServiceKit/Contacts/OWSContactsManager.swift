@@ -199,6 +199,8 @@ public class OWSContactsManagerSwiftValues {
     fileprivate let unknownThreadWarningCache = LowTrustCache()
 
     fileprivate let intersectionQueue = DispatchQueue(label: "org.signal.contacts.intersection")
+    /// Only used on `intersectionQueue`.
+    fileprivate let parsedPhoneNumberCache = FetchedSystemContacts.ParsedPhoneNumberCache()
     fileprivate let skipContactAvatarBlurByServiceIdStore = SDSKeyValueStore(collection: "OWSContactsManager.skipContactAvatarBlurByUuidStore")
     fileprivate let skipGroupAvatarBlurByGroupIdStore = SDSKeyValueStore(collection: "OWSContactsManager.skipGroupAvatarBlurByGroupIdStore")
 
@@ -902,7 +904,8 @@ extension OWSContactsManager: ContactManager {
         let fetchedSystemContacts = FetchedSystemContacts.parseContacts(
             addressBookContacts ?? [],
             phoneNumberUtil: NSObject.phoneNumberUtil,
-            localPhoneNumber: localNumber
+            localPhoneNumber: localNumber,
+            parsedPhoneNumberCache: swiftValues.parsedPhoneNumberCache
         )
         setFetchedSystemContacts(fetchedSystemContacts)
 
@@ -1165,7 +1168,7 @@ extension OWSContactsManager: ContactManager {
             return systemContactNames(for: addresses, tx: transaction)
                 .map { $0.map { .systemContactName($0) } }
         }.refine { addresses -> [DisplayName?] in
-            return profileManager.fetchUserProfiles(for: Array(addresses), tx: transaction)
+            return profileManager.fetchReadOnlyUserProfiles(for: Array(addresses), tx: transaction)
                 .map { $0?.nameComponents.map { .profileName($0) } }
         }.refine { addresses -> [DisplayName?] in
             return addresses.map { $0.e164.map { .phoneNumber($0) } }
@@ -230,24 +230,26 @@ lastVisibleSortIdOnScreenPercentageObsolete:(double)lastVisibleSortIdOnScreenPer
 - (NSArray<TSInvalidIdentityKeyReceivingErrorMessage *> *)receivedMessagesForInvalidKey:(NSData *)key
                                                                                      tx:(SDSAnyReadTransaction *)tx
 {
+    NSError *error;
+    InteractionFinder *interactionFinder = [[InteractionFinder alloc] initWithThreadUniqueId:self.uniqueId];
+    NSArray<TSInvalidIdentityKeyReceivingErrorMessage *> *_Nullable candidates =
+        [interactionFinder fetchInvalidIdentityKeyReceivingErrorMessagesWithTransaction:tx error:&error];
+    if (candidates == nil) {
+        OWSFailDebug(@"Error during fetch: %@", error);
+        return @[];
+    }
+
     NSMutableArray *errorMessages = [NSMutableArray new];
-    [self enumerateRecentInteractionsWithTransaction:tx
-                                          usingBlock:^(TSInteraction *interaction) {
-                                              if ([interaction isKindOfClass:[TSInvalidIdentityKeyReceivingErrorMessage
-                                                                                 class]]) {
-                                                  TSInvalidIdentityKeyReceivingErrorMessage *errorMessage
-                                                      = (TSInvalidIdentityKeyReceivingErrorMessage *)interaction;
-                                                  NSError *error;
-                                                  NSData *newIdentityKey = [errorMessage newIdentityKey:&error];
-                                                  if (newIdentityKey != nil) {
-                                                      if ([newIdentityKey isEqualToData:key]) {
-                                                          [errorMessages addObject:errorMessage];
-                                                      }
-                                                  } else {
-                                                      OWSFailDebug(@"error: %@", error);
-                                                  }
-                                              }
-                                          }];
+    for (TSInvalidIdentityKeyReceivingErrorMessage *errorMessage in candidates) {
+        NSData *newIdentityKey = [errorMessage newIdentityKey:&error];
+        if (newIdentityKey != nil) {
+            if ([newIdentityKey isEqualToData:key]) {
+                [errorMessages addObject:errorMessage];
+            }
+        } else {
+            OWSFailDebug(@"error: %@", error);
+        }
+    }
 
     return errorMessages;
 }
@@ -297,53 +299,78 @@ lastVisibleSortIdOnScreenPercentageObsolete:(double)lastVisibleSortIdOnScreenPer
     OWSAssertDebug(message != nil);
     OWSAssertDebug(transaction != nil);
 
-    BOOL hasLastVisibleInteraction = [self hasLastVisibleInteractionWithTransaction:transaction];
-    BOOL needsToClearLastVisibleSortId = hasLastVisibleInteraction && wasMessageInserted;
+    // A single transaction often inserts many messages into the same thread.
+    // Rather than fetching associated data and updating the thread for each of
+    // them, we merge their effects and apply them once when the transaction is
+    // finalized (see applyPendingSummaryUpdateWithTransaction:).
+    ThreadSummaryAccumulator *accumulator = [ThreadSummaryAccumulator accumulatorForThread:self
+                                                                               transaction:transaction];
+
+    // We want to clear the last visible sort ID on any new message,
+    // even if the message doesn't appear in the inbox view.
+    if (accumulator.hasLastVisibleInteraction && wasMessageInserted) {
+        accumulator.needsToClearLastVisibleSortId = YES;
+    }
 
     if (![message shouldAppearInInboxWithTransaction:transaction]) {
-        // We want to clear the last visible sort ID on any new message,
-        // even if the message doesn't appear in the inbox view.
-        if (needsToClearLastVisibleSortId) {
-            [self clearLastVisibleInteractionWithTransaction:transaction];
-        }
         [self scheduleTouchFinalizationWithTransaction:transaction];
         return;
     }
 
     uint64_t messageSortId = [self messageSortIdForMessage:message transaction:transaction];
-    BOOL needsToMarkAsVisible = !self.shouldThreadBeVisible;
-
-    ThreadAssociatedData *associatedData = [ThreadAssociatedData fetchOrDefaultForThread:self transaction:transaction];
-
-    BOOL needsToClearArchived = [self shouldClearArchivedStatusWhenUpdatingWithMessage:message
-                                                                    wasMessageInserted:wasMessageInserted
-                                                                  threadAssociatedData:associatedData
-                                                                           transaction:transaction];
-
-    BOOL needsToUpdateLastInteractionRowId = messageSortId > self.lastInteractionRowId;
-
-    BOOL needsToClearIsMarkedUnread = associatedData.isMarkedUnread && wasMessageInserted;
+    accumulator.maxMessageSortId = MAX(accumulator.maxMessageSortId, messageSortId);
+
+    ThreadAssociatedData *associatedData = accumulator.associatedData;
+    if ([self shouldClearArchivedStatusWhenUpdatingWithMessage:message
+                                            wasMessageInserted:wasMessageInserted
+                                          threadAssociatedData:associatedData
+                                                   transaction:transaction]) {
+        accumulator.needsToClearArchived = YES;
+    }
+    if (associatedData.isMarkedUnread && wasMessageInserted) {
+        accumulator.needsToClearIsMarkedUnread = YES;
+    }
 
-    if (needsToMarkAsVisible || needsToClearArchived || needsToUpdateLastInteractionRowId
-        || needsToClearLastVisibleSortId || needsToClearIsMarkedUnread) {
+    if (!self.shouldThreadBeVisible) {
+        // Visibility is applied immediately rather than at finalization; later
+        // work in this transaction (e.g. message request checks) depends on it.
+        // This happens at most once per thread.
         [self anyUpdateWithTransaction:transaction
                                  block:^(TSThread *thread) {
                                      thread.shouldThreadBeVisible = YES;
                                      thread.lastInteractionRowId = MAX(thread.lastInteractionRowId, messageSortId);
                                  }];
-        [associatedData clearIsArchived:needsToClearArchived
-                    clearIsMarkedUnread:needsToClearIsMarkedUnread
+        // Non-visible threads don't get indexed, so if we're becoming visible for the first time...
+        [SDSDatabaseStorage.shared touchThread:self shouldReindex:YES transaction:transaction];
+    }
+
+    [self scheduleTouchFinalizationWithTransaction:transaction];
+}
+
+- (void)applyPendingSummaryUpdateWithTransaction:(SDSAnyWriteTransaction *)transaction
+{
+    ThreadSummaryAccumulator *_Nullable accumulator = [ThreadSummaryAccumulator takeAccumulatorForThread:self
+                                                                                            transaction:transaction];
+    if (accumulator == nil || ![accumulator needsThreadUpdateForThread:self]) {
+        [self.databaseStorage touchThread:self shouldReindex:NO transaction:transaction];
+        return;
+    }
+
+    uint64_t maxMessageSortId = accumulator.maxMessageSortId;
+    [self anyUpdateWithTransaction:transaction
+                             block:^(TSThread *thread) {
+                                 thread.lastInteractionRowId = MAX(thread.lastInteractionRowId, maxMessageSortId);
+                             }];
+    if (accumulator.needsToClearArchived || accumulator.needsToClearIsMarkedUnread) {
+        ThreadAssociatedData *associatedData = [ThreadAssociatedData fetchOrDefaultForThread:self
+                                                                                 transaction:transaction];
+        [associatedData clearIsArchived:accumulator.needsToClearArchived && associatedData.isArchived
+                    clearIsMarkedUnread:accumulator.needsToClearIsMarkedUnread && associatedData.isMarkedUnread
                    updateStorageService:YES
                             transaction:transaction];
-        if (needsToMarkAsVisible) {
-            // Non-visible threads don't get indexed, so if we're becoming visible for the first time...
-            [SDSDatabaseStorage.shared touchThread:self shouldReindex:YES transaction:transaction];
-        }
-        if (needsToClearLastVisibleSortId) {
-            [self clearLastVisibleInteractionWithTransaction:transaction];
-        }
-    } else {
-        [self scheduleTouchFinalizationWithTransaction:transaction];
+    }
+    if (accumulator.needsToClearLastVisibleSortId) {
+        [self clearLastVisibleInteractionWithTransaction:transaction];
     }
 }
 
@@ -417,6 +444,10 @@ lastVisibleSortIdOnScreenPercentageObsolete:(double)lastVisibleSortIdOnScreenPer
     OWSAssertDebug(message != nil);
     OWSAssertDebug(transaction != nil);
 
+    // Removal logic depends on the current summary state, so apply anything
+    // that's pending from messages inserted earlier in this transaction.
+    [self applyPendingSummaryUpdateWithTransaction:transaction];
+
     uint64_t messageSortId = [self messageSortIdForMessage:message transaction:transaction];
     BOOL needsToUpdateLastInteractionRowId = messageSortId == self.lastInteractionRowId;
 
@@ -479,12 +510,12 @@ lastVisibleSortIdOnScreenPercentageObsolete:(double)lastVisibleSortIdOnScreenPer
 
     // If we insert, update or remove N interactions in a given
     // transactions, we don't need to touch the same thread more
-    // than once.
+    // than once. This also applies any summary changes accumulated
+    // by updateWithMessage:wasMessageInserted:transaction:.
     [transactionForMethod addTransactionFinalizationBlockForKey:self.transactionFinalizationKey
                                                           block:^(SDSAnyWriteTransaction *transactionForBlock) {
-                                                              [self.databaseStorage touchThread:self
-                                                                                  shouldReindex:NO
-                                                                                    transaction:transactionForBlock];
+                                                              [self applyPendingSummaryUpdateWithTransaction:
+                                                                        transactionForBlock];
                                                           }];
 }
 
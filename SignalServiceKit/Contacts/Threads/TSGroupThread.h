@@ -102,6 +102,12 @@ NS_DESIGNATED_INITIALIZER NS_SWIFT_NAME(init(grdbId:uniqueId:conversationColorNa
       shouldUpdateChatListUi:(BOOL)shouldUpdateChatListUi
                  transaction:(SDSAnyWriteTransaction *)transaction;
 
+/// Replaces this instance's group model without writing it to the database.
+///
+/// This method should only be called by GroupManager, while applying a batch
+/// of updates whose final model it writes once at the end.
+- (void)setGroupModelWithoutPersisting:(TSGroupModel *)groupModel;
+
 @end
 
 NS_ASSUME_NONNULL_END
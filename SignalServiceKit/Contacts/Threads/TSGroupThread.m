@@ -115,6 +115,11 @@ lastVisibleSortIdOnScreenPercentageObsolete:lastVisibleSortIdOnScreenPercentageO
 
 - (NSArray<SignalServiceAddress *> *)recipientAddressesWithTransaction:(SDSAnyReadTransaction *)transaction
 {
+    if (self.groupModel.groupsVersion == GroupsVersionV2) {
+        return [self.groupModel.groupMembership
+            fullMembersExcludingAddress:[TSAccountManagerObjcBridge localAciAddressWith:transaction]];
+    }
+
     NSMutableArray<SignalServiceAddress *> *groupMembers = [self.groupModel.groupMembers mutableCopy];
     if (groupMembers == nil) {
         return @[];
@@ -189,6 +194,13 @@ lastVisibleSortIdOnScreenPercentageObsolete:lastVisibleSortIdOnScreenPercentageO
     }
 }
 
+- (void)setGroupModelWithoutPersisting:(TSGroupModel *)groupModel
+{
+    OWSAssertDebug(groupModel);
+
+    self.groupModel = [groupModel copy];
+}
+
 - (void)fireAvatarChangedNotification
 {
     OWSAssertIsOnMainThread();
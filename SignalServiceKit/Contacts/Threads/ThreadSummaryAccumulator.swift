@@ -0,0 +1,74 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// Collects the changes to a thread's summary state (last interaction,
+/// archived/unread flags, last visible interaction) caused by the messages
+/// inserted or updated in a single write transaction.
+///
+/// When a transaction inserts a burst of messages into one thread, we'd
+/// otherwise fetch the thread's associated data and update the thread once per
+/// message. Instead, `-[TSThread updateWithMessage:...]` merges each message
+/// into the accumulator and the merged result is applied once when the
+/// transaction is finalized.
+@objc
+public final class ThreadSummaryAccumulator: NSObject {
+
+    /// Fetched once per transaction; only used to decide what to clear. The
+    /// clearing itself is applied to a fresh copy during finalization.
+    @objc
+    public let associatedData: ThreadAssociatedData
+
+    @objc
+    public let hasLastVisibleInteraction: Bool
+
+    @objc
+    public var maxMessageSortId: UInt64 = 0
+
+    @objc
+    public var needsToClearArchived = false
+
+    @objc
+    public var needsToClearIsMarkedUnread = false
+
+    @objc
+    public var needsToClearLastVisibleSortId = false
+
+    private init(thread: TSThread, transaction: SDSAnyReadTransaction) {
+        self.associatedData = ThreadAssociatedData.fetchOrDefault(for: thread, transaction: transaction)
+        self.hasLastVisibleInteraction = thread.hasLastVisibleInteraction(transaction: transaction)
+    }
+
+    private static func key(for thread: TSThread) -> String {
+        return thread.transactionFinalizationKey + ".summary"
+    }
+
+    /// Returns the accumulator for `thread` in `transaction`, creating it if
+    /// this is the first message for the thread in this transaction.
+    @objc(accumulatorForThread:transaction:)
+    public static func accumulator(for thread: TSThread, transaction: SDSAnyWriteTransaction) -> ThreadSummaryAccumulator {
+        let object = transaction.transactionScopedObject(forKey: key(for: thread)) {
+            ThreadSummaryAccumulator(thread: thread, transaction: transaction)
+        }
+        return object as! ThreadSummaryAccumulator
+    }
+
+    /// Removes and returns the pending accumulator for `thread`, if any.
+    @objc(takeAccumulatorForThread:transaction:)
+    public static func takeAccumulator(for thread: TSThread, transaction: SDSAnyWriteTransaction) -> ThreadSummaryAccumulator? {
+        return transaction.removeTransactionScopedObject(forKey: key(for: thread)) as? ThreadSummaryAccumulator
+    }
+
+    @objc(needsThreadUpdateForThread:)
+    public func needsThreadUpdate(for thread: TSThread) -> Bool {
+        return (
+            maxMessageSortId > thread.lastInteractionRowId
+            || needsToClearArchived
+            || needsToClearIsMarkedUnread
+            || needsToClearLastVisibleSortId
+        )
+    }
+}
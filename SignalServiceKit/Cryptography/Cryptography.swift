@@ -11,10 +11,21 @@ public enum Cryptography {
     // SHA-256
 
     /// Generates the SHA256 digest for a file.
+    ///
+    /// The same file is often hashed repeatedly (e.g. when it's validated and
+    /// then sent to several chats), so digests are cached by the file's
+    /// identity and modification time. An unchanged file isn't read again.
     public static func computeSHA256DigestOfFile(at url: URL) throws -> Data {
+        let cacheKey = fileDigestCacheKey(for: url)
+        if let cacheKey, let digest = fileDigestCache.get(key: cacheKey) {
+            return digest
+        }
+
         let file = try LocalFileHandle(url: url)
         var sha256 = SHA256()
-        var buffer = Data(count: diskPageSize)
+        // Read in the same large chunks as encryption; small files don't
+        // need a full-size buffer.
+        var buffer = Data(count: min(encryptionChunkSize, max(file.fileLength, diskPageSize)))
         var bytesRead: Int
         repeat {
             bytesRead = try file.read(into: &buffer)
@@ -22,7 +33,32 @@ public enum Cryptography {
                 sha256.update(data: buffer.prefix(bytesRead))
             }
         } while bytesRead > 0
-        return Data(sha256.finalize())
+        let digest = Data(sha256.finalize())
+
+        // Don't cache the digest if the file changed while we were reading it.
+        if let cacheKey, cacheKey == fileDigestCacheKey(for: url) {
+            fileDigestCache.set(key: cacheKey, value: digest)
+        }
+        return digest
+    }
+
+    private static let fileDigestCache = LRUCache<String, Data>(maxSize: 64, nseMaxSize: 16)
+
+    /// Identifies a version of a file's contents: rewriting or replacing the
+    /// file changes its inode, size, or modification/change times.
+    private static func fileDigestCacheKey(for url: URL) -> String? {
+        var fileStat = stat()
+        guard stat(url.path, &fileStat) == 0 else {
+            return nil
+        }
+        return [
+            url.path,
+            "\(fileStat.st_dev)",
+            "\(fileStat.st_ino)",
+            "\(fileStat.st_size)",
+            "\(fileStat.st_mtimespec.tv_sec).\(fileStat.st_mtimespec.tv_nsec)",
+            "\(fileStat.st_ctimespec.tv_sec).\(fileStat.st_ctimespec.tv_nsec)",
+        ].joined(separator: ":")
     }
 }
 
@@ -72,6 +108,11 @@ public extension Cryptography {
     fileprivate static var concatenatedEncryptionKeyLength: Int { aesKeySize + hmac256KeyLength }
     /// Optimize reads/writes by reading this many bytes at once; best balance of performance/memory use from testing in practice.
     fileprivate static let diskPageSize = 8192
+    /// Files are encrypted in chunks of this many bytes, which keeps the number of
+    /// reads, writes and cipher calls down for large attachments. A multiple of
+    /// both the disk page size and the AES block length, so every chunk but the
+    /// last produces the same amount of ciphertext.
+    fileprivate static let encryptionChunkSize = 32 * diskPageSize
 
     static func paddedSize(unpaddedSize: UInt) -> UInt {
         // In order to obsfucate attachment size on the wire, we round up
@@ -160,7 +201,8 @@ public extension Cryptography {
 
         return try _encryptAttachment(
             enumerateInputInBlocks: { closure in
-                var buffer = Data(count: diskPageSize)
+                // Small files don't need a full-size buffer.
+                var buffer = Data(count: min(encryptionChunkSize, max(inputFile.fileLength, diskPageSize)))
                 var totalBytesRead: UInt = 0
                 var bytesRead: Int
                 repeat {
@@ -173,7 +215,7 @@ public extension Cryptography {
                 return totalBytesRead
             },
             output: { outputBlock in
-                outputFile.write(outputBlock)
+                try outputFile.write(contentsOf: outputBlock)
             },
             encryptionKey: encryptionKey,
             hmacKey: hmacKey,
@@ -216,7 +258,7 @@ public extension Cryptography {
                 var totalBytesRead: UInt = 0
                 var bytesRead: Int
                 repeat {
-                    let data = try encryptedFileHandle.read(upToCount: UInt32(diskPageSize))
+                    let data = try encryptedFileHandle.read(upToCount: UInt32(encryptionChunkSize))
                     bytesRead = data.count
                     if bytesRead > 0 {
                         totalBytesRead += UInt(bytesRead)
@@ -226,7 +268,7 @@ public extension Cryptography {
                 return totalBytesRead
             },
             output: { outputBlock in
-                outputFileHandle.write(outputBlock)
+                try outputFileHandle.write(contentsOf: outputBlock)
             },
             encryptionKey: encryptionKey,
             hmacKey: hmacKey,
@@ -278,7 +320,8 @@ public extension Cryptography {
     /// - parameter enumerateInputInBlocks: The caller should enumerate blocks of the plaintext
     /// input one at a time (size up to the caller) until the entire input has been provided, and then return the
     /// byte length of the plaintext input.
-    /// - parameter output: Called by this method with each chunk of output ciphertext data.
+    /// - parameter output: Called by this method with each chunk of output ciphertext data. The chunk is only
+    /// valid for the duration of the call; its storage is reused for the next chunk.
     /// - parameter encryptionKey: The key used for encryption. Must be of byte length ``Cryptography/aesKeySize``.
     /// - parameter hmacKey: The key used for hmac. Must be of byte length ``Cryptography/hmac256KeyLength``.
     /// - parameter applyExtraPadding: If true, additional padding is applied _before_ pkcs7 padding to obfuscate
@@ -286,16 +329,16 @@ public extension Cryptography {
     private static func _encryptAttachment(
         // Run the closure on blocks of the input until complete and then return input plaintext length.
         enumerateInputInBlocks: ((Data) throws -> Void) throws -> UInt,
-        output: @escaping (Data) -> Void,
+        output: @escaping (Data) throws -> Void,
         encryptionKey: Data,
         hmacKey: Data,
         applyExtraPadding: Bool
     ) throws -> EncryptionMetadata {
 
         var totalOutputOffset: Int = 0
-        let output: (Data) -> Void = { outputData in
+        let output: (Data) throws -> Void = { outputData in
             totalOutputOffset += outputData.count
-            output(outputData)
+            try output(outputData)
         }
 
         let iv = Randomness.generateRandomBytes(UInt(aescbcIVLength))
@@ -314,7 +357,27 @@ public extension Cryptography {
         // in both the hmac and digest.
         hmac.update(data: iv)
         sha256.update(data: iv)
-        output(iv)
+        try output(iv)
+
+        // The ciphertext for each block of input is written into this buffer,
+        // which is reused (and only grown) so that we don't allocate per block.
+        // The hmac, digest, and output all consume it in the same pass.
+        var ciphertextBuffer = Data()
+        func encryptBlock(_ plaintextDataBlock: Data) throws {
+            let maxCiphertextLength = try cipherContext.outputLength(forUpdateWithInputLength: plaintextDataBlock.count)
+            if ciphertextBuffer.count < maxCiphertextLength {
+                ciphertextBuffer = Data(count: maxCiphertextLength)
+            }
+            let ciphertextLength = try cipherContext.update(input: plaintextDataBlock, output: &ciphertextBuffer)
+            guard ciphertextLength > 0 else {
+                return
+            }
+            let ciphertextBlock = ciphertextBuffer.prefix(ciphertextLength)
+
+            hmac.update(data: ciphertextBlock)
+            sha256.update(data: ciphertextBlock)
+            try output(ciphertextBlock)
+        }
 
         let unpaddedPlaintextLength: UInt
 
@@ -322,23 +385,21 @@ public extension Cryptography {
         // memory footprint as small as possible during encryption.
         do {
             unpaddedPlaintextLength = try enumerateInputInBlocks { plaintextDataBlock in
-                let ciphertextBlock = try cipherContext.update(plaintextDataBlock)
-
-                hmac.update(data: ciphertextBlock)
-                sha256.update(data: ciphertextBlock)
-                output(ciphertextBlock)
+                try encryptBlock(plaintextDataBlock)
             }
 
             // Add zero padding to the plaintext attachment data if necessary.
+            // This can be several MB for large attachments, so it's encrypted
+            // in chunks too.
             let paddedPlaintextLength = paddedSize(unpaddedSize: unpaddedPlaintextLength)
             if applyExtraPadding, paddedPlaintextLength > unpaddedPlaintextLength {
-                let ciphertextBlock = try cipherContext.update(
-                    Data(repeating: 0, count: Int(paddedPlaintextLength - unpaddedPlaintextLength))
-                )
-
-                hmac.update(data: ciphertextBlock)
-                sha256.update(data: ciphertextBlock)
-                output(ciphertextBlock)
+                var remainingPaddingLength = Int(paddedPlaintextLength - unpaddedPlaintextLength)
+                let zeroPadding = Data(count: min(remainingPaddingLength, encryptionChunkSize))
+                while remainingPaddingLength > 0 {
+                    let paddingBlockLength = min(remainingPaddingLength, zeroPadding.count)
+                    try encryptBlock(zeroPadding.prefix(paddingBlockLength))
+                    remainingPaddingLength -= paddingBlockLength
+                }
             }
 
             // Finalize the encryption and write out the last block.
@@ -349,7 +410,7 @@ public extension Cryptography {
 
             hmac.update(data: finalCiphertextBlock)
             sha256.update(data: finalCiphertextBlock)
-            output(finalCiphertextBlock)
+            try output(finalCiphertextBlock)
         }
 
         // Calculate our HMAC. This will be used to verify the
@@ -361,7 +422,7 @@ public extension Cryptography {
         // receiver to use for verification. We also include
         // it in the digest.
         sha256.update(data: hmacResult)
-        output(hmacResult)
+        try output(hmacResult)
 
         // Calculate our digest. This will be used to verify
         // the data after decryption.
@@ -416,22 +477,22 @@ public extension Cryptography {
         plaintextLength: UInt32,
         encryptionKey: Data
     ) throws -> EncryptedFileHandle {
-        return try EncryptedFileHandleImpl(
+        return try CachingEncryptedFileHandle(EncryptedFileHandleImpl(
             encryptedUrl: encryptedUrl,
             paddingDecryptionStrategy: .customPadding(plaintextLength: plaintextLength),
             encryptionKey: encryptionKey
-        )
+        ))
     }
 
     static func encryptedFileHandle(
         at encryptedUrl: URL,
         encryptionKey: Data
     ) throws -> EncryptedFileHandle {
-        return try EncryptedFileHandleImpl(
+        return try CachingEncryptedFileHandle(EncryptedFileHandleImpl(
             encryptedUrl: encryptedUrl,
             paddingDecryptionStrategy: .pkcs7Only,
             encryptionKey: encryptionKey
-        )
+        ))
     }
 
     static func decryptFile(
@@ -1028,6 +1089,110 @@ public extension Cryptography {
             return outputBuffer
         }
     }
+
+    /// Wraps an EncryptedFileHandleImpl with a cache of decrypted blocks.
+    ///
+    /// Callers like AVAssetResourceLoader (video playback) and ImageIO make
+    /// many small and out-of-order reads, and seeking the underlying handle
+    /// means re-reading and re-decrypting from the start of a CBC block. This
+    /// decrypts the file in fixed-size blocks, keeps the most recently used
+    /// ones, and when reads are sequential, decrypts further ahead each time
+    /// (like the OS's own read-ahead) so playback needs fewer, larger reads.
+    private class CachingEncryptedFileHandle: EncryptedFileHandle {
+        /// A multiple of the AES block length, so every block starts on a
+        /// cipher block boundary and loading one never discards plaintext.
+        private static let blockLength = 64 * 1024
+        private static let maxCachedBlockCount = 8
+        private static let maxReadAheadBlockCount = 4
+
+        private let fileHandle: EncryptedFileHandleImpl
+        let plaintextLength: UInt32
+
+        private var virtualOffset: Int = 0
+
+        /// Most recently used last.
+        private var cachedBlocks = [(index: Int, plaintext: Data)]()
+        private var lastLoadedBlockIndex: Int?
+        private var readAheadBlockCount = 1
+
+        init(_ fileHandle: EncryptedFileHandleImpl) {
+            self.fileHandle = fileHandle
+            self.plaintextLength = fileHandle.plaintextLength
+        }
+
+        func offset() -> UInt32 {
+            return UInt32(virtualOffset)
+        }
+
+        func seek(toOffset: UInt32) throws {
+            guard toOffset <= plaintextLength else {
+                throw OWSAssertionError("Seeking past end of file")
+            }
+            // Blocks are loaded (and the underlying handle seeked) on demand.
+            virtualOffset = Int(toOffset)
+        }
+
+        func read(upToCount: UInt32) throws -> Data {
+            let endOffset = min(virtualOffset + Int(upToCount), Int(plaintextLength))
+            guard virtualOffset < endOffset else {
+                return Data()
+            }
+            var result = Data(capacity: endOffset - virtualOffset)
+            while virtualOffset < endOffset {
+                let blockIndex = virtualOffset / Self.blockLength
+                let block = try self.block(at: blockIndex)
+                let offsetInBlock = virtualOffset - blockIndex * Self.blockLength
+                let byteCount = min(block.count - offsetInBlock, endOffset - virtualOffset)
+                guard byteCount > 0 else {
+                    throw OWSAssertionError("Block ended early")
+                }
+                result.append(block[offsetInBlock..<(offsetInBlock + byteCount)])
+                virtualOffset += byteCount
+            }
+            return result
+        }
+
+        private func block(at blockIndex: Int) throws -> Data {
+            if let cacheIndex = cachedBlocks.firstIndex(where: { $0.index == blockIndex }) {
+                let cachedBlock = cachedBlocks.remove(at: cacheIndex)
+                cachedBlocks.append(cachedBlock)
+                return cachedBlock.plaintext
+            }
+
+            // Double the read-ahead while reads are sequential; reset it on a seek.
+            if let lastLoadedBlockIndex, blockIndex == lastLoadedBlockIndex + 1 {
+                readAheadBlockCount = min(readAheadBlockCount * 2, Self.maxReadAheadBlockCount)
+            } else {
+                readAheadBlockCount = 1
+            }
+
+            let blockOffset = blockIndex * Self.blockLength
+            if fileHandle.offset() != blockOffset {
+                try fileHandle.seek(toOffset: UInt32(blockOffset))
+            }
+            let plaintext = try fileHandle.read(upToCount: UInt32(readAheadBlockCount * Self.blockLength))
+            guard !plaintext.isEmpty else {
+                throw OWSAssertionError("Failed to read block")
+            }
+
+            var loadedBlock = Data()
+            var loadedBlockIndex = blockIndex
+            for blockStart in stride(from: 0, to: plaintext.count, by: Self.blockLength) {
+                let blockPlaintext = plaintext.subdata(in: blockStart..<min(blockStart + Self.blockLength, plaintext.count))
+                if loadedBlockIndex == blockIndex {
+                    loadedBlock = blockPlaintext
+                }
+                cachedBlocks.removeAll(where: { $0.index == loadedBlockIndex })
+                cachedBlocks.append((loadedBlockIndex, blockPlaintext))
+                lastLoadedBlockIndex = loadedBlockIndex
+                loadedBlockIndex += 1
+            }
+            if cachedBlocks.count > Self.maxCachedBlockCount {
+                cachedBlocks.removeFirst(cachedBlocks.count - Self.maxCachedBlockCount)
+            }
+            return loadedBlock
+        }
+    }
 }
 
 // MARK: - Direct file access
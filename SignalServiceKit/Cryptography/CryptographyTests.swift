@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: AGPL-3.0-only
 //
 
+import CryptoKit
 import Foundation
 @testable import SignalServiceKit
 import XCTest
@@ -357,6 +358,51 @@ class CryptographyTestsSwift: XCTestCase {
         }
     }
 
+    func test_fileDigestIsRecomputedWhenFileChanges() throws {
+        let temporaryDirectory = URL(fileURLWithPath: NSTemporaryDirectory(), isDirectory: true)
+        let file = temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: file) }
+
+        let data1 = Randomness.generateRandomBytes(300 * 1024)
+        try data1.write(to: file)
+        XCTAssertEqual(try Cryptography.computeSHA256DigestOfFile(at: file), Data(SHA256.hash(data: data1)))
+        // Cached.
+        XCTAssertEqual(try Cryptography.computeSHA256DigestOfFile(at: file), Data(SHA256.hash(data: data1)))
+
+        // Same size, new contents.
+        let data2 = Randomness.generateRandomBytes(300 * 1024)
+        try data2.write(to: file)
+        XCTAssertEqual(try Cryptography.computeSHA256DigestOfFile(at: file), Data(SHA256.hash(data: data2)))
+    }
+
+    func test_attachmentEncryptionAndDecryptionAcrossChunks() throws {
+        // Sizes around the disk page size and spanning several encryption
+        // chunks, with a partial final chunk.
+        let plaintextLengths: [UInt32] = [
+            8191,
+            8193,
+            3 * 256 * 1024 + 7,
+        ]
+        for plaintextLength in plaintextLengths {
+            let temporaryDirectory = URL(fileURLWithPath: NSTemporaryDirectory(), isDirectory: true)
+            let plaintextFile = temporaryDirectory.appendingPathComponent(UUID().uuidString)
+            let encryptedFile = temporaryDirectory.appendingPathComponent(UUID().uuidString)
+
+            let plaintextData = Randomness.generateRandomBytes(UInt(plaintextLength))
+            try plaintextData.write(to: plaintextFile)
+            let metadata = try Cryptography.encryptAttachment(at: plaintextFile, output: encryptedFile)
+
+            try FileManager.default.removeItem(at: plaintextFile)
+
+            XCTAssertEqual(metadata.length, try Data(contentsOf: encryptedFile).count)
+            XCTAssertEqual(metadata.digest, try Cryptography.computeSHA256DigestOfFile(at: encryptedFile))
+
+            let decryptedData = try Cryptography.decryptAttachment(at: encryptedFile, metadata: metadata)
+
+            XCTAssertEqual(plaintextData, decryptedData)
+        }
+    }
+
     func test_attachmentEncryptionAndDecryptionFileHandle() throws {
         let temporaryDirectory = URL(fileURLWithPath: NSTemporaryDirectory(), isDirectory: true)
         let plaintextFile = temporaryDirectory.appendingPathComponent(UUID().uuidString)
@@ -415,4 +461,56 @@ class CryptographyTestsSwift: XCTestCase {
         decryptedData = try encryptedFileHandle.read(upToCount: UInt32(plaintextData4.count))
         XCTAssertEqual(plaintextData4, decryptedData)
     }
+
+    func test_attachmentFileHandleScatteredReads() throws {
+        let temporaryDirectory = URL(fileURLWithPath: NSTemporaryDirectory(), isDirectory: true)
+        let plaintextFile = temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        let encryptedFile = temporaryDirectory.appendingPathComponent(UUID().uuidString)
+
+        // Several of the handle's cached blocks, with a partial last one.
+        let plaintextData = Randomness.generateRandomBytes(UInt(20 * 64 * 1024 + 123))
+        try plaintextData.write(to: plaintextFile)
+        let metadata = try Cryptography.encryptAttachment(at: plaintextFile, output: encryptedFile)
+
+        try FileManager.default.removeItem(at: plaintextFile)
+
+        let encryptedFileHandle = try Cryptography.encryptedAttachmentFileHandle(
+            at: encryptedFile,
+            plaintextLength: UInt32(plaintextData.count),
+            encryptionKey: metadata.key
+        )
+
+        // Read sequentially in small reads, like a media player.
+        var sequentialData = Data()
+        while true {
+            let data = try encryptedFileHandle.read(upToCount: 10_000)
+            if data.isEmpty {
+                break
+            }
+            sequentialData.append(data)
+        }
+        XCTAssertEqual(plaintextData, sequentialData)
+
+        // Then seek around, re-reading some ranges and crossing block boundaries.
+        let ranges: [Range<Int>] = [
+            0..<1,
+            65_530..<65_540,
+            1_000_000..<1_100_000,
+            17..<70_000,
+            65_530..<65_540,
+            (plaintextData.count - 5)..<plaintextData.count,
+            300_000..<300_000,
+        ]
+        for range in ranges {
+            try encryptedFileHandle.seek(toOffset: UInt32(range.lowerBound))
+            let data = try encryptedFileHandle.read(upToCount: UInt32(range.count))
+            XCTAssertEqual(plaintextData.subdata(in: range), data, "\(range)")
+            XCTAssertEqual(encryptedFileHandle.offset(), UInt32(range.upperBound))
+        }
+
+        // Reads past the end are truncated.
+        try encryptedFileHandle.seek(toOffset: UInt32(plaintextData.count - 3))
+        XCTAssertEqual(try encryptedFileHandle.read(upToCount: 100), plaintextData.suffix(3))
+        XCTAssertEqual(try encryptedFileHandle.read(upToCount: 100), Data())
+    }
 }
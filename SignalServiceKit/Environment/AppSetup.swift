@@ -131,10 +131,12 @@ public class AppSetup {
         let tsConstants = TSConstants.shared
         let keyValueStoreFactory = testDependencies.keyValueStoreFactory ?? SDSKeyValueStoreFactory()
 
-        let libsignalNet = Net(
-            env: TSConstants.isUsingProductionService ? .production : .staging,
-            userAgent: OWSHttpHeaders.userAgentHeaderValueSignalIos
-        )
+        let libsignalNet = LaunchTimeline.shared.measure("libsignal Net") {
+            Net(
+                env: TSConstants.isUsingProductionService ? .production : .staging,
+                userAgent: OWSHttpHeaders.userAgentHeaderValueSignalIos
+            )
+        }
 
         let recipientDatabaseTable = RecipientDatabaseTableImpl()
         let recipientFetcher = RecipientFetcherImpl(recipientDatabaseTable: recipientDatabaseTable)
@@ -243,10 +245,13 @@ public class AppSetup {
         let interactionStore = InteractionStoreImpl()
         let storyStore = StoryStoreImpl()
 
+        let attachmentStore = AttachmentStoreImpl()
         let audioWaveformManager = AudioWaveformManagerImpl()
         let orphanedAttachmentCleaner = OrphanedAttachmentCleanerImpl(db: databaseStorage)
         let attachmentContentValidator = AttachmentContentValidatorImpl(
+            attachmentStore: attachmentStore,
             audioWaveformManager: audioWaveformManager,
+            db: db,
             orphanedAttachmentCleaner: orphanedAttachmentCleaner
         )
         let tsResourceContentValidator = TSResourceContentValidatorImpl(
@@ -312,13 +317,14 @@ public class AppSetup {
             networkManager: networkManager
         )
 
-        let attachmentStore = AttachmentStoreImpl()
         let orphanedAttachmentStore = OrphanedAttachmentStoreImpl()
         let attachmentDownloadStore = AttachmentDownloadStoreImpl(dateProvider: dateProvider)
+        let attachmentThumbnailService = AttachmentThumbnailServiceImpl()
         let attachmentDownloadManager = AttachmentDownloadManagerImpl(
             appReadiness: AttachmentDownloadManagerImpl.Wrappers.AppReadiness(),
             attachmentDownloadStore: attachmentDownloadStore,
             attachmentStore: attachmentStore,
+            attachmentThumbnailService: attachmentThumbnailService,
             attachmentValidator: attachmentContentValidator,
             currentCallProvider: currentCallProvider,
             dateProvider: dateProvider,
@@ -352,8 +358,6 @@ public class AppSetup {
             validator: attachmentContentValidator
         )
 
-        let attachmentThumbnailService = AttachmentThumbnailServiceImpl()
-
         let tsResourceStore = TSResourceStoreImpl(attachmentStore: attachmentStore)
         let tsResourceManager = TSResourceManagerImpl(
             attachmentManager: attachmentManager,
@@ -629,6 +633,10 @@ public class AppSetup {
         let bulkDeleteInteractionJobQueue = BulkDeleteInteractionJobQueue(
             addressableMessageFinder: deleteForMeAddressableMessageFinder,
             db: db,
+            incrementalVacuum: IncrementalVacuum(
+                db: db,
+                checkpoint: { try databaseStorage.grdbStorage.syncMaintenanceCheckpoint() }
+            ),
             interactionDeleteManager: interactionDeleteManager,
             threadSoftDeleteManager: threadSoftDeleteManager,
             threadStore: threadStore
@@ -1204,6 +1212,7 @@ public class AppSetup {
         let groupV2Updates = testDependencies.groupV2Updates ?? GroupV2UpdatesImpl()
         let messageFetcherJob = MessageFetcherJob()
         let profileFetcher = ProfileFetcherImpl(
+            chatConnectionManager: chatConnectionManager,
             db: db,
             deleteForMeSyncMessageSettingsStore: deleteForMeSyncMessageSettingsStore,
             disappearingMessagesConfigurationStore: disappearingMessagesConfigurationStore,
@@ -1376,25 +1385,32 @@ extension AppSetup.DatabaseContinuation {
     ) -> Guarantee<AppSetup.FinalContinuation> {
         let databaseStorage = sskEnvironment.databaseStorageRef
 
+        let launchTimeline = LaunchTimeline.shared
         let (guarantee, future) = Guarantee<AppSetup.FinalContinuation>.pending()
         backgroundScheduler.async {
             if self.shouldTruncateGrdbWal() {
                 // Try to truncate GRDB WAL before any readers or writers are active.
-                do {
-                    databaseStorage.logFileSizes()
-                    try databaseStorage.grdbStorage.syncTruncatingCheckpoint()
-                    databaseStorage.logFileSizes()
-                } catch {
-                    owsFailDebug("Failed to truncate database: \(error)")
+                launchTimeline.measure("Truncate WAL") {
+                    do {
+                        databaseStorage.logFileSizes()
+                        try databaseStorage.grdbStorage.syncTruncatingCheckpoint()
+                        databaseStorage.logFileSizes()
+                    } catch {
+                        owsFailDebug("Failed to truncate database: \(error)")
+                    }
                 }
             }
+            let migrationsStep = launchTimeline.beginStep("Schema migrations")
             databaseStorage.runGrdbSchemaMigrationsOnMainDatabase(completionScheduler: mainScheduler) {
-                do {
-                    try databaseStorage.grdbStorage.setupDatabaseChangeObserver()
-                } catch {
-                    owsFail("Couldn't set up change observer: \(error.grdbErrorForLogging)")
+                migrationsStep.end()
+                launchTimeline.measure("Database change observer") {
+                    do {
+                        try databaseStorage.grdbStorage.setupDatabaseChangeObserver()
+                    } catch {
+                        owsFail("Couldn't set up change observer: \(error.grdbErrorForLogging)")
+                    }
                 }
-                self.sskEnvironment.warmCaches()
+                launchTimeline.measure("Warm caches") { self.sskEnvironment.warmCaches() }
                 self.backgroundTask.end()
                 future.resolve(AppSetup.FinalContinuation(
                     authCredentialStore: self.authCredentialStore,
@@ -1445,6 +1461,9 @@ extension AppSetup.FinalContinuation {
     public func finish(willResumeInProgressRegistration: Bool) -> SetupError? {
         AssertIsOnMainThread()
 
+        let launchStep = LaunchTimeline.shared.beginStep("Finish setup")
+        defer { launchStep.end() }
+
         ZkParamsMigrator(
             authCredentialStore: authCredentialStore,
             db: dependenciesBridge.db,
@@ -0,0 +1,141 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// Records how long each step of a cold launch takes, so that launch time
+/// can be attributed to the work that caused it.
+///
+/// Each step is a signpost interval in the `Launch` tracing category (see
+/// `Tracing`), and is also kept here with its offset from the start of
+/// launch. Once the UI is ready, the app calls `logReport()` to write the
+/// steps to the log, indenting each under the steps that contain it (e.g.
+/// warming each cache within "Warm caches"). Steps may end on another
+/// thread.
+///
+/// This class is thread-safe.
+public final class LaunchTimeline {
+
+    public static let shared = LaunchTimeline()
+
+    struct Step {
+        let name: String
+        let offset: CFTimeInterval
+        let duration: CFTimeInterval
+
+        var endOffset: CFTimeInterval { offset + duration }
+    }
+
+    private struct State {
+        var launchStartedAt: CFTimeInterval?
+        var steps = [Step]()
+        var didLogReport = false
+    }
+
+    private let state = AtomicValue<State>(State(), lock: .init())
+
+    init() {}
+
+    /// Call this once, as early in launch as possible.
+    public func start(launchStartedAt: CFTimeInterval) {
+        state.update { $0.launchStartedAt = launchStartedAt }
+    }
+
+    /// Begins a step that the caller must `end()` exactly once, e.g. when
+    /// work finishes asynchronously.
+    public func beginStep(_ name: StaticString) -> LaunchStep {
+        return LaunchStep(
+            timeline: self,
+            name: name,
+            startedAt: CACurrentMediaTime(),
+            interval: Tracing.beginInterval(.launch, name)
+        )
+    }
+
+    public func measure<T>(_ name: StaticString, block: () throws -> T) rethrows -> T {
+        let step = beginStep(name)
+        defer { step.end() }
+        return try block()
+    }
+
+    public func measure<T>(_ name: StaticString, block: () async throws -> T) async rethrows -> T {
+        let step = beginStep(name)
+        defer { step.end() }
+        return try await block()
+    }
+
+    func record(name: String, startedAt: CFTimeInterval, endedAt: CFTimeInterval) {
+        state.update { state in
+            guard !state.didLogReport else {
+                return
+            }
+            state.steps.append(Step(
+                name: name,
+                offset: startedAt - (state.launchStartedAt ?? startedAt),
+                duration: endedAt - startedAt
+            ))
+        }
+    }
+
+    /// The recorded steps, in the order they started.
+    var steps: [Step] {
+        return state.get().steps.sorted { $0.offset < $1.offset }
+    }
+
+    func reportLines() -> [String] {
+        let steps = self.steps
+        return steps.enumerated().map { index, step in
+            let depth = steps[..<index].filter { $0.endOffset >= step.endOffset }.count
+            return String(
+                format: "%@+%.1fms %@: %.1fms",
+                String(repeating: "  ", count: depth),
+                step.offset * 1000,
+                step.name,
+                step.duration * 1000
+            )
+        }
+    }
+
+    /// Writes the steps recorded so far to the log. Steps that end after
+    /// this is called aren't recorded.
+    public func logReport() {
+        let lines = reportLines()
+        let launchStartedAt = state.update { state -> CFTimeInterval? in
+            state.didLogReport = true
+            return state.launchStartedAt
+        }
+        var message = "Launch timeline"
+        if let launchStartedAt {
+            message += String(format: " (%.1fms)", (CACurrentMediaTime() - launchStartedAt) * 1000)
+        }
+        Logger.info("\(message):\n\(lines.joined(separator: "\n"))")
+    }
+}
+
+// MARK: -
+
+public struct LaunchStep {
+    private let timeline: LaunchTimeline
+    private let name: StaticString
+    private let startedAt: CFTimeInterval
+    private let interval: TraceInterval
+
+    fileprivate init(
+        timeline: LaunchTimeline,
+        name: StaticString,
+        startedAt: CFTimeInterval,
+        interval: TraceInterval
+    ) {
+        self.timeline = timeline
+        self.name = name
+        self.startedAt = startedAt
+        self.interval = interval
+    }
+
+    public func end() {
+        interval.end()
+        timeline.record(name: "\(name)", startedAt: startedAt, endedAt: CACurrentMediaTime())
+    }
+}
@@ -305,7 +305,7 @@ public class Sounds: Dependencies {
     private init() { }
 
     public static func performStartupTasks() {
-        AppReadiness.runNowOrWhenMainAppDidBecomeReadyAsync {
+        AppReadiness.runNowOrWhenMainAppDidBecomeReadyInBackground(priority: .low) {
             Sounds.migrateLegacySounds()
             Sounds.cleanupOrphanedSounds()
         }
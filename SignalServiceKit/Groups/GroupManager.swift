@@ -1017,6 +1017,47 @@ public class GroupManager: NSObject {
     /// - Parameter newlyLearnedPniToAciAssociations
     /// Associations between PNIs and ACIs that were learned as a result of this
     /// group update.
+    /// Applies a run of updates to one group thread within a transaction,
+    /// writing the thread once, with the final group model.
+    ///
+    /// Each update still gets its own info message; writing the model, the
+    /// group member records and touching the thread are what's batched.
+    public final class GroupThreadUpdateBatch {
+        fileprivate let groupThread: TSGroupThread
+        private let originalGroupModel: TSGroupModel
+        private var stagedGroupModel: TSGroupModel?
+        private var shouldUpdateChatListUi = false
+
+        public init(groupThread: TSGroupThread) {
+            self.groupThread = groupThread
+            self.originalGroupModel = groupThread.groupModel
+        }
+
+        fileprivate func stage(_ newGroupModel: TSGroupModel, shouldUpdateChatListUi: Bool) {
+            groupThread.setGroupModelWithoutPersisting(newGroupModel)
+            stagedGroupModel = newGroupModel
+            self.shouldUpdateChatListUi = self.shouldUpdateChatListUi || shouldUpdateChatListUi
+        }
+
+        /// Writes the staged group model, if any. Must be called before the
+        /// transaction ends, including when applying an update fails.
+        public func commit(transaction: SDSAnyWriteTransaction) -> TSGroupThread {
+            guard let stagedGroupModel else {
+                return groupThread
+            }
+            self.stagedGroupModel = nil
+            // Restore the original so the thread can tell what changed, e.g.
+            // whether it must be re-indexed.
+            groupThread.setGroupModelWithoutPersisting(originalGroupModel)
+            groupThread.update(
+                with: stagedGroupModel,
+                shouldUpdateChatListUi: shouldUpdateChatListUi,
+                transaction: transaction
+            )
+            return groupThread
+        }
+    }
+
     public static func updateExistingGroupThreadInDatabaseAndCreateInfoMessage(
         newGroupModel: TSGroupModel,
         newDisappearingMessageToken: DisappearingMessageToken?,
@@ -1025,6 +1066,7 @@ public class GroupManager: NSObject {
         infoMessagePolicy: InfoMessagePolicy = .always,
         localIdentifiers: LocalIdentifiers,
         spamReportingMetadata: GroupUpdateSpamReportingMetadata,
+        batch: GroupThreadUpdateBatch? = nil,
         transaction: SDSAnyWriteTransaction
     ) throws -> TSGroupThread {
         // Step 1: First reload latest thread state. This ensures:
@@ -1033,8 +1075,9 @@ public class GroupManager: NSObject {
         // * The update is working off latest database state.
         //
         // We always have the groupThread at the call sites of this method, but this
-        // future-proofs us against bugs.
-        guard let groupThread = TSGroupThread.fetch(groupId: newGroupModel.groupId, transaction: transaction) else {
+        // future-proofs us against bugs. Batched updates work off the batch's
+        // thread, whose model is ahead of the database.
+        guard let groupThread = batch?.groupThread ?? TSGroupThread.fetch(groupId: newGroupModel.groupId, transaction: transaction) else {
             throw OWSAssertionError("Missing groupThread.")
         }
 
@@ -1158,11 +1201,15 @@ public class GroupManager: NSObject {
             let hasDMUpdate = updateDMResult.newConfiguration != updateDMResult.oldConfiguration
 
             let hasUserFacingUpdate = hasUserFacingGroupModelChange || hasDMUpdate
-            groupThread.update(
-                with: newGroupModel,
-                shouldUpdateChatListUi: hasUserFacingUpdate,
-                transaction: transaction
-            )
+            if let batch {
+                batch.stage(newGroupModel, shouldUpdateChatListUi: hasUserFacingUpdate)
+            } else {
+                groupThread.update(
+                    with: newGroupModel,
+                    shouldUpdateChatListUi: hasUserFacingUpdate,
+                    transaction: transaction
+                )
+            }
 
             return hasUserFacingUpdate
         }()
@@ -148,6 +148,18 @@ public class GroupMembership: MTLModel {
     public fileprivate(set) var bannedMembers: BannedMembersMap
     private var invalidInviteMap: InvalidInviteMap
 
+    /// Built on first use; see ``Snapshot``.
+    private let cachedSnapshot = AtomicOptional<Snapshot>(nil, lock: UnfairLock())
+
+    fileprivate var snapshot: Snapshot {
+        if let snapshot = cachedSnapshot.get() {
+            return snapshot
+        }
+        let snapshot = Snapshot(memberStates: memberStates)
+        cachedSnapshot.set(snapshot)
+        return snapshot
+    }
+
     public var invalidInviteUserIds: [Data] {
         return Array(invalidInviteMap.keys)
     }
@@ -372,51 +384,149 @@ public class GroupMembership: MTLModel {
     }
 }
 
+// MARK: - Snapshot
+
+private extension GroupMembership {
+
+    /// The member sets derived from `memberStates`.
+    ///
+    /// A GroupMembership never changes once built, so these are computed once
+    /// rather than on every access; large groups are asked for them on every
+    /// send and every render.
+    final class Snapshot {
+        let fullMemberAdministrators: Set<SignalServiceAddress>
+        let fullMembers: Set<SignalServiceAddress>
+        let fullMembersArray: [SignalServiceAddress]
+        let invitedMembers: Set<SignalServiceAddress>
+        let requestingMembers: Set<SignalServiceAddress>
+        let fullOrInvitedMembers: Set<SignalServiceAddress>
+        let invitedOrRequestMembers: Set<SignalServiceAddress>
+        let allMembersOfAnyKind: Set<SignalServiceAddress>
+        let allMembersOfAnyKindServiceIds: Set<ServiceId>
+
+        /// Lets lookups by ServiceId skip building a SignalServiceAddress.
+        let memberStatesByServiceId: [ServiceId: GroupMemberState]
+        /// Legacy members may only have a phone number, in which case a
+        /// ServiceId lookup has to fall back to comparing addresses.
+        let hasMembersWithoutServiceId: Bool
+
+        private let cachedNonLocalFullMembers = AtomicOptional<(localAddress: SignalServiceAddress?, members: [SignalServiceAddress])>(nil, lock: UnfairLock())
+
+        init(memberStates: MemberStateMap) {
+            var fullMemberAdministrators = Set<SignalServiceAddress>()
+            var fullMembers = Set<SignalServiceAddress>()
+            var invitedMembers = Set<SignalServiceAddress>()
+            var requestingMembers = Set<SignalServiceAddress>()
+            var memberStatesByServiceId = [ServiceId: GroupMemberState]()
+            var hasMembersWithoutServiceId = false
+            for (address, memberState) in memberStates {
+                switch memberState {
+                case .fullMember:
+                    fullMembers.insert(address)
+                    if memberState.isAdministrator {
+                        fullMemberAdministrators.insert(address)
+                    }
+                case .invited:
+                    invitedMembers.insert(address)
+                case .requesting:
+                    requestingMembers.insert(address)
+                }
+                if let serviceId = address.serviceId {
+                    memberStatesByServiceId[serviceId] = memberState
+                } else {
+                    hasMembersWithoutServiceId = true
+                }
+            }
+            self.fullMemberAdministrators = fullMemberAdministrators
+            self.fullMembers = fullMembers
+            self.fullMembersArray = Array(fullMembers)
+            self.invitedMembers = invitedMembers
+            self.requestingMembers = requestingMembers
+            self.fullOrInvitedMembers = fullMembers.union(invitedMembers)
+            self.invitedOrRequestMembers = invitedMembers.union(requestingMembers)
+            self.allMembersOfAnyKind = Set(memberStates.keys)
+            self.allMembersOfAnyKindServiceIds = Set(memberStatesByServiceId.keys)
+            self.memberStatesByServiceId = memberStatesByServiceId
+            self.hasMembersWithoutServiceId = hasMembersWithoutServiceId
+        }
+
+        func fullMembers(excluding localAddress: SignalServiceAddress?) -> [SignalServiceAddress] {
+            if let cached = cachedNonLocalFullMembers.get(), cached.localAddress == localAddress {
+                return cached.members
+            }
+            var members = fullMembersArray
+            if let localAddress {
+                members.removeAll(where: { $0 == localAddress })
+            }
+            cachedNonLocalFullMembers.set((localAddress, members))
+            return members
+        }
+    }
+
+    func memberState(for serviceId: ServiceId) -> GroupMemberState? {
+        let snapshot = self.snapshot
+        if let memberState = snapshot.memberStatesByServiceId[serviceId] {
+            return memberState
+        }
+        guard snapshot.hasMembersWithoutServiceId else {
+            return nil
+        }
+        return memberStates[SignalServiceAddress(serviceId)]
+    }
+}
+
 // MARK: - Accessors
 
 public extension GroupMembership {
 
     var fullMemberAdministrators: Set<SignalServiceAddress> {
-        return Set(memberStates.lazy.filter { $0.value.isAdministrator && $0.value.isFullMember }.map { $0.key })
+        return snapshot.fullMemberAdministrators
     }
 
     var fullMembers: Set<SignalServiceAddress> {
-        return Set(memberStates.lazy.filter { $0.value.isFullMember }.map { $0.key })
+        return snapshot.fullMembers
+    }
+
+    /// `fullMembers`, in an order that's stable for this membership.
+    var fullMembersArray: [SignalServiceAddress] {
+        return snapshot.fullMembersArray
+    }
+
+    /// `fullMembersArray` without the local user.
+    @objc(fullMembersExcludingAddress:)
+    func fullMembers(excluding localAddress: SignalServiceAddress?) -> [SignalServiceAddress] {
+        return snapshot.fullMembers(excluding: localAddress)
     }
 
     var invitedMembers: Set<SignalServiceAddress> {
-        return Set(memberStates.lazy.filter { $0.value.isInvited }.map { $0.key })
+        return snapshot.invitedMembers
     }
 
     var requestingMembers: Set<SignalServiceAddress> {
-        return Set(memberStates.lazy.filter { $0.value.isRequesting }.map { $0.key })
+        return snapshot.requestingMembers
     }
 
     var fullOrInvitedMembers: Set<SignalServiceAddress> {
-        return Set(memberStates.lazy.filter {
-            $0.value.isFullMember || $0.value.isInvited
-        }.map { $0.key })
+        return snapshot.fullOrInvitedMembers
     }
 
     var invitedOrRequestMembers: Set<SignalServiceAddress> {
-        return Set(memberStates.lazy.filter {
-            $0.value.isInvited || $0.value.isRequesting
-        }.map { $0.key })
+        return snapshot.invitedOrRequestMembers
     }
 
     var allMembersOfAnyKind: Set<SignalServiceAddress> {
-        return Set(memberStates.keys)
+        return snapshot.allMembersOfAnyKind
     }
 
     var allMembersOfAnyKindServiceIds: Set<ServiceId> {
-        return Set(memberStates.keys.lazy.compactMap { $0.serviceId })
+        return snapshot.allMembersOfAnyKindServiceIds
     }
 }
 
 public extension GroupMembership {
 
     func role(for serviceId: ServiceId) -> TSGroupMemberRole? {
-        return role(for: SignalServiceAddress(serviceId))
+        return memberState(for: serviceId)?.role
     }
 
     func role(for address: SignalServiceAddress) -> TSGroupMemberRole? {
@@ -441,7 +551,10 @@ public extension GroupMembership {
     }
 
     func isFullOrInvitedAdministrator(_ serviceId: ServiceId) -> Bool {
-        return isFullOrInvitedAdministrator(SignalServiceAddress(serviceId))
+        guard let memberState = memberState(for: serviceId) else {
+            return false
+        }
+        return !memberState.isRequesting && memberState.isAdministrator
     }
 
     @objc
@@ -453,7 +566,10 @@ public extension GroupMembership {
     }
 
     func isFullMemberAndAdministrator(_ serviceId: ServiceId) -> Bool {
-        return isFullMemberAndAdministrator(SignalServiceAddress(serviceId))
+        guard let memberState = memberState(for: serviceId) else {
+            return false
+        }
+        return memberState.isAdministrator && memberState.isFullMember
     }
 
     @objc
@@ -465,7 +581,7 @@ public extension GroupMembership {
     }
 
     func isFullMember(_ serviceId: ServiceId) -> Bool {
-        return isFullMember(SignalServiceAddress(serviceId))
+        return memberState(for: serviceId)?.isFullMember ?? false
     }
 
     @objc
@@ -477,7 +593,7 @@ public extension GroupMembership {
     }
 
     func isInvitedMember(_ serviceId: ServiceId) -> Bool {
-        return isInvitedMember(SignalServiceAddress(serviceId))
+        return memberState(for: serviceId)?.isInvited ?? false
     }
 
     func isRequestingMember(_ address: SignalServiceAddress) -> Bool {
@@ -488,7 +604,7 @@ public extension GroupMembership {
     }
 
     func isRequestingMember(_ serviceId: ServiceId) -> Bool {
-        return isRequestingMember(SignalServiceAddress(serviceId))
+        return memberState(for: serviceId)?.isRequesting ?? false
     }
 
     func isMemberOfAnyKind(_ address: SignalServiceAddress) -> Bool {
@@ -496,7 +612,7 @@ public extension GroupMembership {
     }
 
     func isMemberOfAnyKind(_ serviceId: ServiceId) -> Bool {
-        return isMemberOfAnyKind(SignalServiceAddress(serviceId))
+        return memberState(for: serviceId) != nil
     }
 
     func isBannedMember(_ aci: Aci) -> Bool {
@@ -557,7 +673,7 @@ public extension GroupMembership {
 
     /// Is this user's profile key exposed to the group?
     func hasProfileKeyInGroup(serviceId: ServiceId) -> Bool {
-        guard let memberState = memberStates[SignalServiceAddress(serviceId)] else {
+        guard let memberState = memberState(for: serviceId) else {
             return false
         }
 
@@ -571,7 +687,7 @@ public extension GroupMembership {
 
     /// Can this user view the profile keys in the group?
     func canViewProfileKeys(serviceId: ServiceId) -> Bool {
-        guard let memberState = memberStates[SignalServiceAddress(serviceId)] else {
+        guard let memberState = memberState(for: serviceId) else {
             return false
         }
 
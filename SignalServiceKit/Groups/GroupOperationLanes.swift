@@ -0,0 +1,48 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// An operation queue with a lane per group.
+///
+/// Operations for the same group run one at a time, in the order they were
+/// added; operations for different groups run concurrently, up to
+/// `maxConcurrentOperationCount` at once. That way a group whose update is
+/// stuck waiting on the network doesn't hold up updates to other groups.
+///
+/// This class is thread-safe.
+final class GroupOperationLanes {
+
+    private let operationQueue: OperationQueue
+
+    /// The most recently added operation for each group that hasn't finished.
+    private let lastOperations = AtomicValue<[Data: Operation]>([:], lock: UnfairLock())
+
+    init(name: String, maxConcurrentOperationCount: Int) {
+        let operationQueue = OperationQueue()
+        operationQueue.name = name
+        operationQueue.maxConcurrentOperationCount = maxConcurrentOperationCount
+        self.operationQueue = operationQueue
+    }
+
+    func addOperation(_ operation: Operation, groupId: Data) {
+        lastOperations.update { lastOperations in
+            if let previousOperation = lastOperations[groupId] {
+                operation.addDependency(previousOperation)
+            }
+            lastOperations[groupId] = operation
+        }
+        let existingCompletionBlock = operation.completionBlock
+        operation.completionBlock = { [weak self, weak operation] in
+            existingCompletionBlock?()
+            self?.lastOperations.update { lastOperations in
+                if let operation, lastOperations[groupId] === operation {
+                    lastOperations[groupId] = nil
+                }
+            }
+        }
+        operationQueue.addOperation(operation)
+    }
+}
@@ -15,19 +15,22 @@ public class GroupV2UpdatesImpl: Dependencies {
     private let changeCache = LRUCache<Data, ChangeCacheItem>(maxSize: 5)
     private var lastSuccessfulRefreshMap = LRUCache<Data, Date>(maxSize: 256)
 
-    let immediateOperationQueue: OperationQueue = {
-        let operationQueue = OperationQueue()
-        operationQueue.name = "GroupV2Updates-Immediate"
-        operationQueue.maxConcurrentOperationCount = 1
-        return operationQueue
-    }()
-
-    let afterMessageProcessingOperationQueue: OperationQueue = {
-        let operationQueue = OperationQueue()
-        operationQueue.name = "GroupV2Updates-AfterMessageProcessing"
-        operationQueue.maxConcurrentOperationCount = 1
-        return operationQueue
-    }()
+    /// Refreshes of one group run one at a time, but those of different
+    /// groups needn't wait for each other, e.g. while incoming messages for
+    /// several groups each need their group refreshed.
+    private static let maxConcurrentRefreshCount = 4
+
+    private let immediateOperationQueue = GroupOperationLanes(
+        name: "GroupV2Updates-Immediate",
+        maxConcurrentOperationCount: maxConcurrentRefreshCount
+    )
+
+    /// Separate from the immediate lanes: these refreshes wait for message
+    /// processing, which may itself be waiting on an immediate refresh.
+    private let afterMessageProcessingOperationQueue = GroupOperationLanes(
+        name: "GroupV2Updates-AfterMessageProcessing",
+        maxConcurrentOperationCount: maxConcurrentRefreshCount
+    )
 
     public init() {
         SwiftSingletons.register(self)
@@ -327,14 +330,17 @@ extension GroupV2UpdatesImpl: GroupV2Updates {
         }
 
         let result = try await withCheckedThrowingContinuation { continuation in
-            self.operationQueue(forGroupUpdateMode: groupUpdateMode).addOperation(GroupV2UpdateOperation(
-                groupId: groupId,
-                spamReportingMetadata: spamReportingMetadata,
-                groupSecretParams: groupSecretParams,
-                groupUpdateMode: groupUpdateMode,
-                groupModelOptions: groupModelOptions,
-                continuation: continuation
-            ))
+            self.operationQueue(forGroupUpdateMode: groupUpdateMode).addOperation(
+                GroupV2UpdateOperation(
+                    groupId: groupId,
+                    spamReportingMetadata: spamReportingMetadata,
+                    groupSecretParams: groupSecretParams,
+                    groupUpdateMode: groupUpdateMode,
+                    groupModelOptions: groupModelOptions,
+                    continuation: continuation
+                ),
+                groupId: groupId
+            )
         }
         await self.groupRefreshDidSucceed(forGroupId: groupId, groupUpdateMode: groupUpdateMode)
         return result
@@ -355,7 +361,7 @@ extension GroupV2UpdatesImpl: GroupV2Updates {
         }
     }
 
-    private func operationQueue(forGroupUpdateMode groupUpdateMode: GroupUpdateMode) -> OperationQueue {
+    private func operationQueue(forGroupUpdateMode groupUpdateMode: GroupUpdateMode) -> GroupOperationLanes {
         if groupUpdateMode.shouldBlockOnMessageProcessing {
             return afterMessageProcessingOperationQueue
         } else {
@@ -689,43 +695,51 @@ private extension GroupV2UpdatesImpl {
 
             var profileKeysByAci = [Aci: Data]()
             var authoritativeProfileKeysByAci = [Aci: Data]()
-            for (index, groupChange) in groupChanges.enumerated() {
-                if let upToRevision = upToRevision {
-                    let changeRevision = groupChange.revision
-                    guard upToRevision >= changeRevision else {
-                        Logger.info("Ignoring group change: \(changeRevision); only updating to revision: \(upToRevision)")
-
-                        // Enqueue an update to latest.
-                        self.tryToRefreshV2GroupUpToCurrentRevisionAfterMessageProcessingWithThrottling(groupThread)
-
-                        break
+            // Catching up on many revisions would otherwise write the whole
+            // group, its member records and the thread once per revision.
+            let batch = GroupManager.GroupThreadUpdateBatch(groupThread: groupThread)
+            do {
+                // Changes applied before a failure are kept, as before batching.
+                defer { groupThread = batch.commit(transaction: transaction) }
+                for (index, groupChange) in groupChanges.enumerated() {
+                    if let upToRevision = upToRevision {
+                        let changeRevision = groupChange.revision
+                        guard upToRevision >= changeRevision else {
+                            Logger.info("Ignoring group change: \(changeRevision); only updating to revision: \(upToRevision)")
+
+                            // Enqueue an update to latest.
+                            self.tryToRefreshV2GroupUpToCurrentRevisionAfterMessageProcessingWithThrottling(groupThread)
+
+                            break
+                        }
                     }
-                }
 
-                let applyResult = try autoreleasepool {
-                    try self.tryToApplySingleChangeFromService(
-                        groupThread: &groupThread,
-                        groupV2Params: groupV2Params,
-                        groupModelOptions: groupModelOptions,
-                        groupChange: groupChange,
-                        isFirstChange: index == 0,
-                        profileKeysByAci: &profileKeysByAci,
-                        authoritativeProfileKeysByAci: &authoritativeProfileKeysByAci,
-                        localIdentifiers: localIdentifiers,
-                        spamReportingMetadata: spamReportingMetadata,
-                        transaction: transaction
-                    )
-                }
+                    let applyResult = try autoreleasepool {
+                        try self.tryToApplySingleChangeFromService(
+                            groupThread: &groupThread,
+                            groupV2Params: groupV2Params,
+                            groupModelOptions: groupModelOptions,
+                            groupChange: groupChange,
+                            isFirstChange: index == 0,
+                            profileKeysByAci: &profileKeysByAci,
+                            authoritativeProfileKeysByAci: &authoritativeProfileKeysByAci,
+                            localIdentifiers: localIdentifiers,
+                            spamReportingMetadata: spamReportingMetadata,
+                            batch: batch,
+                            transaction: transaction
+                        )
+                    }
 
-                if
-                    let applyResult = applyResult,
-                    applyResult.wasLocalUserAddedByChange
-                {
-                    owsAssertDebug(
-                        localUserWasAddedBy == .unknown || applyResult.changeAuthor == .unknown || (index == 0 && localUserWasAddedBy == applyResult.changeAuthor),
-                        "Multiple change actions added the user to the group"
-                    )
-                    localUserWasAddedBy = applyResult.changeAuthor
+                    if
+                        let applyResult = applyResult,
+                        applyResult.wasLocalUserAddedByChange
+                    {
+                        owsAssertDebug(
+                            localUserWasAddedBy == .unknown || applyResult.changeAuthor == .unknown || (index == 0 && localUserWasAddedBy == applyResult.changeAuthor),
+                            "Multiple change actions added the user to the group"
+                        )
+                        localUserWasAddedBy = applyResult.changeAuthor
+                    }
                 }
             }
 
@@ -872,6 +886,7 @@ private extension GroupV2UpdatesImpl {
         authoritativeProfileKeysByAci: inout [Aci: Data],
         localIdentifiers: LocalIdentifiers,
         spamReportingMetadata: GroupUpdateSpamReportingMetadata,
+        batch: GroupManager.GroupThreadUpdateBatch,
         transaction: SDSAnyWriteTransaction
     ) throws -> ApplySingleChangeFromServiceResult? {
         guard let oldGroupModel = groupThread.groupModel as? TSGroupModelV2 else {
@@ -907,6 +922,13 @@ private extension GroupV2UpdatesImpl {
             }
         }
 
+        if changeRevision <= oldRevision, groupChange.snapshot == nil {
+            // Fetches of the changes since our revision start with the
+            // change that brought us to it, which we've already applied.
+            logger.info("Skipping change that's already been applied.")
+            return nil
+        }
+
         let newGroupModel: TSGroupModel
         let newDisappearingMessageToken: DisappearingMessageToken?
         let newProfileKeys: [Aci: Data]
@@ -974,6 +996,7 @@ private extension GroupV2UpdatesImpl {
             groupUpdateSource: groupUpdateSource,
             localIdentifiers: localIdentifiers,
             spamReportingMetadata: spamReportingMetadata,
+            batch: batch,
             transaction: transaction
         )
 
@@ -697,13 +697,24 @@ public class GroupsV2Impl: GroupsV2, Dependencies {
         }
     }
 
+    /// When we last fetched a snapshot of each group's state at its local
+    /// revision, keyed by hex group id.
+    private static let lastLocalRevisionSnapshotStore = SDSKeyValueStore(collection: "GroupsV2Impl.lastLocalRevisionSnapshot")
+
+    /// Local group state is built by applying change actions to it, so it's
+    /// occasionally replaced with a snapshot in case it has drifted.
+    private static let localRevisionSnapshotInterval: TimeInterval = kWeekInterval
+
     private func fetchGroupChangeActions(
         groupId: Data,
         groupV2Params: GroupV2Params,
         includeCurrentRevision: Bool
     ) async throws -> GroupChangePage {
-        let groupThread = NSObject.databaseStorage.read { transaction in
-            TSGroupThread.fetch(groupId: groupId, transaction: transaction)
+        let (groupThread, lastLocalRevisionSnapshotDate) = NSObject.databaseStorage.read { transaction in
+            return (
+                TSGroupThread.fetch(groupId: groupId, transaction: transaction),
+                Self.lastLocalRevisionSnapshotStore.getDate(groupId.hexadecimalString, transaction: transaction)
+            )
         }
 
         let fromRevision: UInt32
@@ -719,8 +730,14 @@ public class GroupsV2Impl: GroupsV2, Dependencies {
             // revision we want to start with from local data.
 
             if includeCurrentRevision {
+                // Snapshots describe every member, so in big groups they
+                // cost far more to fetch and decrypt than the changes since
+                // our revision. The change at our revision is fetched either
+                // way, and skipped when applied if it has no snapshot.
                 fromRevision = groupModel.revision
-                requireSnapshotForFirstChange = true
+                requireSnapshotForFirstChange = lastLocalRevisionSnapshotDate.map {
+                    abs($0.timeIntervalSinceNow) > Self.localRevisionSnapshotInterval
+                } ?? true
             } else {
                 fromRevision = groupModel.revision + 1
                 requireSnapshotForFirstChange = false
@@ -779,6 +796,11 @@ public class GroupsV2Impl: GroupsV2, Dependencies {
             downloadedAvatars: downloadedAvatars,
             groupV2Params: groupV2Params
         )
+        if requireSnapshotForFirstChange, changes.first?.snapshot != nil {
+            await NSObject.databaseStorage.awaitableWrite { transaction in
+                Self.lastLocalRevisionSnapshotStore.setDate(Date(), key: groupId.hexadecimalString, transaction: transaction)
+            }
+        }
         return GroupChangePage(changes: changes, earlyEnd: earlyEnd)
     }
 
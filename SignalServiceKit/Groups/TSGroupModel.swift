@@ -153,7 +153,13 @@ public class TSGroupModelV2: TSGroupModel {
 
     @objc
     public override var groupMembers: [SignalServiceAddress] {
-        return Array(groupMembership.fullMembers)
+        return groupMembership.fullMembersArray
+    }
+
+    @objc
+    public override var nonLocalGroupMembers: [SignalServiceAddress] {
+        let localAddress = DependenciesBridge.shared.tsAccountManager.localIdentifiersWithMaybeSneakyTransaction?.aciAddress
+        return groupMembership.fullMembers(excluding: localAddress)
     }
 
     public func hasUserFacingChangeCompared(
@@ -13,6 +13,7 @@ public final class BulkDeleteInteractionJobQueue {
     init(
         addressableMessageFinder: DeleteForMeAddressableMessageFinder,
         db: DB,
+        incrementalVacuum: IncrementalVacuum,
         interactionDeleteManager: InteractionDeleteManager,
         threadSoftDeleteManager: ThreadSoftDeleteManager,
         threadStore: ThreadStore
@@ -20,12 +21,14 @@ public final class BulkDeleteInteractionJobQueue {
         self.jobRunnerFactory = BulkDeleteInteractionJobRunnerFactory(
             addressableMessageFinder: addressableMessageFinder,
             db: db,
+            incrementalVacuum: incrementalVacuum,
             interactionDeleteManager: interactionDeleteManager,
             threadSoftDeleteManager: threadSoftDeleteManager,
             threadStore: threadStore
         )
         self.jobQueueRunner = JobQueueRunner(
             canExecuteJobsConcurrently: false,
+            priority: .utility,
             db: db,
             jobFinder: JobRecordFinderImpl(db: db),
             jobRunnerFactory: self.jobRunnerFactory
@@ -70,11 +73,18 @@ private class BulkDeleteInteractionJobRunner: JobRunner {
 
     private enum Constants {
         static let maxRetries: UInt = 110
-        static let deletionBatchSize: Int = 500
+        /// Deleting an interaction also deletes its attachments, reactions,
+        /// search index entries and so on, so batches are kept small enough
+        /// that a transaction doesn't run long past `maxTransactionDuration`.
+        static let deletionBatchSize: Int = 50
+        /// How long each transaction may spend deleting before yielding to
+        /// other writers, such as message processing.
+        static let maxTransactionDuration: TimeInterval = 0.1
     }
 
     private let addressableMessageFinder: DeleteForMeAddressableMessageFinder
     private let db: DB
+    private let incrementalVacuum: IncrementalVacuum
     private let interactionDeleteManager: InteractionDeleteManager
     private let threadSoftDeleteManager: ThreadSoftDeleteManager
     private let threadStore: ThreadStore
@@ -84,12 +94,14 @@ private class BulkDeleteInteractionJobRunner: JobRunner {
     init(
         addressableMessageFinder: DeleteForMeAddressableMessageFinder,
         db: DB,
+        incrementalVacuum: IncrementalVacuum,
         interactionDeleteManager: InteractionDeleteManager,
         threadSoftDeleteManager: ThreadSoftDeleteManager,
         threadStore: ThreadStore
     ) {
         self.addressableMessageFinder = addressableMessageFinder
         self.db = db
+        self.incrementalVacuum = incrementalVacuum
         self.interactionDeleteManager = interactionDeleteManager
         self.threadSoftDeleteManager = threadSoftDeleteManager
         self.threadStore = threadStore
@@ -126,7 +138,10 @@ private class BulkDeleteInteractionJobRunner: JobRunner {
 
         logger.info("Attempting to bulk-delete interactions for thread \(threadUniqueId), isFullThreadDelete \(fullThreadDeletionAnchorMessageRowId != nil).")
 
-        let deletedCount = await TimeGatedBatch.processAllAsync(db: db) { tx -> Int in
+        let deletedCount = await TimeGatedBatch.processAllAsync(
+            db: db,
+            yieldTxAfter: Constants.maxTransactionDuration
+        ) { tx -> Int in
             return self.deleteSomeInteractions(
                 threadUniqueId: threadUniqueId,
                 anchorMessageRowId: anchorMessageRowId,
@@ -185,6 +200,10 @@ private class BulkDeleteInteractionJobRunner: JobRunner {
                 )
             }
         }
+
+        if deletedCount > 0 {
+            await incrementalVacuum.run()
+        }
     }
 
     /// Delete a batch of interactions.
@@ -261,6 +280,7 @@ private class BulkDeleteInteractionJobRunnerFactory: JobRunnerFactory {
 
     private let addressableMessageFinder: DeleteForMeAddressableMessageFinder
     private let db: DB
+    private let incrementalVacuum: IncrementalVacuum
     private let interactionDeleteManager: InteractionDeleteManager
     private let threadSoftDeleteManager: ThreadSoftDeleteManager
     private let threadStore: ThreadStore
@@ -268,12 +288,14 @@ private class BulkDeleteInteractionJobRunnerFactory: JobRunnerFactory {
     init(
         addressableMessageFinder: DeleteForMeAddressableMessageFinder,
         db: DB,
+        incrementalVacuum: IncrementalVacuum,
         interactionDeleteManager: InteractionDeleteManager,
         threadSoftDeleteManager: ThreadSoftDeleteManager,
         threadStore: ThreadStore
     ) {
         self.addressableMessageFinder = addressableMessageFinder
         self.db = db
+        self.incrementalVacuum = incrementalVacuum
         self.interactionDeleteManager = interactionDeleteManager
         self.threadSoftDeleteManager = threadSoftDeleteManager
         self.threadStore = threadStore
@@ -283,6 +305,7 @@ private class BulkDeleteInteractionJobRunnerFactory: JobRunnerFactory {
         return BulkDeleteInteractionJobRunner(
             addressableMessageFinder: addressableMessageFinder,
             db: db,
+            incrementalVacuum: incrementalVacuum,
             interactionDeleteManager: interactionDeleteManager,
             threadSoftDeleteManager: threadSoftDeleteManager,
             threadStore: threadStore
@@ -43,6 +43,7 @@ public class CallRecordDeleteAllJobQueue {
         )
         self.jobQueueRunner = JobQueueRunner(
             canExecuteJobsConcurrently: false,
+            priority: .utility,
             db: db,
             jobFinder: JobRecordFinderImpl(db: db),
             jobRunnerFactory: self.jobRunnerFactory
@@ -20,6 +20,7 @@ public class IncomingContactSyncJobQueue: NSObject {
     public init(db: DB, reachabilityManager: SSKReachabilityManager) {
         self.jobQueueRunner = JobQueueRunner(
             canExecuteJobsConcurrently: false,
+            priority: .utility,
             db: db,
             jobFinder: JobRecordFinderImpl(db: db),
             jobRunnerFactory: IncomingContactSyncJobRunnerFactory()
@@ -136,6 +136,24 @@ public protocol JobRunnerFactory<JobRunnerType> {
     func buildRunner() -> JobRunnerType
 }
 
+/// Scheduling metrics for a `JobQueueRunner`.
+public struct JobQueueRunnerMetrics {
+    /// The number of jobs waiting to start.
+    public var queueDepth = 0
+    /// The number of jobs that are running, including those waiting to retry.
+    public var runningJobCount = 0
+    /// The number of jobs that have started since launch.
+    public var startedJobCount = 0
+    /// How long started jobs waited to start, in total.
+    public var totalQueueLatency: TimeInterval = 0
+    /// The longest any started job waited to start.
+    public var maxQueueLatency: TimeInterval = 0
+
+    public var averageQueueLatency: TimeInterval {
+        return startedJobCount > 0 ? totalQueueLatency / TimeInterval(startedJobCount) : 0
+    }
+}
+
 public class JobQueueRunner<
     JobFinderType: JobRecordFinder,
     JobRunnerFactoryType: JobRunnerFactory
@@ -143,34 +161,30 @@ public class JobQueueRunner<
     private let db: DB
     private let jobFinder: JobFinderType
     private let jobRunnerFactory: JobRunnerFactoryType
+    private let maxConcurrentJobCount: Int
+    private let priority: TaskPriority?
     private var observers = [NSObjectProtocol]()
 
-    private enum Mode {
-        /// The runner hasn't been started yet, or the runner is in the process of
-        /// starting. In both of these states, new jobs are held until persisted
-        /// jobs have been loaded. (This ensures new jobs execute after old jobs.)
-        case loading(canExecuteJobsConcurrently: Bool, jobsToEnqueueAfterLoading: [QueuedJob])
-
-        /// The runner is operating concurrently. New jobs are started immediately.
-        case concurrent
-
-        /// The runner is operating serially. No jobs are running, so a new job can
-        /// be started immediately.
-        case serialPaused
-
-        /// The runner is operating serially. A job is being executed, so any new
-        /// jobs will be added to `nextJobs`. When the current job finishes, it will
-        /// start the first job in `nextJobs`.
-        case serialRunning(nextJobs: [QueuedJob])
-    }
+    /// Jobs that wait longer than this to start are logged.
+    private let slowQueueLatency: TimeInterval = 10
 
     private struct QueuedJob {
         var rowId: JobRecord.RowId
         var runner: JobRunnerFactoryType.JobRunnerType
+        var enqueueDate = MonotonicDate()
     }
 
     private struct State {
-        var mode: Mode
+        /// Whether the runner has been started and has loaded persisted jobs.
+        /// Until then, new jobs are held in `pendingJobs` without being started.
+        /// (This ensures new jobs execute after old jobs.)
+        var isLoaded = false
+
+        /// The jobs waiting for one of the `maxConcurrentJobCount` slots, in
+        /// the order they'll be started.
+        var pendingJobs = [QueuedJob]()
+
+        var metrics = JobQueueRunnerMetrics()
 
         /// If a job encounters a transient failure, it can request to be run again
         /// after a delay. While it's waiting, it will store a reference to its
@@ -182,18 +196,42 @@ public class JobQueueRunner<
 
     private let state: AtomicValue<State>
 
-    public init(canExecuteJobsConcurrently: Bool, db: DB, jobFinder: JobFinderType, jobRunnerFactory: JobRunnerFactoryType) {
-        let mode: Mode = .loading(canExecuteJobsConcurrently: canExecuteJobsConcurrently, jobsToEnqueueAfterLoading: [])
-        self.state = AtomicValue<State>(State(mode: mode), lock: .init())
+    /// - Parameter canExecuteJobsConcurrently: If false, jobs run one at a
+    /// time in the order they were added.
+    /// - Parameter maxConcurrentJobCount: How many jobs may run at once if
+    /// `canExecuteJobsConcurrently` is true. A job waiting to retry keeps its
+    /// slot, so it's still attempted before newer jobs.
+    /// - Parameter priority: The priority of the tasks that run jobs, or nil
+    /// to inherit the priority of whoever adds the job.
+    public init(
+        canExecuteJobsConcurrently: Bool,
+        maxConcurrentJobCount: Int = 8,
+        priority: TaskPriority? = nil,
+        db: DB,
+        jobFinder: JobFinderType,
+        jobRunnerFactory: JobRunnerFactoryType
+    ) {
+        owsAssertDebug(maxConcurrentJobCount > 0)
+        self.state = AtomicValue<State>(State(), lock: .init())
         self.db = db
         self.jobFinder = jobFinder
         self.jobRunnerFactory = jobRunnerFactory
+        self.maxConcurrentJobCount = canExecuteJobsConcurrently ? max(1, maxConcurrentJobCount) : 1
+        self.priority = priority
     }
 
     deinit {
         observers.forEach { NotificationCenter.default.removeObserver($0) }
     }
 
+    public var metrics: JobQueueRunnerMetrics {
+        return state.update { state in
+            var metrics = state.metrics
+            metrics.queueDepth = state.pendingJobs.count
+            return metrics
+        }
+    }
+
     public func start(shouldRestartExistingJobs: Bool) {
         Task { await self._start(shouldRestartExistingJobs: shouldRestartExistingJobs) }
     }
@@ -209,40 +247,25 @@ public class JobQueueRunner<
             }
         }
         state.update { state in
-            let newMode: Mode
-            switch state.mode {
-            case .loading(let canExecuteJobsConcurrently, let jobsToEnqueueAfterLoading):
-                // Every runner must be started before it can execute jobs. When a runner
-                // is started, it may optionally fetch all previously-persisted jobs to
-                // execute. Any jobs that are scheduled while previously-persisted jobs are
-                // being loaded from disk must be scheduled after those
-                // previously-persisted jobs. If a new job is persisted while
-                // previously-persisted jobs are being loaded, then it may or may not be
-                // considered a previously-persisted job (depending on db race conditions).
-                // If it is present in the previously-persisted jobs, we want to ignore it
-                // since the new job might have a custom `JobRunner`.
-                let newRowIds = Set(jobsToEnqueueAfterLoading.map { $0.rowId })
-                var queuedJobs = [QueuedJob]()
-                queuedJobs.append(
-                    contentsOf: oldJobs.filter { !newRowIds.contains($0.id!) }.map {
-                        QueuedJob(rowId: $0.id!, runner: jobRunnerFactory.buildRunner())
-                    }
-                )
-                queuedJobs.append(contentsOf: jobsToEnqueueAfterLoading)
-                if canExecuteJobsConcurrently {
-                    queuedJobs.forEach(runJob(_:))
-                    newMode = .concurrent
-                } else if queuedJobs.isEmpty {
-                    newMode = .serialPaused
-                } else {
-                    var serialJobs = queuedJobs
-                    runJob(serialJobs.removeFirst())
-                    newMode = .serialRunning(nextJobs: serialJobs)
-                }
-            case .concurrent, .serialPaused, .serialRunning:
+            guard !state.isLoaded else {
                 owsFail("Can't start a JobQueueRunner more than once.")
             }
-            state.mode = newMode
+            // Every runner must be started before it can execute jobs. When a runner
+            // is started, it may optionally fetch all previously-persisted jobs to
+            // execute. Any jobs that are scheduled while previously-persisted jobs are
+            // being loaded from disk must be scheduled after those
+            // previously-persisted jobs. If a new job is persisted while
+            // previously-persisted jobs are being loaded, then it may or may not be
+            // considered a previously-persisted job (depending on db race conditions).
+            // If it is present in the previously-persisted jobs, we want to ignore it
+            // since the new job might have a custom `JobRunner`.
+            let newRowIds = Set(state.pendingJobs.map { $0.rowId })
+            let restartedJobs = oldJobs.filter { !newRowIds.contains($0.id!) }.map {
+                QueuedJob(rowId: $0.id!, runner: jobRunnerFactory.buildRunner())
+            }
+            state.pendingJobs.insert(contentsOf: restartedJobs, at: 0)
+            state.isLoaded = true
+            startJobsIfPossible(state: &state)
         }
     }
 
@@ -276,30 +299,39 @@ public class JobQueueRunner<
 
     private func enqueueAndStartJob(_ job: QueuedJob) {
         state.update { state in
-            switch state.mode {
-            case .loading(let canExecuteJobsConcurrently, let jobsToEnqueueAfterLoading):
-                state.mode = .loading(
-                    canExecuteJobsConcurrently: canExecuteJobsConcurrently,
-                    jobsToEnqueueAfterLoading: jobsToEnqueueAfterLoading + [job]
-                )
-            case .concurrent:
-                runJob(job)
-            case .serialPaused:
-                runJob(job)
-                state.mode = .serialRunning(nextJobs: [])
-            case .serialRunning(nextJobs: let nextJobs):
-                state.mode = .serialRunning(nextJobs: nextJobs + [job])
-            }
+            state.pendingJobs.append(job)
+            startJobsIfPossible(state: &state)
         }
     }
 
     // MARK: - Running Jobs
 
+    private func startJobsIfPossible(state: inout State) {
+        guard state.isLoaded else {
+            return
+        }
+        while state.metrics.runningJobCount < maxConcurrentJobCount, !state.pendingJobs.isEmpty {
+            let queuedJob = state.pendingJobs.removeFirst()
+            let queueLatency = TimeInterval(MonotonicDate() - queuedJob.enqueueDate) / TimeInterval(NSEC_PER_SEC)
+            state.metrics.runningJobCount += 1
+            state.metrics.startedJobCount += 1
+            state.metrics.totalQueueLatency += queueLatency
+            state.metrics.maxQueueLatency = max(state.metrics.maxQueueLatency, queueLatency)
+            if queueLatency >= slowQueueLatency {
+                Logger.warn("\(JobFinderType.JobRecordType.self) waited \(String(format: "%.1f", queueLatency))s to start; \(state.pendingJobs.count) more queued")
+            }
+            runJob(queuedJob)
+        }
+    }
+
     private func runJob(_ queuedJob: QueuedJob) {
-        Task {
+        Task(priority: priority) {
             let jobResult = await _runJob(queuedJob)
             await queuedJob.runner.didFinishJob(queuedJob.rowId, result: jobResult)
-            state.update { state in startNextJob(state: &state) }
+            state.update { state in
+                state.metrics.runningJobCount -= 1
+                startJobsIfPossible(state: &state)
+            }
         }
     }
 
@@ -358,24 +390,4 @@ public class JobQueueRunner<
             return .runAgain
         }
     }
-
-    private func startNextJob(state: inout State) {
-        switch state.mode {
-        case .loading, .serialPaused:
-            owsFailBeta("Can't start the next job.")
-        case .concurrent:
-            return  // All of these are started immediately.
-        case .serialRunning(nextJobs: var nextJobs):
-            state.mode = {
-                if nextJobs.isEmpty {
-                    // There's no more jobs to run, so pause the runner.
-                    return .serialPaused
-                } else {
-                    let jobToRun = nextJobs.removeFirst()
-                    runJob(jobToRun)
-                    return .serialRunning(nextJobs: nextJobs)
-                }
-            }()
-        }
-    }
 }
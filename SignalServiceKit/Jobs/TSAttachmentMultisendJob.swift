@@ -21,6 +21,7 @@ public class TSAttachmentMultisendJobQueue {
         self.jobRunnerFactory = TSAttachmentMultisendJobRunnerFactory()
         self.jobQueueRunner = JobQueueRunner(
             canExecuteJobsConcurrently: false,
+            priority: .userInitiated,
             db: db,
             jobFinder: JobRecordFinderImpl(db: db),
             jobRunnerFactory: jobRunnerFactory
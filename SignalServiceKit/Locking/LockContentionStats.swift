@@ -0,0 +1,127 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// How often, and for how long, the labeled locks are waited for and held.
+///
+/// Only used when `DebugFlags.lockContentionLogging` is on. Locks with the
+/// same label share one instance, so per-object locks (for example, one per
+/// thread or per job) are reported together. Once any instance exists, the
+/// worst offenders are logged every `reportInterval`.
+final class LockContentionStats {
+    struct Snapshot {
+        let label: String
+        let acquireCount: UInt64
+        let contendedCount: UInt64
+        let totalWaitNanoseconds: UInt64
+        let maxWaitNanoseconds: UInt64
+        let totalHoldNanoseconds: UInt64
+        let maxHoldNanoseconds: UInt64
+    }
+
+    let label: String
+
+    // These locks are created without a label so they're never instrumented.
+    private let lock = UnfairLock()
+    private var acquireCount: UInt64 = 0
+    private var contendedCount: UInt64 = 0
+    private var totalWaitNanoseconds: UInt64 = 0
+    private var maxWaitNanoseconds: UInt64 = 0
+    private var totalHoldNanoseconds: UInt64 = 0
+    private var maxHoldNanoseconds: UInt64 = 0
+
+    private init(label: String) {
+        self.label = label
+    }
+
+    /// - Parameter waitNanoseconds: How long the caller blocked, or nil if
+    ///   the lock was free.
+    func didAcquire(waitNanoseconds: UInt64?) {
+        lock.withLock {
+            acquireCount += 1
+            if let waitNanoseconds {
+                contendedCount += 1
+                totalWaitNanoseconds += waitNanoseconds
+                maxWaitNanoseconds = max(maxWaitNanoseconds, waitNanoseconds)
+            }
+        }
+    }
+
+    func didRelease(holdNanoseconds: UInt64) {
+        lock.withLock {
+            totalHoldNanoseconds += holdNanoseconds
+            maxHoldNanoseconds = max(maxHoldNanoseconds, holdNanoseconds)
+        }
+    }
+
+    func snapshot() -> Snapshot {
+        lock.withLock {
+            Snapshot(
+                label: label,
+                acquireCount: acquireCount,
+                contendedCount: contendedCount,
+                totalWaitNanoseconds: totalWaitNanoseconds,
+                maxWaitNanoseconds: maxWaitNanoseconds,
+                totalHoldNanoseconds: totalHoldNanoseconds,
+                maxHoldNanoseconds: maxHoldNanoseconds
+            )
+        }
+    }
+
+    // MARK: - Registry
+
+    static let reportInterval: TimeInterval = 60
+
+    private static let registryLock = UnfairLock()
+    private static var registry = [String: LockContentionStats]()
+    private static var reportTimer: DispatchSourceTimer?
+
+    static func stats(forLabel label: String) -> LockContentionStats {
+        registryLock.withLock {
+            if let stats = registry[label] {
+                return stats
+            }
+            let stats = LockContentionStats(label: label)
+            registry[label] = stats
+            if reportTimer == nil {
+                let timer = DispatchSource.makeTimerSource(queue: .global(qos: .utility))
+                timer.schedule(deadline: .now() + reportInterval, repeating: reportInterval)
+                timer.setEventHandler { logWorstOffenders() }
+                timer.resume()
+                reportTimer = timer
+            }
+            return stats
+        }
+    }
+
+    /// The labels that have spent the longest waiting for their locks, worst first.
+    static func worstOffenders(limit: Int) -> [Snapshot] {
+        let allStats = registryLock.withLock { Array(registry.values) }
+        return allStats
+            .map { $0.snapshot() }
+            .filter { $0.contendedCount > 0 }
+            .sorted { $0.totalWaitNanoseconds > $1.totalWaitNanoseconds }
+            .prefix(limit)
+            .map { $0 }
+    }
+
+    static func logWorstOffenders(limit: Int = 10) {
+        let offenders = worstOffenders(limit: limit)
+        guard !offenders.isEmpty else {
+            return
+        }
+        func ms(_ nanoseconds: UInt64) -> String {
+            String(format: "%.2fms", Double(nanoseconds) / Double(NSEC_PER_MSEC))
+        }
+        for offender in offenders {
+            Logger.debug(
+                "\(offender.label): contended \(offender.contendedCount)/\(offender.acquireCount), "
+                + "waited \(ms(offender.totalWaitNanoseconds)) (max \(ms(offender.maxWaitNanoseconds))), "
+                + "held \(ms(offender.totalHoldNanoseconds)) (max \(ms(offender.maxHoldNanoseconds)))"
+            )
+        }
+    }
+}
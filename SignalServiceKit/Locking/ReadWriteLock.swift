@@ -0,0 +1,61 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// A wrapper around pthread_rwlock_t, for state that's read far more often
+/// than it's written. Any number of readers can hold the lock at once; a
+/// writer holds it alone.
+///
+/// Like `UnfairLock`, this owns a heap allocation so the underlying lock has
+/// a stable address.
+///
+/// > Important: Not reentrant, and a reader can't upgrade to a writer.
+///
+/// > Warning: Errors are fatal and will terminate the process.
+public final class ReadWriteLock {
+    private let _lock: UnsafeMutablePointer<pthread_rwlock_t>
+
+    public init() {
+        _lock = .allocate(capacity: 1)
+        _lock.initialize(to: pthread_rwlock_t())
+        let result = pthread_rwlock_init(_lock, nil)
+        guard result == 0 else {
+            owsFail("pthread_rwlock_init failed: \(result)")
+        }
+    }
+
+    deinit {
+        pthread_rwlock_destroy(_lock)
+        _lock.deallocate()
+    }
+
+    /// Runs `block` holding a shared lock; blocks while a writer holds it.
+    public final func withReadLock<T>(_ block: () throws -> T) rethrows -> T {
+        let result = pthread_rwlock_rdlock(_lock)
+        guard result == 0 else {
+            owsFail("pthread_rwlock_rdlock failed: \(result)")
+        }
+        defer { unlock() }
+        return try block()
+    }
+
+    /// Runs `block` holding an exclusive lock; blocks while anyone else holds it.
+    public final func withWriteLock<T>(_ block: () throws -> T) rethrows -> T {
+        let result = pthread_rwlock_wrlock(_lock)
+        guard result == 0 else {
+            owsFail("pthread_rwlock_wrlock failed: \(result)")
+        }
+        defer { unlock() }
+        return try block()
+    }
+
+    private func unlock() {
+        let result = pthread_rwlock_unlock(_lock)
+        guard result == 0 else {
+            owsFail("pthread_rwlock_unlock failed: \(result)")
+        }
+    }
+}
@@ -16,9 +16,25 @@ import Foundation
 public final class UnfairLock: NSLocking {
     private let _lock: os_unfair_lock_t
 
-    public init() {
+    /// Set for labeled locks when `DebugFlags.lockContentionLogging` is on.
+    private let contentionStats: LockContentionStats?
+    /// When the current holder acquired the lock. Only touched while holding it.
+    private var lockedDate: MonotonicDate?
+
+    /// - Parameter label: Identifies this lock (and any others with the same
+    ///   label) in the contention logs; see `LockContentionStats`.
+    public convenience init(label: String? = nil) {
+        self.init(label: label, recordsContention: DebugFlags.lockContentionLogging)
+    }
+
+    init(label: String?, recordsContention: Bool) {
         _lock = .allocate(capacity: 1)
         _lock.initialize(to: os_unfair_lock_s())
+        if let label, recordsContention {
+            contentionStats = LockContentionStats.stats(forLabel: label)
+        } else {
+            contentionStats = nil
+        }
     }
 
     deinit {
@@ -28,19 +44,41 @@ public final class UnfairLock: NSLocking {
     /// Locks the lock. Blocks if the lock is held by another thread.
     /// Forwards to os_unfair_lock_lock() defined in os/lock.h
     public final func lock() {
-        os_unfair_lock_lock(_lock)
+        guard let contentionStats else {
+            os_unfair_lock_lock(_lock)
+            return
+        }
+        if os_unfair_lock_trylock(_lock) {
+            contentionStats.didAcquire(waitNanoseconds: nil)
+        } else {
+            let waitStartDate = MonotonicDate()
+            os_unfair_lock_lock(_lock)
+            contentionStats.didAcquire(waitNanoseconds: MonotonicDate() - waitStartDate)
+        }
+        lockedDate = MonotonicDate()
     }
 
     /// Unlocks the lock. Fatal error if the lock is owned by another thread.
     /// Forwards to os_unfair_lock_unlock() defined in os/lock.h
     public final func unlock() {
+        if let contentionStats, let lockedDate {
+            contentionStats.didRelease(holdNanoseconds: MonotonicDate() - lockedDate)
+            self.lockedDate = nil
+        }
         os_unfair_lock_unlock(_lock)
     }
 
     /// Attempts to lock the lock. Returns YES if the lock was successfully acquired.
     /// Forwards to os_unfair_lock_trylock() defined in os/lock.h
     public final func tryLock() -> Bool {
-        return os_unfair_lock_trylock(_lock)
+        guard os_unfair_lock_trylock(_lock) else {
+            return false
+        }
+        if let contentionStats {
+            contentionStats.didAcquire(waitNanoseconds: nil)
+            lockedDate = MonotonicDate()
+        }
+        return true
     }
 
     /// Fatal assert that the lock is owned by the current thread.
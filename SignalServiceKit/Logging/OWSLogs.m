@@ -4,24 +4,56 @@
 //
 
 #import "OWSLogs.h"
+#import <os/lock.h>
 #import <stdatomic.h>
 
 NS_ASSUME_NONNULL_BEGIN
 
 @implementation OWSLogger
 
+/// Returns an NSString for `cString`, which must be a string literal (e.g.
+/// `__FILE__` or `__PRETTY_FUNCTION__`).
+///
+/// We log constantly, and building (and trimming) new strings for the file
+/// and function on every call adds up. Literals have stable addresses, so we
+/// can cache them by pointer; there are only as many as there are log sites.
+static NSString *stringForCStringLiteral(const char *cString, BOOL shouldTrimFilePath)
+{
+    static os_unfair_lock lock = OS_UNFAIR_LOCK_INIT;
+    static CFMutableDictionaryRef trimmedStrings;
+    static CFMutableDictionaryRef untrimmedStrings;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        trimmedStrings = CFDictionaryCreateMutable(NULL, 0, NULL, &kCFTypeDictionaryValueCallBacks);
+        untrimmedStrings = CFDictionaryCreateMutable(NULL, 0, NULL, &kCFTypeDictionaryValueCallBacks);
+    });
+    CFMutableDictionaryRef strings = shouldTrimFilePath ? trimmedStrings : untrimmedStrings;
+
+    os_unfair_lock_lock(&lock);
+    NSString *_Nullable result = (__bridge NSString *)CFDictionaryGetValue(strings, cString);
+    os_unfair_lock_unlock(&lock);
+    if (result != nil) {
+        return result;
+    }
+
+    result = @(cString) ?: @"";
+    result = shouldTrimFilePath ? result.lastPathComponent : result;
+    os_unfair_lock_lock(&lock);
+    CFDictionarySetValue(strings, cString, (__bridge CFStringRef)result);
+    os_unfair_lock_unlock(&lock);
+    return result;
+}
+
 static void logUnconditionally(
     DDLogFlag flag, const char *file, BOOL shouldTrimFilePath, NSUInteger line, const char *function, NSString *message)
 {
     OWSCPrecondition(ShouldLogFlag(flag));
-    NSString *fileObj = [NSString stringWithFormat:@"%s", file];
-    fileObj = shouldTrimFilePath ? fileObj.lastPathComponent : fileObj;
     DDLogMessage *logMessage = [[DDLogMessage alloc] initWithMessage:message
                                                                level:ddLogLevel
                                                                 flag:flag
                                                              context:0
-                                                                file:fileObj
-                                                            function:[NSString stringWithFormat:@"%s", function]
+                                                                file:stringForCStringLiteral(file, shouldTrimFilePath)
+                                                            function:stringForCStringLiteral(function, NO)
                                                                 line:line
                                                                  tag:nil
                                                              options:0
@@ -37,10 +69,16 @@ void OWSLogUnconditionally(DDLogFlag flag,
     NSString *format,
     ...)
 {
-    va_list args;
-    va_start(args, format);
-    NSString *message = [[NSString alloc] initWithFormat:format arguments:args];
-    va_end(args);
+    NSString *message;
+    if ([format rangeOfString:@"%" options:NSLiteralSearch].location == NSNotFound) {
+        // Many log statements have no arguments; skip the formatter for them.
+        message = format;
+    } else {
+        va_list args;
+        va_start(args, format);
+        message = [[NSString alloc] initWithFormat:format arguments:args];
+        va_end(args);
+    }
     logUnconditionally(flag, file, shouldTrimFilePath, line, function, message);
 }
 
@@ -75,6 +75,7 @@ internal class MessageBackupProtoOutputStreamImpl: MessageBackupProtoOutputStrea
     }
 
     public func closeFileStream() throws {
-        try? outputStream.close()
+        // This surfaces any write that failed after writeFrame returned.
+        try outputStream.close()
     }
 }
@@ -255,8 +255,11 @@ private class GenericStreamProvider {
             runLoop: streamRunloop
         )
 
+        // Backup export is bottlenecked on building frames from the database,
+        // which must happen in order in one transaction; gzip and encryption
+        // can happen in parallel with that.
         let messageBackupOutputStream = MessageBackupProtoOutputStreamImpl(
-            outputStream: transformingOutputStream
+            outputStream: PipelinedOutputStream(outputStream: transformingOutputStream)
         )
 
         return .success(messageBackupOutputStream, fileUrl)
@@ -287,9 +290,14 @@ private class GenericStreamProvider {
             runLoop: streamRunloop
         )
 
-        let messageBackupInputStream = MessageBackupProtoInputStreamImpl(
-            inputStream: transformableInputStream,
-            inputStreamDelegate: inputStreamDelegate
+        // Backup import is bottlenecked on restoring frames into the database,
+        // which must happen in order in one transaction; decryption, gzip and
+        // parsing of the following frames can happen in parallel with that.
+        let messageBackupInputStream = MessageBackupReadAheadProtoInputStream(
+            inputStream: MessageBackupProtoInputStreamImpl(
+                inputStream: transformableInputStream,
+                inputStreamDelegate: inputStreamDelegate
+            )
         )
 
         return .success(messageBackupInputStream, rawStream: transformableInputStream)
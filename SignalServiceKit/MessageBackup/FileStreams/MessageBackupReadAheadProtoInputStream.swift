@@ -0,0 +1,122 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// Wrapper around a `MessageBackupProtoInputStream` that reads frames on a
+/// background queue, so that decryption, decompression and parsing of the
+/// next frames overlap with the caller restoring the current one.
+///
+/// The header is read synchronously; frames are read ahead once the first
+/// `readFrame()` call is made, and handed back in order. At most
+/// `maxBufferedFrameCount` frames are buffered; beyond that, the background
+/// read waits for the caller to catch up.
+///
+/// Read-ahead stops at the first result that isn't a success, or that has no
+/// more bytes available; that result is still handed back, in order.
+internal final class MessageBackupReadAheadProtoInputStream: MessageBackupProtoInputStream {
+
+    private let inputStream: MessageBackupProtoInputStream
+    private let maxBufferedFrameCount: Int
+
+    private let readQueue = DispatchQueue(label: "org.signal.message-backup-read-ahead", qos: .userInitiated)
+
+    /// Guards everything below.
+    private let condition = NSCondition()
+    private var bufferedResults = [MessageBackup.ProtoInputStreamReadResult<BackupProto_Frame>]()
+    private var isReadingAhead = false
+    private var hasStoppedReadingAhead = false
+    private var isClosed = false
+
+    internal init(
+        inputStream: MessageBackupProtoInputStream,
+        maxBufferedFrameCount: Int = 256
+    ) {
+        self.inputStream = inputStream
+        self.maxBufferedFrameCount = maxBufferedFrameCount
+    }
+
+    internal func readHeader() -> MessageBackup.ProtoInputStreamReadResult<BackupProto_BackupInfo> {
+        condition.lock()
+        let isReadingAhead = self.isReadingAhead
+        condition.unlock()
+        guard !isReadingAhead else {
+            owsFailDebug("Reading header after frames!")
+            return .protoDeserializationError(OWSAssertionError("Reading header after frames"))
+        }
+        return inputStream.readHeader()
+    }
+
+    internal func readFrame() -> MessageBackup.ProtoInputStreamReadResult<BackupProto_Frame> {
+        condition.lock()
+        if !isReadingAhead {
+            isReadingAhead = true
+            readQueue.async { self.readAhead() }
+        }
+        while bufferedResults.isEmpty, !hasStoppedReadingAhead {
+            condition.wait()
+        }
+        guard !bufferedResults.isEmpty else {
+            condition.unlock()
+            // Read-ahead is done, so it's safe to read directly (e.g. if
+            // the caller reads past the end, it gets the same error it would
+            // without read-ahead).
+            return inputStream.readFrame()
+        }
+        let result = bufferedResults.removeFirst()
+        condition.broadcast()
+        condition.unlock()
+        return result
+    }
+
+    private func readAhead() {
+        while true {
+            condition.lock()
+            while bufferedResults.count >= maxBufferedFrameCount, !isClosed {
+                condition.wait()
+            }
+            if isClosed {
+                hasStoppedReadingAhead = true
+                condition.broadcast()
+                condition.unlock()
+                return
+            }
+            condition.unlock()
+
+            let result = inputStream.readFrame()
+            let isLastResult: Bool
+            switch result {
+            case .success(_, let moreBytesAvailable):
+                isLastResult = !moreBytesAvailable
+            case .invalidByteLengthDelimiter, .protoDeserializationError:
+                isLastResult = true
+            }
+
+            condition.lock()
+            bufferedResults.append(result)
+            if isLastResult {
+                hasStoppedReadingAhead = true
+            }
+            condition.broadcast()
+            condition.unlock()
+
+            if isLastResult {
+                return
+            }
+        }
+    }
+
+    internal func closeFileStream() {
+        condition.lock()
+        isClosed = true
+        bufferedResults = []
+        condition.broadcast()
+        condition.unlock()
+
+        // Wait for any in-progress read before closing the wrapped stream.
+        readQueue.sync {}
+        inputStream.closeFileStream()
+    }
+}
@@ -3,7 +3,6 @@
 // SPDX-License-Identifier: AGPL-3.0-only
 //
 
-import blurhash
 import Foundation
 
 @objc
@@ -37,14 +36,11 @@ public class BlurHash: NSObject {
         } else {
             thumbnail = image
         }
-        guard let normalized = normalize(image: thumbnail, backgroundColor: .white) else {
-            throw OWSAssertionError("Could not normalize thumbnail.")
-        }
         // blurHash uses a DCT transform, so these are AC and DC components.
         // We use 4x3.
         //
         // https://github.com/woltapp/blurhash/blob/master/Algorithm.md
-        guard let blurHash = normalized.blurHash(numberOfComponents: (4, 3)) else {
+        guard let blurHash = normalizeAndEncode(image: thumbnail, backgroundColor: .white, componentsX: 4, componentsY: 3) else {
             throw OWSAssertionError("Could not generate blurHash.")
         }
         guard self.isValidBlurHash(blurHash) else {
@@ -61,20 +57,30 @@ public class BlurHash: NSObject {
     @objc(imageForBlurHash:)
     public class func image(for blurHash: String) -> UIImage? {
         let thumbnailSize = imageSize(for: blurHash)
-        guard let image = UIImage(blurHash: blurHash, size: thumbnailSize) else {
+        guard
+            let cgImage = BlurHashCodec.decode(
+                blurHash,
+                width: Int(thumbnailSize.width),
+                height: Int(thumbnailSize.height)
+            )
+        else {
             owsFailDebug("Couldn't generate image for blurHash.")
             return nil
         }
-        return image
+        return UIImage(cgImage: cgImage)
     }
 
     private class func imageSize(for blurHash: String) -> CGSize {
         return CGSize(width: kDefaultSize, height: kDefaultSize)
     }
 
-    // BlurHashEncode only works with images in a very specific
-    // pixel format: RGBA8888.
-    private class func normalize(image: UIImage, backgroundColor: UIColor) -> UIImage? {
+    // Encoding works on pixels in a very specific format: RGBA8888.
+    private class func normalizeAndEncode(
+        image: UIImage,
+        backgroundColor: UIColor,
+        componentsX: Int,
+        componentsY: Int
+    ) -> String? {
         guard let cgImage = image.cgImage else {
             owsFailDebug("Invalid image.")
             return nil
@@ -91,25 +97,35 @@ public class BlurHash: NSObject {
         let srcMinDimension: CGFloat = min(srcSize.width, srcSize.height)
         // Make sure the short dimension is N.
         let scale: CGFloat = min(1.0, kDefaultSize / srcMinDimension)
-        let dstWidth: Int = Int(round(srcSize.width * scale))
-        let dstHeight: Int = Int(round(srcSize.height * scale))
-        let dstSize = CGSize(width: dstWidth, height: dstHeight)
-        let dstRect = CGRect(origin: .zero, size: dstSize)
-        let colorSpace = CGColorSpaceCreateDeviceRGB()
-        // RGBA8888 pixel format
-        let bitmapInfo = CGBitmapInfo.byteOrder32Big.rawValue | CGImageAlphaInfo.premultipliedLast.rawValue
-        guard let context = CGContext(data: nil,
-                                      width: dstWidth,
-                                      height: dstHeight,
-                                      bitsPerComponent: 8,
-                                      bytesPerRow: dstWidth * 4,
-                                      space: colorSpace,
-                                      bitmapInfo: bitmapInfo) else {
-                                        return nil
+        let dstWidth: Int = max(1, Int(round(srcSize.width * scale)))
+        let dstHeight: Int = max(1, Int(round(srcSize.height * scale)))
+        let dstRect = CGRect(origin: .zero, size: CGSize(width: dstWidth, height: dstHeight))
+        let bytesPerRow = dstWidth * 4
+        var pixels = [UInt8](repeating: 0, count: bytesPerRow * dstHeight)
+        return pixels.withUnsafeMutableBytes { pixelsPtr -> String? in
+            let colorSpace = CGColorSpaceCreateDeviceRGB()
+            // RGBA8888 pixel format
+            let bitmapInfo = CGBitmapInfo.byteOrder32Big.rawValue | CGImageAlphaInfo.premultipliedLast.rawValue
+            guard let context = CGContext(data: pixelsPtr.baseAddress,
+                                          width: dstWidth,
+                                          height: dstHeight,
+                                          bitsPerComponent: 8,
+                                          bytesPerRow: bytesPerRow,
+                                          space: colorSpace,
+                                          bitmapInfo: bitmapInfo) else {
+                                            return nil
+            }
+            context.setFillColor(backgroundColor.cgColor)
+            context.fill(dstRect)
+            context.draw(cgImage, in: dstRect)
+            return BlurHashCodec.encode(
+                rgbaPixels: UnsafeBufferPointer(pixelsPtr.bindMemory(to: UInt8.self)),
+                width: dstWidth,
+                height: dstHeight,
+                bytesPerRow: bytesPerRow,
+                componentsX: componentsX,
+                componentsY: componentsY
+            )
         }
-        context.setFillColor(backgroundColor.cgColor)
-        context.fill(dstRect)
-        context.draw(cgImage, in: dstRect)
-        return (context.makeImage().flatMap { UIImage(cgImage: $0) })
     }
 }
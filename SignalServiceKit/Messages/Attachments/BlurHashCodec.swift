@@ -0,0 +1,320 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Accelerate
+import Foundation
+
+/// Encodes and decodes blurHashes.
+///
+/// A blurHash is a few DCT components per color channel. Both directions
+/// are expressed as small matrix products of the pixels (or components)
+/// with cosine bases, so Accelerate does the arithmetic and no `cos` is
+/// evaluated per pixel. The bases only depend on the component count and
+/// the image dimension, so they're cached; placeholders are always decoded
+/// at the same small size.
+///
+/// See: https://github.com/woltapp/blurhash/blob/master/Algorithm.md
+enum BlurHashCodec {
+
+    // MARK: - Decoding
+
+    /// Decodes `blurHash` into an opaque RGBX8888 image of the given size.
+    static func decode(_ blurHash: String, width: Int, height: Int, punch: Float = 1) -> CGImage? {
+        let characters = Array(blurHash.utf8)
+        guard characters.count >= 6, width > 0, height > 0 else {
+            return nil
+        }
+        guard let sizeFlag = decodeBase83(characters[0..<1]) else {
+            return nil
+        }
+        let componentsX = sizeFlag % 9 + 1
+        let componentsY = sizeFlag / 9 + 1
+        let componentCount = componentsX * componentsY
+        guard characters.count == 4 + 2 * componentCount else {
+            return nil
+        }
+        guard
+            let quantisedMaximumValue = decodeBase83(characters[1..<2]),
+            let dcValue = decodeBase83(characters[2..<6])
+        else {
+            return nil
+        }
+        let maximumValue = Float(quantisedMaximumValue + 1) / 166 * punch
+
+        // One plane per channel, each componentsY rows of componentsX.
+        var components = [[Float]](repeating: [Float](repeating: 0, count: componentCount), count: 3)
+        components[0][0] = sRGBToLinearTable[(dcValue >> 16) & 255]
+        components[1][0] = sRGBToLinearTable[(dcValue >> 8) & 255]
+        components[2][0] = sRGBToLinearTable[dcValue & 255]
+        for index in 1..<max(1, componentCount) {
+            guard let acValue = decodeBase83(characters[(4 + index * 2)..<(6 + index * 2)]) else {
+                return nil
+            }
+            components[0][index] = signedPow((Float(acValue / (19 * 19)) - 9) / 9, 2) * maximumValue
+            components[1][index] = signedPow((Float((acValue / 19) % 19) - 9) / 9, 2) * maximumValue
+            components[2][index] = signedPow((Float(acValue % 19) - 9) / 9, 2) * maximumValue
+        }
+
+        let xBasis = cosineBasis(componentCount: componentsX, size: width)
+        let yBasis = cosineBasis(componentCount: componentsY, size: height)
+
+        let pixelCount = width * height
+        var rows = [Float](repeating: 0, count: height * componentsX)
+        var plane = [Float](repeating: 0, count: pixelCount)
+        var pixels = [UInt8](repeating: 255, count: pixelCount * 4)
+        for channel in 0..<3 {
+            // (height × componentsY) · (componentsY × componentsX) · (componentsX × width)
+            vDSP_mmul(
+                yBasis.table, 1,
+                components[channel], 1,
+                &rows, 1,
+                vDSP_Length(height), vDSP_Length(componentsX), vDSP_Length(componentsY)
+            )
+            vDSP_mmul(
+                rows, 1,
+                xBasis.transposedTable, 1,
+                &plane, 1,
+                vDSP_Length(height), vDSP_Length(width), vDSP_Length(componentsX)
+            )
+            linearToSRGB(&plane)
+            plane.withUnsafeBufferPointer { planePtr in
+                pixels.withUnsafeMutableBufferPointer { pixelsPtr in
+                    vDSP_vfixru8(planePtr.baseAddress!, 1, pixelsPtr.baseAddress! + channel, 4, vDSP_Length(pixelCount))
+                }
+            }
+        }
+
+        guard let dataProvider = CGDataProvider(data: Data(pixels) as CFData) else {
+            return nil
+        }
+        return CGImage(
+            width: width,
+            height: height,
+            bitsPerComponent: 8,
+            bitsPerPixel: 32,
+            bytesPerRow: width * 4,
+            space: CGColorSpaceCreateDeviceRGB(),
+            bitmapInfo: CGBitmapInfo(rawValue: CGImageAlphaInfo.noneSkipLast.rawValue),
+            provider: dataProvider,
+            decode: nil,
+            shouldInterpolate: true,
+            intent: .defaultIntent
+        )
+    }
+
+    // MARK: - Encoding
+
+    /// Encodes opaque RGBA8888 pixels (alpha is ignored).
+    static func encode(
+        rgbaPixels: UnsafeBufferPointer<UInt8>,
+        width: Int,
+        height: Int,
+        bytesPerRow: Int,
+        componentsX: Int,
+        componentsY: Int
+    ) -> String? {
+        guard
+            (1...9).contains(componentsX),
+            (1...9).contains(componentsY),
+            width > 0,
+            height > 0,
+            bytesPerRow >= width * 4,
+            rgbaPixels.count >= bytesPerRow * (height - 1) + width * 4
+        else {
+            return nil
+        }
+
+        let pixelCount = width * height
+        var planes = [[Float]](repeating: [Float](repeating: 0, count: pixelCount), count: 3)
+        for y in 0..<height {
+            for x in 0..<width {
+                let offset = y * bytesPerRow + x * 4
+                let index = y * width + x
+                planes[0][index] = sRGBToLinearTable[Int(rgbaPixels[offset])]
+                planes[1][index] = sRGBToLinearTable[Int(rgbaPixels[offset + 1])]
+                planes[2][index] = sRGBToLinearTable[Int(rgbaPixels[offset + 2])]
+            }
+        }
+
+        let xBasis = cosineBasis(componentCount: componentsX, size: width)
+        let yBasis = cosineBasis(componentCount: componentsY, size: height)
+
+        let componentCount = componentsX * componentsY
+        var columns = [Float](repeating: 0, count: height * componentsX)
+        var components = [[Float]](repeating: [Float](repeating: 0, count: componentCount), count: 3)
+        for channel in 0..<3 {
+            // (componentsY × height) · (height × width) · (width × componentsX)
+            vDSP_mmul(
+                planes[channel], 1,
+                xBasis.table, 1,
+                &columns, 1,
+                vDSP_Length(height), vDSP_Length(componentsX), vDSP_Length(width)
+            )
+            vDSP_mmul(
+                yBasis.transposedTable, 1,
+                columns, 1,
+                &components[channel], 1,
+                vDSP_Length(componentsY), vDSP_Length(componentsX), vDSP_Length(height)
+            )
+            // The DC component is the average; the AC components are scaled
+            // by 2 to span -1...1.
+            var acScale = 2 / Float(pixelCount)
+            components[channel].withUnsafeMutableBufferPointer { ptr in
+                vDSP_vsmul(ptr.baseAddress!, 1, &acScale, ptr.baseAddress!, 1, vDSP_Length(componentCount))
+            }
+            components[channel][0] /= 2
+        }
+
+        var result = encodeBase83((componentsX - 1) + (componentsY - 1) * 9, length: 1)
+
+        let maximumValue: Float
+        if componentCount > 1 {
+            var actualMaximumValue: Float = 0
+            for channel in 0..<3 {
+                var channelMaximumValue: Float = 0
+                components[channel].withUnsafeBufferPointer { ptr in
+                    vDSP_maxmgv(ptr.baseAddress! + 1, 1, &channelMaximumValue, vDSP_Length(componentCount - 1))
+                }
+                actualMaximumValue = max(actualMaximumValue, channelMaximumValue)
+            }
+            let quantisedMaximumValue = Int(max(0, min(82, floor(actualMaximumValue * 166 - 0.5))))
+            maximumValue = Float(quantisedMaximumValue + 1) / 166
+            result += encodeBase83(quantisedMaximumValue, length: 1)
+        } else {
+            maximumValue = 1
+            result += encodeBase83(0, length: 1)
+        }
+
+        let dcValue = (linearToSRGB(components[0][0]) << 16) + (linearToSRGB(components[1][0]) << 8) + linearToSRGB(components[2][0])
+        result += encodeBase83(dcValue, length: 4)
+
+        func quantiseAC(_ value: Float) -> Int {
+            return Int(max(0, min(18, floor(signedPow(value / maximumValue, 0.5) * 9 + 9.5))))
+        }
+        for index in 1..<max(1, componentCount) {
+            let acValue = (
+                quantiseAC(components[0][index]) * 19 * 19
+                + quantiseAC(components[1][index]) * 19
+                + quantiseAC(components[2][index])
+            )
+            result += encodeBase83(acValue, length: 2)
+        }
+
+        return result
+    }
+
+    // MARK: - Cosine bases
+
+    private struct CosineBasis {
+        /// `size` rows of `componentCount` columns: cos(π · pixel · component / size).
+        let table: [Float]
+        /// `componentCount` rows of `size` columns.
+        let transposedTable: [Float]
+    }
+
+    /// Encoding sees arbitrary thumbnail dimensions, so this is bounded.
+    private static let maxCachedBasisCount = 64
+    private static let cosineBases = AtomicDictionary<String, CosineBasis>(lock: UnfairLock())
+
+    private static func cosineBasis(componentCount: Int, size: Int) -> CosineBasis {
+        let cacheKey = "\(componentCount)x\(size)"
+        if let basis = cosineBases[cacheKey] {
+            return basis
+        }
+
+        var table = [Float](repeating: 0, count: size * componentCount)
+        for pixel in 0..<size {
+            for component in 0..<componentCount {
+                table[pixel * componentCount + component] = cos(Float.pi * Float(pixel * component) / Float(size))
+            }
+        }
+        var transposedTable = [Float](repeating: 0, count: size * componentCount)
+        vDSP_mtrans(table, 1, &transposedTable, 1, vDSP_Length(componentCount), vDSP_Length(size))
+
+        let basis = CosineBasis(table: table, transposedTable: transposedTable)
+        if cosineBases.count >= maxCachedBasisCount {
+            cosineBases.removeAllValues()
+        }
+        cosineBases[cacheKey] = basis
+        return basis
+    }
+
+    // MARK: - Color
+
+    private static let sRGBToLinearTable: [Float] = (0..<256).map { byte in
+        let value = Float(byte) / 255
+        if value <= 0.04045 {
+            return value / 12.92
+        }
+        return pow((value + 0.055) / 1.055, 2.4)
+    }
+
+    /// Converts linear values to sRGB in 0...255, in place.
+    private static func linearToSRGB(_ values: inout [Float]) {
+        let count = values.count
+        var powers = [Float](repeating: 0, count: count)
+        values.withUnsafeMutableBufferPointer { valuesPtr in
+            var lowerBound: Float = 0
+            var upperBound: Float = 1
+            vDSP_vclip(valuesPtr.baseAddress!, 1, &lowerBound, &upperBound, valuesPtr.baseAddress!, 1, vDSP_Length(count))
+            var exponent: Float = 1 / 2.4
+            var count32 = Int32(count)
+            vvpowsf(&powers, &exponent, valuesPtr.baseAddress!, &count32)
+        }
+        for index in 0..<count {
+            let value = values[index]
+            values[index] = (value <= 0.0031308 ? value * 12.92 : 1.055 * powers[index] - 0.055) * 255
+        }
+    }
+
+    private static func linearToSRGB(_ value: Float) -> Int {
+        let value = max(0, min(1, value))
+        if value <= 0.0031308 {
+            return Int(value * 12.92 * 255 + 0.5)
+        }
+        return Int((1.055 * pow(value, 1 / 2.4) - 0.055) * 255 + 0.5)
+    }
+
+    private static func signedPow(_ value: Float, _ exponent: Float) -> Float {
+        return copysign(pow(abs(value), exponent), value)
+    }
+
+    // MARK: - Base 83
+
+    private static let base83Characters = Array("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz#$%*+,-.:;=?@[]^_{|}~".utf8)
+
+    private static let base83Values: [Int] = {
+        var result = [Int](repeating: -1, count: 128)
+        for (value, character) in base83Characters.enumerated() {
+            result[Int(character)] = value
+        }
+        return result
+    }()
+
+    private static func decodeBase83(_ characters: ArraySlice<UInt8>) -> Int? {
+        var result = 0
+        for character in characters {
+            guard character < 128 else {
+                return nil
+            }
+            let digit = base83Values[Int(character)]
+            guard digit >= 0 else {
+                return nil
+            }
+            result = result * 83 + digit
+        }
+        return result
+    }
+
+    private static func encodeBase83(_ value: Int, length: Int) -> String {
+        var characters = [UInt8](repeating: 0, count: length)
+        var remainder = value
+        for index in (0..<length).reversed() {
+            characters[index] = base83Characters[remainder % 83]
+            remainder /= 83
+        }
+        return String(decoding: characters, as: UTF8.self)
+    }
+}
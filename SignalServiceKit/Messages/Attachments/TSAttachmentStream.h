@@ -15,6 +15,7 @@ NS_ASSUME_NONNULL_BEGIN
 @class AudioWaveform;
 @class SSKProtoAttachmentPointer;
 @class TSAttachmentPointer;
+@class ThumbnailImageRequest;
 
 @protocol DataSource;
 
@@ -144,6 +145,8 @@ NS_DESIGNATED_INITIALIZER NS_SWIFT_NAME(init(grdbId:uniqueId:albumMessageId:atta
 
 - (NSArray<NSString *> *)allSecondaryFilePaths;
 
+/// The returned data is memory-mapped when possible. To copy the file elsewhere prefer `originalDataSource()`, which
+/// doesn't read the file at all.
 - (nullable NSData *)readDataFromFileWithError:(NSError **)error;
 - (BOOL)writeData:(NSData *)data error:(NSError **)error;
 
@@ -170,9 +173,8 @@ NS_DESIGNATED_INITIALIZER NS_SWIFT_NAME(init(grdbId:uniqueId:albumMessageId:atta
 
 #pragma mark - Thumbnails
 
-// On cache hit, the thumbnail will be returned synchronously and completion will never be invoked.
-// On cache miss, nil will be returned and success will be invoked if thumbnail can be generated;
-// otherwise failure will be invoked.
+// Decoded thumbnails are cached in memory by ThumbnailImageCache, and
+// concurrent requests for the same thumbnail share a single load.
 //
 // success and failure are invoked async on main.
 - (void)thumbnailImageWithSizeHint:(CGSize)sizeHint
@@ -181,6 +183,17 @@ NS_DESIGNATED_INITIALIZER NS_SWIFT_NAME(init(grdbId:uniqueId:albumMessageId:atta
 - (void)thumbnailImageWithQuality:(TSAttachmentThumbnailQuality)quality
                           success:(OWSThumbnailSuccess)success
                           failure:(OWSThumbnailFailure)failure NS_SWIFT_NAME(thumbnailImage(quality:success:failure:));
+// Returns nil on a cache hit. Otherwise, the returned request can be used to
+// cancel (e.g. when a cell scrolls off screen), which invokes failure.
+- (nullable ThumbnailImageRequest *)thumbnailImageWithQuality:(TSAttachmentThumbnailQuality)quality
+                                                     priority:(NSOperationQueuePriority)priority
+                                                      success:(OWSThumbnailSuccess)success
+                                                      failure:(OWSThumbnailFailure)failure
+    NS_SWIFT_NAME(thumbnailImage(quality:priority:success:failure:));
+
+// Returns the thumbnail only if it has already been decoded; never blocks.
+- (nullable UIImage *)cachedThumbnailImageWithQuality:(TSAttachmentThumbnailQuality)quality
+    NS_SWIFT_NAME(cachedThumbnailImage(quality:));
 
 - (nullable UIImage *)thumbnailImageSyncWithQuality:(TSAttachmentThumbnailQuality)quality
     NS_SWIFT_NAME(thumbnailImageSync(quality:));
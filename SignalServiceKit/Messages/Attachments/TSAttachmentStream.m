@@ -256,7 +256,9 @@ NSString *NSStringForAttachmentThumbnailQuality(TSAttachmentThumbnailQuality val
         OWSFailDebug(@"Missing path for attachment.");
         return nil;
     }
-    return [NSData dataWithContentsOfFile:filePath options:0 error:error];
+    // Attachments can be large, so let the VM page the file in on demand
+    // rather than copying all of it onto the heap.
+    return [NSData dataWithContentsOfFile:filePath options:NSDataReadingMappedIfSafe error:error];
 }
 
 - (BOOL)writeData:(NSData *)data error:(NSError **)error
@@ -401,6 +403,19 @@ NSString *NSStringForAttachmentThumbnailQuality(TSAttachmentThumbnailQuality val
 
 - (void)removeFile
 {
+    for (NSNumber *quality in @[
+             @(TSAttachmentThumbnailQuality_Small),
+             @(TSAttachmentThumbnailQuality_Medium),
+             @(TSAttachmentThumbnailQuality_MediumLarge),
+             @(TSAttachmentThumbnailQuality_Large),
+         ]) {
+        CGFloat thumbnailDimensionPoints =
+            [TSAttachmentStream thumbnailDimensionPointsForThumbnailQuality:quality.unsignedIntegerValue];
+        [ThumbnailImageCache.shared
+            removeThumbnailForKey:[ThumbnailImageCache keyForAttachmentId:self.uniqueId
+                                                          dimensionPoints:thumbnailDimensionPoints]];
+    }
+
     NSString *_Nullable thumbnailsDirPath = self.thumbnailsDirPath;
     if (thumbnailsDirPath && ![OWSFileSystem deleteFileIfExists:thumbnailsDirPath]) {
         OWSLogError(@"remove thumbnails dir failed.");
@@ -471,25 +486,24 @@ NSString *NSStringForAttachmentThumbnailQuality(TSAttachmentThumbnailQuality val
 {
     OWSAssertDebug(self.isImageMimeType || [self getAnimatedMimeType] != TSAnimatedMimeTypeNotAnimated);
 
-    BOOL result;
-    BOOL didUpdateCache = NO;
     @synchronized(self) {
-        if (!self.isValidImageCached) {
-            self.isValidImageCached = @([NSData imageMetadataWithPath:self.originalFilePath
-                                                             mimeType:self.contentType
-                                                       ignoreFileSize:ignoreSize]
-                                            .isValid);
-            if (!self.isValidImageCached.boolValue) {
-                OWSLogWarn(@"Invalid image.");
-            }
-            didUpdateCache = YES;
+        if (self.isValidImageCached) {
+            return self.isValidImageCached.boolValue;
         }
-        result = self.isValidImageCached.boolValue;
     }
 
-    if (didUpdateCache && self.canAsyncUpdate) {
-        [self applyChangeAsyncToLatestCopyWithChangeBlock:^(
-            TSAttachmentStream *latestInstance) { latestInstance.isValidImageCached = @(result); }];
+    // Only the image header is read, so this is cheap enough to not hold the
+    // lock for, or to persist the result of.
+    BOOL result = [NSData imageMetadataWithPath:self.originalFilePath
+                                       mimeType:self.contentType
+                                 ignoreFileSize:ignoreSize]
+                      .isValid;
+    if (!result) {
+        OWSLogWarn(@"Invalid image.");
+    }
+
+    @synchronized(self) {
+        self.isValidImageCached = @(result);
     }
 
     return result;
@@ -533,19 +547,17 @@ NSString *NSStringForAttachmentThumbnailQuality(TSAttachmentThumbnailQuality val
 
 - (BOOL)isAnimatedContent
 {
-    BOOL result;
-    BOOL didUpdateCache = NO;
     @synchronized(self) {
-        if (!self.isAnimatedCached) {
-            self.isAnimatedCached = @([self hasAnimatedImageContent]);
-            didUpdateCache = YES;
+        if (self.isAnimatedCached) {
+            return self.isAnimatedCached.boolValue;
         }
-        result = self.isAnimatedCached.boolValue;
     }
 
-    if (didUpdateCache && self.canAsyncUpdate) {
-        [self applyChangeAsyncToLatestCopyWithChangeBlock:^(
-            TSAttachmentStream *latestInstance) { latestInstance.isAnimatedCached = @(result); }];
+    // Like isValidImage, this only reads the image header.
+    BOOL result = [self hasAnimatedImageContent];
+
+    @synchronized(self) {
+        self.isAnimatedCached = @(result);
     }
 
     return result;
@@ -610,7 +622,7 @@ NSString *NSStringForAttachmentThumbnailQuality(TSAttachmentThumbnailQuality val
         return nil;
     }
 
-    return [NSData dataWithContentsOfFile:self.originalFilePath];
+    return [NSData dataWithContentsOfFile:self.originalFilePath options:NSDataReadingMappedIfSafe error:nil];
 }
 
 - (nullable UIImage *)videoStillImage
@@ -682,23 +694,28 @@ NSString *NSStringForAttachmentThumbnailQuality(TSAttachmentThumbnailQuality val
         if (self.cachedImageWidth && self.cachedImageHeight) {
             return CGSizeMake(self.cachedImageWidth.floatValue, self.cachedImageHeight.floatValue);
         }
+    }
 
-        CGSize imageSizePixels = [self calculateImageSizePixels];
-        if (imageSizePixels.width <= 0 || imageSizePixels.height <= 0) {
-            return CGSizeZero;
-        }
+    CGSize imageSizePixels = [self calculateImageSizePixels];
+    if (imageSizePixels.width <= 0 || imageSizePixels.height <= 0) {
+        return CGSizeZero;
+    }
+
+    @synchronized(self) {
         self.cachedImageWidth = @(imageSizePixels.width);
         self.cachedImageHeight = @(imageSizePixels.height);
+    }
 
-        if (self.canAsyncUpdate) {
-            [self applyChangeAsyncToLatestCopyWithChangeBlock:^(TSAttachmentStream *latestInstance) {
-                latestInstance.cachedImageWidth = @(imageSizePixels.width);
-                latestInstance.cachedImageHeight = @(imageSizePixels.height);
-            }];
-        }
-
-        return imageSizePixels;
+    // Image sizes come from the header, but video sizes require decoding a
+    // frame, so those are worth persisting.
+    if (self.isVideoMimeType && self.canAsyncUpdate) {
+        [self applyChangeAsyncToLatestCopyWithChangeBlock:^(TSAttachmentStream *latestInstance) {
+            latestInstance.cachedImageWidth = @(imageSizePixels.width);
+            latestInstance.cachedImageHeight = @(imageSizePixels.height);
+        }];
     }
+
+    return imageSizePixels;
 }
 
 - (CGSize)cachedMediaSize
@@ -804,95 +821,120 @@ NSString *NSStringForAttachmentThumbnailQuality(TSAttachmentThumbnailQuality val
         thumbnailDimensionPoints = [TSAttachmentStream thumbnailDimensionPointsLarge];
     }
 
-    [self thumbnailImageWithThumbnailDimensionPoints:thumbnailDimensionPoints success:success failure:failure];
+    [self thumbnailImageWithThumbnailDimensionPoints:thumbnailDimensionPoints
+                                            priority:NSOperationQueuePriorityNormal
+                                             success:success
+                                             failure:failure];
 }
 
 - (void)thumbnailImageWithQuality:(TSAttachmentThumbnailQuality)quality
                           success:(OWSThumbnailSuccess)success
                           failure:(OWSThumbnailFailure)failure
+{
+    [self thumbnailImageWithQuality:quality priority:NSOperationQueuePriorityNormal success:success failure:failure];
+}
+
+- (nullable ThumbnailImageRequest *)thumbnailImageWithQuality:(TSAttachmentThumbnailQuality)quality
+                                                     priority:(NSOperationQueuePriority)priority
+                                                      success:(OWSThumbnailSuccess)success
+                                                      failure:(OWSThumbnailFailure)failure
 {
     CGFloat thumbnailDimensionPoints = [TSAttachmentStream thumbnailDimensionPointsForThumbnailQuality:quality];
-    [self thumbnailImageWithThumbnailDimensionPoints:thumbnailDimensionPoints success:success failure:failure];
+    return [self thumbnailImageWithThumbnailDimensionPoints:thumbnailDimensionPoints
+                                                   priority:priority
+                                                    success:success
+                                                    failure:failure];
 }
 
-- (void)thumbnailImageWithThumbnailDimensionPoints:(CGFloat)thumbnailDimensionPoints
-                                           success:(OWSThumbnailSuccess)success
-                                           failure:(OWSThumbnailFailure)failure
+- (nullable UIImage *)cachedThumbnailImageWithQuality:(TSAttachmentThumbnailQuality)quality
 {
-    [self loadedThumbnailWithThumbnailDimensionPoints:thumbnailDimensionPoints
+    CGFloat thumbnailDimensionPoints = [TSAttachmentStream thumbnailDimensionPointsForThumbnailQuality:quality];
+    NSString *key = [ThumbnailImageCache keyForAttachmentId:self.uniqueId dimensionPoints:thumbnailDimensionPoints];
+    return [ThumbnailImageCache.shared cachedThumbnailForKey:key].image;
+}
+
+- (nullable ThumbnailImageRequest *)thumbnailImageWithThumbnailDimensionPoints:(CGFloat)thumbnailDimensionPoints
+                                                                     priority:(NSOperationQueuePriority)priority
+                                                                      success:(OWSThumbnailSuccess)success
+                                                                      failure:(OWSThumbnailFailure)failure
+{
+    return [self loadedThumbnailWithThumbnailDimensionPoints:thumbnailDimensionPoints
+        priority:priority
         success:^(OWSLoadedThumbnail *thumbnail) { DispatchMainThreadSafe(^{ success(thumbnail.image); }); }
         failure:^{ DispatchMainThreadSafe(^{ failure(); }); }];
 }
 
-- (void)loadedThumbnailWithThumbnailDimensionPoints:(CGFloat)thumbnailDimensionPoints
-                                            success:(OWSLoadedThumbnailSuccess)success
-                                            failure:(OWSThumbnailFailure)failure
+- (nullable ThumbnailImageRequest *)loadedThumbnailWithThumbnailDimensionPoints:(CGFloat)thumbnailDimensionPoints
+                                                                      priority:(NSOperationQueuePriority)priority
+                                                                       success:(OWSLoadedThumbnailSuccess)success
+                                                                       failure:(OWSThumbnailFailure)failure
 {
-    [self.thumbnailLoadingOperationQueue addOperationWithBlock:^{
-        @autoreleasepool {
-            if (!self.isValidVisualMedia) {
-                // Never thumbnail (or try to use the original of) invalid media.
-                OWSFailDebug(@"Invalid image.");
-                failure();
-                return;
-            }
+    NSString *key = [ThumbnailImageCache keyForAttachmentId:self.uniqueId dimensionPoints:thumbnailDimensionPoints];
+    return [ThumbnailImageCache.shared loadThumbnailForKey:key
+        priority:priority
+        loader:^(OWSLoadedThumbnailSuccess loadSuccess, OWSThumbnailFailure loadFailure) {
+            [self loadThumbnailUncachedWithThumbnailDimensionPoints:thumbnailDimensionPoints
+                                                            success:loadSuccess
+                                                            failure:loadFailure];
+        }
+        success:success
+        failure:failure];
+}
 
-            CGSize originalSizePoints = self.imageSizePoints;
-            if (self.imageSizePixels.width < 1 || self.imageSizePixels.height < 1) {
-                failure();
-                return;
-            }
+// This should only be called by ThumbnailImageCache, which loads on its own
+// queue and caches the decoded result.
+- (void)loadThumbnailUncachedWithThumbnailDimensionPoints:(CGFloat)thumbnailDimensionPoints
+                                                  success:(OWSLoadedThumbnailSuccess)success
+                                                  failure:(OWSThumbnailFailure)failure
+{
+    if (!self.isValidVisualMedia) {
+        // Never thumbnail (or try to use the original of) invalid media.
+        OWSFailDebug(@"Invalid image.");
+        failure();
+        return;
+    }
 
-            if (originalSizePoints.width <= thumbnailDimensionPoints
-                && originalSizePoints.height <= thumbnailDimensionPoints && self.isImageMimeType) {
-                // There's no point in generating a thumbnail if the original is smaller than the
-                // thumbnail size. Only do this for images. We still need to generate thumbnails
-                // for videos.
-                NSString *originalFilePath = self.originalFilePath;
-                UIImage *_Nullable originalImage = self.originalImage;
-                if (originalImage == nil) {
-                    OWSFailDebug(@"originalImage was unexpectedly nil");
-                    failure();
-                } else {
-                    success([[OWSLoadedThumbnail alloc] initWithImage:originalImage filePath:originalFilePath]);
-                }
-                return;
-            }
+    CGSize originalSizePoints = self.imageSizePoints;
+    if (self.imageSizePixels.width < 1 || self.imageSizePixels.height < 1) {
+        failure();
+        return;
+    }
 
-            NSString *thumbnailPath = [self pathForThumbnailDimensionPoints:thumbnailDimensionPoints];
-            if ([[NSFileManager defaultManager] fileExistsAtPath:thumbnailPath]) {
-                UIImage *_Nullable image = [UIImage imageWithContentsOfFile:thumbnailPath];
-                if (!image) {
-                    OWSFailDebug(@"couldn't load image.");
-                    failure();
-                } else {
-                    success([[OWSLoadedThumbnail alloc] initWithImage:image filePath:thumbnailPath]);
-                }
-                return;
-            }
+    if (originalSizePoints.width <= thumbnailDimensionPoints
+        && originalSizePoints.height <= thumbnailDimensionPoints && self.isImageMimeType) {
+        // There's no point in generating a thumbnail if the original is smaller than the
+        // thumbnail size. Only do this for images. We still need to generate thumbnails
+        // for videos.
+        NSString *originalFilePath = self.originalFilePath;
+        UIImage *_Nullable originalImage = self.originalImage;
+        if (originalImage == nil) {
+            OWSFailDebug(@"originalImage was unexpectedly nil");
+            failure();
+        } else {
+            success([[OWSLoadedThumbnail alloc] initWithImage:originalImage filePath:originalFilePath]);
+        }
+        return;
+    }
 
-            [OWSThumbnailService.shared ensureThumbnailForAttachment:self
-                                            thumbnailDimensionPoints:thumbnailDimensionPoints
-                                                             success:success
-                                                             failure:^(NSError *error) {
-                                                                 OWSLogError(@"Failed to create thumbnail: %@", error);
-                                                                 failure();
-                                                             }];
+    NSString *thumbnailPath = [self pathForThumbnailDimensionPoints:thumbnailDimensionPoints];
+    if ([[NSFileManager defaultManager] fileExistsAtPath:thumbnailPath]) {
+        UIImage *_Nullable image = [UIImage imageWithContentsOfFile:thumbnailPath];
+        if (!image) {
+            OWSFailDebug(@"couldn't load image.");
+            failure();
+        } else {
+            success([[OWSLoadedThumbnail alloc] initWithImage:image filePath:thumbnailPath]);
         }
-    }];
-    return;
-}
+        return;
+    }
 
-- (NSOperationQueue *)thumbnailLoadingOperationQueue
-{
-    static dispatch_once_t onceToken;
-    static NSOperationQueue *operationQueue;
-    dispatch_once(&onceToken, ^{
-        operationQueue = [NSOperationQueue new];
-        operationQueue.name = @"ThumbnailLoading";
-        operationQueue.maxConcurrentOperationCount = 4;
-    });
-    return operationQueue;
+    [OWSThumbnailService.shared ensureThumbnailForAttachment:self
+                                    thumbnailDimensionPoints:thumbnailDimensionPoints
+                                                     success:success
+                                                     failure:^(NSError *error) {
+                                                         OWSLogError(@"Failed to create thumbnail: %@", error);
+                                                         failure();
+                                                     }];
 }
 
 - (nullable OWSLoadedThumbnail *)loadedThumbnailSyncWithDimensionPoints:(CGFloat)thumbnailDimensionPoints
@@ -901,6 +943,7 @@ NSString *NSStringForAttachmentThumbnailQuality(TSAttachmentThumbnailQuality val
 
     __block OWSLoadedThumbnail *_Nullable asyncLoadedThumbnail = nil;
     [self loadedThumbnailWithThumbnailDimensionPoints:thumbnailDimensionPoints
+        priority:NSOperationQueuePriorityHigh
         success:^(OWSLoadedThumbnail *thumbnail) {
             @synchronized(self) {
                 asyncLoadedThumbnail = thumbnail;
@@ -28,4 +28,52 @@ extension TSAttachmentStream {
             tx: tx.asV2Write
         )
     }
+
+    // MARK: - Reading
+
+    /// A DataSource backed by the attachment's file.
+    ///
+    /// Copying this (e.g. with `writeCopyingDataSource`) copies or clones the
+    /// file on disk rather than reading it into memory, which matters for big
+    /// attachments in the memory-constrained extensions. The file isn't
+    /// deleted when the DataSource is deallocated; don't consume it.
+    public func originalDataSource() throws -> DataSource {
+        guard let originalMediaURL else {
+            throw OWSAssertionError("Missing URL for attachment.")
+        }
+        let dataSource = try DataSourcePath(fileUrl: originalMediaURL, shouldDeleteOnDeallocation: false)
+        dataSource.sourceFilename = sourceFilename
+        return dataSource
+    }
+
+    public static let defaultReadChunkSize = 64 * 1024
+
+    /// Reads the attachment's file sequentially, `chunkSize` bytes at a time,
+    /// so that callers that only need to stream it (to hash or export it) never
+    /// hold more than one chunk in memory.
+    public func enumerateOriginalFileChunks(
+        chunkSize: Int = TSAttachmentStream.defaultReadChunkSize,
+        block: (Data) throws -> Void
+    ) throws {
+        owsAssertDebug(chunkSize > 0)
+        guard let originalMediaURL else {
+            throw OWSAssertionError("Missing URL for attachment.")
+        }
+        let fileHandle = try FileHandle(forReadingFrom: originalMediaURL)
+        defer {
+            try? fileHandle.close()
+        }
+        while true {
+            let shouldContinue: Bool = try autoreleasepool {
+                guard let chunk = try fileHandle.read(upToCount: chunkSize), !chunk.isEmpty else {
+                    return false
+                }
+                try block(chunk)
+                return true
+            }
+            if !shouldContinue {
+                break
+            }
+        }
+    }
 }
@@ -112,7 +112,7 @@ extension TSAttachmentStream: TSResourceStream {
         guard let originalFilePath else {
             throw OWSAssertionError("Missing file path!")
         }
-        return try NSData(contentsOfFile: originalFilePath) as Data
+        return try Data(contentsOf: URL(fileURLWithPath: originalFilePath), options: .mappedIfSafe)
     }
 
     public func decryptedLongText() throws -> String {
@@ -280,16 +280,29 @@ extension TSAttachmentStream: TSResourceStream {
     // MARK: - Thumbnails
 
     public func thumbnailImage(quality: AttachmentThumbnailQuality) async -> UIImage? {
-        return await withCheckedContinuation { continuation in
-            self.thumbnailImage(
-                quality: quality.tsQuality,
-                success: { image in
-                    continuation.resume(returning: image)
-                },
-                failure: {
-                    continuation.resume(returning: nil)
+        let priority: Operation.QueuePriority = Task.currentPriority >= .userInitiated ? .high : .normal
+        // Cancelling the task (e.g. because the cell was reused) frees up the
+        // loading queue for the thumbnails that are still needed.
+        let pendingRequest = AtomicOptional<ThumbnailImageRequest>(nil, lock: .sharedGlobal)
+        return await withTaskCancellationHandler {
+            return await withCheckedContinuation { continuation in
+                let request = self.thumbnailImage(
+                    quality: quality.tsQuality,
+                    priority: priority,
+                    success: { image in
+                        continuation.resume(returning: image)
+                    },
+                    failure: {
+                        continuation.resume(returning: nil)
+                    }
+                )
+                pendingRequest.set(request)
+                if Task.isCancelled {
+                    request?.cancel()
                 }
-            )
+            }
+        } onCancel: {
+            pendingRequest.get()?.cancel()
         }
     }
 
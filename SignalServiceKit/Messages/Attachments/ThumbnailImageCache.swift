@@ -0,0 +1,225 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// A pending request to `ThumbnailImageCache`.
+@objc
+public final class ThumbnailImageRequest: NSObject {
+    fileprivate let key: String
+    fileprivate weak var cache: ThumbnailImageCache?
+
+    fileprivate init(key: String, cache: ThumbnailImageCache) {
+        self.key = key
+        self.cache = cache
+    }
+
+    /// Stops waiting for the thumbnail; the request's failure block is
+    /// invoked if it hasn't already completed. The thumbnail is only not
+    /// loaded if no other request is waiting for it.
+    @objc
+    public func cancel() {
+        cache?.cancel(self)
+    }
+}
+
+// MARK: -
+
+/// A shared memory cache of decoded thumbnails that bounds how many can be
+/// loaded at once and coalesces concurrent requests for the same thumbnail.
+///
+/// Scrolling back and forth through media-heavy chats asks for the same
+/// thumbnails over and over, and decoding them is expensive.
+@objc
+public final class ThumbnailImageCache: NSObject {
+
+    public typealias Loader = (_ success: @escaping (OWSLoadedThumbnail) -> Void, _ failure: @escaping () -> Void) -> Void
+
+    public struct Counters: Equatable {
+        public var hits: UInt64 = 0
+        public var misses: UInt64 = 0
+        /// Misses that joined a load that was already in flight.
+        public var coalescedLoads: UInt64 = 0
+        public var cancellations: UInt64 = 0
+
+        public var hitRate: Double {
+            let total = hits + misses
+            return total > 0 ? Double(hits) / Double(total) : 0
+        }
+    }
+
+    @objc
+    public static let shared = ThumbnailImageCache(
+        byteLimit: CurrentAppContext().isMainApp ? 48 * 1024 * 1024 : 4 * 1024 * 1024
+    )
+
+    private final class InFlightLoad {
+        /// Retained by the queue until it finishes.
+        weak var operation: Operation?
+        var waiters = [ObjectIdentifier: Waiter]()
+
+        init(operation: Operation) {
+            self.operation = operation
+        }
+    }
+
+    private struct Waiter {
+        let request: ThumbnailImageRequest
+        let success: (OWSLoadedThumbnail) -> Void
+        let failure: () -> Void
+    }
+
+    /// NSCache evicts on its own under memory pressure; the cost of each entry
+    /// is the size of its decoded bitmap.
+    private let cache = NSCache<NSString, OWSLoadedThumbnail>()
+    private let operationQueue: OperationQueue
+
+    private let lock = UnfairLock()
+    private var inFlightLoads = [String: InFlightLoad]()
+    private var _counters = Counters()
+
+    public init(byteLimit: Int, maxConcurrentLoadCount: Int = 4) {
+        cache.totalCostLimit = byteLimit
+        operationQueue = OperationQueue()
+        operationQueue.name = "ThumbnailLoading"
+        operationQueue.maxConcurrentOperationCount = maxConcurrentLoadCount
+    }
+
+    public var counters: Counters {
+        lock.withLock { _counters }
+    }
+
+    @objc(keyForAttachmentId:dimensionPoints:)
+    public static func key(attachmentId: String, dimensionPoints: CGFloat) -> String {
+        return "\(attachmentId)-\(UInt(dimensionPoints))"
+    }
+
+    /// Returns the thumbnail if it's already been decoded. Intended for callers
+    /// on the main thread that would like to avoid a placeholder.
+    @objc(cachedThumbnailForKey:)
+    public func cachedThumbnail(forKey key: String) -> OWSLoadedThumbnail? {
+        let thumbnail = cache.object(forKey: key as NSString)
+        lock.withLock {
+            if thumbnail != nil {
+                _counters.hits += 1
+            } else {
+                _counters.misses += 1
+            }
+        }
+        return thumbnail
+    }
+
+    /// Fetches the thumbnail for `key`, using `loader` (which is invoked on a
+    /// background queue) if it isn't cached or already being loaded.
+    ///
+    /// On a cache hit, `success` is invoked synchronously and nil is returned.
+    /// Otherwise `success` or `failure` is invoked later on an arbitrary
+    /// queue.
+    @objc
+    @discardableResult
+    public func loadThumbnail(
+        forKey key: String,
+        priority: Operation.QueuePriority,
+        loader: @escaping Loader,
+        success: @escaping (OWSLoadedThumbnail) -> Void,
+        failure: @escaping () -> Void
+    ) -> ThumbnailImageRequest? {
+        if let thumbnail = cache.object(forKey: key as NSString) {
+            lock.withLock { _counters.hits += 1 }
+            success(thumbnail)
+            return nil
+        }
+
+        let request = ThumbnailImageRequest(key: key, cache: self)
+        let waiter = Waiter(request: request, success: success, failure: failure)
+        let operationToEnqueue: Operation? = lock.withLock {
+            _counters.misses += 1
+            if let inFlightLoad = inFlightLoads[key] {
+                _counters.coalescedLoads += 1
+                inFlightLoad.waiters[ObjectIdentifier(request)] = waiter
+                if let operation = inFlightLoad.operation, priority.rawValue > operation.queuePriority.rawValue {
+                    operation.queuePriority = priority
+                }
+                return nil
+            }
+
+            let operation = BlockOperation()
+            let inFlightLoad = InFlightLoad(operation: operation)
+            operation.addExecutionBlock { [weak self] in
+                autoreleasepool {
+                    loader(
+                        { thumbnail in self?.didFinishLoad(inFlightLoad, key: key, thumbnail: thumbnail) },
+                        { self?.didFinishLoad(inFlightLoad, key: key, thumbnail: nil) }
+                    )
+                }
+            }
+            operation.queuePriority = priority
+            inFlightLoad.waiters[ObjectIdentifier(request)] = waiter
+            inFlightLoads[key] = inFlightLoad
+            return operation
+        }
+        if let operationToEnqueue {
+            operationQueue.addOperation(operationToEnqueue)
+        }
+        return request
+    }
+
+    private func didFinishLoad(_ inFlightLoad: InFlightLoad, key: String, thumbnail: OWSLoadedThumbnail?) {
+        if let thumbnail {
+            cache.setObject(thumbnail, forKey: key as NSString, cost: Self.byteCost(of: thumbnail.image))
+        }
+        let waiters: [Waiter] = lock.withLock {
+            if inFlightLoads[key] === inFlightLoad {
+                inFlightLoads[key] = nil
+            }
+            let waiters = Array(inFlightLoad.waiters.values)
+            inFlightLoad.waiters = [:]
+            return waiters
+        }
+        for waiter in waiters {
+            if let thumbnail {
+                waiter.success(thumbnail)
+            } else {
+                waiter.failure()
+            }
+        }
+    }
+
+    fileprivate func cancel(_ request: ThumbnailImageRequest) {
+        let waiter: Waiter? = lock.withLock {
+            guard
+                let inFlightLoad = inFlightLoads[request.key],
+                let waiter = inFlightLoad.waiters.removeValue(forKey: ObjectIdentifier(request))
+            else {
+                return nil
+            }
+            _counters.cancellations += 1
+            if inFlightLoad.waiters.isEmpty, let operation = inFlightLoad.operation, !operation.isExecuting {
+                // Nobody is waiting for it anymore, so don't bother loading it.
+                operation.cancel()
+                inFlightLoads[request.key] = nil
+            }
+            return waiter
+        }
+        waiter?.failure()
+    }
+
+    @objc(removeThumbnailForKey:)
+    public func removeThumbnail(forKey key: String) {
+        cache.removeObject(forKey: key as NSString)
+    }
+
+    @objc
+    public func removeAllThumbnails() {
+        cache.removeAllObjects()
+    }
+
+    private static func byteCost(of image: UIImage) -> Int {
+        if let cgImage = image.cgImage {
+            return cgImage.bytesPerRow * cgImage.height
+        }
+        return Int(image.size.width * image.scale * image.size.height * image.scale * 4)
+    }
+}
@@ -624,16 +624,17 @@ public class AttachmentManagerImpl: AttachmentManager {
                     sha256ContentHash: pendingAttachment.sha256ContentHash,
                     tx: tx
                 )?.streamInfo?.localRelativeFilePath == pendingAttachment.localRelativeFilePath
-                let hasOrphanRecord = orphanedAttachmentStore.orphanAttachmentExists(
-                    with: pendingAttachment.orphanRecordId,
-                    tx: tx
-                )
+                let hasOrphanRecord = pendingAttachment.orphanRecordId.map {
+                    orphanedAttachmentStore.orphanAttachmentExists(with: $0, tx: tx)
+                } ?? false
 
                 // Typically, we'd expect an orphan record to exist (which ensures that
                 // if this creation transaction fails, the file on disk gets cleaned up).
                 // However, in AttachmentMultisend we send the same pending attachment file multiple
                 // times; the first instance creates an attachment and deletes the orphan record.
-                // We can detect this (and know its ok) if the existing attachment uses the same file
+                // And if the validator found an existing attachment with the same contents, it
+                // wrote no files and there is no orphan record at all.
+                // We can detect these (and know its ok) if the existing attachment uses the same file
                 // as our pending attachment; that only happens if it shared the pending attachment.
                 guard hasExistingAttachmentWithSameFile || hasOrphanRecord else {
                     throw OWSAssertionError("Attachment file deleted before creation")
@@ -645,9 +646,9 @@ public class AttachmentManagerImpl: AttachmentManager {
                     reference: referenceParams,
                     tx: tx
                 )
-                if hasOrphanRecord {
+                if hasOrphanRecord, let orphanRecordId = pendingAttachment.orphanRecordId {
                     // Make sure to clear out the pending attachment from the orphan table so it isn't deleted!
-                    try orphanedAttachmentCleaner.releasePendingAttachment(withId: pendingAttachment.orphanRecordId, tx: tx)
+                    try orphanedAttachmentCleaner.releasePendingAttachment(withId: orphanRecordId, tx: tx)
                 }
             } catch let AttachmentInsertError.duplicatePlaintextHash(existingAttachmentId) {
                 // Already have an attachment with the same plaintext hash! Create a new reference to it instead.
@@ -734,6 +735,27 @@ public class AttachmentManagerImpl: AttachmentManager {
                 throw OWSAssertionError("Original attachment not found")
             }
 
+            // If another quote of the original already has a thumbnail stream,
+            // add a reference to it instead of making (and writing) another.
+            if let existingThumbnail = try attachmentStore
+                .allQuotedReplyAttachments(forOriginalAttachmentId: originalAttachment.id, tx: tx)
+                .first(where: { $0.asStream() != nil })
+            {
+                let referenceParams = AttachmentReference.ConstructionParams(
+                    owner: try referenceOwner.build(
+                        orderInOwner: nil,
+                        knownIdInOwner: .none,
+                        renderingFlag: originalAttachmentSource.renderingFlag,
+                        contentType: existingThumbnail.streamInfo?.contentType.raw
+                    ),
+                    sourceFilename: originalAttachmentSource.sourceFilename,
+                    sourceUnencryptedByteCount: originalAttachmentSource.sourceUnencryptedByteCount,
+                    sourceMediaSizePixels: originalAttachmentSource.sourceMediaSizePixels
+                )
+                try attachmentStore.addOwner(referenceParams, for: existingThumbnail.id, tx: tx)
+                return
+            }
+
             let thumbnailMimeType: String
             let thumbnailBlurHash: String?
             let thumbnailTransitTierInfo: Attachment.TransitTierInfo?
@@ -421,7 +421,7 @@ public class TSAttachmentManager {
             ) else {
                 throw OWSAssertionError("Missing source attachment!")
             }
-            let data = try existingAttachment.readDataFromFile()
+            let existingDataSource = try existingAttachment.originalDataSource()
             attachment = TSAttachmentStream(
                 contentType: dataSource.mimeType,
                 byteCount: existingAttachment.byteCount,
@@ -430,7 +430,7 @@ public class TSAttachmentManager {
                 attachmentType: dataSource.renderingFlag.tsAttachmentType,
                 albumMessageId: albumMessageId
             )
-            try attachment.write(data)
+            try attachment.writeCopyingDataSource(existingDataSource)
         }
         return attachment
     }
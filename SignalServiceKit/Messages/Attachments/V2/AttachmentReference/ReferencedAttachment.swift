@@ -62,12 +62,13 @@ extension ReferencedAttachment {
 
     public func previewText() -> String {
         let mimeType = attachment.mimeType
+        let classification = MimeTypeUtil.classify(mimeType)
 
         let attachmentString: String
-        if MimeTypeUtil.isSupportedMaybeAnimatedMimeType(mimeType) || reference.renderingFlag == .shouldLoop {
+        if classification.contains(.maybeAnimated) || reference.renderingFlag == .shouldLoop {
             let isGIF = mimeType.caseInsensitiveCompare(MimeType.imageGif.rawValue) == .orderedSame
             let isLoopingVideo = reference.renderingFlag == .shouldLoop
-                && MimeTypeUtil.isSupportedVideoMimeType(mimeType)
+                && classification.contains(.video)
 
             if (isGIF || isLoopingVideo) {
                 attachmentString = OWSLocalizedString(
@@ -80,17 +81,17 @@ extension ReferencedAttachment {
                     comment: "Short text label for a photo attachment, used for thread preview and on the lock screen"
                 )
             }
-        } else if MimeTypeUtil.isSupportedImageMimeType(mimeType) {
+        } else if classification.contains(.image) {
             attachmentString = OWSLocalizedString(
                 "ATTACHMENT_TYPE_PHOTO",
                 comment: "Short text label for a photo attachment, used for thread preview and on the lock screen"
             )
-        } else if MimeTypeUtil.isSupportedVideoMimeType(mimeType) {
+        } else if classification.contains(.video) {
             attachmentString = OWSLocalizedString(
                 "ATTACHMENT_TYPE_VIDEO",
                 comment: "Short text label for a video attachment, used for thread preview and on the lock screen"
             )
-        } else if MimeTypeUtil.isSupportedAudioMimeType(mimeType) {
+        } else if classification.contains(.audio) {
             if reference.renderingFlag == .voiceMessage {
                 attachmentString = OWSLocalizedString(
                     "ATTACHMENT_TYPE_VOICE_MESSAGE",
@@ -114,20 +115,20 @@ extension ReferencedAttachment {
     }
 
     public func previewEmoji() -> String {
-        let mimeType = attachment.mimeType
-        if MimeTypeUtil.isSupportedAudioMimeType(mimeType) {
+        let classification = MimeTypeUtil.classify(attachment.mimeType)
+        if classification.contains(.audio) {
             if reference.renderingFlag == .voiceMessage {
                 return "🎤"
             }
         }
 
-        if MimeTypeUtil.isSupportedDefinitelyAnimatedMimeType(mimeType) || reference.renderingFlag == .shouldLoop {
+        if classification.contains(.definitelyAnimated) || reference.renderingFlag == .shouldLoop {
             return "🎡"
-        } else if MimeTypeUtil.isSupportedImageMimeType(mimeType) {
+        } else if classification.contains(.image) {
             return "📷"
-        } else if MimeTypeUtil.isSupportedVideoMimeType(mimeType) {
+        } else if classification.contains(.video) {
             return "🎥"
-        } else if MimeTypeUtil.isSupportedAudioMimeType(mimeType) {
+        } else if classification.contains(.audio) {
             return "🎧"
         } else {
             return "📎"
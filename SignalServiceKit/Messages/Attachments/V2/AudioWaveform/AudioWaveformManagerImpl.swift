@@ -324,6 +324,12 @@ public class AudioWaveformManagerImpl: AudioWaveformManager {
     /// It's too intensive to sample a waveform for really long audio files.
     fileprivate static let maximumDuration: TimeInterval = 15 * kMinuteInterval
 
+    /// The waveform only has `AudioWaveform.sampleCount` bins, so there's no
+    /// need to decode (and convert to decibels) every sample of a 48kHz stereo
+    /// track; a mono mix at a low rate gives the same shape for a fraction of
+    /// the CPU.
+    private static let samplingRate: Double = 8000
+
     private func sampleWaveform(asset: AVAsset) throws -> AudioWaveform {
         try Task.checkCancellation()
 
@@ -345,9 +351,13 @@ public class AudioWaveformManagerImpl: AudioWaveformManager {
                 AVLinearPCMBitDepthKey: 16,
                 AVLinearPCMIsBigEndianKey: false,
                 AVLinearPCMIsFloatKey: false,
-                AVLinearPCMIsNonInterleaved: false
+                AVLinearPCMIsNonInterleaved: false,
+                AVSampleRateKey: Self.samplingRate,
+                AVNumberOfChannelsKey: 1
             ]
         )
+        // We only read the samples, so don't copy every buffer.
+        trackOutput.alwaysCopiesSampleData = false
         assetReader.add(trackOutput)
 
         let decibelSamples = try readDecibels(from: assetReader)
@@ -382,21 +392,30 @@ public class AudioWaveformManagerImpl: AudioWaveformManager {
                 break
             }
 
-            var lengthAtOffset = 0
-            var dataPointer: UnsafeMutablePointer<Int8>?
-            let result = CMBlockBufferGetDataPointer(
-                blockBuffer,
-                atOffset: 0,
-                lengthAtOffsetOut: &lengthAtOffset,
-                totalLengthOut: nil,
-                dataPointerOut: &dataPointer
-            )
-            guard result == kCMBlockBufferNoErr else {
-                owsFailDebug("track data unexpectedly inaccessible")
-                throw AudioWaveformError.invalidAudioFile
+            // Block buffers aren't necessarily contiguous; sample each of
+            // their segments in place.
+            let totalLength = CMBlockBufferGetDataLength(blockBuffer)
+            var offset = 0
+            while offset < totalLength {
+                var lengthAtOffset = 0
+                var dataPointer: UnsafeMutablePointer<Int8>?
+                let result = CMBlockBufferGetDataPointer(
+                    blockBuffer,
+                    atOffset: offset,
+                    lengthAtOffsetOut: &lengthAtOffset,
+                    totalLengthOut: nil,
+                    dataPointerOut: &dataPointer
+                )
+                guard result == kCMBlockBufferNoErr, let dataPointer, lengthAtOffset > 0 else {
+                    owsFailDebug("track data unexpectedly inaccessible")
+                    throw AudioWaveformError.invalidAudioFile
+                }
+                let segmentSampleCount = lengthAtOffset / MemoryLayout<Int16>.size
+                dataPointer.withMemoryRebound(to: Int16.self, capacity: segmentSampleCount) {
+                    sampler.update(UnsafeBufferPointer(start: $0, count: segmentSampleCount))
+                }
+                offset += lengthAtOffset
             }
-            let bufferPointer = UnsafeBufferPointer(start: dataPointer, count: lengthAtOffset)
-            bufferPointer.withMemoryRebound(to: Int16.self) { sampler.update($0) }
             CMSampleBufferInvalidate(nextSampleBuffer)
         }
 
@@ -404,31 +423,7 @@ public class AudioWaveformManagerImpl: AudioWaveformManager {
     }
 
     private func sampleCount(from assetReader: AVAssetReader) -> Int {
-        let samplesPerChannel = Int(assetReader.asset.duration.value)
-
-        // We will read in the samples from each channel, interleaved since
-        // we only draw one waveform. This gives us an average of the channels
-        // if it is, for example, a stereo audio file.
-        return samplesPerChannel * channelCount(from: assetReader)
-    }
-
-    private func channelCount(from assetReader: AVAssetReader) -> Int {
-        guard
-            let output = assetReader.outputs.first as? AVAssetReaderTrackOutput,
-            let formatDescriptions = output.track.formatDescriptions as? [CMFormatDescription]
-        else {
-            return 0
-        }
-
-        var channelCount = 0
-
-        for description in formatDescriptions {
-            guard let basicDescription = CMAudioFormatDescriptionGetStreamBasicDescription(description) else {
-                continue
-            }
-            channelCount = Int(basicDescription.pointee.mChannelsPerFrame)
-        }
-
-        return channelCount
+        // The track output resamples to a single channel at `samplingRate`.
+        return Int(CMTimeGetSeconds(assetReader.asset.duration) * Self.samplingRate)
     }
 }
@@ -54,6 +54,11 @@ class AudioWaveformSampler {
 
     func update(_ samples: UnsafeBufferPointer<Int16>) {
         let sampleCount = samples.count
+        guard sampleCount > 0, self.output.count < self.outputCount else {
+            // `inputCount` is estimated from the duration, so there may be a
+            // few more samples than expected; ignore them.
+            return
+        }
         if self.buffer.count < sampleCount {
             self.buffer.append(contentsOf: Array(repeating: 0, count: sampleCount - self.buffer.count))
         }
@@ -100,6 +105,9 @@ class AudioWaveformSampler {
                 // If we reached the end of the chunk, add it to the output.
                 if self.currentSegmentRemainingCount <= 0 {
                     self.output.append(self.currentSegmentAverage)
+                    if self.output.count >= self.outputCount {
+                        return
+                    }
                     self.currentSegmentAverage = 0  // technically redundant
 
                     self.currentSegmentCount = self.segmentLength
@@ -115,6 +123,11 @@ class AudioWaveformSampler {
     }
 
     func finalize() -> [Float] {
+        // If there were fewer samples than expected, keep the partial segment.
+        if self.currentSegmentRemainingCount < self.currentSegmentCount, self.output.count < self.outputCount {
+            self.output.append(self.currentSegmentAverage)
+            self.currentSegmentRemainingCount = self.currentSegmentCount
+        }
         assert(self.output.count <= self.outputCount)
         return self.output
     }
@@ -45,6 +45,23 @@ final class AudioWaveformSamplerTest: XCTestCase {
         XCTAssertEqual(sampler.finalize().count, 5)
     }
 
+    func testMoreSamplesThanExpected() {
+        let sampler = AudioWaveformSampler(inputCount: 8, outputCount: 2)
+        sampler.update(Array(repeating: 32_767, count: 8))
+        sampler.update(Array(repeating: 0, count: 8))
+        let result = sampler.finalize()
+        XCTAssertEqual(result.count, 2)
+        XCTAssertEqual(result.last!, 0, accuracy: 0.01)
+    }
+
+    func testFewerSamplesThanExpected() {
+        let sampler = AudioWaveformSampler(inputCount: 8, outputCount: 2)
+        sampler.update(Array(repeating: 32_767, count: 6))
+        let result = sampler.finalize()
+        XCTAssertEqual(result.count, 2)
+        XCTAssertEqual(result.last!, 0, accuracy: 0.01)
+    }
+
     func testEmpty() {
         let sampler = AudioWaveformSampler(inputCount: 5, outputCount: 10)
         sampler.update([])
@@ -17,7 +17,10 @@ public protocol PendingAttachment {
     var renderingFlag: AttachmentReference.RenderingFlag { get }
     var sourceFilename: String? { get }
     var validatedContentType: Attachment.ContentType { get }
-    var orphanRecordId: OrphanedAttachmentRecord.IDType { get }
+    /// Orphan record for the newly written files, or nil if an attachment with the
+    /// same plaintext hash already existed; then no files are written, and the file
+    /// fields are that attachment's, to be shared with it.
+    var orphanRecordId: OrphanedAttachmentRecord.IDType? { get }
 }
 
 public protocol RevalidatedAttachment {
@@ -9,14 +9,20 @@ import Foundation
 
 public class AttachmentContentValidatorImpl: AttachmentContentValidator {
 
+    private let attachmentStore: AttachmentStore
     private let audioWaveformManager: AudioWaveformManager
+    private let db: DB
     private let orphanedAttachmentCleaner: OrphanedAttachmentCleaner
 
     public init(
+        attachmentStore: AttachmentStore,
         audioWaveformManager: AudioWaveformManager,
+        db: DB,
         orphanedAttachmentCleaner: OrphanedAttachmentCleaner
     ) {
+        self.attachmentStore = attachmentStore
         self.audioWaveformManager = audioWaveformManager
+        self.db = db
         self.orphanedAttachmentCleaner = orphanedAttachmentCleaner
     }
 
@@ -268,7 +274,7 @@ public class AttachmentContentValidatorImpl: AttachmentContentValidator {
         let renderingFlag: AttachmentReference.RenderingFlag
         let sourceFilename: String?
         let validatedContentType: Attachment.ContentType
-        let orphanRecordId: OrphanedAttachmentRecord.IDType
+        let orphanRecordId: OrphanedAttachmentRecord.IDType?
     }
 
     private struct RevalidatedAttachmentImpl: RevalidatedAttachment {
@@ -296,6 +302,31 @@ public class AttachmentContentValidatorImpl: AttachmentContentValidator {
         renderingFlag: AttachmentReference.RenderingFlag,
         sourceFilename: String?
     ) throws -> PendingAttachment {
+        let sha256ContentHash = try computePlaintextHash(input: input)
+
+        // If we already have these exact contents, share that attachment's
+        // files rather than validating, encrypting and writing them again.
+        if
+            let existingStream = db.read(block: { tx in
+                attachmentStore.fetchAttachment(sha256ContentHash: sha256ContentHash, tx: tx)?.asStream()
+            })
+        {
+            return PendingAttachmentImpl(
+                blurHash: existingStream.attachment.blurHash,
+                sha256ContentHash: sha256ContentHash,
+                encryptedByteCount: existingStream.encryptedByteCount,
+                unencryptedByteCount: existingStream.unencryptedByteCount,
+                mimeType: existingStream.attachment.mimeType,
+                encryptionKey: existingStream.attachment.encryptionKey,
+                digestSHA256Ciphertext: existingStream.encryptedFileSha256Digest,
+                localRelativeFilePath: existingStream.localRelativeFilePath,
+                renderingFlag: renderingFlag,
+                sourceFilename: sourceFilename,
+                validatedContentType: existingStream.contentType,
+                orphanRecordId: nil
+            )
+        }
+
         var mimeType = mimeType
         let contentTypeResult = try validateContentType(
             input: input,
@@ -304,6 +335,7 @@ public class AttachmentContentValidatorImpl: AttachmentContentValidator {
         )
         return try prepareAttachmentFiles(
             input: input,
+            sha256ContentHash: sha256ContentHash,
             encryptionKey: encryptionKey,
             mimeType: mimeType,
             renderingFlag: renderingFlag,
@@ -729,14 +761,13 @@ public class AttachmentContentValidatorImpl: AttachmentContentValidator {
 
     private func prepareAttachmentFiles(
         input: Input,
+        sha256ContentHash: Data,
         encryptionKey: Data,
         mimeType: String,
         renderingFlag: AttachmentReference.RenderingFlag,
         sourceFilename: String?,
         contentResult: ContentTypeResult
     ) throws -> PendingAttachmentImpl {
-        let primaryFilePlaintextHash = try computePlaintextHash(input: input)
-
         // First encrypt the files that need encrypting.
         let (primaryPendingFile, primaryFileMetadata) = try encryptPrimaryFile(
             input: input,
@@ -769,7 +800,7 @@ public class AttachmentContentValidatorImpl: AttachmentContentValidator {
 
         return PendingAttachmentImpl(
             blurHash: contentResult.blurHash,
-            sha256ContentHash: primaryFilePlaintextHash,
+            sha256ContentHash: sha256ContentHash,
             encryptedByteCount: primaryEncryptedLength,
             unencryptedByteCount: primaryPlaintextLength,
             mimeType: mimeType,
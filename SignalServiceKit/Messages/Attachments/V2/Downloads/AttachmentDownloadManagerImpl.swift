@@ -28,6 +28,7 @@ public class AttachmentDownloadManagerImpl: AttachmentDownloadManager {
         appReadiness: Shims.AppReadiness,
         attachmentDownloadStore: AttachmentDownloadStore,
         attachmentStore: AttachmentStore,
+        attachmentThumbnailService: AttachmentThumbnailService,
         attachmentValidator: AttachmentContentValidator,
         currentCallProvider: CurrentCallProvider,
         dateProvider: @escaping DateProvider,
@@ -79,6 +80,7 @@ public class AttachmentDownloadManagerImpl: AttachmentDownloadManager {
         self.queueLoader = PersistedQueueLoader(
             attachmentDownloadStore: attachmentDownloadStore,
             attachmentStore: attachmentStore,
+            attachmentThumbnailService: attachmentThumbnailService,
             attachmentUpdater: attachmentUpdater,
             dateProvider: dateProvider,
             db: db,
@@ -279,6 +281,7 @@ public class AttachmentDownloadManagerImpl: AttachmentDownloadManager {
 
         private let attachmentDownloadStore: AttachmentDownloadStore
         private let attachmentStore: AttachmentStore
+        private let attachmentThumbnailService: AttachmentThumbnailService
         private let attachmentUpdater: AttachmentUpdater
         private let dateProvider: DateProvider
         private let db: DB
@@ -293,6 +296,7 @@ public class AttachmentDownloadManagerImpl: AttachmentDownloadManager {
         init(
             attachmentDownloadStore: AttachmentDownloadStore,
             attachmentStore: AttachmentStore,
+            attachmentThumbnailService: AttachmentThumbnailService,
             attachmentUpdater: AttachmentUpdater,
             dateProvider: @escaping DateProvider,
             db: DB,
@@ -306,6 +310,7 @@ public class AttachmentDownloadManagerImpl: AttachmentDownloadManager {
         ) {
             self.attachmentDownloadStore = attachmentDownloadStore
             self.attachmentStore = attachmentStore
+            self.attachmentThumbnailService = attachmentThumbnailService
             self.attachmentUpdater = attachmentUpdater
             self.dateProvider = dateProvider
             self.db = db
@@ -345,6 +350,23 @@ public class AttachmentDownloadManagerImpl: AttachmentDownloadManager {
                 currentRecordIds.insert($0)
             }
 
+            // Downloads do other work (and may wait for a download slot)
+            // before they reach the CDN; open connections in the meantime.
+            let cdnNumbers = db.read { tx in
+                Set(records.compactMap { record -> UInt32? in
+                    let attachment = attachmentStore.fetch(id: record.attachmentId, tx: tx)
+                    switch record.sourceType {
+                    case .transitTier:
+                        return attachment?.transitTierInfo?.cdnNumber
+                    case .mediaTierFullsize:
+                        return attachment?.mediaTierInfo?.cdnNumber
+                    case .mediaTierThumbnail:
+                        return attachment?.thumbnailMediaTierInfo?.cdnNumber
+                    }
+                })
+            }
+            downloadQueue.prewarmConnections(cdnNumbers: cdnNumbers)
+
             try await withThrowingTaskGroup(of: Void.self) { taskGroup in
                 records.forEach { record in
                     taskGroup.addTask {
@@ -662,6 +684,13 @@ public class AttachmentDownloadManagerImpl: AttachmentDownloadManager {
                     // can update themselves later.
                     Logger.error("Failed to update thumbnails: \(error)")
                 }
+
+                // Don't block finishing on this either; whatever isn't ready
+                // in time is generated when it's displayed, as before.
+                let attachmentThumbnailService = self.attachmentThumbnailService
+                Task(priority: .utility) {
+                    await attachmentThumbnailService.pregenerateThumbnails(for: attachmentStream)
+                }
             }
 
             await self.didFinishDownloading(record)
@@ -1152,6 +1181,8 @@ public class AttachmentDownloadManagerImpl: AttachmentDownloadManager {
             self.signalService = signalService
         }
 
+        private let rangedDownloader = AttachmentRangedDownloader()
+
         private let maxConcurrentDownloads = 4
         private var concurrentDownloads = 0
         private var queue = [CheckedContinuation<Void, Error>]()
@@ -1172,14 +1203,18 @@ public class AttachmentDownloadManagerImpl: AttachmentDownloadManager {
                 runNextQueuedDownloadIfPossible()
             }
             try Task.checkCancellation()
-            return try await performDownloadAttempt(
+            return try await performDownload(
                 downloadState: downloadState,
-                maxDownloadSizeBytes: maxDownloadSizeBytes,
-                resumeData: nil,
-                attemptCount: 0
+                maxDownloadSizeBytes: maxDownloadSizeBytes
             )
         }
 
+        nonisolated func prewarmConnections(cdnNumbers: Set<UInt32>) {
+            cdnNumbers.forEach {
+                signalService.prewarmConnectionForCdn(cdnNumber: $0)
+            }
+        }
+
         private func runNextQueuedDownloadIfPossible() {
             if queue.isEmpty || concurrentDownloads >= maxConcurrentDownloads { return }
 
@@ -1188,11 +1223,9 @@ public class AttachmentDownloadManagerImpl: AttachmentDownloadManager {
             continuation.resume()
         }
 
-        private nonisolated func performDownloadAttempt(
+        private nonisolated func performDownload(
             downloadState: DownloadState,
-            maxDownloadSizeBytes: UInt,
-            resumeData: Data?,
-            attemptCount: UInt
+            maxDownloadSizeBytes: UInt
         ) async throws -> URL {
             guard downloadState.isExpired().negated else {
                 throw AttachmentDownloads.Error.expiredCredentials
@@ -1214,70 +1247,24 @@ public class AttachmentDownloadManagerImpl: AttachmentDownloadManager {
                 attachmentId = id
             }
 
-            let progress = { (task: URLSessionTask, progress: Progress) in
-                self.handleDownloadProgress(
-                    downloadState: downloadState,
-                    task: task,
-                    progress: progress,
-                    attachmentId: attachmentId
-                )
-            }
-
             do {
-                let downloadResponse: OWSUrlDownloadResponse
-                if let resumeData = resumeData {
-                    let request = try urlSession.endpoint.buildRequest(urlPath, method: .get, headers: headers)
-                    guard let requestUrl = request.url else {
-                        throw OWSAssertionError("Request missing url.")
+                return try await rangedDownloader.download(
+                    urlSession: urlSession,
+                    urlPath: urlPath,
+                    headers: headers,
+                    maxDownloadSizeBytes: maxDownloadSizeBytes,
+                    progress: { task, progress in
+                        self.handleDownloadProgress(
+                            downloadState: downloadState,
+                            task: task,
+                            progress: progress,
+                            attachmentId: attachmentId
+                        )
                     }
-                    downloadResponse = try await urlSession.downloadTaskPromise(
-                        requestUrl: requestUrl,
-                        resumeData: resumeData,
-                        progress: progress
-                    ).awaitable()
-                } else {
-                    downloadResponse = try await urlSession.downloadTaskPromise(
-                        urlPath,
-                        method: .get,
-                        headers: headers,
-                        progress: progress
-                    ).awaitable()
-                }
-                let downloadUrl = downloadResponse.downloadUrl
-                guard let fileSize = OWSFileSystem.fileSize(of: downloadUrl) else {
-                    throw OWSAssertionError("Could not determine attachment file size.")
-                }
-                guard fileSize.int64Value <= maxDownloadSizeBytes else {
-                    throw OWSGenericError("Attachment download length exceeds max size.")
-                }
-                let tmpFile = OWSFileSystem.temporaryFileUrl()
-                try OWSFileSystem.copyFile(from: downloadUrl, to: tmpFile)
-                return tmpFile
+                )
             } catch let error {
                 Logger.warn("Error: \(error)")
-
-                let maxAttemptCount = 16
-                guard
-                    error.isNetworkFailureOrTimeout,
-                    attemptCount < maxAttemptCount
-                else {
-                    throw error
-                }
-
-                // Wait briefly before retrying.
-                try await Task.sleep(nanoseconds: 250 * NSEC_PER_MSEC)
-
-                let newResumeData = (error as NSError)
-                    .userInfo[NSURLSessionDownloadTaskResumeData]
-                    .map { $0 as? Data }
-                    .map(\.?.nilIfEmpty)
-                    ?? nil
-                return try await self.performDownloadAttempt(
-                    downloadState: downloadState,
-                    maxDownloadSizeBytes: maxDownloadSizeBytes,
-                    resumeData: newResumeData,
-                    attemptCount: attemptCount + 1
-                )
+                throw error
             }
         }
 
@@ -1550,7 +1537,7 @@ public class AttachmentDownloadManagerImpl: AttachmentDownloadManager {
                 }
 
                 do {
-                    guard self.orphanedAttachmentStore.orphanAttachmentExists(with: pendingAttachment.orphanRecordId, tx: tx) else {
+                    guard self.pendingAttachmentFilesExist(pendingAttachment, tx: tx) else {
                         throw OWSAssertionError("Attachment file deleted before creation")
                     }
 
@@ -1570,7 +1557,9 @@ public class AttachmentDownloadManagerImpl: AttachmentDownloadManager {
                         tx: tx
                     )
                     // Make sure to clear out the pending attachment from the orphan table so it isn't deleted!
-                    try self.orphanedAttachmentCleaner.releasePendingAttachment(withId: pendingAttachment.orphanRecordId, tx: tx)
+                    if let orphanRecordId = pendingAttachment.orphanRecordId {
+                        try self.orphanedAttachmentCleaner.releasePendingAttachment(withId: orphanRecordId, tx: tx)
+                    }
 
                     let attachment = self.attachmentStore.fetch(id: attachmentId, tx: tx)
                     let result: DownloadResult
@@ -1685,7 +1674,7 @@ public class AttachmentDownloadManagerImpl: AttachmentDownloadManager {
 
                 let newAttachment: AttachmentStream
                 do {
-                    guard self.orphanedAttachmentStore.orphanAttachmentExists(with: pendingAttachment.orphanRecordId, tx: tx) else {
+                    guard self.pendingAttachmentFilesExist(pendingAttachment, tx: tx) else {
                         throw OWSAssertionError("Attachment file deleted before creation")
                     }
 
@@ -1724,7 +1713,9 @@ public class AttachmentDownloadManagerImpl: AttachmentDownloadManager {
                     )
 
                     // Make sure to clear out the pending attachment from the orphan table so it isn't deleted!
-                    try self.orphanedAttachmentCleaner.releasePendingAttachment(withId: pendingAttachment.orphanRecordId, tx: tx)
+                    if let orphanRecordId = pendingAttachment.orphanRecordId {
+                        try self.orphanedAttachmentCleaner.releasePendingAttachment(withId: orphanRecordId, tx: tx)
+                    }
 
                     guard let attachment = self.attachmentStore.fetchFirst(
                         owner: referenceParams.owner.id,
@@ -1825,7 +1816,7 @@ public class AttachmentDownloadManagerImpl: AttachmentDownloadManager {
 
                 let thumbnailAttachmentId: Attachment.IDType
                 do {
-                    guard self.orphanedAttachmentStore.orphanAttachmentExists(with: pendingThumbnailAttachment.orphanRecordId, tx: tx) else {
+                    guard self.pendingAttachmentFilesExist(pendingThumbnailAttachment, tx: tx) else {
                         throw OWSAssertionError("Attachment file deleted before creation")
                     }
 
@@ -1854,7 +1845,8 @@ public class AttachmentDownloadManagerImpl: AttachmentDownloadManager {
                             digestSHA256Ciphertext: pendingThumbnailAttachment.digestSHA256Ciphertext,
                             localRelativeFilePath: pendingThumbnailAttachment.localRelativeFilePath
                         ),
-                        mediaName: Attachment.mediaName(digestSHA256Ciphertext: pendingThumbnailAttachment.digestSHA256Ciphertext)
+                        mediaName: Attachment.mediaName(digestSHA256Ciphertext: pendingThumbnailAttachment.digestSHA256Ciphertext),
+                        originalAttachmentIdForQuotedReply: downloadedAttachment.attachment.id
                     )
 
                     try self.attachmentStore.insert(
@@ -1864,7 +1856,9 @@ public class AttachmentDownloadManagerImpl: AttachmentDownloadManager {
                     )
 
                     // Make sure to clear out the pending attachment from the orphan table so it isn't deleted!
-                    try self.orphanedAttachmentCleaner.releasePendingAttachment(withId: pendingThumbnailAttachment.orphanRecordId, tx: tx)
+                    if let orphanRecordId = pendingThumbnailAttachment.orphanRecordId {
+                        try self.orphanedAttachmentCleaner.releasePendingAttachment(withId: orphanRecordId, tx: tx)
+                    }
 
                     guard let attachment = self.attachmentStore.fetchFirst(
                         owner: referenceParams.owner.id,
@@ -1913,6 +1907,18 @@ public class AttachmentDownloadManagerImpl: AttachmentDownloadManager {
             }
         }
 
+        private func pendingAttachmentFilesExist(_ pendingAttachment: PendingAttachment, tx: DBReadTransaction) -> Bool {
+            guard let orphanRecordId = pendingAttachment.orphanRecordId else {
+                // The pending attachment shares the files of an existing attachment
+                // with the same contents; they're only there as long as it is.
+                return attachmentStore.fetchAttachment(
+                    sha256ContentHash: pendingAttachment.sha256ContentHash,
+                    tx: tx
+                )?.streamInfo?.localRelativeFilePath == pendingAttachment.localRelativeFilePath
+            }
+            return orphanedAttachmentStore.orphanAttachmentExists(with: orphanRecordId, tx: tx)
+        }
+
         func touchAllOwners(attachmentId: Attachment.IDType, tx: DBWriteTransaction) {
             try? self.attachmentStore.enumerateAllReferences(
                 toAttachmentId: attachmentId,
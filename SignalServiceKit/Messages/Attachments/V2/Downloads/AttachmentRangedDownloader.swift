@@ -0,0 +1,497 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import CryptoKit
+import Foundation
+
+/// Downloads a CDN object as concurrent HTTP range requests ("chunks").
+///
+/// The first chunk's `Content-Range` gives the object's length; the file is
+/// preallocated to that length and each chunk is written at its offset.
+/// Which chunks have finished is persisted next to the partial file, so a
+/// download that's interrupted (by a network failure, or by the app being
+/// killed) resumes with the chunks it's missing rather than starting over.
+///
+/// If the CDN ignores the range and sends the whole object, that's used as
+/// is, so downloads work as before against servers without range support.
+final class AttachmentRangedDownloader {
+
+    struct Configuration {
+        /// The size of each range request. Objects no larger than this are
+        /// downloaded with a single request.
+        let chunkSize: UInt64
+        /// How many of a single download's chunks may be in flight at once.
+        let maxConcurrentChunksPerDownload: Int
+        /// How many times a chunk is attempted before a network failure fails
+        /// the download. The chunks that did finish are kept for next time.
+        let maxChunkAttemptCount: Int
+
+        static let `default` = Configuration(
+            chunkSize: 2 * 1024 * 1024,
+            maxConcurrentChunksPerDownload: 4,
+            maxChunkAttemptCount: 16
+        )
+    }
+
+    enum RangedDownloadError: Error {
+        /// The object changed (or the server stopped honoring ranges) after
+        /// some of its chunks were downloaded.
+        case objectChanged
+    }
+
+    /// Shared by all downloads, so that many concurrent downloads don't
+    /// open more connections than a link can make use of.
+    private static let chunkLimiter = ChunkLimiter(maxConcurrentChunks: 8)
+
+    /// Partial downloads that haven't been touched in this long are deleted.
+    private static let maxPartialDownloadAge: TimeInterval = 7 * kDayInterval
+
+    private let configuration: Configuration
+    private let partialDownloadsDirectory: URL
+
+    init(
+        configuration: Configuration = .default,
+        partialDownloadsDirectory: URL = URL(fileURLWithPath: OWSFileSystem.cachesDirectoryPath())
+            .appendingPathComponent("PartialAttachmentDownloads", isDirectory: true)
+    ) {
+        self.configuration = configuration
+        self.partialDownloadsDirectory = partialDownloadsDirectory
+    }
+
+    // MARK: -
+
+    /// Downloads `urlPath` relative to `urlSession`'s endpoint.
+    ///
+    /// - Returns: A temporary file holding the downloaded object, which the
+    ///   caller owns.
+    func download(
+        urlSession: OWSURLSessionProtocol,
+        urlPath: String,
+        headers: [String: String],
+        maxDownloadSizeBytes: UInt,
+        progress: @escaping (URLSessionTask, Progress) -> Void
+    ) async throws -> URL {
+        deleteStalePartialDownloadsIfNeeded()
+
+        let partialDownload = PartialDownload(
+            directory: partialDownloadsDirectory,
+            key: Self.partialDownloadKey(baseUrl: urlSession.endpoint.baseUrl, urlPath: urlPath)
+        )
+        let context = DownloadContext(
+            urlSession: urlSession,
+            urlPath: urlPath,
+            headers: headers,
+            maxDownloadSizeBytes: UInt64(maxDownloadSizeBytes),
+            progress: progress
+        )
+        do {
+            return try await download(context: context, partialDownload: partialDownload)
+        } catch RangedDownloadError.objectChanged {
+            Logger.warn("Object changed during ranged download; restarting.")
+            partialDownload.delete()
+            return try await download(context: context, partialDownload: partialDownload)
+        } catch {
+            // Keep what we have if we might be able to finish it later.
+            if !error.isNetworkFailureOrTimeout {
+                partialDownload.delete()
+            }
+            throw error
+        }
+    }
+
+    private struct DownloadContext {
+        let urlSession: OWSURLSessionProtocol
+        let urlPath: String
+        let headers: [String: String]
+        let maxDownloadSizeBytes: UInt64
+        let progress: (URLSessionTask, Progress) -> Void
+    }
+
+    private func download(context: DownloadContext, partialDownload: PartialDownload) async throws -> URL {
+        var state: PartialDownloadState
+        if let persistedState = partialDownload.loadState(chunkSize: configuration.chunkSize) {
+            state = persistedState
+            Logger.info("Resuming download with \(state.completedChunkIndexes.count) of \(state.chunkCount) chunks")
+        } else {
+            partialDownload.delete()
+            let firstChunkRange = 0..<configuration.chunkSize
+            let response = try await fetchChunk(
+                range: firstChunkRange,
+                entityTag: nil,
+                context: context,
+                progress: { task, chunkProgress in
+                    // Until the first response arrives we don't know how long
+                    // the object is; then its Content-Range says.
+                    guard
+                        let contentRange = (task.response as? HTTPURLResponse)?.value(forHTTPHeaderField: "Content-Range"),
+                        let (_, totalLength) = Self.parseContentRange(contentRange)
+                    else {
+                        context.progress(task, chunkProgress)
+                        return
+                    }
+                    let progress = Progress(parent: nil, userInfo: nil)
+                    progress.totalUnitCount = Int64(totalLength)
+                    progress.completedUnitCount = chunkProgress.completedUnitCount
+                    context.progress(task, progress)
+                }
+            )
+            switch response.statusCode {
+            case 200:
+                // The server ignored the range and sent the whole object.
+                return try Self.takeDownloadedFile(response.downloadUrl, maxDownloadSizeBytes: context.maxDownloadSizeBytes)
+            case 206:
+                break
+            default:
+                throw OWSAssertionError("Unexpected status code: \(response.statusCode)")
+            }
+            guard
+                let contentRange = response.httpUrlResponse.value(forHTTPHeaderField: "Content-Range"),
+                let (range, totalLength) = Self.parseContentRange(contentRange),
+                range.lowerBound == 0
+            else {
+                throw OWSAssertionError("Invalid Content-Range.")
+            }
+            guard totalLength <= context.maxDownloadSizeBytes else {
+                throw OWSGenericError("Attachment download length exceeds max size.")
+            }
+            state = PartialDownloadState(
+                totalLength: totalLength,
+                chunkSize: configuration.chunkSize,
+                entityTag: response.httpUrlResponse.value(forHTTPHeaderField: "ETag"),
+                completedChunkIndexes: []
+            )
+            try partialDownload.preallocate(length: totalLength)
+            try partialDownload.write(chunkAt: response.downloadUrl, offset: 0, expectedLength: state.range(chunkIndex: 0).count)
+            state.completedChunkIndexes.insert(0)
+            try partialDownload.saveState(state)
+        }
+
+        let remainingChunkIndexes = (0..<state.chunkCount).filter { !state.completedChunkIndexes.contains($0) }
+        let progressTracker = ProgressTracker(
+            totalLength: state.totalLength,
+            completedLength: state.completedChunkIndexes.reduce(0) { $0 + UInt64(state.range(chunkIndex: $1).count) },
+            progress: context.progress
+        )
+
+        try await withThrowingTaskGroup(of: Int.self) { taskGroup in
+            var chunkIndexIterator = remainingChunkIndexes.makeIterator()
+            func addNextChunk() {
+                guard let chunkIndex = chunkIndexIterator.next() else {
+                    return
+                }
+                let range = state.range(chunkIndex: chunkIndex)
+                let entityTag = state.entityTag
+                let totalLength = state.totalLength
+                taskGroup.addTask {
+                    try Task.checkCancellation()
+                    let response = try await self.fetchChunk(
+                        range: range,
+                        entityTag: entityTag,
+                        context: context,
+                        progress: { task, chunkProgress in
+                            progressTracker.update(chunkIndex: chunkIndex, completedLength: chunkProgress.completedUnitCount, task: task)
+                        }
+                    )
+                    guard
+                        response.statusCode == 206,
+                        let contentRange = response.httpUrlResponse.value(forHTTPHeaderField: "Content-Range"),
+                        let (responseRange, responseTotalLength) = Self.parseContentRange(contentRange),
+                        responseRange == range.lowerBound...(range.upperBound - 1),
+                        responseTotalLength == totalLength
+                    else {
+                        try? OWSFileSystem.deleteFileIfExists(url: response.downloadUrl)
+                        throw RangedDownloadError.objectChanged
+                    }
+                    try partialDownload.write(chunkAt: response.downloadUrl, offset: range.lowerBound, expectedLength: range.count)
+                    return chunkIndex
+                }
+            }
+
+            for _ in 0..<configuration.maxConcurrentChunksPerDownload {
+                addNextChunk()
+            }
+            while let chunkIndex = try await taskGroup.next() {
+                // Chunks are only marked complete once their bytes are on disk.
+                state.completedChunkIndexes.insert(chunkIndex)
+                try partialDownload.saveState(state)
+                progressTracker.complete(chunkIndex: chunkIndex, length: UInt64(state.range(chunkIndex: chunkIndex).count))
+                addNextChunk()
+            }
+        }
+
+        return try partialDownload.finish()
+    }
+
+    private func fetchChunk(
+        range: Range<UInt64>,
+        entityTag: String?,
+        context: DownloadContext,
+        progress: ((URLSessionTask, Progress) -> Void)? = nil,
+        attemptCount: Int = 0
+    ) async throws -> OWSUrlDownloadResponse {
+        var headers = context.headers
+        headers["Range"] = "bytes=\(range.lowerBound)-\(range.upperBound - 1)"
+        if let entityTag {
+            // If the object changed, the server sends all of it with a 200.
+            headers["If-Range"] = entityTag
+        }
+        let request = try context.urlSession.endpoint.buildRequest(context.urlPath, method: .get, headers: headers)
+
+        await Self.chunkLimiter.acquire()
+        do {
+            let response = try await context.urlSession.downloadTaskPromise(request: request, progress: progress).awaitable()
+            await Self.chunkLimiter.release()
+            return response
+        } catch {
+            await Self.chunkLimiter.release()
+
+            guard error.isNetworkFailureOrTimeout, attemptCount + 1 < configuration.maxChunkAttemptCount else {
+                throw error
+            }
+            Logger.warn("Retrying chunk after error: \(error)")
+            // Wait briefly before retrying.
+            try await Task.sleep(nanoseconds: 250 * NSEC_PER_MSEC)
+            return try await fetchChunk(
+                range: range,
+                entityTag: entityTag,
+                context: context,
+                progress: progress,
+                attemptCount: attemptCount + 1
+            )
+        }
+    }
+
+    private static func takeDownloadedFile(_ downloadUrl: URL, maxDownloadSizeBytes: UInt64) throws -> URL {
+        guard let fileSize = OWSFileSystem.fileSize(of: downloadUrl) else {
+            throw OWSAssertionError("Could not determine attachment file size.")
+        }
+        guard fileSize.uint64Value <= maxDownloadSizeBytes else {
+            throw OWSGenericError("Attachment download length exceeds max size.")
+        }
+        let tmpFile = OWSFileSystem.temporaryFileUrl()
+        try OWSFileSystem.moveFile(from: downloadUrl, to: tmpFile)
+        return tmpFile
+    }
+
+    // MARK: - Parsing
+
+    /// Parses a `Content-Range` header value, e.g. "bytes 0-1023/4096".
+    ///
+    /// - Returns: nil if the value is malformed or the total length is
+    ///   unknown ("*").
+    static func parseContentRange(_ value: String) -> (range: ClosedRange<UInt64>, totalLength: UInt64)? {
+        let value = value.trimmingCharacters(in: .whitespaces)
+        guard value.hasPrefix("bytes ") else {
+            return nil
+        }
+        let rangeAndLength = value.dropFirst("bytes ".count).split(separator: "/")
+        guard rangeAndLength.count == 2, let totalLength = UInt64(rangeAndLength[1]) else {
+            return nil
+        }
+        let bounds = rangeAndLength[0].split(separator: "-")
+        guard
+            bounds.count == 2,
+            let lowerBound = UInt64(bounds[0]),
+            let upperBound = UInt64(bounds[1]),
+            lowerBound <= upperBound,
+            upperBound < totalLength
+        else {
+            return nil
+        }
+        return (lowerBound...upperBound, totalLength)
+    }
+
+    static func partialDownloadKey(baseUrl: URL?, urlPath: String) -> String {
+        let identifier = "\(baseUrl?.absoluteString ?? "")|\(urlPath)"
+        return Data(SHA256.hash(data: Data(identifier.utf8))).hexadecimalString
+    }
+
+    // MARK: - Cleanup
+
+    private static let didDeleteStalePartialDownloads = AtomicBool(false, lock: .sharedGlobal)
+
+    private func deleteStalePartialDownloadsIfNeeded() {
+        guard Self.didDeleteStalePartialDownloads.tryToSetFlag() else {
+            return
+        }
+        let fileUrls = (try? FileManager.default.contentsOfDirectory(
+            at: partialDownloadsDirectory,
+            includingPropertiesForKeys: [.contentModificationDateKey]
+        )) ?? []
+        for fileUrl in fileUrls {
+            guard
+                let modificationDate = try? fileUrl.resourceValues(forKeys: [.contentModificationDateKey]).contentModificationDate,
+                -modificationDate.timeIntervalSinceNow > Self.maxPartialDownloadAge
+            else {
+                continue
+            }
+            try? OWSFileSystem.deleteFileIfExists(url: fileUrl)
+        }
+    }
+}
+
+// MARK: -
+
+/// Which chunks of a partially downloaded object are on disk.
+struct PartialDownloadState: Codable, Equatable {
+    var totalLength: UInt64
+    var chunkSize: UInt64
+    /// Sent with later chunk requests so that we notice if the object changes.
+    var entityTag: String?
+    var completedChunkIndexes: Set<Int>
+
+    var chunkCount: Int {
+        return Int((totalLength + chunkSize - 1) / chunkSize)
+    }
+
+    func range(chunkIndex: Int) -> Range<UInt64> {
+        let lowerBound = UInt64(chunkIndex) * chunkSize
+        return lowerBound..<min(lowerBound + chunkSize, totalLength)
+    }
+}
+
+// MARK: -
+
+/// The on-disk files for one download: the preallocated data file, and the
+/// persisted `PartialDownloadState` describing it.
+private struct PartialDownload {
+    let dataUrl: URL
+    let stateUrl: URL
+
+    init(directory: URL, key: String) {
+        self.dataUrl = directory.appendingPathComponent(key)
+        self.stateUrl = directory.appendingPathComponent(key).appendingPathExtension("json")
+    }
+
+    /// Returns nil unless there is a partial download to resume.
+    func loadState(chunkSize: UInt64) -> PartialDownloadState? {
+        guard
+            let stateData = try? Data(contentsOf: stateUrl),
+            let state = try? JSONDecoder().decode(PartialDownloadState.self, from: stateData),
+            state.chunkSize == chunkSize,
+            OWSFileSystem.fileSize(of: dataUrl)?.uint64Value == state.totalLength
+        else {
+            return nil
+        }
+        return state
+    }
+
+    func saveState(_ state: PartialDownloadState) throws {
+        try JSONEncoder().encode(state).write(to: stateUrl, options: .atomic)
+    }
+
+    func preallocate(length: UInt64) throws {
+        guard OWSFileSystem.ensureDirectoryExists(dataUrl.deletingLastPathComponent().path) else {
+            throw OWSAssertionError("Couldn't create partial downloads directory.")
+        }
+        guard FileManager.default.createFile(atPath: dataUrl.path, contents: nil) else {
+            throw OWSAssertionError("Couldn't create partial download file.")
+        }
+        let fileHandle = try FileHandle(forWritingTo: dataUrl)
+        defer { try? fileHandle.close() }
+        try fileHandle.truncate(atOffset: length)
+    }
+
+    /// Copies a downloaded chunk into place and deletes it. Returns once the
+    /// bytes are on disk, so the chunk can be marked complete.
+    func write(chunkAt chunkUrl: URL, offset: UInt64, expectedLength: Int) throws {
+        defer { try? OWSFileSystem.deleteFileIfExists(url: chunkUrl) }
+        let chunkData = try Data(contentsOf: chunkUrl)
+        guard chunkData.count == expectedLength else {
+            throw OWSAssertionError("Chunk has \(chunkData.count) bytes; expected \(expectedLength).")
+        }
+        // Each chunk uses its own handle, so concurrent writes don't share
+        // a file offset.
+        let fileHandle = try FileHandle(forWritingTo: dataUrl)
+        defer { try? fileHandle.close() }
+        try fileHandle.seek(toOffset: offset)
+        try fileHandle.write(contentsOf: chunkData)
+        try fileHandle.synchronize()
+    }
+
+    /// Moves the completed file to a temporary file and forgets the state.
+    func finish() throws -> URL {
+        let tmpFile = OWSFileSystem.temporaryFileUrl()
+        try OWSFileSystem.moveFile(from: dataUrl, to: tmpFile)
+        try? OWSFileSystem.deleteFileIfExists(url: stateUrl)
+        return tmpFile
+    }
+
+    func delete() {
+        try? OWSFileSystem.deleteFileIfExists(url: dataUrl)
+        try? OWSFileSystem.deleteFileIfExists(url: stateUrl)
+    }
+}
+
+// MARK: -
+
+/// Combines the progress of a download's in-flight chunks.
+private final class ProgressTracker {
+    private struct State {
+        var completedLength: UInt64
+        var inFlightLengths = [Int: Int64]()
+    }
+
+    private let totalLength: UInt64
+    private let state: AtomicValue<State>
+    private let progress: (URLSessionTask, Progress) -> Void
+
+    init(totalLength: UInt64, completedLength: UInt64, progress: @escaping (URLSessionTask, Progress) -> Void) {
+        self.totalLength = totalLength
+        self.state = AtomicValue(State(completedLength: completedLength), lock: UnfairLock())
+        self.progress = progress
+    }
+
+    func update(chunkIndex: Int, completedLength: Int64, task: URLSessionTask) {
+        let downloadedLength = state.update { state in
+            state.inFlightLengths[chunkIndex] = completedLength
+            return Int64(state.completedLength) + state.inFlightLengths.values.reduce(0, +)
+        }
+        let progress = Progress(parent: nil, userInfo: nil)
+        progress.totalUnitCount = Int64(totalLength)
+        progress.completedUnitCount = downloadedLength
+        self.progress(task, progress)
+    }
+
+    func complete(chunkIndex: Int, length: UInt64) {
+        state.update { state in
+            state.inFlightLengths[chunkIndex] = nil
+            state.completedLength += length
+        }
+    }
+}
+
+// MARK: -
+
+/// Limits how many chunk requests are in flight across all downloads.
+private actor ChunkLimiter {
+    private let maxConcurrentChunks: Int
+    private var concurrentChunks = 0
+    private var queue = [CheckedContinuation<Void, Never>]()
+
+    init(maxConcurrentChunks: Int) {
+        self.maxConcurrentChunks = maxConcurrentChunks
+    }
+
+    func acquire() async {
+        await withCheckedContinuation { continuation in
+            queue.append(continuation)
+            runNextIfPossible()
+        }
+    }
+
+    func release() {
+        concurrentChunks -= 1
+        runNextIfPossible()
+    }
+
+    private func runNextIfPossible() {
+        if queue.isEmpty || concurrentChunks >= maxConcurrentChunks { return }
+
+        concurrentChunks += 1
+        let continuation = queue.removeFirst()
+        continuation.resume()
+    }
+}
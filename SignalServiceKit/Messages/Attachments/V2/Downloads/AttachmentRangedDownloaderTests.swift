@@ -0,0 +1,53 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+import XCTest
+
+@testable import SignalServiceKit
+
+class AttachmentRangedDownloaderTests: XCTestCase {
+
+    func testParseContentRange() {
+        let parsed = AttachmentRangedDownloader.parseContentRange("bytes 0-1023/4096")
+        XCTAssertEqual(parsed?.range, 0...1023)
+        XCTAssertEqual(parsed?.totalLength, 4096)
+
+        let last = AttachmentRangedDownloader.parseContentRange("bytes 4000-4095/4096")
+        XCTAssertEqual(last?.range, 4000...4095)
+
+        XCTAssertNil(AttachmentRangedDownloader.parseContentRange("bytes 0-1023/*"))
+        XCTAssertNil(AttachmentRangedDownloader.parseContentRange("bytes */4096"))
+        XCTAssertNil(AttachmentRangedDownloader.parseContentRange("bytes 10-5/4096"))
+        XCTAssertNil(AttachmentRangedDownloader.parseContentRange("bytes 0-4096/4096"))
+        XCTAssertNil(AttachmentRangedDownloader.parseContentRange("items 0-1/2"))
+    }
+
+    func testChunkRanges() {
+        let state = PartialDownloadState(totalLength: 10, chunkSize: 4, entityTag: nil, completedChunkIndexes: [])
+        XCTAssertEqual(state.chunkCount, 3)
+        XCTAssertEqual(state.range(chunkIndex: 0), 0..<4)
+        XCTAssertEqual(state.range(chunkIndex: 1), 4..<8)
+        XCTAssertEqual(state.range(chunkIndex: 2), 8..<10)
+
+        let exact = PartialDownloadState(totalLength: 8, chunkSize: 4, entityTag: nil, completedChunkIndexes: [])
+        XCTAssertEqual(exact.chunkCount, 2)
+        XCTAssertEqual(exact.range(chunkIndex: 1), 4..<8)
+    }
+
+    func testStateRoundTrips() throws {
+        let state = PartialDownloadState(totalLength: 10, chunkSize: 4, entityTag: "\"abc\"", completedChunkIndexes: [0, 2])
+        let decoded = try JSONDecoder().decode(PartialDownloadState.self, from: JSONEncoder().encode(state))
+        XCTAssertEqual(decoded, state)
+    }
+
+    func testPartialDownloadKey() {
+        let baseUrl = URL(string: "https://cdn.example.com")!
+        let key = AttachmentRangedDownloader.partialDownloadKey(baseUrl: baseUrl, urlPath: "attachments/abc")
+        XCTAssertEqual(key, AttachmentRangedDownloader.partialDownloadKey(baseUrl: baseUrl, urlPath: "attachments/abc"))
+        XCTAssertNotEqual(key, AttachmentRangedDownloader.partialDownloadKey(baseUrl: baseUrl, urlPath: "attachments/abd"))
+        XCTAssertNotEqual(key, AttachmentRangedDownloader.partialDownloadKey(baseUrl: nil, urlPath: "attachments/abc"))
+    }
+}
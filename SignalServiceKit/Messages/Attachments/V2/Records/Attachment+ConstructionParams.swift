@@ -70,12 +70,16 @@ extension Attachment {
             )
         }
 
+        /// - Parameter originalAttachmentIdForQuotedReply: If this is a quoted
+        ///   reply thumbnail, the attachment it was made from, so later quotes
+        ///   of that attachment can share it.
         public static func fromStream(
             blurHash: String?,
             mimeType: String,
             encryptionKey: Data,
             streamInfo: StreamInfo,
-            mediaName: String
+            mediaName: String,
+            originalAttachmentIdForQuotedReply: Attachment.IDType? = nil
         ) -> ConstructionParams {
             return .init(
                 blurHash: blurHash,
@@ -87,7 +91,7 @@ extension Attachment {
                 mediaTierInfo: nil,
                 thumbnailMediaTierInfo: nil,
                 localRelativeFilePathThumbnail: nil,
-                originalAttachmentIdForQuotedReply: nil
+                originalAttachmentIdForQuotedReply: originalAttachmentIdForQuotedReply
             )
         }
 
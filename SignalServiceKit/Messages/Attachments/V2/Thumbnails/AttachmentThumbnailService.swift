@@ -16,4 +16,9 @@ public protocol AttachmentThumbnailService {
         for attachmentStream: AttachmentStream,
         quality: AttachmentThumbnailQuality
     ) -> UIImage?
+
+    /// Generates and caches every thumbnail quality the attachment needs,
+    /// so that they're ready before it's first displayed (e.g. right after
+    /// it's downloaded).
+    func pregenerateThumbnails(for attachmentStream: AttachmentStream) async
 }
@@ -4,12 +4,16 @@
 //
 
 import Foundation
+import ImageIO
 
 public class AttachmentThumbnailServiceImpl: AttachmentThumbnailService {
 
     public init() {}
 
     private var taskQueue = SerialTaskQueue()
+    /// Separate from `taskQueue`, so thumbnails that are about to be shown
+    /// don't wait behind pregeneration.
+    private let pregenerationTaskQueue = SerialTaskQueue()
 
     public func thumbnailImage(
         for attachmentStream: AttachmentStream,
@@ -45,25 +49,7 @@ public class AttachmentThumbnailServiceImpl: AttachmentThumbnailService {
             return cached
         }
 
-        let thumbnailImage: UIImage?
-        if attachmentStream.mimeType == MimeType.imageWebp.rawValue {
-            thumbnailImage = try? attachmentStream
-                .decryptedRawData()
-                .stillForWebpData()?
-                .resized(maxDimensionPoints: quality.thumbnailDimensionPoints())
-        } else {
-            thumbnailImage = try? UIImage
-                .fromEncryptedFile(
-                    at: AttachmentStream.absoluteAttachmentFileURL(
-                        relativeFilePath: attachmentStream.localRelativeFilePath
-                    ),
-                    encryptionKey: attachmentStream.attachment.encryptionKey,
-                    plaintextLength: attachmentStream.unencryptedByteCount,
-                    mimeType: attachmentStream.mimeType
-                )
-                .resized(maxDimensionPoints: quality.thumbnailDimensionPoints())
-        }
-
+        let thumbnailImage = generateThumbnailImages(for: attachmentStream, qualities: [quality])[quality]
         guard let thumbnailImage else {
             owsFailDebug("Unable to generate thumbnail")
             return nil
@@ -72,6 +58,142 @@ public class AttachmentThumbnailServiceImpl: AttachmentThumbnailService {
         return thumbnailImage
     }
 
+    public func pregenerateThumbnails(for attachmentStream: AttachmentStream) async {
+        _ = try? await pregenerationTaskQueue.enqueue(operation: {
+            self.pregenerateThumbnailsSync(for: attachmentStream)
+        }).value
+    }
+
+    private func pregenerateThumbnailsSync(for attachmentStream: AttachmentStream) {
+        let pixelSize: CGSize
+        switch attachmentStream.contentType {
+        case .invalid, .file, .audio, .video:
+            // Videos use their still frame, which is already small.
+            return
+        case .image(let size), .animatedImage(let size):
+            pixelSize = size
+        }
+        let pointSize = AttachmentThumbnailQuality.pointSize(pixelSize: pixelSize)
+        let qualities = AttachmentThumbnailQuality.allCases.filter { quality in
+            let targetSize = quality.thumbnailDimensionPoints()
+            guard pointSize.width >= targetSize || pointSize.height >= targetSize else {
+                // The original is shown as-is.
+                return false
+            }
+            let cacheUrl = AttachmentThumbnailQuality.thumbnailCacheFileUrl(for: attachmentStream, at: quality)
+            return !OWSFileSystem.fileOrFolderExists(url: cacheUrl)
+        }
+        for (quality, thumbnailImage) in generateThumbnailImages(for: attachmentStream, qualities: qualities) {
+            cacheThumbnail(thumbnailImage, for: attachmentStream, quality: quality)
+        }
+    }
+
+    /// Generates thumbnails for `qualities` with a single decode.
+    ///
+    /// ImageIO decodes only as much of the image as the largest thumbnail
+    /// needs (JPEG and HEIC decode at a reduced scale), rather than the
+    /// full-size image, and the smaller qualities are scaled down from that.
+    /// Qualities that fit within the image's embedded (EXIF) thumbnail are
+    /// made from it instead, without decoding the image at all.
+    private func generateThumbnailImages(
+        for attachmentStream: AttachmentStream,
+        qualities: [AttachmentThumbnailQuality]
+    ) -> [AttachmentThumbnailQuality: UIImage] {
+        guard !qualities.isEmpty else {
+            return [:]
+        }
+
+        if attachmentStream.mimeType == MimeType.imageWebp.rawValue {
+            guard let stillImage = try? attachmentStream.decryptedRawData().stillForWebpData() else {
+                return [:]
+            }
+            var result = [AttachmentThumbnailQuality: UIImage]()
+            for quality in qualities {
+                result[quality] = stillImage.resized(maxDimensionPoints: quality.thumbnailDimensionPoints())
+            }
+            return result
+        }
+
+        guard
+            let imageData = try? attachmentStream.decryptedRawData(),
+            let imageSource = CGImageSourceCreateWithData(imageData as CFData, [kCGImageSourceShouldCache: false] as CFDictionary)
+        else {
+            return [:]
+        }
+
+        let scale = UIScreen.main.scale
+        func maxPixelSize(_ quality: AttachmentThumbnailQuality) -> CGFloat {
+            return (quality.thumbnailDimensionPoints() * scale).rounded(.down)
+        }
+        func thumbnailImage(from image: CGImage, quality: AttachmentThumbnailQuality) -> UIImage? {
+            let maxPixelSize = maxPixelSize(quality)
+            let uiImage = UIImage(cgImage: image)
+            let resizedImage: UIImage?
+            if CGFloat(max(image.width, image.height)) > maxPixelSize {
+                resizedImage = uiImage.resized(maxDimensionPixels: maxPixelSize)
+            } else {
+                resizedImage = uiImage
+            }
+            return resizedImage?.cgImage.map { UIImage(cgImage: $0, scale: scale, orientation: .up) }
+        }
+
+        var result = [AttachmentThumbnailQuality: UIImage]()
+        var remainingQualities = qualities
+
+        let pixelSize: CGSize?
+        switch attachmentStream.contentType {
+        case .image(let size), .animatedImage(let size):
+            pixelSize = size
+        case .invalid, .file, .audio, .video:
+            pixelSize = nil
+        }
+
+        // Without any of the "create" options, this only returns the
+        // embedded thumbnail, if there is one.
+        if
+            let embeddedThumbnail = CGImageSourceCreateThumbnailAtIndex(imageSource, 0, [
+                kCGImageSourceCreateThumbnailWithTransform: true,
+            ] as CFDictionary),
+            Self.hasSameAspectRatio(embeddedThumbnail, asImageOfPixelSize: pixelSize)
+        {
+            let embeddedMaxPixelSize = CGFloat(max(embeddedThumbnail.width, embeddedThumbnail.height))
+            remainingQualities = remainingQualities.filter { quality in
+                guard maxPixelSize(quality) <= embeddedMaxPixelSize else {
+                    return true
+                }
+                result[quality] = thumbnailImage(from: embeddedThumbnail, quality: quality)
+                return false
+            }
+        }
+
+        guard let largestQuality = remainingQualities.max(by: { maxPixelSize($0) < maxPixelSize($1) }) else {
+            return result
+        }
+        guard
+            let largestThumbnail = CGImageSourceCreateThumbnailAtIndex(imageSource, 0, [
+                kCGImageSourceCreateThumbnailFromImageAlways: true,
+                kCGImageSourceCreateThumbnailWithTransform: true,
+                kCGImageSourceShouldCacheImmediately: true,
+                kCGImageSourceThumbnailMaxPixelSize: maxPixelSize(largestQuality),
+            ] as CFDictionary)
+        else {
+            return result
+        }
+        for quality in remainingQualities {
+            result[quality] = thumbnailImage(from: largestThumbnail, quality: quality)
+        }
+        return result
+    }
+
+    private static func hasSameAspectRatio(_ image: CGImage, asImageOfPixelSize pixelSize: CGSize?) -> Bool {
+        // Embedded thumbnails may be cropped or letterboxed to a fixed shape.
+        guard let pixelSize, pixelSize.width > 0, pixelSize.height > 0, image.width > 0, image.height > 0 else {
+            return false
+        }
+        let aspectRatio = CGFloat(image.width) / CGFloat(image.height)
+        return abs(aspectRatio - pixelSize.width / pixelSize.height) <= 0.02 * aspectRatio
+    }
+
     private enum ThumbnailSpec {
         case cannotGenerate
         case originalFits(UIImage)
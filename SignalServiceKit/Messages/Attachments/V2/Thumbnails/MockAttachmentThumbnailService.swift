@@ -24,6 +24,8 @@ open class MockAttachmentThumbnailService: AttachmentThumbnailService {
     ) -> UIImage? {
         return nil
     }
+
+    open func pregenerateThumbnails(for attachmentStream: AttachmentStream) async {}
 }
 
 #endif
@@ -0,0 +1,113 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+import LibSignalClient
+
+/// Remembers the result of hydrating message bodies with contact names.
+///
+/// The chat list, notifications and the conversation view hydrate the same
+/// bodies over and over, and in mention-heavy groups each of those means
+/// resolving every mentioned member's display name. Bodies are cached by
+/// their text and ranges, so the same body in any interaction (or draft)
+/// shares an entry. Entries are dropped when the name of anyone they mention
+/// might have changed.
+public final class HydratedMessageBodyCache {
+
+    public static let shared = HydratedMessageBodyCache()
+
+    private struct Key: Hashable {
+        let messageBody: MessageBody
+        let isRTL: Bool
+    }
+
+    private let lock = UnfairLock()
+    private let cache = LRUCache<Key, HydratedMessageBody>(maxSize: 256, nseMaxSize: 32)
+    /// Everyone mentioned by a cached body.
+    private var mentionedAcis = Set<Aci>()
+    /// Bumped whenever entries are dropped, so that a hydration that raced
+    /// with a name change doesn't cache the old name.
+    private var generation: UInt64 = 0
+
+    init() {
+        let nameNotifications: [Notification.Name] = [
+            .OWSContactsManagerSignalAccountsDidChange,
+            UserProfileNotifications.localProfileDidChange,
+            UserProfileNotifications.profileWhitelistDidChange,
+        ]
+        for name in nameNotifications {
+            NotificationCenter.default.addObserver(forName: name, object: nil, queue: nil) { [weak self] _ in
+                self?.removeAll()
+            }
+        }
+        NotificationCenter.default.addObserver(
+            forName: UserProfileNotifications.otherUsersProfileDidChange,
+            object: nil,
+            queue: nil
+        ) { [weak self] notification in
+            guard let address = notification.userInfo?[UserProfileNotifications.profileAddressKey] as? SignalServiceAddress else {
+                self?.removeAll()
+                return
+            }
+            // Only ACIs can be mentioned.
+            if let aci = address.aci {
+                self?.removeAll(mentioning: aci)
+            }
+        }
+    }
+
+    /// Equivalent to hydrating `messageBody` with
+    /// `ContactsMentionHydrator.mentionHydrator(transaction:)`.
+    public func hydratedBody(
+        for messageBody: MessageBody,
+        isRTL: Bool = CurrentAppContext().isRTL,
+        tx: DBReadTransaction
+    ) -> HydratedMessageBody {
+        func hydrate() -> HydratedMessageBody {
+            return messageBody.hydrating(
+                mentionHydrator: ContactsMentionHydrator.mentionHydrator(transaction: tx),
+                isRTL: isRTL
+            )
+        }
+        guard messageBody.hasRanges else {
+            // Nothing to resolve; this is just as fast as a lookup.
+            return hydrate()
+        }
+        let key = Key(messageBody: messageBody, isRTL: isRTL)
+        let (cached, startGeneration) = lock.withLock { (cache[key], generation) }
+        if let cached {
+            return cached
+        }
+        let hydrated = hydrate()
+        lock.withLock {
+            guard generation == startGeneration else {
+                return
+            }
+            cache[key] = hydrated
+            mentionedAcis.formUnion(messageBody.ranges.mentions.values)
+        }
+        return hydrated
+    }
+
+    private func removeAll(mentioning aci: Aci) {
+        lock.withLock {
+            guard mentionedAcis.contains(aci) else {
+                return
+            }
+            _removeAll()
+        }
+    }
+
+    private func removeAll() {
+        lock.withLock { _removeAll() }
+    }
+
+    private func _removeAll() {
+        lock.assertOwner()
+        cache.removeAllObjects()
+        mentionedAcis.removeAll()
+        generation += 1
+    }
+}
@@ -0,0 +1,151 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// Keeps track of upcoming disappearing message (and story) expirations in
+/// memory and invokes `handleExpiration` on `queue` shortly after each one.
+///
+/// The upcoming expirations are seeded once from the database (see
+/// `seed(expirationTimestamps:isComplete:)`) and then maintained as messages
+/// start expiring, so we don't have to query for the next expiration after
+/// every deletion pass. The timer runs on `queue` rather than the main run
+/// loop.
+@objc
+public final class DisappearingMessagesExpirationScheduler: NSObject {
+    private let queue: DispatchQueue
+    private let handleExpiration: () -> Void
+
+    // These properties should only be accessed on `queue`.
+    private var upcomingExpirations = MinHeap<UInt64>()
+    private var upcomingExpirationSet = Set<UInt64>()
+    private var hasSeeded = false
+    /// If the seed was truncated, the latest timestamp it included. We don't
+    /// know about expirations in the database after this point.
+    private var truncatedSeedHorizon: UInt64?
+    private var isEnabled = false
+    private var timer: DispatchSourceTimer?
+    private var timerTimestamp: UInt64?
+
+    /// Don't run more often than once per second.
+    private static let minDelayMs: UInt64 = 1000
+
+    /// Bounds how many timestamps we keep in memory. If seeding is truncated,
+    /// we'll reseed when we run out.
+    @objc
+    public static let maxSeedCount = 500
+
+    @objc
+    public init(queue: DispatchQueue, handleExpiration: @escaping () -> Void) {
+        self.queue = queue
+        self.handleExpiration = handleExpiration
+    }
+
+    /// Timers only fire while enabled (e.g. while the main app is active).
+    /// Expirations scheduled while disabled are kept and armed once enabled.
+    @objc
+    public func setIsEnabled(_ isEnabled: Bool) {
+        queue.async {
+            self.isEnabled = isEnabled
+            self.rearmTimer()
+        }
+    }
+
+    @objc
+    public func schedule(expirationTimestamp: UInt64) {
+        queue.async {
+            self.insert(expirationTimestamp)
+            self.rearmTimer()
+        }
+    }
+
+    /// Whether we've run out of known upcoming expirations and must consult
+    /// the database to find more. Must be called on `queue`.
+    @objc
+    public var needsSeed: Bool {
+        assertOnQueue(queue)
+        guard hasSeeded else {
+            return true
+        }
+        guard let truncatedSeedHorizon else {
+            return false
+        }
+        guard let nextExpiration = upcomingExpirations.min else {
+            return true
+        }
+        return nextExpiration > truncatedSeedHorizon
+    }
+
+    /// Provides the upcoming expirations from the database.
+    ///
+    /// - Parameter expirationTimestamps: Upcoming expirations, in ascending
+    /// order.
+    /// - Parameter isComplete: Whether `expirationTimestamps` includes every
+    /// upcoming expiration. If not, `needsSeed` becomes true again once these
+    /// have all passed.
+    @objc
+    public func seed(expirationTimestamps: [NSNumber], isComplete: Bool) {
+        assertOnQueue(queue)
+        for timestamp in expirationTimestamps {
+            insert(timestamp.uint64Value)
+        }
+        hasSeeded = true
+        truncatedSeedHorizon = isComplete ? nil : expirationTimestamps.last?.uint64Value
+        rearmTimer()
+    }
+
+    private func insert(_ timestamp: UInt64) {
+        guard upcomingExpirationSet.insert(timestamp).inserted else {
+            return
+        }
+        upcomingExpirations.insert(timestamp)
+    }
+
+    private func rearmTimer() {
+        assertOnQueue(queue)
+
+        guard isEnabled, let nextExpiration = upcomingExpirations.min else {
+            cancelTimer()
+            return
+        }
+        let now = Date.ows_millisecondTimestamp()
+        let fireTimestamp = max(nextExpiration, now + Self.minDelayMs)
+        if let timerTimestamp, timerTimestamp <= fireTimestamp {
+            // We're already going to fire soon enough.
+            return
+        }
+        cancelTimer()
+
+        let timer = DispatchSource.makeTimerSource(queue: queue)
+        timer.schedule(deadline: .now() + .milliseconds(Int(fireTimestamp - now)), leeway: .milliseconds(100))
+        timer.setEventHandler { [weak self] in
+            self?.timerDidFire()
+        }
+        timer.resume()
+        self.timer = timer
+        self.timerTimestamp = fireTimestamp
+    }
+
+    private func cancelTimer() {
+        timer?.cancel()
+        timer = nil
+        timerTimestamp = nil
+    }
+
+    private func timerDidFire() {
+        assertOnQueue(queue)
+
+        cancelTimer()
+
+        let now = Date.ows_millisecondTimestamp()
+        while let nextExpiration = upcomingExpirations.min, nextExpiration <= now {
+            upcomingExpirations.popMin()
+            upcomingExpirationSet.remove(nextExpiration)
+        }
+        handleExpiration()
+
+        rearmTimer()
+    }
+}
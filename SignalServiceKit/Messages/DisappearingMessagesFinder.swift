@@ -15,4 +15,15 @@ class DisappearingMessagesFinder {
     public func nextExpirationTimestamp(transaction tx: SDSAnyReadTransaction) -> UInt64? {
         return InteractionFinder.nextMessageWithStartedPerConversationExpirationToExpire(transaction: tx)?.expiresAt
     }
+
+    /// - Returns:
+    /// Up to `limit` distinct upcoming expiration timestamps, in ascending order.
+    public func upcomingExpirationTimestamps(limit: Int, transaction tx: SDSAnyReadTransaction) -> [UInt64] {
+        do {
+            return try InteractionFinder.fetchUpcomingExpirationTimestamps(limit: limit, tx: tx)
+        } catch {
+            owsFailDebug("Couldn't fetch upcoming expirations: \(error)")
+            return []
+        }
+    }
 }
@@ -4,16 +4,39 @@
 //
 
 import Foundation
+import GRDB
 import LibSignalClient
 
+/// Holds envelopes and receipts that arrive before the message they refer to,
+/// until that message arrives.
+///
+/// They're kept in the `EarlyMessage` table, one row each, indexed by the
+/// author and timestamp of the message they're waiting for, so checking an
+/// incoming message for early arrivals is a single indexed query. Rows are
+/// capped per message as they're recorded, and expired by age and capped in
+/// total (oldest first) in batches after launch.
 @objc
 public class EarlyMessageManager: NSObject {
     private struct MessageIdentifier: Hashable {
         let timestamp: UInt64
         let author: Aci
 
-        var key: String {
-            return "\(author.serviceIdUppercaseString).\(timestamp)"
+        /// Parses the keys of the legacy key-value stores.
+        init?(legacyKey: String) {
+            let components = legacyKey.split(separator: ".")
+            guard
+                components.count == 2,
+                let author = Aci.parseFrom(aciString: String(components[0])),
+                let timestamp = UInt64(components[1])
+            else {
+                return nil
+            }
+            self.init(timestamp: timestamp, author: author)
+        }
+
+        init(timestamp: UInt64, author: Aci) {
+            self.timestamp = timestamp
+            self.author = author
         }
     }
 
@@ -163,10 +186,33 @@ public class EarlyMessageManager: NSObject {
 
     private static let maxEarlyEnvelopeSize: Int = 1024
     private static let maxQueuedPerMessage: Int = 128
+    /// Across all messages. Beyond this, the earliest recorded are dropped.
+    private static let maxEarlyMessageCount: Int = 5000
+    private static let expiryBatchSize: Int = 500
+
+    // MARK: - Table
+
+    static let tableName = "EarlyMessage"
+    private static let targetAuthorAciColumn = "targetAuthorAci"
+    private static let targetTimestampColumn = "targetTimestamp"
+    private static let kindColumn = "kind"
+    private static let payloadColumn = "payload"
+
+    private enum Kind: Int {
+        case envelope = 0
+        case receipt = 1
+    }
+
+    private static func encode<T: Encodable>(_ value: T) throws -> Data {
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = .sortedKeys
+        return try encoder.encode(value)
+    }
 
-    private var pendingEnvelopeStore = SDSKeyValueStore(collection: "EarlyEnvelopesStore")
-    private var pendingReceiptStore =  SDSKeyValueStore(collection: "EarlyReceiptsStore")
-    private var metadataStore =  SDSKeyValueStore(collection: "EarlyMessageManager.metadata")
+    // Only used to move what's left in them into the table.
+    private let legacyEnvelopeStore = SDSKeyValueStore(collection: "EarlyEnvelopesStore")
+    private let legacyReceiptStore = SDSKeyValueStore(collection: "EarlyReceiptsStore")
+    private let legacyMetadataStore = SDSKeyValueStore(collection: "EarlyMessageManager.metadata")
 
     public override init() {
         super.init()
@@ -203,28 +249,14 @@ public class EarlyMessageManager: NSObject {
 
         Logger.info("Recording early envelope \(OWSMessageDecrypter.description(for: envelope)) for message \(identifier)")
 
-        var envelopes: [EarlyEnvelope]
         do {
-            envelopes = try pendingEnvelopeStore.getCodableValue(forKey: identifier.key, transaction: transaction) ?? []
-        } catch {
-            owsFailDebug("Failed to decode existing early envelopes for message \(identifier) with error \(error)")
-            envelopes = []
-        }
-
-        while envelopes.count >= Self.maxQueuedPerMessage, let droppedEarlyEnvelope = envelopes.first {
-            envelopes.remove(at: 0)
-            owsFailDebug("Dropping early envelope \(OWSMessageDecrypter.description(for: droppedEarlyEnvelope.envelope)) for message \(identifier) due to excessive early envelopes.")
-        }
-
-        envelopes.append(EarlyEnvelope(
-            envelope: envelope,
-            plainTextData: plainTextData,
-            wasReceivedByUD: wasReceivedByUD,
-            serverDeliveryTimestamp: serverDeliveryTimestamp
-        ))
-
-        do {
-            try pendingEnvelopeStore.setCodable(envelopes, key: identifier.key, transaction: transaction)
+            let payload = try Self.encode(EarlyEnvelope(
+                envelope: envelope,
+                plainTextData: plainTextData,
+                wasReceivedByUD: wasReceivedByUD,
+                serverDeliveryTimestamp: serverDeliveryTimestamp
+            ))
+            try insert(kind: .envelope, payload: payload, identifier: identifier, tx: transaction)
         } catch {
             owsFailDebug("Failed to persist early envelope \(OWSMessageDecrypter.description(for: envelope)) for message \(identifier) with error \(error)")
         }
@@ -311,31 +343,83 @@ public class EarlyMessageManager: NSObject {
         identifier: MessageIdentifier,
         transaction: SDSAnyWriteTransaction
     ) {
-        var receipts: [EarlyReceipt]
         do {
-            receipts = try pendingReceiptStore.getCodableValue(forKey: identifier.key, transaction: transaction) ?? []
+            let existingReceipts = try fetchPayloads(kind: .receipt, identifier: identifier, tx: transaction)
+                .compactMap { try? JSONDecoder().decode(EarlyReceipt.self, from: $0) }
+            guard !existingReceipts.contains(earlyReceipt) else {
+                Logger.warn("Ignoring duplicate early receipt \(earlyReceipt) for message \(identifier)")
+                return
+            }
+            try insert(kind: .receipt, payload: try Self.encode(earlyReceipt), identifier: identifier, tx: transaction)
         } catch {
-            owsFailDebug("Failed to decode existing early receipts for message \(identifier) with error \(error)")
-            receipts = []
+            owsFailDebug("Failed to persist early receipt for message \(identifier) with error \(error)")
         }
+    }
 
-        guard !Set(receipts).contains(earlyReceipt) else {
-            Logger.warn("Ignoring duplicate early receipt \(earlyReceipt) for message \(identifier)")
-            return
-        }
+    private func fetchPayloads(
+        kind: Kind,
+        identifier: MessageIdentifier,
+        tx: SDSAnyReadTransaction
+    ) throws -> [Data] {
+        return try Data.fetchAll(
+            tx.unwrapGrdbRead.database,
+            sql: """
+                SELECT \(Self.payloadColumn) FROM \(Self.tableName)
+                WHERE \(Self.targetAuthorAciColumn) = ?
+                AND \(Self.targetTimestampColumn) = ?
+                AND \(Self.kindColumn) = ?
+                ORDER BY id
+            """,
+            arguments: [Data(identifier.author.serviceIdBinary), identifier.timestamp, kind.rawValue]
+        )
+    }
 
-        while receipts.count >= Self.maxQueuedPerMessage, let droppedEarlyReceipt = receipts.first {
-            receipts.remove(at: 0)
-            owsFailDebug("Dropping early receipt \(droppedEarlyReceipt) for message \(identifier) due to excessive early receipts.")
+    /// Inserts a row, first dropping the earliest rows of the same kind for
+    /// the same message if it already has `maxQueuedPerMessage`.
+    private func insert(
+        kind: Kind,
+        payload: Data,
+        identifier: MessageIdentifier,
+        tx: SDSAnyWriteTransaction
+    ) throws {
+        let database = tx.unwrapGrdbWrite.database
+        let targetArguments: StatementArguments = [
+            Data(identifier.author.serviceIdBinary),
+            identifier.timestamp,
+            kind.rawValue,
+        ]
+        let targetClause = """
+            \(Self.targetAuthorAciColumn) = ?
+            AND \(Self.targetTimestampColumn) = ?
+            AND \(Self.kindColumn) = ?
+        """
+
+        let existingCount = try Int.fetchOne(
+            database,
+            sql: "SELECT COUNT(*) FROM \(Self.tableName) WHERE \(targetClause)",
+            arguments: targetArguments
+        ) ?? 0
+        if existingCount >= Self.maxQueuedPerMessage {
+            let dropCount = existingCount - Self.maxQueuedPerMessage + 1
+            owsFailDebug("Dropping \(dropCount) early \(kind) row(s) for message \(identifier) due to excessive early messages.")
+            try database.execute(
+                sql: """
+                    DELETE FROM \(Self.tableName) WHERE id IN (
+                        SELECT id FROM \(Self.tableName) WHERE \(targetClause) ORDER BY id LIMIT ?
+                    )
+                """,
+                arguments: targetArguments + [dropCount]
+            )
         }
 
-        receipts.append(earlyReceipt)
-
-        do {
-            try pendingReceiptStore.setCodable(receipts, key: identifier.key, transaction: transaction)
-        } catch {
-            owsFailDebug("Failed to persist early receipt for message \(identifier) with error \(error)")
-        }
+        try database.execute(
+            sql: """
+                INSERT INTO \(Self.tableName)
+                (\(Self.targetAuthorAciColumn), \(Self.targetTimestampColumn), \(Self.kindColumn), \(Self.payloadColumn))
+                VALUES (?, ?, ?, ?)
+            """,
+            arguments: targetArguments + [payload]
+        )
     }
 
     public func applyPendingMessages(for message: TSMessage, localIdentifiers: LocalIdentifiers, transaction: SDSAnyWriteTransaction) {
@@ -469,31 +553,60 @@ public class EarlyMessageManager: NSObject {
         tx transaction: SDSAnyWriteTransaction,
         earlyReceiptProcessor: (EarlyReceipt) -> Void
     ) {
-        let earlyReceipts: [EarlyReceipt]?
+        let database = transaction.unwrapGrdbWrite.database
+        let targetArguments: StatementArguments = [Data(identifier.author.serviceIdBinary), identifier.timestamp]
+        let targetClause = "\(Self.targetAuthorAciColumn) = ? AND \(Self.targetTimestampColumn) = ?"
+
+        let rows: [Row]
         do {
-            earlyReceipts = try pendingReceiptStore.getCodableValue(forKey: identifier.key, transaction: transaction)
+            rows = try Row.fetchAll(
+                database,
+                sql: """
+                    SELECT \(Self.kindColumn), \(Self.payloadColumn) FROM \(Self.tableName)
+                    WHERE \(targetClause)
+                    ORDER BY id
+                """,
+                arguments: targetArguments
+            )
         } catch {
-            owsFailDebug("Failed to decode early receipts for message \(identifier) with error \(error)")
-            earlyReceipts = nil
+            owsFailDebug("Failed to fetch early messages for message \(identifier) with error \(error)")
+            return
         }
 
-        pendingReceiptStore.removeValue(forKey: identifier.key, transaction: transaction)
-
-        // Apply any early receipts for this message
-        earlyReceipts?.forEach { earlyReceiptProcessor($0) }
+        // This is the common case; every message we receive or send ends up here.
+        guard !rows.isEmpty else {
+            return
+        }
 
-        let earlyEnvelopes: [EarlyEnvelope]?
         do {
-            earlyEnvelopes = try pendingEnvelopeStore.getCodableValue(forKey: identifier.key, transaction: transaction)
+            try database.execute(sql: "DELETE FROM \(Self.tableName) WHERE \(targetClause)", arguments: targetArguments)
         } catch {
-            owsFailDebug("Failed to decode early envelopes for \(identifier) with error \(error)")
-            earlyEnvelopes = nil
+            owsFailDebug("Failed to delete early messages for message \(identifier) with error \(error)")
+        }
+
+        var earlyReceipts = [EarlyReceipt]()
+        var earlyEnvelopes = [EarlyEnvelope]()
+        for row in rows {
+            let payload: Data = row[Self.payloadColumn]
+            do {
+                switch Kind(rawValue: row[Self.kindColumn]) {
+                case .receipt:
+                    earlyReceipts.append(try JSONDecoder().decode(EarlyReceipt.self, from: payload))
+                case .envelope:
+                    earlyEnvelopes.append(try JSONDecoder().decode(EarlyEnvelope.self, from: payload))
+                case nil:
+                    owsFailDebug("Unknown early message kind for message \(identifier)")
+                }
+            } catch {
+                owsFailDebug("Failed to decode early message for message \(identifier) with error \(error)")
+            }
         }
 
-        pendingEnvelopeStore.removeValue(forKey: identifier.key, transaction: transaction)
+        // Apply any early receipts for this message
+        earlyReceipts.forEach { earlyReceiptProcessor($0) }
 
         // Re-process any early envelopes associated with this message
-        for earlyEnvelope in earlyEnvelopes ?? [] {
+        for earlyEnvelope in earlyEnvelopes {
             Logger.info("Reprocessing early envelope \(OWSMessageDecrypter.description(for: earlyEnvelope.envelope)) for \(identifier)")
 
             guard let plaintextData = earlyEnvelope.plainTextData else {
@@ -513,90 +626,111 @@ public class EarlyMessageManager: NSObject {
         }
     }
 
+    // MARK: - Expiry
+
     private func cleanupStaleMessages() {
-        databaseStorage.asyncWrite { transaction in
+        DispatchQueue.global(qos: .utility).async {
+            self.databaseStorage.write { tx in
+                self.moveLegacyEarlyMessagesIfNecessary(tx: tx)
+            }
+
             let oldestTimestampToKeep = Date.ows_millisecondTimestamp() - kWeekInMs
+            var expiredCount = 0
+            self.deleteInBatches(
+                selectingIdsSQL: """
+                    SELECT id FROM \(Self.tableName)
+                    WHERE \(Self.targetTimestampColumn) < \(oldestTimestampToKeep)
+                """,
+                deletedCount: &expiredCount
+            )
 
-            let allEnvelopeKeys = self.pendingEnvelopeStore.allKeys(transaction: transaction)
-            let staleEnvelopeKeys = allEnvelopeKeys.filter {
-                guard let timestampString = $0.split(separator: ".")[safe: 1],
-                      let timestamp = UInt64(timestampString),
-                      timestamp < oldestTimestampToKeep else {
-                    return false
-                }
-                return true
+            // The newest row that's over the cap, if any; it and everything
+            // recorded before it go.
+            let newestExcessId = self.databaseStorage.read { tx in
+                return try? Int64.fetchOne(
+                    tx.unwrapGrdbRead.database,
+                    sql: """
+                        SELECT id FROM \(Self.tableName)
+                        ORDER BY id DESC
+                        LIMIT 1 OFFSET \(Self.maxEarlyMessageCount)
+                    """
+                )
             }
-            self.pendingEnvelopeStore.removeValues(forKeys: staleEnvelopeKeys, transaction: transaction)
-
-            let allReceiptKeys = self.pendingReceiptStore.allKeys(transaction: transaction)
-            let staleReceiptKeys = allReceiptKeys.filter {
-                guard let timestampString = $0.split(separator: ".")[safe: 1],
-                      let timestamp = UInt64(timestampString),
-                      timestamp < oldestTimestampToKeep else {
-                    return false
-                }
-                return true
+            var trimmedCount = 0
+            if let newestExcessId {
+                self.deleteInBatches(
+                    selectingIdsSQL: "SELECT id FROM \(Self.tableName) WHERE id <= \(newestExcessId)",
+                    deletedCount: &trimmedCount
+                )
             }
-            self.pendingReceiptStore.removeValues(forKeys: staleReceiptKeys, transaction: transaction)
 
-            let remainingReceiptKeys = Set(allReceiptKeys).subtracting(staleReceiptKeys)
-            self.trimEarlyReceiptsIfNecessary(remainingReceiptKeys: remainingReceiptKeys,
-                                                     transaction: transaction)
+            if expiredCount > 0 || trimmedCount > 0 {
+                Logger.info("Removed \(expiredCount) stale and \(trimmedCount) excess early messages.")
+            }
         }
     }
 
-    private func trimEarlyReceiptsIfNecessary(
-        remainingReceiptKeys: Set<String>,
-        transaction: SDSAnyWriteTransaction
-    ) {
-        guard CurrentAppContext().isMainApp,
-              !CurrentAppContext().isRunningTests else {
-                  return
-              }
-
-        let trimmedReceiptsKey = "trimmedReceiptsKey"
-        let hasTrimmedReceipts = self.metadataStore.getBool(
-            trimmedReceiptsKey,
-            defaultValue: false,
-            transaction: transaction)
-        guard !hasTrimmedReceipts else { return }
-        self.metadataStore.setBool(true, key: trimmedReceiptsKey, transaction: transaction)
-
-        var removedTotal: Int = 0
-        for receiptKey in remainingReceiptKeys {
-            autoreleasepool {
+    /// Deletes the rows whose ids `selectingIdsSQL` selects, `expiryBatchSize`
+    /// at a time so that no single write holds up message processing.
+    private func deleteInBatches(selectingIdsSQL: String, deletedCount: inout Int) {
+        while true {
+            let batchCount: Int = databaseStorage.write { tx in
+                let database = tx.unwrapGrdbWrite.database
                 do {
-                    let receipts: [EarlyReceipt] = try self.pendingReceiptStore.getCodableValue(forKey: receiptKey,
-                                                                                                transaction: transaction) ?? []
-                    var deduplicatedReceipts = OrderedSet(receipts).orderedMembers
-                    if deduplicatedReceipts.count != receipts.count {
-                        Logger.info("De-duplicated early receipts for message \(receiptKey): \(receipts.count) - \(receipts.count - deduplicatedReceipts.count) -> \(deduplicatedReceipts.count)")
-                    }
+                    try database.execute(sql: """
+                        DELETE FROM \(Self.tableName) WHERE id IN (
+                            SELECT id FROM (\(selectingIdsSQL)) LIMIT \(Self.expiryBatchSize)
+                        )
+                    """)
+                    return database.changesCount
+                } catch {
+                    owsFailDebug("Failed to delete early messages: \(error)")
+                    return 0
+                }
+            }
+            deletedCount += batchCount
+            guard batchCount == Self.expiryBatchSize else {
+                return
+            }
+        }
+    }
 
-                    if deduplicatedReceipts.count > Self.maxQueuedPerMessage {
-                        let countBeforeTrimming = deduplicatedReceipts.count
-                        deduplicatedReceipts = Array(deduplicatedReceipts.suffix(Self.maxQueuedPerMessage))
-                        Logger.info("Trimmed early receipts for message \(receiptKey): \(countBeforeTrimming) - \(countBeforeTrimming - deduplicatedReceipts.count) -> \(deduplicatedReceipts.count)")
-                    }
+    /// Early messages used to be stored as arrays in key-value stores, one
+    /// entry per message they were waiting for.
+    private func moveLegacyEarlyMessagesIfNecessary(tx: SDSAnyWriteTransaction) {
+        let envelopeKeys = legacyEnvelopeStore.allKeys(transaction: tx)
+        let receiptKeys = legacyReceiptStore.allKeys(transaction: tx)
+        guard !envelopeKeys.isEmpty || !receiptKeys.isEmpty else {
+            return
+        }
 
-                    guard !receipts.isEmpty,
-                          receipts.count != deduplicatedReceipts.count else {
+        var movedCount = 0
+        func move<T: Codable>(_ type: T.Type, kind: Kind, keys: [String], from store: SDSKeyValueStore) {
+            for key in keys {
+                autoreleasepool {
+                    guard let identifier = MessageIdentifier(legacyKey: key) else {
+                        owsFailDebug("Invalid legacy early message key.")
                         return
                     }
-                    try pendingReceiptStore.setCodable(deduplicatedReceipts,
-                                                       key: receiptKey,
-                                                       transaction: transaction)
-                    owsAssertDebug(receipts.count > deduplicatedReceipts.count)
-                    removedTotal += receipts.count - deduplicatedReceipts.count
-                } catch {
-                    owsFailDebug("Failed to decode early receipts: \(error)")
-                    self.pendingReceiptStore.removeValue(forKey: receiptKey, transaction: transaction)
+                    do {
+                        let values: [T] = try store.getCodableValue(forKey: key, transaction: tx) ?? []
+                        // Keep the latest, as inserting would have.
+                        for value in values.suffix(Self.maxQueuedPerMessage) {
+                            try insert(kind: kind, payload: try Self.encode(value), identifier: identifier, tx: tx)
+                            movedCount += 1
+                        }
+                    } catch {
+                        owsFailDebug("Failed to move legacy early messages for message \(identifier): \(error)")
+                    }
                 }
             }
+            store.removeAll(transaction: tx)
         }
-        if removedTotal > 0 {
-            Logger.info("Removed early receipts (total): \(removedTotal)")
-        }
+        move(EarlyEnvelope.self, kind: .envelope, keys: envelopeKeys, from: legacyEnvelopeStore)
+        move(EarlyReceipt.self, kind: .receipt, keys: receiptKeys, from: legacyReceiptStore)
+        legacyMetadataStore.removeAll(transaction: tx)
+
+        Logger.info("Moved \(movedCount) legacy early messages.")
     }
 }
 
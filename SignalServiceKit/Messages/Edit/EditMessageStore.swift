@@ -88,9 +88,12 @@ public class EditMessageStoreImpl: EditMessageStore {
 
         let transaction = SDSDB.shimOnlyBridge(tx)
 
+        // The author is part of this index, so SQLite can check it against
+        // index entries instead of loading every row with this timestamp.
         let sql = """
             SELECT *
             FROM \(InteractionRecord.databaseTableName)
+            INDEXED BY index_interactions_on_timestamp_sourceDeviceId_and_authorUUID
             WHERE \(interactionColumn: .timestamp) = ?
             AND \(interactionColumn: .authorUUID) IS ?
             LIMIT 1
@@ -202,17 +205,20 @@ public class EditMessageStoreImpl: EditMessageStore {
             arguments: arguments
         )
 
-        return records.map { record -> (EditRecord, MessageType?) in
-            let interaction = InteractionFinder.fetch(
-                rowId: record.pastRevisionId,
-                transaction: transaction
-            )
-            guard let message = interaction as? MessageType else {
-                owsFailDebug("Interaction has unexpected type: \(type(of: interaction))")
-                return (record, nil)
-            }
-            return (record: record, edit: message)
-        }
+        // Fetch all the past revisions at once, rather than one at a time.
+        let revisionSQL = """
+            SELECT interaction.* FROM \(InteractionRecord.databaseTableName) AS interaction
+            INNER JOIN \(EditRecord.databaseTableName) AS editRecord
+            ON interaction.\(interactionColumn: .id) = editRecord.pastRevisionId
+            WHERE editRecord.latestRevisionId = ?
+        """
+        let pastRevisions = try TSInteraction.grdbFetchCursor(
+            sql: revisionSQL,
+            arguments: arguments,
+            transaction: transaction.unwrapGrdbRead
+        ).all()
+
+        return Self.matchRecords(records, toPastRevisions: pastRevisions)
     }
 
     /// This method is similar to findEditHistory, but will find records and interactions where the
@@ -239,16 +245,40 @@ public class EditMessageStoreImpl: EditMessageStore {
             arguments: arguments
         )
 
+        // Fetch all the past revisions at once, rather than one at a time.
+        let revisionSQL = """
+            SELECT interaction.* FROM \(InteractionRecord.databaseTableName) AS interaction
+            INNER JOIN \(EditRecord.databaseTableName) AS editRecord
+            ON interaction.\(interactionColumn: .id) = editRecord.pastRevisionId
+            WHERE editRecord.latestRevisionId = ?
+            OR editRecord.pastRevisionId = ?
+        """
+        let pastRevisions = try TSInteraction.grdbFetchCursor(
+            sql: revisionSQL,
+            arguments: arguments,
+            transaction: transaction.unwrapGrdbRead
+        ).all()
+
+        return Self.matchRecords(records, toPastRevisions: pastRevisions)
+    }
+
+    private static func matchRecords<MessageType: TSMessage>(
+        _ records: [EditRecord],
+        toPastRevisions pastRevisions: [TSInteraction]
+    ) -> [(record: EditRecord, message: MessageType?)] {
+        var pastRevisionsByRowId = [Int64: TSInteraction]()
+        for pastRevision in pastRevisions {
+            if let rowId = pastRevision.sqliteRowId {
+                pastRevisionsByRowId[rowId] = pastRevision
+            }
+        }
         return records.map { record -> (EditRecord, MessageType?) in
-            let interaction = InteractionFinder.fetch(
-                rowId: record.pastRevisionId,
-                transaction: transaction
-            )
+            let interaction = pastRevisionsByRowId[record.pastRevisionId]
             guard let message = interaction as? MessageType else {
                 owsFailDebug("Interaction has unexpected type: \(type(of: interaction))")
                 return (record, nil)
             }
-            return (record: record, edit: message)
+            return (record: record, message: message)
         }
     }
 
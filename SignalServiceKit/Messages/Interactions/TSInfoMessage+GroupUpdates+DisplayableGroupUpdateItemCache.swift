@@ -0,0 +1,152 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+import LibSignalClient
+
+/// Remembers the ``DisplayableGroupUpdateItem``s built for each group update
+/// info message.
+///
+/// Building them means decoding the persisted update items (or diffing
+/// group models, for legacy messages) and resolving the name of everyone
+/// involved, every time the message is rendered or previewed. Items embed
+/// those names, so entries are dropped when the name of anyone they
+/// reference might have changed, and an info message's entry is dropped
+/// when the message is updated.
+final class DisplayableGroupUpdateItemCache {
+
+    static let shared = DisplayableGroupUpdateItemCache()
+
+    private struct Key: Hashable {
+        let infoMessageUniqueId: String
+        let localeIdentifier: String
+
+        init(_ infoMessage: TSInfoMessage) {
+            self.infoMessageUniqueId = infoMessage.uniqueId
+            self.localeIdentifier = Locale.current.identifier
+        }
+    }
+
+    private struct Entry {
+        /// Items differ depending on who the local user is.
+        let localAci: Aci
+        let items: [DisplayableGroupUpdateItem]
+    }
+
+    private let lock = UnfairLock()
+    private let cache = LRUCache<Key, Entry>(maxSize: 512, nseMaxSize: 32)
+    /// Everyone referenced by a cached item.
+    private var referencedAddresses = Set<SignalServiceAddress>()
+    /// Bumped whenever entries are dropped, so that a build that raced with a
+    /// name change or an update doesn't cache stale items.
+    private var generation: UInt64 = 0
+
+    init() {
+        let nameNotifications: [Notification.Name] = [
+            .OWSContactsManagerSignalAccountsDidChange,
+            UserProfileNotifications.localProfileDidChange,
+            UserProfileNotifications.profileWhitelistDidChange,
+        ]
+        for name in nameNotifications {
+            NotificationCenter.default.addObserver(forName: name, object: nil, queue: nil) { [weak self] _ in
+                self?.removeAll()
+            }
+        }
+        NotificationCenter.default.addObserver(
+            forName: UserProfileNotifications.otherUsersProfileDidChange,
+            object: nil,
+            queue: nil
+        ) { [weak self] notification in
+            guard let address = notification.userInfo?[UserProfileNotifications.profileAddressKey] as? SignalServiceAddress else {
+                self?.removeAll()
+                return
+            }
+            self?.removeAll(referencing: address)
+        }
+    }
+
+    func items(
+        for infoMessage: TSInfoMessage,
+        localIdentifiers: LocalIdentifiers,
+        build: () -> [DisplayableGroupUpdateItem]?
+    ) -> [DisplayableGroupUpdateItem]? {
+        let key = Key(infoMessage)
+        let (cached, startGeneration) = lock.withLock { (cache[key], generation) }
+        if let cached, cached.localAci == localIdentifiers.aci {
+            return cached.items
+        }
+        guard let items = build() else {
+            return nil
+        }
+        lock.withLock {
+            guard generation == startGeneration else {
+                return
+            }
+            cache[key] = Entry(localAci: localIdentifiers.aci, items: items)
+            for item in items {
+                referencedAddresses.formUnion(Self.addresses(referencedBy: item))
+            }
+        }
+        return items
+    }
+
+    func removeItems(for infoMessage: TSInfoMessage) {
+        lock.withLock {
+            cache.removeObject(forKey: Key(infoMessage))
+            generation += 1
+        }
+    }
+
+    private func removeAll(referencing address: SignalServiceAddress) {
+        lock.withLock {
+            guard referencedAddresses.contains(address) else {
+                return
+            }
+            _removeAll()
+        }
+    }
+
+    private func removeAll() {
+        lock.withLock { _removeAll() }
+    }
+
+    private func _removeAll() {
+        lock.assertOwner()
+        cache.removeAllObjects()
+        referencedAddresses.removeAll()
+        generation += 1
+    }
+
+    /// The addresses in `item`'s associated values.
+    ///
+    /// There are well over a hundred cases, so rather than switch over them
+    /// all this reflects over the associated values: a single value, or a
+    /// tuple of labeled values.
+    static func addresses(referencedBy item: DisplayableGroupUpdateItem) -> [SignalServiceAddress] {
+        return Mirror(reflecting: item).children.flatMap { associatedValue -> [SignalServiceAddress] in
+            if let address = associatedValue.value as? SignalServiceAddress {
+                return [address]
+            }
+            return Mirror(reflecting: associatedValue.value).children.compactMap { $0.value as? SignalServiceAddress }
+        }
+    }
+}
+
+// MARK: -
+
+extension TSInfoMessage {
+    @objc
+    func removeCachedGroupUpdateItems(transaction: SDSAnyWriteTransaction) {
+        guard messageType == .typeGroupUpdate else {
+            return
+        }
+        // Until this commits, readers still see the old items; drop whatever
+        // they cached in the meantime too.
+        DisplayableGroupUpdateItemCache.shared.removeItems(for: self)
+        transaction.addSyncCompletion {
+            DisplayableGroupUpdateItemCache.shared.removeItems(for: self)
+        }
+    }
+}
@@ -116,16 +116,9 @@ public extension TSInfoMessage {
             return NSAttributedString(string: string)
 
         case .newGroup, .modelDiff, .precomputed:
-            guard let items = buildGroupUpdateItems(
+            guard let items = buildDisplayableGroupUpdateItems(
                 localIdentifiers: localIdentifiers,
-                tx: tx.asV2Read,
-                transformer: { builder, precomputedItems, tx in
-                    return builder.displayableUpdateItemsForPrecomputed(
-                        precomputedUpdateItems: precomputedItems,
-                        localIdentifiers: localIdentifiers,
-                        tx: tx
-                    )
-                }
+                tx: tx
             ) else {
                 return fallback
             }
@@ -189,6 +182,23 @@ public extension TSInfoMessage {
                 return nil
             }
 
+            return buildDisplayableGroupUpdateItems(
+                localIdentifiers: localIdentifiers,
+                tx: tx
+            )
+        }
+    }
+
+    /// Builds the displayable items, or returns them from
+    /// ``DisplayableGroupUpdateItemCache`` if they were built already.
+    private func buildDisplayableGroupUpdateItems(
+        localIdentifiers: LocalIdentifiers,
+        tx: SDSAnyReadTransaction
+    ) -> [DisplayableGroupUpdateItem]? {
+        return DisplayableGroupUpdateItemCache.shared.items(
+            for: self,
+            localIdentifiers: localIdentifiers
+        ) {
             return buildGroupUpdateItems(
                 localIdentifiers: localIdentifiers,
                 tx: tx.asV2Read,
@@ -335,6 +335,15 @@ NSUInteger TSInfoMessageSchemaVersion = 2;
     return @"";
 }
 
+#pragma mark - Any Transaction Hooks
+
+- (void)anyDidUpdateWithTransaction:(SDSAnyWriteTransaction *)transaction
+{
+    [super anyDidUpdateWithTransaction:transaction];
+
+    [self removeCachedGroupUpdateItemsWithTransaction:transaction];
+}
+
 #pragma mark - OWSReadTracking
 
 - (uint64_t)expireStartedAt
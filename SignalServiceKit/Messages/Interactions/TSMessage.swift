@@ -443,9 +443,10 @@ public extension TSMessage {
     func notificationPreviewText(_ tx: SDSAnyReadTransaction) -> String {
         switch previewText(tx) {
         case let .body(body, prefix, ranges):
-            let hydrated = MessageBody(text: body, ranges: ranges ?? .empty)
-                .hydrating(mentionHydrator: ContactsMentionHydrator.mentionHydrator(transaction: tx.asV2Read))
-                .asPlaintext()
+            let hydrated = HydratedMessageBodyCache.shared.hydratedBody(
+                for: MessageBody(text: body, ranges: ranges ?? .empty),
+                tx: tx.asV2Read
+            ).asPlaintext()
             guard let prefix else {
                 return hydrated.filterForDisplay
             }
@@ -467,8 +468,10 @@ public extension TSMessage {
     func conversationListPreviewText(_ tx: SDSAnyReadTransaction) -> HydratedMessageBody {
         switch previewText(tx) {
         case let .body(body, prefix, ranges):
-            let hydrated = MessageBody(text: body, ranges: ranges ?? .empty)
-                .hydrating(mentionHydrator: ContactsMentionHydrator.mentionHydrator(transaction: tx.asV2Read))
+            let hydrated = HydratedMessageBodyCache.shared.hydratedBody(
+                for: MessageBody(text: body, ranges: ranges ?? .empty),
+                tx: tx.asV2Read
+            )
             guard let prefix else {
                 return hydrated
             }
@@ -671,7 +674,7 @@ public extension TSMessage {
 
     @objc
     internal func _anyDidInsert(tx: SDSAnyWriteTransaction) {
-        FullTextSearchIndexer.insert(self, tx: tx)
+        FullTextSearchIndexer.enqueue(self, tx: tx)
     }
 
     @objc
@@ -13,6 +13,7 @@ extern const NSUInteger kOversizeTextMessageSizeThreshold;
 @class OWSOutgoingSyncMessage;
 @class SignalServiceAddress;
 @class TSOutgoingMessageRecipientState;
+@class TSOutgoingMessageRecipientStatusCounts;
 
 typedef NS_ENUM(NSUInteger, OWSOutgoingMessageRecipientStatus);
 
@@ -175,8 +176,14 @@ NS_DESIGNATED_INITIALIZER NS_SWIFT_NAME(init(grdbId:uniqueId:receivedAtTimestamp
 @property (atomic, nullable)
     NSDictionary<SignalServiceAddress *, TSOutgoingMessageRecipientState *> *recipientAddressStates;
 
+/// Per-status counts of `recipientAddressStates`, kept up to date as they change.
+@property (nonatomic, readonly) TSOutgoingMessageRecipientStatusCounts *recipientStatusCounts;
+
 @property (nonatomic, readonly) BOOL wasDeliveredToAnyRecipient;
 @property (nonatomic, readonly) BOOL wasSentToAnyRecipient;
+// We only learn "read" status if read receipts are enabled.
+@property (nonatomic, readonly) BOOL wasReadByAnyRecipient;
+@property (nonatomic, readonly) BOOL wasViewedByAnyRecipient;
 
 @property (atomic, readonly) BOOL hasSyncedTranscript;
 @property (atomic, readonly, nullable) NSString *customMessage;
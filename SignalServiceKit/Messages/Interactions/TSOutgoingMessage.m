@@ -67,7 +67,12 @@ NSUInteger const TSOutgoingMessageSchemaVersion = 1;
 
 #pragma mark -
 
-@implementation TSOutgoingMessage
+@implementation TSOutgoingMessage {
+    // These are deliberately ivars rather than properties so that they aren't
+    // serialized. They're rebuilt whenever recipientAddressStates is replaced.
+    TSOutgoingMessageRecipientStatusCounts *_Nullable _recipientStatusCounts;
+    NSDictionary<SignalServiceAddress *, TSOutgoingMessageRecipientState *> *_Nullable _recipientStatusCountsSource;
+}
 
 // --- CODE GENERATION MARKER
 
@@ -298,10 +303,25 @@ NSUInteger const TSOutgoingMessageSchemaVersion = 1;
 
 #pragma mark -
 
+- (TSOutgoingMessageRecipientStatusCounts *)recipientStatusCounts
+{
+    NSDictionary<SignalServiceAddress *, TSOutgoingMessageRecipientState *> *_Nullable recipientAddressStates
+        = self.recipientAddressStates;
+    @synchronized(self) {
+        if (_recipientStatusCounts == nil || _recipientStatusCountsSource != recipientAddressStates
+            || !_recipientStatusCounts.isValid) {
+            _recipientStatusCounts =
+                [[TSOutgoingMessageRecipientStatusCounts alloc] initWithRecipientStates:recipientAddressStates.allValues
+                                                                                            ?: @[]];
+            _recipientStatusCountsSource = recipientAddressStates;
+        }
+        return _recipientStatusCounts;
+    }
+}
+
 - (TSOutgoingMessageState)messageState
 {
-    TSOutgoingMessageState newMessageState =
-        [TSOutgoingMessage messageStateForRecipientStates:self.recipientAddressStates.allValues];
+    TSOutgoingMessageState newMessageState = self.recipientStatusCounts.messageState;
     if (self.hasLegacyMessageState) {
         if (newMessageState == TSOutgoingMessageStateSent || self.legacyMessageState == TSOutgoingMessageStateSent) {
             return TSOutgoingMessageStateSent;
@@ -312,7 +332,7 @@ NSUInteger const TSOutgoingMessageSchemaVersion = 1;
 
 - (BOOL)wasDeliveredToAnyRecipient
 {
-    if (self.deliveredRecipientAddresses.count > 0) {
+    if (self.recipientStatusCounts.deliveredCount > 0) {
         return YES;
     }
     return (self.hasLegacyMessageState && self.legacyWasDelivered && self.messageState == TSOutgoingMessageStateSent);
@@ -320,12 +340,22 @@ NSUInteger const TSOutgoingMessageSchemaVersion = 1;
 
 - (BOOL)wasSentToAnyRecipient
 {
-    if (self.sentRecipientAddresses.count > 0) {
+    if (self.recipientStatusCounts.sentCount > 0) {
         return YES;
     }
     return (self.hasLegacyMessageState && self.messageState == TSOutgoingMessageStateSent);
 }
 
+- (BOOL)wasReadByAnyRecipient
+{
+    return self.recipientStatusCounts.readCount > 0;
+}
+
+- (BOOL)wasViewedByAnyRecipient
+{
+    return self.recipientStatusCounts.viewedCount > 0;
+}
+
 - (BOOL)shouldBeSaved
 {
     if (!super.shouldBeSaved) {
@@ -37,6 +37,10 @@ public class TSOutgoingMessageRecipientState: NSObject, NSCoding, NSCopying {
     /// if `status = .failed`, or `status = .sending` with a prior failure.
     public var errorCode: Int?
 
+    /// The counts on the message that owns this state, which need to hear
+    /// about changes to `status`.
+    weak var statusCounts: TSOutgoingMessageRecipientStatusCounts?
+
     @objc
     public convenience init(status: OWSOutgoingMessageRecipientStatus) {
         self.init(
@@ -65,8 +69,10 @@ public class TSOutgoingMessageRecipientState: NSObject, NSCoding, NSCopying {
         _ newStatus: OWSOutgoingMessageRecipientStatus,
         statusTimestamp: UInt64 = Date().ows_millisecondsSince1970
     ) {
+        let oldStatus = self.status
         self.status = newStatus
         self.statusTimestamp = statusTimestamp
+        statusCounts?.recipientState(self, didChangeStatusFrom: oldStatus, to: newStatus)
     }
 
     // MARK: - NSCoding
@@ -0,0 +1,109 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+/// How many of an outgoing message's recipients are in each status.
+///
+/// `TSOutgoingMessage` asks for its message state and whether it was
+/// delivered/read several times per render, which used to mean a pass over
+/// every recipient each time; that adds up in large groups. These counts are
+/// built once from `recipientAddressStates` and kept up to date as recipient
+/// states change.
+///
+/// Recipient states are mutated in place, so each state holds a weak
+/// reference to the counts that include it. A state can only report to one
+/// set of counts; if another message starts tracking it, the previous counts
+/// are invalidated and their message rebuilds them on next access.
+@objc
+public final class TSOutgoingMessageRecipientStatusCounts: NSObject {
+    private let lock = UnfairLock()
+    private var counts = [OWSOutgoingMessageRecipientStatus: Int]()
+    private var _isValid = true
+
+    @objc
+    public init(recipientStates: [TSOutgoingMessageRecipientState]) {
+        super.init()
+
+        for recipientState in recipientStates {
+            if let previousCounts = recipientState.statusCounts, previousCounts !== self {
+                previousCounts.invalidate()
+            }
+            recipientState.statusCounts = self
+            counts[recipientState.status, default: 0] += 1
+        }
+    }
+
+    @objc
+    public var isValid: Bool {
+        lock.withLock { _isValid }
+    }
+
+    private func invalidate() {
+        lock.withLock { _isValid = false }
+    }
+
+    func recipientState(
+        _ recipientState: TSOutgoingMessageRecipientState,
+        didChangeStatusFrom oldStatus: OWSOutgoingMessageRecipientStatus,
+        to newStatus: OWSOutgoingMessageRecipientStatus
+    ) {
+        guard oldStatus != newStatus else {
+            return
+        }
+        lock.withLock {
+            counts[oldStatus, default: 0] -= 1
+            counts[newStatus, default: 0] += 1
+            owsAssertDebug(counts[oldStatus]! >= 0)
+        }
+    }
+
+    public func count(of statuses: OWSOutgoingMessageRecipientStatus...) -> Int {
+        lock.withLock {
+            statuses.reduce(0) { $0 + counts[$1, default: 0] }
+        }
+    }
+
+    /// Equivalent to `TSOutgoingMessage.messageStateForRecipientStates(_:)`,
+    /// except that "sending" deterministically wins over "pending" if there are
+    /// recipients in both states.
+    @objc
+    public var messageState: TSOutgoingMessageState {
+        lock.withLock {
+            if counts[.sending, default: 0] > 0 {
+                return .sending
+            }
+            if counts[.pending, default: 0] > 0 {
+                return .pending
+            }
+            if counts[.failed, default: 0] > 0 {
+                return .failed
+            }
+            return .sent
+        }
+    }
+
+    /// Recipients to whom the message has been sent, including those for whom
+    /// it has been delivered, read, or viewed.
+    @objc
+    public var sentCount: Int {
+        count(of: .sent, .delivered, .read, .viewed)
+    }
+
+    /// Recipients to whom the message has been delivered, including those for
+    /// whom it has been read or viewed.
+    @objc
+    public var deliveredCount: Int {
+        count(of: .delivered, .read, .viewed)
+    }
+
+    @objc
+    public var readCount: Int {
+        count(of: .read, .viewed)
+    }
+
+    @objc
+    public var viewedCount: Int {
+        count(of: .viewed)
+    }
+}
@@ -200,7 +200,13 @@ public class MessageFetcherJob: NSObject {
             )
         }
 
-        if batch.hasMore {
+        if batch.hasMore, MemoryWatermark.current == .critical {
+            // Leave the rest on the server for the main app (or a later NSE
+            // launch) rather than fetching more than we can process.
+            Logger.warn("Not fetching more messages; memoryUsage: \(LocalDevice.memoryUsageString)")
+            self.didFinishFetchingViaREST.set(true)
+            NotificationCenter.default.postNotificationNameAsync(MessageFetcherJob.didChangeStateNotificationName, object: nil)
+        } else if batch.hasMore {
             Logger.info("fetching more messages.")
             try await fetchMessagesViaRestWhenReady()
         } else {
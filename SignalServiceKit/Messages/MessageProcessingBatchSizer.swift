@@ -0,0 +1,88 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// Picks how many envelopes `MessageProcessor` should handle per write
+/// transaction.
+///
+/// Larger batches amortize the per-transaction overhead, which matters a lot
+/// when catching up on a backlog. However, the write transaction blocks every
+/// other writer (including ones the UI is waiting on), and in the background
+/// a long transaction risks being killed before it commits. So we estimate the
+/// per-envelope cost from recent batches and size the next batch so that it
+/// should finish within the target duration for the current policy.
+struct MessageProcessingBatchSizer {
+    struct Policy: Equatable {
+        /// How long we'd like each write transaction to take.
+        let targetDuration: TimeInterval
+        /// If a transaction has been running for this long, we stop starting
+        /// new work in it, even if the batch isn't finished.
+        let maxDuration: TimeInterval
+        let minBatchSize: Int
+        let maxBatchSize: Int
+
+        /// In the foreground, larger batches are fine as long as the write
+        /// doesn't hold up user-initiated writes for more than a few frames.
+        static let foreground = Policy(targetDuration: 0.05, maxDuration: 0.2, minBatchSize: 1, maxBatchSize: 128)
+
+        /// In the background (and in the NSE) we may be suspended or killed at
+        /// any moment, so we keep transactions short so that work is committed
+        /// (and acked) incrementally.
+        static let background = Policy(targetDuration: 0.02, maxDuration: 0.1, minBatchSize: 1, maxBatchSize: 16)
+
+        /// When the NSE is near its memory limit, every envelope in a batch
+        /// (and everything it touches) is held in memory until the batch
+        /// commits, so we handle a couple at a time.
+        static let lowMemory = Policy(targetDuration: 0.02, maxDuration: 0.05, minBatchSize: 1, maxBatchSize: 2)
+    }
+
+    /// Exponentially-weighted moving average of how long it takes to process
+    /// a single envelope. Nil until we've processed our first batch.
+    private(set) var estimatedDurationPerEnvelope: TimeInterval?
+
+    private var lastBatchSize: Int?
+
+    /// How much weight to give the most recent batch when updating the
+    /// estimate.
+    private static let smoothingFactor = 0.3
+
+    /// Limits how quickly the batch size can grow so that a few cheap
+    /// envelopes (e.g. receipts) don't make us jump to a huge batch.
+    private static let maxGrowthFactor = 2
+
+    func nextBatchSize(policy: Policy) -> Int {
+        guard let estimatedDurationPerEnvelope else {
+            // Start small; we'll grow quickly once we have a measurement.
+            return policy.minBatchSize
+        }
+        var batchSize = policy.maxBatchSize
+        if estimatedDurationPerEnvelope > 0 {
+            // Compare as Doubles to avoid overflowing Int for tiny estimates.
+            let idealBatchSize = policy.targetDuration / estimatedDurationPerEnvelope
+            batchSize = idealBatchSize < Double(batchSize) ? Int(idealBatchSize) : batchSize
+        }
+        if let lastBatchSize {
+            batchSize = min(batchSize, lastBatchSize * Self.maxGrowthFactor)
+        }
+        return batchSize.clamp(policy.minBatchSize, policy.maxBatchSize)
+    }
+
+    mutating func recordBatch(envelopeCount: Int, duration: TimeInterval) {
+        guard envelopeCount > 0 else {
+            return
+        }
+        let durationPerEnvelope = max(0, duration) / Double(envelopeCount)
+        if let estimatedDurationPerEnvelope {
+            self.estimatedDurationPerEnvelope = (
+                Self.smoothingFactor * durationPerEnvelope
+                + (1 - Self.smoothingFactor) * estimatedDurationPerEnvelope
+            )
+        } else {
+            self.estimatedDurationPerEnvelope = durationPerEnvelope
+        }
+        lastBatchSize = envelopeCount
+    }
+}
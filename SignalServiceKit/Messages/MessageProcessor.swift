@@ -142,26 +142,9 @@ public class MessageProcessor: NSObject {
             SDSDatabaseStorage.shared.read { transaction in
                 // We may have legacy process jobs queued. We want to schedule them for
                 // processing immediately when we launch, so that we can drain the old queue.
-                let legacyProcessingJobRecords = LegacyMessageJobFinder().allJobs(transaction: transaction)
-                for jobRecord in legacyProcessingJobRecords {
-                    let completion: (Error?) -> Void = { _ in
-                        SDSDatabaseStorage.shared.write { jobRecord.anyRemove(transaction: $0) }
-                    }
-                    do {
-                        let envelope = try SSKProtoEnvelope(serializedData: jobRecord.envelopeData)
-                        self.processReceivedEnvelope(
-                            ReceivedEnvelope(
-                                envelope: envelope,
-                                encryptionStatus: .decrypted(plaintextData: jobRecord.plaintextData, wasReceivedByUD: jobRecord.wasReceivedByUD),
-                                serverDeliveryTimestamp: jobRecord.serverDeliveryTimestamp,
-                                completion: completion
-                            ),
-                            envelopeSource: .unknown
-                        )
-                    } catch {
-                        completion(error)
-                    }
-                }
+                self.drainLegacyMessageContentJobs(
+                    LegacyMessageJobFinder().nextJobs(afterId: nil, batchSize: Self.legacyJobBatchSize, transaction: transaction)
+                )
 
                 // We may have legacy decrypt jobs queued. We want to schedule them for
                 // processing immediately when we launch, so that we can drain the old queue.
@@ -198,6 +181,69 @@ public class MessageProcessor: NSObject {
         }
     }
 
+    /// How many legacy process jobs to read, and remove, at a time.
+    private static let legacyJobBatchSize = 500
+
+    /// Feeds a batch of legacy process jobs through the usual batching path.
+    ///
+    /// Once every job in the batch has completed, the whole batch is removed
+    /// with one ranged delete and the next batch is read, rather than writing
+    /// once per job. If any were deferred for low memory, the batch is kept
+    /// so it's processed again on a later launch.
+    private func drainLegacyMessageContentJobs(_ jobRecords: [OWSMessageContentJob]) {
+        guard let lastJobId = jobRecords.last?.grdbId?.int64Value else {
+            return
+        }
+        Logger.info("Processing \(jobRecords.count) legacy message content jobs.")
+
+        let lock = UnfairLock()
+        var remainingCount = jobRecords.count
+        var wasDeferred = false
+        let completion: (Error?) -> Void = { error in
+            let (isBatchComplete, wasBatchDeferred): (Bool, Bool) = lock.withLock {
+                if (error as? MessageProcessingError) == .deferredForLowMemory {
+                    wasDeferred = true
+                }
+                remainingCount -= 1
+                return (remainingCount == 0, wasDeferred)
+            }
+            guard isBatchComplete else {
+                return
+            }
+            guard !wasBatchDeferred else {
+                Logger.warn("Legacy message content jobs were deferred; keeping them.")
+                return
+            }
+            // Completions may be called synchronously, while the batch is
+            // still being read or enqueued.
+            DispatchQueue.global().async {
+                let nextJobRecords = SDSDatabaseStorage.shared.write { tx in
+                    let finder = LegacyMessageJobFinder()
+                    finder.removeJobs(throughId: lastJobId, transaction: tx)
+                    return finder.nextJobs(afterId: lastJobId, batchSize: Self.legacyJobBatchSize, transaction: tx)
+                }
+                self.drainLegacyMessageContentJobs(nextJobRecords)
+            }
+        }
+
+        for jobRecord in jobRecords {
+            do {
+                let envelope = try SSKProtoEnvelope(serializedData: jobRecord.envelopeData)
+                processReceivedEnvelope(
+                    ReceivedEnvelope(
+                        envelope: envelope,
+                        encryptionStatus: .decrypted(plaintextData: jobRecord.plaintextData, wasReceivedByUD: jobRecord.wasReceivedByUD),
+                        serverDeliveryTimestamp: jobRecord.serverDeliveryTimestamp,
+                        completion: completion
+                    ),
+                    envelopeSource: .unknown
+                )
+            } catch {
+                completion(error)
+            }
+        }
+    }
+
     public func processReceivedEnvelopeData(
         _ envelopeData: Data,
         serverDeliveryTimestamp: UInt64,
@@ -259,6 +305,7 @@ public class MessageProcessor: NSObject {
     }
 
     private func processReceivedEnvelope(_ receivedEnvelope: ReceivedEnvelope, envelopeSource: EnvelopeSource) {
+        Tracing.emitEvent(.messageProcessing, "EnvelopeReceived", metadata: "\(receivedEnvelope.envelope.timestamp)")
         let replacedEnvelope = pendingEnvelopes.enqueue(receivedEnvelope)
         if let replacedEnvelope {
             Logger.warn("Replaced \(replacedEnvelope.envelope.timestamp) serverGuid: \(replacedEnvelope.envelope.serverGuid as Optional)")
@@ -280,6 +327,12 @@ public class MessageProcessor: NSObject {
 
     private var pendingEnvelopes = PendingEnvelopes()
 
+    /// Only accessed on `serialQueue`.
+    private var batchSizer = MessageProcessingBatchSizer()
+
+    /// Only accessed on `serialQueue`.
+    private var memoryWatermark = MemoryWatermark.normal
+
     private let isDrainingPendingEnvelopes = AtomicBool(false, lock: .init())
 
     private func drainPendingEnvelopes() {
@@ -293,6 +346,7 @@ public class MessageProcessor: NSObject {
             while autoreleasepool(invoking: { self.drainNextBatch() }) {}
             self.isDrainingPendingEnvelopes.set(false)
             if self.pendingEnvelopes.isEmpty {
+                Tracing.emitEvent(.messageProcessing, "DidDrainQueue")
                 NotificationCenter.default.postNotificationNameAsync(Self.messageProcessorDidDrainQueue, object: nil)
             }
         }
@@ -306,24 +360,34 @@ public class MessageProcessor: NSObject {
             return false
         }
 
-        // We want a value that is just high enough to yield perf benefits.
-        let kIncomingMessageBatchSize = 16
-        // If the app is in the background, use batch size of 1.
-        // This reduces the risk of us never being able to drain any
-        // messages from the queue. We should fine tune this number
-        // to yield the best perf we can get.
-        let batchSize = CurrentAppContext().isInBackground() ? 1 : kIncomingMessageBatchSize
+        let batchPolicy: MessageProcessingBatchSizer.Policy
+        switch updateMemoryWatermark() {
+        case .critical:
+            deferPendingEnvelopes()
+            return false
+        case .elevated:
+            batchPolicy = .lowMemory
+        case .normal:
+            // In the background, keep transactions short. This reduces the risk of
+            // us never being able to drain any messages from the queue.
+            batchPolicy = CurrentAppContext().isInBackground() ? .background : .foreground
+        }
+        let batchSize = batchSizer.nextBatchSize(policy: batchPolicy)
         let batch = pendingEnvelopes.nextBatch(batchSize: batchSize)
-        let batchEnvelopes = batch.batchEnvelopes
         let pendingEnvelopesCount = batch.pendingEnvelopesCount
 
-        guard !batchEnvelopes.isEmpty else {
+        guard !batch.batchEnvelopes.isEmpty else {
             return false
         }
 
         let startTime = CACurrentMediaTime()
 
+        let batchEnvelopes = Tracing.withInterval(.messageProcessing, "Unseal", metadata: "batchSize: \(batch.batchEnvelopes.count)") {
+            unsealEnvelopes(batch.batchEnvelopes)
+        }
+
         var processedEnvelopesCount = 0
+        let batchInterval = Tracing.beginInterval(.messageProcessing, "ProcessBatch", metadata: "batchSize: \(batchEnvelopes.count)")
         databaseStorage.write { tx in
             // This is only called via `drainPendingEnvelopes`, and that confirms that
             // we're registered. If we're registered, we must have `LocalIdentifiers`,
@@ -338,6 +402,12 @@ public class MessageProcessor: NSObject {
                 guard messagePipelineSupervisor.isMessageProcessingPermitted else {
                     break
                 }
+                // If our estimate was off (e.g. a batch of expensive messages), commit
+                // what we've done so far rather than exceeding our time budget. The
+                // rest of the batch will be picked up by the next transaction.
+                if remainingEnvelopes.count < batchEnvelopes.count, CACurrentMediaTime() - startTime >= batchPolicy.maxDuration {
+                    break
+                }
                 autoreleasepool {
                     // If we build a request, we must handle it to ensure it's not lost if we
                     // stop processing envelopes.
@@ -356,13 +426,99 @@ public class MessageProcessor: NSObject {
             }
             processedEnvelopesCount += batchEnvelopes.count - remainingEnvelopes.count
         }
+        batchInterval.end(metadata: "processed: \(processedEnvelopesCount)")
         pendingEnvelopes.removeProcessedEnvelopes(processedEnvelopesCount)
         let endTime = CACurrentMediaTime()
+        batchSizer.recordBatch(envelopeCount: processedEnvelopesCount, duration: endTime - startTime)
         let formattedDuration = String(format: "%.1f", (endTime - startTime) * 1000)
-        Logger.info("Processed \(processedEnvelopesCount) envelopes (of \(pendingEnvelopesCount) total) in \(formattedDuration)ms")
+        let counters = pendingEnvelopes.counters
+        Logger.info("Processed \(processedEnvelopesCount) envelopes (of \(pendingEnvelopesCount) total) in \(formattedDuration)ms; enqueued: \(counters.enqueuedEnvelopesCount), replaced: \(counters.replacedEnvelopesCount), dequeued: \(counters.dequeuedEnvelopesCount)")
         return true
     }
 
+    /// In the NSE, checks how close we are to the memory limit before each
+    /// batch. The first time memory runs low we clear our caches, since the
+    /// NSE doesn't get memory warnings.
+    private func updateMemoryWatermark() -> MemoryWatermark {
+        assertOnQueue(serialQueue)
+
+        guard CurrentAppContext().isNSE else {
+            return .normal
+        }
+        let oldMemoryWatermark = memoryWatermark
+        memoryWatermark = MemoryWatermark.current
+        if memoryWatermark > oldMemoryWatermark {
+            Logger.warn("Memory watermark rose to \(memoryWatermark); memoryUsage: \(LocalDevice.memoryUsageString)")
+            LRUCacheMemoryBudget.shared.clearAll()
+            ModelReadCaches.shared.evacuateAllCaches()
+        }
+        return memoryWatermark
+    }
+
+    /// Gives up on the queued envelopes without acking them, so the server
+    /// keeps them for the main app (or a later NSE launch) to process. This
+    /// lets the NSE finish cleanly rather than being killed mid-batch.
+    private func deferPendingEnvelopes() {
+        assertOnQueue(serialQueue)
+
+        let deferredEnvelopes = pendingEnvelopes.removeAll()
+        guard !deferredEnvelopes.isEmpty else {
+            return
+        }
+        Logger.warn("Deferring \(deferredEnvelopes.count) envelopes; memoryUsage: \(LocalDevice.memoryUsageString)")
+        for receivedEnvelope in deferredEnvelopes {
+            receivedEnvelope.completion(MessageProcessingError.deferredForLowMemory)
+        }
+    }
+
+    /// Removes the outer layer of the batch's sealed sender envelopes
+    /// concurrently.
+    ///
+    /// Decrypting an envelope reads and advances its sender's session, so it
+    /// happens in order, in the batch's write transaction. Unsealing (finding
+    /// out who sent it and validating their certificate) needs only our
+    /// identity key, and is a large part of the work of decrypting a sealed
+    /// sender message, so it's done for the whole batch up front across all
+    /// cores. Envelopes that can't be unsealed here are unsealed again, and
+    /// their errors handled, when they're decrypted.
+    private func unsealEnvelopes(_ envelopes: [ReceivedEnvelope]) -> [ReceivedEnvelope] {
+        let sealedIndexes = envelopes.indices.filter { envelopes[$0].isEncryptedSealedSender }
+        guard sealedIndexes.count > 1 else {
+            return envelopes
+        }
+
+        let (localIdentifiers, identityKeyPairs) = databaseStorage.read { tx in
+            let identityManager = DependenciesBridge.shared.identityManager
+            var identityKeyPairs = [OWSIdentity: IdentityKeyPair]()
+            for identity in [OWSIdentity.aci, .pni] {
+                identityKeyPairs[identity] = identityManager.identityKeyPair(for: identity, tx: tx.asV2Read)?.identityKeyPair
+            }
+            let localIdentifiers = DependenciesBridge.shared.tsAccountManager.localIdentifiers(tx: tx.asV2Read)
+            return (localIdentifiers, identityKeyPairs)
+        }
+        guard let localIdentifiers else {
+            return envelopes
+        }
+        let trustRoot = udManager.trustRoot
+
+        var unsealedMessages = [SMKUnsealedMessage?](repeating: nil, count: sealedIndexes.count)
+        unsealedMessages.withUnsafeMutableBufferPointer { buffer in
+            DispatchQueue.concurrentPerform(iterations: sealedIndexes.count) { index in
+                buffer[index] = envelopes[sealedIndexes[index]].unseal(
+                    trustRoot: trustRoot,
+                    localIdentifiers: localIdentifiers,
+                    identityKeyPairs: identityKeyPairs
+                )
+            }
+        }
+
+        var result = envelopes
+        for (index, unsealedMessage) in zip(sealedIndexes, unsealedMessages) {
+            result[index].unsealedMessage = unsealedMessage
+        }
+        return result
+    }
+
     // If envelopes is not empty, this will emit a single request for a non-delivery receipt or one or more requests
     // all for delivery receipts.
     private func buildNextCombinedRequest(
@@ -439,7 +595,9 @@ public class MessageProcessor: NSObject {
         localIdentifiers: LocalIdentifiers,
         tx: SDSAnyWriteTransaction
     ) {
-        let error = reallyHandleProcessingRequest(request, context: context, localIdentifiers: localIdentifiers, transaction: tx)
+        let error = Tracing.withInterval(.messageProcessing, "HandleEnvelope", metadata: "\(request.receivedEnvelope.envelope.timestamp)") {
+            reallyHandleProcessingRequest(request, context: context, localIdentifiers: localIdentifiers, transaction: tx)
+        }
         tx.addAsyncCompletionOffMain { request.receivedEnvelope.completion(error) }
     }
 
@@ -463,6 +621,9 @@ public class MessageProcessor: NSObject {
         if case MessageProcessingError.replacedEnvelope = error {
             // _DO NOT_ ACK if de-duplicated before decryption.
             return .shouldNotAck(error: error)
+        } else if case MessageProcessingError.deferredForLowMemory = error {
+            // _DO NOT_ ACK if we didn't get to it; it'll be fetched again.
+            return .shouldNotAck(error: error)
         } else if case MessageProcessingError.blockedSender = error {
             return .shouldAck
         } else if let owsError = error as? OWSError,
@@ -551,12 +712,14 @@ private struct ProcessingRequestBuilder {
 
     func build(tx: SDSAnyWriteTransaction) -> ProcessingRequest.State {
         do {
-            let decryptionResult = try receivedEnvelope.decryptIfNeeded(
-                messageDecrypter: messageDecrypter,
-                localIdentifiers: localIdentifiers,
-                localDeviceId: localDeviceId,
-                tx: tx
-            )
+            let decryptionResult = try Tracing.withInterval(.messageProcessing, "Decrypt", metadata: "\(receivedEnvelope.envelope.timestamp)") {
+                try receivedEnvelope.decryptIfNeeded(
+                    messageDecrypter: messageDecrypter,
+                    localIdentifiers: localIdentifiers,
+                    localDeviceId: localDeviceId,
+                    tx: tx
+                )
+            }
             switch decryptionResult {
             case .serverReceipt(let receiptEnvelope):
                 return .serverReceipt(receiptEnvelope)
@@ -727,6 +890,41 @@ private struct ReceivedEnvelope {
     let encryptionStatus: EncryptionStatus
     let serverDeliveryTimestamp: UInt64
     let completion: (Error?) -> Void
+    /// Set for sealed sender envelopes unsealed ahead of decryption; see
+    /// `MessageProcessor.unsealEnvelopes(_:)`.
+    var unsealedMessage: SMKUnsealedMessage?
+
+    var isEncryptedSealedSender: Bool {
+        guard case .encrypted = encryptionStatus else {
+            return false
+        }
+        return envelope.type == .unidentifiedSender
+    }
+
+    func unseal(
+        trustRoot: PublicKey,
+        localIdentifiers: LocalIdentifiers,
+        identityKeyPairs: [OWSIdentity: IdentityKeyPair]
+    ) -> SMKUnsealedMessage? {
+        do {
+            let validatedEnvelope = try ValidatedIncomingEnvelope(envelope, localIdentifiers: localIdentifiers)
+            guard
+                case .unidentifiedSender = validatedEnvelope.kind,
+                let cipherTextData = envelope.content,
+                let identityKeyPair = identityKeyPairs[validatedEnvelope.localIdentity]
+            else {
+                return nil
+            }
+            return try SMKSecretSessionCipher.unsealMessage(
+                trustRoot: trustRoot,
+                cipherTextData: cipherTextData,
+                timestamp: validatedEnvelope.serverTimestamp,
+                identityKeyPair: identityKeyPair
+            )
+        } catch {
+            return nil
+        }
+    }
 
     enum DecryptionResult {
         case serverReceipt(ServerReceiptEnvelope)
@@ -756,7 +954,11 @@ private struct ReceivedEnvelope {
             case .unidentifiedSender:
                 return .decryptedMessage(
                     try messageDecrypter.decryptUnidentifiedSenderEnvelope(
-                        validatedEnvelope, localIdentifiers: localIdentifiers, localDeviceId: localDeviceId, tx: tx
+                        validatedEnvelope,
+                        localIdentifiers: localIdentifiers,
+                        localDeviceId: localDeviceId,
+                        unsealedMessage: unsealedMessage,
+                        tx: tx
                     )
                 )
             }
@@ -785,16 +987,14 @@ private struct ReceivedEnvelope {
         }
     }
 
-    func isDuplicateOf(_ other: ReceivedEnvelope) -> Bool {
+    /// Envelopes with the same duplicate identity are redeliveries of the same
+    /// message, and only the most recent copy should be processed.
+    var duplicateIdentity: String? {
         guard let serverGuid = self.envelope.serverGuid else {
             owsFailDebug("Missing serverGuid.")
-            return false
-        }
-        guard let otherServerGuid = other.envelope.serverGuid else {
-            owsFailDebug("Missing other.serverGuid.")
-            return false
+            return nil
         }
-        return serverGuid == otherServerGuid
+        return serverGuid
     }
 }
 
@@ -815,7 +1015,12 @@ public enum EnvelopeSource {
 
 private class PendingEnvelopes {
     private let unfairLock = UnfairLock()
-    private var pendingEnvelopes = [ReceivedEnvelope]()
+    private var pendingEnvelopes = DedupingRingQueue<String, ReceivedEnvelope>(initialCapacity: 64)
+
+    /// Running totals, useful for observing how a backlog drains.
+    private var enqueuedEnvelopesCount = 0
+    private var replacedEnvelopesCount = 0
+    private var dequeuedEnvelopesCount = 0
 
     var isEmpty: Bool {
         unfairLock.withLock { pendingEnvelopes.isEmpty }
@@ -830,10 +1035,26 @@ private class PendingEnvelopes {
         let pendingEnvelopesCount: Int
     }
 
+    struct Counters {
+        let enqueuedEnvelopesCount: Int
+        let replacedEnvelopesCount: Int
+        let dequeuedEnvelopesCount: Int
+    }
+
+    var counters: Counters {
+        unfairLock.withLock {
+            Counters(
+                enqueuedEnvelopesCount: enqueuedEnvelopesCount,
+                replacedEnvelopesCount: replacedEnvelopesCount,
+                dequeuedEnvelopesCount: dequeuedEnvelopesCount
+            )
+        }
+    }
+
     func nextBatch(batchSize: Int) -> Batch {
         unfairLock.withLock {
             Batch(
-                batchEnvelopes: Array(pendingEnvelopes.prefix(batchSize)),
+                batchEnvelopes: pendingEnvelopes.prefix(batchSize),
                 pendingEnvelopesCount: pendingEnvelopes.count
             )
         }
@@ -842,19 +1063,28 @@ private class PendingEnvelopes {
     func removeProcessedEnvelopes(_ processedEnvelopesCount: Int) {
         unfairLock.withLock {
             pendingEnvelopes.removeFirst(processedEnvelopesCount)
+            dequeuedEnvelopesCount += processedEnvelopesCount
+        }
+    }
+
+    func removeAll() -> [ReceivedEnvelope] {
+        unfairLock.withLock {
+            let removedEnvelopes = pendingEnvelopes.prefix(pendingEnvelopes.count)
+            pendingEnvelopes.removeFirst(removedEnvelopes.count)
+            dequeuedEnvelopesCount += removedEnvelopes.count
+            return removedEnvelopes
         }
     }
 
     func enqueue(_ receivedEnvelope: ReceivedEnvelope) -> ReceivedEnvelope? {
         return unfairLock.withLock { () -> ReceivedEnvelope? in
-            if let indexToReplace = pendingEnvelopes.firstIndex(where: { receivedEnvelope.isDuplicateOf($0) }) {
-                let replacedEnvelope = pendingEnvelopes[indexToReplace]
-                pendingEnvelopes[indexToReplace] = receivedEnvelope
-                return replacedEnvelope
+            let replacedEnvelope = pendingEnvelopes.enqueue(receivedEnvelope, key: receivedEnvelope.duplicateIdentity)
+            if replacedEnvelope == nil {
+                enqueuedEnvelopesCount += 1
             } else {
-                pendingEnvelopes.append(receivedEnvelope)
-                return nil
+                replacedEnvelopesCount += 1
             }
+            return replacedEnvelope
         }
     }
 }
@@ -866,4 +1096,6 @@ public enum MessageProcessingError: Error {
     case invalidMessageTypeForDestinationUuid
     case replacedEnvelope
     case blockedSender
+    /// The NSE stopped processing because it was running out of memory.
+    case deferredForLowMemory
 }
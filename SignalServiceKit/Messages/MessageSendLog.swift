@@ -40,7 +40,10 @@ public class MessageSendLog {
 
     private enum Constants {
         static let payloadLifetime: TimeInterval = RemoteConfig.current.messageSendLogEntryLifetime
-        static let cleanupLimit = 25
+        static let cleanupLimit = 500
+        /// Smaller payloads are stored as-is; they rarely shrink enough to be
+        /// worth decompressing on every fetch.
+        static let compressionThreshold = 512
     }
 
     private func currentExpiredPayloadTimestamp() -> UInt64 {
@@ -74,6 +77,52 @@ public class MessageSendLog {
             self.sendComplete = sendComplete
         }
 
+        private enum CodingKeys: String, CodingKey {
+            case payloadId
+            case plaintextContent
+            // If true, plaintextContent is stored zlib-compressed.
+            case isCompressed
+            case contentHint
+            case sentTimestamp
+            case uniqueThreadId
+            case sendComplete
+        }
+
+        init(from decoder: Decoder) throws {
+            let container = try decoder.container(keyedBy: CodingKeys.self)
+            payloadId = try container.decodeIfPresent(Int64.self, forKey: .payloadId)
+            let storedContent = try container.decode(Data.self, forKey: .plaintextContent)
+            if try container.decode(Bool.self, forKey: .isCompressed) {
+                plaintextContent = try (storedContent as NSData).decompressed(using: .zlib) as Data
+            } else {
+                plaintextContent = storedContent
+            }
+            contentHint = try container.decode(SealedSenderContentHint.self, forKey: .contentHint)
+            sentTimestamp = try container.decode(UInt64.self, forKey: .sentTimestamp)
+            uniqueThreadId = try container.decode(String.self, forKey: .uniqueThreadId)
+            sendComplete = try container.decode(Bool.self, forKey: .sendComplete)
+        }
+
+        func encode(to encoder: Encoder) throws {
+            var container = encoder.container(keyedBy: CodingKeys.self)
+            try container.encodeIfPresent(payloadId, forKey: .payloadId)
+            if
+                plaintextContent.count >= Constants.compressionThreshold,
+                let compressedContent = try? (plaintextContent as NSData).compressed(using: .zlib) as Data,
+                compressedContent.count < plaintextContent.count
+            {
+                try container.encode(compressedContent, forKey: .plaintextContent)
+                try container.encode(true, forKey: .isCompressed)
+            } else {
+                try container.encode(plaintextContent, forKey: .plaintextContent)
+                try container.encode(false, forKey: .isCompressed)
+            }
+            try container.encode(contentHint, forKey: .contentHint)
+            try container.encode(sentTimestamp, forKey: .sentTimestamp)
+            try container.encode(uniqueThreadId, forKey: .uniqueThreadId)
+            try container.encode(sendComplete, forKey: .sendComplete)
+        }
+
         mutating func didInsert(with rowID: Int64, for column: String?) {
             guard column == "payloadId" else { return owsFailDebug("Expected payloadId") }
             payloadId = rowID
@@ -123,7 +172,7 @@ public class MessageSendLog {
                 do {
                     var existingPayload = existingValue.payload
                     existingPayload.sendComplete = false
-                    try existingPayload.update(tx.unwrapGrdbWrite.database)
+                    try existingPayload.update(tx.unwrapGrdbWrite.database, columns: ["sendComplete"])
                 } catch {
                     owsFailDebug("Failed to mark existing payload incomplete.")
                 }
@@ -220,7 +269,7 @@ public class MessageSendLog {
                 return
             }
             payload.sendComplete = true
-            try payload.update(db)
+            try payload.update(db, columns: ["sendComplete"])
             try deletePayloadIfNecessary(payload, tx: tx)
         } catch {
             owsFailDebug("Failed to mark send complete for \(message.timestamp): \(error)")
@@ -389,16 +438,25 @@ public class MessageSendLog {
 
     public func cleanUpExpiredEntries() throws {
         let cutoffTimestamp = currentExpiredPayloadTimestamp()
-        let fetchRequest = Payload
-            .select(Column("payloadId"), as: Int64.self)
-            .filter(Column("sentTimestamp") < cutoffTimestamp)
-            .limit(Constants.cleanupLimit)
+        // Payloads are deleted oldest first, in chunks picked out by the
+        // sentTimestamp index; deleting a payload cascades to its rows in the
+        // other MSL tables.
         let count = try TimeGatedBatch.processAll(db: db) { tx in
             do {
                 let db = SDSDB.shimOnlyBridge(tx).unwrapGrdbWrite.database
-                let payloadIds = try fetchRequest.fetchAll(db)
-                try Payload.filter(keys: payloadIds).deleteAll(db)
-                return payloadIds.count
+                try db.execute(
+                    sql: """
+                        DELETE FROM \(Payload.databaseTableName)
+                        WHERE payloadId IN (
+                            SELECT payloadId FROM \(Payload.databaseTableName)
+                            WHERE sentTimestamp < ?
+                            ORDER BY sentTimestamp
+                            LIMIT ?
+                        )
+                        """,
+                    arguments: [cutoffTimestamp, Constants.cleanupLimit]
+                )
+                return db.changesCount
             } catch {
                 throw error.grdbErrorForLogging
             }
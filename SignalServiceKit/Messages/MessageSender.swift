@@ -66,8 +66,8 @@ public class MessageSender: Dependencies {
         }
     }
 
-    /// Establishes a session with the recipient if one doesn't already exist.
-    private func ensureRecipientHasSession(
+    /// Establishes a session with a recipient device we don't have one with.
+    private func fetchPreKeysAndCreateSession(
         recipientUniqueId: RecipientUniqueId,
         serviceId: ServiceId,
         deviceId: UInt32,
@@ -76,13 +76,6 @@ public class MessageSender: Dependencies {
         isStoryMessage: Bool,
         udAccess: OWSUDAccess?
     ) async throws {
-        let hasSession = try databaseStorage.read { tx in
-            try containsValidSession(for: serviceId, deviceId: deviceId, tx: tx.asV2Read)
-        }
-        if hasSession {
-            return
-        }
-
         let preKeyBundle = try await makePrekeyRequest(
             recipientUniqueId: recipientUniqueId,
             serviceId: serviceId,
@@ -709,6 +702,9 @@ public class MessageSender: Dependencies {
     }
 
     private func sendPreparedMessage(_ message: TSOutgoingMessage) async throws {
+        let interval = Tracing.beginInterval(.messageSending, "SendMessage", metadata: "\(message.timestamp)")
+        defer { interval.end() }
+
         if !areAttachmentsUploadedWithSneakyTransaction(for: message) {
             throw OWSUnretryableMessageSenderError()
         }
@@ -766,6 +762,9 @@ public class MessageSender: Dependencies {
         senderCertificates: SenderCertificates
     ) async throws {
         let nextAction: SendMessageNextAction? = try await databaseStorage.awaitableWrite { tx in
+            let interval = Tracing.beginInterval(.messageSending, "Prepare", metadata: "\(message.timestamp)")
+            defer { interval.end() }
+
             guard let thread = message.thread(tx: tx) else {
                 throw MessageSenderError.threadMissing
             }
@@ -904,6 +903,10 @@ public class MessageSender: Dependencies {
         }
     }
 
+    /// Matches the number of default priority requests a chat connection
+    /// sends at once; starting more would only queue them.
+    private static let maxConcurrentFanoutSends = ChatRequestScheduler.Limits.default.maxInFlightCountPerPriority[.default] ?? 16
+
     private func sendPreparedMessage(
         message: TSOutgoingMessage,
         serializedMessage: SerializedMessage,
@@ -920,12 +923,22 @@ public class MessageSender: Dependencies {
             of: [(ServiceId, any Error)].self,
             returning: [(ServiceId, any Error)].self
         ) { taskGroup in
+            var inFlightTaskCount = 0
             if let sendViaSenderKey {
                 taskGroup.addTask(operation: sendViaSenderKey)
+                inFlightTaskCount += 1
             }
 
-            // Perform an "OWSMessageSend" for each non-senderKey recipient.
+            // Perform an "OWSMessageSend" for each non-senderKey recipient, a
+            // limited number at a time so that large groups don't queue up
+            // hundreds of requests and database transactions at once.
+            var results = [(ServiceId, any Error)]()
             for serviceId in fanoutRecipients {
+                if inFlightTaskCount >= Self.maxConcurrentFanoutSends, let result = await taskGroup.next() {
+                    results.append(contentsOf: result)
+                    inFlightTaskCount -= 1
+                }
+                inFlightTaskCount += 1
                 let messageSend = OWSMessageSend(
                     message: message,
                     plaintextContent: serializedMessage.plaintextData,
@@ -947,7 +960,7 @@ public class MessageSender: Dependencies {
                 }
             }
 
-            return await taskGroup.reduce(into: [], { $0.append(contentsOf: $1) })
+            return await taskGroup.reduce(into: results, { $0.append(contentsOf: $1) })
         }
     }
 
@@ -1215,10 +1228,12 @@ public class MessageSender: Dependencies {
 
         let deviceMessages: [DeviceMessage]
         do {
-            deviceMessages = try await buildDeviceMessages(
-                messageSend: messageSend,
-                sealedSenderParameters: sealedSenderParameters
-            )
+            deviceMessages = try await Tracing.withInterval(.messageSending, "Encrypt", metadata: "\(message.timestamp)") {
+                try await buildDeviceMessages(
+                    messageSend: messageSend,
+                    sealedSenderParameters: sealedSenderParameters
+                )
+            }
         } catch {
             switch error {
             case RequestMakerUDAuthError.udAuthFailure:
@@ -1312,43 +1327,69 @@ public class MessageSender: Dependencies {
         sealedSenderParameters: SealedSenderParameters?
     ) async throws -> [DeviceMessage] {
         let recipientDatabaseTable = DependenciesBridge.shared.recipientDatabaseTable
-        let recipient = databaseStorage.read { tx in
-            return recipientDatabaseTable.fetchRecipient(serviceId: messageSend.serviceId, transaction: tx.asV2Read)
+        let localDeviceId = DependenciesBridge.shared.tsAccountManager.storedDeviceIdWithMaybeTransaction
+
+        // Look up the recipient and which of its devices we have sessions with in
+        // one read, rather than one per device.
+        let (recipient, recipientDeviceIds, deviceIdsWithSession) = try databaseStorage.read { tx -> (SignalRecipient?, [UInt32], Set<UInt32>) in
+            let recipient = recipientDatabaseTable.fetchRecipient(serviceId: messageSend.serviceId, transaction: tx.asV2Read)
+            guard let recipient, recipient.isRegistered else {
+                return (nil, [], [])
+            }
+            var recipientDeviceIds = recipient.deviceIds
+            if messageSend.localIdentifiers.contains(serviceId: messageSend.serviceId) {
+                recipientDeviceIds.removeAll(where: { $0 == localDeviceId })
+            }
+            let deviceIdsWithSession = try Set(recipientDeviceIds.filter { deviceId in
+                try self.containsValidSession(for: messageSend.serviceId, deviceId: deviceId, tx: tx.asV2Read)
+            })
+            return (recipient, recipientDeviceIds, deviceIdsWithSession)
         }
 
         // If we think the recipient isn't registered, don't build any device
         // messages. Instead, send an empty message to the server to learn if the
         // account has any devices.
-        guard let recipient, recipient.isRegistered else {
+        guard let recipient else {
             return []
         }
 
-        var recipientDeviceIds = recipient.deviceIds
+        var deviceIdsToEncrypt = [UInt32]()
+        for deviceId in recipientDeviceIds {
+            if !deviceIdsWithSession.contains(deviceId) {
+                let deviceExists = try await establishSession(
+                    recipientUniqueId: recipient.uniqueId,
+                    serviceId: messageSend.serviceId,
+                    deviceId: deviceId,
+                    isOnlineMessage: messageSend.message.isOnline,
+                    isTransientSenderKeyDistributionMessage: messageSend.message.isTransientSKDM,
+                    isStoryMessage: messageSend.message.isStorySend,
+                    udAccess: sealedSenderParameters?.udSendingAccess.udAccess
+                )
+                guard deviceExists else {
+                    continue
+                }
+            }
+            deviceIdsToEncrypt.append(deviceId)
+        }
 
-        if messageSend.localIdentifiers.contains(serviceId: messageSend.serviceId) {
-            let localDeviceId = DependenciesBridge.shared.tsAccountManager.storedDeviceIdWithMaybeTransaction
-            recipientDeviceIds.removeAll(where: { $0 == localDeviceId })
+        if deviceIdsToEncrypt.isEmpty {
+            return []
         }
 
-        var results = [DeviceMessage]()
-        for deviceId in recipientDeviceIds {
-            let deviceMessage = try await buildDeviceMessage(
-                messagePlaintextContent: messageSend.plaintextContent,
-                messageEncryptionStyle: messageSend.message.encryptionStyle,
-                recipientUniqueId: recipient.uniqueId,
-                serviceId: messageSend.serviceId,
-                deviceId: deviceId,
-                isOnlineMessage: messageSend.message.isOnline,
-                isTransientSenderKeyDistributionMessage: messageSend.message.isTransientSKDM,
-                isStoryMessage: messageSend.message.isStorySend,
-                isResendRequestMessage: messageSend.message.isResendRequest,
-                sealedSenderParameters: sealedSenderParameters
-            )
-            if let deviceMessage {
-                results.append(deviceMessage)
+        // Encrypt for all of the recipient's devices in a single write.
+        return try await databaseStorage.awaitableWrite { tx in
+            return try deviceIdsToEncrypt.map { deviceId in
+                try self.encryptDeviceMessage(
+                    messagePlaintextContent: messageSend.plaintextContent,
+                    messageEncryptionStyle: messageSend.message.encryptionStyle,
+                    serviceId: messageSend.serviceId,
+                    deviceId: deviceId,
+                    isResendRequestMessage: messageSend.message.isResendRequest,
+                    sealedSenderParameters: sealedSenderParameters,
+                    tx: tx
+                )
             }
         }
-        return results
     }
 
     /// Build a ``DeviceMessage`` for the given parameters describing a message.
@@ -1369,8 +1410,11 @@ public class MessageSender: Dependencies {
     ) async throws -> DeviceMessage? {
         AssertNotOnMainThread()
 
-        do {
-            try await ensureRecipientHasSession(
+        let hasSession = try databaseStorage.read { tx in
+            try containsValidSession(for: serviceId, deviceId: deviceId, tx: tx.asV2Read)
+        }
+        if !hasSession {
+            let deviceExists = try await establishSession(
                 recipientUniqueId: recipientUniqueId,
                 serviceId: serviceId,
                 deviceId: deviceId,
@@ -1379,6 +1423,48 @@ public class MessageSender: Dependencies {
                 isStoryMessage: isStoryMessage,
                 udAccess: sealedSenderParameters?.udSendingAccess.udAccess
             )
+            guard deviceExists else {
+                return nil
+            }
+        }
+
+        return try await databaseStorage.awaitableWrite { tx in
+            try self.encryptDeviceMessage(
+                messagePlaintextContent: messagePlaintextContent,
+                messageEncryptionStyle: messageEncryptionStyle,
+                serviceId: serviceId,
+                deviceId: deviceId,
+                isResendRequestMessage: isResendRequestMessage,
+                sealedSenderParameters: sealedSenderParameters,
+                tx: tx
+            )
+        }
+    }
+
+    /// Establishes a session with a recipient device we don't have one with.
+    ///
+    /// - Returns: false if the device no longer exists, in which case it has
+    ///   been removed from the recipient.
+    private func establishSession(
+        recipientUniqueId: RecipientUniqueId,
+        serviceId: ServiceId,
+        deviceId: UInt32,
+        isOnlineMessage: Bool,
+        isTransientSenderKeyDistributionMessage: Bool,
+        isStoryMessage: Bool,
+        udAccess: OWSUDAccess?
+    ) async throws -> Bool {
+        do {
+            try await fetchPreKeysAndCreateSession(
+                recipientUniqueId: recipientUniqueId,
+                serviceId: serviceId,
+                deviceId: deviceId,
+                isOnlineMessage: isOnlineMessage,
+                isTransientSenderKeyDistributionMessage: isTransientSenderKeyDistributionMessage,
+                isStoryMessage: isStoryMessage,
+                udAccess: udAccess
+            )
+            return true
         } catch let error {
             switch error {
             case MessageSenderError.missingDevice:
@@ -1392,7 +1478,7 @@ public class MessageSender: Dependencies {
                         transaction: tx
                     )
                 }
-                return nil
+                return false
             case is MessageSenderNoSessionForTransientMessageError:
                 // When users re-register, we don't want transient messages (like typing
                 // indicators) to cause users to hit the prekey fetch rate limit. So we
@@ -1423,43 +1509,51 @@ public class MessageSender: Dependencies {
                 throw OWSRetryableMessageSenderError()
             }
         }
+    }
 
-        return try await databaseStorage.awaitableWrite { tx in
-            do {
-                switch messageEncryptionStyle {
-                case .whisper:
-                    return try self.encryptMessage(
-                        plaintextContent: messagePlaintextContent,
-                        serviceId: serviceId,
-                        deviceId: deviceId,
-                        sealedSenderParameters: sealedSenderParameters,
-                        transaction: tx
-                    )
-                case .plaintext:
-                    return try self.wrapPlaintextMessage(
-                        plaintextContent: messagePlaintextContent,
-                        serviceId: serviceId,
-                        deviceId: deviceId,
-                        isResendRequestMessage: isResendRequestMessage,
-                        sealedSenderParameters: sealedSenderParameters,
-                        transaction: tx
-                    )
-                @unknown default:
-                    throw OWSAssertionError("Unrecognized encryption style")
-                }
-            } catch IdentityManagerError.identityKeyMismatchForOutgoingMessage {
-                Logger.warn("Found identity key mismatch on outgoing message to \(serviceId).\(deviceId). Archiving session before retrying...")
-                let signalProtocolStoreManager = DependenciesBridge.shared.signalProtocolStoreManager
-                let aciSessionStore = signalProtocolStoreManager.signalProtocolStore(for: .aci).sessionStore
-                aciSessionStore.archiveSession(for: serviceId, deviceId: deviceId, tx: tx.asV2Write)
-                throw OWSRetryableMessageSenderError()
-            } catch SignalError.untrustedIdentity {
-                Logger.warn("Found untrusted identity on outgoing message to \(serviceId). Wrapping error and throwing...")
-                throw UntrustedIdentityError(serviceId: serviceId)
-            } catch {
-                Logger.warn("Failed to encrypt message \(error)")
-                throw error
+    private func encryptDeviceMessage(
+        messagePlaintextContent: Data,
+        messageEncryptionStyle: EncryptionStyle,
+        serviceId: ServiceId,
+        deviceId: UInt32,
+        isResendRequestMessage: Bool,
+        sealedSenderParameters: SealedSenderParameters?,
+        tx: SDSAnyWriteTransaction
+    ) throws -> DeviceMessage {
+        do {
+            switch messageEncryptionStyle {
+            case .whisper:
+                return try self.encryptMessage(
+                    plaintextContent: messagePlaintextContent,
+                    serviceId: serviceId,
+                    deviceId: deviceId,
+                    sealedSenderParameters: sealedSenderParameters,
+                    transaction: tx
+                )
+            case .plaintext:
+                return try self.wrapPlaintextMessage(
+                    plaintextContent: messagePlaintextContent,
+                    serviceId: serviceId,
+                    deviceId: deviceId,
+                    isResendRequestMessage: isResendRequestMessage,
+                    sealedSenderParameters: sealedSenderParameters,
+                    transaction: tx
+                )
+            @unknown default:
+                throw OWSAssertionError("Unrecognized encryption style")
             }
+        } catch IdentityManagerError.identityKeyMismatchForOutgoingMessage {
+            Logger.warn("Found identity key mismatch on outgoing message to \(serviceId).\(deviceId). Archiving session before retrying...")
+            let signalProtocolStoreManager = DependenciesBridge.shared.signalProtocolStoreManager
+            let aciSessionStore = signalProtocolStoreManager.signalProtocolStore(for: .aci).sessionStore
+            aciSessionStore.archiveSession(for: serviceId, deviceId: deviceId, tx: tx.asV2Write)
+            throw OWSRetryableMessageSenderError()
+        } catch SignalError.untrustedIdentity {
+            Logger.warn("Found untrusted identity on outgoing message to \(serviceId). Wrapping error and throwing...")
+            throw UntrustedIdentityError(serviceId: serviceId)
+        } catch {
+            Logger.warn("Failed to encrypt message \(error)")
+            throw error
         }
     }
 
@@ -1491,13 +1585,17 @@ public class MessageSender: Dependencies {
         )
 
         do {
-            let result = try await requestMaker.makeRequest().awaitable()
-            return await messageSendDidSucceed(
-                messageSend,
-                deviceMessages: deviceMessages,
-                wasSentByUD: result.wasSentByUD,
-                wasSentByWebsocket: result.wasSentByWebsocket
-            )
+            let result = try await Tracing.withInterval(.messageSending, "Send", metadata: "\(message.timestamp)") {
+                try await requestMaker.makeRequest().awaitable()
+            }
+            return await Tracing.withInterval(.messageSending, "Ack", metadata: "\(message.timestamp)") {
+                await messageSendDidSucceed(
+                    messageSend,
+                    deviceMessages: deviceMessages,
+                    wasSentByUD: result.wasSentByUD,
+                    wasSentByWebsocket: result.wasSentByWebsocket
+                )
+            }
         } catch {
             return try await messageSendDidFail(
                 messageSend,
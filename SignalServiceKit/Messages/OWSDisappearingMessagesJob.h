@@ -5,6 +5,7 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@class DisappearingMessagesExpirationScheduler;
 @class SDSAnyWriteTransaction;
 @class SignalServiceAddress;
 @class TSMessage;
@@ -16,6 +17,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (instancetype)init NS_DESIGNATED_INITIALIZER;
 
+@property (nonatomic, readonly) DisappearingMessagesExpirationScheduler *expirationScheduler;
+
 - (void)startAnyExpirationForMessage:(TSMessage *)message
                  expirationStartedAt:(uint64_t)expirationStartedAt
                          transaction:(SDSAnyWriteTransaction *_Nonnull)transaction;
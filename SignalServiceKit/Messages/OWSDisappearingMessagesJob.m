@@ -19,11 +19,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 + (dispatch_queue_t)serialQueue;
 
-// These three properties should only be accessed on the main thread.
+// This property should only be accessed on the main thread.
 @property (nonatomic) BOOL hasStarted;
-@property (nonatomic, nullable) NSTimer *nextDisappearanceTimer;
-@property (nonatomic, nullable) NSDate *nextDisappearanceDate;
-@property (nonatomic, nullable) NSTimer *fallbackTimer;
 
 @end
 
@@ -47,15 +44,10 @@ void AssertIsOnDisappearingMessagesQueue(void)
         return self;
     }
 
-    // suspenders in case a deletion schedule is missed.
-    NSTimeInterval kFallBackTimerInterval = 5 * kMinuteInterval;
-    AppReadinessRunNowOrWhenMainAppDidBecomeReadyAsync(^{
-        self.fallbackTimer = [NSTimer weakScheduledTimerWithTimeInterval:kFallBackTimerInterval
-                                                                  target:self
-                                                                selector:@selector(fallbackTimerDidFire)
-                                                                userInfo:nil
-                                                                 repeats:YES];
-    });
+    __weak OWSDisappearingMessagesJob *weakSelf = self;
+    _expirationScheduler =
+        [[DisappearingMessagesExpirationScheduler alloc] initWithQueue:OWSDisappearingMessagesJob.serialQueue
+                                                      handleExpiration:^{ [weakSelf runLoop]; }];
 
     OWSSingletonAssert();
 
@@ -105,13 +97,13 @@ void AssertIsOnDisappearingMessagesQueue(void)
     [transaction addAsyncCompletionOffMain:^{
         // Necessary that the async expiration run happens *after* the message is saved with it's new
         // expiration configuration.
-        [self scheduleRunByDate:[NSDate ows_dateWithMillisecondsSince1970:message.expiresAt]];
+        [self scheduleRunByTimestamp:message.expiresAt];
     }];
 }
 
 - (void)scheduleRunByTimestamp:(uint64_t)timestamp
 {
-    [self scheduleRunByDate:[NSDate ows_dateWithMillisecondsSince1970:timestamp]];
+    [self.expirationScheduler scheduleWithExpirationTimestamp:timestamp];
 }
 
 #pragma mark -
@@ -131,6 +123,8 @@ void AssertIsOnDisappearingMessagesQueue(void)
 
         self.hasStarted = YES;
 
+        [self.expirationScheduler setIsEnabled:AppContextObjCBridge.shared.isMainAppAndActive];
+
         dispatch_async(OWSDisappearingMessagesJob.serialQueue, ^{
             // Theoretically this shouldn't be necessary, but there was a race condition when receiving a backlog
             // of messages across timer changes which could cause a disappearing message's timer to never be started.
@@ -161,105 +155,28 @@ void AssertIsOnDisappearingMessagesQueue(void)
     return dateFormatter;
 }
 
-- (void)scheduleRunByDate:(NSDate *)date
-{
-    OWSAssertDebug(date);
-
-    dispatch_async(dispatch_get_main_queue(), ^{
-        if (!AppContextObjCBridge.shared.isMainAppAndActive) {
-            // Don't schedule run when inactive or not in main app.
-            return;
-        }
-
-        // Don't run more often than once per second.
-        const NSTimeInterval kMinDelaySeconds = 1.0;
-        NSTimeInterval delaySeconds = MAX(kMinDelaySeconds, date.timeIntervalSinceNow);
-        NSDate *newTimerScheduleDate = [NSDate dateWithTimeIntervalSinceNow:delaySeconds];
-        if (self.nextDisappearanceDate && [self.nextDisappearanceDate isBeforeDate:newTimerScheduleDate]) {
-            return;
-        }
-
-        // Update Schedule
-        [self resetNextDisappearanceTimer];
-        self.nextDisappearanceDate = newTimerScheduleDate;
-        self.nextDisappearanceTimer = [NSTimer weakTimerWithTimeInterval:delaySeconds
-                                                                  target:self
-                                                                selector:@selector(disappearanceTimerDidFire)
-                                                                userInfo:nil
-                                                                 repeats:NO];
-        [[NSRunLoop mainRunLoop] addTimer:self.nextDisappearanceTimer forMode:NSRunLoopCommonModes];
-    });
-}
+#pragma mark - Notifications
 
-- (void)disappearanceTimerDidFire
+- (void)applicationDidBecomeActive:(NSNotification *)notification
 {
     OWSAssertIsOnMainThread();
 
-    if (!AppContextObjCBridge.shared.isMainAppAndActive) {
-        // Don't schedule run when inactive or not in main app.
-        OWSFailDebug(@"Disappearing messages job timer fired while main app inactive.");
-        return;
-    }
-
     AppReadinessRunNowOrWhenAppDidBecomeReadyAsync(^{
-        [self resetNextDisappearanceTimer];
-
-        dispatch_async(OWSDisappearingMessagesJob.serialQueue, ^{ [self runLoop]; });
-    });
-}
-
-- (void)fallbackTimerDidFire
-{
-    OWSAssertIsOnMainThread();
-
-    BOOL recentlyScheduledDisappearanceTimer = NO;
-    if (fabs(self.nextDisappearanceDate.timeIntervalSinceNow) < 1.0) {
-        recentlyScheduledDisappearanceTimer = YES;
-    }
-
-    if (!AppContextObjCBridge.shared.isMainAppAndActive) {
-        return;
-    }
-
-    AppReadinessRunNowOrWhenMainAppDidBecomeReadyAsync(^{
+        [self.expirationScheduler setIsEnabled:AppContextObjCBridge.shared.isMainAppAndActive];
         dispatch_async(OWSDisappearingMessagesJob.serialQueue, ^{
-            NSInteger deletedCount = [self runLoop];
-
-            // Normally deletions should happen via the disappearanceTimer, to make sure that they're prompt.
-            // So, if we're deleting something via this fallback timer, something may have gone wrong. The
-            // exception is if we're in close proximity to the disappearanceTimer, in which case a race condition
-            // is inevitable.
-            if (!recentlyScheduledDisappearanceTimer && deletedCount > 0) {
-                OWSFailDebug(@"unexpectedly deleted disappearing messages via fallback timer.");
-            }
+            // Other processes may have started expirations while we were inactive.
+            [self reseedExpirations];
+            [self runLoop];
         });
     });
 }
 
-- (void)resetNextDisappearanceTimer
-{
-    OWSAssertIsOnMainThread();
-
-    [self.nextDisappearanceTimer invalidate];
-    self.nextDisappearanceTimer = nil;
-    self.nextDisappearanceDate = nil;
-}
-
-#pragma mark - Notifications
-
-- (void)applicationDidBecomeActive:(NSNotification *)notification
-{
-    OWSAssertIsOnMainThread();
-
-    AppReadinessRunNowOrWhenAppDidBecomeReadyAsync(
-        ^{ dispatch_async(OWSDisappearingMessagesJob.serialQueue, ^{ [self runLoop]; }); });
-}
-
 - (void)applicationWillResignActive:(NSNotification *)notification
 {
     OWSAssertIsOnMainThread();
 
-    [self resetNextDisappearanceTimer];
+    // Don't fire when inactive or not in main app.
+    [self.expirationScheduler setIsEnabled:NO];
 }
 
 @end
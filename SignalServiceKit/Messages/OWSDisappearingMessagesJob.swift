@@ -75,21 +75,49 @@ extension OWSDisappearingMessagesJob {
             owsFailDebug("Couldn't delete expired messages/stories: \(error)")
         }
 
-        let nextExpirationAt = databaseStorage.read { tx in
-            return [
-                DisappearingMessagesFinder().nextExpirationTimestamp(transaction: tx),
-                StoryManager.nextExpirationTimestamp(transaction: tx)
-            ].compacted().min()
-        }
-        if let nextExpirationAt {
-            scheduleRun(byTimestamp: nextExpirationAt)
+        if expirationScheduler.needsSeed {
+            reseedExpirations()
         }
 
         return deletedCount
     }
 
+    /// Loads upcoming expirations from the database into `expirationScheduler`.
+    /// Later expirations are scheduled as messages start expiring, so this
+    /// only needs to happen at launch, when becoming active (other processes
+    /// may have started expirations) or if we had too many to load at once.
+    @objc
+    func reseedExpirations() {
+        let maxSeedCount = DisappearingMessagesExpirationScheduler.maxSeedCount
+        let (messageExpirations, storyExpiration) = databaseStorage.read { tx in
+            return (
+                DisappearingMessagesFinder().upcomingExpirationTimestamps(limit: maxSeedCount, transaction: tx),
+                StoryManager.nextExpirationTimestamp(transaction: tx)
+            )
+        }
+        var expirationTimestamps = messageExpirations
+        let isComplete = messageExpirations.count < maxSeedCount
+        if let storyExpiration, isComplete || storyExpiration <= (messageExpirations.last ?? 0) {
+            // Keep the timestamps sorted and within the loaded horizon.
+            expirationTimestamps.append(storyExpiration)
+            expirationTimestamps.sort()
+        }
+        expirationScheduler.seed(
+            expirationTimestamps: expirationTimestamps.map { NSNumber(value: $0) },
+            isComplete: isComplete
+        )
+    }
+
     @objc
     func cleanUpMessagesWhichFailedToStartExpiringWithSneakyTransaction() {
+        // This runs on every launch and there's almost never anything to fix,
+        // so check with a read before contending for the write lock.
+        let hasMessagesToFix = databaseStorage.read { tx in
+            !DisappearingMessagesFinder().fetchAllMessageUniqueIdsWhichFailedToStartExpiring(tx: tx).isEmpty
+        }
+        guard hasMessagesToFix else {
+            return
+        }
         databaseStorage.write { tx in
             let messageIds = DisappearingMessagesFinder().fetchAllMessageUniqueIdsWhichFailedToStartExpiring(tx: tx)
             for messageId in messageIds {
@@ -524,10 +524,13 @@ public class OWSMessageDecrypter: Dependencies {
         }
     }
 
+    /// - Parameter unsealedMessage: The envelope's content, already unsealed
+    ///   by `SMKSecretSessionCipher.unsealMessage`, if available.
     func decryptUnidentifiedSenderEnvelope(
         _ validatedEnvelope: ValidatedIncomingEnvelope,
         localIdentifiers: LocalIdentifiers,
         localDeviceId: UInt32,
+        unsealedMessage: SMKUnsealedMessage? = nil,
         tx transaction: SDSAnyWriteTransaction
     ) throws -> DecryptedIncomingEnvelope {
         let localIdentity = validatedEnvelope.localIdentity
@@ -554,6 +557,7 @@ public class OWSMessageDecrypter: Dependencies {
                 timestamp: validatedEnvelope.serverTimestamp,
                 localIdentifiers: localIdentifiers,
                 localDeviceId: localDeviceId,
+                unsealedMessage: unsealedMessage,
                 protocolContext: transaction
             )
         } catch let outerError as SecretSessionKnownSenderError {
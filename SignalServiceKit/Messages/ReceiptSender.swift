@@ -51,6 +51,7 @@ public class ReceiptSender: NSObject {
     private var observers = [NSObjectProtocol]()
     private let pendingTasks = PendingTasks(label: #fileID)
     private let sendingState: AtomicValue<SendingState>
+    private let collectionWindow = AtomicOptional<Task<Void, Never>>(nil, lock: .init())
 
     public init(kvStoreFactory: KeyValueStoreFactory, recipientDatabaseTable: any RecipientDatabaseTable) {
         self.recipientDatabaseTable = recipientDatabaseTable
@@ -70,6 +71,13 @@ public class ReceiptSender: NSObject {
             using: { [weak self] _ in self?.sendPendingReceiptsIfNeeded(pendingTask: nil) }
         ))
 
+        observers.append(NotificationCenter.default.addObserver(
+            forName: .OWSApplicationDidEnterBackground,
+            object: nil,
+            queue: nil,
+            using: { [weak self] _ in self?.flushPendingReceipts() }
+        ))
+
         observers.append(NotificationCenter.default.addObserver(
             forName: SSKReachability.owsReachabilityDidChange,
             object: self,
@@ -158,11 +166,20 @@ public class ReceiptSender: NSObject {
         persistedSet.insert(timestamp: timestamp, messageUniqueId: messageUniqueId)
         storeReceiptSet(persistedSet, receiptType: receiptType, aci: aci, tx: tx.asV2Write)
         tx.addAsyncCompletionOffMain {
-            self.sendingState.update { $0.mightHavePendingReceipts = true }
+            let shouldFlush = self.sendingState.update { $0.didEnqueueReceipt() }
+            if shouldFlush {
+                self.collectionWindow.get()?.cancel()
+            }
             self.sendPendingReceiptsIfNeeded(pendingTask: pendingTask)
         }
     }
 
+    /// Sends any receipts that are waiting for the collection window to close.
+    func flushPendingReceipts() {
+        sendingState.update { $0.isFlushRequested = true }
+        collectionWindow.get()?.cancel()
+    }
+
     // MARK: - Processing
 
     struct SendingState {
@@ -174,6 +191,25 @@ public class ReceiptSender: NSObject {
         /// sent when the app launches.
         var mightHavePendingReceipts = true
 
+        /// The number of receipts enqueued since the last pass started.
+        var enqueuedReceiptCount = 0
+
+        /// Whether the pending receipts should be sent without waiting for the
+        /// collection window to close.
+        var isFlushRequested = false
+
+        /// Returns true if enough receipts have piled up that we shouldn't wait
+        /// for the rest of the collection window.
+        mutating func didEnqueueReceipt() -> Bool {
+            mightHavePendingReceipts = true
+            enqueuedReceiptCount += 1
+            return enqueuedReceiptCount >= ReceiptSender.maxEnqueuedReceiptCount
+        }
+
+        var shouldSkipCollectionWindow: Bool {
+            isFlushRequested || enqueuedReceiptCount >= ReceiptSender.maxEnqueuedReceiptCount
+        }
+
         mutating func startIfPossible() -> Bool {
             guard mightHavePendingReceipts, !inProgress else {
                 return false
@@ -182,14 +218,27 @@ public class ReceiptSender: NSObject {
             inProgress = true
             return true
         }
+
+        mutating func didCloseCollectionWindow() {
+            enqueuedReceiptCount = 0
+            isFlushRequested = false
+        }
     }
 
+    /// When receipts start arriving after a quiet period (e.g. the user starts
+    /// scrolling through a busy group), wait this long for more so they can go
+    /// out as one message per sender rather than one message per receipt.
+    static let collectionWindowNanoseconds: UInt64 = 500 * NSEC_PER_MSEC
+
+    /// Stop waiting for more receipts once this many are enqueued.
+    static let maxEnqueuedReceiptCount = 100
+
     /// Schedules a processing pass, unless one is already scheduled.
     func sendPendingReceiptsIfNeeded(pendingTask: PendingTask?) {
-        Task { await self._sendPendingReceiptsIfNeeded(pendingTask: pendingTask) }
+        Task { await self._sendPendingReceiptsIfNeeded(pendingTask: pendingTask, isFollowUpPass: false) }
     }
 
-    private func _sendPendingReceiptsIfNeeded(pendingTask: PendingTask?) async {
+    private func _sendPendingReceiptsIfNeeded(pendingTask: PendingTask?, isFollowUpPass: Bool) async {
         do {
             defer { pendingTask?.complete() }
 
@@ -199,6 +248,12 @@ public class ReceiptSender: NSObject {
             guard sendingState.update(block: { $0.startIfPossible() }) else {
                 return
             }
+            // Follow-up passes have already waited (below) for a batch to
+            // accumulate.
+            if !isFollowUpPass {
+                await waitForCollectionWindow()
+            }
+            sendingState.update { $0.didCloseCollectionWindow() }
             try? await sendPendingReceipts()
         }
 
@@ -209,7 +264,20 @@ public class ReceiptSender: NSObject {
         // receipts without being so high that the user notices.
         try? await Task.sleep(nanoseconds: 3 * NSEC_PER_SEC)
         sendingState.update(block: { $0.inProgress = false })
-        await _sendPendingReceiptsIfNeeded(pendingTask: nil)
+        await _sendPendingReceiptsIfNeeded(pendingTask: nil, isFollowUpPass: true)
+    }
+
+    private func waitForCollectionWindow() async {
+        let windowTask = Task {
+            try? await Task.sleep(nanoseconds: Self.collectionWindowNanoseconds)
+        }
+        collectionWindow.set(windowTask)
+        // A flush may have been requested before we published the task.
+        if sendingState.get().shouldSkipCollectionWindow {
+            windowTask.cancel()
+        }
+        await windowTask.value
+        collectionWindow.set(nil)
     }
 
     private func sendPendingReceipts() async throws {
@@ -715,16 +715,31 @@ public class StickerManager: NSObject {
 
         return firstly {
             tryToDownloadSticker(stickerPack: stickerPack, stickerInfo: stickerInfo)
-        }.map(on: DispatchQueue.global()) { stickerUrl in
-            self.installSticker(
-                stickerInfo: stickerInfo,
-                stickerUrl: stickerUrl,
-                contentType: item.contentType,
-                emojiString: emojiString
-            )
+        }.then(on: DispatchQueue.global()) { stickerUrl -> Promise<Bool> in
+            let (promise, future) = Promise<Bool>.pending()
+            self.stickerInstallQueue.addOperation {
+                future.resolve(self.installSticker(
+                    stickerInfo: stickerInfo,
+                    stickerUrl: stickerUrl,
+                    contentType: item.contentType,
+                    emojiString: emojiString
+                ))
+            }
+            return promise
         }
     }
 
+    /// Installs the stickers of a pack a few at a time as their downloads
+    /// finish, rather than starting a file copy and a write transaction for
+    /// every sticker in the pack at once.
+    private static let stickerInstallQueue: OperationQueue = {
+        let operationQueue = OperationQueue()
+        operationQueue.name = "StickerManager.install"
+        operationQueue.qualityOfService = .utility
+        operationQueue.maxConcurrentOperationCount = 4
+        return operationQueue
+    }()
+
     private struct StickerDownload {
         let promise: Promise<URL>
         let future: Future<URL>
@@ -149,7 +149,7 @@ public class OnboardingStoryManagerStoryMessageFactoryMock: OnboardingStoryManag
             let renderingFlag: AttachmentReference.RenderingFlag = .default
             let sourceFilename: String?
             let validatedContentType: Attachment.ContentType = .file
-            let orphanRecordId: OrphanedAttachmentRecord.IDType = 1
+            let orphanRecordId: OrphanedAttachmentRecord.IDType? = 1
         }
 
         return AttachmentDataSource.pendingAttachment(FakePendingAttachment(
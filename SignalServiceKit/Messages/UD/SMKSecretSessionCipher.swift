@@ -50,6 +50,18 @@ public struct SMKDecryptResult {
     let messageType: SMKMessageType
 }
 
+/// A sealed sender message with its outer layer removed and its sender
+/// certificate validated.
+///
+/// Unsealing needs only our identity key pair, not any session state, so
+/// it can be done ahead of (and concurrently with) decrypting the inner
+/// message. Pass the result to `decryptMessage` to skip those steps.
+public struct SMKUnsealedMessage {
+    fileprivate let cipherTextData: Data
+    fileprivate let timestamp: UInt64
+    fileprivate let messageContent: UnidentifiedSenderMessageContent
+}
+
 // MARK: -
 
 fileprivate extension ProtocolAddress {
@@ -169,12 +181,37 @@ public class SMKSecretSessionCipher: NSObject {
 
     // public Pair<SignalProtocolAddress, byte[]> decrypt(CertificateValidator validator, byte[] ciphertext, long timestamp)
     //    throws InvalidMetadataMessageException, InvalidMetadataVersionException, ProtocolInvalidMessageException, ProtocolInvalidKeyException, ProtocolNoSessionException, ProtocolLegacyMessageException, ProtocolInvalidVersionException, ProtocolDuplicateMessageException, ProtocolInvalidKeyIdException, ProtocolUntrustedIdentityException
+    /// Removes the outer layer of a sealed sender message and validates its
+    /// sender certificate; see `SMKUnsealedMessage`.
+    ///
+    /// This doesn't check for self-sent messages; `decryptMessage` does.
+    public static func unsealMessage(
+        trustRoot: PublicKey,
+        cipherTextData: Data,
+        timestamp: UInt64,
+        identityKeyPair: IdentityKeyPair
+    ) throws -> SMKUnsealedMessage {
+        let identityStore = InMemorySignalProtocolStore(identity: identityKeyPair, registrationId: 0)
+        let messageContent = try UnidentifiedSenderMessageContent(
+            message: cipherTextData,
+            identityStore: identityStore,
+            context: NullContext()
+        )
+        guard try messageContent.senderCertificate.validate(trustRoot: trustRoot, time: timestamp) else {
+            throw SMKSecretSessionCipherError.invalidCertificate
+        }
+        return SMKUnsealedMessage(cipherTextData: cipherTextData, timestamp: timestamp, messageContent: messageContent)
+    }
+
+    /// - Parameter unsealedMessage: The result of `unsealMessage` for this
+    ///   message, if it's already been unsealed.
     public func decryptMessage(
         trustRoot: PublicKey,
         cipherTextData: Data,
         timestamp: UInt64,
         localIdentifiers: LocalIdentifiers,
         localDeviceId: UInt32,
+        unsealedMessage: SMKUnsealedMessage? = nil,
         protocolContext: StoreContext?
     ) throws -> SMKDecryptResult {
         guard timestamp > 0 else {
@@ -183,9 +220,21 @@ public class SMKSecretSessionCipher: NSObject {
 
         // Allow nil contexts for testing.
         let context = protocolContext ?? NullContext()
-        let messageContent = try UnidentifiedSenderMessageContent(message: cipherTextData,
+        let messageContent: UnidentifiedSenderMessageContent
+        let isCertificateValidated: Bool
+        if
+            let unsealedMessage,
+            unsealedMessage.timestamp == timestamp,
+            unsealedMessage.cipherTextData == cipherTextData
+        {
+            messageContent = unsealedMessage.messageContent
+            isCertificateValidated = true
+        } else {
+            messageContent = try UnidentifiedSenderMessageContent(message: cipherTextData,
                                                                   identityStore: currentIdentityStore,
                                                                   context: context)
+            isCertificateValidated = false
+        }
 
         let sender = messageContent.senderCertificate.sender
 
@@ -204,7 +253,7 @@ public class SMKSecretSessionCipher: NSObject {
 
         do {
             // validator.validate(content.getSenderCertificate(), timestamp);
-            guard try messageContent.senderCertificate.validate(trustRoot: trustRoot, time: timestamp) else {
+            guard try isCertificateValidated || messageContent.senderCertificate.validate(trustRoot: trustRoot, time: timestamp) else {
                 throw SMKSecretSessionCipherError.invalidCertificate
             }
 
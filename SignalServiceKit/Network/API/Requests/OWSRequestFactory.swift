@@ -144,6 +144,7 @@ public enum OWSRequestFactory {
         ]
 
         let request = TSRequest(url: URL(string: path)!, method: "PUT", parameters: parameters)
+        request.priority = messageRequestPriority(isOnline: isOnline, isUrgent: isUrgent)
         if let udAccessKey {
             useUDAuth(request: request, accessKey: udAccessKey)
         }
@@ -164,12 +165,23 @@ public enum OWSRequestFactory {
         ]
 
         let request = TSRequest(url: components.url!, method: "PUT", parameters: nil)
+        request.priority = messageRequestPriority(isOnline: isOnline, isUrgent: isUrgent)
         request.setValue("application/vnd.signal-messenger.mrm", forHTTPHeaderField: "Content-Type")
         useUDAuth(request: request, accessKey: accessKey)
         request.httpBody = ciphertext
         return request
     }
 
+    private static func messageRequestPriority(isOnline: Bool, isUrgent: Bool) -> ChatRequestPriority {
+        if isUrgent {
+            return .high
+        }
+        // Online messages (typing indicators) are only worth sending if they
+        // arrive promptly, so they shouldn't hold up anything else.
+        // Receipts and most sync messages aren't urgent either.
+        return isOnline ? .low : .default
+    }
+
     // MARK: - Registration
 
     static func disable2FARequest() -> TSRequest {
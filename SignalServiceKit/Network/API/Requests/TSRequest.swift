@@ -19,6 +19,10 @@ public class TSRequest: NSMutableURLRequest {
     /// during the processing for individual requests.
     public var shouldCheckDeregisteredOn401: Bool = false
 
+    /// When sent over a chat connection, requests with a higher priority are
+    /// started ahead of those with a lower one. See `ChatRequestScheduler`.
+    public var priority: ChatRequestPriority = .default
+
     public let parameters: [String: Any]
 
     public init(url: URL) {
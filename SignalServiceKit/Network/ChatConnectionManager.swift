@@ -13,6 +13,9 @@ public protocol ChatConnectionManager {
 
     func canMakeRequests(connectionType: OWSChatConnectionType) -> Bool
     func makeRequest(_ request: TSRequest) async throws -> HTTPResponse
+    /// Whether a request of `priority` would have to wait for others to
+    /// finish on any connection. Bulk work should hold off while it does.
+    func hasRequestBackpressure(priority: ChatRequestPriority) -> Bool
 
     func didReceivePush()
 }
@@ -89,8 +92,12 @@ public class ChatConnectionManagerImpl: ChatConnectionManager {
             // Proceed even though we will probably fail.
             return
         }
-        // After 30 seconds, we try anyways. We'll probably fail.
-        let maxWaitInterval = 30 * kSecondInterval
+        // After 30 seconds (or when the caller's deadline passes, if sooner), we
+        // try anyways. We'll probably fail.
+        var maxWaitInterval = 30 * kSecondInterval
+        if let deadline = WorkDeadline.current {
+            maxWaitInterval = min(maxWaitInterval, deadline.remainingInterval)
+        }
         _ = try? await withCooperativeTimeout(
             seconds: maxWaitInterval,
             operation: { try await connection.waitForOpen() }
@@ -133,6 +140,11 @@ public class ChatConnectionManagerImpl: ChatConnectionManager {
         return try await connection(ofType: connectionType).makeRequest(request, unsubmittedRequestToken: unsubmittedRequestToken)
     }
 
+    // This method can be called from any thread.
+    public func hasRequestBackpressure(priority: ChatRequestPriority) -> Bool {
+        return connections.contains { $0.requestScheduler.hasBackpressure(priority: priority) }
+    }
+
     // This method can be called from any thread.
     public func didReceivePush() {
         for connection in connections {
@@ -214,6 +226,12 @@ public class ChatConnectionManagerMock: ChatConnectionManager {
         return try await requestHandler(request)
     }
 
+    public var requestBackpressure = [ChatRequestPriority: Bool]()
+
+    public func hasRequestBackpressure(priority: ChatRequestPriority) -> Bool {
+        return requestBackpressure[priority] ?? false
+    }
+
     public func didReceivePush() {
         // Do nothing
     }
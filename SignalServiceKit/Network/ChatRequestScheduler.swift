@@ -0,0 +1,174 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// How urgently a request made over a chat connection should be sent,
+/// relative to the other requests on the connection.
+public enum ChatRequestPriority: Int, CaseIterable, CustomStringConvertible {
+    /// Bulk work the user isn't waiting on, e.g. opportunistic profile
+    /// fetches and sync traffic.
+    case low
+    case `default`
+    /// Work the user is waiting on, e.g. urgent message sends.
+    case high
+
+    public var description: String {
+        switch self {
+        case .low: return "low"
+        case .default: return "default"
+        case .high: return "high"
+        }
+    }
+}
+
+/// Limits how many requests are in flight on a chat connection.
+///
+/// Each priority has its own limit, and all of them share an overall limit.
+/// When a request finishes, waiting requests are started highest priority
+/// first (and in order within a priority). The lower priorities' limits add
+/// up to less than the overall limit, so some slots are always left for
+/// high priority requests, however much bulk work is queued.
+///
+/// Callers doing bulk work can check `hasBackpressure(priority:)` to hold
+/// off instead of queuing more requests behind those already waiting.
+///
+/// This class is thread-safe.
+public final class ChatRequestScheduler {
+
+    public struct Limits {
+        public let maxInFlightCount: Int
+        public let maxInFlightCountPerPriority: [ChatRequestPriority: Int]
+
+        public init(maxInFlightCount: Int, maxInFlightCountPerPriority: [ChatRequestPriority: Int]) {
+            self.maxInFlightCount = maxInFlightCount
+            self.maxInFlightCountPerPriority = maxInFlightCountPerPriority
+        }
+
+        public static let `default` = Limits(
+            maxInFlightCount: 24,
+            maxInFlightCountPerPriority: [.low: 4, .default: 16, .high: 24]
+        )
+
+        fileprivate func maxInFlightCount(priority: ChatRequestPriority) -> Int {
+            return min(maxInFlightCount, maxInFlightCountPerPriority[priority] ?? maxInFlightCount)
+        }
+    }
+
+    /// Held by a request from when it's started until it finishes.
+    public struct Slot {
+        public let priority: ChatRequestPriority
+        /// How long the request waited to be started, in nanoseconds.
+        public let queueDuration: UInt64
+    }
+
+    /// Cumulative timings for the requests of one priority.
+    public struct Stats: Equatable {
+        public var requestCount: Int = 0
+        /// In nanoseconds.
+        public var totalQueueDuration: UInt64 = 0
+        public var maxQueueDuration: UInt64 = 0
+        /// In nanoseconds, time from being started until a response (or failure).
+        public var totalRoundTripDuration: UInt64 = 0
+        public var maxRoundTripDuration: UInt64 = 0
+    }
+
+    private struct Waiter {
+        let enqueueDate: MonotonicDate
+        let continuation: CheckedContinuation<Slot, Never>
+    }
+
+    private struct State {
+        var inFlightCount = 0
+        var inFlightCounts = [ChatRequestPriority: Int]()
+        var waiters = [ChatRequestPriority: [Waiter]]()
+        var stats = [ChatRequestPriority: Stats]()
+    }
+
+    private let limits: Limits
+    private let state = AtomicValue(State(), lock: UnfairLock())
+
+    public init(limits: Limits = .default) {
+        self.limits = limits
+    }
+
+    /// Waits until a request of `priority` can be started.
+    ///
+    /// You must call `releaseSlot(_:roundTripDuration:)` once the request
+    /// finishes, however it finishes.
+    public func waitForSlot(priority: ChatRequestPriority) async -> Slot {
+        let enqueueDate = MonotonicDate()
+        return await withCheckedContinuation { continuation in
+            let startedWaiters = state.update { state in
+                state.waiters[priority, default: []].append(Waiter(enqueueDate: enqueueDate, continuation: continuation))
+                return startWaiters(state: &state)
+            }
+            startedWaiters.forEach { $0() }
+        }
+    }
+
+    public func releaseSlot(_ slot: Slot, roundTripDuration: UInt64) {
+        let startedWaiters = state.update { state in
+            state.inFlightCount -= 1
+            state.inFlightCounts[slot.priority, default: 0] -= 1
+            owsAssertDebug(state.inFlightCount >= 0)
+
+            var stats = state.stats[slot.priority, default: Stats()]
+            stats.requestCount += 1
+            stats.totalQueueDuration += slot.queueDuration
+            stats.maxQueueDuration = max(stats.maxQueueDuration, slot.queueDuration)
+            stats.totalRoundTripDuration += roundTripDuration
+            stats.maxRoundTripDuration = max(stats.maxRoundTripDuration, roundTripDuration)
+            state.stats[slot.priority] = stats
+
+            return startWaiters(state: &state)
+        }
+        startedWaiters.forEach { $0() }
+    }
+
+    /// Whether a request of `priority` made now would have to wait.
+    public func hasBackpressure(priority: ChatRequestPriority) -> Bool {
+        return state.update { state in
+            return (
+                !(state.waiters[priority]?.isEmpty ?? true)
+                || state.inFlightCount >= limits.maxInFlightCount
+                || state.inFlightCounts[priority, default: 0] >= limits.maxInFlightCount(priority: priority)
+            )
+        }
+    }
+
+    /// How many requests of `priority` are waiting to be started.
+    public func queuedRequestCount(priority: ChatRequestPriority) -> Int {
+        return state.update { $0.waiters[priority]?.count ?? 0 }
+    }
+
+    public func stats(priority: ChatRequestPriority) -> Stats {
+        return state.update { $0.stats[priority, default: Stats()] }
+    }
+
+    /// Takes as many waiters as can be started, highest priority first.
+    ///
+    /// - Returns: Blocks that resume the started waiters, to be called once
+    ///   the lock is released.
+    private func startWaiters(state: inout State) -> [() -> Void] {
+        let now = MonotonicDate()
+        var result = [() -> Void]()
+        for priority in ChatRequestPriority.allCases.reversed() {
+            let maxInFlightCount = limits.maxInFlightCount(priority: priority)
+            while
+                state.inFlightCount < limits.maxInFlightCount,
+                state.inFlightCounts[priority, default: 0] < maxInFlightCount,
+                let waiter = state.waiters[priority]?.first
+            {
+                state.waiters[priority]!.removeFirst()
+                state.inFlightCount += 1
+                state.inFlightCounts[priority, default: 0] += 1
+                let slot = Slot(priority: priority, queueDuration: now - waiter.enqueueDate)
+                result.append { waiter.continuation.resume(returning: slot) }
+            }
+        }
+        return result
+    }
+}
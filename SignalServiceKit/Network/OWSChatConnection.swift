@@ -61,6 +61,9 @@ public class OWSChatConnection: NSObject {
     fileprivate let appExpiry: AppExpiry
     fileprivate let db: DB
 
+    /// Decides the order requests are sent in, and how many are in flight.
+    public let requestScheduler = ChatRequestScheduler()
+
     fileprivate static func label(forRequest request: TSRequest,
                                   connectionType: OWSChatConnectionType,
                                   requestInfo: RequestInfo?) -> String {
@@ -544,6 +547,12 @@ public class OWSChatConnection: NSObject {
         let isIdentifiedRequest = request.shouldHaveAuthorizationHeaders && !request.isUDRequest
         owsAssertDebug(isIdentifiedConnection == isIdentifiedRequest)
 
+        let slot = await requestScheduler.waitForSlot(priority: request.priority)
+        let sendDate = MonotonicDate()
+        defer {
+            requestScheduler.releaseSlot(slot, roundTripDuration: MonotonicDate() - sendDate)
+        }
+
         let (response, requestInfo) = try await withCheckedThrowingContinuation { continuation in
             self.serialQueue.async {
                 self.makeRequestInternal(
@@ -556,7 +565,9 @@ public class OWSChatConnection: NSObject {
         }
 
         let label = Self.label(forRequest: request, connectionType: connectionType, requestInfo: requestInfo)
-        Logger.info("\(label): Request Succeeded (\(response.responseStatusCode))")
+        let queueMs = slot.queueDuration / NSEC_PER_MSEC
+        let roundTripMs = (MonotonicDate() - sendDate) / NSEC_PER_MSEC
+        Logger.info("\(label): Request Succeeded (\(response.responseStatusCode)), priority: \(slot.priority), queued: \(queueMs)ms, round trip: \(roundTripMs)ms")
 
         Self.outageDetection.reportConnectionSuccess()
         return response
@@ -173,7 +173,10 @@ public class OWSSignalService: OWSSignalServiceProtocol, Dependencies {
             endpoint: endpoint,
             configuration: configuration ?? OWSURLSession.defaultConfigurationWithoutCaching,
             maxResponseSize: maxResponseSize,
-            canUseSignalProxy: endpoint.frontingInfo == nil
+            canUseSignalProxy: endpoint.frontingInfo == nil,
+            // Sessions with the default configuration are interchangeable, so
+            // they can share connections to the same host.
+            sharesConnections: configuration == nil
         )
         urlSession.shouldHandleRemoteDeprecation = signalServiceInfo.shouldHandleRemoteDeprecation
         return urlSession
@@ -90,6 +90,16 @@ public extension OWSSignalServiceProtocol {
     func urlSessionForUpdates2() -> OWSURLSessionProtocol {
         buildUrlSession(for: .updates2)
     }
+
+    /// Opens a connection to `signalServiceType`'s host ahead of a request
+    /// that's expected soon. See `OWSURLSession.prewarmConnection()`.
+    func prewarmConnection(for signalServiceType: SignalServiceType) {
+        (buildUrlSession(for: signalServiceType) as? OWSURLSession)?.prewarmConnection()
+    }
+
+    func prewarmConnectionForCdn(cdnNumber: UInt32) {
+        prewarmConnection(for: SignalServiceType.type(forCdnNumber: cdnNumber))
+    }
 }
 
 // MARK: - Service type mapping
@@ -0,0 +1,343 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// Shares `URLSession`s between `OWSURLSession`s that talk to the same host.
+///
+/// Callers build a fresh `OWSURLSession` for almost every request, and a
+/// `URLSession` never reuses another session's connections, so without this
+/// nearly every request to a CDN or the storage service paid for DNS, TCP
+/// and TLS setup. Sessions are keyed by host and pinned certificates; the
+/// shared `URLSession` is never invalidated.
+final class OWSURLSessionConnectionPool {
+
+    static let shared = OWSURLSessionConnectionPool()
+
+    private struct Key: Hashable {
+        let scheme: String?
+        let host: String
+        let port: Int?
+        let pinnedCertificates: Set<Data>
+    }
+
+    private let sessions = AtomicValue<[Key: SharedURLSession]>([:], lock: UnfairLock())
+
+    /// Returns nil if `endpoint` can't share connections, e.g. because it
+    /// has no base URL.
+    ///
+    /// The first caller's `configuration` is used for the shared session, so
+    /// only callers that all use the same configuration should share.
+    func sharedSession(for endpoint: OWSURLSessionEndpoint, configuration: URLSessionConfiguration) -> SharedURLSession? {
+        guard let baseUrl = endpoint.baseUrl, let host = baseUrl.host else {
+            return nil
+        }
+        let key = Key(
+            scheme: baseUrl.scheme,
+            host: host,
+            port: baseUrl.port,
+            pinnedCertificates: endpoint.securityPolicy.pinnedCertificates
+        )
+        return sessions.update { sessions in
+            if let session = sessions[key] {
+                return session
+            }
+            let session = SharedURLSession(configuration: configuration, securityPolicy: endpoint.securityPolicy)
+            sessions[key] = session
+            return session
+        }
+    }
+}
+
+// MARK: -
+
+/// A `URLSession` used by many `OWSURLSession`s, which routes each task's
+/// delegate callbacks to the `OWSURLSession` that started it.
+///
+/// Each `OWSURLSession` is retained while it has outstanding tasks, as it
+/// would be by its own `URLSession`.
+final class SharedURLSession: NSObject {
+
+    private static let operationQueue: OperationQueue = {
+        let queue = OperationQueue()
+        queue.underlyingQueue = .global()
+        return queue
+    }()
+
+    /// All sessions sharing this one have the same pinned certificates, so
+    /// any of their policies would reach the same decision.
+    private let securityPolicy: OWSHTTPSecurityPolicy
+
+    private(set) var urlSession: URLSession!
+
+    private let owners = AtomicDictionary<OWSURLSession.TaskIdentifier, OWSURLSession>(lock: UnfairLock())
+
+    /// Idle connections are closed after a while; a task started more
+    /// recently than this has probably left one open.
+    private static let prewarmInterval: TimeInterval = 30
+
+    private let lastTaskDate = AtomicValue<MonotonicDate>(.distantPast, lock: UnfairLock())
+
+    fileprivate init(configuration: URLSessionConfiguration, securityPolicy: OWSHTTPSecurityPolicy) {
+        self.securityPolicy = securityPolicy
+        super.init()
+        self.urlSession = URLSession(configuration: configuration, delegate: self, delegateQueue: Self.operationQueue)
+    }
+
+    func addTask(_ task: URLSessionTask, owner: OWSURLSession) {
+        owners[task.taskIdentifier] = owner
+        lastTaskDate.set(MonotonicDate())
+    }
+
+    /// Whether a prewarming request should be made, i.e. whether no task
+    /// has been started recently. If so, counts as starting a task.
+    func needsPrewarm() -> Bool {
+        let now = MonotonicDate()
+        return lastTaskDate.update { lastTaskDate in
+            guard lastTaskDate.adding(Self.prewarmInterval) < now else {
+                return false
+            }
+            lastTaskDate = now
+            return true
+        }
+    }
+
+    func removeTask(_ task: URLSessionTask) {
+        owners.removeValue(forKey: task.taskIdentifier)
+    }
+
+    private func owner(for task: URLSessionTask) -> OWSURLSession? {
+        return owners[task.taskIdentifier]
+    }
+}
+
+extension SharedURLSession: URLSessionDelegate, URLSessionTaskDelegate, URLSessionDownloadDelegate, URLSessionDataDelegate {
+
+    func urlSession(
+        _ session: URLSession,
+        didReceive challenge: URLAuthenticationChallenge,
+        completionHandler: @escaping OWSURLSession.URLAuthenticationChallengeCompletion
+    ) {
+        OWSURLSession.handleAuthenticationChallenge(
+            challenge,
+            securityPolicy: securityPolicy,
+            completionHandler: completionHandler
+        )
+    }
+
+    func urlSession(
+        _ session: URLSession,
+        task: URLSessionTask,
+        didReceive challenge: URLAuthenticationChallenge,
+        completionHandler: @escaping OWSURLSession.URLAuthenticationChallengeCompletion
+    ) {
+        OWSURLSession.handleAuthenticationChallenge(
+            challenge,
+            securityPolicy: securityPolicy,
+            completionHandler: completionHandler
+        )
+    }
+
+    func urlSession(_ session: URLSession, task: URLSessionTask, didFinishCollecting metrics: URLSessionTaskMetrics) {
+        OWSURLSessionConnectionStats.record(metrics)
+    }
+
+    func urlSession(_ session: URLSession, task: URLSessionTask, didCompleteWithError error: Error?) {
+        owner(for: task)?.urlSession(session, task: task, didCompleteWithError: error)
+        removeTask(task)
+    }
+
+    func urlSession(
+        _ session: URLSession,
+        task: URLSessionTask,
+        willPerformHTTPRedirection response: HTTPURLResponse,
+        newRequest: URLRequest,
+        completionHandler: @escaping (URLRequest?) -> Void
+    ) {
+        guard let owner = owner(for: task) else {
+            completionHandler(nil)
+            return
+        }
+        owner.urlSession(
+            session,
+            task: task,
+            willPerformHTTPRedirection: response,
+            newRequest: newRequest,
+            completionHandler: completionHandler
+        )
+    }
+
+    func urlSession(
+        _ session: URLSession,
+        task: URLSessionTask,
+        didSendBodyData bytesSent: Int64,
+        totalBytesSent: Int64,
+        totalBytesExpectedToSend: Int64
+    ) {
+        owner(for: task)?.urlSession(
+            session,
+            task: task,
+            didSendBodyData: bytesSent,
+            totalBytesSent: totalBytesSent,
+            totalBytesExpectedToSend: totalBytesExpectedToSend
+        )
+    }
+
+    func urlSession(_ session: URLSession, downloadTask: URLSessionDownloadTask, didFinishDownloadingTo location: URL) {
+        owner(for: downloadTask)?.urlSession(session, downloadTask: downloadTask, didFinishDownloadingTo: location)
+    }
+
+    func urlSession(
+        _ session: URLSession,
+        downloadTask: URLSessionDownloadTask,
+        didWriteData bytesWritten: Int64,
+        totalBytesWritten: Int64,
+        totalBytesExpectedToWrite: Int64
+    ) {
+        owner(for: downloadTask)?.urlSession(
+            session,
+            downloadTask: downloadTask,
+            didWriteData: bytesWritten,
+            totalBytesWritten: totalBytesWritten,
+            totalBytesExpectedToWrite: totalBytesExpectedToWrite
+        )
+    }
+
+    func urlSession(
+        _ session: URLSession,
+        downloadTask: URLSessionDownloadTask,
+        didResumeAtOffset fileOffset: Int64,
+        expectedTotalBytes: Int64
+    ) {
+        owner(for: downloadTask)?.urlSession(
+            session,
+            downloadTask: downloadTask,
+            didResumeAtOffset: fileOffset,
+            expectedTotalBytes: expectedTotalBytes
+        )
+    }
+
+    func urlSession(
+        _ session: URLSession,
+        dataTask: URLSessionDataTask,
+        didReceive response: URLResponse,
+        completionHandler: @escaping (URLSession.ResponseDisposition) -> Void
+    ) {
+        guard let owner = owner(for: dataTask) else {
+            completionHandler(.cancel)
+            return
+        }
+        owner.urlSession(session, dataTask: dataTask, didReceive: response, completionHandler: completionHandler)
+    }
+
+    func urlSession(_ session: URLSession, dataTask: URLSessionDataTask, didReceive data: Data) {
+        owner(for: dataTask)?.urlSession(session, dataTask: dataTask, didReceive: data)
+    }
+}
+
+// MARK: -
+
+/// Connection setup timings, per host, from `URLSessionTaskMetrics`.
+public struct OWSURLSessionConnectionStats: Equatable {
+    public var requestCount: Int = 0
+    /// Requests sent on a connection that an earlier request opened.
+    public var reusedConnectionCount: Int = 0
+    /// Requests that had to open a connection; the totals below are over these.
+    public var newConnectionCount: Int = 0
+    /// In milliseconds.
+    public var totalDomainLookupDuration: UInt64 = 0
+    public var totalConnectDuration: UInt64 = 0
+    public var totalSecureConnectionDuration: UInt64 = 0
+    public var maxSecureConnectionDuration: UInt64 = 0
+
+    public var reusedConnectionRatio: Double {
+        guard requestCount > 0 else {
+            return 0
+        }
+        return Double(reusedConnectionCount) / Double(requestCount)
+    }
+
+    private static let statsByHost = AtomicValue<[String: OWSURLSessionConnectionStats]>([:], lock: UnfairLock())
+
+    public static func stats(host: String) -> OWSURLSessionConnectionStats {
+        return statsByHost.get()[host] ?? OWSURLSessionConnectionStats()
+    }
+
+    public static func allStats() -> [String: OWSURLSessionConnectionStats] {
+        return statsByHost.get()
+    }
+
+    static func record(_ metrics: URLSessionTaskMetrics) {
+        // Redirects add a transaction each; the last is the one that
+        // produced the response.
+        guard
+            let transaction = metrics.transactionMetrics.last(where: { $0.resourceFetchType == .networkLoad }),
+            let host = transaction.request.url?.host
+        else {
+            return
+        }
+        record(ConnectionMetrics(transaction), host: host)
+    }
+
+    struct ConnectionMetrics {
+        let isReusedConnection: Bool
+        /// In milliseconds.
+        let domainLookupDuration: UInt64?
+        let connectDuration: UInt64?
+        let secureConnectionDuration: UInt64?
+
+        init(
+            isReusedConnection: Bool,
+            domainLookupDuration: UInt64?,
+            connectDuration: UInt64?,
+            secureConnectionDuration: UInt64?
+        ) {
+            self.isReusedConnection = isReusedConnection
+            self.domainLookupDuration = domainLookupDuration
+            self.connectDuration = connectDuration
+            self.secureConnectionDuration = secureConnectionDuration
+        }
+
+        init(_ transaction: URLSessionTaskTransactionMetrics) {
+            func durationMs(_ start: Date?, _ end: Date?) -> UInt64? {
+                guard let start, let end, end >= start else {
+                    return nil
+                }
+                return UInt64(end.timeIntervalSince(start) * 1000)
+            }
+            self.init(
+                isReusedConnection: transaction.isReusedConnection,
+                domainLookupDuration: durationMs(transaction.domainLookupStartDate, transaction.domainLookupEndDate),
+                connectDuration: durationMs(transaction.connectStartDate, transaction.connectEndDate),
+                secureConnectionDuration: durationMs(transaction.secureConnectionStartDate, transaction.secureConnectionEndDate)
+            )
+        }
+    }
+
+    static func record(_ metrics: ConnectionMetrics, host: String) {
+        statsByHost.update { statsByHost in
+            var stats = statsByHost[host] ?? OWSURLSessionConnectionStats()
+            stats.add(metrics)
+            statsByHost[host] = stats
+        }
+        if !metrics.isReusedConnection {
+            let formatMs = { (value: UInt64?) in value.map { "\($0)ms" } ?? "n/a" }
+            Logger.info("Opened connection to \(host); dns: \(formatMs(metrics.domainLookupDuration)), connect: \(formatMs(metrics.connectDuration)), tls: \(formatMs(metrics.secureConnectionDuration))")
+        }
+    }
+
+    mutating func add(_ metrics: ConnectionMetrics) {
+        requestCount += 1
+        if metrics.isReusedConnection {
+            reusedConnectionCount += 1
+            return
+        }
+        newConnectionCount += 1
+        totalDomainLookupDuration += metrics.domainLookupDuration ?? 0
+        totalConnectDuration += metrics.connectDuration ?? 0
+        totalSecureConnectionDuration += metrics.secureConnectionDuration ?? 0
+        maxSecureConnectionDuration = max(maxSecureConnectionDuration, metrics.secureConnectionDuration ?? 0)
+    }
+}
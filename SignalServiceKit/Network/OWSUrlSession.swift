@@ -103,11 +103,31 @@ public class OWSURLSession: NSObject, OWSURLSessionProtocol {
 
     // MARK: Initializers
 
-    required public init(
+    required convenience public init(
         endpoint: OWSURLSessionEndpoint,
         configuration: URLSessionConfiguration,
         maxResponseSize: Int?,
         canUseSignalProxy: Bool
+    ) {
+        self.init(
+            endpoint: endpoint,
+            configuration: configuration,
+            maxResponseSize: maxResponseSize,
+            canUseSignalProxy: canUseSignalProxy,
+            sharesConnections: false
+        )
+    }
+
+    /// - Parameter sharesConnections: Whether to run tasks on a `URLSession`
+    ///   shared with other `OWSURLSession`s for the same host, so they can
+    ///   reuse its connections. Only pass true if all such sessions use the
+    ///   same `configuration`. Ignored while the Signal proxy is in use.
+    init(
+        endpoint: OWSURLSessionEndpoint,
+        configuration: URLSessionConfiguration,
+        maxResponseSize: Int?,
+        canUseSignalProxy: Bool,
+        sharesConnections: Bool
     ) {
         if canUseSignalProxy {
             configuration.connectionProxyDictionary = SignalProxy.connectionProxyDictionary
@@ -117,6 +137,11 @@ public class OWSURLSession: NSObject, OWSURLSessionProtocol {
         self.configuration = configuration
         self.maxResponseSize = maxResponseSize
         self.canUseSignalProxy = canUseSignalProxy
+        if sharesConnections, configuration.connectionProxyDictionary == nil {
+            self.sharedSession = OWSURLSessionConnectionPool.shared.sharedSession(for: endpoint, configuration: configuration)
+        } else {
+            self.sharedSession = nil
+        }
 
         super.init()
 
@@ -263,6 +288,31 @@ public class OWSURLSession: NSObject, OWSURLSessionProtocol {
         return task
     }
 
+    // MARK: - Prewarming
+
+    /// Opens a connection to the endpoint's host so that the next request to
+    /// it doesn't pay for DNS, TCP and TLS setup.
+    ///
+    /// Only sessions that share connections keep the connection around for
+    /// later requests, so this does nothing for other sessions. It also does
+    /// nothing if a request to the host was made recently.
+    func prewarmConnection() {
+        guard let sharedSession, sharedSession.needsPrewarm() else {
+            return
+        }
+        let request: URLRequest
+        do {
+            request = try endpoint.buildRequest("", method: .head)
+        } catch {
+            owsFailDebug("Couldn't build prewarm request: \(error)")
+            return
+        }
+        Logger.info("Prewarming connection to \(request.url?.host ?? "unknown host")")
+        dataTaskPromise(request: request, ignoreAppExpiry: true).catch(on: DispatchQueue.global()) { _ in
+            // Any response, even an error status, means the connection is open.
+        }
+    }
+
     // MARK: - Internal Implementation
 
     private static let operationQueue: OperationQueue = {
@@ -287,8 +337,13 @@ public class OWSURLSession: NSObject, OWSURLSessionProtocol {
 
     private let configuration: URLSessionConfiguration
 
+    private let sharedSession: SharedURLSession?
+
     private lazy var session: URLSession = {
-        URLSession(configuration: configuration, delegate: delegateBox, delegateQueue: Self.operationQueue)
+        if let sharedSession {
+            return sharedSession.urlSession
+        }
+        return URLSession(configuration: configuration, delegate: delegateBox, delegateQueue: Self.operationQueue)
     }()
 
     private let maxResponseSize: Int?
@@ -304,7 +359,11 @@ public class OWSURLSession: NSObject, OWSURLSessionProtocol {
         //
         // Even though there will be no reference cycle, underlying NSURLSession metadata
         // is malloced and kept around as a root leak.
-        session.invalidateAndCancel()
+        //
+        // Shared sessions live as long as the process and are never invalidated.
+        if sharedSession == nil {
+            session.invalidateAndCancel()
+        }
     }
 
     // MARK: Configuration
@@ -664,6 +723,7 @@ public class OWSURLSession: NSObject, OWSURLSessionProtocol {
             owsAssertDebug(self.taskStateMap[task.taskIdentifier] == nil)
             self.taskStateMap[task.taskIdentifier] = taskState
         }
+        sharedSession?.addTask(task, owner: self)
     }
 
     private func progressBlock(forTask task: URLSessionTask) -> ProgressBlock? {
@@ -685,7 +745,8 @@ public class OWSURLSession: NSObject, OWSURLSessionProtocol {
     }
 
     private func removeCompletedTaskState(_ task: URLSessionTask) -> TaskState? {
-        lock.withLock { () -> TaskState? in
+        defer { sharedSession?.removeTask(task) }
+        return lock.withLock { () -> TaskState? in
             guard let taskState = self.taskStateMap[task.taskIdentifier] else {
                 // This isn't necessarily an error or bug.
                 // A task might "succeed" after it "fails" in certain edge cases,
@@ -739,13 +800,25 @@ public class OWSURLSession: NSObject, OWSURLSessionProtocol {
     fileprivate func urlSession(
         didReceive challenge: URLAuthenticationChallenge,
         completionHandler: @escaping URLAuthenticationChallengeCompletion
+    ) {
+        Self.handleAuthenticationChallenge(
+            challenge,
+            securityPolicy: endpoint.securityPolicy,
+            completionHandler: completionHandler
+        )
+    }
+
+    static func handleAuthenticationChallenge(
+        _ challenge: URLAuthenticationChallenge,
+        securityPolicy: OWSHTTPSecurityPolicy,
+        completionHandler: @escaping URLAuthenticationChallengeCompletion
     ) {
         var disposition: URLSession.AuthChallengeDisposition = .performDefaultHandling
         var credential: URLCredential?
 
         if challenge.protectionSpace.authenticationMethod == NSURLAuthenticationMethodServerTrust,
            let serverTrust = challenge.protectionSpace.serverTrust {
-            if endpoint.securityPolicy.evaluateServerTrust(serverTrust, forDomain: challenge.protectionSpace.host) {
+            if securityPolicy.evaluateServerTrust(serverTrust, forDomain: challenge.protectionSpace.host) {
                 credential = URLCredential(trust: serverTrust)
                 disposition = .useCredential
             } else {
@@ -1175,6 +1248,10 @@ extension URLSessionDelegateBox: URLSessionDelegate, URLSessionTaskDelegate, URL
     func urlSession(_ session: URLSession, dataTask: URLSessionDataTask, didReceive data: Data) {
         weakDelegate?.urlSession(session, dataTask: dataTask, didReceive: data)
     }
+
+    func urlSession(_ session: URLSession, task: URLSessionTask, didFinishCollecting metrics: URLSessionTaskMetrics) {
+        OWSURLSessionConnectionStats.record(metrics)
+    }
 }
 
 extension URLSessionDelegateBox: URLSessionWebSocketDelegate {
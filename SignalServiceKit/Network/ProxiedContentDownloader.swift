@@ -299,7 +299,7 @@ public class ProxiedContentAssetRequest: NSObject {
         return true
     }
 
-    public func writeAssetToFile(downloadFolderPath: String) -> ProxiedContentAsset? {
+    public func writeAssetToFile(diskCache: LRUDiskCache) -> ProxiedContentAsset? {
 
         var assetData = Data()
         for segment in segments {
@@ -327,16 +327,15 @@ public class ProxiedContentAssetRequest: NSObject {
             return nil
         }
 
-        let fileExtension = assetDescription.fileExtension
-        let fileName = (NSUUID().uuidString as NSString).appendingPathExtension(fileExtension)!
-        let filePath = (downloadFolderPath as NSString).appendingPathComponent(fileName)
-
         do {
-            try assetData.write(to: NSURL.fileURL(withPath: filePath), options: .atomicWrite)
-            let asset = ProxiedContentAsset(assetDescription: assetDescription, filePath: filePath)
-            return asset
-        } catch let error as NSError {
-            owsFailDebug("file write failed: \(filePath), \(error)")
+            let fileUrl = try diskCache.store(
+                assetData,
+                key: (assetDescription.url as URL).absoluteString,
+                fileExtension: assetDescription.fileExtension
+            )
+            return ProxiedContentAsset(assetDescription: assetDescription, filePath: fileUrl.path)
+        } catch {
+            owsFailDebug("file write failed: \(error)")
             return nil
         }
     }
@@ -386,9 +385,9 @@ public class ProxiedContentAssetRequest: NSObject {
 
 // Represents a downloaded asset.
 //
-// The blob on disk is cleaned up when this instance is deallocated,
-// so consumers of this resource should retain a strong reference to
-// this instance as long as they are using the asset.
+// The blob on disk belongs to the downloader's disk cache, which doesn't
+// evict recently used assets; consumers that need the asset for longer
+// should copy it.
 @objc
 public class ProxiedContentAsset: NSObject {
 
@@ -403,19 +402,6 @@ public class ProxiedContentAsset: NSObject {
         self.assetDescription = assetDescription
         self.filePath = filePath
     }
-
-    deinit {
-        // Clean up on the asset on disk.
-        let filePathCopy = filePath
-        DispatchQueue.global().async {
-            do {
-                let fileManager = FileManager.default
-                try fileManager.removeItem(atPath: filePathCopy)
-            } catch let error as NSError {
-                owsFailDebug("file cleanup failed: \(filePathCopy), \(error)")
-            }
-        }
-    }
 }
 
 // MARK: -
@@ -452,19 +438,30 @@ open class ProxiedContentDownloader: NSObject, URLSessionTaskDelegate, URLSessio
 
     private let downloadFolderName: String
 
-    private var downloadFolderPath: String?
+    private let diskCache: LRUDiskCache
+
+    // Animated GIFs will usually be less than 3 MB.
+    private static let maxDiskCacheSize: Int64 = 150 * 1024 * 1024
 
     // Force usage as a singleton
     public init(downloadFolderName: String) {
         AssertIsOnMainThread()
 
         self.downloadFolderName = downloadFolderName
+        // In the shared container so that the share extension can use
+        // assets downloaded by the main app.
+        self.diskCache = LRUDiskCache(
+            directoryUrl: URL(fileURLWithPath: CurrentAppContext().appSharedDataDirectoryPath())
+                .appendingPathComponent("ProxiedContent", isDirectory: true)
+                .appendingPathComponent(downloadFolderName, isDirectory: true),
+            maxSize: Self.maxDiskCacheSize
+        )
 
         super.init()
 
         SwiftSingletons.register(self)
 
-        ensureDownloadFolder()
+        deleteLegacyDownloadFolder()
     }
 
     private lazy var downloadSession: URLSession = {
@@ -484,12 +481,7 @@ open class ProxiedContentDownloader: NSObject, URLSessionTaskDelegate, URLSessio
     }()
 
     // 100 entries of which at least half will probably be stills.
-    // Actual animated GIFs will usually be less than 3 MB so the
-    // max size of the cache on disk should be ~150 MB.  Bear in mind
-    // that assets are not always deleted on disk as soon as they are
-    // evacuated from the cache; if a cache consumer (e.g. view) is
-    // still using the asset, the asset won't be deleted on disk until
-    // it is no longer in use.
+    // Misses fall back to the disk cache, which holds many more.
     private var assetMap = LRUCache<NSURL, ProxiedContentAsset>(maxSize: 100)
     // TODO: We could use a proper queue, e.g. implemented with a linked
     // list.
@@ -562,11 +554,7 @@ open class ProxiedContentDownloader: NSObject, URLSessionTaskDelegate, URLSessio
 
         // Move write off main thread.
         DispatchQueue.global().async {
-            guard let downloadFolderPath = self.downloadFolderPath else {
-                owsFailDebug("Missing downloadFolderPath")
-                return
-            }
-            guard let asset = assetRequest.writeAssetToFile(downloadFolderPath: downloadFolderPath) else {
+            guard let asset = assetRequest.writeAssetToFile(diskCache: self.diskCache) else {
                 self.segmentRequestDidFail(assetRequest: assetRequest)
                 return
             }
@@ -638,13 +626,6 @@ open class ProxiedContentDownloader: NSObject, URLSessionTaskDelegate, URLSessio
             removeAssetRequestFromQueue(assetRequest: assetRequest)
             return
         }
-        guard CurrentAppContext().isMainAppAndActive else {
-            // If app is not active, fail the asset request.
-            assetRequest.state = .failed
-            assetRequestDidFail(assetRequest: assetRequest)
-            processRequestQueueSync()
-            return
-        }
 
         if let asset = assetMap.get(key: assetRequest.assetDescription.url) {
             // Deferred cache hit, avoids re-downloading assets that were
@@ -655,6 +636,29 @@ open class ProxiedContentDownloader: NSObject, URLSessionTaskDelegate, URLSessio
             return
         }
 
+        // Checked before the app state so that cached assets are available
+        // wherever the cache is.
+        if
+            assetRequest.state == .waiting,
+            let fileUrl = diskCache.cachedFileUrl(
+                key: (assetRequest.assetDescription.url as URL).absoluteString,
+                fileExtension: assetRequest.assetDescription.fileExtension
+            )
+        {
+            assetRequest.state = .complete
+            let asset = ProxiedContentAsset(assetDescription: assetRequest.assetDescription, filePath: fileUrl.path)
+            assetRequestDidSucceed(assetRequest: assetRequest, asset: asset)
+            return
+        }
+
+        guard CurrentAppContext().isMainAppAndActive else {
+            // If app is not active, fail the asset request.
+            assetRequest.state = .failed
+            assetRequestDidFail(assetRequest: assetRequest)
+            processRequestQueueSync()
+            return
+        }
+
         if assetRequest.state == .waiting {
             // If asset request hasn't yet determined the resource size,
             // try to do so now, by requesting a small initial segment.
@@ -800,6 +804,12 @@ open class ProxiedContentDownloader: NSObject, URLSessionTaskDelegate, URLSessio
         let kMaxAssetRequestCount: UInt = 3
         let kMaxAssetRequestsPerAssetCount: UInt = kMaxAssetRequestCount - 1
 
+        // A request for a URL that another request is already downloading
+        // waits for that download and then hits the cache.
+        let downloadingUrls = Set(assetRequestQueue.lazy.filter {
+            !$0.wasCancelled && ($0.state == .requestingSize || $0.state == .active)
+        }.map { $0.assetDescription.url })
+
         // Prefer the first "high" priority request;
         // fall back to the first "low" priority request.
         var activeAssetRequestsCount: UInt = 0
@@ -807,6 +817,9 @@ open class ProxiedContentDownloader: NSObject, URLSessionTaskDelegate, URLSessio
             for assetRequest in assetRequestQueue where assetRequest.priority == priority {
                 switch assetRequest.state {
                 case .waiting:
+                    guard !downloadingUrls.contains(assetRequest.assetDescription.url) else {
+                        continue
+                    }
                     // This asset request needs its content length.
                     return assetRequest
                 case .requestingSize:
@@ -917,33 +930,12 @@ open class ProxiedContentDownloader: NSObject, URLSessionTaskDelegate, URLSessio
 
     // MARK: Temp Directory
 
-    public func ensureDownloadFolder() {
-        // We write assets to the temporary directory so that iOS can clean them up.
-        // We try to eagerly clean up these assets when they are no longer in use.
-
-        let tempDirPath = OWSTemporaryDirectory()
-        let dirPath = (tempDirPath as NSString).appendingPathComponent(downloadFolderName)
-        do {
-            let fileManager = FileManager.default
-
-            // Try to delete existing folder if necessary.
-            if fileManager.fileExists(atPath: dirPath) {
-                try fileManager.removeItem(atPath: dirPath)
-                downloadFolderPath = dirPath
-            }
-            // Try to create folder if necessary.
-            if !fileManager.fileExists(atPath: dirPath) {
-                try fileManager.createDirectory(atPath: dirPath,
-                                                withIntermediateDirectories: true,
-                                                attributes: nil)
-                downloadFolderPath = dirPath
-            }
-
-            // Don't back up ProxiedContent downloads.
-            OWSFileSystem.protectFileOrFolder(atPath: dirPath)
-        } catch let error as NSError {
-            owsFailDebug("ensureTempFolder failed: \(dirPath), \(error)")
-            downloadFolderPath = tempDirPath
+    /// Assets used to be written to a temporary directory that was emptied
+    /// on every launch.
+    private func deleteLegacyDownloadFolder() {
+        let dirPath = (OWSTemporaryDirectory() as NSString).appendingPathComponent(downloadFolderName)
+        DispatchQueue.global().async {
+            _ = OWSFileSystem.deleteFileIfExists(dirPath)
         }
     }
 }
@@ -110,19 +110,18 @@ public class GRDBGroupsV2MessageJobFinder: NSObject {
         }
     }
 
-    @objc
-    public func removeJobs(withUniqueIds uniqueIds: [String], transaction: GRDBWriteTransaction) {
-        guard uniqueIds.count > 0 else {
-            return
-        }
-
-        let commaSeparatedIds = uniqueIds.map { "\"\($0)\"" }.joined(separator: ", ")
+    /// Removes the group's jobs up to and including `lastId`.
+    ///
+    /// Jobs are processed in order, so this removes a processed batch with
+    /// one ranged delete (on the groupId and id index).
+    public func removeJobs(forGroupId groupId: Data, throughId lastId: Int64, transaction: GRDBWriteTransaction) {
         let sql = """
             DELETE
             FROM \(IncomingGroupsV2MessageJobRecord.databaseTableName)
-            WHERE \(incomingGroupsV2MessageJobColumn: .uniqueId) in (\(commaSeparatedIds))
+            WHERE \(incomingGroupsV2MessageJobColumn: .groupId) = ?
+            AND \(incomingGroupsV2MessageJobColumn: .id) <= ?
         """
-        transaction.execute(sql: sql)
+        transaction.execute(sql: sql, arguments: [groupId, lastId])
     }
 
     @objc
@@ -329,7 +329,7 @@ internal class GroupsMessageProcessor: MessageProcessingPipelineStage, Dependenc
 
     private typealias BatchCompletionBlock = ([IncomingGroupsV2MessageJob], Bool, SDSAnyWriteTransaction) -> Void
 
-    private func processWorkStep(retryDelayAfterFailure: TimeInterval = 1.0) {
+    private func processWorkStep(retryDelayAfterFailure: TimeInterval = 1.0, isCatchingUp: Bool = false) {
         owsAssertDebug(isDrainingQueue.get())
 
         let canProcess = (
@@ -345,10 +345,18 @@ internal class GroupsMessageProcessor: MessageProcessingPipelineStage, Dependenc
 
         // We want a value that is just high enough to yield perf benefits.
         let kIncomingMessageBatchSize: UInt = 16
+        // Once a batch comes back full there's a backlog (e.g. after a long
+        // time offline, or jobs left over from an upgrade), so drain it in
+        // larger batches.
+        let kCatchUpBatchSize: UInt = 64
         // If the app is in the background, use batch size of 1.
         // This reduces the cost of being interrupted and rolled back if
         // app is suspended.
-        let batchSize: UInt = CurrentAppContext().isInBackground() ? 1 : kIncomingMessageBatchSize
+        let batchSize: UInt = (
+            CurrentAppContext().isInBackground() ? 1
+            : isCatchingUp ? kCatchUpBatchSize
+            : kIncomingMessageBatchSize
+        )
 
         let batchJobs = databaseStorage.read { transaction in
             self.finder.nextJobs(forGroupId: self.groupId, batchSize: batchSize, transaction: transaction.unwrapGrdbRead)
@@ -368,8 +376,11 @@ internal class GroupsMessageProcessor: MessageProcessingPipelineStage, Dependenc
                 Logger.warn("shouldWaitBeforeRetrying")
             }
 
-            let processedUniqueIds = processedJobs.map { $0.uniqueId }
-            self.finder.removeJobs(withUniqueIds: processedUniqueIds, transaction: transaction.unwrapGrdbWrite)
+            // Processed jobs are always a prefix of the batch.
+            if let lastProcessedId = processedJobs.last?.grdbId?.int64Value {
+                self.finder.removeJobs(forGroupId: self.groupId, throughId: lastProcessedId, transaction: transaction.unwrapGrdbWrite)
+            }
+            let wasBatchFull = batchJobs.count == Int(batchSize)
 
             transaction.addAsyncCompletionOffMain {
                 assert(backgroundTask != nil)
@@ -392,6 +403,11 @@ internal class GroupsMessageProcessor: MessageProcessingPipelineStage, Dependenc
                     DispatchQueue.global().asyncAfter(deadline: DispatchTime.now() + retryDelayAfterFailure) {
                         self.tryToProcess(retryDelayAfterFailure: retryDelayAfterFailure * 2)
                     }
+                } else if wasBatchFull {
+                    // There are more jobs waiting, so there's nothing to gain by waiting.
+                    DispatchQueue.global().async {
+                        self.processWorkStep(isCatchingUp: true)
+                    }
                 } else {
                     // Wait always a bit in hopes of increasing the size of the next batch.
                     // This delay won't affect the first message to arrive when this queue is idle,
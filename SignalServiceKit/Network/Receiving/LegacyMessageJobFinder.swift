@@ -7,14 +7,23 @@ import Foundation
 import GRDB
 
 public class LegacyMessageJobFinder {
-    func allJobs(transaction: SDSAnyReadTransaction) -> [OWSMessageContentJob] {
+    /// The oldest `batchSize` jobs with ids after `afterId` (or the oldest
+    /// jobs, if it's nil), in order.
+    func nextJobs(
+        afterId: Int64?,
+        batchSize: Int,
+        transaction: SDSAnyReadTransaction
+    ) -> [OWSMessageContentJob] {
         let sql = """
             SELECT *
             FROM \(MessageContentJobRecord.databaseTableName)
+            WHERE \(messageContentJobColumn: .id) > ?
             ORDER BY \(messageContentJobColumn: .id)
+            LIMIT ?
         """
         let cursor = OWSMessageContentJob.grdbFetchCursor(
             sql: sql,
+            arguments: [afterId ?? 0, batchSize],
             transaction: transaction.unwrapGrdbRead
         )
 
@@ -25,7 +34,17 @@ public class LegacyMessageJobFinder {
                 userDefaults: CurrentAppContext().appUserDefaults(),
                 error: error
             )
-            owsFail("Failed to fetch all jobs")
+            owsFail("Failed to fetch jobs")
         }
     }
+
+    /// Removes every job up to and including `lastId`.
+    func removeJobs(throughId lastId: Int64, transaction: SDSAnyWriteTransaction) {
+        let sql = """
+            DELETE
+            FROM \(MessageContentJobRecord.databaseTableName)
+            WHERE \(messageContentJobColumn: .id) <= ?
+        """
+        transaction.unwrapGrdbWrite.execute(sql: sql, arguments: [lastId])
+    }
 }
@@ -0,0 +1,57 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// Collects values by key for a short window so that they can be handled
+/// together, e.g. posting one notification for several messages in a
+/// thread.
+///
+/// The first value for a key opens a window, and values added for that key
+/// before it closes join it. When the window closes, or when `flushAll()`
+/// is called, `flush` is called with the key's values, oldest first.
+///
+/// This class is thread-safe.
+final class NotificationCoalescer<Key: Hashable, Value> {
+    private let window: TimeInterval
+    private let flush: (Key, [Value]) -> Void
+    private let pendingValues = AtomicValue<[Key: [Value]]>([:], lock: .init())
+
+    init(window: TimeInterval, flush: @escaping (Key, [Value]) -> Void) {
+        self.window = window
+        self.flush = flush
+    }
+
+    /// The values waiting to be flushed for `key`, oldest first.
+    func pendingValues(for key: Key) -> [Value] {
+        return pendingValues.get()[key] ?? []
+    }
+
+    func add(_ value: Value, for key: Key) {
+        let didOpenWindow = pendingValues.update { pendingValues -> Bool in
+            let didOpenWindow = pendingValues[key] == nil
+            pendingValues[key, default: []].append(value)
+            return didOpenWindow
+        }
+        if didOpenWindow {
+            DispatchQueue.global().asyncAfter(deadline: .now() + window) { [weak self] in
+                self?.flush(key: key)
+            }
+        }
+    }
+
+    func flushAll() {
+        for key in pendingValues.get().keys {
+            flush(key: key)
+        }
+    }
+
+    private func flush(key: Key) {
+        guard let values = pendingValues.update({ $0.removeValue(forKey: key) }) else {
+            return
+        }
+        flush(key, values)
+    }
+}
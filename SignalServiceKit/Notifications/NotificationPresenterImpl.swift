@@ -60,6 +60,8 @@ public struct AppNotificationUserInfoKey {
     public static let callBackPhoneNumber = "Signal.AppNotificationsUserInfoKey.callBackPhoneNumber"
     public static let isMissedCall = "Signal.AppNotificationsUserInfoKey.isMissedCall"
     public static let defaultAction = "Signal.AppNotificationsUserInfoKey.defaultAction"
+    /// The ids of every message a coalesced notification stands for.
+    public static let coalescedMessageIds = "Signal.AppNotificationsUserInfoKey.coalescedMessageIds"
 }
 
 extension AppNotificationCategory {
@@ -175,11 +177,27 @@ public class NotificationPresenterImpl: NotificationPresenter {
     private var contactManager: any ContactManager { NSObject.contactsManager }
     private var databaseStorage: SDSDatabaseStorage { NSObject.databaseStorage }
     private var identityManager: any OWSIdentityManager { DependenciesBridge.shared.identityManager }
+    private var messageProcessor: MessageProcessor { NSObject.messageProcessor }
     private var preferences: Preferences { NSObject.preferences }
     private var tsAccountManager: any TSAccountManager { DependenciesBridge.shared.tsAccountManager }
 
+    /// While catching up on a backlog, incoming messages' notifications are
+    /// collected per thread and posted as one notification for each thread.
+    private var incomingMessageCoalescer: NotificationCoalescer<String, IncomingMessageNotification>!
+
     public init() {
         SwiftSingletons.register(self)
+
+        incomingMessageCoalescer = NotificationCoalescer(window: 1) { [weak self] threadUniqueId, notifications in
+            self?.postIncomingMessageNotifications(notifications, threadUniqueId: threadUniqueId)
+        }
+        NotificationCenter.default.addObserver(
+            forName: MessageProcessor.messageProcessorDidDrainQueue,
+            object: nil,
+            queue: nil
+        ) { [weak self] _ in
+            self?.incomingMessageCoalescer.flushAll()
+        }
     }
 
     func previewType(tx: SDSAnyReadTransaction) -> NotificationType {
@@ -603,13 +621,26 @@ public class NotificationPresenterImpl: NotificationPresenter {
             }
         }()
 
+        // While catching up on a backlog, post one notification per thread, and
+        // resolve what's the same for each message in the thread only once.
+        let shouldCoalesce = (
+            editTarget == nil
+            && !incomingMessage.isGroupStoryReply
+            && (messageProcessor.queuedContentCount > 1 || !incomingMessageCoalescer.pendingValues(for: thread.uniqueId).isEmpty)
+        )
+        let pendingNotifications = shouldCoalesce ? incomingMessageCoalescer.pendingValues(for: thread.uniqueId) : []
+
         // Don't reply from lockscreen if anyone in this conversation is
         // "no longer verified".
         var didIdentityChange = false
-        for address in thread.recipientAddresses(with: transaction) {
-            if identityManager.verificationState(for: address, tx: transaction.asV2Read) == .noLongerVerified {
-                didIdentityChange = true
-                break
+        if let pendingNotification = pendingNotifications.first {
+            didIdentityChange = pendingNotification.didIdentityChange
+        } else {
+            for address in thread.recipientAddresses(with: transaction) {
+                if identityManager.verificationState(for: address, tx: transaction.asV2Read) == .noLongerVerified {
+                    didIdentityChange = true
+                    break
+                }
             }
         }
 
@@ -636,18 +667,49 @@ public class NotificationPresenterImpl: NotificationPresenter {
             userInfo[AppNotificationUserInfoKey.storyTimestamp] = storyTimestamp
         }
 
+        // The intent carries the sender's avatar, so it's the same for each of
+        // their messages in the thread.
         var interaction: INInteraction?
-        if previewType != .noNameNoPreview,
-           let intent = thread.generateSendMessageIntent(context: .incomingMessage(incomingMessage), transaction: transaction) {
+        if
+            previewType != .noNameNoPreview,
+            let pendingNotification = pendingNotifications.last(where: { $0.authorAddress == incomingMessage.authorAddress }),
+            let pendingInteraction = pendingNotification.interaction
+        {
+            interaction = pendingInteraction
+        } else if
+            previewType != .noNameNoPreview,
+            let intent = thread.generateSendMessageIntent(context: .incomingMessage(incomingMessage), transaction: transaction)
+        {
             let wrapper = INInteraction(intent: intent, response: nil)
             wrapper.direction = .incoming
             interaction = wrapper
         }
 
-        let threadUniqueId = thread.uniqueId
-        let editTargetUniqueId = editTarget?.uniqueId
+        let notification = IncomingMessageNotification(
+            messageId: incomingMessage.uniqueId,
+            authorAddress: incomingMessage.authorAddress,
+            category: category,
+            title: notificationTitle,
+            body: notificationBody,
+            showsPreview: previewType == .namePreview,
+            threadIdentifier: threadIdentifier,
+            userInfo: userInfo,
+            interaction: interaction,
+            didIdentityChange: didIdentityChange,
+            pendingTask: shouldCoalesce ? Self.pendingTasks.buildPendingTask(label: "CoalescedNotification") : nil
+        )
+
+        if shouldCoalesce {
+            incomingMessageCoalescer.add(notification, for: thread.uniqueId)
+            return
+        }
+
+        guard let editTargetUniqueId = editTarget?.uniqueId else {
+            postIncomingMessageNotifications([notification], threadUniqueId: thread.uniqueId)
+            return
+        }
         enqueueNotificationAction {
-            if let editTargetUniqueId, await !self.presenter.replaceNotification(messageId: editTargetUniqueId) {
+            if await !self.presenter.replaceNotification(messageId: editTargetUniqueId) {
                 // The original notification was already dismissed. Don't show the edited one either.
                 return
             }
@@ -658,9 +720,53 @@ public class NotificationPresenterImpl: NotificationPresenter {
                 threadIdentifier: threadIdentifier,
                 userInfo: userInfo,
                 interaction: interaction,
-                soundQuery: (editTargetUniqueId != nil) ? .none : .thread(threadUniqueId)
+                soundQuery: .none
+            )
+        }
+    }
+
+    private struct IncomingMessageNotification {
+        let messageId: String
+        let authorAddress: SignalServiceAddress
+        let category: AppNotificationCategory
+        let title: String?
+        let body: String
+        let showsPreview: Bool
+        let threadIdentifier: String?
+        let userInfo: [AnyHashable: Any]
+        let interaction: INInteraction?
+        let didIdentityChange: Bool
+        /// Keeps the NSE waiting while this is held by the coalescer.
+        let pendingTask: PendingTask?
+    }
+
+    /// Posts one notification for the newest of `notifications`, which are
+    /// for the same thread, oldest first. If there are several, it also says
+    /// how many there are.
+    private func postIncomingMessageNotifications(_ notifications: [IncomingMessageNotification], threadUniqueId: String) {
+        guard let latestNotification = notifications.last else {
+            return
+        }
+        var body = latestNotification.body
+        var userInfo = latestNotification.userInfo
+        if notifications.count > 1 {
+            let summary = String.localizedStringWithFormat(NotificationStrings.incomingMessagesSummaryFormat, notifications.count)
+            body = latestNotification.showsPreview ? "\(body)\n\(summary)" : summary
+            userInfo[AppNotificationUserInfoKey.coalescedMessageIds] = notifications.map { $0.messageId }
+            Logger.info("Coalesced \(notifications.count) notifications for thread \(threadUniqueId)")
+        }
+        enqueueNotificationAction {
+            await self.notifyViaPresenter(
+                category: latestNotification.category,
+                title: latestNotification.title,
+                body: body,
+                threadIdentifier: latestNotification.threadIdentifier,
+                userInfo: userInfo,
+                interaction: latestNotification.interaction,
+                soundQuery: .thread(threadUniqueId)
             )
         }
+        notifications.forEach { $0.pendingTask?.complete() }
     }
 
     public func notifyUser(
@@ -376,6 +376,12 @@ class UserNotificationPresenter: Dependencies {
                 {
                     return true
                 }
+                if
+                    let coalescedMessageIds = request.content.userInfo[AppNotificationUserInfoKey.coalescedMessageIds] as? [String],
+                    coalescedMessageIds.contains(where: { messageIds.contains($0) })
+                {
+                    return true
+                }
             case .reactionId(let reactionId):
                 if
                     let requestReactionId = request.content.userInfo[AppNotificationUserInfoKey.reactionId] as? String,
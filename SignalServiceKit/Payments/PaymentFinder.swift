@@ -102,6 +102,24 @@ public class PaymentFinder: NSObject {
         }
     }
 
+    /// Payment models in blocks after `mcLedgerBlockIndex`, and those whose
+    /// ledger block isn't known yet.
+    public class func paymentModels(afterMcLedgerBlockIndex mcLedgerBlockIndex: UInt64,
+                                    transaction: SDSAnyReadTransaction) -> [TSPaymentModel] {
+        let sql = """
+        SELECT * FROM \(PaymentModelRecord.databaseTableName)
+        WHERE \(paymentModelColumn: .mcLedgerBlockIndex) > ?
+        OR \(paymentModelColumn: .mcLedgerBlockIndex) = 0
+        """
+        do {
+            return try TSPaymentModel.grdbFetchCursor(sql: sql,
+                                                      arguments: [mcLedgerBlockIndex],
+                                                      transaction: transaction.unwrapGrdbRead).all()
+        } catch {
+            owsFail("error: \(error)")
+        }
+    }
+
     @objc
     public class func paymentModels(forMcReceiptData mcReceiptData: Data,
                                     transaction: SDSAnyReadTransaction) -> [TSPaymentModel] {
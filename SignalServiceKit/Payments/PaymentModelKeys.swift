@@ -0,0 +1,97 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+import GRDB
+
+/// The MobileCoin keys of each `TSPaymentModel`, one row per key.
+///
+/// `MobileCoinPayment` keeps its incoming TXO public keys, spent key images
+/// and output public keys in archived arrays, so finding the payment models
+/// with a given key would otherwise mean decoding every model. The rows are
+/// rewritten whenever a payment model is inserted or updated, and are
+/// deleted with it (by cascade).
+public enum PaymentModelKeys {
+    static let tableName = "PaymentModelKey"
+    static let paymentModelRowIdColumn = "paymentModelRowId"
+    static let kindColumn = "kind"
+    static let keyColumn = "key"
+
+    public enum Kind: Int {
+        case incomingTransactionPublicKey = 0
+        case spentKeyImage = 1
+        case outputPublicKey = 2
+    }
+
+    /// The payment models with `key`, oldest first.
+    public static func paymentModels(
+        withKey key: Data,
+        kind: Kind,
+        tx: SDSAnyReadTransaction
+    ) -> [TSPaymentModel] {
+        let sql = """
+            SELECT \(PaymentModelRecord.databaseTableName).*
+            FROM \(tableName)
+            JOIN \(PaymentModelRecord.databaseTableName)
+                ON \(PaymentModelRecord.databaseTableName).id = \(tableName).\(paymentModelRowIdColumn)
+            WHERE \(tableName).\(kindColumn) = ?
+            AND \(tableName).\(keyColumn) = ?
+            ORDER BY \(PaymentModelRecord.databaseTableName).id
+        """
+        do {
+            return try TSPaymentModel.grdbFetchCursor(
+                sql: sql,
+                arguments: [kind.rawValue, key],
+                transaction: tx.unwrapGrdbRead
+            ).all()
+        } catch {
+            owsFail("error: \(error)")
+        }
+    }
+
+    static func updateKeys(for paymentModel: TSPaymentModel, tx: SDSAnyWriteTransaction) {
+        guard let paymentModelRowId = paymentModel.grdbId?.int64Value else {
+            owsFailDebug("Payment model missing grdbId.")
+            return
+        }
+        let database = tx.unwrapGrdbWrite.database
+        do {
+            try database.execute(
+                sql: "DELETE FROM \(tableName) WHERE \(paymentModelRowIdColumn) = ?",
+                arguments: [paymentModelRowId]
+            )
+            let insertStatement = try database.cachedStatement(sql: """
+                INSERT OR IGNORE INTO \(tableName)
+                (\(paymentModelRowIdColumn), \(kindColumn), \(keyColumn))
+                VALUES (?, ?, ?)
+            """)
+            for (kind, key) in keys(for: paymentModel) {
+                try insertStatement.execute(arguments: [paymentModelRowId, kind.rawValue, key])
+            }
+        } catch {
+            owsFailDebug("Couldn't update payment model keys: \(error)")
+        }
+    }
+
+    private static func keys(for paymentModel: TSPaymentModel) -> [(Kind, Data)] {
+        guard let mobileCoin = paymentModel.mobileCoin else {
+            return []
+        }
+        var keys = [(Kind, Data)]()
+        keys += (mobileCoin.incomingTransactionPublicKeys ?? []).map { (.incomingTransactionPublicKey, $0) }
+        keys += (mobileCoin.spentKeyImages ?? []).map { (.spentKeyImage, $0) }
+        keys += (mobileCoin.outputPublicKeys ?? []).map { (.outputPublicKey, $0) }
+        return keys
+    }
+}
+
+// MARK: -
+
+extension TSPaymentModel {
+    @objc
+    public func updatePaymentModelKeys(transaction: SDSAnyWriteTransaction) {
+        PaymentModelKeys.updateKeys(for: self, tx: transaction)
+    }
+}
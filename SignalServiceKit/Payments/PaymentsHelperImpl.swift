@@ -605,26 +605,29 @@ public class PaymentsHelperImpl: Dependencies, PaymentsHelperSwift, PaymentsHelp
         if !paymentModel.isUnidentified,
            mcLedgerBlockIndex > 0 {
 
-            let otherPaymentModels = PaymentFinder.paymentModels(forMcLedgerBlockIndex: mcLedgerBlockIndex,
-                                                                 transaction: transaction)
-            for otherPaymentModel in otherPaymentModels {
-                guard !otherPaymentModel.isUnidentified else {
-                    continue
-                }
-                guard paymentModel.uniqueId != otherPaymentModel.uniqueId else {
-                    owsFailDebug("Duplicate paymentModel.")
-                    return true
-                }
-                let otherSpentKeyImages = otherPaymentModel.mobileCoin?.spentKeyImages ?? []
-                let otherOutputPublicKeys = otherPaymentModel.mobileCoin?.outputPublicKeys ?? []
-                if !spentKeyImages.isDisjoint(with: otherSpentKeyImages) {
-                    owsFailDebug("spentKeyImage conflict.")
-                    return true
-                }
-                if !outputPublicKeys.isDisjoint(with: otherOutputPublicKeys) {
-                    owsFailDebug("outputPublicKey conflict.")
-                    return true
+            func hasConflict(keys: Set<Data>, kind: PaymentModelKeys.Kind) -> Bool {
+                for key in keys {
+                    let otherPaymentModels = PaymentModelKeys.paymentModels(withKey: key,
+                                                                            kind: kind,
+                                                                            tx: transaction)
+                    if otherPaymentModels.contains(where: { !$0.isUnidentified }) {
+                        return true
+                    }
                 }
+                return false
+            }
+
+            if TSPaymentModel.anyExists(uniqueId: paymentModel.uniqueId, transaction: transaction) {
+                owsFailDebug("Duplicate paymentModel.")
+                return true
+            }
+            if hasConflict(keys: spentKeyImages, kind: .spentKeyImage) {
+                owsFailDebug("spentKeyImage conflict.")
+                return true
+            }
+            if hasConflict(keys: outputPublicKeys, kind: .outputPublicKey) {
+                owsFailDebug("outputPublicKey conflict.")
+                return true
             }
         }
 
@@ -273,6 +273,8 @@ NS_ASSUME_NONNULL_BEGIN
     OWSAssertDebug(self.isValid);
 
     [super anyDidInsertWithTransaction:transaction];
+
+    [self updatePaymentModelKeysWithTransaction:transaction];
 }
 
 - (void)anyWillUpdateWithTransaction:(SDSAnyWriteTransaction *)transaction
@@ -289,6 +291,8 @@ NS_ASSUME_NONNULL_BEGIN
     OWSAssertDebug(self.isValid);
 
     [super anyDidUpdateWithTransaction:transaction];
+
+    [self updatePaymentModelKeysWithTransaction:transaction];
 }
 
 @end
@@ -1454,6 +1454,19 @@ extension OWSProfileManager: ProfileManager, Dependencies {
     }
 
     public func fetchUserProfiles(for addresses: [SignalServiceAddress], tx: SDSAnyReadTransaction) -> [OWSUserProfile?] {
+        return fetchUserProfiles(for: addresses, readOnly: false, tx: tx)
+    }
+
+    public func fetchReadOnlyUserProfiles(for addresses: [SignalServiceAddress], tx: SDSAnyReadTransaction) -> [OWSUserProfile?] {
+        return fetchUserProfiles(for: addresses, readOnly: true, tx: tx)
+    }
+
+    private func fetchUserProfiles(
+        for addresses: [SignalServiceAddress],
+        readOnly: Bool,
+        tx: SDSAnyReadTransaction
+    ) -> [OWSUserProfile?] {
+        let userProfileReadCache = modelReadCaches.userProfileReadCache
         return Refinery<SignalServiceAddress, OWSUserProfile>(addresses).refine(condition: { address in
             // TODO: Don't reach out to global state.
             return address.isLocalAddress
@@ -1461,7 +1474,11 @@ extension OWSProfileManager: ProfileManager, Dependencies {
             lazy var profile = { self.getLocalUserProfile(tx) }()
             return localAddresses.lazy.map { _ in profile }
         }, otherwise: { otherAddresses in
-            return self.modelReadCaches.userProfileReadCache.getUserProfiles(for: otherAddresses.map { .otherUser($0) }, transaction: tx)
+            let cacheKeys = otherAddresses.map { OWSUserProfile.Address.otherUser($0) }
+            if readOnly {
+                return userProfileReadCache.getReadOnlyUserProfiles(for: cacheKeys, transaction: tx)
+            }
+            return userProfileReadCache.getUserProfiles(for: cacheKeys, transaction: tx)
         }).values
     }
 
@@ -11,6 +11,11 @@ public struct ProfileFetchOptions: OptionSet {
     public init(rawValue: Int) { self.rawValue = rawValue }
 
     public static let opportunistic: Self = .init(rawValue: 1 << 0)
+
+    /// The profile is for something on screen, e.g. a member of the open
+    /// conversation. Opportunistic fetches with this option go ahead of
+    /// other opportunistic fetches.
+    public static let userVisible: Self = .init(rawValue: 1 << 1)
 }
 
 public protocol ProfileFetcher {
@@ -41,7 +46,8 @@ public enum ProfileFetcherError: Error {
 }
 
 public actor ProfileFetcherImpl: ProfileFetcher {
-    private let jobCreator: (ServiceId, AuthedAccount) -> ProfileFetcherJob
+    private let chatConnectionManager: any ChatConnectionManager
+    private let jobCreator: (ServiceId, AuthedAccount, ChatRequestPriority) -> ProfileFetcherJob
     private let reachabilityManager: any SSKReachabilityManager
     private let tsAccountManager: any TSAccountManager
 
@@ -66,7 +72,20 @@ public actor ProfileFetcherImpl: ProfileFetcher {
     private var rateLimitExpirationDate: MonotonicDate = .distantPast
     private var scheduledOpportunisticDate: MonotonicDate = .distantPast
 
+    /// How long to slow down for after the next rate limit. This doubles each
+    /// time we're rate limited again and resets once a fetch succeeds.
+    private var rateLimitBackoff: TimeInterval = Self.minRateLimitBackoff
+    private static let minRateLimitBackoff: TimeInterval = 5 * kMinuteInterval
+    private static let maxRateLimitBackoff: TimeInterval = kHourInterval
+
+    /// Opportunistic fetches that are waiting for their turn or in flight.
+    /// Asking again for the same profile joins the existing fetch rather than
+    /// taking another turn.
+    private var opportunisticFetches = [ServiceId: Task<FetchedProfile, Error>]()
+    private var waitingUserVisibleFetchCount = 0
+
     public init(
+        chatConnectionManager: any ChatConnectionManager,
         db: any DB,
         deleteForMeSyncMessageSettingsStore: any DeleteForMeSyncMessageSettingsStore,
         disappearingMessagesConfigurationStore: any DisappearingMessagesConfigurationStore,
@@ -82,12 +101,14 @@ public actor ProfileFetcherImpl: ProfileFetcher {
         udManager: any OWSUDManager,
         versionedProfiles: any VersionedProfilesSwift
     ) {
+        self.chatConnectionManager = chatConnectionManager
         self.reachabilityManager = reachabilityManager
         self.tsAccountManager = tsAccountManager
-        self.jobCreator = { serviceId, authedAccount in
+        self.jobCreator = { serviceId, authedAccount, requestPriority in
             return ProfileFetcherJob(
                 serviceId: serviceId,
                 authedAccount: authedAccount,
+                requestPriority: requestPriority,
                 db: db,
                 deleteForMeSyncMessageSettingsStore: deleteForMeSyncMessageSettingsStore,
                 disappearingMessagesConfigurationStore: disappearingMessagesConfigurationStore,
@@ -141,14 +162,19 @@ public actor ProfileFetcherImpl: ProfileFetcher {
             if !CurrentAppContext().isMainApp {
                 throw ProfileFetcherError.skippingOpportunisticFetch
             }
-            return try await fetchProfileOpportunistically(serviceId: serviceId, authedAccount: authedAccount)
+            return try await fetchProfileOpportunistically(
+                serviceId: serviceId,
+                authedAccount: authedAccount,
+                isUserVisible: options.contains(.userVisible)
+            )
         }
-        return try await fetchProfileUrgently(serviceId: serviceId, authedAccount: authedAccount)
+        return try await fetchProfileUrgently(serviceId: serviceId, authedAccount: authedAccount, requestPriority: .default)
     }
 
     private func fetchProfileOpportunistically(
         serviceId: ServiceId,
-        authedAccount: AuthedAccount
+        authedAccount: AuthedAccount,
+        isUserVisible: Bool
     ) async throws -> FetchedProfile {
         if CurrentAppContext().isRunningTests {
             throw ProfileFetcherError.skippingOpportunisticFetch
@@ -164,12 +190,20 @@ public actor ProfileFetcherImpl: ProfileFetcher {
         guard !localIdentifiers.contains(serviceId: serviceId) else {
             throw ProfileFetcherError.skippingOpportunisticFetch
         }
-        try await waitIfNecessary()
-        // Check again since we might have fetched while waiting.
-        guard shouldOpportunisticallyFetch(serviceId: serviceId) else {
-            throw ProfileFetcherError.skippingOpportunisticFetch
+        if let existingFetch = opportunisticFetches[serviceId] {
+            return try await existingFetch.value
         }
-        return try await fetchProfileUrgently(serviceId: serviceId, authedAccount: authedAccount)
+        let fetch = Task {
+            try await self.waitIfNecessary(isUserVisible: isUserVisible)
+            // Check again since we might have fetched while waiting.
+            guard self.shouldOpportunisticallyFetch(serviceId: serviceId) else {
+                throw ProfileFetcherError.skippingOpportunisticFetch
+            }
+            return try await self.fetchProfileUrgently(serviceId: serviceId, authedAccount: authedAccount, requestPriority: .low)
+        }
+        opportunisticFetches[serviceId] = fetch
+        defer { opportunisticFetches[serviceId] = nil }
+        return try await fetch.value
     }
 
     private func isRegisteredOrExplicitlyAuthenticated(authedAccount: AuthedAccount) -> Bool {
@@ -183,9 +217,10 @@ public actor ProfileFetcherImpl: ProfileFetcher {
 
     private func fetchProfileUrgently(
         serviceId: ServiceId,
-        authedAccount: AuthedAccount
+        authedAccount: AuthedAccount,
+        requestPriority: ChatRequestPriority
     ) async throws -> FetchedProfile {
-        let result = await Result { try await jobCreator(serviceId, authedAccount).run() }
+        let result = await Result { try await jobCreator(serviceId, authedAccount, requestPriority).run() }
         let outcome: FetchResult.Outcome
         do {
             _ = try result.get()
@@ -198,14 +233,34 @@ public actor ProfileFetcherImpl: ProfileFetcher {
             outcome = .otherFailure
         }
         let now = MonotonicDate()
-        if case .failure(ProfileRequestError.rateLimit) = result {
-            self.rateLimitExpirationDate = now.adding(5*kMinuteInterval)
+        switch result {
+        case .success:
+            self.rateLimitBackoff = Self.minRateLimitBackoff
+        case .failure(ProfileRequestError.rateLimit):
+            self.rateLimitExpirationDate = now.adding(self.rateLimitBackoff)
+            self.rateLimitBackoff = min(self.rateLimitBackoff * 2, Self.maxRateLimitBackoff)
+        case .failure:
+            break
         }
         self.recentFetchResults[serviceId] = FetchResult(outcome: outcome, completionDate: now)
         return try result.get()
     }
 
-    private func waitIfNecessary() async throws {
+    private func waitIfNecessary(isUserVisible: Bool) async throws {
+        if isUserVisible {
+            waitingUserVisibleFetchCount += 1
+        } else {
+            // Let fetches for what's on screen take the next turns.
+            while waitingUserVisibleFetchCount > 0 {
+                try await Task.sleep(nanoseconds: 250 * NSEC_PER_MSEC)
+            }
+        }
+        defer {
+            if isUserVisible {
+                waitingUserVisibleFetchCount -= 1
+            }
+        }
+
         let now = MonotonicDate()
 
         // We need to throttle these jobs.
@@ -219,7 +274,8 @@ public actor ProfileFetcherImpl: ProfileFetcher {
         // succeed, the "bulk" profile fetches are cautious. This takes two forms:
         //
         // * Rate-limiting bulk profiles faster than the service's rate limit.
-        // * Backing off aggressively if we hit the rate limit.
+        // * Backing off aggressively if we hit the rate limit, and for longer
+        //   each time we hit it again.
 
         let minimumDelay: TimeInterval
         if now < rateLimitExpirationDate {
@@ -234,6 +290,12 @@ public actor ProfileFetcherImpl: ProfileFetcher {
         if now < minimumDate {
             try await Task.sleep(nanoseconds: minimumDate - now)
         }
+
+        // Don't queue behind other bulk requests; that only delays whatever is
+        // sent after us.
+        while chatConnectionManager.hasRequestBackpressure(priority: .low) {
+            try await Task.sleep(nanoseconds: 250 * NSEC_PER_MSEC)
+        }
     }
 
     private func shouldOpportunisticallyFetch(serviceId: ServiceId) -> Bool {
@@ -18,6 +18,7 @@ public enum ProfileRequestError: Error {
 public class ProfileFetcherJob {
     private let serviceId: ServiceId
     private let authedAccount: AuthedAccount
+    private let requestPriority: ChatRequestPriority
 
     private let db: any DB
     private let deleteForMeSyncMessageSettingsStore: any DeleteForMeSyncMessageSettingsStore
@@ -36,6 +37,7 @@ public class ProfileFetcherJob {
     init(
         serviceId: ServiceId,
         authedAccount: AuthedAccount,
+        requestPriority: ChatRequestPriority,
         db: any DB,
         deleteForMeSyncMessageSettingsStore: any DeleteForMeSyncMessageSettingsStore,
         disappearingMessagesConfigurationStore: any DisappearingMessagesConfigurationStore,
@@ -52,6 +54,7 @@ public class ProfileFetcherJob {
     ) {
         self.serviceId = serviceId
         self.authedAccount = authedAccount
+        self.requestPriority = requestPriority
         self.db = db
         self.deleteForMeSyncMessageSettingsStore = deleteForMeSyncMessageSettingsStore
         self.disappearingMessagesConfigurationStore = disappearingMessagesConfigurationStore
@@ -147,6 +150,7 @@ public class ProfileFetcherJob {
                             auth: self.authedAccount.chatServiceAuth
                         )
                         currentVersionedProfileRequest = request
+                        request.request.priority = self.requestPriority
                         return request.request
                     } catch {
                         owsFailDebug("Error: \(error)")
@@ -154,11 +158,13 @@ public class ProfileFetcherJob {
                     }
                 default:
                     Logger.info("Unversioned profile fetch.")
-                    return OWSRequestFactory.getUnversionedProfileRequest(
+                    let request = OWSRequestFactory.getUnversionedProfileRequest(
                         serviceId: serviceId,
                         udAccessKey: udAccessKeyForRequest,
                         auth: self.authedAccount.chatServiceAuth
                     )
+                    request.priority = self.requestPriority
+                    return request
                 }
             },
             serviceId: serviceId,
@@ -83,6 +83,9 @@ public protocol ProfileManager: ProfileManagerProtocol {
 
     func fetchLocalUsersProfile(authedAccount: AuthedAccount) -> Promise<FetchedProfile>
     func fetchUserProfiles(for addresses: [SignalServiceAddress], tx: SDSAnyReadTransaction) -> [OWSUserProfile?]
+    /// Like `fetchUserProfiles`, but may return shared instances instead of
+    /// copies, so callers must not change them.
+    func fetchReadOnlyUserProfiles(for addresses: [SignalServiceAddress], tx: SDSAnyReadTransaction) -> [OWSUserProfile?]
 
     func reuploadLocalProfile(authedAccount: AuthedAccount)
 
@@ -673,16 +673,55 @@ public class SSKProtoStoryMessage: NSObject, Codable, NSSecureCoding {
     fileprivate let proto: SignalServiceProtos_StoryMessage
 
     @objc
-    public let group: SSKProtoGroupContextV2?
+    public var group: SSKProtoGroupContextV2? {
+        guard proto.hasGroup else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let group = _group {
+                return group
+            }
+            let group = SSKProtoGroupContextV2(proto.group)
+            _group = group
+            return group
+        }
+    }
+    private var _group: SSKProtoGroupContextV2?
 
     @objc
-    public let fileAttachment: SSKProtoAttachmentPointer?
+    public var fileAttachment: SSKProtoAttachmentPointer? {
+        guard proto.hasFileAttachment else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let fileAttachment = _fileAttachment {
+                return fileAttachment
+            }
+            let fileAttachment = SSKProtoAttachmentPointer(proto.fileAttachment)
+            _fileAttachment = fileAttachment
+            return fileAttachment
+        }
+    }
+    private var _fileAttachment: SSKProtoAttachmentPointer?
 
     @objc
     public let textAttachment: SSKProtoTextAttachment?
 
     @objc
-    public let bodyRanges: [SSKProtoBodyRange]
+    public var bodyRanges: [SSKProtoBodyRange] {
+        guard !proto.bodyRanges.isEmpty else {
+            return []
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let bodyRanges = _bodyRanges {
+                return bodyRanges
+            }
+            let bodyRanges = proto.bodyRanges.map { SSKProtoBodyRange($0) }
+            _bodyRanges = bodyRanges
+            return bodyRanges
+        }
+    }
+    private var _bodyRanges: [SSKProtoBodyRange]?
 
     @objc
     public var profileKey: Data? {
@@ -714,15 +753,9 @@ public class SSKProtoStoryMessage: NSObject, Codable, NSSecureCoding {
     }
 
     private init(proto: SignalServiceProtos_StoryMessage,
-                 group: SSKProtoGroupContextV2?,
-                 fileAttachment: SSKProtoAttachmentPointer?,
-                 textAttachment: SSKProtoTextAttachment?,
-                 bodyRanges: [SSKProtoBodyRange]) {
+                 textAttachment: SSKProtoTextAttachment?) {
         self.proto = proto
-        self.group = group
-        self.fileAttachment = fileAttachment
         self.textAttachment = textAttachment
-        self.bodyRanges = bodyRanges
     }
 
     @objc
@@ -737,29 +770,13 @@ public class SSKProtoStoryMessage: NSObject, Codable, NSSecureCoding {
     }
 
     fileprivate convenience init(_ proto: SignalServiceProtos_StoryMessage) throws {
-        var group: SSKProtoGroupContextV2?
-        if proto.hasGroup {
-            group = SSKProtoGroupContextV2(proto.group)
-        }
-
-        var fileAttachment: SSKProtoAttachmentPointer?
-        if proto.hasFileAttachment {
-            fileAttachment = SSKProtoAttachmentPointer(proto.fileAttachment)
-        }
-
         var textAttachment: SSKProtoTextAttachment?
         if proto.hasTextAttachment {
             textAttachment = try SSKProtoTextAttachment(proto.textAttachment)
         }
 
-        var bodyRanges: [SSKProtoBodyRange] = []
-        bodyRanges = proto.bodyRanges.map { SSKProtoBodyRange($0) }
-
         self.init(proto: proto,
-                  group: group,
-                  fileAttachment: fileAttachment,
-                  textAttachment: textAttachment,
-                  bodyRanges: bodyRanges)
+                  textAttachment: textAttachment)
     }
 
     public required convenience init(from decoder: Swift.Decoder) throws {
@@ -942,7 +959,20 @@ public class SSKProtoPreview: NSObject, Codable, NSSecureCoding {
     public let url: String
 
     @objc
-    public let image: SSKProtoAttachmentPointer?
+    public var image: SSKProtoAttachmentPointer? {
+        guard proto.hasImage else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let image = _image {
+                return image
+            }
+            let image = SSKProtoAttachmentPointer(proto.image)
+            _image = image
+            return image
+        }
+    }
+    private var _image: SSKProtoAttachmentPointer?
 
     @objc
     public var title: String? {
@@ -986,11 +1016,9 @@ public class SSKProtoPreview: NSObject, Codable, NSSecureCoding {
     }
 
     private init(proto: SignalServiceProtos_Preview,
-                 url: String,
-                 image: SSKProtoAttachmentPointer?) {
+                 url: String) {
         self.proto = proto
         self.url = url
-        self.image = image
     }
 
     @objc
@@ -1010,14 +1038,8 @@ public class SSKProtoPreview: NSObject, Codable, NSSecureCoding {
         }
         let url = proto.url
 
-        var image: SSKProtoAttachmentPointer?
-        if proto.hasImage {
-            image = SSKProtoAttachmentPointer(proto.image)
-        }
-
         self.init(proto: proto,
-                  url: url,
-                  image: image)
+                  url: url)
     }
 
     public required convenience init(from decoder: Swift.Decoder) throws {
@@ -1438,7 +1460,20 @@ public class SSKProtoTextAttachment: NSObject, Codable, NSSecureCoding {
     public let preview: SSKProtoPreview?
 
     @objc
-    public let gradient: SSKProtoTextAttachmentGradient?
+    public var gradient: SSKProtoTextAttachmentGradient? {
+        guard proto.hasGradient else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let gradient = _gradient {
+                return gradient
+            }
+            let gradient = SSKProtoTextAttachmentGradient(proto.gradient)
+            _gradient = gradient
+            return gradient
+        }
+    }
+    private var _gradient: SSKProtoTextAttachmentGradient?
 
     @objc
     public var text: String? {
@@ -1508,11 +1543,9 @@ public class SSKProtoTextAttachment: NSObject, Codable, NSSecureCoding {
     }
 
     private init(proto: SignalServiceProtos_TextAttachment,
-                 preview: SSKProtoPreview?,
-                 gradient: SSKProtoTextAttachmentGradient?) {
+                 preview: SSKProtoPreview?) {
         self.proto = proto
         self.preview = preview
-        self.gradient = gradient
     }
 
     @objc
@@ -1532,14 +1565,8 @@ public class SSKProtoTextAttachment: NSObject, Codable, NSSecureCoding {
             preview = try SSKProtoPreview(proto.preview)
         }
 
-        var gradient: SSKProtoTextAttachmentGradient?
-        if proto.hasGradient {
-            gradient = SSKProtoTextAttachmentGradient(proto.gradient)
-        }
-
         self.init(proto: proto,
-                  preview: preview,
-                  gradient: gradient)
+                  preview: preview)
     }
 
     public required convenience init(from decoder: Swift.Decoder) throws {
@@ -1727,10 +1754,36 @@ public class SSKProtoContent: NSObject, Codable, NSSecureCoding {
     public let callMessage: SSKProtoCallMessage?
 
     @objc
-    public let nullMessage: SSKProtoNullMessage?
+    public var nullMessage: SSKProtoNullMessage? {
+        guard proto.hasNullMessage else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let nullMessage = _nullMessage {
+                return nullMessage
+            }
+            let nullMessage = SSKProtoNullMessage(proto.nullMessage)
+            _nullMessage = nullMessage
+            return nullMessage
+        }
+    }
+    private var _nullMessage: SSKProtoNullMessage?
 
     @objc
-    public let receiptMessage: SSKProtoReceiptMessage?
+    public var receiptMessage: SSKProtoReceiptMessage? {
+        guard proto.hasReceiptMessage else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let receiptMessage = _receiptMessage {
+                return receiptMessage
+            }
+            let receiptMessage = SSKProtoReceiptMessage(proto.receiptMessage)
+            _receiptMessage = receiptMessage
+            return receiptMessage
+        }
+    }
+    private var _receiptMessage: SSKProtoReceiptMessage?
 
     @objc
     public let typingMessage: SSKProtoTypingMessage?
@@ -1739,7 +1792,20 @@ public class SSKProtoContent: NSObject, Codable, NSSecureCoding {
     public let storyMessage: SSKProtoStoryMessage?
 
     @objc
-    public let pniSignatureMessage: SSKProtoPniSignatureMessage?
+    public var pniSignatureMessage: SSKProtoPniSignatureMessage? {
+        guard proto.hasPniSignatureMessage else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let pniSignatureMessage = _pniSignatureMessage {
+                return pniSignatureMessage
+            }
+            let pniSignatureMessage = SSKProtoPniSignatureMessage(proto.pniSignatureMessage)
+            _pniSignatureMessage = pniSignatureMessage
+            return pniSignatureMessage
+        }
+    }
+    private var _pniSignatureMessage: SSKProtoPniSignatureMessage?
 
     @objc
     public let editMessage: SSKProtoEditMessage?
@@ -1780,21 +1846,15 @@ public class SSKProtoContent: NSObject, Codable, NSSecureCoding {
                  dataMessage: SSKProtoDataMessage?,
                  syncMessage: SSKProtoSyncMessage?,
                  callMessage: SSKProtoCallMessage?,
-                 nullMessage: SSKProtoNullMessage?,
-                 receiptMessage: SSKProtoReceiptMessage?,
                  typingMessage: SSKProtoTypingMessage?,
                  storyMessage: SSKProtoStoryMessage?,
-                 pniSignatureMessage: SSKProtoPniSignatureMessage?,
                  editMessage: SSKProtoEditMessage?) {
         self.proto = proto
         self.dataMessage = dataMessage
         self.syncMessage = syncMessage
         self.callMessage = callMessage
-        self.nullMessage = nullMessage
-        self.receiptMessage = receiptMessage
         self.typingMessage = typingMessage
         self.storyMessage = storyMessage
-        self.pniSignatureMessage = pniSignatureMessage
         self.editMessage = editMessage
     }
 
@@ -1825,16 +1885,6 @@ public class SSKProtoContent: NSObject, Codable, NSSecureCoding {
             callMessage = try SSKProtoCallMessage(proto.callMessage)
         }
 
-        var nullMessage: SSKProtoNullMessage?
-        if proto.hasNullMessage {
-            nullMessage = SSKProtoNullMessage(proto.nullMessage)
-        }
-
-        var receiptMessage: SSKProtoReceiptMessage?
-        if proto.hasReceiptMessage {
-            receiptMessage = SSKProtoReceiptMessage(proto.receiptMessage)
-        }
-
         var typingMessage: SSKProtoTypingMessage?
         if proto.hasTypingMessage {
             typingMessage = try SSKProtoTypingMessage(proto.typingMessage)
@@ -1845,11 +1895,6 @@ public class SSKProtoContent: NSObject, Codable, NSSecureCoding {
             storyMessage = try SSKProtoStoryMessage(proto.storyMessage)
         }
 
-        var pniSignatureMessage: SSKProtoPniSignatureMessage?
-        if proto.hasPniSignatureMessage {
-            pniSignatureMessage = SSKProtoPniSignatureMessage(proto.pniSignatureMessage)
-        }
-
         var editMessage: SSKProtoEditMessage?
         if proto.hasEditMessage {
             editMessage = try SSKProtoEditMessage(proto.editMessage)
@@ -1859,11 +1904,8 @@ public class SSKProtoContent: NSObject, Codable, NSSecureCoding {
                   dataMessage: dataMessage,
                   syncMessage: syncMessage,
                   callMessage: callMessage,
-                  nullMessage: nullMessage,
-                  receiptMessage: receiptMessage,
                   typingMessage: typingMessage,
                   storyMessage: storyMessage,
-                  pniSignatureMessage: pniSignatureMessage,
                   editMessage: editMessage)
     }
 
@@ -3301,7 +3343,20 @@ public class SSKProtoCallMessage: NSObject, Codable, NSSecureCoding {
     public let hangup: SSKProtoCallMessageHangup?
 
     @objc
-    public let opaque: SSKProtoCallMessageOpaque?
+    public var opaque: SSKProtoCallMessageOpaque? {
+        guard proto.hasOpaque else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let opaque = _opaque {
+                return opaque
+            }
+            let opaque = SSKProtoCallMessageOpaque(proto.opaque)
+            _opaque = opaque
+            return opaque
+        }
+    }
+    private var _opaque: SSKProtoCallMessageOpaque?
 
     @objc
     public var profileKey: Data? {
@@ -3337,15 +3392,13 @@ public class SSKProtoCallMessage: NSObject, Codable, NSSecureCoding {
                  answer: SSKProtoCallMessageAnswer?,
                  iceUpdate: [SSKProtoCallMessageIceUpdate],
                  busy: SSKProtoCallMessageBusy?,
-                 hangup: SSKProtoCallMessageHangup?,
-                 opaque: SSKProtoCallMessageOpaque?) {
+                 hangup: SSKProtoCallMessageHangup?) {
         self.proto = proto
         self.offer = offer
         self.answer = answer
         self.iceUpdate = iceUpdate
         self.busy = busy
         self.hangup = hangup
-        self.opaque = opaque
     }
 
     @objc
@@ -3383,18 +3436,12 @@ public class SSKProtoCallMessage: NSObject, Codable, NSSecureCoding {
             hangup = try SSKProtoCallMessageHangup(proto.hangup)
         }
 
-        var opaque: SSKProtoCallMessageOpaque?
-        if proto.hasOpaque {
-            opaque = SSKProtoCallMessageOpaque(proto.opaque)
-        }
-
         self.init(proto: proto,
                   offer: offer,
                   answer: answer,
                   iceUpdate: iceUpdate,
                   busy: busy,
-                  hangup: hangup,
-                  opaque: opaque)
+                  hangup: hangup)
     }
 
     public required convenience init(from decoder: Swift.Decoder) throws {
@@ -3602,7 +3649,20 @@ public class SSKProtoDataMessageQuoteQuotedAttachment: NSObject, Codable, NSSecu
     fileprivate let proto: SignalServiceProtos_DataMessage.Quote.QuotedAttachment
 
     @objc
-    public let thumbnail: SSKProtoAttachmentPointer?
+    public var thumbnail: SSKProtoAttachmentPointer? {
+        guard proto.hasThumbnail else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let thumbnail = _thumbnail {
+                return thumbnail
+            }
+            let thumbnail = SSKProtoAttachmentPointer(proto.thumbnail)
+            _thumbnail = thumbnail
+            return thumbnail
+        }
+    }
+    private var _thumbnail: SSKProtoAttachmentPointer?
 
     @objc
     public var contentType: String? {
@@ -3636,10 +3696,8 @@ public class SSKProtoDataMessageQuoteQuotedAttachment: NSObject, Codable, NSSecu
         return proto.unknownFields
     }
 
-    private init(proto: SignalServiceProtos_DataMessage.Quote.QuotedAttachment,
-                 thumbnail: SSKProtoAttachmentPointer?) {
+    private init(proto: SignalServiceProtos_DataMessage.Quote.QuotedAttachment) {
         self.proto = proto
-        self.thumbnail = thumbnail
     }
 
     @objc
@@ -3654,13 +3712,7 @@ public class SSKProtoDataMessageQuoteQuotedAttachment: NSObject, Codable, NSSecu
     }
 
     fileprivate convenience init(_ proto: SignalServiceProtos_DataMessage.Quote.QuotedAttachment) {
-        var thumbnail: SSKProtoAttachmentPointer?
-        if proto.hasThumbnail {
-            thumbnail = SSKProtoAttachmentPointer(proto.thumbnail)
-        }
-
-        self.init(proto: proto,
-                  thumbnail: thumbnail)
+        self.init(proto: proto)
     }
 
     public required convenience init(from decoder: Swift.Decoder) throws {
@@ -3832,10 +3884,36 @@ public class SSKProtoDataMessageQuote: NSObject, Codable, NSSecureCoding {
     public let id: UInt64
 
     @objc
-    public let attachments: [SSKProtoDataMessageQuoteQuotedAttachment]
+    public var attachments: [SSKProtoDataMessageQuoteQuotedAttachment] {
+        guard !proto.attachments.isEmpty else {
+            return []
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let attachments = _attachments {
+                return attachments
+            }
+            let attachments = proto.attachments.map { SSKProtoDataMessageQuoteQuotedAttachment($0) }
+            _attachments = attachments
+            return attachments
+        }
+    }
+    private var _attachments: [SSKProtoDataMessageQuoteQuotedAttachment]?
 
     @objc
-    public let bodyRanges: [SSKProtoBodyRange]
+    public var bodyRanges: [SSKProtoBodyRange] {
+        guard !proto.bodyRanges.isEmpty else {
+            return []
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let bodyRanges = _bodyRanges {
+                return bodyRanges
+            }
+            let bodyRanges = proto.bodyRanges.map { SSKProtoBodyRange($0) }
+            _bodyRanges = bodyRanges
+            return bodyRanges
+        }
+    }
+    private var _bodyRanges: [SSKProtoBodyRange]?
 
     @objc
     public var authorAci: String? {
@@ -3890,13 +3968,9 @@ public class SSKProtoDataMessageQuote: NSObject, Codable, NSSecureCoding {
     }
 
     private init(proto: SignalServiceProtos_DataMessage.Quote,
-                 id: UInt64,
-                 attachments: [SSKProtoDataMessageQuoteQuotedAttachment],
-                 bodyRanges: [SSKProtoBodyRange]) {
+                 id: UInt64) {
         self.proto = proto
         self.id = id
-        self.attachments = attachments
-        self.bodyRanges = bodyRanges
     }
 
     @objc
@@ -3916,16 +3990,8 @@ public class SSKProtoDataMessageQuote: NSObject, Codable, NSSecureCoding {
         }
         let id = proto.id
 
-        var attachments: [SSKProtoDataMessageQuoteQuotedAttachment] = []
-        attachments = proto.attachments.map { SSKProtoDataMessageQuoteQuotedAttachment($0) }
-
-        var bodyRanges: [SSKProtoBodyRange] = []
-        bodyRanges = proto.bodyRanges.map { SSKProtoBodyRange($0) }
-
         self.init(proto: proto,
-                  id: id,
-                  attachments: attachments,
-                  bodyRanges: bodyRanges)
+                  id: id)
     }
 
     public required convenience init(from decoder: Swift.Decoder) throws {
@@ -5219,7 +5285,20 @@ public class SSKProtoDataMessageContactAvatar: NSObject, Codable, NSSecureCoding
     fileprivate let proto: SignalServiceProtos_DataMessage.Contact.Avatar
 
     @objc
-    public let avatar: SSKProtoAttachmentPointer?
+    public var avatar: SSKProtoAttachmentPointer? {
+        guard proto.hasAvatar else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let avatar = _avatar {
+                return avatar
+            }
+            let avatar = SSKProtoAttachmentPointer(proto.avatar)
+            _avatar = avatar
+            return avatar
+        }
+    }
+    private var _avatar: SSKProtoAttachmentPointer?
 
     @objc
     public var isProfile: Bool {
@@ -5238,10 +5317,8 @@ public class SSKProtoDataMessageContactAvatar: NSObject, Codable, NSSecureCoding
         return proto.unknownFields
     }
 
-    private init(proto: SignalServiceProtos_DataMessage.Contact.Avatar,
-                 avatar: SSKProtoAttachmentPointer?) {
+    private init(proto: SignalServiceProtos_DataMessage.Contact.Avatar) {
         self.proto = proto
-        self.avatar = avatar
     }
 
     @objc
@@ -5256,13 +5333,7 @@ public class SSKProtoDataMessageContactAvatar: NSObject, Codable, NSSecureCoding
     }
 
     fileprivate convenience init(_ proto: SignalServiceProtos_DataMessage.Contact.Avatar) {
-        var avatar: SSKProtoAttachmentPointer?
-        if proto.hasAvatar {
-            avatar = SSKProtoAttachmentPointer(proto.avatar)
-        }
-
-        self.init(proto: proto,
-                  avatar: avatar)
+        self.init(proto: proto)
     }
 
     public required convenience init(from decoder: Swift.Decoder) throws {
@@ -5389,19 +5460,84 @@ public class SSKProtoDataMessageContact: NSObject, Codable, NSSecureCoding {
     fileprivate let proto: SignalServiceProtos_DataMessage.Contact
 
     @objc
-    public let name: SSKProtoDataMessageContactName?
+    public var name: SSKProtoDataMessageContactName? {
+        guard proto.hasName else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let name = _name {
+                return name
+            }
+            let name = SSKProtoDataMessageContactName(proto.name)
+            _name = name
+            return name
+        }
+    }
+    private var _name: SSKProtoDataMessageContactName?
 
     @objc
-    public let number: [SSKProtoDataMessageContactPhone]
+    public var number: [SSKProtoDataMessageContactPhone] {
+        guard !proto.number.isEmpty else {
+            return []
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let number = _number {
+                return number
+            }
+            let number = proto.number.map { SSKProtoDataMessageContactPhone($0) }
+            _number = number
+            return number
+        }
+    }
+    private var _number: [SSKProtoDataMessageContactPhone]?
 
     @objc
-    public let email: [SSKProtoDataMessageContactEmail]
+    public var email: [SSKProtoDataMessageContactEmail] {
+        guard !proto.email.isEmpty else {
+            return []
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let email = _email {
+                return email
+            }
+            let email = proto.email.map { SSKProtoDataMessageContactEmail($0) }
+            _email = email
+            return email
+        }
+    }
+    private var _email: [SSKProtoDataMessageContactEmail]?
 
     @objc
-    public let address: [SSKProtoDataMessageContactPostalAddress]
+    public var address: [SSKProtoDataMessageContactPostalAddress] {
+        guard !proto.address.isEmpty else {
+            return []
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let address = _address {
+                return address
+            }
+            let address = proto.address.map { SSKProtoDataMessageContactPostalAddress($0) }
+            _address = address
+            return address
+        }
+    }
+    private var _address: [SSKProtoDataMessageContactPostalAddress]?
 
     @objc
-    public let avatar: SSKProtoDataMessageContactAvatar?
+    public var avatar: SSKProtoDataMessageContactAvatar? {
+        guard proto.hasAvatar else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let avatar = _avatar {
+                return avatar
+            }
+            let avatar = SSKProtoDataMessageContactAvatar(proto.avatar)
+            _avatar = avatar
+            return avatar
+        }
+    }
+    private var _avatar: SSKProtoDataMessageContactAvatar?
 
     @objc
     public var organization: String? {
@@ -5423,18 +5559,8 @@ public class SSKProtoDataMessageContact: NSObject, Codable, NSSecureCoding {
         return proto.unknownFields
     }
 
-    private init(proto: SignalServiceProtos_DataMessage.Contact,
-                 name: SSKProtoDataMessageContactName?,
-                 number: [SSKProtoDataMessageContactPhone],
-                 email: [SSKProtoDataMessageContactEmail],
-                 address: [SSKProtoDataMessageContactPostalAddress],
-                 avatar: SSKProtoDataMessageContactAvatar?) {
+    private init(proto: SignalServiceProtos_DataMessage.Contact) {
         self.proto = proto
-        self.name = name
-        self.number = number
-        self.email = email
-        self.address = address
-        self.avatar = avatar
     }
 
     @objc
@@ -5449,31 +5575,7 @@ public class SSKProtoDataMessageContact: NSObject, Codable, NSSecureCoding {
     }
 
     fileprivate convenience init(_ proto: SignalServiceProtos_DataMessage.Contact) {
-        var name: SSKProtoDataMessageContactName?
-        if proto.hasName {
-            name = SSKProtoDataMessageContactName(proto.name)
-        }
-
-        var number: [SSKProtoDataMessageContactPhone] = []
-        number = proto.number.map { SSKProtoDataMessageContactPhone($0) }
-
-        var email: [SSKProtoDataMessageContactEmail] = []
-        email = proto.email.map { SSKProtoDataMessageContactEmail($0) }
-
-        var address: [SSKProtoDataMessageContactPostalAddress] = []
-        address = proto.address.map { SSKProtoDataMessageContactPostalAddress($0) }
-
-        var avatar: SSKProtoDataMessageContactAvatar?
-        if proto.hasAvatar {
-            avatar = SSKProtoDataMessageContactAvatar(proto.avatar)
-        }
-
-        self.init(proto: proto,
-                  name: name,
-                  number: number,
-                  email: email,
-                  address: address,
-                  avatar: avatar)
+        self.init(proto: proto)
     }
 
     public required convenience init(from decoder: Swift.Decoder) throws {
@@ -7242,7 +7344,20 @@ public class SSKProtoDataMessagePayment: NSObject, Codable, NSSecureCoding {
     public let notification: SSKProtoDataMessagePaymentNotification?
 
     @objc
-    public let activation: SSKProtoDataMessagePaymentActivation?
+    public var activation: SSKProtoDataMessagePaymentActivation? {
+        guard proto.hasActivation else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let activation = _activation {
+                return activation
+            }
+            let activation = SSKProtoDataMessagePaymentActivation(proto.activation)
+            _activation = activation
+            return activation
+        }
+    }
+    private var _activation: SSKProtoDataMessagePaymentActivation?
 
     public var hasUnknownFields: Bool {
         return !proto.unknownFields.data.isEmpty
@@ -7253,11 +7368,9 @@ public class SSKProtoDataMessagePayment: NSObject, Codable, NSSecureCoding {
     }
 
     private init(proto: SignalServiceProtos_DataMessage.Payment,
-                 notification: SSKProtoDataMessagePaymentNotification?,
-                 activation: SSKProtoDataMessagePaymentActivation?) {
+                 notification: SSKProtoDataMessagePaymentNotification?) {
         self.proto = proto
         self.notification = notification
-        self.activation = activation
     }
 
     @objc
@@ -7277,14 +7390,8 @@ public class SSKProtoDataMessagePayment: NSObject, Codable, NSSecureCoding {
             notification = try SSKProtoDataMessagePaymentNotification(proto.notification)
         }
 
-        var activation: SSKProtoDataMessagePaymentActivation?
-        if proto.hasActivation {
-            activation = SSKProtoDataMessagePaymentActivation(proto.activation)
-        }
-
         self.init(proto: proto,
-                  notification: notification,
-                  activation: activation)
+                  notification: notification)
     }
 
     public required convenience init(from decoder: Swift.Decoder) throws {
@@ -7807,16 +7914,55 @@ public class SSKProtoDataMessage: NSObject, Codable, NSSecureCoding {
     fileprivate let proto: SignalServiceProtos_DataMessage
 
     @objc
-    public let attachments: [SSKProtoAttachmentPointer]
+    public var attachments: [SSKProtoAttachmentPointer] {
+        guard !proto.attachments.isEmpty else {
+            return []
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let attachments = _attachments {
+                return attachments
+            }
+            let attachments = proto.attachments.map { SSKProtoAttachmentPointer($0) }
+            _attachments = attachments
+            return attachments
+        }
+    }
+    private var _attachments: [SSKProtoAttachmentPointer]?
 
     @objc
-    public let groupV2: SSKProtoGroupContextV2?
+    public var groupV2: SSKProtoGroupContextV2? {
+        guard proto.hasGroupV2 else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let groupV2 = _groupV2 {
+                return groupV2
+            }
+            let groupV2 = SSKProtoGroupContextV2(proto.groupV2)
+            _groupV2 = groupV2
+            return groupV2
+        }
+    }
+    private var _groupV2: SSKProtoGroupContextV2?
 
     @objc
     public let quote: SSKProtoDataMessageQuote?
 
     @objc
-    public let contact: [SSKProtoDataMessageContact]
+    public var contact: [SSKProtoDataMessageContact] {
+        guard !proto.contact.isEmpty else {
+            return []
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let contact = _contact {
+                return contact
+            }
+            let contact = proto.contact.map { SSKProtoDataMessageContact($0) }
+            _contact = contact
+            return contact
+        }
+    }
+    private var _contact: [SSKProtoDataMessageContact]?
 
     @objc
     public let preview: [SSKProtoPreview]
@@ -7831,19 +7977,71 @@ public class SSKProtoDataMessage: NSObject, Codable, NSSecureCoding {
     public let delete: SSKProtoDataMessageDelete?
 
     @objc
-    public let bodyRanges: [SSKProtoBodyRange]
+    public var bodyRanges: [SSKProtoBodyRange] {
+        guard !proto.bodyRanges.isEmpty else {
+            return []
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let bodyRanges = _bodyRanges {
+                return bodyRanges
+            }
+            let bodyRanges = proto.bodyRanges.map { SSKProtoBodyRange($0) }
+            _bodyRanges = bodyRanges
+            return bodyRanges
+        }
+    }
+    private var _bodyRanges: [SSKProtoBodyRange]?
 
     @objc
-    public let groupCallUpdate: SSKProtoDataMessageGroupCallUpdate?
+    public var groupCallUpdate: SSKProtoDataMessageGroupCallUpdate? {
+        guard proto.hasGroupCallUpdate else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let groupCallUpdate = _groupCallUpdate {
+                return groupCallUpdate
+            }
+            let groupCallUpdate = SSKProtoDataMessageGroupCallUpdate(proto.groupCallUpdate)
+            _groupCallUpdate = groupCallUpdate
+            return groupCallUpdate
+        }
+    }
+    private var _groupCallUpdate: SSKProtoDataMessageGroupCallUpdate?
 
     @objc
     public let payment: SSKProtoDataMessagePayment?
 
     @objc
-    public let storyContext: SSKProtoDataMessageStoryContext?
+    public var storyContext: SSKProtoDataMessageStoryContext? {
+        guard proto.hasStoryContext else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let storyContext = _storyContext {
+                return storyContext
+            }
+            let storyContext = SSKProtoDataMessageStoryContext(proto.storyContext)
+            _storyContext = storyContext
+            return storyContext
+        }
+    }
+    private var _storyContext: SSKProtoDataMessageStoryContext?
 
     @objc
-    public let giftBadge: SSKProtoDataMessageGiftBadge?
+    public var giftBadge: SSKProtoDataMessageGiftBadge? {
+        guard proto.hasGiftBadge else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let giftBadge = _giftBadge {
+                return giftBadge
+            }
+            let giftBadge = SSKProtoDataMessageGiftBadge(proto.giftBadge)
+            _giftBadge = giftBadge
+            return giftBadge
+        }
+    }
+    private var _giftBadge: SSKProtoDataMessageGiftBadge?
 
     @objc
     public var body: String? {
@@ -7932,33 +8130,19 @@ public class SSKProtoDataMessage: NSObject, Codable, NSSecureCoding {
     }
 
     private init(proto: SignalServiceProtos_DataMessage,
-                 attachments: [SSKProtoAttachmentPointer],
-                 groupV2: SSKProtoGroupContextV2?,
                  quote: SSKProtoDataMessageQuote?,
-                 contact: [SSKProtoDataMessageContact],
                  preview: [SSKProtoPreview],
                  sticker: SSKProtoDataMessageSticker?,
                  reaction: SSKProtoDataMessageReaction?,
                  delete: SSKProtoDataMessageDelete?,
-                 bodyRanges: [SSKProtoBodyRange],
-                 groupCallUpdate: SSKProtoDataMessageGroupCallUpdate?,
-                 payment: SSKProtoDataMessagePayment?,
-                 storyContext: SSKProtoDataMessageStoryContext?,
-                 giftBadge: SSKProtoDataMessageGiftBadge?) {
+                 payment: SSKProtoDataMessagePayment?) {
         self.proto = proto
-        self.attachments = attachments
-        self.groupV2 = groupV2
         self.quote = quote
-        self.contact = contact
         self.preview = preview
         self.sticker = sticker
         self.reaction = reaction
         self.delete = delete
-        self.bodyRanges = bodyRanges
-        self.groupCallUpdate = groupCallUpdate
         self.payment = payment
-        self.storyContext = storyContext
-        self.giftBadge = giftBadge
     }
 
     @objc
@@ -7973,22 +8157,11 @@ public class SSKProtoDataMessage: NSObject, Codable, NSSecureCoding {
     }
 
     fileprivate convenience init(_ proto: SignalServiceProtos_DataMessage) throws {
-        var attachments: [SSKProtoAttachmentPointer] = []
-        attachments = proto.attachments.map { SSKProtoAttachmentPointer($0) }
-
-        var groupV2: SSKProtoGroupContextV2?
-        if proto.hasGroupV2 {
-            groupV2 = SSKProtoGroupContextV2(proto.groupV2)
-        }
-
         var quote: SSKProtoDataMessageQuote?
         if proto.hasQuote {
             quote = try SSKProtoDataMessageQuote(proto.quote)
         }
 
-        var contact: [SSKProtoDataMessageContact] = []
-        contact = proto.contact.map { SSKProtoDataMessageContact($0) }
-
         var preview: [SSKProtoPreview] = []
         preview = try proto.preview.map { try SSKProtoPreview($0) }
 
@@ -8007,43 +8180,18 @@ public class SSKProtoDataMessage: NSObject, Codable, NSSecureCoding {
             delete = try SSKProtoDataMessageDelete(proto.delete)
         }
 
-        var bodyRanges: [SSKProtoBodyRange] = []
-        bodyRanges = proto.bodyRanges.map { SSKProtoBodyRange($0) }
-
-        var groupCallUpdate: SSKProtoDataMessageGroupCallUpdate?
-        if proto.hasGroupCallUpdate {
-            groupCallUpdate = SSKProtoDataMessageGroupCallUpdate(proto.groupCallUpdate)
-        }
-
         var payment: SSKProtoDataMessagePayment?
         if proto.hasPayment {
             payment = try SSKProtoDataMessagePayment(proto.payment)
         }
 
-        var storyContext: SSKProtoDataMessageStoryContext?
-        if proto.hasStoryContext {
-            storyContext = SSKProtoDataMessageStoryContext(proto.storyContext)
-        }
-
-        var giftBadge: SSKProtoDataMessageGiftBadge?
-        if proto.hasGiftBadge {
-            giftBadge = SSKProtoDataMessageGiftBadge(proto.giftBadge)
-        }
-
         self.init(proto: proto,
-                  attachments: attachments,
-                  groupV2: groupV2,
                   quote: quote,
-                  contact: contact,
                   preview: preview,
                   sticker: sticker,
                   reaction: reaction,
                   delete: delete,
-                  bodyRanges: bodyRanges,
-                  groupCallUpdate: groupCallUpdate,
-                  payment: payment,
-                  storyContext: storyContext,
-                  giftBadge: giftBadge)
+                  payment: payment)
     }
 
     public required convenience init(from decoder: Swift.Decoder) throws {
@@ -9365,13 +9513,39 @@ public class SSKProtoSyncMessageSent: NSObject, Codable, NSSecureCoding {
     public let message: SSKProtoDataMessage?
 
     @objc
-    public let unidentifiedStatus: [SSKProtoSyncMessageSentUnidentifiedDeliveryStatus]
+    public var unidentifiedStatus: [SSKProtoSyncMessageSentUnidentifiedDeliveryStatus] {
+        guard !proto.unidentifiedStatus.isEmpty else {
+            return []
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let unidentifiedStatus = _unidentifiedStatus {
+                return unidentifiedStatus
+            }
+            let unidentifiedStatus = proto.unidentifiedStatus.map { SSKProtoSyncMessageSentUnidentifiedDeliveryStatus($0) }
+            _unidentifiedStatus = unidentifiedStatus
+            return unidentifiedStatus
+        }
+    }
+    private var _unidentifiedStatus: [SSKProtoSyncMessageSentUnidentifiedDeliveryStatus]?
 
     @objc
     public let storyMessage: SSKProtoStoryMessage?
 
     @objc
-    public let storyMessageRecipients: [SSKProtoSyncMessageSentStoryMessageRecipient]
+    public var storyMessageRecipients: [SSKProtoSyncMessageSentStoryMessageRecipient] {
+        guard !proto.storyMessageRecipients.isEmpty else {
+            return []
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let storyMessageRecipients = _storyMessageRecipients {
+                return storyMessageRecipients
+            }
+            let storyMessageRecipients = proto.storyMessageRecipients.map { SSKProtoSyncMessageSentStoryMessageRecipient($0) }
+            _storyMessageRecipients = storyMessageRecipients
+            return storyMessageRecipients
+        }
+    }
+    private var _storyMessageRecipients: [SSKProtoSyncMessageSentStoryMessageRecipient]?
 
     @objc
     public let editMessage: SSKProtoEditMessage?
@@ -9437,15 +9611,11 @@ public class SSKProtoSyncMessageSent: NSObject, Codable, NSSecureCoding {
 
     private init(proto: SignalServiceProtos_SyncMessage.Sent,
                  message: SSKProtoDataMessage?,
-                 unidentifiedStatus: [SSKProtoSyncMessageSentUnidentifiedDeliveryStatus],
                  storyMessage: SSKProtoStoryMessage?,
-                 storyMessageRecipients: [SSKProtoSyncMessageSentStoryMessageRecipient],
                  editMessage: SSKProtoEditMessage?) {
         self.proto = proto
         self.message = message
-        self.unidentifiedStatus = unidentifiedStatus
         self.storyMessage = storyMessage
-        self.storyMessageRecipients = storyMessageRecipients
         self.editMessage = editMessage
     }
 
@@ -9466,17 +9636,11 @@ public class SSKProtoSyncMessageSent: NSObject, Codable, NSSecureCoding {
             message = try SSKProtoDataMessage(proto.message)
         }
 
-        var unidentifiedStatus: [SSKProtoSyncMessageSentUnidentifiedDeliveryStatus] = []
-        unidentifiedStatus = proto.unidentifiedStatus.map { SSKProtoSyncMessageSentUnidentifiedDeliveryStatus($0) }
-
         var storyMessage: SSKProtoStoryMessage?
         if proto.hasStoryMessage {
             storyMessage = try SSKProtoStoryMessage(proto.storyMessage)
         }
 
-        var storyMessageRecipients: [SSKProtoSyncMessageSentStoryMessageRecipient] = []
-        storyMessageRecipients = proto.storyMessageRecipients.map { SSKProtoSyncMessageSentStoryMessageRecipient($0) }
-
         var editMessage: SSKProtoEditMessage?
         if proto.hasEditMessage {
             editMessage = try SSKProtoEditMessage(proto.editMessage)
@@ -9484,9 +9648,7 @@ public class SSKProtoSyncMessageSent: NSObject, Codable, NSSecureCoding {
 
         self.init(proto: proto,
                   message: message,
-                  unidentifiedStatus: unidentifiedStatus,
                   storyMessage: storyMessage,
-                  storyMessageRecipients: storyMessageRecipients,
                   editMessage: editMessage)
     }
 
@@ -13792,10 +13954,36 @@ public class SSKProtoSyncMessageDeleteForMeMessageDeletes: NSObject, Codable, NS
     fileprivate let proto: SignalServiceProtos_SyncMessage.DeleteForMe.MessageDeletes
 
     @objc
-    public let conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier?
+    public var conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier? {
+        guard proto.hasConversation else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let conversation = _conversation {
+                return conversation
+            }
+            let conversation = SSKProtoSyncMessageDeleteForMeConversationIdentifier(proto.conversation)
+            _conversation = conversation
+            return conversation
+        }
+    }
+    private var _conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier?
 
     @objc
-    public let messages: [SSKProtoSyncMessageDeleteForMeAddressableMessage]
+    public var messages: [SSKProtoSyncMessageDeleteForMeAddressableMessage] {
+        guard !proto.messages.isEmpty else {
+            return []
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let messages = _messages {
+                return messages
+            }
+            let messages = proto.messages.map { SSKProtoSyncMessageDeleteForMeAddressableMessage($0) }
+            _messages = messages
+            return messages
+        }
+    }
+    private var _messages: [SSKProtoSyncMessageDeleteForMeAddressableMessage]?
 
     public var hasUnknownFields: Bool {
         return !proto.unknownFields.data.isEmpty
@@ -13805,12 +13993,8 @@ public class SSKProtoSyncMessageDeleteForMeMessageDeletes: NSObject, Codable, NS
         return proto.unknownFields
     }
 
-    private init(proto: SignalServiceProtos_SyncMessage.DeleteForMe.MessageDeletes,
-                 conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier?,
-                 messages: [SSKProtoSyncMessageDeleteForMeAddressableMessage]) {
+    private init(proto: SignalServiceProtos_SyncMessage.DeleteForMe.MessageDeletes) {
         self.proto = proto
-        self.conversation = conversation
-        self.messages = messages
     }
 
     @objc
@@ -13825,17 +14009,7 @@ public class SSKProtoSyncMessageDeleteForMeMessageDeletes: NSObject, Codable, NS
     }
 
     fileprivate convenience init(_ proto: SignalServiceProtos_SyncMessage.DeleteForMe.MessageDeletes) {
-        var conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier?
-        if proto.hasConversation {
-            conversation = SSKProtoSyncMessageDeleteForMeConversationIdentifier(proto.conversation)
-        }
-
-        var messages: [SSKProtoSyncMessageDeleteForMeAddressableMessage] = []
-        messages = proto.messages.map { SSKProtoSyncMessageDeleteForMeAddressableMessage($0) }
-
-        self.init(proto: proto,
-                  conversation: conversation,
-                  messages: messages)
+        self.init(proto: proto)
     }
 
     public required convenience init(from decoder: Swift.Decoder) throws {
@@ -13965,10 +14139,36 @@ public class SSKProtoSyncMessageDeleteForMeAttachmentDelete: NSObject, Codable,
     fileprivate let proto: SignalServiceProtos_SyncMessage.DeleteForMe.AttachmentDelete
 
     @objc
-    public let conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier?
+    public var conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier? {
+        guard proto.hasConversation else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let conversation = _conversation {
+                return conversation
+            }
+            let conversation = SSKProtoSyncMessageDeleteForMeConversationIdentifier(proto.conversation)
+            _conversation = conversation
+            return conversation
+        }
+    }
+    private var _conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier?
 
     @objc
-    public let targetMessage: SSKProtoSyncMessageDeleteForMeAddressableMessage?
+    public var targetMessage: SSKProtoSyncMessageDeleteForMeAddressableMessage? {
+        guard proto.hasTargetMessage else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let targetMessage = _targetMessage {
+                return targetMessage
+            }
+            let targetMessage = SSKProtoSyncMessageDeleteForMeAddressableMessage(proto.targetMessage)
+            _targetMessage = targetMessage
+            return targetMessage
+        }
+    }
+    private var _targetMessage: SSKProtoSyncMessageDeleteForMeAddressableMessage?
 
     @objc
     public var clientUuid: Data? {
@@ -14014,12 +14214,8 @@ public class SSKProtoSyncMessageDeleteForMeAttachmentDelete: NSObject, Codable,
         return proto.unknownFields
     }
 
-    private init(proto: SignalServiceProtos_SyncMessage.DeleteForMe.AttachmentDelete,
-                 conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier?,
-                 targetMessage: SSKProtoSyncMessageDeleteForMeAddressableMessage?) {
+    private init(proto: SignalServiceProtos_SyncMessage.DeleteForMe.AttachmentDelete) {
         self.proto = proto
-        self.conversation = conversation
-        self.targetMessage = targetMessage
     }
 
     @objc
@@ -14034,19 +14230,7 @@ public class SSKProtoSyncMessageDeleteForMeAttachmentDelete: NSObject, Codable,
     }
 
     fileprivate convenience init(_ proto: SignalServiceProtos_SyncMessage.DeleteForMe.AttachmentDelete) {
-        var conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier?
-        if proto.hasConversation {
-            conversation = SSKProtoSyncMessageDeleteForMeConversationIdentifier(proto.conversation)
-        }
-
-        var targetMessage: SSKProtoSyncMessageDeleteForMeAddressableMessage?
-        if proto.hasTargetMessage {
-            targetMessage = SSKProtoSyncMessageDeleteForMeAddressableMessage(proto.targetMessage)
-        }
-
-        self.init(proto: proto,
-                  conversation: conversation,
-                  targetMessage: targetMessage)
+        self.init(proto: proto)
     }
 
     public required convenience init(from decoder: Swift.Decoder) throws {
@@ -14221,13 +14405,52 @@ public class SSKProtoSyncMessageDeleteForMeConversationDelete: NSObject, Codable
     fileprivate let proto: SignalServiceProtos_SyncMessage.DeleteForMe.ConversationDelete
 
     @objc
-    public let conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier?
+    public var conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier? {
+        guard proto.hasConversation else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let conversation = _conversation {
+                return conversation
+            }
+            let conversation = SSKProtoSyncMessageDeleteForMeConversationIdentifier(proto.conversation)
+            _conversation = conversation
+            return conversation
+        }
+    }
+    private var _conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier?
 
     @objc
-    public let mostRecentMessages: [SSKProtoSyncMessageDeleteForMeAddressableMessage]
+    public var mostRecentMessages: [SSKProtoSyncMessageDeleteForMeAddressableMessage] {
+        guard !proto.mostRecentMessages.isEmpty else {
+            return []
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let mostRecentMessages = _mostRecentMessages {
+                return mostRecentMessages
+            }
+            let mostRecentMessages = proto.mostRecentMessages.map { SSKProtoSyncMessageDeleteForMeAddressableMessage($0) }
+            _mostRecentMessages = mostRecentMessages
+            return mostRecentMessages
+        }
+    }
+    private var _mostRecentMessages: [SSKProtoSyncMessageDeleteForMeAddressableMessage]?
 
     @objc
-    public let mostRecentNonExpiringMessages: [SSKProtoSyncMessageDeleteForMeAddressableMessage]
+    public var mostRecentNonExpiringMessages: [SSKProtoSyncMessageDeleteForMeAddressableMessage] {
+        guard !proto.mostRecentNonExpiringMessages.isEmpty else {
+            return []
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let mostRecentNonExpiringMessages = _mostRecentNonExpiringMessages {
+                return mostRecentNonExpiringMessages
+            }
+            let mostRecentNonExpiringMessages = proto.mostRecentNonExpiringMessages.map { SSKProtoSyncMessageDeleteForMeAddressableMessage($0) }
+            _mostRecentNonExpiringMessages = mostRecentNonExpiringMessages
+            return mostRecentNonExpiringMessages
+        }
+    }
+    private var _mostRecentNonExpiringMessages: [SSKProtoSyncMessageDeleteForMeAddressableMessage]?
 
     @objc
     public var isFullDelete: Bool {
@@ -14246,14 +14469,8 @@ public class SSKProtoSyncMessageDeleteForMeConversationDelete: NSObject, Codable
         return proto.unknownFields
     }
 
-    private init(proto: SignalServiceProtos_SyncMessage.DeleteForMe.ConversationDelete,
-                 conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier?,
-                 mostRecentMessages: [SSKProtoSyncMessageDeleteForMeAddressableMessage],
-                 mostRecentNonExpiringMessages: [SSKProtoSyncMessageDeleteForMeAddressableMessage]) {
+    private init(proto: SignalServiceProtos_SyncMessage.DeleteForMe.ConversationDelete) {
         self.proto = proto
-        self.conversation = conversation
-        self.mostRecentMessages = mostRecentMessages
-        self.mostRecentNonExpiringMessages = mostRecentNonExpiringMessages
     }
 
     @objc
@@ -14268,21 +14485,7 @@ public class SSKProtoSyncMessageDeleteForMeConversationDelete: NSObject, Codable
     }
 
     fileprivate convenience init(_ proto: SignalServiceProtos_SyncMessage.DeleteForMe.ConversationDelete) {
-        var conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier?
-        if proto.hasConversation {
-            conversation = SSKProtoSyncMessageDeleteForMeConversationIdentifier(proto.conversation)
-        }
-
-        var mostRecentMessages: [SSKProtoSyncMessageDeleteForMeAddressableMessage] = []
-        mostRecentMessages = proto.mostRecentMessages.map { SSKProtoSyncMessageDeleteForMeAddressableMessage($0) }
-
-        var mostRecentNonExpiringMessages: [SSKProtoSyncMessageDeleteForMeAddressableMessage] = []
-        mostRecentNonExpiringMessages = proto.mostRecentNonExpiringMessages.map { SSKProtoSyncMessageDeleteForMeAddressableMessage($0) }
-
-        self.init(proto: proto,
-                  conversation: conversation,
-                  mostRecentMessages: mostRecentMessages,
-                  mostRecentNonExpiringMessages: mostRecentNonExpiringMessages)
+        self.init(proto: proto)
     }
 
     public required convenience init(from decoder: Swift.Decoder) throws {
@@ -14431,7 +14634,20 @@ public class SSKProtoSyncMessageDeleteForMeLocalOnlyConversationDelete: NSObject
     fileprivate let proto: SignalServiceProtos_SyncMessage.DeleteForMe.LocalOnlyConversationDelete
 
     @objc
-    public let conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier?
+    public var conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier? {
+        guard proto.hasConversation else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let conversation = _conversation {
+                return conversation
+            }
+            let conversation = SSKProtoSyncMessageDeleteForMeConversationIdentifier(proto.conversation)
+            _conversation = conversation
+            return conversation
+        }
+    }
+    private var _conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier?
 
     public var hasUnknownFields: Bool {
         return !proto.unknownFields.data.isEmpty
@@ -14441,10 +14657,8 @@ public class SSKProtoSyncMessageDeleteForMeLocalOnlyConversationDelete: NSObject
         return proto.unknownFields
     }
 
-    private init(proto: SignalServiceProtos_SyncMessage.DeleteForMe.LocalOnlyConversationDelete,
-                 conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier?) {
+    private init(proto: SignalServiceProtos_SyncMessage.DeleteForMe.LocalOnlyConversationDelete) {
         self.proto = proto
-        self.conversation = conversation
     }
 
     @objc
@@ -14459,13 +14673,7 @@ public class SSKProtoSyncMessageDeleteForMeLocalOnlyConversationDelete: NSObject
     }
 
     fileprivate convenience init(_ proto: SignalServiceProtos_SyncMessage.DeleteForMe.LocalOnlyConversationDelete) {
-        var conversation: SSKProtoSyncMessageDeleteForMeConversationIdentifier?
-        if proto.hasConversation {
-            conversation = SSKProtoSyncMessageDeleteForMeConversationIdentifier(proto.conversation)
-        }
-
-        self.init(proto: proto,
-                  conversation: conversation)
+        self.init(proto: proto)
     }
 
     public required convenience init(from decoder: Swift.Decoder) throws {
@@ -14584,16 +14792,68 @@ public class SSKProtoSyncMessageDeleteForMe: NSObject, Codable, NSSecureCoding {
     fileprivate let proto: SignalServiceProtos_SyncMessage.DeleteForMe
 
     @objc
-    public let messageDeletes: [SSKProtoSyncMessageDeleteForMeMessageDeletes]
+    public var messageDeletes: [SSKProtoSyncMessageDeleteForMeMessageDeletes] {
+        guard !proto.messageDeletes.isEmpty else {
+            return []
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let messageDeletes = _messageDeletes {
+                return messageDeletes
+            }
+            let messageDeletes = proto.messageDeletes.map { SSKProtoSyncMessageDeleteForMeMessageDeletes($0) }
+            _messageDeletes = messageDeletes
+            return messageDeletes
+        }
+    }
+    private var _messageDeletes: [SSKProtoSyncMessageDeleteForMeMessageDeletes]?
 
     @objc
-    public let conversationDeletes: [SSKProtoSyncMessageDeleteForMeConversationDelete]
+    public var conversationDeletes: [SSKProtoSyncMessageDeleteForMeConversationDelete] {
+        guard !proto.conversationDeletes.isEmpty else {
+            return []
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let conversationDeletes = _conversationDeletes {
+                return conversationDeletes
+            }
+            let conversationDeletes = proto.conversationDeletes.map { SSKProtoSyncMessageDeleteForMeConversationDelete($0) }
+            _conversationDeletes = conversationDeletes
+            return conversationDeletes
+        }
+    }
+    private var _conversationDeletes: [SSKProtoSyncMessageDeleteForMeConversationDelete]?
 
     @objc
-    public let localOnlyConversationDeletes: [SSKProtoSyncMessageDeleteForMeLocalOnlyConversationDelete]
+    public var localOnlyConversationDeletes: [SSKProtoSyncMessageDeleteForMeLocalOnlyConversationDelete] {
+        guard !proto.localOnlyConversationDeletes.isEmpty else {
+            return []
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let localOnlyConversationDeletes = _localOnlyConversationDeletes {
+                return localOnlyConversationDeletes
+            }
+            let localOnlyConversationDeletes = proto.localOnlyConversationDeletes.map { SSKProtoSyncMessageDeleteForMeLocalOnlyConversationDelete($0) }
+            _localOnlyConversationDeletes = localOnlyConversationDeletes
+            return localOnlyConversationDeletes
+        }
+    }
+    private var _localOnlyConversationDeletes: [SSKProtoSyncMessageDeleteForMeLocalOnlyConversationDelete]?
 
     @objc
-    public let attachmentDeletes: [SSKProtoSyncMessageDeleteForMeAttachmentDelete]
+    public var attachmentDeletes: [SSKProtoSyncMessageDeleteForMeAttachmentDelete] {
+        guard !proto.attachmentDeletes.isEmpty else {
+            return []
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let attachmentDeletes = _attachmentDeletes {
+                return attachmentDeletes
+            }
+            let attachmentDeletes = proto.attachmentDeletes.map { SSKProtoSyncMessageDeleteForMeAttachmentDelete($0) }
+            _attachmentDeletes = attachmentDeletes
+            return attachmentDeletes
+        }
+    }
+    private var _attachmentDeletes: [SSKProtoSyncMessageDeleteForMeAttachmentDelete]?
 
     public var hasUnknownFields: Bool {
         return !proto.unknownFields.data.isEmpty
@@ -14603,16 +14863,8 @@ public class SSKProtoSyncMessageDeleteForMe: NSObject, Codable, NSSecureCoding {
         return proto.unknownFields
     }
 
-    private init(proto: SignalServiceProtos_SyncMessage.DeleteForMe,
-                 messageDeletes: [SSKProtoSyncMessageDeleteForMeMessageDeletes],
-                 conversationDeletes: [SSKProtoSyncMessageDeleteForMeConversationDelete],
-                 localOnlyConversationDeletes: [SSKProtoSyncMessageDeleteForMeLocalOnlyConversationDelete],
-                 attachmentDeletes: [SSKProtoSyncMessageDeleteForMeAttachmentDelete]) {
+    private init(proto: SignalServiceProtos_SyncMessage.DeleteForMe) {
         self.proto = proto
-        self.messageDeletes = messageDeletes
-        self.conversationDeletes = conversationDeletes
-        self.localOnlyConversationDeletes = localOnlyConversationDeletes
-        self.attachmentDeletes = attachmentDeletes
     }
 
     @objc
@@ -14627,23 +14879,7 @@ public class SSKProtoSyncMessageDeleteForMe: NSObject, Codable, NSSecureCoding {
     }
 
     fileprivate convenience init(_ proto: SignalServiceProtos_SyncMessage.DeleteForMe) {
-        var messageDeletes: [SSKProtoSyncMessageDeleteForMeMessageDeletes] = []
-        messageDeletes = proto.messageDeletes.map { SSKProtoSyncMessageDeleteForMeMessageDeletes($0) }
-
-        var conversationDeletes: [SSKProtoSyncMessageDeleteForMeConversationDelete] = []
-        conversationDeletes = proto.conversationDeletes.map { SSKProtoSyncMessageDeleteForMeConversationDelete($0) }
-
-        var localOnlyConversationDeletes: [SSKProtoSyncMessageDeleteForMeLocalOnlyConversationDelete] = []
-        localOnlyConversationDeletes = proto.localOnlyConversationDeletes.map { SSKProtoSyncMessageDeleteForMeLocalOnlyConversationDelete($0) }
-
-        var attachmentDeletes: [SSKProtoSyncMessageDeleteForMeAttachmentDelete] = []
-        attachmentDeletes = proto.attachmentDeletes.map { SSKProtoSyncMessageDeleteForMeAttachmentDelete($0) }
-
-        self.init(proto: proto,
-                  messageDeletes: messageDeletes,
-                  conversationDeletes: conversationDeletes,
-                  localOnlyConversationDeletes: localOnlyConversationDeletes,
-                  attachmentDeletes: attachmentDeletes)
+        self.init(proto: proto)
     }
 
     public required convenience init(from decoder: Swift.Decoder) throws {
@@ -14798,19 +15034,71 @@ public class SSKProtoSyncMessage: NSObject, Codable, NSSecureCoding {
     public let contacts: SSKProtoSyncMessageContacts?
 
     @objc
-    public let request: SSKProtoSyncMessageRequest?
+    public var request: SSKProtoSyncMessageRequest? {
+        guard proto.hasRequest else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let request = _request {
+                return request
+            }
+            let request = SSKProtoSyncMessageRequest(proto.request)
+            _request = request
+            return request
+        }
+    }
+    private var _request: SSKProtoSyncMessageRequest?
 
     @objc
     public let read: [SSKProtoSyncMessageRead]
 
     @objc
-    public let blocked: SSKProtoSyncMessageBlocked?
+    public var blocked: SSKProtoSyncMessageBlocked? {
+        guard proto.hasBlocked else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let blocked = _blocked {
+                return blocked
+            }
+            let blocked = SSKProtoSyncMessageBlocked(proto.blocked)
+            _blocked = blocked
+            return blocked
+        }
+    }
+    private var _blocked: SSKProtoSyncMessageBlocked?
 
     @objc
-    public let verified: SSKProtoVerified?
+    public var verified: SSKProtoVerified? {
+        guard proto.hasVerified else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let verified = _verified {
+                return verified
+            }
+            let verified = SSKProtoVerified(proto.verified)
+            _verified = verified
+            return verified
+        }
+    }
+    private var _verified: SSKProtoVerified?
 
     @objc
-    public let configuration: SSKProtoSyncMessageConfiguration?
+    public var configuration: SSKProtoSyncMessageConfiguration? {
+        guard proto.hasConfiguration else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let configuration = _configuration {
+                return configuration
+            }
+            let configuration = SSKProtoSyncMessageConfiguration(proto.configuration)
+            _configuration = configuration
+            return configuration
+        }
+    }
+    private var _configuration: SSKProtoSyncMessageConfiguration?
 
     @objc
     public let stickerPackOperation: [SSKProtoSyncMessageStickerPackOperation]
@@ -14819,13 +15107,52 @@ public class SSKProtoSyncMessage: NSObject, Codable, NSSecureCoding {
     public let viewOnceOpen: SSKProtoSyncMessageViewOnceOpen?
 
     @objc
-    public let fetchLatest: SSKProtoSyncMessageFetchLatest?
+    public var fetchLatest: SSKProtoSyncMessageFetchLatest? {
+        guard proto.hasFetchLatest else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let fetchLatest = _fetchLatest {
+                return fetchLatest
+            }
+            let fetchLatest = SSKProtoSyncMessageFetchLatest(proto.fetchLatest)
+            _fetchLatest = fetchLatest
+            return fetchLatest
+        }
+    }
+    private var _fetchLatest: SSKProtoSyncMessageFetchLatest?
 
     @objc
-    public let keys: SSKProtoSyncMessageKeys?
+    public var keys: SSKProtoSyncMessageKeys? {
+        guard proto.hasKeys else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let keys = _keys {
+                return keys
+            }
+            let keys = SSKProtoSyncMessageKeys(proto.keys)
+            _keys = keys
+            return keys
+        }
+    }
+    private var _keys: SSKProtoSyncMessageKeys?
 
     @objc
-    public let messageRequestResponse: SSKProtoSyncMessageMessageRequestResponse?
+    public var messageRequestResponse: SSKProtoSyncMessageMessageRequestResponse? {
+        guard proto.hasMessageRequestResponse else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let messageRequestResponse = _messageRequestResponse {
+                return messageRequestResponse
+            }
+            let messageRequestResponse = SSKProtoSyncMessageMessageRequestResponse(proto.messageRequestResponse)
+            _messageRequestResponse = messageRequestResponse
+            return messageRequestResponse
+        }
+    }
+    private var _messageRequestResponse: SSKProtoSyncMessageMessageRequestResponse?
 
     @objc
     public let outgoingPayment: SSKProtoSyncMessageOutgoingPayment?
@@ -14834,19 +15161,84 @@ public class SSKProtoSyncMessage: NSObject, Codable, NSSecureCoding {
     public let viewed: [SSKProtoSyncMessageViewed]
 
     @objc
-    public let pniChangeNumber: SSKProtoSyncMessagePniChangeNumber?
+    public var pniChangeNumber: SSKProtoSyncMessagePniChangeNumber? {
+        guard proto.hasPniChangeNumber else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let pniChangeNumber = _pniChangeNumber {
+                return pniChangeNumber
+            }
+            let pniChangeNumber = SSKProtoSyncMessagePniChangeNumber(proto.pniChangeNumber)
+            _pniChangeNumber = pniChangeNumber
+            return pniChangeNumber
+        }
+    }
+    private var _pniChangeNumber: SSKProtoSyncMessagePniChangeNumber?
 
     @objc
-    public let callEvent: SSKProtoSyncMessageCallEvent?
+    public var callEvent: SSKProtoSyncMessageCallEvent? {
+        guard proto.hasCallEvent else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let callEvent = _callEvent {
+                return callEvent
+            }
+            let callEvent = SSKProtoSyncMessageCallEvent(proto.callEvent)
+            _callEvent = callEvent
+            return callEvent
+        }
+    }
+    private var _callEvent: SSKProtoSyncMessageCallEvent?
 
     @objc
-    public let callLinkUpdate: SSKProtoSyncMessageCallLinkUpdate?
+    public var callLinkUpdate: SSKProtoSyncMessageCallLinkUpdate? {
+        guard proto.hasCallLinkUpdate else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let callLinkUpdate = _callLinkUpdate {
+                return callLinkUpdate
+            }
+            let callLinkUpdate = SSKProtoSyncMessageCallLinkUpdate(proto.callLinkUpdate)
+            _callLinkUpdate = callLinkUpdate
+            return callLinkUpdate
+        }
+    }
+    private var _callLinkUpdate: SSKProtoSyncMessageCallLinkUpdate?
 
     @objc
-    public let callLogEvent: SSKProtoSyncMessageCallLogEvent?
+    public var callLogEvent: SSKProtoSyncMessageCallLogEvent? {
+        guard proto.hasCallLogEvent else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let callLogEvent = _callLogEvent {
+                return callLogEvent
+            }
+            let callLogEvent = SSKProtoSyncMessageCallLogEvent(proto.callLogEvent)
+            _callLogEvent = callLogEvent
+            return callLogEvent
+        }
+    }
+    private var _callLogEvent: SSKProtoSyncMessageCallLogEvent?
 
     @objc
-    public let deleteForMe: SSKProtoSyncMessageDeleteForMe?
+    public var deleteForMe: SSKProtoSyncMessageDeleteForMe? {
+        guard proto.hasDeleteForMe else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let deleteForMe = _deleteForMe {
+                return deleteForMe
+            }
+            let deleteForMe = SSKProtoSyncMessageDeleteForMe(proto.deleteForMe)
+            _deleteForMe = deleteForMe
+            return deleteForMe
+        }
+    }
+    private var _deleteForMe: SSKProtoSyncMessageDeleteForMe?
 
     @objc
     public var padding: Data? {
@@ -14871,43 +15263,19 @@ public class SSKProtoSyncMessage: NSObject, Codable, NSSecureCoding {
     private init(proto: SignalServiceProtos_SyncMessage,
                  sent: SSKProtoSyncMessageSent?,
                  contacts: SSKProtoSyncMessageContacts?,
-                 request: SSKProtoSyncMessageRequest?,
                  read: [SSKProtoSyncMessageRead],
-                 blocked: SSKProtoSyncMessageBlocked?,
-                 verified: SSKProtoVerified?,
-                 configuration: SSKProtoSyncMessageConfiguration?,
                  stickerPackOperation: [SSKProtoSyncMessageStickerPackOperation],
                  viewOnceOpen: SSKProtoSyncMessageViewOnceOpen?,
-                 fetchLatest: SSKProtoSyncMessageFetchLatest?,
-                 keys: SSKProtoSyncMessageKeys?,
-                 messageRequestResponse: SSKProtoSyncMessageMessageRequestResponse?,
                  outgoingPayment: SSKProtoSyncMessageOutgoingPayment?,
-                 viewed: [SSKProtoSyncMessageViewed],
-                 pniChangeNumber: SSKProtoSyncMessagePniChangeNumber?,
-                 callEvent: SSKProtoSyncMessageCallEvent?,
-                 callLinkUpdate: SSKProtoSyncMessageCallLinkUpdate?,
-                 callLogEvent: SSKProtoSyncMessageCallLogEvent?,
-                 deleteForMe: SSKProtoSyncMessageDeleteForMe?) {
+                 viewed: [SSKProtoSyncMessageViewed]) {
         self.proto = proto
         self.sent = sent
         self.contacts = contacts
-        self.request = request
         self.read = read
-        self.blocked = blocked
-        self.verified = verified
-        self.configuration = configuration
         self.stickerPackOperation = stickerPackOperation
         self.viewOnceOpen = viewOnceOpen
-        self.fetchLatest = fetchLatest
-        self.keys = keys
-        self.messageRequestResponse = messageRequestResponse
         self.outgoingPayment = outgoingPayment
         self.viewed = viewed
-        self.pniChangeNumber = pniChangeNumber
-        self.callEvent = callEvent
-        self.callLinkUpdate = callLinkUpdate
-        self.callLogEvent = callLogEvent
-        self.deleteForMe = deleteForMe
     }
 
     @objc
@@ -14932,29 +15300,9 @@ public class SSKProtoSyncMessage: NSObject, Codable, NSSecureCoding {
             contacts = try SSKProtoSyncMessageContacts(proto.contacts)
         }
 
-        var request: SSKProtoSyncMessageRequest?
-        if proto.hasRequest {
-            request = SSKProtoSyncMessageRequest(proto.request)
-        }
-
         var read: [SSKProtoSyncMessageRead] = []
         read = try proto.read.map { try SSKProtoSyncMessageRead($0) }
 
-        var blocked: SSKProtoSyncMessageBlocked?
-        if proto.hasBlocked {
-            blocked = SSKProtoSyncMessageBlocked(proto.blocked)
-        }
-
-        var verified: SSKProtoVerified?
-        if proto.hasVerified {
-            verified = SSKProtoVerified(proto.verified)
-        }
-
-        var configuration: SSKProtoSyncMessageConfiguration?
-        if proto.hasConfiguration {
-            configuration = SSKProtoSyncMessageConfiguration(proto.configuration)
-        }
-
         var stickerPackOperation: [SSKProtoSyncMessageStickerPackOperation] = []
         stickerPackOperation = try proto.stickerPackOperation.map { try SSKProtoSyncMessageStickerPackOperation($0) }
 
@@ -14963,21 +15311,6 @@ public class SSKProtoSyncMessage: NSObject, Codable, NSSecureCoding {
             viewOnceOpen = try SSKProtoSyncMessageViewOnceOpen(proto.viewOnceOpen)
         }
 
-        var fetchLatest: SSKProtoSyncMessageFetchLatest?
-        if proto.hasFetchLatest {
-            fetchLatest = SSKProtoSyncMessageFetchLatest(proto.fetchLatest)
-        }
-
-        var keys: SSKProtoSyncMessageKeys?
-        if proto.hasKeys {
-            keys = SSKProtoSyncMessageKeys(proto.keys)
-        }
-
-        var messageRequestResponse: SSKProtoSyncMessageMessageRequestResponse?
-        if proto.hasMessageRequestResponse {
-            messageRequestResponse = SSKProtoSyncMessageMessageRequestResponse(proto.messageRequestResponse)
-        }
-
         var outgoingPayment: SSKProtoSyncMessageOutgoingPayment?
         if proto.hasOutgoingPayment {
             outgoingPayment = try SSKProtoSyncMessageOutgoingPayment(proto.outgoingPayment)
@@ -14986,51 +15319,14 @@ public class SSKProtoSyncMessage: NSObject, Codable, NSSecureCoding {
         var viewed: [SSKProtoSyncMessageViewed] = []
         viewed = try proto.viewed.map { try SSKProtoSyncMessageViewed($0) }
 
-        var pniChangeNumber: SSKProtoSyncMessagePniChangeNumber?
-        if proto.hasPniChangeNumber {
-            pniChangeNumber = SSKProtoSyncMessagePniChangeNumber(proto.pniChangeNumber)
-        }
-
-        var callEvent: SSKProtoSyncMessageCallEvent?
-        if proto.hasCallEvent {
-            callEvent = SSKProtoSyncMessageCallEvent(proto.callEvent)
-        }
-
-        var callLinkUpdate: SSKProtoSyncMessageCallLinkUpdate?
-        if proto.hasCallLinkUpdate {
-            callLinkUpdate = SSKProtoSyncMessageCallLinkUpdate(proto.callLinkUpdate)
-        }
-
-        var callLogEvent: SSKProtoSyncMessageCallLogEvent?
-        if proto.hasCallLogEvent {
-            callLogEvent = SSKProtoSyncMessageCallLogEvent(proto.callLogEvent)
-        }
-
-        var deleteForMe: SSKProtoSyncMessageDeleteForMe?
-        if proto.hasDeleteForMe {
-            deleteForMe = SSKProtoSyncMessageDeleteForMe(proto.deleteForMe)
-        }
-
         self.init(proto: proto,
                   sent: sent,
                   contacts: contacts,
-                  request: request,
                   read: read,
-                  blocked: blocked,
-                  verified: verified,
-                  configuration: configuration,
                   stickerPackOperation: stickerPackOperation,
                   viewOnceOpen: viewOnceOpen,
-                  fetchLatest: fetchLatest,
-                  keys: keys,
-                  messageRequestResponse: messageRequestResponse,
                   outgoingPayment: outgoingPayment,
-                  viewed: viewed,
-                  pniChangeNumber: pniChangeNumber,
-                  callEvent: callEvent,
-                  callLinkUpdate: callLinkUpdate,
-                  callLogEvent: callLogEvent,
-                  deleteForMe: deleteForMe)
+                  viewed: viewed)
     }
 
     public required convenience init(from decoder: Swift.Decoder) throws {
@@ -16280,7 +16576,20 @@ public class SSKProtoContactDetails: NSObject, Codable, NSSecureCoding {
     fileprivate let proto: SignalServiceProtos_ContactDetails
 
     @objc
-    public let avatar: SSKProtoContactDetailsAvatar?
+    public var avatar: SSKProtoContactDetailsAvatar? {
+        guard proto.hasAvatar else {
+            return nil
+        }
+        return ProtoWrapperCache.withLock(for: self) {
+            if let avatar = _avatar {
+                return avatar
+            }
+            let avatar = SSKProtoContactDetailsAvatar(proto.avatar)
+            _avatar = avatar
+            return avatar
+        }
+    }
+    private var _avatar: SSKProtoContactDetailsAvatar?
 
     @objc
     public var contactE164: String? {
@@ -16353,10 +16662,8 @@ public class SSKProtoContactDetails: NSObject, Codable, NSSecureCoding {
         return proto.unknownFields
     }
 
-    private init(proto: SignalServiceProtos_ContactDetails,
-                 avatar: SSKProtoContactDetailsAvatar?) {
+    private init(proto: SignalServiceProtos_ContactDetails) {
         self.proto = proto
-        self.avatar = avatar
     }
 
     @objc
@@ -16371,13 +16678,7 @@ public class SSKProtoContactDetails: NSObject, Codable, NSSecureCoding {
     }
 
     fileprivate convenience init(_ proto: SignalServiceProtos_ContactDetails) {
-        var avatar: SSKProtoContactDetailsAvatar?
-        if proto.hasAvatar {
-            avatar = SSKProtoContactDetailsAvatar(proto.avatar)
-        }
-
-        self.init(proto: proto,
-                  avatar: avatar)
+        self.init(proto: proto)
     }
 
     public required convenience init(from decoder: Swift.Decoder) throws {
@@ -0,0 +1,23 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// Guards the nested wrappers that generated proto wrapper classes build on
+/// first access (see `ProtoWrappers.py`).
+///
+/// Wrappers are immutable and read from any thread, so caching a nested
+/// wrapper needs a lock. Rather than allocate a lock for every wrapper, a
+/// small fixed set is shared and picked by the wrapper's address.
+enum ProtoWrapperCache {
+    private static let locks: [UnfairLock] = (0..<16).map { _ in UnfairLock() }
+
+    static func withLock<T>(for wrapper: AnyObject, _ block: () -> T) -> T {
+        // Objects are at least 16-byte aligned, so skip the low bits.
+        let address = UInt(bitPattern: ObjectIdentifier(wrapper))
+        let lock = locks[Int((address >> 4) % UInt(locks.count))]
+        return lock.withLock(block)
+    }
+}
@@ -955,6 +955,7 @@ CREATE
             ,"sentTimestamp" INTEGER NOT NULL
             ,"uniqueThreadId" TEXT NOT NULL
             ,"sendComplete" BOOLEAN NOT NULL DEFAULT 0
+            ,"isCompressed" BOOLEAN NOT NULL DEFAULT 0
         )
 ;
 
@@ -1063,19 +1064,6 @@ WHERE
     recordType IS NOT 70
 ;
 
-CREATE
-    INDEX index_model_TSInteraction_ConversationLoadInteractionDistance
-        ON model_TSInteraction (
-        uniqueThreadId
-        ,id
-        ,isGroupStoryReply
-        ,recordType
-        ,uniqueId
-    )
-WHERE
-    recordType IS NOT 70
-;
-
 CREATE
     INDEX "index_model_TSInteraction_UnreadMessages"
         ON "model_TSInteraction" (
@@ -2071,3 +2059,284 @@ CREATE
                 CASCADE
 )
 ;
+
+CREATE
+    INDEX index_model_TSInteraction_ConversationViewKeyset
+        ON model_TSInteraction (
+        uniqueThreadId
+        ,id
+        ,isGroupStoryReply
+        ,editState
+        ,recordType
+        ,uniqueId
+    )
+WHERE
+    recordType IS NOT 70
+;
+
+CREATE
+    TABLE
+        IF NOT EXISTS "PendingFullTextSearchIndex" (
+            "interactionRowId" INTEGER PRIMARY KEY
+                ON CONFLICT IGNORE NOT NULL REFERENCES "model_TSInteraction"("id"
+        )
+            ON DELETE
+                CASCADE
+)
+;
+
+CREATE
+    TABLE
+        IF NOT EXISTS "ThreadUnreadCount" (
+            "threadUniqueId" TEXT PRIMARY KEY NOT NULL
+            ,"unreadCount" INTEGER NOT NULL DEFAULT 0
+        )
+;
+
+CREATE
+    TRIGGER "__ThreadUnreadCount_ai" AFTER INSERT
+                ON "model_TSInteraction"
+                WHEN (
+                        NEW.read IS 0
+                        AND NEW.isGroupStoryReply IS NOT 1
+                        AND (
+                            NEW.editState IN (
+                                0
+                                ,3
+                            )
+                            OR NEW.editState IS NULL
+                        )
+                        AND (
+                            NEW.recordType IS 19
+                            OR (
+                                NEW.recordType IS 10
+                                AND NEW.messageType IS 11
+                            )
+                        )
+                    ) BEGIN INSERT
+                    OR IGNORE INTO
+                        ThreadUnreadCount (threadUniqueId)
+                    VALUES (NEW.uniqueThreadId)
+;
+
+UPDATE
+    ThreadUnreadCount
+SET
+    unreadCount = unreadCount + 1
+WHERE
+    threadUniqueId = NEW.uniqueThreadId
+;
+
+END
+;
+
+CREATE
+    TRIGGER "__ThreadUnreadCount_ad" AFTER DELETE
+                ON "model_TSInteraction"
+                WHEN (
+                        OLD.read IS 0
+                        AND OLD.isGroupStoryReply IS NOT 1
+                        AND (
+                            OLD.editState IN (
+                                0
+                                ,3
+                            )
+                            OR OLD.editState IS NULL
+                        )
+                        AND (
+                            OLD.recordType IS 19
+                            OR (
+                                OLD.recordType IS 10
+                                AND OLD.messageType IS 11
+                            )
+                        )
+                    ) BEGIN UPDATE
+                    ThreadUnreadCount
+                SET
+                    unreadCount = unreadCount - 1
+                WHERE
+                    threadUniqueId = OLD.uniqueThreadId
+;
+
+END
+;
+
+CREATE
+    TRIGGER "__ThreadUnreadCount_au" AFTER UPDATE
+            OF read
+            ,isGroupStoryReply
+            ,editState
+            ,recordType
+            ,messageType
+            ,uniqueThreadId
+                ON "model_TSInteraction"
+                WHEN (
+                        OLD.read IS 0
+                        AND OLD.isGroupStoryReply IS NOT 1
+                        AND (
+                            OLD.editState IN (
+                                0
+                                ,3
+                            )
+                            OR OLD.editState IS NULL
+                        )
+                        AND (
+                            OLD.recordType IS 19
+                            OR (
+                                OLD.recordType IS 10
+                                AND OLD.messageType IS 11
+                            )
+                        )
+                    ) IS NOT (
+                        NEW.read IS 0
+                        AND NEW.isGroupStoryReply IS NOT 1
+                        AND (
+                            NEW.editState IN (
+                                0
+                                ,3
+                            )
+                            OR NEW.editState IS NULL
+                        )
+                        AND (
+                            NEW.recordType IS 19
+                            OR (
+                                NEW.recordType IS 10
+                                AND NEW.messageType IS 11
+                            )
+                        )
+                    )
+                OR OLD.uniqueThreadId IS NOT NEW.uniqueThreadId BEGIN UPDATE
+                    ThreadUnreadCount
+                SET
+                    unreadCount = unreadCount - 1
+                WHERE
+                    threadUniqueId = OLD.uniqueThreadId
+                    AND (
+                        OLD.read IS 0
+                        AND OLD.isGroupStoryReply IS NOT 1
+                        AND (
+                            OLD.editState IN (
+                                0
+                                ,3
+                            )
+                            OR OLD.editState IS NULL
+                        )
+                        AND (
+                            OLD.recordType IS 19
+                            OR (
+                                OLD.recordType IS 10
+                                AND OLD.messageType IS 11
+                            )
+                        )
+                    )
+;
+
+INSERT
+    OR IGNORE INTO
+        ThreadUnreadCount (threadUniqueId) SELECT
+                NEW.uniqueThreadId
+            WHERE
+                (
+                        NEW.read IS 0
+                        AND NEW.isGroupStoryReply IS NOT 1
+                        AND (
+                            NEW.editState IN (
+                                0
+                                ,3
+                            )
+                            OR NEW.editState IS NULL
+                        )
+                        AND (
+                            NEW.recordType IS 19
+                            OR (
+                                NEW.recordType IS 10
+                                AND NEW.messageType IS 11
+                            )
+                        )
+                    )
+;
+
+UPDATE
+    ThreadUnreadCount
+SET
+    unreadCount = unreadCount + 1
+WHERE
+    threadUniqueId = NEW.uniqueThreadId
+    AND (
+                        NEW.read IS 0
+                        AND NEW.isGroupStoryReply IS NOT 1
+                        AND (
+                            NEW.editState IN (
+                                0
+                                ,3
+                            )
+                            OR NEW.editState IS NULL
+                        )
+                        AND (
+                            NEW.recordType IS 19
+                            OR (
+                                NEW.recordType IS 10
+                                AND NEW.messageType IS 11
+                            )
+                        )
+                    )
+;
+
+END
+;
+
+CREATE
+    TRIGGER "__ThreadUnreadCount_thread_ad" AFTER DELETE
+                ON "model_TSThread" BEGIN DELETE
+                FROM
+                    ThreadUnreadCount
+                WHERE
+                    threadUniqueId = OLD.uniqueId
+;
+
+END
+;
+
+CREATE
+    TABLE
+        IF NOT EXISTS "PaymentModelKey" (
+            "paymentModelRowId" INTEGER NOT NULL REFERENCES "model_TSPaymentModel"("id"
+        )
+            ON DELETE
+                CASCADE
+                ,"kind" INTEGER NOT NULL
+                ,"key" BLOB NOT NULL
+                ,PRIMARY KEY (
+                    "paymentModelRowId"
+                    ,"kind"
+                    ,"key"
+                )
+                    ON CONFLICT IGNORE
+)
+;
+
+CREATE
+    INDEX "index_PaymentModelKey_on_kind_and_key"
+        ON "PaymentModelKey"("kind"
+    ,"key"
+)
+;
+
+CREATE
+    TABLE
+        IF NOT EXISTS "EarlyMessage" (
+            "id" INTEGER PRIMARY KEY AUTOINCREMENT NOT NULL
+            ,"targetAuthorAci" BLOB NOT NULL
+            ,"targetTimestamp" INTEGER NOT NULL
+            ,"kind" INTEGER NOT NULL
+            ,"payload" BLOB NOT NULL
+        )
+;
+
+CREATE
+    INDEX "index_EarlyMessage_on_targetTimestamp_and_targetAuthorAci_and_kind"
+        ON "EarlyMessage"("targetTimestamp"
+    ,"targetAuthorAci"
+    ,"kind"
+)
+;
@@ -227,21 +227,24 @@ public class SSKEnvironment: NSObject {
     public static let warmCachesNotification = Notification.Name("WarmCachesNotification")
 
     func warmCaches() {
-        SignalProxy.warmCaches()
-        DependenciesBridge.shared.tsAccountManager.warmCaches()
-        fixLocalRecipientIfNeeded()
-        signalServiceAddressCache.warmCaches()
-        signalService.warmCaches()
-        remoteConfigManager.warmCaches()
-        blockingManager.warmCaches()
-        profileManager.warmCaches()
-        receiptManager.prepareCachedValues()
-        DependenciesBridge.shared.svr.warmCaches()
-        typingIndicatorsImpl.warmCaches()
-        paymentsHelper.warmCaches()
-        paymentsCurrencies.warmCaches()
-        StoryManager.setup()
-        DependenciesBridge.shared.db.read { tx in appExpiryRef.warmCaches(with: tx) }
+        let launchTimeline = LaunchTimeline.shared
+        launchTimeline.measure("SignalProxy") { SignalProxy.warmCaches() }
+        launchTimeline.measure("TSAccountManager") { DependenciesBridge.shared.tsAccountManager.warmCaches() }
+        launchTimeline.measure("FixLocalRecipient") { fixLocalRecipientIfNeeded() }
+        launchTimeline.measure("SignalServiceAddressCache") { signalServiceAddressCache.warmCaches() }
+        launchTimeline.measure("SignalService") { signalService.warmCaches() }
+        launchTimeline.measure("RemoteConfigManager") { remoteConfigManager.warmCaches() }
+        launchTimeline.measure("BlockingManager") { blockingManager.warmCaches() }
+        launchTimeline.measure("ProfileManager") { profileManager.warmCaches() }
+        launchTimeline.measure("ReceiptManager") { receiptManager.prepareCachedValues() }
+        launchTimeline.measure("SVR") { DependenciesBridge.shared.svr.warmCaches() }
+        launchTimeline.measure("TypingIndicators") { typingIndicatorsImpl.warmCaches() }
+        launchTimeline.measure("PaymentsHelper") { paymentsHelper.warmCaches() }
+        launchTimeline.measure("PaymentsCurrencies") { paymentsCurrencies.warmCaches() }
+        launchTimeline.measure("StoryManager") { StoryManager.setup() }
+        launchTimeline.measure("AppExpiry") {
+            DependenciesBridge.shared.db.read { tx in appExpiryRef.warmCaches(with: tx) }
+        }
 
         AppReadiness.runNowOrWhenAppDidBecomeReadyAsync {
             self.localUserLeaveGroupJobQueueRef.start(appContext: CurrentAppContext())
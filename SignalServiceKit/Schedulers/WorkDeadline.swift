@@ -0,0 +1,118 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+public struct WorkDeadlineExpiredError: Error {}
+
+/// When some piece of work stops being worth doing, and how urgent it is
+/// until then.
+///
+/// Pass one along a promise chain (`Scheduler.async(_:deadline:execute:)`,
+/// `ChainedPromise.enqueue(deadline:_:)`) or bind it to a Task
+/// (`withCooperativeTimeout(deadline:operation:)`) so that work which only
+/// gets to run after the deadline is dropped instead of started. This
+/// matters most in the NSE, where anything still running when the budget
+/// runs out is wasted.
+public struct WorkDeadline {
+    public let date: MonotonicDate
+    public let qos: DispatchQoS.QoSClass
+
+    public init(date: MonotonicDate, qos: DispatchQoS.QoSClass = .default) {
+        self.date = date
+        self.qos = qos
+    }
+
+    public init(secondsFromNow seconds: TimeInterval, qos: DispatchQoS.QoSClass = .default) {
+        self.init(date: MonotonicDate().adding(seconds), qos: qos)
+    }
+
+    public var isExpired: Bool {
+        return MonotonicDate() >= date
+    }
+
+    /// How long until the deadline, or 0 if it has passed.
+    public var remainingInterval: TimeInterval {
+        let now = MonotonicDate()
+        guard now < date else {
+            return 0
+        }
+        return TimeInterval(date - now) / TimeInterval(NSEC_PER_SEC)
+    }
+
+    /// Throws `WorkDeadlineExpiredError` if the deadline has passed.
+    public func checkNotExpired() throws {
+        if isExpired {
+            throw WorkDeadlineExpiredError()
+        }
+    }
+
+    /// The Swift concurrency priority matching `qos`.
+    public var taskPriority: TaskPriority {
+        switch qos {
+        case .userInteractive, .userInitiated:
+            return .userInitiated
+        case .utility:
+            return .utility
+        case .background:
+            return .background
+        case .default, .unspecified:
+            return .medium
+        @unknown default:
+            return .medium
+        }
+    }
+
+    /// The deadline of the surrounding `withCooperativeTimeout(deadline:operation:)`, if any.
+    @TaskLocal
+    public static var current: WorkDeadline?
+}
+
+// MARK: -
+
+/// Invokes `operation` in a Task at `deadline`'s priority that's canceled
+/// when `deadline` passes. `WorkDeadline.current` is set to `deadline` (or
+/// an earlier enclosing deadline) for the duration.
+///
+/// If `deadline` has already passed, `operation` isn't invoked and
+/// `WorkDeadlineExpiredError` is thrown. Otherwise this behaves like
+/// `withCooperativeTimeout(seconds:operation:)`.
+public func withCooperativeTimeout<T>(
+    deadline: WorkDeadline,
+    operation: @escaping () async throws -> T
+) async throws -> T {
+    var deadline = deadline
+    if let enclosingDeadline = WorkDeadline.current, enclosingDeadline.date < deadline.date {
+        deadline = WorkDeadline(date: enclosingDeadline.date, qos: deadline.qos)
+    }
+    try deadline.checkNotExpired()
+    return try await WorkDeadline.$current.withValue(deadline) {
+        let task = Task(priority: deadline.taskPriority) {
+            try await withCooperativeTimeout(seconds: deadline.remainingInterval, operation: operation)
+        }
+        return try await withTaskCancellationHandler(
+            operation: { try await task.value },
+            onCancel: { task.cancel() }
+        )
+    }
+}
+
+// MARK: -
+
+public extension Scheduler {
+
+    /// Like `async(_:execute:)`, but if `deadline` has passed by the time
+    /// `work` would start, rejects with `WorkDeadlineExpiredError` instead.
+    func async<T>(
+        _ namespace: PromiseNamespace,
+        deadline: WorkDeadline,
+        execute work: @escaping () throws -> T
+    ) -> Promise<T> {
+        return async(namespace) { () throws -> T in
+            try deadline.checkNotExpired()
+            return try work()
+        }
+    }
+}
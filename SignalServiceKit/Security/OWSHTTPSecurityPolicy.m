@@ -5,9 +5,29 @@
 
 #import "OWSHTTPSecurityPolicy.h"
 #import <AssertMacros.h>
+#import <CommonCrypto/CommonDigest.h>
 
 NS_ASSUME_NONNULL_BEGIN
 
+// Many connections to the same host present the same certificate, so a
+// successful evaluation is reused for a short while rather than repeated
+// for each of them.
+static const NSTimeInterval kTrustEvaluationCacheDuration = 60;
+static const NSUInteger kTrustEvaluationCacheMaxCount = 32;
+
+@interface OWSHTTPSecurityPolicy ()
+
+// SecCertificateRefs for pinnedCertificates, created once.
+@property (nonatomic, readonly) NSArray *pinnedCertificateRefs;
+
+// Maps "<host> <leaf certificate SHA-256>" to the system uptime at which the
+// successful evaluation expires. Guarded by @synchronized(self).
+@property (nonatomic, readonly) NSMutableDictionary<NSString *, NSNumber *> *trustEvaluationExpirations;
+
+@end
+
+#pragma mark -
+
 @implementation OWSHTTPSecurityPolicy
 
 + (instancetype)sharedPolicy
@@ -23,7 +43,11 @@ NS_ASSUME_NONNULL_BEGIN
 
 + (instancetype)systemDefault
 {
-    return [[self alloc] initWithPinnedCertificates:[NSSet set]];
+    // Shared so that every session using it shares its trust evaluation cache.
+    static OWSHTTPSecurityPolicy *systemDefaultPolicy = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{ systemDefaultPolicy = [[self alloc] initWithPinnedCertificates:[NSSet set]]; });
+    return systemDefaultPolicy;
 }
 
 - (instancetype)initWithPinnedCertificates:(NSSet<NSData *> *)certificates
@@ -31,6 +55,14 @@ NS_ASSUME_NONNULL_BEGIN
     self = [super init];
     if (self) {
         _pinnedCertificates = [certificates copy];
+
+        NSMutableArray *pinnedCertificateRefs = [NSMutableArray array];
+        for (NSData *certificateData in _pinnedCertificates) {
+            [pinnedCertificateRefs addObject:(__bridge_transfer id)SecCertificateCreateWithData(
+                                                 NULL, (__bridge CFDataRef)certificateData)];
+        }
+        _pinnedCertificateRefs = [pinnedCertificateRefs copy];
+        _trustEvaluationExpirations = [NSMutableDictionary dictionary];
     }
     return self;
 }
@@ -67,6 +99,20 @@ NS_ASSUME_NONNULL_BEGIN
 }
 
 - (BOOL)evaluateServerTrust:(SecTrustRef)serverTrust forDomain:(nullable NSString *)domain
+{
+    NSString *_Nullable cacheKey = [self trustEvaluationCacheKeyForServerTrust:serverTrust domain:domain];
+    if (cacheKey != nil && [self hasCachedTrustEvaluationForKey:cacheKey]) {
+        return YES;
+    }
+
+    BOOL isValid = [self evaluateServerTrustUncached:serverTrust forDomain:domain];
+    if (isValid && cacheKey != nil) {
+        [self cacheTrustEvaluationForKey:cacheKey];
+    }
+    return isValid;
+}
+
+- (BOOL)evaluateServerTrustUncached:(SecTrustRef)serverTrust forDomain:(nullable NSString *)domain
 {
     NSMutableArray *policies = [NSMutableArray array];
     [policies addObject:(__bridge_transfer id)SecPolicyCreateSSL(true, (__bridge CFStringRef)domain)];
@@ -76,14 +122,9 @@ NS_ASSUME_NONNULL_BEGIN
         return NO;
     }
 
-    if ([self.pinnedCertificates count] > 0) {
-        NSMutableArray *pinnedCertificates = [NSMutableArray array];
-        for (NSData *certificateData in self.pinnedCertificates) {
-            [pinnedCertificates addObject:(__bridge_transfer id)SecCertificateCreateWithData(
-                                              NULL, (__bridge CFDataRef)certificateData)];
-        }
-
-        if (SecTrustSetAnchorCertificates(serverTrust, (__bridge CFArrayRef)pinnedCertificates) != errSecSuccess) {
+    if ([self.pinnedCertificateRefs count] > 0) {
+        if (SecTrustSetAnchorCertificates(serverTrust, (__bridge CFArrayRef)self.pinnedCertificateRefs)
+            != errSecSuccess) {
             OWSLogError(@"The anchor certificates couldn't be set.");
             return NO;
         }
@@ -94,6 +135,65 @@ NS_ASSUME_NONNULL_BEGIN
     return AFServerTrustIsValid(serverTrust);
 }
 
+#pragma mark - Trust Evaluation Cache
+
+- (nullable NSString *)trustEvaluationCacheKeyForServerTrust:(SecTrustRef)serverTrust domain:(nullable NSString *)domain
+{
+    if (domain.length < 1) {
+        return nil;
+    }
+    NSArray *certificateChain = (__bridge_transfer NSArray *)SecTrustCopyCertificateChain(serverTrust);
+    SecCertificateRef _Nullable leafCertificate = (__bridge SecCertificateRef)certificateChain.firstObject;
+    if (leafCertificate == NULL) {
+        return nil;
+    }
+    NSData *leafCertificateData = (__bridge_transfer NSData *)SecCertificateCopyData(leafCertificate);
+
+    uint8_t digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256(leafCertificateData.bytes, (CC_LONG)leafCertificateData.length, digest);
+    NSMutableString *digestString = [NSMutableString stringWithCapacity:CC_SHA256_DIGEST_LENGTH * 2];
+    for (size_t i = 0; i < CC_SHA256_DIGEST_LENGTH; i++) {
+        [digestString appendFormat:@"%02x", digest[i]];
+    }
+    return [NSString stringWithFormat:@"%@ %@", domain.lowercaseString, digestString];
+}
+
+- (BOOL)hasCachedTrustEvaluationForKey:(NSString *)cacheKey
+{
+    NSTimeInterval now = NSProcessInfo.processInfo.systemUptime;
+    @synchronized(self) {
+        NSNumber *_Nullable expiration = self.trustEvaluationExpirations[cacheKey];
+        if (expiration == nil) {
+            return NO;
+        }
+        if (expiration.doubleValue <= now) {
+            [self.trustEvaluationExpirations removeObjectForKey:cacheKey];
+            return NO;
+        }
+        return YES;
+    }
+}
+
+- (void)cacheTrustEvaluationForKey:(NSString *)cacheKey
+{
+    NSTimeInterval now = NSProcessInfo.processInfo.systemUptime;
+    @synchronized(self) {
+        if (self.trustEvaluationExpirations.count >= kTrustEvaluationCacheMaxCount) {
+            NSArray<NSString *> *expiredKeys =
+                [self.trustEvaluationExpirations keysOfEntriesPassingTest:^BOOL(NSString *key, NSNumber *expiration, BOOL *stop) {
+                    return expiration.doubleValue <= now;
+                }].allObjects;
+            [self.trustEvaluationExpirations removeObjectsForKeys:expiredKeys];
+        }
+        if (self.trustEvaluationExpirations.count >= kTrustEvaluationCacheMaxCount) {
+            [self.trustEvaluationExpirations removeAllObjects];
+        }
+        self.trustEvaluationExpirations[cacheKey] = @(now + kTrustEvaluationCacheDuration);
+    }
+}
+
+#pragma mark -
+
 static BOOL AFServerTrustIsValid(SecTrustRef serverTrust)
 {
     BOOL isValid = NO;
@@ -181,6 +181,29 @@ NSUInteger const RecipientIdentitySchemaVersion = 1;
     }
 }
 
+#pragma mark -
+
+- (void)anyDidInsertWithTransaction:(SDSAnyWriteTransaction *)transaction
+{
+    [super anyDidInsertWithTransaction:transaction];
+
+    [self.modelReadCaches.recipientIdentityReadCache didInsertOrUpdateRecipientIdentity:self transaction:transaction];
+}
+
+- (void)anyDidUpdateWithTransaction:(SDSAnyWriteTransaction *)transaction
+{
+    [super anyDidUpdateWithTransaction:transaction];
+
+    [self.modelReadCaches.recipientIdentityReadCache didInsertOrUpdateRecipientIdentity:self transaction:transaction];
+}
+
+- (void)anyDidRemoveWithTransaction:(SDSAnyWriteTransaction *)transaction
+{
+    [super anyDidRemoveWithTransaction:transaction];
+
+    [self.modelReadCaches.recipientIdentityReadCache didRemoveRecipientIdentity:self transaction:transaction];
+}
+
 #pragma mark - debug
 
 + (void)printAllIdentities
@@ -0,0 +1,233 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+import GRDB
+
+/// Rewrites sessions stored as ``LegacySessionRecord`` archives as
+/// libsignal session records.
+///
+/// The session store converts legacy records whenever they're loaded, but
+/// never saves the result, so an install that has been around long enough
+/// unarchives and converts the same sessions every time it sends to those
+/// recipients. This converts them all once, in the background.
+///
+/// Recipients are visited in batches, in key order, and the position is
+/// saved after each batch, so an interrupted migration picks up where it
+/// left off on the next launch. Each batch is decoded concurrently outside
+/// of any transaction; a recipient's sessions are only replaced if they're
+/// unchanged since they were read.
+public final class LegacySessionMigrator {
+    private typealias SessionsByDeviceDictionary = [Int32: AnyObject]
+
+    private let db: DB
+    private let keyValueStore: KeyValueStore
+    private let sessionKeyValueStores: [KeyValueStore]
+    private let preconditions: Preconditions
+
+    private enum Constants {
+        /// The number of recipients whose sessions are decoded per batch.
+        static let batchSize = 100
+
+        static let nanosecondsBetweenBatches = 50 * NSEC_PER_MSEC
+
+        static let isCompleteKey = "isComplete"
+        static let identityIndexKey = "identityIndex"
+        static let lastRecipientUniqueIdKey = "lastRecipientUniqueId"
+        static let convertedSessionCountKey = "convertedSessionCount"
+
+        static let identities: [OWSIdentity] = [.aci, .pni]
+    }
+
+    private struct ArchivedSessions {
+        var recipientUniqueId: String
+        var value: Data
+    }
+
+    public init(appContext: AppContext, db: DB, keyValueStoreFactory: KeyValueStoreFactory) {
+        LegacySessionRecord.setUpKeyedArchiverSubstitutions()
+
+        self.db = db
+        self.keyValueStore = keyValueStoreFactory.keyValueStore(collection: "LegacySessionMigrator")
+        self.sessionKeyValueStores = Constants.identities.map {
+            keyValueStoreFactory.keyValueStore(collection: SSKSessionStore.collection(for: $0))
+        }
+        self.preconditions = Preconditions([AppActivePrecondition(appContext: appContext)])
+    }
+
+    /// Converts every legacy session, unless that's already been done.
+    public func run() async {
+        do {
+            let isComplete = db.read { tx in
+                keyValueStore.getBool(Constants.isCompleteKey, defaultValue: false, transaction: tx)
+            }
+            guard !isComplete else {
+                return
+            }
+            let recipientCount = db.read { tx in
+                sessionKeyValueStores.reduce(0) { $0 + $1.numberOfKeys(transaction: tx) }
+            }
+            Logger.info("Migrating sessions for \(recipientCount) recipients")
+            var visitedCount = 0
+            while true {
+                try await preconditions.waitUntilSatisfied()
+                let batchResult = try await runNextBatch()
+                visitedCount += batchResult.visitedCount
+                if batchResult.isComplete {
+                    break
+                }
+                Logger.info("Visited \(visitedCount)/\(recipientCount) recipients")
+                try await Task.sleep(nanoseconds: Constants.nanosecondsBetweenBatches)
+            }
+            let convertedCount = db.read { tx in
+                keyValueStore.getInt(Constants.convertedSessionCountKey, defaultValue: 0, transaction: tx)
+            }
+            Logger.info("Finished; converted \(convertedCount) sessions")
+        } catch {
+            Logger.warn("\(error)")
+        }
+    }
+
+    struct BatchResult {
+        var visitedCount: Int
+        var isComplete: Bool
+    }
+
+    func runNextBatch() async throws -> BatchResult {
+        let backgroundTask = OWSBackgroundTask(label: #function)
+        defer { backgroundTask.end() }
+
+        let startTime = CACurrentMediaTime()
+
+        guard let (identityIndex, batch) = try db.read(block: fetchNextBatch(tx:)) else {
+            await db.awaitableWrite { tx in
+                self.keyValueStore.setBool(true, key: Constants.isCompleteKey, transaction: tx)
+            }
+            return BatchResult(visitedCount: 0, isComplete: true)
+        }
+
+        let convertedValues = await withTaskGroup(
+            of: (index: Int, value: Data, sessionCount: Int)?.self,
+            returning: [(index: Int, value: Data, sessionCount: Int)].self
+        ) { taskGroup in
+            for (index, archivedSessions) in batch.enumerated() {
+                taskGroup.addTask {
+                    guard let (value, sessionCount) = Self.convertedValue(archivedSessions.value) else {
+                        return nil
+                    }
+                    return (index, value, sessionCount)
+                }
+            }
+            return await taskGroup.reduce(into: []) { result, convertedValue in
+                if let convertedValue {
+                    result.append(convertedValue)
+                }
+            }
+        }
+
+        let convertedSessionCount = try await db.awaitableWrite { tx -> Int in
+            let database = SDSDB.shimOnlyBridge(tx).unwrapGrdbWrite.database
+            let collection = SSKSessionStore.collection(for: Constants.identities[identityIndex])
+            var convertedSessionCount = 0
+            for convertedValue in convertedValues {
+                let archivedSessions = batch[convertedValue.index]
+                // If these sessions were updated since we read them, they've
+                // already been saved as libsignal records.
+                try database.execute(
+                    sql: """
+                        UPDATE \(SDSKeyValueStore.tableName)
+                        SET \(SDSKeyValueStore.valueColumn.columnName) = ?
+                        WHERE \(SDSKeyValueStore.keyColumn.columnName) = ?
+                        AND \(SDSKeyValueStore.collectionColumn.columnName) = ?
+                        AND \(SDSKeyValueStore.valueColumn.columnName) = ?
+                        """,
+                    arguments: [convertedValue.value, archivedSessions.recipientUniqueId, collection, archivedSessions.value]
+                )
+                if database.changesCount > 0 {
+                    convertedSessionCount += convertedValue.sessionCount
+                }
+            }
+            self.keyValueStore.setInt(identityIndex, key: Constants.identityIndexKey, transaction: tx)
+            self.keyValueStore.setString(batch.last!.recipientUniqueId, key: Constants.lastRecipientUniqueIdKey, transaction: tx)
+            let previousCount = self.keyValueStore.getInt(Constants.convertedSessionCountKey, defaultValue: 0, transaction: tx)
+            self.keyValueStore.setInt(previousCount + convertedSessionCount, key: Constants.convertedSessionCountKey, transaction: tx)
+            return convertedSessionCount
+        }
+
+        let formattedDuration = String(format: "%.1fms", (CACurrentMediaTime() - startTime)*1000)
+        Logger.info("Converted \(convertedSessionCount) sessions for \(batch.count) recipients in \(formattedDuration)")
+
+        return BatchResult(visitedCount: batch.count, isComplete: false)
+    }
+
+    /// Fetches the archived sessions for the next batch of recipients
+    /// after the saved position, or nil if there aren't any left.
+    private func fetchNextBatch(tx: DBReadTransaction) throws -> (identityIndex: Int, batch: [ArchivedSessions])? {
+        let database = SDSDB.shimOnlyBridge(tx).unwrapGrdbRead.database
+        var identityIndex = keyValueStore.getInt(Constants.identityIndexKey, defaultValue: 0, transaction: tx)
+        var lastKey = keyValueStore.getString(Constants.lastRecipientUniqueIdKey, transaction: tx)
+        while identityIndex < Constants.identities.count {
+            let rows = try GRDB.Row.fetchAll(
+                database,
+                sql: """
+                    SELECT \(SDSKeyValueStore.keyColumn.columnName), \(SDSKeyValueStore.valueColumn.columnName)
+                    FROM \(SDSKeyValueStore.tableName)
+                    WHERE \(SDSKeyValueStore.collectionColumn.columnName) = ?
+                    AND \(SDSKeyValueStore.keyColumn.columnName) > ?
+                    ORDER BY \(SDSKeyValueStore.keyColumn.columnName)
+                    LIMIT ?
+                    """,
+                arguments: [SSKSessionStore.collection(for: Constants.identities[identityIndex]), lastKey ?? "", Constants.batchSize]
+            )
+            if !rows.isEmpty {
+                return (identityIndex, rows.map { ArchivedSessions(recipientUniqueId: $0[0], value: $0[1]) })
+            }
+            identityIndex += 1
+            lastKey = nil
+        }
+        return nil
+    }
+
+    /// Returns the re-archived sessions if any of them were legacy records,
+    /// along with how many were converted.
+    private static func convertedValue(_ value: Data) -> (Data, Int)? {
+        let dictionary: SessionsByDeviceDictionary
+        do {
+            guard let object = try NSKeyedUnarchiver.unarchiveTopLevelObjectWithData(value) as? SessionsByDeviceDictionary else {
+                owsFailDebug("unexpected entry in session store")
+                return nil
+            }
+            dictionary = object
+        } catch {
+            owsFailDebug("failed to decode sessions: \(error)")
+            return nil
+        }
+
+        var convertedCount = 0
+        let newDictionary = dictionary.mapValues { entry -> AnyObject in
+            guard let record = entry as? LegacySessionRecord else {
+                return entry
+            }
+            do {
+                let data = try record.serializeProto()
+                convertedCount += 1
+                return data as NSData
+            } catch {
+                owsFailDebug("failed to serialize AxolotlKit session: \(error)")
+                return entry
+            }
+        }
+        guard convertedCount > 0 else {
+            return nil
+        }
+
+        do {
+            return (try NSKeyedArchiver.archivedData(withRootObject: newDictionary, requiringSecureCoding: false), convertedCount)
+        } catch {
+            owsFailDebug("failed to encode sessions: \(error)")
+            return nil
+        }
+    }
+}
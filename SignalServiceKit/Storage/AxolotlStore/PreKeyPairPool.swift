@@ -0,0 +1,111 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+import LibSignalClient
+
+/// Key pairs for pre-keys, generated in the background ahead of need.
+///
+/// Pre-keys are generated inside the write transaction that assigns their
+/// ids, so generating a batch of one-time EC and Kyber keys there holds the
+/// write lock for the whole time. The stores take key pairs from this pool
+/// instead, and only assign ids and sign them in the transaction.
+///
+/// The pool only holds unsigned key pairs without ids, and only in memory;
+/// they become pre-keys when they're taken. If the pool runs dry, the
+/// shortfall is generated inline.
+///
+/// This class is thread-safe.
+final class PreKeyPairPool {
+
+    static let shared = PreKeyPairPool()
+
+    private struct State {
+        var ecKeyPairs = [ECKeyPair]()
+        var kemKeyPairs = [KEMKeyPair]()
+        var isFilling = false
+    }
+
+    /// How many key pairs of each kind to keep on hand.
+    private let targetCount: Int
+    private let queue = DispatchQueue(label: "org.signal.pre-key-pair-pool", qos: .utility)
+    private let state = AtomicValue(State(), lock: UnfairLock())
+
+    /// The default is enough for a batch of one-time pre-keys plus a signed
+    /// pre-key and a last resort Kyber pre-key.
+    init(targetCount: Int = 101) {
+        self.targetCount = targetCount
+    }
+
+    /// Starts filling the pool, if needed. Call this when pre-keys are likely
+    /// to be generated soon, e.g. before checking whether they need to be.
+    func prepare() {
+        let shouldFill = state.update { state -> Bool in
+            guard !state.isFilling, state.ecKeyPairs.count < targetCount || state.kemKeyPairs.count < targetCount else {
+                return false
+            }
+            state.isFilling = true
+            return true
+        }
+        guard shouldFill else {
+            return
+        }
+        queue.async { self.fill() }
+    }
+
+    private func fill() {
+        // Generate in small chunks so that keys taken mid-fill are replaced and
+        // takers don't wait for the whole pool.
+        let chunkSize = 10
+        while true {
+            let (ecCount, kemCount) = state.update { state -> (Int, Int) in
+                let ecCount = min(chunkSize, max(0, targetCount - state.ecKeyPairs.count))
+                let kemCount = min(chunkSize, max(0, targetCount - state.kemKeyPairs.count))
+                if ecCount == 0, kemCount == 0 {
+                    state.isFilling = false
+                }
+                return (ecCount, kemCount)
+            }
+            if ecCount == 0, kemCount == 0 {
+                return
+            }
+            let ecKeyPairs = (0..<ecCount).map { _ in ECKeyPair.generateKeyPair() }
+            let kemKeyPairs = (0..<kemCount).map { _ in KEMKeyPair.generate() }
+            state.update {
+                $0.ecKeyPairs.append(contentsOf: ecKeyPairs)
+                $0.kemKeyPairs.append(contentsOf: kemKeyPairs)
+            }
+        }
+    }
+
+    func takeECKeyPairs(count: Int) -> [ECKeyPair] {
+        let taken = state.update { state -> [ECKeyPair] in
+            let taken = Array(state.ecKeyPairs.suffix(count))
+            state.ecKeyPairs.removeLast(taken.count)
+            return taken
+        }
+        refillAfterTaking()
+        return taken + (taken.count..<count).map { _ in ECKeyPair.generateKeyPair() }
+    }
+
+    func takeKEMKeyPairs(count: Int) -> [KEMKeyPair] {
+        let taken = state.update { state -> [KEMKeyPair] in
+            let taken = Array(state.kemKeyPairs.suffix(count))
+            state.kemKeyPairs.removeLast(taken.count)
+            return taken
+        }
+        refillAfterTaking()
+        return taken + (taken.count..<count).map { _ in KEMKeyPair.generate() }
+    }
+
+    private func refillAfterTaking() {
+        // Extensions rarely generate pre-keys; don't spend their time and
+        // memory keeping a pool.
+        guard CurrentAppContext().isMainApp else {
+            return
+        }
+        prepare()
+    }
+}
@@ -191,10 +191,10 @@ public class SSKKyberPreKeyStore: SignalKyberPreKeyStore {
 
     private func generateKyberPreKeyRecord(
         id: UInt32,
+        keyPair: KEMKeyPair,
         signedBy identityKeyPair: ECKeyPair,
         isLastResort: Bool
     ) throws -> KyberPreKeyRecord {
-        let keyPair = KEMKeyPair.generate()
         let signature = Data(identityKeyPair.keyPair.privateKey.generateSignature(message: Data(keyPair.publicKey.serialize())))
 
         let record = KyberPreKeyRecord(
@@ -216,9 +216,10 @@ public class SSKKyberPreKeyStore: SignalKyberPreKeyStore {
         tx: DBWriteTransaction
     ) throws -> [KyberPreKeyRecord] {
         var nextKeyId = nextKyberPreKeyId(minimumCapacity: UInt32(count), tx: tx)
-        let records = try (0..<count).map { _ in
+        let records = try PreKeyPairPool.shared.takeKEMKeyPairs(count: count).map { kemKeyPair in
             let record = try generateKyberPreKeyRecord(
                 id: nextKeyId,
+                keyPair: kemKeyPair,
                 signedBy: keyPair,
                 isLastResort: false
             )
@@ -238,6 +239,7 @@ public class SSKKyberPreKeyStore: SignalKyberPreKeyStore {
         let keyId = nextKyberPreKeyId(tx: tx)
         let record = try generateKyberPreKeyRecord(
             id: keyId,
+            keyPair: PreKeyPairPool.shared.takeKEMKeyPairs(count: 1)[0],
             signedBy: keyPair,
             isLastResort: true
         )
@@ -250,6 +252,7 @@ public class SSKKyberPreKeyStore: SignalKyberPreKeyStore {
     ) throws -> SignalServiceKit.KyberPreKeyRecord {
         return try generateKyberPreKeyRecord(
             id: PreKeyId.random(),
+            keyPair: PreKeyPairPool.shared.takeKEMKeyPairs(count: 1)[0],
             signedBy: keyPair,
             isLastResort: true
         )
@@ -32,8 +32,7 @@ class SSKPreKeyStore: NSObject {
             var preKeyId = nextPreKeyId(transaction: transaction)
 
             Logger.info("building \(batchSize) new preKeys starting from preKeyId: \(preKeyId)")
-            for _ in 0..<batchSize {
-                let keyPair = ECKeyPair.generateKeyPair()
+            for keyPair in PreKeyPairPool.shared.takeECKeyPairs(count: batchSize) {
                 let record = SignalServiceKit.PreKeyRecord(id: preKeyId, keyPair: keyPair, createdAt: Date())
                 preKeyRecords.append(record)
                 preKeyId += 1
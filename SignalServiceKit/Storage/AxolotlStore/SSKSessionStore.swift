@@ -18,17 +18,19 @@ public final class SSKSessionStore: SignalSessionStore {
     ) {
         LegacySessionRecord.setUpKeyedArchiverSubstitutions()
 
-        self.keyValueStore = keyValueStoreFactory.keyValueStore(collection: {
-            switch identity {
-            case .aci:
-                return "TSStorageManagerSessionStoreCollection"
-            case .pni:
-                return "TSStorageManagerPNISessionStoreCollection"
-            }
-        }())
+        self.keyValueStore = keyValueStoreFactory.keyValueStore(collection: Self.collection(for: identity))
         self.recipientIdFinder = recipientIdFinder
     }
 
+    static func collection(for identity: OWSIdentity) -> String {
+        switch identity {
+        case .aci:
+            return "TSStorageManagerSessionStoreCollection"
+        case .pni:
+            return "TSStorageManagerPNISessionStoreCollection"
+        }
+    }
+
     fileprivate func loadSerializedSession(
         for serviceId: ServiceId,
         deviceId: UInt32,
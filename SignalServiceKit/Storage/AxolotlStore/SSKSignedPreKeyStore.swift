@@ -10,7 +10,7 @@ extension SSKSignedPreKeyStore {
     public class func generateSignedPreKey(
         signedBy identityKeyPair: ECKeyPair
     ) -> SignalServiceKit.SignedPreKeyRecord {
-        let keyPair = ECKeyPair.generateKeyPair()
+        let keyPair = PreKeyPairPool.shared.takeECKeyPairs(count: 1)[0]
 
         // Signed prekey ids must be > 0.
         let preKeyId = Int32.random(in: 1..<Int32.max)
@@ -18,6 +18,11 @@ public class SenderKeyStore {
         "\(authorAci.serviceIdUppercaseString).\(distributionId.uuidString)"
     }
 
+    private let keyMetadataCache = TransactionalReadCache<KeyId, CachedKeyMetadata>(
+        tableName: SDSKeyValueStore.tableName,
+        maxSize: 256
+    )
+
     public init() {
         SwiftSingletons.register(self)
     }
@@ -145,6 +150,8 @@ public class SenderKeyStore {
     }
 
     public func resetSenderKeyStore(transaction writeTx: SDSAnyWriteTransaction) {
+        writeTx.removeTransactionScopedObject(forKey: Self.pendingWritesKey)
+        keyMetadataCache.willRemoveAll(writeTx: writeTx)
         keyMetadataStore.removeAll(transaction: writeTx)
         sendingDistributionIdStore.removeAll(transaction: writeTx)
     }
@@ -247,6 +254,16 @@ extension SenderKeyStore {
     private var keyMetadataStore: SDSKeyValueStore { Self.keyMetadataStore }
 
     fileprivate func getKeyMetadata(for keyId: KeyId, readTx: SDSAnyReadTransaction) -> KeyMetadata? {
+        if
+            let writeTx = readTx as? SDSAnyWriteTransaction,
+            let pendingValue = pendingWrites(in: writeTx).metadataByKeyId[keyId]
+        {
+            return pendingValue
+        }
+        if let cachedValue = keyMetadataCache.cachedValue(for: keyId, readTx: readTx) {
+            return cachedValue.metadata
+        }
+
         let persisted: KeyMetadata?
         do {
             persisted = try keyMetadataStore.getCodableValue(forKey: keyId, transaction: readTx)
@@ -254,6 +271,7 @@ extension SenderKeyStore {
             owsFailDebug("Failed to deserialize sender key: \(error)")
             persisted = nil
         }
+        keyMetadataCache.didRead(CachedKeyMetadata(metadata: persisted), for: keyId, readTx: readTx)
         return persisted
     }
 
@@ -261,16 +279,45 @@ extension SenderKeyStore {
         setMetadata(metadata, for: metadata.keyId, writeTx: writeTx)
     }
 
+    /// Updates the metadata for `keyId` as seen by `writeTx`.
+    ///
+    /// A single send or receive can update the same key several times (e.g.
+    /// storing the ratcheted record and then recording SKDM deliveries), so the
+    /// latest value for each key is written once, when `writeTx` is finalized.
     fileprivate func setMetadata(_ metadata: KeyMetadata?, for keyId: KeyId, writeTx: SDSAnyWriteTransaction) {
-        do {
-            if let metadata = metadata {
-                owsAssertDebug(metadata.keyId == keyId)
-                try keyMetadataStore.setCodable(metadata, key: keyId, transaction: writeTx)
-            } else {
-                keyMetadataStore.removeValue(forKey: keyId, transaction: writeTx)
+        if let metadata {
+            owsAssertDebug(metadata.keyId == keyId)
+        }
+        pendingWrites(in: writeTx).metadataByKeyId.updateValue(metadata, forKey: keyId)
+
+        writeTx.addTransactionFinalizationBlock(forKey: Self.pendingWritesKey) { [weak self] writeTx in
+            self?.flushPendingWrites(writeTx: writeTx)
+        }
+    }
+
+    private static let pendingWritesKey = "SenderKeyStore.pendingWrites"
+
+    private func pendingWrites(in writeTx: SDSAnyWriteTransaction) -> PendingKeyMetadataWrites {
+        return writeTx.transactionScopedObject(forKey: Self.pendingWritesKey) {
+            PendingKeyMetadataWrites()
+        } as! PendingKeyMetadataWrites
+    }
+
+    private func flushPendingWrites(writeTx: SDSAnyWriteTransaction) {
+        guard let pendingWrites = writeTx.removeTransactionScopedObject(forKey: Self.pendingWritesKey) as? PendingKeyMetadataWrites else {
+            return
+        }
+        for (keyId, metadata) in pendingWrites.metadataByKeyId {
+            keyMetadataCache.willWrite(CachedKeyMetadata(metadata: metadata), for: keyId, writeTx: writeTx)
+            do {
+                if let metadata {
+                    try keyMetadataStore.setCodable(metadata, key: keyId, transaction: writeTx)
+                } else {
+                    keyMetadataStore.removeValue(forKey: keyId, transaction: writeTx)
+                }
+            } catch {
+                owsFailDebug("Failed to persist sender key: \(error)")
             }
-        } catch {
-            owsFailDebug("Failed to persist sender key: \(error)")
         }
     }
 
@@ -387,6 +434,23 @@ extension SenderKeyStore {
     }
 }
 
+// MARK: - Caching
+
+/// The key metadata changes made by a write transaction that haven't been
+/// written to the database yet.
+private final class PendingKeyMetadataWrites {
+    /// A nil value means the key is being removed.
+    var metadataByKeyId = [SenderKeyStore.KeyId: KeyMetadata?]()
+}
+
+/// Decoded key metadata for a sender key, as cached in `keyMetadataCache`,
+/// so that sending to or receiving from an active group doesn't decode its
+/// sender key record and delivery state from the database for every message.
+private struct CachedKeyMetadata {
+    /// Nil if the key doesn't exist.
+    let metadata: KeyMetadata?
+}
+
 // MARK: - Model
 
 // MARK: SKDMSendInfo
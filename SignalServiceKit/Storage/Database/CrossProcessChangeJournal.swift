@@ -0,0 +1,266 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// The rows of a single table that were changed by another process.
+public struct CrossProcessTableChanges: Codable, Equatable {
+    /// Sorted, non-overlapping ranges of inserted or updated row ids. This may
+    /// be a superset of the rows that actually changed.
+    public fileprivate(set) var rowIdRanges: [ClosedRange<Int64>]
+    /// If true, rows were deleted from the table. We don't know which, so
+    /// consumers should assume any row may be gone.
+    public fileprivate(set) var hasDeletions: Bool
+
+    /// We don't want the journal to grow without bound when a process writes
+    /// lots of scattered rows, so beyond this many ranges we widen the last
+    /// range to cover everything after it.
+    static let maxRowIdRangeCount = 64
+
+    public init(rowIds: Set<Int64> = [], hasDeletions: Bool = false) {
+        self.rowIdRanges = Self.ranges(for: rowIds.sorted())
+        self.hasDeletions = hasDeletions
+    }
+
+    public var rowIdCount: Int {
+        rowIdRanges.reduce(0) { $0 + $1.count }
+    }
+
+    public func contains(rowId: Int64) -> Bool {
+        rowIdRanges.contains { $0.contains(rowId) }
+    }
+
+    public func merging(_ other: CrossProcessTableChanges) -> CrossProcessTableChanges {
+        var result = self
+        result.hasDeletions = hasDeletions || other.hasDeletions
+        result.rowIdRanges = Self.coalesce((rowIdRanges + other.rowIdRanges).sorted { $0.lowerBound < $1.lowerBound })
+        return result
+    }
+
+    private static func ranges(for sortedRowIds: [Int64]) -> [ClosedRange<Int64>] {
+        var result = [ClosedRange<Int64>]()
+        for rowId in sortedRowIds {
+            if let last = result.last, last.upperBound == rowId - 1 {
+                result[result.count - 1] = last.lowerBound...rowId
+            } else {
+                result.append(rowId...rowId)
+            }
+        }
+        return capped(result)
+    }
+
+    private static func coalesce(_ sortedRanges: [ClosedRange<Int64>]) -> [ClosedRange<Int64>] {
+        var result = [ClosedRange<Int64>]()
+        for range in sortedRanges {
+            if let last = result.last, range.lowerBound <= last.upperBound + 1 {
+                result[result.count - 1] = last.lowerBound...max(last.upperBound, range.upperBound)
+            } else {
+                result.append(range)
+            }
+        }
+        return capped(result)
+    }
+
+    private static func capped(_ ranges: [ClosedRange<Int64>]) -> [ClosedRange<Int64>] {
+        guard ranges.count > maxRowIdRangeCount, let last = ranges.last else {
+            return ranges
+        }
+        var result = Array(ranges.prefix(maxRowIdRangeCount - 1))
+        result.append(ranges[maxRowIdRangeCount - 1].lowerBound...last.upperBound)
+        return result
+    }
+}
+
+// MARK: -
+
+/// The database changes made by other processes since the last time we
+/// checked, as read from the `CrossProcessChangeJournal`.
+///
+/// This is posted in the `userInfo` of the cross-process write notifications
+/// (see `SDSDatabaseStorage.crossProcessChangesKey`). If those notifications
+/// don't include it, we don't know what changed and observers should assume
+/// that anything could have changed.
+@objc
+public final class CrossProcessDatabaseChanges: NSObject {
+    public let tableChanges: [String: CrossProcessTableChanges]
+
+    public init(tableChanges: [String: CrossProcessTableChanges]) {
+        self.tableChanges = tableChanges
+    }
+
+    public var tableNames: Set<String> {
+        Set(tableChanges.keys)
+    }
+
+    public func didUpdate(tableName: String) -> Bool {
+        tableChanges[tableName] != nil
+    }
+
+    /// The row ids that were inserted or updated in `tableName`, or nil if
+    /// rows were deleted or there are more than `limit` of them.
+    public func updatedRowIds(tableName: String, limit: Int) -> Set<Int64>? {
+        guard let changes = tableChanges[tableName] else {
+            return []
+        }
+        guard !changes.hasDeletions, changes.rowIdCount <= limit else {
+            return nil
+        }
+        var result = Set<Int64>()
+        for range in changes.rowIdRanges {
+            result.formUnion(range)
+        }
+        return result
+    }
+
+    public func merging(_ other: CrossProcessDatabaseChanges) -> CrossProcessDatabaseChanges {
+        CrossProcessDatabaseChanges(tableChanges: tableChanges.merging(other.tableChanges) { $0.merging($1) })
+    }
+}
+
+// MARK: -
+
+/// A small log in the shared container of the tables & rows changed by each
+/// write transaction in the app extensions.
+///
+/// `SDSCrossProcess` only tells the main app _that_ another process wrote to
+/// the database. Extensions append an entry here when they commit so that
+/// the main app can find out _what_ they wrote and only invalidate the
+/// affected caches and views.
+///
+/// Entries have sequence numbers that are shared by all processes. The
+/// journal only retains the most recent entries; a reader that falls behind
+/// further than that (or can't read the journal) gets nil and must assume
+/// that everything changed.
+public final class CrossProcessChangeJournal {
+
+    public struct Entry: Codable, Equatable {
+        public let sequenceNumber: UInt64
+        public let pid: Int32
+        public let tableChanges: [String: CrossProcessTableChanges]
+    }
+
+    private struct Contents: Codable {
+        var lastSequenceNumber: UInt64 = 0
+        var entries = [Entry]()
+    }
+
+    static let maxEntryCount = 128
+
+    private let fileUrl: URL
+    private let pid: Int32
+
+    public init(fileUrl: URL, pid: Int32 = getpid()) {
+        self.fileUrl = fileUrl
+        self.pid = pid
+    }
+
+    public static var defaultFileUrl: URL {
+        URL(fileURLWithPath: CurrentAppContext().appSharedDataDirectoryPath())
+            .appendingPathComponent("CrossProcessChangeJournal.json")
+    }
+
+    /// Appends an entry for a transaction that changed `tableChanges`.
+    public func append(tableChanges: [String: CrossProcessTableChanges]) {
+        guard !tableChanges.isEmpty else {
+            return
+        }
+        do {
+            try withLockedFile(exclusive: true) { fileHandle in
+                var contents: Contents
+                do {
+                    contents = try Self.readContents(fileHandle)
+                } catch {
+                    // Start over, but don't reuse sequence numbers that
+                    // readers might have already seen.
+                    owsFailDebug("Discarding unreadable journal: \(error)")
+                    contents = Contents(lastSequenceNumber: Date.ows_millisecondTimestamp())
+                }
+                contents.lastSequenceNumber += 1
+                contents.entries.append(Entry(
+                    sequenceNumber: contents.lastSequenceNumber,
+                    pid: pid,
+                    tableChanges: tableChanges
+                ))
+                if contents.entries.count > Self.maxEntryCount {
+                    contents.entries.removeFirst(contents.entries.count - Self.maxEntryCount)
+                }
+                let data = try JSONEncoder().encode(contents)
+                try fileHandle.truncate(atOffset: 0)
+                try fileHandle.write(contentsOf: data)
+            }
+        } catch {
+            // Remove the journal so that readers notice that its sequence
+            // numbers went backwards and fall back to invalidating everything.
+            owsFailDebug("Couldn't append to journal: \(error)")
+            try? FileManager.default.removeItem(at: fileUrl)
+        }
+    }
+
+    /// The sequence number of the most recent entry.
+    public func lastSequenceNumber() -> UInt64? {
+        do {
+            return try withLockedFile(exclusive: false) { try Self.readContents($0).lastSequenceNumber }
+        } catch {
+            Logger.warn("Couldn't read journal: \(error)")
+            return nil
+        }
+    }
+
+    /// Returns the changes made by other processes in entries after
+    /// `sequenceNumber`.
+    ///
+    /// - Returns: The changes (or nil if some of the entries are no longer
+    /// available) and the sequence number to pass next time.
+    public func changes(after sequenceNumber: UInt64) -> (changes: CrossProcessDatabaseChanges?, lastSequenceNumber: UInt64) {
+        let contents: Contents
+        do {
+            contents = try withLockedFile(exclusive: false) { try Self.readContents($0) }
+        } catch {
+            Logger.warn("Couldn't read journal: \(error)")
+            return (nil, sequenceNumber)
+        }
+        if contents.lastSequenceNumber < sequenceNumber {
+            // The journal was reset (e.g. deleted); we don't know what changed.
+            return (nil, contents.lastSequenceNumber)
+        }
+        let newEntries = contents.entries.filter { $0.sequenceNumber > sequenceNumber }
+        let expectedEntryCount = contents.lastSequenceNumber - sequenceNumber
+        guard newEntries.count == expectedEntryCount else {
+            return (nil, contents.lastSequenceNumber)
+        }
+        var tableChanges = [String: CrossProcessTableChanges]()
+        for entry in newEntries where entry.pid != pid {
+            tableChanges.merge(entry.tableChanges) { $0.merging($1) }
+        }
+        return (CrossProcessDatabaseChanges(tableChanges: tableChanges), contents.lastSequenceNumber)
+    }
+
+    // MARK: -
+
+    /// Writers hold an exclusive `flock` for the duration of a small
+    /// read-modify-write, so readers never see a partially-written journal.
+    private func withLockedFile<T>(exclusive: Bool, block: (FileHandle) throws -> T) throws -> T {
+        let fileDescriptor = open(fileUrl.path, O_RDWR | O_CREAT, 0o600)
+        guard fileDescriptor >= 0 else {
+            throw POSIXError(POSIXErrorCode(rawValue: errno) ?? .EIO)
+        }
+        let fileHandle = FileHandle(fileDescriptor: fileDescriptor, closeOnDealloc: true)
+        guard flock(fileDescriptor, exclusive ? LOCK_EX : LOCK_SH) == 0 else {
+            throw POSIXError(POSIXErrorCode(rawValue: errno) ?? .EIO)
+        }
+        defer {
+            flock(fileDescriptor, LOCK_UN)
+        }
+        return try block(fileHandle)
+    }
+
+    private static func readContents(_ fileHandle: FileHandle) throws -> Contents {
+        try fileHandle.seek(toOffset: 0)
+        guard let data = try fileHandle.readToEnd(), !data.isEmpty else {
+            return Contents()
+        }
+        return try JSONDecoder().decode(Contents.self, from: data)
+    }
+}
@@ -0,0 +1,153 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// Keeps the WAL small while the app is idle or in the background, reports
+/// how large the database is growing, and corrects derived counts.
+///
+/// Writes already schedule truncating checkpoints (see
+/// `GRDBDatabaseStorageAdapter`), but those give up if readers are busy, so
+/// after a burst of writes (e.g. a large sync) the WAL can stay hundreds of
+/// megabytes until the next quiet moment. This class looks for those
+/// moments: when nothing has written for a while, it checkpoints any WAL
+/// over `Constants.maxIdleWalSize`, and it always truncates the WAL when the
+/// app enters the background.
+///
+/// Once a day it also recounts each thread's unread messages (see
+/// `ThreadUnreadCounts`).
+public final class DatabaseMaintenanceScheduler {
+    private enum Constants {
+        static let pollInterval: TimeInterval = 60
+        /// How long writes must have stopped for before the app counts as idle.
+        static let idleInterval: TimeInterval = 10
+        static let maxIdleWalSize: UInt64 = 32 * 1024 * 1024
+        static let growthReportInterval: TimeInterval = kDayInterval
+
+        static let lastReportDateKey = "lastReportDate"
+        static let lastReportedFileSizeKey = "lastReportedFileSize"
+    }
+
+    private let appContext: AppContext
+    private let databaseStorage: SDSDatabaseStorage
+    private let keyValueStore = SDSKeyValueStore(collection: "DatabaseMaintenanceScheduler")
+    private let queue = DispatchQueue(label: "org.signal.database-maintenance", qos: .utility)
+
+    private var pollTimer: Timer?
+
+    public init(appContext: AppContext, databaseStorage: SDSDatabaseStorage) {
+        self.appContext = appContext
+        self.databaseStorage = databaseStorage
+    }
+
+    deinit {
+        pollTimer?.invalidate()
+    }
+
+    /// Must be called on the main thread, after the app is ready.
+    public func start() {
+        AssertIsOnMainThread()
+        owsAssertDebug(pollTimer == nil)
+
+        NotificationCenter.default.addObserver(
+            self,
+            selector: #selector(didEnterBackground),
+            name: .OWSApplicationDidEnterBackground,
+            object: nil
+        )
+        pollTimer = WeakTimer.scheduledTimer(
+            timeInterval: Constants.pollInterval,
+            target: self,
+            userInfo: nil,
+            repeats: true
+        ) { [weak self] _ in
+            self?.pollIfForeground()
+        }
+        queue.async { self.runDailyTasksIfNecessary() }
+    }
+
+    @objc
+    private func didEnterBackground() {
+        AssertIsOnMainThread()
+
+        let backgroundTask = OWSBackgroundTask(label: #function)
+        queue.async {
+            defer { backgroundTask.end() }
+            self.checkpoint(reason: "background")
+        }
+    }
+
+    private func pollIfForeground() {
+        AssertIsOnMainThread()
+
+        guard !appContext.isInBackground() else {
+            return
+        }
+        queue.async {
+            let grdbStorage = self.databaseStorage.grdbStorage
+            if let timeIntervalSinceLastWrite = grdbStorage.timeIntervalSinceLastWrite, timeIntervalSinceLastWrite < Constants.idleInterval {
+                return
+            }
+            guard grdbStorage.databaseWALFileSize > Constants.maxIdleWalSize else {
+                return
+            }
+            self.checkpoint(reason: "idle")
+        }
+    }
+
+    private func checkpoint(reason: String) {
+        assertOnQueue(queue)
+
+        let grdbStorage = databaseStorage.grdbStorage
+        let walSizeBefore = grdbStorage.databaseWALFileSize
+        do {
+            try grdbStorage.syncMaintenanceCheckpoint()
+        } catch {
+            Logger.warn("Checkpoint (\(reason)) failed: \(error.grdbErrorForLogging)")
+        }
+        let walSizeAfter = grdbStorage.databaseWALFileSize
+        if walSizeBefore != walSizeAfter {
+            Logger.info("Checkpoint (\(reason)): WAL \(walSizeBefore) -> \(walSizeAfter) bytes")
+        }
+    }
+
+    private func runDailyTasksIfNecessary() {
+        assertOnQueue(queue)
+
+        let (lastReportDate, lastReportedFileSize) = databaseStorage.read { tx in
+            return (
+                keyValueStore.getDate(Constants.lastReportDateKey, transaction: tx),
+                keyValueStore.getUInt64(Constants.lastReportedFileSizeKey, transaction: tx)
+            )
+        }
+        if let lastReportDate, -lastReportDate.timeIntervalSinceNow < Constants.growthReportInterval {
+            return
+        }
+
+        let grdbStorage = databaseStorage.grdbStorage
+        let fileSize = grdbStorage.databaseFileSize
+        let walSize = grdbStorage.databaseWALFileSize
+        let freelistPageCount = grdbStorage.databaseFreelistPageCount()
+        var message = "Database: \(fileSize) bytes, WAL: \(walSize) bytes, free pages: \(freelistPageCount)"
+        if let lastReportDate, let lastReportedFileSize {
+            let days = -lastReportDate.timeIntervalSinceNow / kDayInterval
+            let growth = Int64(fileSize) - Int64(lastReportedFileSize)
+            message += ", growth: \(growth) bytes in \(String(format: "%.1f", days)) days"
+        }
+        Logger.info(message)
+
+        databaseStorage.write { tx in
+            keyValueStore.setDate(Date(), key: Constants.lastReportDateKey, transaction: tx)
+            keyValueStore.setUInt64(fileSize, key: Constants.lastReportedFileSizeKey, transaction: tx)
+
+            do {
+                let repairedCount = try ThreadUnreadCounts.repair(tx: tx)
+                owsAssertDebug(repairedCount == 0, "Unread counts were out of sync in \(repairedCount) thread(s)")
+            } catch {
+                owsFailDebug("Couldn't repair unread counts: \(error.grdbErrorForLogging)")
+            }
+        }
+    }
+}
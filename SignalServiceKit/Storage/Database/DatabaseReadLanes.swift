@@ -0,0 +1,113 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// Splits the database pool's readers between interactive and background
+/// work.
+///
+/// Reads from utility- and background-QoS threads (backups, search
+/// indexing, media gallery loads, etc.) go in the background lane, which may
+/// only hold `maximumBackgroundReaderCount` of the pool's readers at once.
+/// The rest are left for reads the user is waiting on, such as opening a
+/// conversation. Interactive reads are never held back.
+///
+/// Each lane keeps a histogram of how long its reads waited for a reader,
+/// which is logged periodically.
+///
+/// This class is thread-safe.
+final class DatabaseReadLanes {
+
+    enum Lane: CaseIterable {
+        case interactive
+        case background
+
+        static var current: Lane {
+            switch qos_class_self() {
+            case QOS_CLASS_UTILITY, QOS_CLASS_BACKGROUND:
+                return .background
+            default:
+                return .interactive
+            }
+        }
+    }
+
+    struct Ticket {
+        fileprivate let lane: Lane
+        fileprivate let startTime: CFTimeInterval
+    }
+
+    /// Wait time counts, bucketed by upper bound in milliseconds; the last
+    /// bucket has no upper bound.
+    struct WaitTimeHistogram {
+        static let bucketUpperBoundsMs: [Double] = [1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024]
+
+        private(set) var counts = [Int](repeating: 0, count: bucketUpperBoundsMs.count + 1)
+
+        var totalCount: Int { counts.reduce(0, +) }
+
+        mutating func record(waitTimeMs: Double) {
+            let bucketIndex = Self.bucketUpperBoundsMs.firstIndex(where: { waitTimeMs <= $0 }) ?? Self.bucketUpperBoundsMs.count
+            counts[bucketIndex] += 1
+        }
+
+        var description: String {
+            return counts.enumerated().compactMap { bucketIndex, count -> String? in
+                guard count > 0 else {
+                    return nil
+                }
+                let bucketName = bucketIndex < Self.bucketUpperBoundsMs.count ? "≤\(Int(Self.bucketUpperBoundsMs[bucketIndex]))ms" : ">\(Int(Self.bucketUpperBoundsMs.last!))ms"
+                return "\(bucketName): \(count)"
+            }.joined(separator: ", ")
+        }
+    }
+
+    /// How many reads a lane records between logging its histogram.
+    private static let readsPerLog = 10_000
+
+    private let backgroundReaderSemaphore: DispatchSemaphore?
+    private let histograms = AtomicValue<[Lane: WaitTimeHistogram]>([:], lock: UnfairLock())
+
+    /// - Parameter maximumBackgroundReaderCount: The number of readers the
+    /// background lane may hold at once, or nil to not limit it.
+    init(maximumBackgroundReaderCount: Int?) {
+        self.backgroundReaderSemaphore = maximumBackgroundReaderCount.map { DispatchSemaphore(value: $0) }
+    }
+
+    /// Call before asking the pool for a reader. Blocks until the current
+    /// thread's lane has room for another reader.
+    func enter() -> Ticket {
+        let ticket = Ticket(lane: .current, startTime: CACurrentMediaTime())
+        if ticket.lane == .background {
+            backgroundReaderSemaphore?.wait()
+        }
+        return ticket
+    }
+
+    /// Call once the pool has provided a reader.
+    func didAcquireReader(_ ticket: Ticket) {
+        let waitTimeMs = (CACurrentMediaTime() - ticket.startTime) * 1000
+        let histogramToLog = histograms.update { histograms -> WaitTimeHistogram? in
+            var histogram = histograms[ticket.lane] ?? WaitTimeHistogram()
+            histogram.record(waitTimeMs: waitTimeMs)
+            histograms[ticket.lane] = histogram
+            return histogram.totalCount % Self.readsPerLog == 0 ? histogram : nil
+        }
+        if let histogramToLog {
+            Logger.info("Read wait times for \(ticket.lane) lane: \(histogramToLog.description)")
+        }
+    }
+
+    /// Call after the read finishes, whether or not it succeeded.
+    func leave(_ ticket: Ticket) {
+        if ticket.lane == .background {
+            backgroundReaderSemaphore?.signal()
+        }
+    }
+
+    func waitTimeHistogram(for lane: Lane) -> WaitTimeHistogram {
+        return histograms.get()[lane] ?? WaitTimeHistogram()
+    }
+}
@@ -279,6 +279,9 @@ public extension DatabaseRecovery {
             OrphanedAttachmentRecord.databaseTableName,
             QueuedAttachmentDownloadRecord.databaseTableName,
             ArchivedPayment.databaseTableName,
+            PaymentModelKeys.tableName,
+            // Best-effort, like the key-value stores these used to live in.
+            EarlyMessageManager.tableName,
             // TODO: remove this once the attachment migration is blocking; by the time
             // this runs migrations are done and the migration table will be deleted.
             TSAttachmentMigration.V1AttachmentReservedFileIds.databaseTableName,
@@ -445,6 +448,9 @@ public extension DatabaseRecovery {
             OWSMessageContentJob.table.tableName, // also, this one is deprecated
             // Recovered manually in other steps.
             MediaGalleryRecord.databaseTableName,
+            FullTextSearchIndexer.pendingTableName,
+            // Rebuilt by triggers as interactions are copied.
+            ThreadUnreadCounts.tableName,
             // Can be recovered in other ways, after recovery is done.
             IncomingGroupsV2MessageJob.table.tableName,
             KnownStickerPack.table.tableName,
@@ -116,6 +116,9 @@ public class GRDBDatabaseStorageAdapter: NSObject {
         /// We use CLOCK_UPTIME_RAW here to match the one used by `asyncAfter`.
         var lastCheckpointTimestamp: UInt64?
 
+        /// The last time a write transaction committed.
+        var lastWriteTimestamp: UInt64?
+
         static func currentTimestamp() -> UInt64 { clock_gettime_nsec_np(CLOCK_UPTIME_RAW) }
     }
 
@@ -123,6 +126,8 @@ public class GRDBDatabaseStorageAdapter: NSObject {
 
     private let storage: GRDBStorage
 
+    private let readLanes: DatabaseReadLanes
+
     public var pool: DatabasePool {
         return storage.pool
     }
@@ -138,6 +143,10 @@ public class GRDBDatabaseStorageAdapter: NSObject {
         } catch {
             throw error
         }
+
+        self.readLanes = DatabaseReadLanes(
+            maximumBackgroundReaderCount: CurrentAppContext().isMainApp ? GRDBStorage.maximumBackgroundReaderCountInMainApp : nil
+        )
     }
 
     deinit {
@@ -191,8 +200,22 @@ public class GRDBDatabaseStorageAdapter: NSObject {
         try pool.write { db in
             db.add(transactionObserver: databaseChangeObserver, extent: Database.TransactionObservationExtent.observerLifetime)
         }
+
+        // The main app is told about writes from the extensions via
+        // SDSCrossProcess. Let it know what those writes changed.
+        if !CurrentAppContext().isMainApp {
+            let crossProcessChangeRecorder = CrossProcessChangeRecorder(
+                journal: CrossProcessChangeJournal(fileUrl: CrossProcessChangeJournal.defaultFileUrl)
+            )
+            self.crossProcessChangeRecorder = crossProcessChangeRecorder
+            try pool.write { db in
+                db.add(transactionObserver: crossProcessChangeRecorder, extent: Database.TransactionObservationExtent.observerLifetime)
+            }
+        }
     }
 
+    private var crossProcessChangeRecorder: CrossProcessChangeRecorder?
+
     func testing_tearDownDatabaseChangeObserver() {
         // DatabaseChangeObserver is a general purpose observer, whose delegates
         // are notified when things change, but are not given any specific details
@@ -236,6 +259,8 @@ public class GRDBDatabaseStorageAdapter: NSObject {
         try db.execute(sql: "PRAGMA key = \"\(key)\"")
         try db.execute(sql: "PRAGMA cipher_plaintext_header_size = 32")
         try db.execute(sql: "PRAGMA checkpoint_fullfsync = ON")
+        // This only takes effect for new databases (see IncrementalVacuum).
+        try db.execute(sql: "PRAGMA auto_vacuum = INCREMENTAL")
         try SqliteUtil.setBarrierFsync(db: db, enabled: true)
 
         if !CurrentAppContext().isMainApp {
@@ -360,8 +385,11 @@ extension GRDBDatabaseStorageAdapter: SDSDatabaseStorageAdapter {
         }
         #endif
 
+        let readLaneTicket = readLanes.enter()
+        defer { readLanes.leave(readLaneTicket) }
         return try pool.read { database in
-            try autoreleasepool {
+            readLanes.didAcquireReader(readLaneTicket)
+            return try autoreleasepool {
                 try block(GRDBReadTransaction(database: database))
             }
         }
@@ -401,7 +429,10 @@ extension GRDBDatabaseStorageAdapter: SDSDatabaseStorageAdapter {
         }
         #endif
 
+        let readLaneTicket = readLanes.enter()
+        defer { readLanes.leave(readLaneTicket) }
         try pool.read { database in
+            readLanes.didAcquireReader(readLaneTicket)
             autoreleasepool {
                 block(GRDBReadTransaction(database: database))
             }
@@ -440,6 +471,7 @@ extension GRDBDatabaseStorageAdapter: SDSDatabaseStorageAdapter {
         }
 
         checkpointState.update { mutableState in
+            mutableState.lastWriteTimestamp = CheckpointState.currentTimestamp()
             mutableState.budget -= 1
             if mutableState.budget == 0 {
                 scheduleCheckpoint(lastCheckpointTimestamp: mutableState.lastCheckpointTimestamp)
@@ -732,6 +764,10 @@ private struct GRDBStorage {
 
     fileprivate static var maximumReaderCountInExtensions: Int { 4 }
 
+    /// Of the main app's readers, how many background work may hold at once.
+    /// See `DatabaseReadLanes`.
+    fileprivate static var maximumBackgroundReaderCountInMainApp: Int { 4 }
+
     private static func buildConfiguration(keyFetcher: GRDBKeyFetcher) -> Configuration {
         var configuration = Configuration()
         configuration.readonly = false
@@ -774,6 +810,9 @@ private struct GRDBStorage {
         configuration.prepareDatabase { db in
             try GRDBDatabaseStorageAdapter.prepareDatabase(db: db, keyFetcher: keyFetcher)
 
+            SlowQueryLog.shared.install(in: db)
+
+            // This replaces the SlowQueryLog's trace; a connection has only one.
             #if DEBUG
             #if false
                 db.trace { dbQueryLog("\($0)") }
@@ -974,6 +1013,16 @@ extension GRDBDatabaseStorageAdapter {
         return fileSize.uint64Value
     }
 
+    /// The number of unused pages in the database file.
+    func databaseFreelistPageCount() -> Int {
+        do {
+            return try pool.read { db in try Int.fetchOne(db, sql: "PRAGMA freelist_count") ?? 0 }
+        } catch {
+            Logger.warn("Couldn't count free pages: \(error.grdbErrorForLogging)")
+            return 0
+        }
+    }
+
     var databaseSHMFileSize: UInt64 {
         guard let fileSize = OWSFileSystem.fileSize(ofPath: databaseSHMFilePath) else {
             owsFailDebug("Could not determine file size.")
@@ -990,6 +1039,30 @@ extension GRDBDatabaseStorageAdapter {
         try GRDBDatabaseStorageAdapter.checkpoint(pool: pool)
     }
 
+    /// Runs a passive checkpoint, which integrates what it can without
+    /// waiting for readers, and then a truncating one, which has less left to
+    /// do as a result.
+    ///
+    /// This runs on the queue used for the checkpoints scheduled after writes
+    /// so that the two never overlap.
+    func syncMaintenanceCheckpoint() throws {
+        try checkpointQueue.sync {
+            try pool.writeWithoutTransaction { db in
+                try db.checkpoint(.passive)
+            }
+            try GRDBDatabaseStorageAdapter.checkpoint(pool: pool)
+        }
+    }
+
+    /// How long it's been since a write transaction committed in this
+    /// process, or nil if none has.
+    var timeIntervalSinceLastWrite: TimeInterval? {
+        guard let lastWriteTimestamp = checkpointState.get().lastWriteTimestamp else {
+            return nil
+        }
+        return TimeInterval(CheckpointState.currentTimestamp() - lastWriteTimestamp) / TimeInterval(NSEC_PER_SEC)
+    }
+
     private static func checkpoint(pool: DatabasePool) throws {
         try Bench(title: "Slow checkpoint", logIfLongerThan: 0.01, logInProduction: true) {
             // Set checkpointTimeout flag.
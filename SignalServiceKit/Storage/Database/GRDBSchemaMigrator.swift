@@ -75,9 +75,10 @@ public class GRDBSchemaMigrator: NSObject {
 
         // First do the schema migrations. (See the comment within MigrationId for why schema and data
         // migrations are separate.)
-        let incrementalMigrator = DatabaseMigratorWrapper()
+        let incrementalMigrator = DatabaseMigratorWrapper(deferredMigrationIds: deferredDataMigrationIds)
         registerSchemaMigrations(migrator: incrementalMigrator)
         try incrementalMigrator.migrate(grdbStorageAdapter.pool)
+        incrementalMigrator.logTimings(label: "schema")
 
         if runDataMigrations {
             // Hack: Load the account state now, so it can be accessed while performing other migrations.
@@ -91,6 +92,7 @@ public class GRDBSchemaMigrator: NSObject {
             // Finally, do data migrations.
             registerDataMigrations(migrator: incrementalMigrator)
             try incrementalMigrator.migrate(grdbStorageAdapter.pool)
+            incrementalMigrator.logTimings(label: "data")
         }
 
         let allAppliedMigrations = try grdbStorageAdapter.read { transaction in
@@ -100,6 +102,46 @@ public class GRDBSchemaMigrator: NSObject {
         return allAppliedMigrations != previouslyAppliedMigrations
     }
 
+    /// Data migrations that run after launch rather than during it.
+    ///
+    /// These rebuild derived data that nothing needs at launch, such as search
+    /// indexes, and can take a long time on large databases. No other
+    /// migration may depend on them, and they must tolerate the app writing
+    /// to the tables they read while they're pending.
+    private static let deferredDataMigrationIds: Set<MigrationId> = [
+        .dataMigration_removeGroupStoryRepliesFromSearchIndex,
+        .dataMigration_indexSearchableNames,
+    ]
+
+    /// Runs the data migrations that were deferred at launch.
+    ///
+    /// Each runs in its own write transaction, alongside other writes rather
+    /// than behind a barrier, and is marked complete in that transaction. If
+    /// the app exits first, the remaining ones run again next launch.
+    public static func runDeferredDataMigrations(databaseStorage: SDSDatabaseStorage) async {
+        let migrator = DatabaseMigratorWrapper(deferredMigrationIds: deferredDataMigrationIds)
+        registerDataMigrations(migrator: migrator)
+        for (identifier, migrate) in migrator.deferredMigrations {
+            do {
+                try await databaseStorage.awaitableWrite { tx in
+                    let transaction = tx.unwrapGrdbWrite
+                    guard try DatabaseMigrator().appliedIdentifiers(transaction.database).contains(identifier.rawValue).negated else {
+                        return
+                    }
+                    Logger.info("Running deferred migration: \(identifier)")
+                    let startTime = CACurrentMediaTime()
+                    try migrate(transaction).get()
+                    insertMigration(identifier.rawValue, db: transaction.database)
+                    migrator.recordTiming(identifier: identifier, duration: CACurrentMediaTime() - startTime)
+                }
+            } catch {
+                owsFailDebug("Deferred migration \(identifier) failed: \(error.grdbErrorForLogging)")
+                return
+            }
+        }
+        migrator.logTimings(label: "deferred data")
+    }
+
     private static func hasCreatedInitialSchema(transaction: GRDBReadTransaction) throws -> Bool {
         let appliedMigrations = try DatabaseMigrator().appliedIdentifiers(transaction.database)
         return appliedMigrations.contains(MigrationId.createInitialSchema.rawValue)
@@ -295,6 +337,12 @@ public class GRDBSchemaMigrator: NSObject {
         case addIsViewOnceColumnToMessageAttachmentReference
         case backfillIsViewOnceMessageAttachmentReference
         case addAttachmentValidationBackfillTable
+        case addConversationViewCoveringIndex
+        case addPendingFullTextSearchIndexTable
+        case addIsCompressedToMessageSendLogPayload
+        case addThreadUnreadCountTable
+        case addPaymentModelKeyTable
+        case addEarlyMessageTable
 
         // NOTE: Every time we add a migration id, consider
         // incrementing grdbSchemaVersionLatest.
@@ -353,6 +401,7 @@ public class GRDBSchemaMigrator: NSObject {
         case dataMigration_ensureLocalDeviceId
         case dataMigration_indexSearchableNames
         case dataMigration_removeSystemContacts
+        case dataMigration_populatePaymentModelKeys
     }
 
     public static let grdbSchemaVersionDefault: UInt = 0
@@ -395,6 +444,17 @@ public class GRDBSchemaMigrator: NSObject {
     private class DatabaseMigratorWrapper {
         var migrator = DatabaseMigrator()
 
+        /// Migrations with these identifiers are collected in
+        /// `deferredMigrations` instead of being registered.
+        private let deferredMigrationIds: Set<MigrationId>
+        private(set) var deferredMigrations = [(MigrationId, (GRDBWriteTransaction) throws -> Result<Void, Error>)]()
+
+        private let timings = AtomicValue<[(MigrationId, CFTimeInterval)]>([], lock: UnfairLock())
+
+        init(deferredMigrationIds: Set<MigrationId> = []) {
+            self.deferredMigrationIds = deferredMigrationIds
+        }
+
         /**
          * Registers a database migration to be run asynchronously.
          *
@@ -410,6 +470,11 @@ public class GRDBSchemaMigrator: NSObject {
             _ identifier: MigrationId,
             migrate: @escaping (GRDBWriteTransaction) throws -> Result<Void, Error>
         ) {
+            if deferredMigrationIds.contains(identifier) {
+                deferredMigrations.append((identifier, migrate))
+                return
+            }
+            let timings = self.timings
             // Hold onto a reference to the migrator, so we can use its `appliedIdentifiers` method
             // which is really a static method since it uses no instance state, but needs a reference
             // to an instance (any instance, doesn't matter) anyway.
@@ -457,6 +522,7 @@ public class GRDBSchemaMigrator: NSObject {
                     let timeElapsed = CACurrentMediaTime() - startTime
                     let formattedTime = String(format: "%0.2fms", timeElapsed * 1000)
                     Logger.info("Migration completed: \(identifier), duration: \(formattedTime)")
+                    timings.update { $0.append((identifier, timeElapsed)) }
                 case .failure(let error):
                     throw error
                 }
@@ -467,6 +533,27 @@ public class GRDBSchemaMigrator: NSObject {
         func migrate(_ database: DatabaseWriter) throws {
             try migrator.migrate(database)
         }
+
+        func recordTiming(identifier: MigrationId, duration: CFTimeInterval) {
+            timings.update { $0.append((identifier, duration)) }
+        }
+
+        /// Logs the total duration of the migrations run since the last call
+        /// and the slowest of them, so slow launches can be traced to a
+        /// migration.
+        func logTimings(label: String) {
+            let timings = self.timings.update { timings in
+                defer { timings = [] }
+                return timings
+            }
+            guard !timings.isEmpty else {
+                return
+            }
+            let formatDuration = { (duration: CFTimeInterval) in String(format: "%0.2fms", duration * 1000) }
+            let totalDuration = timings.reduce(0) { $0 + $1.1 }
+            let slowest = timings.sorted { $0.1 > $1.1 }.prefix(3).map { "\($0.0) (\(formatDuration($0.1)))" }
+            Logger.info("Ran \(timings.count) \(label) migrations in \(formatDuration(totalDuration)); slowest: \(slowest.joined(separator: ", "))")
+        }
     }
 
     private static func registerSchemaMigrations(migrator: DatabaseMigratorWrapper) {
@@ -3492,6 +3579,159 @@ public class GRDBSchemaMigrator: NSObject {
             return .success(())
         }
 
+        migrator.registerMigration(.addConversationViewCoveringIndex) { tx in
+            // The conversation view pages through a thread by row id, fetching
+            // only uniqueIds and filtering out edit history, group story
+            // replies, and placeholders. This index covers all of those
+            // columns, so pages (and InteractionFinder.firstInteraction(
+            // atOrAroundSortId:)) are served from the index alone.
+            //
+            // It supersedes the "distance" index, which didn't include
+            // editState and so had to read every candidate row.
+            //
+            // As in tunedConversationLoadIndices, the WHERE clause mustn't
+            // quote its column name or the planner won't use this index.
+            try tx.database.execute(sql: """
+                DROP INDEX IF EXISTS index_model_TSInteraction_ConversationLoadInteractionDistance;
+
+                CREATE INDEX index_model_TSInteraction_ConversationViewKeyset
+                ON model_TSInteraction(uniqueThreadId, id, isGroupStoryReply, editState, recordType, uniqueId)
+                WHERE recordType IS NOT \(SDSRecordType.recoverableDecryptionPlaceholder.rawValue);
+            """)
+            return .success(())
+        }
+
+        migrator.registerMigration(.addPendingFullTextSearchIndexTable) { tx in
+            // Messages waiting to be added to the FTS index; see
+            // FullTextSearchIndexer.enqueue(_:tx:).
+            try tx.database.create(table: "PendingFullTextSearchIndex") { table in
+                table.column("interactionRowId", .integer)
+                    .notNull()
+                    .references("model_TSInteraction", column: "id", onDelete: .cascade)
+                    .primaryKey(onConflict: .ignore)
+            }
+            return .success(())
+        }
+
+        migrator.registerMigration(.addIsCompressedToMessageSendLogPayload) { tx in
+            try tx.database.alter(table: "MessageSendLog_Payload") { table in
+                table.add(column: "isCompressed", .boolean)
+                    .notNull()
+                    .defaults(to: false)
+            }
+            return .success(())
+        }
+
+        migrator.registerMigration(.addThreadUnreadCountTable) { tx in
+            // Unread counts per thread, kept up to date by triggers so that the
+            // chat list and the badge don't have to count interactions. The
+            // triggers apply the same filter as
+            // InteractionFinder.sqlClauseForUnreadInteractionCounts; see
+            // ThreadUnreadCounts if that filter changes.
+            try tx.database.create(table: "ThreadUnreadCount") { table in
+                table.column("threadUniqueId", .text).notNull().primaryKey()
+                table.column("unreadCount", .integer).notNull().defaults(to: 0)
+            }
+
+            func isUnread(_ row: String) -> String {
+                return """
+                (
+                    \(row).read IS 0
+                    AND \(row).isGroupStoryReply IS NOT 1
+                    AND (
+                        \(row).editState IN (\(TSEditState.none.rawValue), \(TSEditState.latestRevisionUnread.rawValue))
+                        OR \(row).editState IS NULL
+                    )
+                    AND (
+                        \(row).recordType IS \(SDSRecordType.incomingMessage.rawValue)
+                        OR (
+                            \(row).recordType IS \(SDSRecordType.infoMessage.rawValue)
+                            AND \(row).messageType IS \(TSInfoMessageType.userJoinedSignal.rawValue)
+                        )
+                    )
+                )
+                """
+            }
+
+            try tx.database.execute(sql: """
+                CREATE TRIGGER "__ThreadUnreadCount_ai" AFTER INSERT ON "model_TSInteraction"
+                  WHEN \(isUnread("NEW"))
+                  BEGIN
+                    INSERT OR IGNORE INTO ThreadUnreadCount (threadUniqueId) VALUES (NEW.uniqueThreadId);
+                    UPDATE ThreadUnreadCount SET unreadCount = unreadCount + 1 WHERE threadUniqueId = NEW.uniqueThreadId;
+                  END;
+
+                CREATE TRIGGER "__ThreadUnreadCount_ad" AFTER DELETE ON "model_TSInteraction"
+                  WHEN \(isUnread("OLD"))
+                  BEGIN
+                    UPDATE ThreadUnreadCount SET unreadCount = unreadCount - 1 WHERE threadUniqueId = OLD.uniqueThreadId;
+                  END;
+
+                CREATE TRIGGER "__ThreadUnreadCount_au"
+                  AFTER UPDATE OF read, isGroupStoryReply, editState, recordType, messageType, uniqueThreadId ON "model_TSInteraction"
+                  WHEN \(isUnread("OLD")) IS NOT \(isUnread("NEW")) OR OLD.uniqueThreadId IS NOT NEW.uniqueThreadId
+                  BEGIN
+                    UPDATE ThreadUnreadCount SET unreadCount = unreadCount - 1
+                      WHERE threadUniqueId = OLD.uniqueThreadId AND \(isUnread("OLD"));
+                    INSERT OR IGNORE INTO ThreadUnreadCount (threadUniqueId)
+                      SELECT NEW.uniqueThreadId WHERE \(isUnread("NEW"));
+                    UPDATE ThreadUnreadCount SET unreadCount = unreadCount + 1
+                      WHERE threadUniqueId = NEW.uniqueThreadId AND \(isUnread("NEW"));
+                  END;
+
+                CREATE TRIGGER "__ThreadUnreadCount_thread_ad" AFTER DELETE ON "model_TSThread"
+                  BEGIN
+                    DELETE FROM ThreadUnreadCount WHERE threadUniqueId = OLD.uniqueId;
+                  END;
+
+                INSERT INTO ThreadUnreadCount (threadUniqueId, unreadCount)
+                  SELECT uniqueThreadId, COUNT(*)
+                  FROM model_TSInteraction
+                  WHERE \(isUnread("model_TSInteraction"))
+                  GROUP BY uniqueThreadId;
+            """)
+            return .success(())
+        }
+
+        migrator.registerMigration(.addPaymentModelKeyTable) { tx in
+            // The MobileCoin keys of each payment model; see PaymentModelKeys.
+            // Filled in by dataMigration_populatePaymentModelKeys.
+            try tx.database.create(table: "PaymentModelKey") { table in
+                table.column("paymentModelRowId", .integer)
+                    .notNull()
+                    .references("model_TSPaymentModel", column: "id", onDelete: .cascade)
+                table.column("kind", .integer).notNull()
+                table.column("key", .blob).notNull()
+                table.primaryKey(["paymentModelRowId", "kind", "key"], onConflict: .ignore)
+            }
+            try tx.database.create(
+                index: "index_PaymentModelKey_on_kind_and_key",
+                on: "PaymentModelKey",
+                columns: ["kind", "key"]
+            )
+            return .success(())
+        }
+
+        migrator.registerMigration(.addEarlyMessageTable) { tx in
+            // Envelopes and receipts that arrived before their target message; see
+            // EarlyMessageManager. What's left in its old key-value stores is moved
+            // over after launch.
+            try tx.database.create(table: "EarlyMessage") { table in
+                table.autoIncrementedPrimaryKey("id").notNull()
+                table.column("targetAuthorAci", .blob).notNull()
+                table.column("targetTimestamp", .integer).notNull()
+                table.column("kind", .integer).notNull()
+                table.column("payload", .blob).notNull()
+            }
+            // Timestamp first so that expiring by age can use it too.
+            try tx.database.create(
+                index: "index_EarlyMessage_on_targetTimestamp_and_targetAuthorAci_and_kind",
+                on: "EarlyMessage",
+                columns: ["targetTimestamp", "targetAuthorAci", "kind"]
+            )
+            return .success(())
+        }
+
         // MARK: - Schema Migration Insertion Point
     }
 
@@ -3939,6 +4179,13 @@ public class GRDBSchemaMigrator: NSObject {
             return .success(())
         }
 
+        migrator.registerMigration(.dataMigration_populatePaymentModelKeys) { transaction in
+            TSPaymentModel.anyEnumerate(transaction: transaction.asAnyWrite, batchSize: 100) { paymentModel, _ in
+                paymentModel.updatePaymentModelKeys(transaction: transaction.asAnyWrite)
+            }
+            return .success(())
+        }
+
         // MARK: - Data Migration Insertion Point
     }
 
@@ -19,6 +19,17 @@ public class IncrementalMessageTSAttachmentMigratorImpl: IncrementalMessageTSAtt
     private let databaseStorage: SDSDatabaseStorage
     private let store: IncrementalTSAttachmentMigrationStore
 
+    /// How long a single batch's write transaction should take. Each batch
+    /// copies attachment files inside the transaction, so the number of
+    /// messages that fits in the budget varies a lot between devices and
+    /// attachments; the batch size is adjusted after every batch to match.
+    private static let batchTimeBudget: TimeInterval = 0.5
+    private static let maxBatchSize = 100
+    private let batchSize = AtomicValue<Int>(
+        TSAttachmentMigration.TSMessageMigration.defaultIterativeBatchSize,
+        lock: .init()
+    )
+
     public init(
         databaseStorage: SDSDatabaseStorage,
         store: IncrementalTSAttachmentMigrationStore
@@ -73,9 +84,22 @@ public class IncrementalMessageTSAttachmentMigratorImpl: IncrementalMessageTSAtt
     public func runNextBatch() async throws -> Bool {
         typealias Migrator = TSAttachmentMigration.TSMessageMigration
 
+        await waitForThermalAndPowerHeadroom()
+
+        let batchSize = self.batchSize.get()
+
         return try await databaseStorage.awaitableWrite { tx in
+            // Time inside the transaction only, so waiting for the write lock
+            // doesn't shrink the batches.
+            let startDate = MonotonicDate()
+            defer {
+                let elapsed = TimeInterval(MonotonicDate() - startDate) / TimeInterval(NSEC_PER_SEC)
+                self.adjustBatchSize(batchSize, elapsed: elapsed)
+            }
+
             // First we try to migrate a batch of prepared messages.
             let didMigrateBatch = try Migrator.completeNextIterativeTSMessageMigrationBatch(
+                batchSize: batchSize,
                 tx: tx.unwrapGrdbWrite
             )
             if didMigrateBatch {
@@ -84,6 +108,7 @@ public class IncrementalMessageTSAttachmentMigratorImpl: IncrementalMessageTSAtt
 
             // If no messages are prepared, we try to prepare a batch of messages.
             let didPrepareBatch = try Migrator.prepareNextIterativeTSMessageMigrationBatch(
+                batchSize: batchSize,
                 tx: tx.unwrapGrdbWrite
             )
             if didPrepareBatch {
@@ -97,6 +122,41 @@ public class IncrementalMessageTSAttachmentMigratorImpl: IncrementalMessageTSAtt
             return true
         }
     }
+
+    /// Halves the batch size if the last batch ran over budget, and doubles
+    /// it if it finished in less than half of it.
+    private func adjustBatchSize(_ lastBatchSize: Int, elapsed: TimeInterval) {
+        let newBatchSize: Int
+        if elapsed > Self.batchTimeBudget {
+            newBatchSize = max(1, lastBatchSize / 2)
+        } else if elapsed < Self.batchTimeBudget / 2 {
+            newBatchSize = min(Self.maxBatchSize, lastBatchSize * 2)
+        } else {
+            newBatchSize = lastBatchSize
+        }
+        batchSize.set(newBatchSize)
+    }
+
+    /// Every batch reads and writes attachment files, so back off while the
+    /// device is hot or in Low Power Mode instead of adding to the load.
+    /// Cancellation ends the wait early; the caller checks for it between
+    /// batches.
+    private func waitForThermalAndPowerHeadroom() async {
+        while !Task.isCancelled {
+            switch ProcessInfo.processInfo.thermalState {
+            case .serious, .critical:
+                Logger.info("Pausing message attachment migration while the device is hot")
+                try? await Task.sleep(nanoseconds: 30 * NSEC_PER_SEC)
+            default:
+                if ProcessInfo.processInfo.isLowPowerModeEnabled {
+                    // Space batches out rather than stopping; backups wait on
+                    // this migration to finish.
+                    try? await Task.sleep(nanoseconds: NSEC_PER_SEC)
+                }
+                return
+            }
+        }
+    }
 }
 
 public class NoOpIncrementalMessageTSAttachmentMigrator: IncrementalMessageTSAttachmentMigrator {
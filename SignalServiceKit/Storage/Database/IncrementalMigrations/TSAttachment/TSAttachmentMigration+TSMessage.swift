@@ -85,18 +85,23 @@ extension TSAttachmentMigration {
             )
         }
 
+        /// The number of messages prepared or completed per iterative batch, unless the caller
+        /// picks its own.
+        public static let defaultIterativeBatchSize = 5
+
         /// Phases 1 and 2 when running as an iterative migration.
         /// - Returns
         /// True if any rows were migrated; callers should keep calling until it returns false.
-        public static func prepareNextIterativeTSMessageMigrationBatch(tx: GRDBWriteTransaction) throws -> Bool {
+        public static func prepareNextIterativeTSMessageMigrationBatch(
+            batchSize: Int = defaultIterativeBatchSize,
+            tx: GRDBWriteTransaction
+        ) throws -> Bool {
             // If we finished phase 2, we are done.
             let finished: Bool? = try Self.read(key: finishedGoingForwardsKey, tx: tx)
             if finished == true {
                 return false
             }
 
-            let batchSize = 5
-
             guard
                 let maxMigratedRowId: Int64 = try Self.read(key: maxMigratedInteractionRowIdKey, tx: tx)
             else {
@@ -245,8 +250,10 @@ extension TSAttachmentMigration {
         /// Phase 3 when running as an iterative migration.
         /// - Returns
         /// True if any rows were migrated; callers should keep calling until it returns false.
-        public static func completeNextIterativeTSMessageMigrationBatch(tx: GRDBWriteTransaction) throws -> Bool {
-            let batchSize = 5
+        public static func completeNextIterativeTSMessageMigrationBatch(
+            batchSize: Int = defaultIterativeBatchSize,
+            tx: GRDBWriteTransaction
+        ) throws -> Bool {
             let count = try Self.completeTSMessageMigrationBatch(batchSize: batchSize, tx: tx)
             return count > 0
         }
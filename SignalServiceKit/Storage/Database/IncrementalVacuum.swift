@@ -0,0 +1,83 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+import GRDB
+
+/// Returns free database pages to the file system after large deletes.
+///
+/// SQLite can only do this for databases in incremental auto-vacuum mode,
+/// which must be chosen before the first table is created (see
+/// `GRDBDatabaseStorageAdapter.prepareDatabase`). Switching an existing
+/// database requires a full `VACUUM`, which rewrites the whole file, so
+/// older databases aren't converted; their free pages are reused by later
+/// inserts instead.
+final class IncrementalVacuum {
+    private enum Constants {
+        /// `PRAGMA auto_vacuum` returns 2 for incremental mode.
+        static let incrementalAutoVacuumMode = 2
+    }
+
+    private let db: DB
+    private let checkpoint: () throws -> Void
+
+    private let logger = PrefixedLogger(prefix: "[IncrementalVacuum]")
+
+    /// - Parameter checkpoint: Truncates the WAL, which grows by every page
+    /// the vacuum moves.
+    init(db: DB, checkpoint: @escaping () throws -> Void) {
+        self.db = db
+        self.checkpoint = checkpoint
+    }
+
+    /// Frees at most `maxPagesPerPass` pages per write transaction, so that
+    /// other writers can interleave with the passes, and then checkpoints.
+    func run(maxPagesPerPass: Int = 256) async {
+        let isIncremental = db.read { tx in
+            let database = SDSDB.shimOnlyBridge(tx).unwrapGrdbRead.database
+            return (try? Int.fetchOne(database, sql: "PRAGMA auto_vacuum")) == Constants.incrementalAutoVacuumMode
+        }
+        guard isIncremental else {
+            return
+        }
+
+        var freedPageCount = 0
+        while true {
+            let passResult = await db.awaitableWrite { tx -> (freedPageCount: Int, remainingPageCount: Int)? in
+                let database = SDSDB.shimOnlyBridge(tx).unwrapGrdbWrite.database
+                do {
+                    let freePageCount = try Int.fetchOne(database, sql: "PRAGMA freelist_count") ?? 0
+                    guard freePageCount > 0 else {
+                        return (0, 0)
+                    }
+                    try database.execute(sql: "PRAGMA incremental_vacuum(\(maxPagesPerPass))")
+                    let remainingPageCount = try Int.fetchOne(database, sql: "PRAGMA freelist_count") ?? 0
+                    return (freePageCount - remainingPageCount, remainingPageCount)
+                } catch {
+                    self.logger.warn("Pass failed: \(error.grdbErrorForLogging)")
+                    return nil
+                }
+            }
+            guard let passResult else {
+                break
+            }
+            freedPageCount += passResult.freedPageCount
+            guard passResult.freedPageCount > 0, passResult.remainingPageCount > 0 else {
+                break
+            }
+            await Task.yield()
+        }
+
+        guard freedPageCount > 0 else {
+            return
+        }
+        logger.info("Freed \(freedPageCount) pages.")
+        do {
+            try checkpoint()
+        } catch {
+            logger.warn("Checkpoint failed: \(error.grdbErrorForLogging)")
+        }
+    }
+}
@@ -180,10 +180,10 @@ public class InteractionFinder: NSObject {
             let includeMutedThreads = SSKPreferences.includeMutedThreadsInBadgeCount(transaction: transaction)
 
             var unreadInteractionQuery = """
-                SELECT COUNT(interaction.\(interactionColumn: .id))
-                FROM \(InteractionRecord.databaseTableName) AS interaction
+                SELECT COALESCE(SUM(unreadCount.\(ThreadUnreadCounts.unreadCountColumn)), 0)
+                FROM \(ThreadUnreadCounts.tableName) AS unreadCount
                 INNER JOIN \(ThreadAssociatedData.databaseTableName) AS associatedData
-                    ON associatedData.threadUniqueId = \(interactionColumn: .threadUniqueId)
+                    ON associatedData.threadUniqueId = unreadCount.\(ThreadUnreadCounts.threadUniqueIdColumn)
                 WHERE associatedData.isArchived = "0"
             """
 
@@ -191,8 +191,6 @@ public class InteractionFinder: NSObject {
                 unreadInteractionQuery += " \(sqlClauseForIgnoringInteractionsWithMutedThread(threadAssociatedDataAlias: "associatedData")) "
             }
 
-            unreadInteractionQuery += " AND \(sqlClauseForUnreadInteractionCounts(interactionsAlias: "interaction")) "
-
             let unreadInteractionCount = try UInt.fetchOne(transaction.unwrapGrdbRead.database, sql: unreadInteractionQuery)
             owsAssertDebug(unreadInteractionCount != nil, "unreadInteractionCount was unexpectedly nil")
 
@@ -250,6 +248,23 @@ public class InteractionFinder: NSObject {
         return nil
     }
 
+    public class func fetchUpcomingExpirationTimestamps(limit: Int, tx: SDSAnyReadTransaction) throws -> [UInt64] {
+        // NOTE: We DO NOT consult storedShouldStartExpireTimer here;
+        //       once expiration has begun we want to see it through.
+        let sql = """
+            SELECT DISTINCT \(interactionColumn: .expiresAt)
+            FROM \(InteractionRecord.databaseTableName)
+            WHERE \(interactionColumn: .expiresAt) > 0
+            ORDER BY \(interactionColumn: .expiresAt)
+            LIMIT \(limit)
+        """
+        do {
+            return try UInt64.fetchAll(tx.unwrapGrdbRead.database, sql: sql)
+        } catch {
+            throw error.grdbErrorForLogging
+        }
+    }
+
     public class func fetchSomeExpiredMessageRowIds(now: UInt64, limit: Int, tx: SDSAnyReadTransaction) throws -> [Int64] {
         // NOTE: We DO NOT consult storedShouldStartExpireTimer here;
         //       once expiration has begun we want to see it through.
@@ -267,24 +282,29 @@ public class InteractionFinder: NSObject {
         }
     }
 
+    /// Matches the WHERE clause of the partial index
+    /// `index_interactions_on_threadUniqueId_storedShouldStartExpireTimer_and_expiresAt`
+    /// exactly, so that the lookup only visits the (usually zero) rows in that
+    /// index rather than scanning every interaction.
+    static let messageUniqueIdsWhichFailedToStartExpiringSQL = """
+        SELECT \(interactionColumn: .uniqueId)
+        FROM \(InteractionRecord.databaseTableName)
+        WHERE \(interactionColumn: .storedShouldStartExpireTimer) IS TRUE
+        AND (
+            \(interactionColumn: .expiresAt) IS 0 OR
+            \(interactionColumn: .expireStartedAt) IS 0
+        )
+    """
+
     public class func fetchAllMessageUniqueIdsWhichFailedToStartExpiring(
         transaction: SDSAnyReadTransaction
     ) -> [String] {
         // NOTE: We DO consult storedShouldStartExpireTimer here.
         //       We don't want to start expiration until it is true.
-        let sql = """
-            SELECT \(interactionColumn: .uniqueId)
-            FROM \(InteractionRecord.databaseTableName)
-            WHERE \(interactionColumn: .storedShouldStartExpireTimer) IS TRUE
-            AND (
-                \(interactionColumn: .expiresAt) IS 0 OR
-                \(interactionColumn: .expireStartedAt) IS 0
-            )
-        """
         do {
             return try String.fetchAll(
                 transaction.unwrapGrdbRead.database,
-                sql: sql
+                sql: messageUniqueIdsWhichFailedToStartExpiringSQL
             )
         } catch {
             owsFailDebug("error: \(error)")
@@ -650,23 +670,7 @@ public class InteractionFinder: NSObject {
 
     public func unreadCount(transaction: SDSAnyReadTransaction) -> UInt {
         do {
-            let sql = """
-                SELECT COUNT(*)
-                FROM \(InteractionRecord.databaseTableName)
-                WHERE \(interactionColumn: .threadUniqueId) = ?
-                AND \(InteractionFinder.sqlClauseForUnreadInteractionCounts())
-            """
-            let arguments: StatementArguments = [threadUniqueId]
-
-            guard let count = try UInt.fetchOne(
-                transaction.unwrapGrdbRead.database,
-                sql: sql,
-                arguments: arguments
-            ) else {
-                owsFailDebug("count was unexpectedly nil")
-                return 0
-            }
-            return count
+            return try ThreadUnreadCounts.unreadCount(threadUniqueId: threadUniqueId, tx: transaction)
         } catch {
             owsFailDebug("error: \(error)")
             return 0
@@ -851,52 +855,39 @@ public class InteractionFinder: NSObject {
         return try cursor.next()
     }
 
+    /// The interaction the conversation view should position itself at when
+    /// restoring `sortId`, which may no longer exist.
+    ///
+    /// Only interactions that appear in the conversation view are considered.
+    /// The lookups are served by the conversation view's covering index, so
+    /// only the chosen interaction's row is read.
     @objc
     public func firstInteraction(
         atOrAroundSortId sortId: UInt64,
         transaction: SDSAnyReadTransaction
     ) -> TSInteraction? {
-        guard sortId > 0 else { return nil }
-
-        // First, see if there's an interaction at or before this sortId.
-
-        let atOrBeforeQuery = """
-            SELECT *
-            FROM \(InteractionRecord.databaseTableName)
-            WHERE \(interactionColumn: .threadUniqueId) = ?
-            AND \(interactionColumn: .id) <= ?
-            \(Self.filterEditHistoryClause())
-            ORDER BY \(interactionColumn: .id) DESC
-            LIMIT 1
-        """
-        let arguments: StatementArguments = [threadUniqueId, sortId]
+        guard sortId > 0, let rowId = Int64(exactly: sortId) else { return nil }
 
-        if let interactionAtOrBeforeSortId = TSInteraction.grdbFetchOne(
-            sql: atOrBeforeQuery,
-            arguments: arguments,
-            transaction: transaction.unwrapGrdbRead
-        ) {
-            return interactionAtOrBeforeSortId
+        do {
+            // First, see if there's an interaction at or before this sortId. If
+            // not, look for the first interaction *after* this sortId.
+            let uniqueId = try fetchUniqueIdsForConversationView(
+                rowIdFilter: .atOrBefore(rowId),
+                limit: 1,
+                tx: transaction
+            ).first ?? fetchUniqueIdsForConversationView(
+                rowIdFilter: .after(rowId),
+                limit: 1,
+                tx: transaction
+            ).first
+            guard let uniqueId else {
+                return nil
+            }
+            return TSInteraction.anyFetch(uniqueId: uniqueId, transaction: transaction)
+        } catch {
+            owsFailDebug("Couldn't fetch interaction around sortId: \(error)")
+            return nil
         }
-
-        // If there wasn't an interaction at or before this sortId,
-        // look for the first interaction *after* this sort id.
-
-        let afterQuery = """
-            SELECT *
-            FROM \(InteractionRecord.databaseTableName)
-            WHERE \(interactionColumn: .threadUniqueId) = ?
-            AND \(interactionColumn: .id) > ?
-            \(Self.filterEditHistoryClause())
-            ORDER BY \(interactionColumn: .id) ASC
-            LIMIT 1
-        """
-
-        return TSInteraction.grdbFetchOne(
-            sql: afterQuery,
-            arguments: arguments,
-            transaction: transaction.unwrapGrdbRead
-        )
     }
 
     public func existsOutgoingMessage(transaction: SDSAnyReadTransaction) -> Bool {
@@ -994,6 +985,49 @@ public class InteractionFinder: NSObject {
         }
     }
 
+    /// Fetches every ``TSInvalidIdentityKeyReceivingErrorMessage`` in this
+    /// thread, newest first.
+    ///
+    /// These are looked up by record type so that accepting a safety number
+    /// change doesn't walk (and deserialize) the thread's entire history.
+    @objc
+    public func fetchInvalidIdentityKeyReceivingErrorMessages(
+        transaction: SDSAnyReadTransaction
+    ) throws -> [TSInvalidIdentityKeyReceivingErrorMessage] {
+        // In DEBUG builds, confirm that we use the expected index.
+        let indexedBy: String
+        #if DEBUG
+        indexedBy = "INDEXED BY index_model_TSInteraction_on_uniqueThreadId_recordType_messageType"
+        #else
+        indexedBy = ""
+        #endif
+
+        let sql = """
+            SELECT *
+            FROM \(InteractionRecord.databaseTableName)
+            \(indexedBy)
+            WHERE \(interactionColumn: .threadUniqueId) = ?
+            AND \(interactionColumn: .recordType) = \(SDSRecordType.invalidIdentityKeyReceivingErrorMessage.rawValue)
+            ORDER BY \(interactionColumn: .id) DESC
+        """
+
+        let cursor = TSInteraction.grdbFetchCursor(
+            sql: sql,
+            arguments: [threadUniqueId],
+            transaction: transaction.unwrapGrdbRead
+        )
+
+        var errorMessages = [TSInvalidIdentityKeyReceivingErrorMessage]()
+        while let interaction = try cursor.next() {
+            guard let errorMessage = interaction as? TSInvalidIdentityKeyReceivingErrorMessage else {
+                owsFailDebug("Unexpected interaction type: \(type(of: interaction))")
+                continue
+            }
+            errorMessages.append(errorMessage)
+        }
+        return errorMessages
+    }
+
     public func hasUserReportedSpam(transaction: SDSAnyReadTransaction) -> Bool {
         // In DEBUG builds, confirm that we use the expected index.
         let indexedBy: String
@@ -1312,7 +1346,8 @@ public class InteractionFinder: NSObject {
         /// view. This includes filtering out decryption placeholders, group
         /// story replies, and edit history.
         ///
-        /// Relies on `index_model_TSInteraction_UnreadMessages`.
+        /// Relies on `index_model_TSInteraction_ConversationViewKeyset`, which
+        /// covers these filters and `uniqueId`.
         case filterForConversationView
 
         /// Filter the fetched interactions to ``TSIncomingMessage``s.
@@ -1499,6 +1534,10 @@ extension InteractionFinder {
         """
     }
 
+    /// The interactions counted by `unreadCount(transaction:)`.
+    ///
+    /// Triggers maintain those counts with a copy of this filter; see
+    /// `ThreadUnreadCounts` before changing it.
     static func sqlClauseForUnreadInteractionCounts(
         interactionsAlias: String? = nil
     ) -> String {
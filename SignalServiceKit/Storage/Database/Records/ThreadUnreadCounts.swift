@@ -0,0 +1,83 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+import GRDB
+
+/// The number of unread messages in each thread.
+///
+/// Counts are kept in the `ThreadUnreadCount` table by triggers on
+/// `model_TSInteraction` (see `GRDBSchemaMigrator`'s
+/// `addThreadUnreadCountTable`), so they change in the same transaction as
+/// the interactions they count, no matter how those are written. Reading a
+/// count is a single-row lookup rather than a `COUNT` over the thread.
+///
+/// The triggers count the interactions matched by
+/// `InteractionFinder.sqlClauseForUnreadInteractionCounts`. If that clause
+/// changes, add a migration that recreates the triggers; `repair` would
+/// otherwise correct the counts once a day.
+enum ThreadUnreadCounts {
+    static let tableName = "ThreadUnreadCount"
+    static let threadUniqueIdColumn = "threadUniqueId"
+    static let unreadCountColumn = "unreadCount"
+
+    static func unreadCount(threadUniqueId: String, tx: SDSAnyReadTransaction) throws -> UInt {
+        let unreadCount = try UInt.fetchOne(
+            tx.unwrapGrdbRead.database,
+            sql: "SELECT \(unreadCountColumn) FROM \(tableName) WHERE \(threadUniqueIdColumn) = ?",
+            arguments: [threadUniqueId]
+        )
+        return unreadCount ?? 0
+    }
+
+    /// Recounts the unread messages in every thread and corrects any count
+    /// that doesn't match.
+    ///
+    /// - Returns: The number of threads whose count was corrected.
+    @discardableResult
+    static func repair(tx: SDSAnyWriteTransaction) throws -> Int {
+        let database = tx.unwrapGrdbWrite.database
+
+        var actualCounts = [String: Int]()
+        let actualCountRows = try Row.fetchCursor(database, sql: """
+            SELECT \(interactionColumn: .threadUniqueId), COUNT(*)
+            FROM \(InteractionRecord.databaseTableName)
+            WHERE \(InteractionFinder.sqlClauseForUnreadInteractionCounts())
+            GROUP BY \(interactionColumn: .threadUniqueId)
+        """)
+        while let row = try actualCountRows.next() {
+            actualCounts[row[0] as String] = row[1] as Int
+        }
+
+        var storedCounts = [String: Int]()
+        let storedCountRows = try Row.fetchCursor(database, sql: """
+            SELECT \(threadUniqueIdColumn), \(unreadCountColumn)
+            FROM \(tableName)
+            WHERE \(unreadCountColumn) != 0
+        """)
+        while let row = try storedCountRows.next() {
+            storedCounts[row[0] as String] = row[1] as Int
+        }
+
+        var repairedCount = 0
+        for threadUniqueId in Set(actualCounts.keys).union(storedCounts.keys) {
+            let actualCount = actualCounts[threadUniqueId] ?? 0
+            let storedCount = storedCounts[threadUniqueId] ?? 0
+            guard actualCount != storedCount else {
+                continue
+            }
+            Logger.warn("Correcting unread count for \(threadUniqueId): \(storedCount) -> \(actualCount)")
+            try database.execute(
+                sql: """
+                    INSERT OR REPLACE INTO \(tableName) (\(threadUniqueIdColumn), \(unreadCountColumn))
+                    VALUES (?, ?)
+                """,
+                arguments: [threadUniqueId, actualCount]
+            )
+            repairedCount += 1
+        }
+        return repairedCount
+    }
+}
@@ -11,7 +11,8 @@ NS_ASSUME_NONNULL_BEGIN
 // database writes by other processes.
 //
 // * notifyChanged should be called after every write
-//   transaction completes.
+//   transaction completes. Calls that arrive before the
+//   main queue posts the pending notification share it.
 // * callback is invoked when a write from another process
 //   is detected.
 @interface SDSCrossProcess : NSObject
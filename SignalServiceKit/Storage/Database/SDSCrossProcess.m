@@ -27,6 +27,9 @@ static pid_t localPid(void)
 
 @property (nonatomic) int notifyToken;
 
+// Guarded by @synchronized(self).
+@property (nonatomic) BOOL hasScheduledNotify;
+
 @end
 
 #pragma mark -
@@ -84,7 +87,21 @@ static pid_t localPid(void)
 
 - (void)notifyChangedAsync
 {
-    dispatch_async(dispatch_get_main_queue(), ^{ [self notifyChanged]; });
+    // Writes tend to come in bursts, and every post wakes every other process
+    // that's listening. Collapse the writes that finish before the main queue
+    // gets to the post into one; it's posted after all of them have committed.
+    @synchronized(self) {
+        if (self.hasScheduledNotify) {
+            return;
+        }
+        self.hasScheduledNotify = YES;
+    }
+    dispatch_async(dispatch_get_main_queue(), ^{
+        @synchronized(self) {
+            self.hasScheduledNotify = NO;
+        }
+        [self notifyChanged];
+    });
 }
 
 - (void)notifyChanged
@@ -0,0 +1,98 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+import GRDB
+
+/// Runs small async writes that arrive close together in one transaction.
+///
+/// The first write to arrive starts a short window; every write enqueued
+/// before it closes (up to `maxBatchSize`) shares a single commit. Each
+/// write runs in its own savepoint, so one that throws has its changes
+/// rolled back without affecting the others. Only changes to the database
+/// are rolled back; anything else a failed write did with its transaction,
+/// such as adding a finalization block, still happens.
+///
+/// This class is thread-safe.
+final class CoalescedWriteQueue {
+
+    typealias WriteBlock = (SDSAnyWriteTransaction) throws -> Void
+
+    private struct PendingWrite {
+        let block: WriteBlock
+        let completion: ((Result<Void, Error>) -> Void)?
+    }
+
+    private let window: TimeInterval
+    private let maxBatchSize: Int
+    private let queue: DispatchQueue
+    private let write: (_ block: (SDSAnyWriteTransaction) -> Void) -> Void
+
+    private let pendingWrites = AtomicValue<[PendingWrite]>([], lock: UnfairLock())
+
+    /// - Parameter queue: The queue on which batches are written.
+    /// - Parameter write: Opens a write transaction and runs the block in it.
+    init(
+        window: TimeInterval = 0.05,
+        maxBatchSize: Int = 64,
+        queue: DispatchQueue,
+        write: @escaping (_ block: (SDSAnyWriteTransaction) -> Void) -> Void
+    ) {
+        self.window = window
+        self.maxBatchSize = maxBatchSize
+        self.queue = queue
+        self.write = write
+    }
+
+    /// - Parameter completion: Called on the main queue once the batch
+    /// containing this write has been committed, with the error the block
+    /// threw, if any.
+    func enqueue(block: @escaping WriteBlock, completion: ((Result<Void, Error>) -> Void)?) {
+        let pendingCount = pendingWrites.update { pendingWrites -> Int in
+            pendingWrites.append(PendingWrite(block: block, completion: completion))
+            return pendingWrites.count
+        }
+        if pendingCount == maxBatchSize {
+            queue.async { self.flush() }
+        } else if pendingCount == 1 {
+            queue.asyncAfter(deadline: .now() + window) { self.flush() }
+        }
+    }
+
+    private func flush() {
+        let writes = pendingWrites.update { pendingWrites in
+            defer { pendingWrites = [] }
+            return pendingWrites
+        }
+        // A full batch may have already flushed the writes this was
+        // scheduled for.
+        guard !writes.isEmpty else {
+            return
+        }
+
+        var results = [Result<Void, Error>]()
+        results.reserveCapacity(writes.count)
+        write { tx in
+            let database = tx.unwrapGrdbWrite.database
+            for pendingWrite in writes {
+                results.append(Result {
+                    try database.inSavepoint {
+                        try pendingWrite.block(tx)
+                        return .commit
+                    }
+                })
+            }
+        }
+
+        DispatchQueue.main.async {
+            for (pendingWrite, result) in zip(writes, results) {
+                if case .failure(let error) = result {
+                    Logger.warn("Coalesced write failed: \(error.grdbErrorForLogging)")
+                }
+                pendingWrite.completion?(result)
+            }
+        }
+    }
+}
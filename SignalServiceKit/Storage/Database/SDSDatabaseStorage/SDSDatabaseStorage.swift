@@ -13,10 +13,20 @@ public class SDSDatabaseStorage: NSObject {
 
     private let asyncWriteQueue = DispatchQueue(label: "org.signal.database.write-async", qos: .userInitiated)
 
+    private lazy var coalescedWriteQueue = CoalescedWriteQueue(queue: asyncWriteQueue) { [unowned self] block in
+        self.write(block: block)
+    }
+
     private var hasPendingCrossProcessWrite = false
+    /// The changes from the cross process writes that arrived while we were
+    /// inactive, or nil if we don't know what they changed.
+    private var pendingCrossProcessChanges: CrossProcessDatabaseChanges?
 
     private let crossProcess = SDSCrossProcess()
 
+    private lazy var crossProcessChangeJournal = CrossProcessChangeJournal(fileUrl: CrossProcessChangeJournal.defaultFileUrl)
+    private var lastCrossProcessChangeSequenceNumber: UInt64?
+
     // MARK: - Initialization / Setup
 
     public let databaseFileUrl: URL
@@ -34,6 +44,9 @@ public class SDSDatabaseStorage: NSObject {
 
         super.init()
 
+        // Values cached for a previous database (e.g. in tests) are stale.
+        SDSKeyValueStore.evacuateValueCaches()
+
         addObservers()
     }
 
@@ -42,6 +55,10 @@ public class SDSDatabaseStorage: NSObject {
             return
         }
         // Cross process writes
+        if CurrentAppContext().isMainApp {
+            // We only care about changes made after we launched.
+            lastCrossProcessChangeSequenceNumber = crossProcessChangeJournal.lastSequenceNumber()
+        }
         crossProcess.callback = { [weak self] in
             DispatchQueue.main.async {
                 self?.handleCrossProcessWrite()
@@ -243,19 +260,59 @@ public class SDSDatabaseStorage: NSObject {
             return
         }
 
+        let changes = readCrossProcessChanges()
+        if let changes, changes.tableChanges.isEmpty {
+            // The other process didn't change anything we observe.
+            return
+        }
+
         // Post these notifications always, sync.
-        NotificationCenter.default.post(name: SDSDatabaseStorage.didReceiveCrossProcessNotificationAlwaysSync, object: nil, userInfo: nil)
+        NotificationCenter.default.post(
+            name: SDSDatabaseStorage.didReceiveCrossProcessNotificationAlwaysSync,
+            object: nil,
+            userInfo: Self.userInfo(forCrossProcessChanges: changes)
+        )
 
         // Post these notifications async and defer if inactive.
         if CurrentAppContext().isMainAppAndActive {
             // If already active, update immediately.
-            postCrossProcessNotificationActiveAsync()
+            postCrossProcessNotificationActiveAsync(changes: changes)
         } else {
             // If not active, set flag to update when we become active.
+            if hasPendingCrossProcessWrite {
+                if let pendingChanges = pendingCrossProcessChanges, let changes {
+                    pendingCrossProcessChanges = pendingChanges.merging(changes)
+                } else {
+                    pendingCrossProcessChanges = nil
+                }
+            } else {
+                pendingCrossProcessChanges = changes
+            }
             hasPendingCrossProcessWrite = true
         }
     }
 
+    /// Returns the changes made by other processes since we last checked, or
+    /// nil if we don't know what they changed.
+    private func readCrossProcessChanges() -> CrossProcessDatabaseChanges? {
+        AssertIsOnMainThread()
+
+        guard let lastSequenceNumber = lastCrossProcessChangeSequenceNumber else {
+            lastCrossProcessChangeSequenceNumber = crossProcessChangeJournal.lastSequenceNumber()
+            return nil
+        }
+        let (changes, newLastSequenceNumber) = crossProcessChangeJournal.changes(after: lastSequenceNumber)
+        lastCrossProcessChangeSequenceNumber = newLastSequenceNumber
+        return changes
+    }
+
+    private static func userInfo(forCrossProcessChanges changes: CrossProcessDatabaseChanges?) -> [AnyHashable: Any]? {
+        guard let changes else {
+            return nil
+        }
+        return [crossProcessChangesKey: changes]
+    }
+
     @objc
     func didBecomeActive() {
         AssertIsOnMainThread()
@@ -264,8 +321,10 @@ public class SDSDatabaseStorage: NSObject {
             return
         }
         hasPendingCrossProcessWrite = false
+        let changes = pendingCrossProcessChanges
+        pendingCrossProcessChanges = nil
 
-        postCrossProcessNotificationActiveAsync()
+        postCrossProcessNotificationActiveAsync(changes: changes)
     }
 
     @objc
@@ -273,20 +332,26 @@ public class SDSDatabaseStorage: NSObject {
     @objc
     public static let didReceiveCrossProcessNotificationAlwaysSync = Notification.Name("didReceiveCrossProcessNotificationAlwaysSync")
 
-    private func postCrossProcessNotificationActiveAsync() {
-        Logger.info("")
+    /// The cross process notifications include a `CrossProcessDatabaseChanges`
+    /// under this key if we know which tables & rows the other process changed.
+    public static let crossProcessChangesKey = "crossProcessChanges"
+
+    private func postCrossProcessNotificationActiveAsync(changes: CrossProcessDatabaseChanges?) {
+        Logger.info("tables: \(changes.map { $0.tableNames.sorted().description } ?? "unknown")")
 
-        // TODO: The observers of this notification will inevitably do
-        //       expensive work.  It'd be nice to only fire this event
-        //       if this had any effect, if the state of the database
-        //       has changed.
+        // The observers of this notification will inevitably do expensive
+        // work. When we know what the other process changed, they can limit
+        // that work to what actually changed.
         //
-        //       In the meantime, most (all?) cross process write notifications
-        //       will be delivered to the main app while it is inactive. By
-        //       de-bouncing notifications while inactive and only updating
-        //       once when we become active, we should be able to effectively
-        //       skip most of the perf cost.
-        NotificationCenter.default.postNotificationNameAsync(SDSDatabaseStorage.didReceiveCrossProcessNotificationActiveAsync, object: nil)
+        // In addition, most (all?) cross process write notifications will be
+        // delivered to the main app while it is inactive. By de-bouncing
+        // notifications while inactive and only updating once when we become
+        // active, we should be able to effectively skip most of the perf cost.
+        NotificationCenter.default.postNotificationNameAsync(
+            SDSDatabaseStorage.didReceiveCrossProcessNotificationActiveAsync,
+            object: nil,
+            userInfo: Self.userInfo(forCrossProcessChanges: changes)
+        )
     }
 
     // MARK: - Reading & Writing
@@ -503,6 +568,24 @@ public class SDSDatabaseStorage: NSObject {
         }
     }
 
+    /// Like `asyncWrite`, but the block may share its transaction with other
+    /// coalesced writes enqueued within a few milliseconds of it.
+    ///
+    /// Use this for small, independent writes that happen in bursts (e.g.
+    /// receipts or flags), where a commit per write is most of the cost. If
+    /// the block throws, its changes to the database are rolled back and the
+    /// other writes in the transaction are unaffected. See
+    /// `CoalescedWriteQueue`.
+    ///
+    /// - Parameter completion: Called on the main queue after the transaction
+    /// commits, with the error the block threw, if any.
+    public func coalescedAsyncWrite(
+        block: @escaping (SDSAnyWriteTransaction) throws -> Void,
+        completion: ((Result<Void, Error>) -> Void)? = nil
+    ) {
+        coalescedWriteQueue.enqueue(block: block, completion: completion)
+    }
+
     // MARK: - Awaitable
 
     public func awaitableWrite<T>(
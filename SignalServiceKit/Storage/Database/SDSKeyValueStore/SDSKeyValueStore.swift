@@ -40,6 +40,66 @@ public class SDSKeyValueStore: NSObject {
         super.init()
     }
 
+    /// - Parameter cachesValues: Whether to keep an in-memory copy of values
+    /// read from or written to `collection` so that repeated reads of the
+    /// same keys don't hit the database. Use this for small collections that
+    /// are read far more often than they're written, such as preferences.
+    /// Once any store for a collection opts in, every store for that
+    /// collection shares its cache.
+    public convenience init(collection: String, cachesValues: Bool) {
+        self.init(collection: collection)
+        if cachesValues {
+            Self.valueCaches.update { valueCaches in
+                if valueCaches[collection] == nil {
+                    valueCaches[collection] = TransactionalReadCache(tableName: Self.tableName, maxSize: Self.maxCachedValueCount)
+                }
+            }
+        }
+    }
+
+    // MARK: Value Caching
+
+    /// A value of a cached collection, as last read from or written to the
+    /// database.
+    private struct CachedValue {
+        /// Nil if the key doesn't exist.
+        let encoded: Data?
+        /// The unarchived value, if it's immutable and has been unarchived.
+        let decoded: Any?
+    }
+
+    private static let maxCachedValueCount = 256
+
+    /// The caches for collections whose stores opted in, keyed by collection.
+    ///
+    /// Values are looked up by collection (rather than held by each store) so
+    /// that writes through any store invalidate the cache. Writes to the
+    /// table with raw SQL bypass the cache and must not target a cached
+    /// collection.
+    private static let valueCaches = AtomicValue<[String: TransactionalReadCache<String, CachedValue>]>([:], lock: UnfairLock())
+
+    private var valueCache: TransactionalReadCache<String, CachedValue>? {
+        return Self.valueCaches.get()[collection]
+    }
+
+    static func evacuateValueCaches() {
+        for valueCache in valueCaches.get().values {
+            valueCache.evacuate()
+        }
+    }
+
+    /// Only values that can't be mutated by the caller are cached decoded.
+    private static func canCacheDecodedValue(_ value: Any) -> Bool {
+        switch value {
+        case is NSMutableString:
+            return false
+        case is NSNumber, is NSString, is NSDate:
+            return true
+        default:
+            return false
+        }
+    }
+
     @objc
     public class func logCollectionStatistics() {
         Logger.info("SDSKeyValueStore statistics:")
@@ -73,6 +133,9 @@ public class SDSKeyValueStore: NSObject {
 
     @objc
     public func hasValue(forKey key: String, transaction: SDSAnyReadTransaction) -> Bool {
+        if let cachedValue = valueCache?.cachedValue(for: key, readTx: transaction) {
+            return cachedValue.encoded != nil
+        }
         switch transaction.readTransaction {
         case .grdbRead(let grdbTransaction):
             do {
@@ -358,6 +421,7 @@ public class SDSKeyValueStore: NSObject {
 
     @objc
     public func removeAll(transaction: SDSAnyWriteTransaction) {
+        valueCache?.willRemoveAll(writeTx: transaction)
         switch transaction.writeTransaction {
         case .grdbWrite(let grdbWrite):
             let sql = """
@@ -614,10 +678,18 @@ public class SDSKeyValueStore: NSObject {
         // GRDB values are serialized to data by this class.
         switch transaction.readTransaction {
         case .grdbRead:
+            let valueCache = self.valueCache
+            if let cachedValue = valueCache?.cachedValue(for: key, readTx: transaction), let decoded = cachedValue.decoded {
+                return decoded
+            }
             guard let encoded = readData(key, transaction: transaction) else {
                 return nil
             }
-            return parseArchivedValue(encoded)
+            let rawObject = parseArchivedValue(encoded)
+            if let valueCache, let rawObject, Self.canCacheDecodedValue(rawObject) {
+                valueCache.didRead(CachedValue(encoded: encoded, decoded: rawObject), for: key, readTx: transaction)
+            }
+            return rawObject
         }
     }
 
@@ -647,10 +719,16 @@ public class SDSKeyValueStore: NSObject {
 
     private func readData(_ key: String, transaction: SDSAnyReadTransaction) -> Data? {
         let collection = self.collection
+        let valueCache = self.valueCache
+        if let cachedValue = valueCache?.cachedValue(for: key, readTx: transaction) {
+            return cachedValue.encoded
+        }
 
         switch transaction.readTransaction {
         case .grdbRead(let grdbTransaction):
-            return SDSKeyValueStore.readData(transaction: grdbTransaction, key: key, collection: collection)
+            let encoded = SDSKeyValueStore.readData(transaction: grdbTransaction, key: key, collection: collection)
+            valueCache?.didRead(CachedValue(encoded: encoded, decoded: nil), for: key, readTx: transaction)
+            return encoded
         }
     }
 
@@ -687,6 +765,10 @@ public class SDSKeyValueStore: NSObject {
 
         let collection = self.collection
 
+        // The write might be rolled back (e.g. by a failed savepoint), so the
+        // new value is read back from the database rather than cached here.
+        valueCache?.willWrite(nil, for: key, writeTx: transaction)
+
         switch transaction.writeTransaction {
         case .grdbWrite(let grdbTransaction):
             do {
@@ -35,20 +35,30 @@ public extension SDSRecord {
     // doesn't match the database contents.
     func sdsSave(saveMode: SDSSaveMode,
                  transaction: GRDBWriteTransaction) {
-        // GRDB TODO: the record has an id property, but we can't use it here
-        //            until we modify the upsert logic.
-        //            grdbIdByUniqueId() verifies that the model hasn't been
-        //            deleted from the db.
-        if let grdbId: Int64 = grdbIdByUniqueId(transaction: transaction) {
-            if saveMode == .insert {
+        switch saveMode {
+        case .insert:
+            // Almost every insert is of a new record, so rather than looking
+            // for an existing row first, insert and let the UNIQUE constraint
+            // on uniqueId catch the rest. That's one statement per insert
+            // instead of two.
+            if !sdsInsertIfNew(transaction: transaction) {
                 owsFailDebug("Could not insert existing record.")
+                guard let grdbId = grdbIdByUniqueId(transaction: transaction) else {
+                    owsFail("Insert failed, but no record exists.")
+                }
+                sdsUpdate(grdbId: grdbId, transaction: transaction)
             }
-            sdsUpdate(grdbId: grdbId, transaction: transaction)
-        } else {
-            if saveMode == .update {
+        case .update:
+            // GRDB TODO: the record has an id property, but we can't use it here
+            //            until we modify the upsert logic.
+            //            grdbIdByUniqueId() verifies that the model hasn't been
+            //            deleted from the db.
+            if let grdbId: Int64 = grdbIdByUniqueId(transaction: transaction) {
+                sdsUpdate(grdbId: grdbId, transaction: transaction)
+            } else {
                 owsFailDebug("Could not update missing record.")
+                sdsInsert(transaction: transaction)
             }
-            sdsInsert(transaction: transaction)
         }
     }
 
@@ -66,6 +76,24 @@ public extension SDSRecord {
         }
     }
 
+    /// - Returns: false if a record with the same uniqueId already exists.
+    private func sdsInsertIfNew(transaction: GRDBWriteTransaction) -> Bool {
+        do {
+            try self.insert(transaction.database)
+            return true
+        } catch let error as DatabaseError where error.extendedResultCode == .SQLITE_CONSTRAINT_UNIQUE {
+            // The failed statement is rolled back on its own; the transaction
+            // carries on.
+            return false
+        } catch {
+            DatabaseCorruptionState.flagDatabaseCorruptionIfNecessary(
+                userDefaults: CurrentAppContext().appUserDefaults(),
+                error: error
+            )
+            owsFail("Insert failed: \(error.grdbErrorForLogging)")
+        }
+    }
+
     private func sdsInsert(transaction: GRDBWriteTransaction) {
         do {
             try self.insert(transaction.database)
@@ -119,7 +147,9 @@ extension BaseModel {
         do {
             let tableName = tableMetadata.tableName
             let sql = "SELECT id FROM \(tableName.quotedDatabaseIdentifier) WHERE \(uniqueIdColumnName.quotedDatabaseIdentifier)=?"
-            guard let value = try Int64.fetchOne(transaction.database, sql: sql, arguments: [uniqueIdColumnValue]) else {
+            // This runs before every save, so reuse the prepared statement.
+            let statement = try transaction.database.cachedStatement(sql: sql)
+            guard let value = try Int64.fetchOne(statement, arguments: [uniqueIdColumnValue]) else {
                 return nil
             }
             return value
@@ -133,6 +133,23 @@ public class GRDBWriteTransaction: GRDBReadTransaction {
         }
         removedFinalizationKeys.insert(key)
     }
+
+    /// State that finalization blocks can accumulate over the course of the
+    /// transaction (e.g. merging N updates to the same entity into one).
+    private var transactionScopedObjects = [String: AnyObject]()
+
+    fileprivate func transactionScopedObject(forKey key: String, orInsert createObject: () -> AnyObject) -> AnyObject {
+        if let existingObject = transactionScopedObjects[key] {
+            return existingObject
+        }
+        let newObject = createObject()
+        transactionScopedObjects[key] = newObject
+        return newObject
+    }
+
+    fileprivate func removeTransactionScopedObject(forKey key: String) -> AnyObject? {
+        return transactionScopedObjects.removeValue(forKey: key)
+    }
 }
 
 // MARK: -
@@ -233,6 +250,27 @@ public class SDSAnyWriteTransaction: SDSAnyReadTransaction, StoreContext {
             grdbWrite.addRemovedFinalizationKey(key)
         }
     }
+
+    /// Returns an object that lives until it is removed or the transaction is
+    /// deallocated, creating it if necessary. Typically used alongside
+    /// `addTransactionFinalizationBlock` to accumulate state that's applied
+    /// once when the transaction is finalized.
+    @objc
+    public func transactionScopedObject(forKey key: String, orInsert createObject: () -> AnyObject) -> AnyObject {
+        switch writeTransaction {
+        case .grdbWrite(let grdbWrite):
+            return grdbWrite.transactionScopedObject(forKey: key, orInsert: createObject)
+        }
+    }
+
+    @objc
+    @discardableResult
+    public func removeTransactionScopedObject(forKey key: String) -> AnyObject? {
+        switch writeTransaction {
+        case .grdbWrite(let grdbWrite):
+            return grdbWrite.removeTransactionScopedObject(forKey: key)
+        }
+    }
 }
 
 // MARK: -
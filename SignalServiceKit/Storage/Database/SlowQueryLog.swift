@@ -0,0 +1,134 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+import GRDB
+
+/// Keeps track of the slowest SQL statements run in this process, so that
+/// they can be written to the debug logs along with their query plans.
+///
+/// Every connection reports each statement's duration through GRDB's
+/// profiling trace. Statements faster than `slowThreshold` are ignored
+/// without taking a lock; the rest are grouped by their SQL (before any
+/// arguments are bound), and only the `maxEntryCount` slowest are kept.
+///
+/// This class is thread-safe.
+public final class SlowQueryLog {
+
+    public static let shared = SlowQueryLog()
+
+    struct Entry {
+        let sql: String
+        var count: Int
+        var totalDuration: TimeInterval
+        var maxDuration: TimeInterval
+    }
+
+    private enum Constants {
+        /// SQL is truncated to this length so a statement with a long literal
+        /// list can't crowd out the rest of the report.
+        static let maxSqlLength = 1000
+    }
+
+    private let slowThreshold: TimeInterval
+    private let maxEntryCount: Int
+    private let entries = AtomicValue<[String: Entry]>([:], lock: UnfairLock())
+
+    init(slowThreshold: TimeInterval = 0.02, maxEntryCount: Int = 20) {
+        self.slowThreshold = slowThreshold
+        self.maxEntryCount = maxEntryCount
+    }
+
+    /// Starts timing the statements run on `db`. Call this when each
+    /// connection is prepared.
+    func install(in db: Database) {
+        db.trace(options: .profile) { [weak self] event in
+            guard case let .profile(statement, duration) = event else {
+                return
+            }
+            self?.record(sql: statement.sql, duration: duration)
+        }
+    }
+
+    func record(sql: String, duration: TimeInterval) {
+        guard duration >= slowThreshold else {
+            return
+        }
+        entries.update { entries in
+            if entries[sql] != nil {
+                entries[sql]!.count += 1
+                entries[sql]!.totalDuration += duration
+                entries[sql]!.maxDuration = max(entries[sql]!.maxDuration, duration)
+                return
+            }
+            if entries.count >= maxEntryCount {
+                guard
+                    let fastest = entries.values.min(by: { $0.maxDuration < $1.maxDuration }),
+                    fastest.maxDuration < duration
+                else {
+                    return
+                }
+                entries[fastest.sql] = nil
+            }
+            entries[sql] = Entry(sql: sql, count: 1, totalDuration: duration, maxDuration: duration)
+        }
+    }
+
+    /// The recorded statements, slowest first.
+    var slowestStatements: [Entry] {
+        return entries.get().values.sorted { $0.maxDuration > $1.maxDuration }
+    }
+
+    /// Describes each recorded statement, slowest first, with its query plan.
+    func reportLines(db: Database) -> [String] {
+        var lines = [String]()
+        for (index, entry) in slowestStatements.enumerated() {
+            let averageMs = entry.totalDuration * 1000 / Double(entry.count)
+            lines.append(String(
+                format: "#%d: max %.1fms, avg %.1fms, count %d: %@",
+                index + 1,
+                entry.maxDuration * 1000,
+                averageMs,
+                entry.count,
+                String(entry.sql.prefix(Constants.maxSqlLength))
+            ))
+            for planLine in Self.queryPlan(sql: entry.sql, db: db) {
+                lines.append("    \(planLine)")
+            }
+        }
+        return lines
+    }
+
+    private static func queryPlan(sql: String, db: Database) -> [String] {
+        let keyword = sql.drop(while: { $0.isWhitespace }).prefix(6).uppercased()
+        guard ["SELECT", "WITH", "UPDATE", "DELETE", "INSERT"].contains(where: { keyword.hasPrefix($0) }) else {
+            return []
+        }
+        do {
+            let statement = try db.makeSelectStatement(sql: "EXPLAIN QUERY PLAN \(sql)")
+            // The plan doesn't depend on the values, so leave every argument
+            // NULL.
+            statement.setUncheckedArguments(StatementArguments())
+            return try Row.fetchAll(statement).map { row in
+                let detail: String = row["detail"] ?? ""
+                return detail
+            }
+        } catch {
+            return ["(no query plan: \(error.grdbErrorForLogging))"]
+        }
+    }
+
+    /// Writes the slowest statements and their query plans to the log.
+    public func logReport(databaseStorage: SDSDatabaseStorage) {
+        let lines = databaseStorage.read { tx in
+            reportLines(db: tx.unwrapGrdbRead.database)
+        }
+        guard !lines.isEmpty else {
+            Logger.info("No statements slower than \(Int(slowThreshold * 1000))ms.")
+            return
+        }
+        Logger.info("Slowest statements:\n\(lines.joined(separator: "\n"))")
+    }
+}
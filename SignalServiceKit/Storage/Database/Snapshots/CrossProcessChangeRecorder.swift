@@ -0,0 +1,61 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+import GRDB
+
+/// Records the tables & rows changed by each write transaction in the
+/// `CrossProcessChangeJournal` so that other processes can do targeted
+/// invalidation when they're notified of our writes.
+///
+/// Only the main app consumes the journal, so this is only installed in the
+/// app extensions.
+final class CrossProcessChangeRecorder: TransactionObserver {
+    private let journal: CrossProcessChangeJournal
+
+    // GRDB serializes writes and calls us on the writer, so these don't need
+    // any additional synchronization.
+    private var pendingRowIds = [String: Set<Int64>]()
+    private var pendingDeletionTableNames = Set<String>()
+
+    init(journal: CrossProcessChangeJournal) {
+        self.journal = journal
+    }
+
+    func observes(eventsOfKind eventKind: DatabaseEventKind) -> Bool {
+        DatabaseChangeObserver.observes(eventWithTableName: eventKind.tableName)
+    }
+
+    func databaseDidChange(with event: DatabaseEvent) {
+        switch event.kind {
+        case .insert, .update:
+            pendingRowIds[event.tableName, default: []].insert(event.rowID)
+        case .delete:
+            pendingDeletionTableNames.insert(event.tableName)
+        }
+    }
+
+    func databaseDidCommit(_ db: Database) {
+        var tableChanges = [String: CrossProcessTableChanges]()
+        for tableName in Set(pendingRowIds.keys).union(pendingDeletionTableNames) {
+            tableChanges[tableName] = CrossProcessTableChanges(
+                rowIds: pendingRowIds[tableName] ?? [],
+                hasDeletions: pendingDeletionTableNames.contains(tableName)
+            )
+        }
+        reset()
+        // This happens before SDSCrossProcess posts its notification.
+        journal.append(tableChanges: tableChanges)
+    }
+
+    func databaseDidRollback(_ db: Database) {
+        reset()
+    }
+
+    private func reset() {
+        pendingRowIds = [:]
+        pendingDeletionTableNames = []
+    }
+}
@@ -40,7 +40,7 @@ func AssertHasDatabaseChangeObserverLock() {
 public class DatabaseChangeObserver: NSObject {
     public static let kMaxIncrementalRowChanges = 200
 
-    private lazy var nonModelTables: Set<String> = Set([
+    private static let nonModelTables: Set<String> = Set([
         MediaGalleryRecord.databaseTableName,
         PendingReadReceiptRecord.databaseTableName
     ])
@@ -242,27 +242,97 @@ public class DatabaseChangeObserver: NSObject {
         }
     }()
 
+    // These properties should only be accessed on the main thread.
+    private var hasPendingCrossProcessChanges = false
+    /// The changes from cross process writes that we haven't published yet,
+    /// or nil if we don't know what (some of) those writes changed.
+    private var pendingCrossProcessChanges: CrossProcessDatabaseChanges?
+
     @objc
     func didReceiveCrossProcessNotification(_ notification: Notification) {
         AssertIsOnMainThread()
 
+        let changes = notification.userInfo?[SDSDatabaseStorage.crossProcessChangesKey] as? CrossProcessDatabaseChanges
+        if hasPendingCrossProcessChanges {
+            if let pendingChanges = pendingCrossProcessChanges, let changes {
+                pendingCrossProcessChanges = pendingChanges.merging(changes)
+            } else {
+                pendingCrossProcessChanges = nil
+            }
+        } else {
+            pendingCrossProcessChanges = changes
+        }
+        hasPendingCrossProcessChanges = true
+
         didUpdateExternallyEvent.requestNotify()
     }
 
     private func fireDidUpdateExternally() {
         AssertIsOnMainThread()
 
+        guard hasPendingCrossProcessChanges else {
+            return
+        }
+        let changes = pendingCrossProcessChanges
+        hasPendingCrossProcessChanges = false
+        pendingCrossProcessChanges = nil
+
+        if let changes, publishCrossProcessChanges(changes) {
+            return
+        }
+
         for delegate in databaseChangeDelegates {
             delegate.databaseChangesDidUpdateExternally()
         }
     }
+
+    /// Publishes changes made by another process the same way we publish our
+    /// own, so that delegates only need to update what changed.
+    ///
+    /// - Returns: false if the changes can't be expressed incrementally (e.g.
+    /// because models were deleted and we can't tell which), in which case
+    /// delegates must reload everything.
+    private func publishCrossProcessChanges(_ changes: CrossProcessDatabaseChanges) -> Bool {
+        AssertIsOnMainThread()
+
+        let limit = Self.kMaxIncrementalRowChanges
+        guard
+            let interactionRowIds = changes.updatedRowIds(tableName: InteractionRecord.databaseTableName, limit: limit),
+            let threadRowIds = changes.updatedRowIds(tableName: ThreadRecord.databaseTableName, limit: limit),
+            let storyMessageRowIds = changes.updatedRowIds(tableName: StoryMessage.databaseTableName, limit: limit)
+        else {
+            return false
+        }
+
+        let crossProcessChanges = ObservedDatabaseChanges(concurrencyMode: .databaseChangeObserverSerialQueue)
+        databaseStorage.read { tx in
+            Self.serializedSync {
+                crossProcessChanges.formUnion(tableNames: changes.tableNames.filter { Self.observes(eventWithTableName: $0) })
+                crossProcessChanges.formUnion(interactionRowIds: interactionRowIds)
+                for threadRowId in threadRowIds {
+                    crossProcessChanges.insert(threadRowId: threadRowId)
+                }
+                crossProcessChanges.formUnion(storyMessageRowIds: storyMessageRowIds)
+
+                crossProcessChanges.finalizePublishedStateAndCopyToCommittedChanges(
+                    committedChanges,
+                    withLock: Self.committedChangesLock,
+                    db: tx.unwrapGrdbRead.database
+                )
+            }
+        }
+
+        ensureDisplayLink()
+        publishUpdatesIfNecessary()
+        return true
+    }
 }
 
 // MARK: -
 
 extension DatabaseChangeObserver: TransactionObserver {
 
-    private func observes(eventWithTableName tableName: String) -> Bool {
+    static func observes(eventWithTableName tableName: String) -> Bool {
         if tableName.hasPrefix(FullTextSearchIndexer.contentTableName) {
             return false
         }
@@ -280,11 +350,11 @@ extension DatabaseChangeObserver: TransactionObserver {
     }
 
     public func observes(eventsOfKind eventKind: DatabaseEventKind) -> Bool {
-        observes(eventWithTableName: eventKind.tableName)
+        Self.observes(eventWithTableName: eventKind.tableName)
     }
 
     private func observes(event: DatabaseEvent) -> Bool {
-        observes(eventWithTableName: event.tableName)
+        Self.observes(eventWithTableName: event.tableName)
     }
 
     // This should only be called by DatabaseStorage.
@@ -385,7 +455,7 @@ extension DatabaseChangeObserver: TransactionObserver {
             pendingChanges.insert(tableName: event.tableName)
 
             if event.tableName == InteractionRecord.databaseTableName {
-                pendingChanges.insert(interactionRowId: event.rowID)
+                pendingChanges.insert(interactionRowId: event.rowID, eventKind: event.kind)
             } else if event.tableName == ThreadRecord.databaseTableName {
                 pendingChanges.insert(threadRowId: event.rowID)
             } else if event.tableName == StoryMessage.databaseTableName {
@@ -26,9 +26,37 @@ public protocol DatabaseChanges {
 
     var didUpdateThreads: Bool { get }
 
+    /// The interactions that changed in each changed thread, keyed by thread
+    /// unique id; a thread that changed without any of its interactions
+    /// changing has an empty entry. Nil if some interaction changes couldn't
+    /// be attributed to a thread, in which case callers should fall back to
+    /// `interactionUniqueIds` and `interactionDeletedUniqueIds`.
+    var interactionChangesByThreadUniqueId: [UniqueId: ThreadInteractionChanges]? { get }
+
     func didUpdate(tableName: String) -> Bool
 
     func didUpdate(interaction: TSInteraction) -> Bool
 
     func didUpdate(thread: TSThread) -> Bool
 }
+
+// MARK: -
+
+/// The changes to a single thread's interactions.
+public struct ThreadInteractionChanges {
+    public typealias UniqueId = String
+
+    public internal(set) var insertedInteractionUniqueIds = Set<UniqueId>()
+    public internal(set) var updatedInteractionUniqueIds = Set<UniqueId>()
+    public internal(set) var deletedInteractionUniqueIds = Set<UniqueId>()
+
+    /// Whether only the thread itself changed (e.g. its last message preview
+    /// or unread count) and none of its interactions did.
+    public var isSummaryOnly: Bool {
+        return (
+            insertedInteractionUniqueIds.isEmpty
+            && updatedInteractionUniqueIds.isEmpty
+            && deletedInteractionUniqueIds.isEmpty
+        )
+    }
+}
@@ -17,6 +17,7 @@ public struct DatabaseChangesSnapshot: DatabaseChanges {
     public let tableNames: Set<String>
     public let didUpdateInteractions: Bool
     public let didUpdateThreads: Bool
+    public let interactionChangesByThreadUniqueId: [UniqueId: ThreadInteractionChanges]?
 
     public let lastError: Error?
 
@@ -31,6 +32,7 @@ public struct DatabaseChangesSnapshot: DatabaseChanges {
         tableNames: Set<String>,
         didUpdateInteractions: Bool,
         didUpdateThreads: Bool,
+        interactionChangesByThreadUniqueId: [UniqueId: ThreadInteractionChanges]?,
         lastError: Error?
     ) {
         self.threadUniqueIds = threadUniqueIds
@@ -43,6 +45,7 @@ public struct DatabaseChangesSnapshot: DatabaseChanges {
         self.tableNames = tableNames
         self.didUpdateInteractions = didUpdateInteractions
         self.didUpdateThreads = didUpdateThreads
+        self.interactionChangesByThreadUniqueId = interactionChangesByThreadUniqueId
         self.lastError = lastError
     }
 
@@ -105,6 +105,7 @@ class ObservedDatabaseChanges: NSObject {
         #endif
 
         interactions.insert(model: interaction, state: .default)
+        interactionThreadUniqueIds[interaction.uniqueId] = interaction.uniqueThreadId
     }
 
     func insert(interactionUniqueId: UniqueId) {
@@ -139,6 +140,15 @@ class ObservedDatabaseChanges: NSObject {
         interactions.insert(rowId: interactionRowId)
     }
 
+    func insert(interactionRowId: RowId, eventKind: DatabaseEvent.Kind) {
+        #if TESTABLE_BUILD
+        checkConcurrency()
+        #endif
+
+        interactions.insert(rowId: interactionRowId)
+        interactionChangeKinds.insert(interactionRowId, InteractionChangeKind(eventKind))
+    }
+
     func formUnion(interactionRowIds: Set<RowId>) {
         #if TESTABLE_BUILD
         checkConcurrency()
@@ -155,6 +165,16 @@ class ObservedDatabaseChanges: NSObject {
         interactions.insert(deletedRowId: deletedInteractionRowId)
     }
 
+    // MARK: - Interactions by Thread
+
+    /// How interactions changed, for those whose changes we observed
+    /// directly. Other changed interactions are treated as updated.
+    private var interactionChangeKinds = MergingDict<RowId, InteractionChangeKind>()
+
+    /// The thread of each changed interaction whose thread is known, keyed
+    /// by interaction unique id.
+    private var interactionThreadUniqueIds = [UniqueId: UniqueId]()
+
     // MARK: - Stories
 
     private var storyMessages = ObservedModelChanges()
@@ -275,6 +295,37 @@ fileprivate extension Bool {
     }
 }
 
+/// How an interaction changed. When an interaction changes more than once,
+/// a delete wins over everything, and an insert followed by updates is
+/// still an insert.
+private enum InteractionChangeKind: Mergeable {
+    case insert
+    case update
+    case delete
+
+    init(_ eventKind: DatabaseEvent.Kind) {
+        switch eventKind {
+        case .insert:
+            self = .insert
+        case .update:
+            self = .update
+        case .delete:
+            self = .delete
+        }
+    }
+
+    func merge(_ other: Self) -> Self {
+        switch (self, other) {
+        case (.delete, _), (_, .delete):
+            return .delete
+        case (.insert, _), (_, .insert):
+            return .insert
+        case (.update, .update):
+            return .update
+        }
+    }
+}
+
 /// Track state related to a single model update, for example
 /// whether this model change should trigger chat list UI to update.
 private struct ObservedModelState: Mergeable {
@@ -405,6 +456,7 @@ extension ObservedDatabaseChanges {
         let tableNames: Set<String> = _tableNames
         let didUpdateInteractions: Bool = tableNames.contains(TSInteraction.table.tableName)
         let didUpdateThreads: Bool = tableNames.contains(TSThread.table.tableName)
+        let interactionChangesByThreadUniqueId = buildInteractionChangesByThreadUniqueId()
         let lastError = _lastError
 
         return DatabaseChangesSnapshot(
@@ -418,10 +470,56 @@ extension ObservedDatabaseChanges {
             tableNames: tableNames,
             didUpdateInteractions: didUpdateInteractions,
             didUpdateThreads: didUpdateThreads,
+            interactionChangesByThreadUniqueId: interactionChangesByThreadUniqueId,
             lastError: lastError
         )
     }
 
+    /// Groups the interaction changes by thread, or returns nil if any of
+    /// them can't be attributed to a thread (e.g. rows deleted with raw SQL).
+    private func buildInteractionChangesByThreadUniqueId() -> [UniqueId: ThreadInteractionChanges]? {
+        var changeKinds = MergingDict<UniqueId, InteractionChangeKind>()
+        for rowId in interactions.rowIds {
+            guard let uniqueId = interactions.rowIdToUniqueIdMap[rowId] else {
+                return nil
+            }
+            changeKinds.insert(uniqueId, interactionChangeKinds[rowId] ?? .update)
+        }
+        for rowId in interactions.deletedRowIds {
+            guard let uniqueId = interactions.rowIdToUniqueIdMap[rowId] else {
+                return nil
+            }
+            changeKinds.insert(uniqueId, .delete)
+        }
+        for uniqueId in interactions.uniqueIds.keys {
+            changeKinds.insert(uniqueId, .update)
+        }
+        for uniqueId in interactions.deletedUniqueIds.keys {
+            changeKinds.insert(uniqueId, .delete)
+        }
+
+        var result = [UniqueId: ThreadInteractionChanges]()
+        for uniqueId in changeKinds.keys {
+            guard let threadUniqueId = interactionThreadUniqueIds[uniqueId] else {
+                return nil
+            }
+            switch changeKinds[uniqueId]! {
+            case .insert:
+                result[threadUniqueId, default: ThreadInteractionChanges()].insertedInteractionUniqueIds.insert(uniqueId)
+            case .update:
+                result[threadUniqueId, default: ThreadInteractionChanges()].updatedInteractionUniqueIds.insert(uniqueId)
+            case .delete:
+                result[threadUniqueId, default: ThreadInteractionChanges()].deletedInteractionUniqueIds.insert(uniqueId)
+            }
+        }
+        // Threads that changed without any of their interactions changing
+        // only need their summaries updated.
+        for threadUniqueId in threads.uniqueIds.keys where result[threadUniqueId] == nil {
+            result[threadUniqueId] = ThreadInteractionChanges()
+        }
+        return result
+    }
+
     /// Finalizes the current set of changes, mapping any row Ids to uniqueIds by doing database lookups.
     /// Then copies over final changes to a "committed" set of changes, using the provided lock to
     /// guard updates.
@@ -445,12 +543,16 @@ extension ObservedDatabaseChanges {
         let threads = self.threads
         let storyMessages = self.storyMessages
         let tableNames = self._tableNames
+        let interactionChangeKinds = self.interactionChangeKinds
+        let interactionThreadUniqueIds = self.interactionThreadUniqueIds
 
         lock.withLock {
             committedChanges.interactions.merge(interactions)
             committedChanges.threads.merge(threads)
             committedChanges.storyMessages.merge(storyMessages)
             committedChanges.formUnion(tableNames: tableNames)
+            committedChanges.interactionChangeKinds.formUnion(interactionChangeKinds)
+            committedChanges.interactionThreadUniqueIds.merge(interactionThreadUniqueIds) { _, new in new }
         }
     }
 
@@ -469,6 +571,11 @@ extension ObservedDatabaseChanges {
             )
         )
 
+        // Look up the interactions we don't have models for (e.g. those
+        // changed with raw SQL) so that their changes can be grouped by
+        // thread. This also resolves their unique ids for the step below.
+        try resolveInteractionRowIds(db: db)
+
         // We need to convert all interaction "row ids" to "unique ids".
         interactions.formUnion(
             uniqueIds: try mapRowIdsToUniqueIds(
@@ -494,6 +601,33 @@ extension ObservedDatabaseChanges {
         )
     }
 
+    private func resolveInteractionRowIds(db: Database) throws {
+        AssertHasDatabaseChangeObserverLock()
+
+        let unresolvedRowIds = interactions.rowIds.filter { interactions.rowIdToUniqueIdMap[$0] == nil }
+        guard !unresolvedRowIds.isEmpty else {
+            return
+        }
+        guard unresolvedRowIds.count < DatabaseChangeObserver.kMaxIncrementalRowChanges else {
+            throw DatabaseObserverError.changeTooLarge
+        }
+
+        let commaSeparatedRowIds = unresolvedRowIds.map { String($0) }.joined(separator: ", ")
+        let sql = """
+        SELECT rowid, \(interactionColumn: .uniqueId), \(interactionColumn: .threadUniqueId)
+        FROM \(InteractionRecord.databaseTableName)
+        WHERE rowid IN (\(commaSeparatedRowIds))
+        """
+        let cursor = try Row.fetchCursor(db, sql: sql)
+        while let row = try cursor.next() {
+            let rowId: RowId = row[0]
+            let uniqueId: UniqueId = row[1]
+            let threadUniqueId: UniqueId = row[2]
+            interactions.rowIdToUniqueIdMap[rowId] = uniqueId
+            interactionThreadUniqueIds[uniqueId] = threadUniqueId
+        }
+    }
+
     private func mapRowIdsToUniqueIds(
         db: Database,
         rowIds: Set<RowId>,
@@ -0,0 +1,146 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// A cache of values read from the database that stays consistent with
+/// transactions.
+///
+/// Like `ModelReadCache`, values are only cached in the main app, a key isn't
+/// served from the cache while a write to it is in flight, and values read by
+/// transactions that started before the latest write are discarded. Writes by
+/// other processes to `tableName` evacuate the cache.
+///
+/// Callers look up values with `cachedValue`, fall back to the database and
+/// report what they read with `didRead`, and call `willWrite` or
+/// `willRemoveAll` from every write transaction that changes the values.
+///
+/// This class is thread-safe.
+final class TransactionalReadCache<Key: Hashable, Value> {
+
+    private struct State {
+        var pendingWriteCounts = [Key: Int]()
+        var pendingRemoveAllCount = 0
+        var lastWriteDate = Date.distantPast
+    }
+
+    private let tableName: String
+    private let isEnabled: Bool
+    private let entries: LRUCache<Key, Value>
+    private let state = AtomicValue(State(), lock: UnfairLock())
+    private var crossProcessObserver: NSObjectProtocol?
+
+    init(tableName: String, maxSize: Int) {
+        self.tableName = tableName
+        self.isEnabled = CurrentAppContext().isMainApp
+        self.entries = LRUCache(maxSize: maxSize)
+        guard isEnabled else {
+            return
+        }
+        // This is a generic class, so it can't use selector-based observation.
+        crossProcessObserver = NotificationCenter.default.addObserver(
+            forName: SDSDatabaseStorage.didReceiveCrossProcessNotificationAlwaysSync,
+            object: nil,
+            queue: nil
+        ) { [weak self] notification in
+            self?.didReceiveCrossProcessNotification(notification)
+        }
+    }
+
+    deinit {
+        if let crossProcessObserver {
+            NotificationCenter.default.removeObserver(crossProcessObserver)
+        }
+    }
+
+    private func didReceiveCrossProcessNotification(_ notification: Notification) {
+        let changes = notification.userInfo?[SDSDatabaseStorage.crossProcessChangesKey] as? CrossProcessDatabaseChanges
+        if let changes, !changes.didUpdate(tableName: tableName) {
+            return
+        }
+        evacuate()
+    }
+
+    /// Discards every cached value, including any read by transactions
+    /// that are still open.
+    func evacuate() {
+        state.update {
+            $0.lastWriteDate = Date()
+            entries.clear()
+        }
+    }
+
+    private static func canUseCache(for key: Key, state: State, readTx: SDSAnyReadTransaction) -> Bool {
+        return (
+            state.pendingWriteCounts[key] == nil
+            && state.pendingRemoveAllCount == 0
+            && state.lastWriteDate < readTx.startDate
+        )
+    }
+
+    func cachedValue(for key: Key, readTx: SDSAnyReadTransaction) -> Value? {
+        guard isEnabled else {
+            return nil
+        }
+        return state.update { state -> Value? in
+            guard Self.canUseCache(for: key, state: state, readTx: readTx) else {
+                return nil
+            }
+            return entries.get(key: key)
+        }
+    }
+
+    func didRead(_ value: Value, for key: Key, readTx: SDSAnyReadTransaction) {
+        guard isEnabled else {
+            return
+        }
+        state.update { state in
+            guard Self.canUseCache(for: key, state: state, readTx: readTx) else {
+                return
+            }
+            entries.set(key: key, value: value)
+        }
+    }
+
+    /// - Parameter newValue: The value to cache once the transaction commits,
+    /// or nil to leave the key uncached until it's next read.
+    func willWrite(_ newValue: Value?, for key: Key, writeTx: SDSAnyWriteTransaction) {
+        guard isEnabled else {
+            return
+        }
+        state.update {
+            $0.pendingWriteCounts[key, default: 0] += 1
+            entries.remove(key: key)
+        }
+        writeTx.addSyncCompletion {
+            self.state.update { state in
+                let pendingWriteCount = (state.pendingWriteCounts[key] ?? 1) - 1
+                state.pendingWriteCounts[key] = pendingWriteCount > 0 ? pendingWriteCount : nil
+                state.lastWriteDate = Date()
+                self.entries.remove(key: key)
+                if let newValue, pendingWriteCount == 0, state.pendingRemoveAllCount == 0 {
+                    self.entries.set(key: key, value: newValue)
+                }
+            }
+        }
+    }
+
+    func willRemoveAll(writeTx: SDSAnyWriteTransaction) {
+        guard isEnabled else {
+            return
+        }
+        state.update {
+            $0.pendingRemoveAllCount += 1
+            entries.clear()
+        }
+        writeTx.addSyncCompletion {
+            self.state.update { state in
+                state.pendingRemoveAllCount -= 1
+                state.lastWriteDate = Date()
+                self.entries.clear()
+            }
+        }
+    }
+}
@@ -78,6 +78,20 @@ public enum FullTextSearchIndexer {
     // We want to match by prefix for "search as you type" functionality.
     // SQLite does not support suffix or contains matches.
     public static func buildQuery(for searchText: String) -> String {
+        return queryTerms(for: searchText).map {
+            // Allow partial match of each term.
+            //
+            // Note that we use double-quotes to enclose each search term.
+            // Quoted search terms can include a few more characters than
+            // "bareword" (non-quoted) search terms.  This shouldn't matter,
+            // since we're filtering all of the affected characters, but
+            // quoting protects us from any bugs in that logic.
+            "\"\($0)\"*"
+        }.joined(separator: " ")
+    }
+
+    /// The terms that `buildQuery(for:)` prefix-matches.
+    private static func queryTerms(for searchText: String) -> [Substring] {
         // 1. Normalize the search text.
         //
         // TODO: We could arguably convert to lowercase since the search
@@ -107,24 +121,8 @@ public enum FullTextSearchIndexer {
         //        and the order won't affect the search results.
         queryTerms = Array(Set(queryTerms)).sorted()
 
-        // 5. Filter the query terms.
-        let filteredQueryTerms = queryTerms.filter {
-            // Ignore empty terms.
-            $0.count > 0
-        }.map {
-            // Allow partial match of each term.
-            //
-            // Note that we use double-quotes to enclose each search term.
-            // Quoted search terms can include a few more characters than
-            // "bareword" (non-quoted) search terms.  This shouldn't matter,
-            // since we're filtering all of the affected characters, but
-            // quoting protects us from any bugs in that logic.
-            "\"\($0)\"*"
-        }
-
-        // 6. Join terms into query string.
-        let query = filteredQueryTerms.joined(separator: " ")
-        return query
+        // 5. Ignore empty terms.
+        return queryTerms.filter { $0.count > 0 }
     }
 }
 
@@ -160,6 +158,9 @@ extension FullTextSearchIndexer {
         return normalizeText(bodyText)
     }
 
+    /// Indexes `message` immediately. Most callers should use `enqueue(_:tx:)`
+    /// instead, which keeps this work out of the write that's changing the
+    /// message.
     public static func insert(_ message: TSMessage, tx: SDSAnyWriteTransaction) {
         guard let ftsContent = indexableContent(for: message, tx: tx) else {
             return
@@ -177,8 +178,7 @@ extension FullTextSearchIndexer {
     }
 
     public static func update(_ message: TSMessage, tx: SDSAnyWriteTransaction) {
-        delete(message, tx: tx)
-        insert(message, tx: tx)
+        enqueue(message, tx: tx)
     }
 
     public static func delete(_ message: TSMessage, tx: SDSAnyWriteTransaction) {
@@ -191,6 +191,143 @@ extension FullTextSearchIndexer {
             arguments: [message.uniqueId, legacyCollectionName],
             tx: tx
         )
+        if let rowId = message.sqliteRowId {
+            executeUpdate(
+                sql: "DELETE FROM \(pendingTableName) WHERE \(pendingRowIdColumn) = ?",
+                arguments: [rowId],
+                tx: tx
+            )
+        }
+    }
+
+    // MARK: - Deferred Indexing
+
+    // Updating the FTS index is a noticeable part of inserting a message, and
+    // message processing inserts them one at a time. Instead, inserted and
+    // updated messages are queued in the same write, which is cheap, and
+    // FullTextSearchIndexingQueue indexes them in large batches afterwards.
+    // Search also checks the queue, so results stay complete in the meantime.
+
+    static let pendingTableName = "PendingFullTextSearchIndex"
+    static let pendingRowIdColumn = "interactionRowId"
+
+    /// Queues `message` to be (re)indexed. Any stale index entry is removed
+    /// right away.
+    public static func enqueue(_ message: TSMessage, tx: SDSAnyWriteTransaction) {
+        guard let rowId = message.sqliteRowId else {
+            owsFailDebug("Can't queue a message that hasn't been inserted.")
+            return
+        }
+        delete(message, tx: tx)
+        executeUpdate(
+            sql: "INSERT INTO \(pendingTableName) (\(pendingRowIdColumn)) VALUES (?)",
+            arguments: [rowId],
+            tx: tx
+        )
+        tx.addSyncCompletion {
+            FullTextSearchIndexingQueue.shared.scheduleDrain()
+        }
+    }
+
+    /// Indexes up to `limit` queued messages, oldest first.
+    ///
+    /// - Returns: How many were dequeued. If it's less than `limit`, the
+    /// queue is empty.
+    public static func indexPendingMessages(limit: Int, tx: SDSAnyWriteTransaction) throws -> Int {
+        let database = tx.unwrapGrdbWrite.database
+        let rowIds = try Int64.fetchAll(
+            database,
+            sql: "SELECT \(pendingRowIdColumn) FROM \(pendingTableName) ORDER BY \(pendingRowIdColumn) LIMIT ?",
+            arguments: [limit]
+        )
+        guard let maxRowId = rowIds.last else {
+            return 0
+        }
+        for rowId in rowIds {
+            guard let message = InteractionFinder.fetch(rowId: rowId, transaction: tx) as? TSMessage else {
+                continue
+            }
+            insert(message, tx: tx)
+        }
+        try database.execute(
+            sql: "DELETE FROM \(pendingTableName) WHERE \(pendingRowIdColumn) <= ?",
+            arguments: [maxRowId]
+        )
+        return rowIds.count
+    }
+
+    /// If a lot of messages are queued (e.g. right after a restore), search
+    /// only checks the newest.
+    private static let maxPendingMessagesToSearch = 2000
+
+    /// Searches queued messages, which aren't in the FTS index yet.
+    ///
+    /// This approximates the FTS query (every term must prefix a token,
+    /// ignoring case and diacritics) and snippet, which is fine for the
+    /// handful of messages that are usually queued.
+    private static func searchPendingMessages(
+        queryTerms: [Substring],
+        threadUniqueId: String? = nil,
+        maxResults: Int,
+        tx: SDSAnyReadTransaction,
+        block: (_ message: TSMessage, _ snippet: String, _ stop: inout Bool) -> Void
+    ) throws {
+        let rowIds = try Int64.fetchAll(
+            tx.unwrapGrdbRead.database,
+            sql: "SELECT \(pendingRowIdColumn) FROM \(pendingTableName) ORDER BY \(pendingRowIdColumn) DESC LIMIT ?",
+            arguments: [maxPendingMessagesToSearch]
+        )
+        var resultCount = 0
+        for rowId in rowIds {
+            guard resultCount < maxResults else {
+                return
+            }
+            guard
+                let message = InteractionFinder.fetch(rowId: rowId, transaction: tx) as? TSMessage,
+                threadUniqueId == nil || message.uniqueThreadId == threadUniqueId,
+                let content = indexableContent(for: message, tx: tx),
+                let snippet = pendingSnippet(content: content, queryTerms: queryTerms)
+            else {
+                continue
+            }
+            resultCount += 1
+            var stop = false
+            block(message, snippet, &stop)
+            if stop {
+                return
+            }
+        }
+    }
+
+    /// Returns nil unless every term prefixes a token of `content`.
+    private static func pendingSnippet(content: String, queryTerms: [Substring]) -> String? {
+        let tokens = content.split(separator: " ")
+        let options: String.CompareOptions = [.anchored, .caseInsensitive, .diacriticInsensitive]
+        let matchingIndices = tokens.indices.filter { index in
+            queryTerms.contains { tokens[index].range(of: $0, options: options) != nil }
+        }
+        let allTermsMatch = queryTerms.allSatisfy { term in
+            matchingIndices.contains { tokens[$0].range(of: term, options: options) != nil }
+        }
+        guard allTermsMatch, let firstMatchingIndex = matchingIndices.first else {
+            return nil
+        }
+
+        // Match the FTS snippet's length (15 tokens).
+        let snippetLength = 15
+        let startIndex = max(0, min(firstMatchingIndex - 2, tokens.count - snippetLength))
+        let endIndex = min(tokens.count, startIndex + snippetLength)
+        let matchingIndexSet = Set(matchingIndices)
+        var snippet = (startIndex..<endIndex).map { index in
+            matchingIndexSet.contains(index) ? "<\(matchTag)>\(tokens[index])</\(matchTag)>" : String(tokens[index])
+        }.joined(separator: " ")
+        if startIndex > 0 {
+            snippet = "…" + snippet
+        }
+        if endIndex < tokens.count {
+            snippet += "…"
+        }
+        return snippet
     }
 
     private static func executeUpdate(
@@ -212,6 +349,7 @@ extension FullTextSearchIndexer {
         tx: SDSAnyReadTransaction,
         block: (_ message: TSMessage, _ snippet: String, _ stop: inout Bool) -> Void
     ) {
+        let terms = queryTerms(for: searchText)
         let query = buildQuery(for: searchText)
 
         if query.isEmpty {
@@ -240,6 +378,7 @@ extension FullTextSearchIndexer {
             LIMIT \(maxResults)
             """
 
+            var resultCount = 0
             let cursor = try Row.fetchCursor(tx.unwrapGrdbRead.database, sql: sql, arguments: [query])
             while let row = try cursor.next() {
                 let collection: String = row[collectionColumn]
@@ -256,14 +395,102 @@ extension FullTextSearchIndexer {
                     owsFailDebug("Couldn't find message that exists in the FTS table")
                     continue
                 }
+                resultCount += 1
                 var stop = false
                 block(message, snippet, &stop)
                 if stop {
-                    break
+                    return
                 }
             }
+
+            try searchPendingMessages(
+                queryTerms: terms,
+                maxResults: maxResults - resultCount,
+                tx: tx,
+                block: block
+            )
+        } catch {
+            owsFailDebug("Couldn't fetch results: \(error.grdbErrorForLogging)")
+        }
+    }
+
+    public struct ThreadMatch {
+        public let messageUniqueId: String
+        public let sortId: UInt64
+        public let snippet: String
+    }
+
+    /// Searches one thread's messages, newest first.
+    ///
+    /// Unlike `search(for:maxResults:tx:block:)`, this doesn't fetch the
+    /// matching messages: the FTS matches are joined to the thread's
+    /// interactions (on their covering uniqueId index), so each match costs a
+    /// couple of index lookups, however long the thread is.
+    public static func searchWithinThread(
+        for searchText: String,
+        threadUniqueId: String,
+        maxResults: Int,
+        tx: SDSAnyReadTransaction
+    ) -> [ThreadMatch] {
+        let terms = queryTerms(for: searchText)
+        let query = buildQuery(for: searchText)
+
+        if query.isEmpty {
+            Logger.warn("Empty query.")
+            return []
+        }
+
+        do {
+            let indexOfContentColumnInFTSTable = 0
+            // Determines the length of the snippet.
+            let numTokens: UInt = 15
+            let matchSnippet = "match_snippet"
+            let interactionTableName = InteractionRecord.databaseTableName
+            // The CROSS JOINs make SQLite start with the FTS match. Otherwise
+            // it prefers to scan the thread and run the match per message.
+            let sql: String = """
+            SELECT
+                \(interactionTableName).\(interactionColumn: .uniqueId),
+                \(interactionTableName).\(interactionColumn: .id),
+                SNIPPET(\(ftsTableName), \(indexOfContentColumnInFTSTable), '<\(matchTag)>', '</\(matchTag)>', '…', \(numTokens)) AS \(matchSnippet)
+            FROM \(ftsTableName)
+            CROSS JOIN \(contentTableName) ON \(contentTableName).rowId = \(ftsTableName).rowId
+            CROSS JOIN \(interactionTableName) ON \(interactionTableName).\(interactionColumn: .uniqueId) = \(contentTableName).\(uniqueIdColumn)
+            WHERE \(ftsTableName).\(ftsContentColumn) MATCH ?
+            AND \(contentTableName).\(collectionColumn) = ?
+            AND \(interactionTableName).\(interactionColumn: .threadUniqueId) = ?
+            ORDER BY \(interactionTableName).\(interactionColumn: .id) DESC
+            LIMIT ?
+            """
+
+            let rows = try Row.fetchAll(
+                tx.unwrapGrdbRead.database,
+                sql: sql,
+                arguments: [query, legacyCollectionName, threadUniqueId, maxResults]
+            )
+            var matches = rows.map { row in
+                ThreadMatch(
+                    messageUniqueId: row[0],
+                    sortId: UInt64(row[1] as Int64),
+                    snippet: row[matchSnippet]
+                )
+            }
+
+            try searchPendingMessages(
+                queryTerms: terms,
+                threadUniqueId: threadUniqueId,
+                maxResults: maxResults,
+                tx: tx
+            ) { message, snippet, _ in
+                matches.append(ThreadMatch(messageUniqueId: message.uniqueId, sortId: message.sortId, snippet: snippet))
+            }
+
+            // Queued messages are usually the newest.
+            matches.sort { $0.sortId > $1.sortId }
+            return Array(matches.prefix(maxResults))
         } catch {
             owsFailDebug("Couldn't fetch results: \(error.grdbErrorForLogging)")
+            return []
         }
     }
 }
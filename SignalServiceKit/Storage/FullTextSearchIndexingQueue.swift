@@ -0,0 +1,66 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// Drains the messages FullTextSearchIndexer queues for indexing.
+///
+/// Drains are debounced so that a burst of incoming messages is indexed in
+/// a few large writes rather than one per message. Only the main app
+/// drains; extensions just queue messages, which the main app picks up the
+/// next time it launches or inserts a message.
+public final class FullTextSearchIndexingQueue {
+
+    public static let shared = FullTextSearchIndexingQueue()
+
+    private static let batchSize = 500
+    private static let debounceInterval: TimeInterval = 1
+
+    private let serialQueue = DispatchQueue(label: "org.signal.fts-indexing-queue", qos: .utility)
+
+    /// Only accessed on `serialQueue`.
+    private var isDrainScheduled = false
+
+    private init() {}
+
+    public func scheduleDrain() {
+        guard CurrentAppContext().isMainApp, !CurrentAppContext().isRunningTests else {
+            return
+        }
+        serialQueue.async {
+            guard !self.isDrainScheduled else {
+                return
+            }
+            self.isDrainScheduled = true
+            self.serialQueue.asyncAfter(deadline: .now() + Self.debounceInterval) {
+                self.isDrainScheduled = false
+                self.drain()
+            }
+        }
+    }
+
+    private func drain() {
+        let databaseStorage = SSKEnvironment.shared.databaseStorageRef
+        var totalCount = 0
+        while true {
+            let batchCount: Int
+            do {
+                batchCount = try databaseStorage.write { tx in
+                    try FullTextSearchIndexer.indexPendingMessages(limit: Self.batchSize, tx: tx)
+                }
+            } catch {
+                owsFailDebug("Couldn't index pending messages: \(error.grdbErrorForLogging)")
+                return
+            }
+            totalCount += batchCount
+            if batchCount < Self.batchSize {
+                break
+            }
+        }
+        if totalCount > 0 {
+            Logger.info("Indexed \(totalCount) message(s)")
+        }
+    }
+}
@@ -44,6 +44,10 @@ public class StorageServiceManagerImpl: NSObject, StorageServiceManager {
             AppReadiness.runNowOrWhenMainAppDidBecomeReadyAsync {
                 guard DependenciesBridge.shared.tsAccountManager.registrationStateWithMaybeSneakyTransaction.isRegistered else { return }
 
+                // Open a connection while the rest of launch is happening so
+                // that the first storage service request doesn't wait on one.
+                self.signalService.prewarmConnection(for: .storageService)
+
                 // Schedule a restore. This will do nothing unless we've never
                 // registered a manifest before.
                 self.restoreOrCreateManifestIfNecessary(authedDevice: .implicit)
@@ -1289,18 +1293,36 @@ class StorageServiceOperation: OWSOperation {
     }
 
     private static var itemsBatchSize: Int { CurrentAppContext().isNSE ? 256 : 1024 }
+
+    /// Merges are split across write transactions of at most this many items,
+    /// so that merging a large batch doesn't hold up other writes (e.g.
+    /// message processing) for the whole batch.
+    private static var mergeBatchSize: Int { 256 }
+
     private func fetchAndMergeItemsInBatches(
         identifiers: [StorageService.StorageIdentifier],
         manifest: StorageServiceProtoManifestRecord,
         state: State
     ) async throws -> State {
+        let identifierBatches = identifiers.chunked(by: Self.itemsBatchSize).map { Array($0) }
+        let chatServiceAuth = self.authedAccount.chatServiceAuth
+        func fetchItems(batchIndex: Int) -> Promise<[StorageService.StorageItem]>? {
+            guard let identifierBatch = identifierBatches[safe: batchIndex] else {
+                return nil
+            }
+            return StorageService.fetchItems(for: identifierBatch, chatServiceAuth: chatServiceAuth)
+        }
+
         var mutableState = state
         var deferredItems = [StorageService.StorageItem]()
-        for identifierBatch in identifiers.chunked(by: Self.itemsBatchSize) {
-            let fetchedItems = try await StorageService.fetchItems(
-                for: Array(identifierBatch),
-                chatServiceAuth: self.authedAccount.chatServiceAuth
-            ).awaitable()
+        var nextFetch = fetchItems(batchIndex: 0)
+        for (batchIndex, identifierBatch) in identifierBatches.enumerated() {
+            guard let fetch = nextFetch else {
+                break
+            }
+            let fetchedItems = try await fetch.awaitable()
+            // Fetch the next batch while we merge this one.
+            nextFetch = fetchItems(batchIndex: batchIndex + 1)
 
             // We process contacts with ACIs before those without ACIs. We do this to
             // ensure we process split operations first. If we don't, then we'll likely
@@ -1316,12 +1338,14 @@ class StorageServiceOperation: OWSOperation {
                 }
             }
 
-            await databaseStorage.awaitableWrite { tx in
-                self.mergeItems(batchItems, mutableState: &mutableState, tx: tx)
+            for mergeBatch in batchItems.chunked(by: Self.mergeBatchSize) {
+                await databaseStorage.awaitableWrite { tx in
+                    self.mergeItems(mergeBatch, mutableState: &mutableState, tx: tx)
+                }
             }
             Logger.info("\(manifest.logDescription); fetched \(identifierBatch.count) items; processed \(batchItems.count); deferred \(batchDeferredItemCount)")
         }
-        for deferredBatch in deferredItems.chunked(by: Self.itemsBatchSize) {
+        for deferredBatch in deferredItems.chunked(by: Self.mergeBatchSize) {
             await databaseStorage.awaitableWrite { tx in
                 self.mergeItems(deferredBatch, mutableState: &mutableState, tx: tx)
             }
@@ -151,6 +151,10 @@ extension OWSFakeProfileManager: ProfileManager {
         return addresses.map { fakeUserProfiles?[$0] }
     }
 
+    public func fetchReadOnlyUserProfiles(for addresses: [SignalServiceAddress], tx: SDSAnyReadTransaction) -> [OWSUserProfile?] {
+        return fetchUserProfiles(for: addresses, tx: tx)
+    }
+
     public func downloadAndDecryptLocalUserAvatarIfNeeded(authedAccount: AuthedAccount) async throws {
         throw OWSGenericError("Not supported.")
     }
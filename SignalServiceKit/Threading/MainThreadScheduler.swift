@@ -0,0 +1,202 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// Schedules blocks on the main thread by priority, collapsing repeated
+/// requests for the same work into one and measuring how long each block
+/// runs.
+///
+/// `DispatchMainThreadSafe` hands every block straight to the main queue,
+/// so when something (e.g. a progress observer) asks to "reload X" many
+/// times in quick succession, the main thread does all of that work, in
+/// order, ahead of whatever the user is waiting for.
+///
+/// Blocks run in lane order. Normal and deferrable blocks only run for a
+/// fraction of a frame per pass; whatever's left yields back to the main
+/// queue so that touches and rendering can interleave.
+@objc
+public final class MainThreadScheduler: NSObject {
+
+    @objc(MainThreadSchedulerLane)
+    public enum Lane: Int, CaseIterable, Comparable {
+        /// Work the user is waiting on, e.g. responding to a tap.
+        case userInteractive = 0
+        case normal = 1
+        /// Work that can wait until the main thread is otherwise idle.
+        case deferrable = 2
+
+        public static func < (lhs: Lane, rhs: Lane) -> Bool {
+            lhs.rawValue < rhs.rawValue
+        }
+    }
+
+    public struct ExecutionStats: Equatable {
+        public var count: Int = 0
+        public var totalDuration: TimeInterval = 0
+        public var maxDuration: TimeInterval = 0
+        /// Blocks that took longer than `hitchThreshold`.
+        public var hitchCount: Int = 0
+    }
+
+    @objc
+    public static let shared = MainThreadScheduler()
+
+    /// A block that runs longer than this drops a frame.
+    public static let hitchThreshold: TimeInterval = 1.0 / 60
+
+    /// How long normal and deferrable blocks may run per pass before yielding.
+    private static let passBudget: TimeInterval = 0.008
+
+    /// Bounds how many distinct labels we keep stats for.
+    private static let maxLabelCount = 256
+
+    private final class Item {
+        let lane: Lane
+        let label: String
+        let coalescingKey: String?
+        var block: () -> Void
+        var isSuperseded = false
+
+        init(lane: Lane, label: String, coalescingKey: String?, block: @escaping () -> Void) {
+            self.lane = lane
+            self.label = label
+            self.coalescingKey = coalescingKey
+            self.block = block
+        }
+    }
+
+    private let lock = UnfairLock()
+    /// Indexed by lane.
+    private var queuedItems: [[Item]] = Lane.allCases.map { _ in [] }
+    private var pendingItemsByKey = [String: Item]()
+    private var isPassScheduled = false
+    private var stats = [String: ExecutionStats]()
+
+    override init() {
+        super.init()
+    }
+
+    /// Runs `block` on the main thread.
+    ///
+    /// If a block with the same `coalescingKey` is still waiting to run, it's
+    /// replaced by `block` (in the higher-priority of the two lanes) rather
+    /// than both running.
+    public func schedule(
+        _ lane: Lane = .normal,
+        coalescingKey: String? = nil,
+        file: String = #fileID,
+        line: Int = #line,
+        block: @escaping () -> Void
+    ) {
+        schedule(lane: lane, coalescingKey: coalescingKey, label: coalescingKey ?? "\(file):\(line)", block: block)
+    }
+
+    @objc(scheduleOnLane:coalescingKey:label:block:)
+    public func schedule(
+        lane: Lane,
+        coalescingKey: String?,
+        label: String,
+        block: @escaping () -> Void
+    ) {
+        let shouldSchedulePass: Bool = lock.withLock {
+            if let coalescingKey, let pendingItem = pendingItemsByKey[coalescingKey] {
+                if lane >= pendingItem.lane {
+                    pendingItem.block = block
+                    return false
+                }
+                pendingItem.isSuperseded = true
+            }
+            let item = Item(lane: lane, label: label, coalescingKey: coalescingKey, block: block)
+            queuedItems[lane.rawValue].append(item)
+            if let coalescingKey {
+                pendingItemsByKey[coalescingKey] = item
+            }
+            if isPassScheduled {
+                return false
+            }
+            isPassScheduled = true
+            return true
+        }
+        if shouldSchedulePass {
+            DispatchQueue.main.async { self.runPass() }
+        }
+    }
+
+    private func nextItem(passStartTime: CFTimeInterval) -> Item? {
+        lock.withLock {
+            let isOverBudget = CACurrentMediaTime() - passStartTime >= Self.passBudget
+            for lane in Lane.allCases {
+                if lane != .userInteractive, isOverBudget {
+                    break
+                }
+                while !queuedItems[lane.rawValue].isEmpty {
+                    let item = queuedItems[lane.rawValue].removeFirst()
+                    if item.isSuperseded {
+                        continue
+                    }
+                    if let coalescingKey = item.coalescingKey, pendingItemsByKey[coalescingKey] === item {
+                        pendingItemsByKey[coalescingKey] = nil
+                    }
+                    return item
+                }
+            }
+            return nil
+        }
+    }
+
+    private func runPass() {
+        AssertIsOnMainThread()
+
+        let passStartTime = CACurrentMediaTime()
+        while let item = nextItem(passStartTime: passStartTime) {
+            let startTime = CACurrentMediaTime()
+            item.block()
+            record(label: item.label, duration: CACurrentMediaTime() - startTime)
+        }
+
+        let hasRemainingItems: Bool = lock.withLock {
+            let hasRemainingItems = queuedItems.contains { !$0.isEmpty }
+            isPassScheduled = hasRemainingItems
+            return hasRemainingItems
+        }
+        if hasRemainingItems {
+            DispatchQueue.main.async { self.runPass() }
+        }
+    }
+
+    // MARK: - Instrumentation
+
+    private func record(label: String, duration: TimeInterval) {
+        let isHitch = duration > Self.hitchThreshold
+        lock.withLock {
+            guard stats[label] != nil || stats.count < Self.maxLabelCount else {
+                return
+            }
+            stats[label, default: ExecutionStats()].count += 1
+            stats[label]!.totalDuration += duration
+            stats[label]!.maxDuration = max(stats[label]!.maxDuration, duration)
+            if isHitch {
+                stats[label]!.hitchCount += 1
+            }
+        }
+        if isHitch {
+            Logger.warn("Main thread block \(label) took \(Int(duration * 1000))ms")
+        }
+    }
+
+    /// Per-label stats for the blocks that have run so far.
+    public func executionStats() -> [String: ExecutionStats] {
+        lock.withLock { stats }
+    }
+
+    @objc
+    public func logExecutionStats() {
+        let stats = executionStats().sorted { $0.value.totalDuration > $1.value.totalDuration }
+        for (label, stat) in stats.prefix(20) {
+            Logger.info("\(label): count: \(stat.count), total: \(Int(stat.totalDuration * 1000))ms, max: \(Int(stat.maxDuration * 1000))ms, hitches: \(stat.hitchCount)")
+        }
+    }
+}
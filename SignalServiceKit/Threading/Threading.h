@@ -8,6 +8,9 @@ NS_ASSUME_NONNULL_BEGIN
 // The block is executed immediately if called from the
 // main thread; otherwise it is dispatched async to the
 // main thread.
+//
+// For work that's requested repeatedly (e.g. reloading a view) or that can
+// wait behind user-interactive work, use MainThreadScheduler instead.
 void DispatchMainThreadSafe(dispatch_block_t block);
 
 // The block is executed immediately if called from the
@@ -12,6 +12,18 @@ public class WallpaperImageStoreImpl: WallpaperImageStore {
     private let attachmentValidator: AttachmentContentValidator
     private let db: DB
 
+    /// Decoded wallpaper images, keyed by attachment id.
+    ///
+    /// The same wallpaper (usually the global one) is loaded every time a
+    /// conversation is opened. Without this, each open decrypts and decodes
+    /// it again, on the main thread, during the push transition. A new
+    /// wallpaper is a new attachment, so entries never go stale.
+    private let decodedImageCache = LRUCache<Attachment.IDType, UIImage>(
+        maxSize: 4,
+        shouldEvacuateInBackground: true,
+        maxCost: 48 * 1024 * 1024
+    )
+
     public init(
         attachmentManager: AttachmentManager,
         attachmentStore: AttachmentStore,
@@ -151,6 +163,16 @@ public class WallpaperImageStoreImpl: WallpaperImageStore {
         else {
             return nil
         }
-        return try? attachment.attachment.asStream()?.decryptedImage()
+        let attachmentId = attachment.attachment.id
+        if let image = decodedImageCache.get(key: attachmentId) {
+            return image
+        }
+        guard let image = try? attachment.attachment.asStream()?.decryptedImage() else {
+            return nil
+        }
+        let decodedImage = image.preparingForDisplay() ?? image
+        let cost = Int(decodedImage.size.width * decodedImage.scale * decodedImage.size.height * decodedImage.scale) * 4
+        decodedImageCache.set(key: attachmentId, value: decodedImage, cost: cost)
+        return decodedImage
     }
 }
@@ -325,7 +325,12 @@ public actor AttachmentUploadManagerImpl: AttachmentUploadManager {
             record: attachmentUploadRecord,
             logger: logger
         ) {
-        case .existing(let metadata), .reuse(let metadata):
+        case .existing(let metadata):
+            // Cached metadata is still good to use, and its file was
+            // re-encrypted for this upload.
+            localMetadata = metadata
+            cleanupMetadata = true
+        case .reuse(let metadata):
             // Cached metadata is still good to use
             localMetadata = metadata
         case .new(let metadata):
@@ -408,9 +413,8 @@ public actor AttachmentUploadManagerImpl: AttachmentUploadManager {
                 progress: progress
             )
 
-            // On success, cleanup the temp file.  Temp files are only created for
-            // new local metadata, otherwise the existing attachment file location is used.
-            // TODO: Tie this in with OrphanedAttachmentRecord to track this
+            // On success, cleanup the re-encrypted file.  These are only created when
+            // re-encrypting, otherwise the existing attachment file location is used.
             if cleanupMetadata {
                 do {
                     try fileSystem.deleteFile(url: localMetadata.fileUrl)
@@ -426,6 +430,9 @@ public actor AttachmentUploadManagerImpl: AttachmentUploadManager {
                 await db.awaitableWrite { tx in
                     self.cleanup(record: attachmentUploadRecord, logger: logger, tx: tx)
                 }
+                if cleanupMetadata {
+                    try? fileSystem.deleteFile(url: localMetadata.fileUrl)
+                }
                 throw error
             }
 
@@ -445,6 +452,9 @@ public actor AttachmentUploadManagerImpl: AttachmentUploadManager {
                 attachmentUploadRecord.localMetadata = nil
                 attachmentUploadRecord.uploadForm = nil
                 attachmentUploadRecord.uploadSessionUrl = nil
+                if cleanupMetadata {
+                    try? fileSystem.deleteFile(url: localMetadata.fileUrl)
+                }
 
                 try await db.awaitableWrite { tx in
                     try self.attachmentStore.upsert(record: attachmentUploadRecord, tx: tx)
@@ -545,11 +555,6 @@ public actor AttachmentUploadManagerImpl: AttachmentUploadManager {
             // that file if it still exists.
             if
                 let metadata = record.localMetadata,
-                // TODO: 
-                // Currently, the file url is in a temp directory and doesn't
-                // persist across launches, so this will never be hit. The fix for this
-                // is to store the temporary file in a more persistent location, and
-                // register the file with the OrphanedAttachmentCleaner
                 OWSFileSystem.fileOrFolderExists(url: metadata.fileUrl)
             {
                 return .existing(metadata)
@@ -677,25 +682,27 @@ public actor AttachmentUploadManagerImpl: AttachmentUploadManager {
     }
 
     func buildMetadata(forUploading attachmentStream: AttachmentStream) throws -> Upload.LocalUploadMetadata {
-        // First we need to decrypt, so we can re-encrypt for upload.
-        let tmpDecryptedFile = fileSystem.temporaryFileUrl()
         let decryptionMedatata = EncryptionMetadata(
             key: attachmentStream.attachment.encryptionKey,
             digest: attachmentStream.info.digestSHA256Ciphertext,
             length: Int(clamping: attachmentStream.info.encryptedByteCount),
             plaintextLength: Int(clamping: attachmentStream.info.unencryptedByteCount)
         )
-        try attachmentEncrypter.decryptAttachment(at: attachmentStream.fileURL, metadata: decryptionMedatata, output: tmpDecryptedFile)
 
-        // Now re-encrypt with a fresh set of keys.
-        // We use a tmp file on purpose; we already have the source file for the attachment
-        // and don't need to keep around this copy encrypted with different keys; its useful
-        // for upload only and can cleaned up by the OS after.
-        let tmpReencryptedFile = fileSystem.temporaryFileUrl()
-        let reencryptedMetadata = try attachmentEncrypter.encryptAttachment(at: tmpDecryptedFile, output: tmpReencryptedFile)
+        // Re-encrypt with a fresh set of keys, reading the plaintext straight out
+        // of the attachment file so it never touches the disk.
+        // The output goes somewhere that persists across launches so that the
+        // upload record can resume an interrupted upload of it; it's deleted
+        // once the upload finishes.
+        let reencryptedFile = fileSystem.pendingUploadFileUrl()
+        let reencryptedMetadata = try attachmentEncrypter.reencryptAttachment(
+            at: attachmentStream.fileURL,
+            metadata: decryptionMedatata,
+            output: reencryptedFile
+        )
 
         // we upload the re-encrypted file.
-        return try .validateAndBuild(fileUrl: tmpReencryptedFile, metadata: reencryptedMetadata)
+        return try .validateAndBuild(fileUrl: reencryptedFile, metadata: reencryptedMetadata)
     }
 
     private func updateProgress(id: Attachment.IDType, progress: Double) {
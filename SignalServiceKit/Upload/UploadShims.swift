@@ -22,12 +22,18 @@ extension Upload {
 public protocol _Upload_AttachmentEncrypterShim {
     func encryptAttachment(at unencryptedUrl: URL, output encryptedUrl: URL) throws -> EncryptionMetadata
 
-    func decryptAttachment(at encryptedUrl: URL, metadata: EncryptionMetadata, output: URL) throws
+    /// Re-encrypts an encrypted attachment with a fresh key, streaming the
+    /// plaintext straight from `encryptedUrl` without writing it to disk.
+    func reencryptAttachment(at encryptedUrl: URL, metadata: EncryptionMetadata, output: URL) throws -> EncryptionMetadata
 }
 
 public protocol _Upload_FileSystemShim {
     func temporaryFileUrl() -> URL
 
+    /// A location for files that an upload record refers to, which unlike
+    /// `temporaryFileUrl()` persists across launches.
+    func pendingUploadFileUrl() -> URL
+
     func deleteFile(url: URL) throws
 
     func createTempFileSlice(url: URL, start: Int) throws -> (URL, Int)
@@ -40,8 +46,21 @@ public struct _Upload_AttachmentEncrypterWrapper: Upload.Shims.AttachmentEncrypt
         try Cryptography.encryptAttachment(at: unencryptedUrl, output: encryptedUrl)
     }
 
-    public func decryptAttachment(at encryptedUrl: URL, metadata: EncryptionMetadata, output: URL) throws {
-        try Cryptography.decryptAttachment(at: encryptedUrl, metadata: metadata, output: output)
+    public func reencryptAttachment(at encryptedUrl: URL, metadata: EncryptionMetadata, output: URL) throws -> EncryptionMetadata {
+        guard let plaintextLength = metadata.plaintextLength.flatMap(UInt32.init(exactly:)) else {
+            throw OWSAssertionError("Missing plaintext length")
+        }
+        let fileHandle = try Cryptography.encryptedAttachmentFileHandle(
+            at: encryptedUrl,
+            plaintextLength: plaintextLength,
+            encryptionKey: metadata.key
+        )
+        return try Cryptography.reencryptFileHandle(
+            at: fileHandle,
+            encryptionKey: nil,
+            encryptedOutputUrl: output,
+            applyExtraPadding: true
+        )
     }
 }
 
@@ -50,6 +69,41 @@ public struct _Upload_FileSystemWrapper: Upload.Shims.FileSystem {
         return OWSFileSystem.temporaryFileUrl(isAvailableWhileDeviceLocked: true)
     }
 
+    private static var pendingUploadsDirectory: URL {
+        return OWSFileSystem.appSharedDataDirectoryURL().appendingPathComponent("PendingAttachmentUploads", isDirectory: true)
+    }
+
+    private static let didDeleteStalePendingUploads = AtomicBool(false, lock: .sharedGlobal)
+
+    public func pendingUploadFileUrl() -> URL {
+        let directory = Self.pendingUploadsDirectory
+        OWSFileSystem.ensureDirectoryExists(directory.path)
+        deleteStalePendingUploadsIfNeeded(in: directory)
+        return directory.appendingPathComponent(UUID().uuidString)
+    }
+
+    /// Upload records are thrown away when their upload fails for good, so
+    /// their files can be left behind; by the time the upload form would
+    /// have expired, no record will try to resume from one.
+    private func deleteStalePendingUploadsIfNeeded(in directory: URL) {
+        guard Self.didDeleteStalePendingUploads.tryToSetFlag() else {
+            return
+        }
+        let fileUrls = (try? FileManager.default.contentsOfDirectory(
+            at: directory,
+            includingPropertiesForKeys: [.contentModificationDateKey]
+        )) ?? []
+        for fileUrl in fileUrls {
+            guard
+                let modificationDate = try? fileUrl.resourceValues(forKeys: [.contentModificationDateKey]).contentModificationDate,
+                -modificationDate.timeIntervalSinceNow > Upload.Constants.uploadFormReuseWindow
+            else {
+                continue
+            }
+            try? OWSFileSystem.deleteFileIfExists(url: fileUrl)
+        }
+    }
+
     public func deleteFile(url: URL) throws {
         try OWSFileSystem.deleteFile(url: url)
     }
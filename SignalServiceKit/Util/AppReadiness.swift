@@ -72,8 +72,30 @@ public class AppReadiness: NSObject {
     //   can be safely delayed for a second or two after the app becomes ready.
     // * We should use the "polite" flavor of "did become ready" blocks wherever possible
     //   since they avoid a stampede of activity on launch.
+    //
+    // * We should use the "background" flavor for work that doesn't touch UIKit or other
+    //   main-thread-only state (e.g. database cleanup, file system work). Those blocks run
+    //   concurrently off the main thread, alongside the main thread blocks.
+    //
+    // * Within each flavor, blocks run in order of `BlockPriority`, then in the order they
+    //   were registered. Use `.userInterface` for work the first screen is waiting on, and
+    //   `.low` for work that can wait until everything else has run.
+
+    public enum BlockPriority {
+        case userInterface
+        case `default`
+        case low
+
+        fileprivate var readyFlagPriority: ReadyFlag.Priority {
+            switch self {
+            case .userInterface: return -1
+            case .default: return 0
+            case .low: return 1
+            }
+        }
+    }
 
-    private static let defaultPriority: ReadyFlag.Priority = 0
+    private static let defaultPriority: ReadyFlag.Priority = BlockPriority.default.readyFlagPriority
 
     public static func runNowOrWhenAppWillBecomeReady(_ block: @escaping BlockType,
                                                       file: String = #file,
@@ -116,26 +138,28 @@ public class AppReadiness: NSObject {
     // MARK: -
 
     public static func runNowOrWhenUIDidBecomeReadySync(
+        priority: BlockPriority = .default,
         _ block: @escaping BlockType,
         file: String = #file,
         function: String = #function,
         line: Int = #line
     ) {
         let label = Self.buildLabel(file: file, function: function, line: line)
-        let priority = Self.defaultPriority
+        let priority = priority.readyFlagPriority
         DispatchMainThreadSafe {
             shared.runNowOrWhenAppDidBecomeReadySync(block, flag: shared.readyFlagUI, label: label, priority: priority)
         }
     }
 
     public static func runNowOrWhenAppDidBecomeReadySync(
+        priority: BlockPriority = .default,
         _ block: @escaping BlockType,
         file: String = #file,
         function: String = #function,
         line: Int = #line
     ) {
         let label = Self.buildLabel(file: file, function: function, line: line)
-        let priority = Self.defaultPriority
+        let priority = priority.readyFlagPriority
         DispatchMainThreadSafe {
             shared.runNowOrWhenAppDidBecomeReadySync(block, flag: shared.readyFlag, label: label, priority: priority)
         }
@@ -193,18 +217,25 @@ public class AppReadiness: NSObject {
     // reduce the risk of starving the main thread, especially if
     // any given block is expensive.
 
-    public static func runNowOrWhenAppDidBecomeReadyAsync(_ block: @escaping BlockType,
+    public static func runNowOrWhenAppDidBecomeReadyAsync(priority: BlockPriority = .default,
+                                                          _ block: @escaping BlockType,
                                                           file: String = #file,
                                                           function: String = #function,
                                                           line: Int = #line) {
         let label = Self.buildLabel(file: file, function: function, line: line)
-        runNowOrWhenAppDidBecomeReadyAsync(block, label: label)
+        runNowOrWhenAppDidBecomeReadyAsync(block, label: label, priority: priority)
     }
 
     @objc
     static func runNowOrWhenAppDidBecomeReadyAsync(_ block: @escaping BlockType,
                                                    label: String) {
-        let priority = Self.defaultPriority
+        runNowOrWhenAppDidBecomeReadyAsync(block, label: label, priority: .default)
+    }
+
+    private static func runNowOrWhenAppDidBecomeReadyAsync(_ block: @escaping BlockType,
+                                                           label: String,
+                                                           priority: BlockPriority) {
+        let priority = priority.readyFlagPriority
         DispatchMainThreadSafe {
             shared.runNowOrWhenAppDidBecomeReadyAsync(block,
                                                       label: label,
@@ -212,11 +243,14 @@ public class AppReadiness: NSObject {
         }
     }
 
-    public static func runNowOrWhenMainAppDidBecomeReadyAsync(_ block: @escaping BlockType,
+    public static func runNowOrWhenMainAppDidBecomeReadyAsync(priority: BlockPriority = .default,
+                                                              _ block: @escaping BlockType,
                                                               file: String = #file,
                                                               function: String = #function,
                                                               line: Int = #line) {
-        runNowOrWhenAppDidBecomeReadyAsync({
+        runNowOrWhenAppDidBecomeReadyAsync(
+            priority: priority,
+            {
                 guard CurrentAppContext().isMainApp else { return }
                 block()
             },
@@ -249,6 +283,44 @@ public class AppReadiness: NSObject {
         readyFlag.runNowOrWhenDidBecomeReadyAsync(block, label: label, priority: priority)
     }
 
+    // MARK: -
+
+    /// Runs `block` on a background queue once the app is ready, concurrently
+    /// with other readiness blocks. `block` must not touch UIKit or any other
+    /// main-thread-only state.
+    public static func runNowOrWhenAppDidBecomeReadyInBackground(priority: BlockPriority = .default,
+                                                                _ block: @escaping BlockType,
+                                                                file: String = #file,
+                                                                function: String = #function,
+                                                                line: Int = #line) {
+        let label = Self.buildLabel(file: file, function: function, line: line)
+        let priority = priority.readyFlagPriority
+        DispatchMainThreadSafe {
+            guard !CurrentAppContext().isRunningTests else {
+                // We don't need to do any "on app ready" work in the tests.
+                return
+            }
+            shared.readyFlag.runNowOrWhenDidBecomeReadyInBackground(block, label: label, priority: priority)
+        }
+    }
+
+    public static func runNowOrWhenMainAppDidBecomeReadyInBackground(priority: BlockPriority = .default,
+                                                                    _ block: @escaping BlockType,
+                                                                    file: String = #file,
+                                                                    function: String = #function,
+                                                                    line: Int = #line) {
+        runNowOrWhenAppDidBecomeReadyInBackground(
+            priority: priority,
+            {
+                guard CurrentAppContext().isMainApp else { return }
+                block()
+            },
+            file: file,
+            function: function,
+            line: line
+        )
+    }
+
     private static func buildLabel(file: String, function: String, line: Int) -> String {
         let filename = (file as NSString).lastPathComponent
         // We format the filename & line number in a format compatible
@@ -55,6 +55,10 @@ public class AvatarBuilder: NSObject {
 
         SwiftSingletons.register(self)
 
+        MemoryProfiler.shared.registerCache(addressToAvatarIdentifierCache, named: "AvatarBuilder.addressToAvatarIdentifier")
+        MemoryProfiler.shared.registerCache(requestToContentCache, named: "AvatarBuilder.requestToContent")
+        MemoryProfiler.shared.registerCache(contentToImageCache, named: "AvatarBuilder.contentToImage")
+
         AppReadiness.runNowOrWhenAppWillBecomeReady {
             self.addObservers()
         }
@@ -654,13 +658,21 @@ public class AvatarBuilder: NSObject {
     // This cache never needs to be evacuated. The cache keys will change
     // whenever state in the content changes that would affect the image.
     private let contentToImageCache = LRUCache<String, UIImage>(maxSize: 128, nseMaxSize: 0)
-    private static let avatarCacheDirectory = URL(
-        fileURLWithPath: "Library/Caches/AvatarBuilder",
-        isDirectory: true,
-        relativeTo: URL(
-            fileURLWithPath: CurrentAppContext().appSharedDataDirectoryPath(),
-            isDirectory: true
-        )
+
+    /// Rendered avatars, shared with the extensions (the NSE never renders
+    /// avatars itself) and kept across launches. Like `contentToImageCache`,
+    /// entries never go stale: a new profile or group avatar, name or theme
+    /// changes the cache key. The least recently used are evicted.
+    private static let diskCache = LRUDiskCache(
+        directoryUrl: URL(
+            fileURLWithPath: "Library/Caches/AvatarBuilder",
+            isDirectory: true,
+            relativeTo: URL(
+                fileURLWithPath: CurrentAppContext().appSharedDataDirectoryPath(),
+                isDirectory: true
+            )
+        ),
+        maxSize: 50 * 1024 * 1024
     )
 
     private static let contactCacheKeys = SDSKeyValueStore(collection: "AvatarBuilder.contactCacheKeys")
@@ -687,11 +699,10 @@ public class AvatarBuilder: NSObject {
             }
         }
 
-        // We use the digest of the cache key for the filename, to ensure it's safe
-        // for use in the filename (it's a hexadecimal string so only 0-9a-f).
-        let cachedImageUrl = URL(fileURLWithPath: cacheKey.sha1HexadecimalDigestString + ".png", relativeTo: Self.avatarCacheDirectory)
-
-        if let image = UIImage(contentsOfFile: cachedImageUrl.path) {
+        if
+            let cachedImageUrl = Self.diskCache.cachedFileUrl(key: cacheKey, fileExtension: "png"),
+            let image = UIImage(contentsOfFile: cachedImageUrl.path)
+        {
             memoryCacheAvatarImageIfEligible(image, cacheKey: cacheKey)
             saveCacheKeyForNSE()
             return image
@@ -708,11 +719,9 @@ public class AvatarBuilder: NSObject {
         saveCacheKeyForNSE()
 
         // Always cache the avatar image to disk.
-        OWSFileSystem.ensureDirectoryExists(Self.avatarCacheDirectory.path)
-
         if let pngData = image.pngData() {
             do {
-                try pngData.write(to: cachedImageUrl)
+                _ = try Self.diskCache.store(pngData, key: cacheKey, fileExtension: "png")
             } catch {
                 owsFailDebug("Failed to cache avatar image to disk \(error)")
             }
@@ -13,8 +13,8 @@ import zlib
 /// ```
 /// var crc = CRC32()
 ///
-/// crc.update(with: Data([1, 2, 3])
-/// crc.update(with: Data([4, 5, 6])
+/// crc = crc.update(with: Data([1, 2, 3]))
+/// crc = crc.update(with: Data([4, 5, 6]))
 ///
 /// let checksum: UInt32 = crc.value
 /// ```
@@ -32,10 +32,20 @@ public struct CRC32 {
     }
 
     public func update(with data: Data) -> CRC32 {
-        let newRawValue = data.withUnsafeBytes { bytes -> CUnsignedLong in
-            let pointerForC = bytes.baseAddress?.assumingMemoryBound(to: UInt8.self)
-            return crc32(self.rawValue, pointerForC, UInt32(bytes.count))
+        return data.withUnsafeBytes { update(with: $0) }
+    }
+
+    /// Checksums bytes in place, e.g. from a memory-mapped file or a stream's
+    /// read buffer, without copying them into a `Data` first.
+    public func update(with bytes: UnsafeRawBufferPointer) -> CRC32 {
+        guard let baseAddress = bytes.baseAddress, !bytes.isEmpty else {
+            return self
         }
+        // zlib's implementation is already word-at-a-time (and uses the CRC32
+        // instructions where available), so there's nothing to gain from our
+        // own kernel. `crc32_z` takes a full-width length, so large buffers
+        // don't need to be split into 4GB pieces.
+        let newRawValue = crc32_z(self.rawValue, baseAddress.assumingMemoryBound(to: UInt8.self), bytes.count)
         return CRC32(rawValue: newRawValue)
     }
 }
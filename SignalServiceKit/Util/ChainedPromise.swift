@@ -122,6 +122,31 @@ extension ChainedPromise where Value == Void {
     ) -> Promise<T> {
         _enqueue(nextPromise, recoverValue: (), map: { _ in () })
     }
+
+    /// Enqueue a block of work to be executed when all previous enqueued work has completed,
+    /// unless `deadline` has passed by then.
+    /// Future enqueued blocks will not begin until the returned promise is resolved.
+    ///
+    /// - Parameter deadline: If this has passed when it's `nextPromise`'s turn, `nextPromise`
+    /// isn't executed and the returned promise is rejected with `WorkDeadlineExpiredError`.
+    /// - Parameter nextPromise: A closure to be executed when previous enqueued work has
+    /// completed, returning a promise whose resolution blocks future enqueued work.
+    /// - Returns a promise representing the result of the provided block, when it eventually executes.
+    public func enqueue<T>(
+        deadline: WorkDeadline,
+        _ nextPromise: @escaping () -> Promise<T>
+    ) -> Promise<T> {
+        _enqueue(
+            { () -> Promise<T> in
+                guard !deadline.isExpired else {
+                    return Promise(error: WorkDeadlineExpiredError())
+                }
+                return nextPromise()
+            },
+            recoverValue: (),
+            map: { _ in () }
+        )
+    }
 }
 
 extension ChainedPromise {
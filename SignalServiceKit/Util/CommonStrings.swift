@@ -366,6 +366,16 @@ public class NotificationStrings: NSObject {
         )
     }
 
+    /// Added to a notification that stands for several incoming messages in
+    /// the same chat.
+    static public var incomingMessagesSummaryFormat: String {
+        OWSLocalizedString(
+            "NOTIFICATION_BODY_INCOMING_MESSAGES_SUMMARY_%d",
+            tableName: "PluralAware",
+            comment: "Added to a notification for several new messages in the same chat. Embeds {{ the number of new messages }}."
+        )
+    }
+
     /// This is the fallback message used for push notifications
     /// when the NSE or main app is unable to process them. We
     /// don't use it directly in the app, but need to maintain
@@ -296,7 +296,7 @@ public class DataSourcePath: DataSource {
         lock.withLock {
             owsAssertDebug(!_isConsumed)
             if _data == nil {
-                _data = NSData(contentsOfFile: fileUrl.path) as Data?
+                _data = try? Data(contentsOf: fileUrl, options: .mappedIfSafe)
             }
             if _data == nil {
                 owsFailDebug("Could not read data from disk.")
@@ -360,6 +360,7 @@ public class DataSourcePath: DataSource {
             try FileManager.default.copyItem(at: fileUrl, to: dstUrl)
         } catch {
             owsFailDebug("Could not write data with error: \(error)")
+            throw error
         }
     }
 
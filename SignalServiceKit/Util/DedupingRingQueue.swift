@@ -0,0 +1,100 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// A FIFO queue backed by a growable ring buffer with a hash index for
+/// elements that have a "duplicate identity".
+///
+/// Enqueuing an element whose key matches an element that's already in the
+/// queue replaces that element in place (preserving its position) rather
+/// than appending. Elements without a key are never considered duplicates.
+///
+/// Enqueue, replace, peek and dequeue are all O(1) (amortized for enqueue).
+///
+/// > Important: This type is not thread-safe; callers must provide their own
+/// synchronization.
+public struct DedupingRingQueue<Key: Hashable, Element> {
+    private var storage: [Element?]
+    /// The storage index of the oldest element in the queue.
+    private var headIndex = 0
+    /// A monotonically-increasing sequence number for the element at
+    /// `headIndex`. Every element is assigned a sequence number when it's
+    /// enqueued, which lets the key index survive buffer growth.
+    private var headSequenceNumber: UInt64 = 0
+    private var keyIndex = [Key: UInt64]()
+    private var keysBySequenceNumber = [UInt64: Key]()
+
+    public private(set) var count = 0
+
+    public init(initialCapacity: Int = 16) {
+        storage = Array(repeating: nil, count: max(1, initialCapacity))
+    }
+
+    public var isEmpty: Bool { count == 0 }
+
+    /// Adds `element` to the end of the queue, or replaces an existing element
+    /// with the same `key`.
+    ///
+    /// - Returns: The replaced element, if any.
+    public mutating func enqueue(_ element: Element, key: Key?) -> Element? {
+        if let key, let sequenceNumber = keyIndex[key] {
+            let index = storageIndex(for: sequenceNumber)
+            let replacedElement = storage[index]
+            storage[index] = element
+            return replacedElement
+        }
+        if count == storage.count {
+            grow()
+        }
+        let sequenceNumber = headSequenceNumber + UInt64(count)
+        storage[storageIndex(for: sequenceNumber)] = element
+        count += 1
+        if let key {
+            keyIndex[key] = sequenceNumber
+            keysBySequenceNumber[sequenceNumber] = key
+        }
+        return nil
+    }
+
+    /// Returns up to `maxCount` elements from the front of the queue without
+    /// removing them.
+    public func prefix(_ maxCount: Int) -> [Element] {
+        let resultCount = min(maxCount, count)
+        var result = [Element]()
+        result.reserveCapacity(resultCount)
+        for offset in 0..<resultCount {
+            result.append(storage[(headIndex + offset) % storage.count]!)
+        }
+        return result
+    }
+
+    /// Removes up to `n` elements from the front of the queue.
+    public mutating func removeFirst(_ n: Int) {
+        owsAssertDebug(n <= count)
+        for _ in 0..<min(n, count) {
+            storage[headIndex] = nil
+            if let key = keysBySequenceNumber.removeValue(forKey: headSequenceNumber) {
+                keyIndex.removeValue(forKey: key)
+            }
+            headIndex = (headIndex + 1) % storage.count
+            headSequenceNumber += 1
+            count -= 1
+        }
+    }
+
+    private func storageIndex(for sequenceNumber: UInt64) -> Int {
+        return (headIndex + Int(sequenceNumber - headSequenceNumber)) % storage.count
+    }
+
+    private mutating func grow() {
+        var newStorage = [Element?](repeating: nil, count: storage.count * 2)
+        for offset in 0..<count {
+            newStorage[offset] = storage[(headIndex + offset) % storage.count]
+        }
+        storage = newStorage
+        headIndex = 0
+    }
+}
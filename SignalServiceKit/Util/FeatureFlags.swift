@@ -135,6 +135,11 @@ public enum DebugFlags {
     // * Places we make requests using tasks.
     public static let logCurlOnSuccess = false
 
+    /// Records how long labeled `UnfairLock`s are waited for and held, and
+    /// periodically logs the worst offenders. Adds a little overhead to
+    /// every lock and unlock of those locks.
+    public static let lockContentionLogging = false
+
     public static let verboseNotificationLogging = build.includes(.internal)
 
     public static let deviceTransferVerboseProgressLogging = build.includes(.internal)
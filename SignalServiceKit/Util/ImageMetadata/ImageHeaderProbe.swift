@@ -0,0 +1,405 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// What can be learned about an image from its header alone.
+///
+/// Image metadata is computed for every image we send, receive, or display,
+/// so for PNG, JPEG, GIF and WebP we parse the structures that precede the
+/// image data ourselves: a few reads from the start of the file, never the
+/// whole file, and nothing is decoded. Other formats (HEIC, HEIF, TIFF, BMP)
+/// aren't probed; ImageIO's properties for those also only read the header.
+internal struct ImageHeaderProbe {
+    let imageFormat: ImageFormat
+    /// Adjusted for the EXIF orientation, if there is one.
+    let pixelSize: CGSize
+    /// The number of bits per color sample.
+    let bitDepth: Int
+    /// `false` for color models we can't render, like CMYK.
+    let hasSupportedColorModel: Bool
+    let hasAlpha: Bool
+    /// `nil` if it can't be determined from the header; GIFs don't record
+    /// their frame count anywhere, so every frame would have to be walked.
+    let frameCount: Int?
+
+    enum ProbeError: Error {
+        case endedUnexpectedly
+        case invalidHeader
+    }
+
+    /// - Returns: `nil` if `imageFormat` isn't one that's probed.
+    /// - Throws: `ProbeError` if the header is invalid, or
+    ///   `PngChunker.PngChunkerError` if a PNG's chunks are.
+    static func probe(_ source: OWSImageSource, imageFormat: ImageFormat) throws -> ImageHeaderProbe? {
+        let reader = Reader(source: source)
+        switch imageFormat {
+        case .png:
+            return try probePng(source)
+        case .jpeg:
+            return try probeJpeg(reader)
+        case .gif:
+            return try probeGif(reader)
+        case .webp:
+            return try probeWebp(reader)
+        case .unknown, .tiff, .bmp, .heic, .heif:
+            return nil
+        }
+    }
+
+    // MARK: - PNG
+
+    /// See: https://www.w3.org/TR/png-3/
+    private static func probePng(_ source: OWSImageSource) throws -> ImageHeaderProbe {
+        let chunker = try PngChunker(source: source)
+
+        guard
+            let ihdr = try chunker.next(),
+            ihdr.type == Data("IHDR".utf8),
+            ihdr.data.count == 13
+        else {
+            throw ProbeError.invalidHeader
+        }
+        let ihdrBytes = [UInt8](ihdr.data)
+        let width = bigEndianInteger(ihdrBytes[0..<4])
+        let height = bigEndianInteger(ihdrBytes[4..<8])
+        let bitDepth = Int(ihdrBytes[8])
+        let colorType = ihdrBytes[9]
+
+        // 0: grayscale, 2: truecolor, 3: indexed, 4: grayscale with alpha,
+        // 6: truecolor with alpha.
+        guard [0, 2, 3, 4, 6].contains(colorType) else {
+            throw ProbeError.invalidHeader
+        }
+        var hasAlpha = colorType == 4 || colorType == 6
+        var frameCount = 1
+        var orientation: CGImagePropertyOrientation?
+
+        // acTL (which makes it an APNG), tRNS and eXIf must come before the
+        // image data, so there's no need to look any further.
+        while true {
+            guard let chunk = try chunker.next() else {
+                throw ProbeError.endedUnexpectedly
+            }
+            switch String(decoding: chunk.type, as: UTF8.self) {
+            case "IDAT":
+                return ImageHeaderProbe(
+                    imageFormat: .png,
+                    pixelSize: orientedSize(width: width, height: height, orientation: orientation),
+                    bitDepth: bitDepth,
+                    hasSupportedColorModel: true,
+                    hasAlpha: hasAlpha,
+                    frameCount: frameCount
+                )
+            case "acTL":
+                guard chunk.data.count == 8 else {
+                    throw ProbeError.invalidHeader
+                }
+                frameCount = bigEndianInteger([UInt8](chunk.data)[0..<4])
+            case "tRNS":
+                hasAlpha = true
+            case "eXIf":
+                orientation = exifOrientation(tiff: [UInt8](chunk.data)[...])
+            default:
+                break
+            }
+        }
+    }
+
+    // MARK: - JPEG
+
+    /// See: https://www.w3.org/Graphics/JPEG/itu-t81.pdf (Annex B)
+    private static func probeJpeg(_ reader: Reader) throws -> ImageHeaderProbe {
+        var offset = 2
+        var orientation: CGImagePropertyOrientation?
+
+        while offset + 4 <= reader.byteLength {
+            guard try reader.byte(at: offset) == 0xff else {
+                // Like decoders, skip any garbage between segments.
+                offset += 1
+                continue
+            }
+            let marker = try reader.byte(at: offset + 1)
+            switch marker {
+            case 0xff:
+                // Fill byte.
+                offset += 1
+                continue
+            case 0x01, 0xd0...0xd8:
+                // Markers without a length.
+                offset += 2
+                continue
+            case 0xd9, 0xda:
+                // EOI or SOS: there's no frame header before the image data.
+                throw ProbeError.invalidHeader
+            default:
+                break
+            }
+
+            let length = bigEndianInteger(try reader.bytes(at: offset + 2, count: 2))
+            guard length >= 2 else {
+                throw ProbeError.invalidHeader
+            }
+            let segmentOffset = offset + 4
+            let segmentLength = length - 2
+
+            switch marker {
+            case 0xe1 where orientation == nil:
+                let exifPrefix: [UInt8] = Array("Exif\0\0".utf8)
+                let segment = try reader.bytes(at: segmentOffset, count: segmentLength)
+                if segment.starts(with: exifPrefix) {
+                    orientation = exifOrientation(tiff: segment[exifPrefix.count...])
+                }
+            case 0xc0...0xcf where marker != 0xc4 && marker != 0xc8 && marker != 0xcc:
+                // SOFn (but not DHT, JPG or DAC, which share the range).
+                let frameHeader = try reader.bytes(at: segmentOffset, count: 6)
+                let height = bigEndianInteger(frameHeader[1..<3])
+                let width = bigEndianInteger(frameHeader[3..<5])
+                let componentCount = frameHeader[5]
+                return ImageHeaderProbe(
+                    imageFormat: .jpeg,
+                    pixelSize: orientedSize(width: width, height: height, orientation: orientation),
+                    bitDepth: Int(frameHeader[0]),
+                    // 1 is grayscale and 3 is YCbCr (or RGB); 4 is CMYK.
+                    hasSupportedColorModel: componentCount == 1 || componentCount == 3,
+                    hasAlpha: false,
+                    frameCount: 1
+                )
+            default:
+                break
+            }
+            offset = segmentOffset + segmentLength
+        }
+        throw ProbeError.endedUnexpectedly
+    }
+
+    // MARK: - GIF
+
+    /// See: https://www.w3.org/Graphics/GIF/spec-gif89a.txt
+    private static func probeGif(_ reader: Reader) throws -> ImageHeaderProbe {
+        let logicalScreenDescriptor = try reader.bytes(at: 6, count: 7)
+        let width = littleEndianInteger(logicalScreenDescriptor[0..<2])
+        let height = littleEndianInteger(logicalScreenDescriptor[2..<4])
+        let packedFields = logicalScreenDescriptor[4]
+
+        var offset = 13
+        if packedFields & 0x80 != 0 {
+            offset += 3 << ((packedFields & 0x07) + 1)
+        }
+
+        // Transparency is declared by a graphic control extension ahead of
+        // the first image descriptor.
+        var hasAlpha = false
+        scanBlocks: while true {
+            switch try reader.byte(at: offset) {
+            case 0x21:
+                let label = try reader.byte(at: offset + 1)
+                if label == 0xf9 {
+                    let graphicControl = try reader.bytes(at: offset + 2, count: 2)
+                    if graphicControl[0] == 4, graphicControl[1] & 0x01 != 0 {
+                        hasAlpha = true
+                    }
+                }
+                offset += 2
+                // Skip the extension's data sub-blocks.
+                while true {
+                    let subBlockLength = Int(try reader.byte(at: offset))
+                    offset += 1 + subBlockLength
+                    if subBlockLength == 0 {
+                        break
+                    }
+                }
+            case 0x2c, 0x3b:
+                // Image descriptor or trailer.
+                break scanBlocks
+            default:
+                throw ProbeError.invalidHeader
+            }
+        }
+
+        return ImageHeaderProbe(
+            imageFormat: .gif,
+            pixelSize: CGSize(width: width, height: height),
+            bitDepth: 8,
+            hasSupportedColorModel: true,
+            hasAlpha: hasAlpha,
+            frameCount: nil
+        )
+    }
+
+    // MARK: - WebP
+
+    /// See: https://developers.google.com/speed/webp/docs/riff_container
+    private static func probeWebp(_ reader: Reader) throws -> ImageHeaderProbe {
+        let riffHeader = try reader.bytes(at: 0, count: 12)
+        guard riffHeader[0..<4].elementsEqual("RIFF".utf8), riffHeader[8..<12].elementsEqual("WEBP".utf8) else {
+            throw ProbeError.invalidHeader
+        }
+        let riffEndOffset = min(reader.byteLength, 8 + littleEndianInteger(riffHeader[4..<8]))
+
+        let firstChunkHeader = try reader.bytes(at: 12, count: 8)
+        let firstChunkLength = littleEndianInteger(firstChunkHeader[4..<8])
+
+        let width: Int
+        let height: Int
+        let frameCount: Int
+        switch String(decoding: firstChunkHeader[0..<4], as: UTF8.self) {
+        case "VP8 ":
+            // A lossy still: a 3 byte frame tag, a start code, then 14 bit
+            // dimensions (and 2 bit scales we don't need).
+            let frameHeader = try reader.bytes(at: 20, count: 10)
+            guard frameHeader[3..<6].elementsEqual([0x9d, 0x01, 0x2a]) else {
+                throw ProbeError.invalidHeader
+            }
+            width = littleEndianInteger(frameHeader[6..<8]) & 0x3fff
+            height = littleEndianInteger(frameHeader[8..<10]) & 0x3fff
+            frameCount = 1
+        case "VP8L":
+            // A lossless still: a signature byte, then 14 bit dimensions
+            // minus one.
+            let header = try reader.bytes(at: 20, count: 5)
+            guard header[0] == 0x2f else {
+                throw ProbeError.invalidHeader
+            }
+            let bits = littleEndianInteger(header[1..<5])
+            width = (bits & 0x3fff) + 1
+            height = ((bits >> 14) & 0x3fff) + 1
+            frameCount = 1
+        case "VP8X":
+            // The extended format: flags, then 24 bit canvas dimensions
+            // minus one.
+            let header = try reader.bytes(at: 20, count: 10)
+            width = littleEndianInteger(header[4..<7]) + 1
+            height = littleEndianInteger(header[7..<10]) + 1
+            let isAnimated = header[0] & 0x02 != 0
+            if isAnimated {
+                // Only the chunk headers are read; frames are skipped over.
+                var animationFrameCount = 0
+                var offset = 20 + firstChunkLength + (firstChunkLength & 1)
+                while offset + 8 <= riffEndOffset {
+                    let chunkHeader = try reader.bytes(at: offset, count: 8)
+                    if chunkHeader[0..<4].elementsEqual("ANMF".utf8) {
+                        animationFrameCount += 1
+                    }
+                    let chunkLength = littleEndianInteger(chunkHeader[4..<8])
+                    offset += 8 + chunkLength + (chunkLength & 1)
+                }
+                frameCount = animationFrameCount
+            } else {
+                frameCount = 1
+            }
+        default:
+            throw ProbeError.invalidHeader
+        }
+
+        guard width > 0, height > 0, frameCount > 0 else {
+            throw ProbeError.invalidHeader
+        }
+        return ImageHeaderProbe(
+            imageFormat: .webp,
+            pixelSize: CGSize(width: width, height: height),
+            bitDepth: 8,
+            hasSupportedColorModel: true,
+            // We don't check the ALPH chunk or alpha flags; WebPs are
+            // always treated as having alpha.
+            hasAlpha: true,
+            frameCount: frameCount
+        )
+    }
+
+    // MARK: - EXIF
+
+    /// Finds the orientation tag in IFD0 of the TIFF structure at the start
+    /// of `tiff`, if there is one.
+    private static func exifOrientation(tiff: ArraySlice<UInt8>) -> CGImagePropertyOrientation? {
+        let tiff = Array(tiff)
+        guard tiff.count >= 8 else {
+            return nil
+        }
+        let isLittleEndian: Bool
+        switch (tiff[0], tiff[1]) {
+        case (0x49, 0x49):
+            isLittleEndian = true
+        case (0x4d, 0x4d):
+            isLittleEndian = false
+        default:
+            return nil
+        }
+        func integer(at offset: Int, count: Int) -> Int? {
+            guard offset >= 0, offset + count <= tiff.count else {
+                return nil
+            }
+            let bytes = tiff[offset..<(offset + count)]
+            return isLittleEndian ? littleEndianInteger(bytes) : bigEndianInteger(bytes)
+        }
+
+        guard
+            let ifdOffset = integer(at: 4, count: 4),
+            let entryCount = integer(at: ifdOffset, count: 2)
+        else {
+            return nil
+        }
+        let orientationTag = 0x0112
+        let shortType = 3
+        for index in 0..<entryCount {
+            let entryOffset = ifdOffset + 2 + index * 12
+            guard let tag = integer(at: entryOffset, count: 2) else {
+                return nil
+            }
+            guard tag == orientationTag else {
+                continue
+            }
+            guard
+                integer(at: entryOffset + 2, count: 2) == shortType,
+                let value = integer(at: entryOffset + 8, count: 2)
+            else {
+                return nil
+            }
+            return CGImagePropertyOrientation(rawValue: UInt32(value))
+        }
+        return nil
+    }
+
+    private static func orientedSize(width: Int, height: Int, orientation: CGImagePropertyOrientation?) -> CGSize {
+        switch orientation {
+        case .left, .leftMirrored, .right, .rightMirrored:
+            return CGSize(width: height, height: width)
+        case nil, .up, .upMirrored, .down, .downMirrored:
+            return CGSize(width: width, height: height)
+        }
+    }
+
+    // MARK: - Reading
+
+    private static func bigEndianInteger(_ bytes: ArraySlice<UInt8>) -> Int {
+        return bytes.reduce(0) { ($0 << 8) | Int($1) }
+    }
+
+    private static func littleEndianInteger(_ bytes: ArraySlice<UInt8>) -> Int {
+        return bytes.reversed().reduce(0) { ($0 << 8) | Int($1) }
+    }
+
+    /// Bounds-checked reads from an image source.
+    private struct Reader {
+        let source: OWSImageSource
+
+        var byteLength: Int { source.byteLength }
+
+        func bytes(at offset: Int, count: Int) throws -> ArraySlice<UInt8> {
+            guard offset >= 0, count >= 0, offset + count <= byteLength else {
+                throw ProbeError.endedUnexpectedly
+            }
+            let data = try source.readData(byteOffset: offset, byteLength: count)
+            guard data.count == count else {
+                throw ProbeError.endedUnexpectedly
+            }
+            return [UInt8](data)[...]
+        }
+
+        func byte(at offset: Int) throws -> UInt8 {
+            return try bytes(at: offset, count: 1).first!
+        }
+    }
+}
@@ -5,7 +5,6 @@
 
 import Foundation
 
-import libwebp
 import YYImage
 
 public protocol OWSImageSource {
@@ -249,7 +248,9 @@ extension OWSImageSource {
     }
 
     public func ows_hasStickerLikeProperties() -> Bool {
-        let imageMetadata = imageMetadata(withIsAnimated: false, imageFormat: ows_guessImageFormat())
+        let imageFormat = ows_guessImageFormat()
+        let headerProbe = try? ImageHeaderProbe.probe(self, imageFormat: imageFormat)
+        let imageMetadata = imageMetadata(withIsAnimated: false, imageFormat: imageFormat, headerProbe: headerProbe)
         return Data.ows_hasStickerLikeProperties(withImageMetadata: imageMetadata)
     }
 
@@ -265,12 +266,10 @@ extension OWSImageSource {
 
     public static func imageMetadata(withPath filePath: String, mimeType declaredMimeType: String?, ignoreFileSize: Bool = false) -> ImageMetadata {
         do {
-            let data = try Data(contentsOf: URL(fileURLWithPath: filePath), options: .mappedIfSafe)
-            // Use memory-mapped NSData instead of a URL-based
-            // CGImageSource. We should usually only be reading
-            // from (a small portion of) the file header,
-            // depending on the file format.
-            return data.imageMetadata(withPath: filePath, mimeType: declaredMimeType, ignoreFileSize: ignoreFileSize)
+            // Read through a file handle rather than mapping the file; only
+            // (a small portion of) the header is read, depending on the format.
+            let source = try FileHandleImageSource(fileUrl: URL(fileURLWithPath: filePath))
+            return source.imageMetadata(withPath: filePath, mimeType: declaredMimeType, ignoreFileSize: ignoreFileSize)
         } catch {
             Logger.warn("Could not read image data: \(error)")
             return .invalid()
@@ -343,31 +342,21 @@ extension OWSImageSource {
             return .invalid
         }
 
+        let headerProbe: ImageHeaderProbe?
+        do {
+            headerProbe = try ImageHeaderProbe.probe(self, imageFormat: imageFormat)
+        } catch {
+            Logger.warn("Image does not have a valid header: \(error)")
+            return .invalid
+        }
+
         let isAnimated: Bool
         switch imageFormat {
         case .gif:
             // TODO: We currently treat all GIFs as animated. We could reflect the actual image content.
             isAnimated = true
-        case .webp:
-            let webpMetadata = metadataForWebp
-            guard webpMetadata.isValid else {
-                Logger.warn("Image does not have valid webpMetadata.")
-                return .invalid
-            }
-            isAnimated = webpMetadata.frameCount > 1
-        case .png:
-            guard let isAnimatedPng = isAnimatedPngData() else {
-                Logger.warn("Could not determine if png is animated.")
-                return .invalid
-            }
-            isAnimated = isAnimatedPng.boolValue
         default:
-            isAnimated = false
-        }
-
-        guard imageFormat.isValid(source: self) else {
-            Logger.warn("Image does not have valid format.")
-            return .invalid
+            isAnimated = (headerProbe?.frameCount ?? 1) > 1
         }
 
         if !ignorePerTypeFileSizeLimits {
@@ -380,7 +369,7 @@ extension OWSImageSource {
             }
         }
 
-        let metadata = imageMetadata(withIsAnimated: isAnimated, imageFormat: imageFormat)
+        let metadata = imageMetadata(withIsAnimated: isAnimated, imageFormat: imageFormat, headerProbe: headerProbe)
 
         guard metadata.isValid else {
             return .invalid
@@ -404,14 +393,13 @@ extension OWSImageSource {
         return .valid(metadata)
     }
 
-    fileprivate func imageMetadata(withIsAnimated isAnimated: Bool, imageFormat: ImageFormat) -> ImageMetadata {
-        if imageFormat == .webp {
-            let imageSize = sizeForWebpData
-            guard Data.ows_isValidImage(dimension: imageSize, depthBytes: 1, isAnimated: isAnimated) else {
-                Logger.warn("Image does not have valid dimensions: \(imageSize)")
-                return .invalid()
-            }
-            return .init(isValid: true, imageFormat: imageFormat, pixelSize: imageSize, hasAlpha: true, isAnimated: isAnimated)
+    fileprivate func imageMetadata(withIsAnimated isAnimated: Bool, imageFormat: ImageFormat, headerProbe: ImageHeaderProbe?) -> ImageMetadata {
+        if let headerProbe {
+            return Data.imageMetadata(withHeaderProbe: headerProbe, isAnimated: isAnimated)
+        }
+        guard imageFormat != .webp else {
+            Logger.warn("Image does not have a valid webp header.")
+            return .invalid()
         }
 
         guard let imageSource = try? self.cgImageSource() else {
@@ -421,6 +409,27 @@ extension OWSImageSource {
         return Data.imageMetadata(withImageSource: imageSource, imageFormat: imageFormat, isAnimated: isAnimated)
     }
 
+    fileprivate static func imageMetadata(withHeaderProbe headerProbe: ImageHeaderProbe, isAnimated: Bool) -> ImageMetadata {
+        guard headerProbe.hasSupportedColorModel else {
+            Logger.warn("Invalid colorModel")
+            return .invalid()
+        }
+
+        let depthBytes = ceil(Double(headerProbe.bitDepth) / 8.0)
+        guard ows_isValidImage(dimension: headerProbe.pixelSize, depthBytes: depthBytes, isAnimated: isAnimated) else {
+            Logger.warn("Image does not have valid dimensions: \(headerProbe.pixelSize).")
+            return .invalid()
+        }
+
+        return .init(
+            isValid: true,
+            imageFormat: headerProbe.imageFormat,
+            pixelSize: headerProbe.pixelSize,
+            hasAlpha: headerProbe.hasAlpha,
+            isAnimated: isAnimated
+        )
+    }
+
     fileprivate static func imageMetadata(withImageSource imageSource: CGImageSource, imageFormat: ImageFormat, isAnimated: Bool) -> ImageMetadata {
         let options = [kCGImageSourceShouldCache as String: false]
         guard let imageProperties = CGImageSourceCopyPropertiesAtIndex(imageSource, 0, options as CFDictionary) as? [String: AnyObject] else {
@@ -498,38 +507,4 @@ extension OWSImageSource {
         let fileExtension = ((filePath as NSString).lastPathComponent as NSString).pathExtension.lowercased()
         return "webp" == fileExtension
     }
-
-    fileprivate var sizeForWebpData: CGSize {
-        let webpMetadata = metadataForWebp
-        guard webpMetadata.isValid else {
-            return .zero
-        }
-        return .init(width: CGFloat(webpMetadata.canvasWidth), height: CGFloat(webpMetadata.canvasHeight))
-    }
-
-    fileprivate var metadataForWebp: WebpMetadata {
-        guard let data = try? self.readIntoMemory() else {
-            return WebpMetadata(isValid: false, canvasWidth: 0, canvasHeight: 0, frameCount: 0)
-        }
-        return data.withUnsafeBytes {
-            $0.withMemoryRebound(to: UInt8.self) { buffer in
-                var webPData = WebPData(bytes: buffer.baseAddress, size: buffer.count)
-                guard let demuxer = WebPDemux(&webPData) else {
-                    return WebpMetadata(isValid: false, canvasWidth: 0, canvasHeight: 0, frameCount: 0)
-                }
-                defer {
-                    WebPDemuxDelete(demuxer)
-                }
-
-                let canvasWidth = WebPDemuxGetI(demuxer, WEBP_FF_CANVAS_WIDTH)
-                let canvasHeight = WebPDemuxGetI(demuxer, WEBP_FF_CANVAS_HEIGHT)
-                let frameCount = WebPDemuxGetI(demuxer, WEBP_FF_FRAME_COUNT)
-                let result = WebpMetadata(isValid: canvasWidth > 0 && canvasHeight > 0 && frameCount > 0,
-                                          canvasWidth: canvasWidth,
-                                          canvasHeight: canvasHeight,
-                                          frameCount: frameCount)
-                return result
-            }
-        }
-    }
 }
@@ -63,10 +63,25 @@ public class AnyLRUCache: NSObject {
 
 // MARK: -
 
-// A simple LRU cache bounded by the number of entries.
+// A simple LRU cache bounded by the number of entries and, optionally, by
+// the total cost (e.g. the byte size) of its entries.
+//
+// Entries that are given a cost also count against a process-wide
+// `LRUCacheMemoryBudget`, so many caches of small items can't add up to more
+// memory than we can afford.
 public class LRUCache<KeyType: Hashable & Equatable, ValueType> {
 
+    private final class Entry: LRUCacheEntry {
+        let value: ValueType
+
+        init(value: ValueType, cost: Int) {
+            self.value = value
+            super.init(cost: cost)
+        }
+    }
+
     private let cache = NSCache<AnyObject, AnyObject>()
+    private let costTracker: LRUCacheCostTracker
     private let _resetCount = AtomicUInt(0, lock: .sharedGlobal)
     public var resetCount: UInt {
         _resetCount.get()
@@ -81,11 +96,37 @@ public class LRUCache<KeyType: Hashable & Equatable, ValueType> {
         }
     }
 
+    /// The maximum total cost of this cache's entries, or 0 for no limit.
+    public var maxCost: Int {
+        get {
+            return cache.totalCostLimit
+        }
+        set {
+            cache.totalCostLimit = newValue
+        }
+    }
+
+    /// The total cost of the entries currently in the cache.
+    public var totalCost: Int {
+        costTracker.totalCost
+    }
+
+    /// The number of entries currently in the cache.
+    public var count: Int {
+        costTracker.count
+    }
+
     public init(maxSize: Int,
                 nseMaxSize: Int = 0,
-                shouldEvacuateInBackground: Bool = false) {
+                shouldEvacuateInBackground: Bool = false,
+                maxCost: Int = 0,
+                memoryBudget: LRUCacheMemoryBudget = .shared) {
         regularMaxSize = CurrentAppContext().isNSE ? nseMaxSize : maxSize
         self.cache.countLimit = regularMaxSize
+        self.cache.totalCostLimit = maxCost
+        self.costTracker = LRUCacheCostTracker(budget: memoryBudget)
+        self.cache.delegate = costTracker
+        costTracker.clearBlock = { [weak self] in self?.clear() }
 
         if CurrentAppContext().isMainApp,
            shouldEvacuateInBackground {
@@ -96,6 +137,10 @@ public class LRUCache<KeyType: Hashable & Equatable, ValueType> {
         }
     }
 
+    deinit {
+        costTracker.didRemoveAll()
+    }
+
     @objc
     private func didEnterBackground() {
         AssertIsOnMainThread()
@@ -104,17 +149,21 @@ public class LRUCache<KeyType: Hashable & Equatable, ValueType> {
     }
 
     public func get(key: KeyType) -> ValueType? {
-        // ValueType might be AnyObject, so we need to check
-        // rawValue for nil; value might be NSNull.
-        guard let rawValue = cache.object(forKey: key as AnyObject),
-              let value = rawValue as? ValueType else {
+        guard let entry = cache.object(forKey: key as AnyObject) as? Entry else {
             return nil
         }
-        owsAssertDebug(!(value is NSNull))
-        return value
+        // ValueType might be AnyObject; value shouldn't be NSNull.
+        owsAssertDebug(!(entry.value is NSNull))
+        return entry.value
     }
 
     public func set(key: KeyType, value: ValueType) {
+        set(key: key, value: value, cost: 0)
+    }
+
+    /// Adds `value` to the cache. `cost` is typically its size in bytes; if
+    /// nonzero, it counts against `maxCost` and the process-wide budget.
+    public func set(key: KeyType, value: ValueType, cost: Int) {
         if value is NSNull {
             owsFailDebug("Nil value.")
             remove(key: key)
@@ -123,10 +172,20 @@ public class LRUCache<KeyType: Hashable & Equatable, ValueType> {
         guard cache.countLimit > 0 else {
             return
         }
-        cache.setObject(value as AnyObject, forKey: key as AnyObject)
+        let entry = Entry(value: value, cost: max(0, cost))
+        // NSCache doesn't tell its delegate about replaced entries.
+        if let replacedEntry = cache.object(forKey: key as AnyObject) as? LRUCacheEntry {
+            costTracker.didRemove(replacedEntry)
+        }
+        costTracker.didAdd(entry)
+        cache.setObject(entry, forKey: key as AnyObject, cost: entry.cost)
+        costTracker.trimBudgetIfNeeded()
     }
 
     public func remove(key: KeyType) {
+        if let entry = cache.object(forKey: key as AnyObject) as? LRUCacheEntry {
+            costTracker.didRemove(entry)
+        }
         cache.removeObject(forKey: key as AnyObject)
     }
 
@@ -134,6 +193,7 @@ public class LRUCache<KeyType: Hashable & Equatable, ValueType> {
     public func clear() {
         _resetCount.increment()
 
+        costTracker.didRemoveAll()
         autoreleasepool {
             cache.removeAllObjects()
         }
@@ -173,6 +233,203 @@ public class LRUCache<KeyType: Hashable & Equatable, ValueType> {
 
 // MARK: -
 
+private class LRUCacheEntry {
+    let cost: Int
+
+    /// The `LRUCacheCostTracker` generation that this entry was counted in,
+    /// or nil if it isn't counted. Guarded by the tracker's lock.
+    var countedGeneration: Int?
+
+    init(cost: Int) {
+        self.cost = cost
+    }
+}
+
+// MARK: -
+
+/// Keeps a running total of the cost of one LRUCache's entries and reports it
+/// to the memory budget. Also counts the entries, which NSCache doesn't expose.
+private final class LRUCacheCostTracker: NSObject, NSCacheDelegate {
+    private let budget: LRUCacheMemoryBudget
+    private let lock = UnfairLock()
+    private var _totalCost = 0
+    private var _count = 0
+    /// Bumped when the cache is cleared, so that we don't need to hear back
+    /// about every entry that was in it.
+    private var generation = 0
+
+    var clearBlock: (() -> Void)?
+
+    init(budget: LRUCacheMemoryBudget) {
+        self.budget = budget
+        super.init()
+        budget.register(self)
+    }
+
+    var totalCost: Int {
+        lock.withLock { _totalCost }
+    }
+
+    var count: Int {
+        lock.withLock { _count }
+    }
+
+    func didAdd(_ entry: LRUCacheEntry) {
+        lock.withLock {
+            entry.countedGeneration = generation
+            _totalCost += entry.cost
+            _count += 1
+        }
+        if entry.cost > 0 {
+            budget.didAdd(cost: entry.cost)
+        }
+    }
+
+    func didRemove(_ entry: LRUCacheEntry) {
+        let removedCost: Int = lock.withLock {
+            guard entry.countedGeneration == generation else {
+                return 0
+            }
+            entry.countedGeneration = nil
+            _totalCost -= entry.cost
+            _count -= 1
+            return entry.cost
+        }
+        if removedCost > 0 {
+            budget.didRemove(cost: removedCost)
+        }
+    }
+
+    func didRemoveAll() {
+        let removedCost: Int = lock.withLock {
+            generation += 1
+            let removedCost = _totalCost
+            _totalCost = 0
+            _count = 0
+            return removedCost
+        }
+        if removedCost > 0 {
+            budget.didRemove(cost: removedCost)
+        }
+    }
+
+    func trimBudgetIfNeeded() {
+        budget.trimIfNeeded()
+    }
+
+    func clear() {
+        clearBlock?()
+    }
+
+    // MARK: - NSCacheDelegate
+
+    func cache(_ cache: NSCache<AnyObject, AnyObject>, willEvictObject obj: Any) {
+        guard let entry = obj as? LRUCacheEntry else {
+            return
+        }
+        didRemove(entry)
+    }
+}
+
+// MARK: -
+
+/// A limit on the total cost of the entries in all `LRUCache`s that share
+/// it. When the limit is exceeded, or the app receives a memory warning,
+/// the most expensive caches are cleared.
+public final class LRUCacheMemoryBudget: NSObject {
+
+    public static let shared = LRUCacheMemoryBudget(byteLimit: LRUCacheMemoryBudget.defaultByteLimit)
+
+    private static var defaultByteLimit: Int {
+        if CurrentAppContext().isNSE {
+            return 4 * 1024 * 1024
+        }
+        // Stay well clear of the app's jetsam limit, which scales with
+        // physical memory.
+        let physicalMemory = Int(clamping: ProcessInfo.processInfo.physicalMemory)
+        return (physicalMemory / 32).clamp(32 * 1024 * 1024, 192 * 1024 * 1024)
+    }
+
+    public let byteLimit: Int
+
+    private let lock = UnfairLock()
+    private var _totalCost = 0
+    private let trackers = NSHashTable<LRUCacheCostTracker>.weakObjects()
+
+    public init(byteLimit: Int) {
+        self.byteLimit = byteLimit
+        super.init()
+
+        NotificationCenter.default.addObserver(
+            self,
+            selector: #selector(didReceiveMemoryWarning),
+            name: UIApplication.didReceiveMemoryWarningNotification,
+            object: nil
+        )
+    }
+
+    public var totalCost: Int {
+        lock.withLock { _totalCost }
+    }
+
+    fileprivate func register(_ tracker: LRUCacheCostTracker) {
+        lock.withLock { trackers.add(tracker) }
+    }
+
+    fileprivate func didAdd(cost: Int) {
+        lock.withLock { _totalCost += cost }
+    }
+
+    fileprivate func didRemove(cost: Int) {
+        lock.withLock {
+            _totalCost -= cost
+            owsAssertDebug(_totalCost >= 0)
+        }
+    }
+
+    fileprivate func trimIfNeeded() {
+        // Clear whole caches, largest first. NSCache doesn't let us evict its
+        // least recently used entries on demand.
+        while true {
+            let trackerToClear: LRUCacheCostTracker? = lock.withLock {
+                guard _totalCost > byteLimit else {
+                    return nil
+                }
+                return trackers.allObjects.max { $0.totalCost < $1.totalCost }
+            }
+            guard let trackerToClear else {
+                return
+            }
+            let trackerCost = trackerToClear.totalCost
+            guard trackerCost > 0 else {
+                return
+            }
+            Logger.info("Over budget (\(totalCost) > \(byteLimit) bytes); clearing a cache with cost \(trackerCost)")
+            trackerToClear.clear()
+            guard trackerToClear.totalCost < trackerCost else {
+                // The cache is going away; don't spin.
+                return
+            }
+        }
+    }
+
+    @objc
+    private func didReceiveMemoryWarning() {
+        clearAll()
+    }
+
+    /// Clears every cache with entries that count against this budget. App
+    /// extensions don't receive memory warnings, so they call this when
+    /// they're running low on memory.
+    public func clearAll() {
+        let trackersToClear = lock.withLock { trackers.allObjects.filter { $0.totalCost > 0 } }
+        Logger.warn("Clearing \(trackersToClear.count) caches with cost \(totalCost)")
+        trackersToClear.forEach { $0.clear() }
+    }
+}
+
+// MARK: -
+
 // NSCache sometimes evacuates entries off the main thread.
 // Some cached entities should only be deallocated on the main thread.
 // This handle can be used to ensure that cache entries are released
@@ -0,0 +1,119 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import CryptoKit
+import Foundation
+
+/// Keeps files on disk, keyed by a hash of a caller-provided key, e.g.
+/// downloaded GIF search renditions or rendered avatars.
+///
+/// Callers typically put the directory in the shared container so the main
+/// app and the extensions can all use it. Entries are evicted least recently
+/// used first once the cache is over `maxSize`, except for those used within
+/// `minRetainedAge`, which a view may still be loading from.
+///
+/// This class is thread-safe.
+public final class LRUDiskCache {
+
+    private let directoryUrl: URL
+    private let maxSize: Int64
+    private let minRetainedAge: TimeInterval
+
+    private let trimQueue = DispatchQueue(label: "org.signal.lru-disk-cache", qos: .utility)
+    private let needsTrim = AtomicBool(false, lock: UnfairLock())
+
+    public init(directoryUrl: URL, maxSize: Int64, minRetainedAge: TimeInterval = 10 * kMinuteInterval) {
+        self.directoryUrl = directoryUrl
+        self.maxSize = maxSize
+        self.minRetainedAge = minRetainedAge
+
+        do {
+            try FileManager.default.createDirectory(at: directoryUrl, withIntermediateDirectories: true)
+        } catch {
+            owsFailDebug("Couldn't create cache directory: \(error)")
+        }
+        // Don't back up cached files.
+        OWSFileSystem.protectFileOrFolder(atPath: directoryUrl.path)
+
+        scheduleTrim()
+    }
+
+    /// Hashing keeps keys of any length or content safe to use as filenames.
+    static func fileName(key: String) -> String {
+        return Data(SHA256.hash(data: Data(key.utf8))).hexadecimalString
+    }
+
+    public func fileUrl(key: String, fileExtension: String) -> URL {
+        return directoryUrl.appendingPathComponent(Self.fileName(key: key)).appendingPathExtension(fileExtension)
+    }
+
+    /// Returns the cached file for `key`, if any, and marks it as recently used.
+    public func cachedFileUrl(key: String, fileExtension: String) -> URL? {
+        let fileUrl = self.fileUrl(key: key, fileExtension: fileExtension)
+        do {
+            // Also checks that the file exists.
+            try FileManager.default.setAttributes([.modificationDate: Date()], ofItemAtPath: fileUrl.path)
+            return fileUrl
+        } catch {
+            return nil
+        }
+    }
+
+    /// Stores `data` for `key`, returning the file it was written to.
+    public func store(_ data: Data, key: String, fileExtension: String) throws -> URL {
+        let fileUrl = self.fileUrl(key: key, fileExtension: fileExtension)
+        try data.write(to: fileUrl, options: .atomic)
+        scheduleTrim()
+        return fileUrl
+    }
+
+    /// Trims are coalesced, since every store adds an entry.
+    private func scheduleTrim() {
+        guard needsTrim.tryToSetFlag() else {
+            return
+        }
+        trimQueue.async {
+            self.needsTrim.set(false)
+            self.trim()
+        }
+    }
+
+    func trim() {
+        let resourceKeys: Set<URLResourceKey> = [.contentModificationDateKey, .totalFileAllocatedSizeKey]
+        guard let fileUrls = try? FileManager.default.contentsOfDirectory(
+            at: directoryUrl,
+            includingPropertiesForKeys: Array(resourceKeys)
+        ) else {
+            return
+        }
+
+        var entries = [(fileUrl: URL, modificationDate: Date, size: Int64)]()
+        var totalSize: Int64 = 0
+        for fileUrl in fileUrls {
+            guard let resourceValues = try? fileUrl.resourceValues(forKeys: resourceKeys) else {
+                continue
+            }
+            let size = Int64(resourceValues.totalFileAllocatedSize ?? 0)
+            entries.append((fileUrl, resourceValues.contentModificationDate ?? .distantPast, size))
+            totalSize += size
+        }
+        guard totalSize > maxSize else {
+            return
+        }
+
+        let now = Date()
+        for entry in entries.sorted(by: { $0.modificationDate < $1.modificationDate }) {
+            guard totalSize > maxSize, now.timeIntervalSince(entry.modificationDate) > minRetainedAge else {
+                break
+            }
+            do {
+                try OWSFileSystem.deleteFileIfExists(url: entry.fileUrl)
+                totalSize -= entry.size
+            } catch {
+                Logger.warn("Couldn't evict cached file: \(error)")
+            }
+        }
+    }
+}
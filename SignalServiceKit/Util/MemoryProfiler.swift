@@ -0,0 +1,315 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// Periodically records the app's memory footprint and the size of its
+/// caches, so that debug logs sent after a jetsam or memory warning show
+/// what was using memory at the time.
+///
+/// Samples are kept in a fixed-size ring buffer. Once started, the buffer is
+/// also written to the debug logs directory (so it's uploaded with the
+/// logs), and the previous launch's buffer is kept alongside it, since a
+/// jetsam ends the process without warning.
+public final class MemoryProfiler: MemorySampler {
+
+    public static let shared = MemoryProfiler()
+
+    public struct CacheSize {
+        public let count: Int
+        /// The total cost of the entries, typically in bytes. Zero for caches
+        /// whose entries aren't given a cost.
+        public let cost: Int
+
+        public init(count: Int, cost: Int) {
+            self.count = count
+            self.cost = cost
+        }
+    }
+
+    struct Sample {
+        let date: Date
+        let footprint: UInt64
+        let peakFootprint: Int64
+        let bytesRemaining: UInt64
+        let lruCacheBudgetCost: Int
+        let screen: String?
+        let reason: String?
+        let cacheSizes: [(name: String, size: CacheSize)]
+    }
+
+    static let sampleInterval: TimeInterval = 30
+    /// An hour of samples, at `sampleInterval`.
+    static let sampleCapacity = 120
+    /// Persist every few samples, rather than on every one.
+    private static let samplesPerWrite = 4
+
+    static let profileFilename = "MemoryProfile.txt"
+    static let previousProfileFilename = "MemoryProfile-previous.txt"
+
+    private let capacity: Int
+    private let queue = DispatchQueue(label: "org.signal.memory-profiler", qos: .utility)
+
+    private let lock = UnfairLock()
+    private var samples = [Sample]()
+    private var nextSampleIndex = 0
+    private var samplesSinceWrite = 0
+    private var cacheRegistrations = [CacheRegistration]()
+    private var nextCacheRegistrationId = 0
+    private var currentScreen: String?
+    private var peakFootprintByScreen = [String: UInt64]()
+    private var timer: DispatchSourceTimer?
+    private var profileDirectoryPath: String?
+
+    private struct CacheRegistration {
+        let id: Int
+        let name: String
+        let sizeBlock: () -> CacheSize?
+    }
+
+    init(capacity: Int = MemoryProfiler.sampleCapacity) {
+        self.capacity = capacity
+    }
+
+    // MARK: - Starting
+
+    /// Starts taking a sample every `sampleInterval`, and on memory warnings.
+    ///
+    /// - Parameter directoryPath: Where to write the samples, or nil to only
+    ///   keep them in memory.
+    public func start(persistingTo directoryPath: String?) {
+        let didStart: Bool = lock.withLock {
+            guard timer == nil else {
+                return false
+            }
+            profileDirectoryPath = directoryPath
+
+            let timer = DispatchSource.makeTimerSource(queue: queue)
+            timer.schedule(deadline: .now(), repeating: Self.sampleInterval, leeway: .seconds(5))
+            timer.setEventHandler { [weak self] in self?.recordSample(reason: nil) }
+            self.timer = timer
+            return true
+        }
+        guard didStart else {
+            return
+        }
+
+        queue.async {
+            self.rotatePreviousProfile()
+            self.lock.withLock { self.timer }?.resume()
+        }
+
+        NotificationCenter.default.addObserver(
+            self,
+            selector: #selector(didReceiveMemoryWarning),
+            name: UIApplication.didReceiveMemoryWarningNotification,
+            object: nil
+        )
+    }
+
+    @objc
+    private func didReceiveMemoryWarning() {
+        queue.async {
+            self.recordSample(reason: "memory warning")
+            Logger.warn("Memory warning; recent memory samples:\n\(self.recentSamplesDescription(limit: 5))")
+            self.writeProfile()
+        }
+    }
+
+    // MARK: - Inputs
+
+    /// Includes a cache's size in every sample. The block is called off the
+    /// main thread; if it returns nil, the cache is no longer reported.
+    public func registerCache(named name: String, sizeBlock: @escaping () -> CacheSize?) {
+        lock.withLock {
+            cacheRegistrations.append(CacheRegistration(id: nextCacheRegistrationId, name: name, sizeBlock: sizeBlock))
+            nextCacheRegistrationId += 1
+        }
+    }
+
+    public func registerCache<KeyType, ValueType>(_ cache: LRUCache<KeyType, ValueType>, named name: String) {
+        registerCache(named: name) { [weak cache] in
+            cache.map { CacheSize(count: $0.count, cost: $0.totalCost) }
+        }
+    }
+
+    /// Attributes later samples to `screen`, and tracks the highest footprint
+    /// seen while it's shown.
+    public func screenDidAppear(_ screen: String) {
+        lock.withLock {
+            currentScreen = screen
+        }
+    }
+
+    // MARK: - MemorySampler
+
+    /// Records a sample now, in addition to the periodic ones.
+    public func sample() {
+        queue.async {
+            self.recordSample(reason: "requested")
+        }
+    }
+
+    // MARK: - Sampling
+
+    func recordSample(reason: String?) {
+        guard let memoryStatus = LocalDevice.currentMemoryStatus(forceUpdate: true) else {
+            return
+        }
+
+        // Don't hold our lock while asking the caches, which take their own.
+        let cacheRegistrations = lock.withLock { self.cacheRegistrations }
+        var cacheSizes = [(name: String, size: CacheSize)]()
+        var releasedRegistrationIds = Set<Int>()
+        for registration in cacheRegistrations {
+            if let size = registration.sizeBlock() {
+                cacheSizes.append((registration.name, size))
+            } else {
+                releasedRegistrationIds.insert(registration.id)
+            }
+        }
+        let lruCacheBudgetCost = LRUCacheMemoryBudget.shared.totalCost
+
+        let shouldWrite: Bool = lock.withLock {
+            if !releasedRegistrationIds.isEmpty {
+                self.cacheRegistrations.removeAll { releasedRegistrationIds.contains($0.id) }
+            }
+            let sample = Sample(
+                date: Date(),
+                footprint: memoryStatus.footprint,
+                peakFootprint: memoryStatus.peakFootprint,
+                bytesRemaining: memoryStatus.bytesRemaining,
+                lruCacheBudgetCost: lruCacheBudgetCost,
+                screen: currentScreen,
+                reason: reason,
+                cacheSizes: cacheSizes
+            )
+            if samples.count < capacity {
+                samples.append(sample)
+            } else {
+                samples[nextSampleIndex] = sample
+            }
+            nextSampleIndex = (nextSampleIndex + 1) % capacity
+
+            if let currentScreen {
+                peakFootprintByScreen[currentScreen] = max(peakFootprintByScreen[currentScreen] ?? 0, sample.footprint)
+            }
+
+            samplesSinceWrite += 1
+            guard samplesSinceWrite >= Self.samplesPerWrite else {
+                return false
+            }
+            samplesSinceWrite = 0
+            return true
+        }
+        if shouldWrite {
+            writeProfile()
+        }
+    }
+
+    /// The samples, oldest first.
+    func orderedSamples() -> [Sample] {
+        lock.withLock {
+            guard samples.count == capacity else {
+                return samples
+            }
+            return Array(samples[nextSampleIndex...] + samples[..<nextSampleIndex])
+        }
+    }
+
+    // MARK: - Reporting
+
+    public func report() -> String {
+        let peakFootprintByScreen = lock.withLock { self.peakFootprintByScreen }
+        let samples = orderedSamples()
+
+        var lines = [String]()
+        lines.append("Peak footprint by screen:")
+        for (screen, peakFootprint) in peakFootprintByScreen.sorted(by: { $0.value > $1.value }) {
+            lines.append("  \(screen): \(Self.formatBytes(peakFootprint))")
+        }
+        lines.append("")
+        lines.append("Samples (oldest first):")
+        lines.append(contentsOf: samples.map(Self.describe(_:)))
+        return lines.joined(separator: "\n") + "\n"
+    }
+
+    private func recentSamplesDescription(limit: Int) -> String {
+        orderedSamples().suffix(limit).map(Self.describe(_:)).joined(separator: "\n")
+    }
+
+    private static func describe(_ sample: Sample) -> String {
+        var components = [
+            "\(sample.date)",
+            "footprint: \(formatBytes(sample.footprint))",
+            "peak: \(formatBytes(UInt64(clamping: sample.peakFootprint)))",
+        ]
+        if sample.bytesRemaining > 0 {
+            // The simulator doesn't report available bytes.
+            components.append("remaining: \(formatBytes(sample.bytesRemaining))")
+        }
+        components.append("LRU budget: \(formatBytes(UInt64(clamping: sample.lruCacheBudgetCost)))")
+        if let screen = sample.screen {
+            components.append("screen: \(screen)")
+        }
+        if let reason = sample.reason {
+            components.append("reason: \(reason)")
+        }
+        let cacheDescriptions = sample.cacheSizes.map { name, size in
+            size.cost > 0 ? "\(name)=\(size.count)/\(formatBytes(UInt64(size.cost)))" : "\(name)=\(size.count)"
+        }
+        if !cacheDescriptions.isEmpty {
+            components.append("caches: \(cacheDescriptions.joined(separator: " "))")
+        }
+        return components.joined(separator: ", ")
+    }
+
+    private static func formatBytes(_ byteCount: UInt64) -> String {
+        ByteCountFormatter.string(fromByteCount: Int64(clamping: byteCount), countStyle: .memory)
+    }
+
+    // MARK: - Persistence
+
+    /// Writes the latest samples now, e.g. right before the logs are collected.
+    public func writeProfileNow() {
+        queue.sync {
+            writeProfile()
+        }
+    }
+
+    private func rotatePreviousProfile() {
+        guard let directoryPath = lock.withLock({ profileDirectoryPath }) else {
+            return
+        }
+        let profilePath = directoryPath.appendingPathComponent(Self.profileFilename)
+        let previousProfilePath = directoryPath.appendingPathComponent(Self.previousProfileFilename)
+        guard OWSFileSystem.fileOrFolderExists(atPath: profilePath) else {
+            return
+        }
+        OWSFileSystem.deleteFileIfExists(previousProfilePath)
+        do {
+            try FileManager.default.moveItem(atPath: profilePath, toPath: previousProfilePath)
+        } catch {
+            Logger.warn("Couldn't keep previous memory profile: \(error)")
+        }
+    }
+
+    private func writeProfile() {
+        guard let directoryPath = lock.withLock({ profileDirectoryPath }) else {
+            return
+        }
+        // The logs may have been wiped, or turned off, since we started.
+        guard Preferences.isLoggingEnabled else {
+            return
+        }
+        OWSFileSystem.ensureDirectoryExists(directoryPath)
+        let profilePath = directoryPath.appendingPathComponent(Self.profileFilename)
+        do {
+            try report().write(toFile: profilePath, atomically: true, encoding: .utf8)
+        } catch {
+            Logger.warn("Couldn't write memory profile: \(error)")
+        }
+    }
+}
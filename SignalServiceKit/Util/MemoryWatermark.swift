@@ -0,0 +1,47 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// How close this process is to its memory limit, judged by how many bytes
+/// the system says we can still allocate before we're killed.
+///
+/// The NSE's limit is a small fraction of the app's, so the NSE checks this
+/// as it works through a backlog: at `.elevated` it does less at a time and
+/// drops its caches, and at `.critical` it stops and leaves the rest for
+/// later.
+public enum MemoryWatermark: Int, Comparable {
+    case normal
+    case elevated
+    case critical
+
+    static let elevatedThreshold: UInt64 = 10 * 1024 * 1024
+    static let criticalThreshold: UInt64 = 5 * 1024 * 1024
+
+    init(bytesRemaining: UInt64) {
+        switch bytesRemaining {
+        case 0:
+            // The simulator (and some processes) don't report a limit.
+            self = .normal
+        case ..<Self.criticalThreshold:
+            self = .critical
+        case ..<Self.elevatedThreshold:
+            self = .elevated
+        default:
+            self = .normal
+        }
+    }
+
+    public static var current: MemoryWatermark {
+        guard let memoryStatus = LocalDevice.currentMemoryStatus(forceUpdate: true) else {
+            return .normal
+        }
+        return MemoryWatermark(bytesRemaining: memoryStatus.bytesRemaining)
+    }
+
+    public static func < (lhs: MemoryWatermark, rhs: MemoryWatermark) -> Bool {
+        return lhs.rawValue < rhs.rawValue
+    }
+}
@@ -88,34 +88,74 @@ public class MimeTypeUtil: NSObject {
     public static let syncMessageFileExtension = "bin"
 
     // MARK: - Supported Mime Types
+
+    /// Which of the supported mime type tables a mime type appears in.
+    public struct Classification: OptionSet, Equatable {
+        public let rawValue: UInt
+        public init(rawValue: UInt) {
+            self.rawValue = rawValue
+        }
+
+        public static let video = Classification(rawValue: 1 << 0)
+        public static let audio = Classification(rawValue: 1 << 1)
+        public static let image = Classification(rawValue: 1 << 2)
+        public static let definitelyAnimated = Classification(rawValue: 1 << 3)
+        public static let maybeAnimated = Classification(rawValue: 1 << 4)
+        public static let binaryData = Classification(rawValue: 1 << 5)
+
+        public static let visualMedia: Classification = [.image, .video, .maybeAnimated]
+    }
+
+    /// Classifies `contentType` with a single lookup, for callers that would
+    /// otherwise check several of the `isSupported…MimeType` methods in turn.
+    public static func classify(_ contentType: String) -> Classification {
+        classifications[contentType] ?? []
+    }
+
+    private static let classifications: [String: Classification] = {
+        var result = [String: Classification]()
+        let tables: [(Classification, [String: String])] = [
+            (.video, supportedVideoMimeTypesToExtensionTypes),
+            (.audio, supportedAudioMimeTypesToExtensionTypes),
+            (.image, supportedImageMimeTypesToExtensionTypes),
+            (.definitelyAnimated, supportedDefinitelyAnimatedMimeTypesToExtensionTypes),
+            (.maybeAnimated, supportedMaybeAnimatedMimeTypesToExtensionTypes),
+            (.binaryData, supportedBinaryDataMimeTypesToExtensionTypes),
+        ]
+        for (classification, table) in tables {
+            for mimeType in table.keys {
+                result[mimeType, default: []].insert(classification)
+            }
+        }
+        return result
+    }()
+
     @objc
     public static func isSupportedVideoMimeType(_ contentType: String) -> Bool {
-        supportedVideoMimeTypesToExtensionTypes[contentType] != nil
+        classify(contentType).contains(.video)
     }
     @objc
     public static func isSupportedAudioMimeType(_ contentType: String) -> Bool {
-        supportedAudioMimeTypesToExtensionTypes[contentType] != nil
+        classify(contentType).contains(.audio)
     }
     @objc
     public static func isSupportedImageMimeType(_ contentType: String) -> Bool {
-        supportedImageMimeTypesToExtensionTypes[contentType] != nil
+        classify(contentType).contains(.image)
     }
     @objc
     public static func isSupportedDefinitelyAnimatedMimeType(_ contentType: String) -> Bool {
-        supportedDefinitelyAnimatedMimeTypesToExtensionTypes[contentType] != nil
+        classify(contentType).contains(.definitelyAnimated)
     }
     @objc
     public static func isSupportedMaybeAnimatedMimeType(_ contentType: String) -> Bool {
-        supportedMaybeAnimatedMimeTypesToExtensionTypes[contentType] != nil
+        classify(contentType).contains(.maybeAnimated)
     }
     public static func isSupportedBinaryDataMimeType(_ contentType: String) -> Bool {
-        supportedBinaryDataMimeTypesToExtensionTypes[contentType] != nil
+        classify(contentType).contains(.binaryData)
     }
     @objc
     public static func isSupportedVisualMediaMimeType(_ contentType: String) -> Bool {
-        isSupportedImageMimeType(contentType)
-        || isSupportedVideoMimeType(contentType)
-        || isSupportedMaybeAnimatedMimeType(contentType)
+        !classify(contentType).isDisjoint(with: .visualMedia)
     }
 
     // MARK: - Supported File Extensions
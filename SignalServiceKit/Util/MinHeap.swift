@@ -0,0 +1,84 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// A binary min-heap.
+///
+/// `insert` and `popMin` are O(log n); `min` is O(1).
+///
+/// > Important: This type is not thread-safe; callers must provide their own
+/// synchronization.
+public struct MinHeap<Element: Comparable> {
+    private var elements = [Element]()
+
+    public init() {}
+
+    public init<S: Sequence>(_ sequence: S) where S.Element == Element {
+        for element in sequence {
+            insert(element)
+        }
+    }
+
+    public var count: Int { elements.count }
+
+    public var isEmpty: Bool { elements.isEmpty }
+
+    public var min: Element? { elements.first }
+
+    public mutating func insert(_ element: Element) {
+        elements.append(element)
+        siftUp(from: elements.count - 1)
+    }
+
+    @discardableResult
+    public mutating func popMin() -> Element? {
+        guard !elements.isEmpty else {
+            return nil
+        }
+        elements.swapAt(0, elements.count - 1)
+        let result = elements.removeLast()
+        if !elements.isEmpty {
+            siftDown(from: 0)
+        }
+        return result
+    }
+
+    public mutating func removeAll() {
+        elements.removeAll()
+    }
+
+    private mutating func siftUp(from index: Int) {
+        var childIndex = index
+        while childIndex > 0 {
+            let parentIndex = (childIndex - 1) / 2
+            guard elements[childIndex] < elements[parentIndex] else {
+                return
+            }
+            elements.swapAt(childIndex, parentIndex)
+            childIndex = parentIndex
+        }
+    }
+
+    private mutating func siftDown(from index: Int) {
+        var parentIndex = index
+        while true {
+            let leftIndex = 2 * parentIndex + 1
+            let rightIndex = leftIndex + 1
+            var minIndex = parentIndex
+            if leftIndex < elements.count, elements[leftIndex] < elements[minIndex] {
+                minIndex = leftIndex
+            }
+            if rightIndex < elements.count, elements[rightIndex] < elements[minIndex] {
+                minIndex = rightIndex
+            }
+            guard minIndex != parentIndex else {
+                return
+            }
+            elements.swapAt(parentIndex, minIndex)
+            parentIndex = minIndex
+        }
+    }
+}
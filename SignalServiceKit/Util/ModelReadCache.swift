@@ -4,6 +4,7 @@
 //
 
 import Foundation
+import GRDB
 
 // MARK: -
 
@@ -50,6 +51,23 @@ class ModelCacheAdapter<KeyType: Hashable & Equatable, ValueType> {
         fatalError("Unimplemented")
     }
 
+    /// If true, the cache stores its own copy of every value added to it, so
+    /// no caller holds the instances it hands out with `copiesValues: false`.
+    /// Only worth it when `copy(value:)` is cheap, since it runs on every
+    /// write and every cache miss.
+    var storesOwnCopies: Bool { false }
+
+    /// The table that values are read from. If nil, the cache is evacuated
+    /// after every cross process write.
+    var tableName: String? { nil }
+
+    /// Returns the keys for the values stored in `rowIds` of `tableName`, or
+    /// nil if we can't tell, in which case the cache is evacuated after cross
+    /// process writes to `tableName`.
+    func keys(forRowIds rowIds: Set<Int64>, transaction: SDSAnyReadTransaction) -> [KeyType]? {
+        return nil
+    }
+
     let cacheName: String
 
     let cacheCountLimit: Int
@@ -64,6 +82,22 @@ class ModelCacheAdapter<KeyType: Hashable & Equatable, ValueType> {
 
 // MARK: -
 
+public struct ModelReadCacheCounters: Equatable {
+    public var hits: UInt64 = 0
+    public var misses: UInt64 = 0
+    /// Keys removed because their rows changed in another process.
+    public var evictions: UInt64 = 0
+    /// Times the entire cache was discarded.
+    public var fullEvacuations: UInt64 = 0
+
+    public var hitRate: Double {
+        let total = hits + misses
+        return total > 0 ? Double(hits) / Double(total) : 0
+    }
+}
+
+// MARK: -
+
 class ModelReadCache<KeyType: Hashable & Equatable, ValueType>: Dependencies, CacheSizeLeasing {
 
     enum Mode {
@@ -108,11 +142,19 @@ class ModelReadCache<KeyType: Hashable & Equatable, ValueType>: Dependencies, Ca
 
     private var leases = NSHashTable<ModelReadCacheSizeLease>.weakObjects()
 
+    // This should only be accessed within performSync().
+    private var _counters = ModelReadCacheCounters()
+
+    var counters: ModelReadCacheCounters {
+        performSync { _counters }
+    }
+
     init(mode: Mode, adapter: ModelCacheAdapter<KeyType, ValueType>) {
         self.mode = mode
         self.adapter = adapter
         self.cache = LRUCache(maxSize: adapter.cacheCountLimit,
                               nseMaxSize: disableCachesInNSE ? 0 : adapter.cacheCountLimitNSE)
+        MemoryProfiler.shared.registerCache(cache, named: "ModelReadCache.\(adapter.cacheName)")
 
         switch mode {
         case .read:
@@ -141,6 +183,7 @@ class ModelReadCache<KeyType: Hashable & Equatable, ValueType>: Dependencies, Ca
         DispatchQueue.global().async {
             self.performSync {
                 self.cache.removeAllObjects()
+                self._counters.fullEvacuations += 1
             }
         }
     }
@@ -150,11 +193,52 @@ class ModelReadCache<KeyType: Hashable & Equatable, ValueType>: Dependencies, Ca
         evacuateCache()
     }
 
+    private func evacuate(keys: [KeyType]) {
+        guard !keys.isEmpty else {
+            return
+        }
+
+        for key in keys {
+            cache.removeObject(forKey: key)
+        }
+
+        DispatchQueue.global().async {
+            self.performSync {
+                for key in keys {
+                    self.cache.removeObject(forKey: key)
+                }
+                self._counters.evictions += UInt64(keys.count)
+            }
+        }
+    }
+
+    /// Beyond this many changed rows, it's cheaper to evacuate everything.
+    private static var maxTargetedEvacuationCount: Int { 64 }
+
     @objc
     private func didReceiveCrossProcessNotification(_ notification: Notification) {
         AssertIsOnMainThread()
         assert(mode == .read)
-        evacuateCache()
+
+        guard
+            isAppReady,
+            let changes = notification.userInfo?[SDSDatabaseStorage.crossProcessChangesKey] as? CrossProcessDatabaseChanges,
+            let tableName = adapter.tableName
+        else {
+            evacuateCache()
+            return
+        }
+        guard changes.didUpdate(tableName: tableName) else {
+            return
+        }
+        guard
+            let rowIds = changes.updatedRowIds(tableName: tableName, limit: Self.maxTargetedEvacuationCount),
+            let keys = databaseStorage.read(block: { adapter.keys(forRowIds: rowIds, transaction: $0) })
+        else {
+            evacuateCache()
+            return
+        }
+        evacuate(keys: keys)
     }
 
     #if TESTABLE_BUILD
@@ -220,9 +304,15 @@ class ModelReadCache<KeyType: Hashable & Equatable, ValueType>: Dependencies, Ca
         return getValues(for: [cacheKey], transaction: transaction, returnNilOnCacheMiss: returnNilOnCacheMiss)[0]
     }
 
+    /// - Parameter copiesValues: If false, cached values are returned
+    /// without copying them. Callers must treat them as read-only and copy
+    /// one before changing it. Requires an adapter that `storesOwnCopies`.
     func getValues(for cacheKeys: [ModelCacheKey<KeyType>],
                    transaction: SDSAnyReadTransaction,
-                   returnNilOnCacheMiss: Bool = false) -> [ValueType?] {
+                   returnNilOnCacheMiss: Bool = false,
+                   copiesValues: Bool = true) -> [ValueType?] {
+        owsAssertDebug(copiesValues || adapter.storesOwnCopies)
+
         // This can be used to verify that cached values exactly
         // align with database contents.
         #if TESTABLE_BUILD
@@ -235,36 +325,24 @@ class ModelReadCache<KeyType: Hashable & Equatable, ValueType>: Dependencies, Ca
         }
         #endif
 
-        return performSync {
+        let (values, isCachedValue) = performSync { () -> ([ValueType?], [Bool]) in
             let maybeValues = self.cachedValues(for: cacheKeys, transaction: transaction)
             let keyValueTuples = Array(zip(cacheKeys, maybeValues))
             typealias KeyValuePair = (ModelCacheKey<KeyType>, ModelCacheValueBox<ValueType>?)
-            return Refinery<KeyValuePair, ValueType>(keyValueTuples).refine { (entry: KeyValuePair) -> Bool in
+            let values = Refinery<KeyValuePair, ValueType>(keyValueTuples).refine { (entry: KeyValuePair) -> Bool in
                 return entry.1 != nil
             } then: { (entries: AnySequence<KeyValuePair>) -> [ValueType?] in
                 //  Have an entry in maybeValues, although it could be nil.
                 return entries.map { tuple in
                     let (key, cachedValue) = (tuple.0, tuple.1!)
 
-                    if let value = cachedValue.value {
-                        // Return a copy of the model.
-                        let cachedValue = self.copyValue(value)
-
-                        #if TESTABLE_BUILD
-                        if shouldCheckValues {
-                            checkValues(key, cachedValue)
-                        }
-                        #endif
-
-                        return cachedValue
-                    }
                     #if TESTABLE_BUILD
                     if shouldCheckValues {
-                        checkValues(key, nil)
+                        checkValues(key, cachedValue.value)
                     }
                     #endif
 
-                    return nil
+                    return cachedValue.value
                 }
             } otherwise: { tuples -> [ValueType?] in
                 // Have no cache entry.
@@ -275,14 +353,30 @@ class ModelReadCache<KeyType: Hashable & Equatable, ValueType>: Dependencies, Ca
                 let keys = tuples.lazy.map { $0.0 }
                 return self.readValues(for: AnySequence(keys), transaction: transaction)
             }.values
+
+            let isCachedValue = maybeValues.map { $0 != nil }
+            let hitCount = isCachedValue.lazy.filter { $0 }.count
+            self._counters.hits += UInt64(hitCount)
+            self._counters.misses += UInt64(isCachedValue.count - hitCount)
+            return (values, isCachedValue)
+        }
+
+        // Cached models are shared, so callers get a copy. Copying can be
+        // expensive (e.g. a deep copy), so it's done without holding the lock.
+        return zip(values, isCachedValue).map { value, isCachedValue in
+            guard let value, isCachedValue, copiesValues || !adapter.storesOwnCopies else {
+                return value
+            }
+            return self.copyValue(value)
         }
     }
 
     func getValuesIfInCache(for keys: [KeyType], transaction: SDSAnyReadTransaction) -> [KeyType: ValueType] {
+        let cacheKeys = keys.map { adapter.cacheKey(forKey: $0) }
+        let values = getValues(for: cacheKeys, transaction: transaction, returnNilOnCacheMiss: true)
         var result = [KeyType: ValueType]()
-        for key in keys {
-            let cacheKey = adapter.cacheKey(forKey: key)
-            if let value = getValue(for: cacheKey, transaction: transaction, returnNilOnCacheMiss: true) {
+        for (key, value) in zip(keys, values) {
+            if let value {
                 result[key] = value
             }
         }
@@ -403,7 +497,10 @@ class ModelReadCache<KeyType: Hashable & Equatable, ValueType>: Dependencies, Ca
     // MARK: -
 
     func writeToCache(cacheKey: ModelCacheKey<KeyType>, value: ValueType?) {
-        cache.setObject(ModelCacheValueBox(value: value), forKey: cacheKey.key)
+        // The value passed in belongs to whoever read or wrote it, and they
+        // may go on to change it.
+        let valueToStore = adapter.storesOwnCopies ? value.flatMap { copyValue($0) } : value
+        cache.setObject(ModelCacheValueBox(value: valueToStore), forKey: cacheKey.key)
     }
 
     func readFromCache(cacheKey: ModelCacheKey<KeyType>) -> ModelCacheValueBox<ValueType>? {
@@ -542,6 +639,8 @@ public class UserProfileReadCache: NSObject {
             return modelCopy
         }
 
+        override var storesOwnCopies: Bool { true }
+
         override func read(keys: [KeyType], transaction tx: SDSAnyReadTransaction) -> [ValueType?] {
             return OWSUserProfile.getUserProfiles(for: keys, tx: tx)
         }
@@ -556,6 +655,8 @@ public class UserProfileReadCache: NSObject {
         cache = factory.create(mode: .read, adapter: adapter)
     }
 
+    public var counters: ModelReadCacheCounters { cache.counters }
+
     @objc(didRemoveUserProfile:transaction:)
     public func didRemove(userProfile: OWSUserProfile, transaction: SDSAnyWriteTransaction) {
         cache.didRemove(value: userProfile, transaction: transaction)
@@ -583,6 +684,16 @@ public class UserProfileReadCache: NSObject {
         let cacheKeys = addresses.map { self.adapter.cacheKey(forKey: $0) }
         return cache.getValues(for: cacheKeys, transaction: transaction)
     }
+
+    /// Like `getUserProfiles`, but cached profiles are shared rather than
+    /// copied. They must not be changed; `shallowCopy()` one first.
+    public func getReadOnlyUserProfiles(
+        for addresses: some Sequence<OWSUserProfile.Address>,
+        transaction: SDSAnyReadTransaction
+    ) -> [OWSUserProfile?] {
+        let cacheKeys = addresses.map { self.adapter.cacheKey(forKey: $0) }
+        return cache.getValues(for: cacheKeys, transaction: transaction, copiesValues: false)
+    }
 }
 
 // MARK: -
@@ -619,6 +730,8 @@ public class SignalAccountReadCache: NSObject {
             }
             return modelCopy
         }
+
+        override var tableName: String? { SignalAccount.databaseTableName }
     }
 
     private let cache: ModelReadCache<KeyType, ValueType>
@@ -629,6 +742,8 @@ public class SignalAccountReadCache: NSObject {
         cache = factory.create(mode: .read, adapter: adapter)
     }
 
+    public var counters: ModelReadCacheCounters { cache.counters }
+
     @objc
     public func getSignalAccount(phoneNumber: String, transaction: SDSAnyReadTransaction) -> SignalAccount? {
         let cacheKey = adapter.cacheKey(forKey: phoneNumber)
@@ -689,6 +804,18 @@ public class ThreadReadCache: NSObject {
         override func copy(value: ValueType) throws -> ValueType {
             return try DeepCopies.deepCopy(value)
         }
+
+        override func read(keys: [KeyType], transaction: SDSAnyReadTransaction) -> [ValueType?] {
+            return fetchModels(uniqueIds: keys, tableName: ThreadRecord.databaseTableName, transaction: transaction) {
+                TSThread.grdbFetchCursor(sql: $0, arguments: $1, transaction: $2)
+            } ?? super.read(keys: keys, transaction: transaction)
+        }
+
+        override var tableName: String? { ThreadRecord.databaseTableName }
+
+        override func keys(forRowIds rowIds: Set<Int64>, transaction: SDSAnyReadTransaction) -> [KeyType]? {
+            return fetchUniqueIds(tableName: ThreadRecord.databaseTableName, rowIds: rowIds, transaction: transaction)
+        }
     }
 
     private let cache: ModelReadCache<KeyType, ValueType>
@@ -699,6 +826,8 @@ public class ThreadReadCache: NSObject {
         cache = factory.create(mode: .read, adapter: adapter)
     }
 
+    public var counters: ModelReadCacheCounters { cache.counters }
+
     @objc(getThreadForUniqueId:transaction:)
     public func getThread(uniqueId: String, transaction: SDSAnyReadTransaction) -> TSThread? {
         let cacheKey = adapter.cacheKey(forKey: uniqueId)
@@ -755,6 +884,18 @@ public class InteractionReadCache: NSObject {
         override func copy(value: ValueType) throws -> ValueType {
             return try DeepCopies.deepCopy(value)
         }
+
+        override func read(keys: [KeyType], transaction: SDSAnyReadTransaction) -> [ValueType?] {
+            return fetchModels(uniqueIds: keys, tableName: InteractionRecord.databaseTableName, transaction: transaction) {
+                TSInteraction.grdbFetchCursor(sql: $0, arguments: $1, transaction: $2)
+            } ?? super.read(keys: keys, transaction: transaction)
+        }
+
+        override var tableName: String? { InteractionRecord.databaseTableName }
+
+        override func keys(forRowIds rowIds: Set<Int64>, transaction: SDSAnyReadTransaction) -> [KeyType]? {
+            return fetchUniqueIds(tableName: InteractionRecord.databaseTableName, rowIds: rowIds, transaction: transaction)
+        }
     }
 
     private let cache: ModelReadCache<KeyType, ValueType>
@@ -765,6 +906,8 @@ public class InteractionReadCache: NSObject {
         cache = factory.create(mode: .read, adapter: adapter)
     }
 
+    public var counters: ModelReadCacheCounters { cache.counters }
+
     @objc(getInteractionForUniqueId:transaction:)
     public func getInteraction(uniqueId: String, transaction: SDSAnyReadTransaction) -> TSInteraction? {
         let cacheKey = adapter.cacheKey(forKey: uniqueId)
@@ -775,6 +918,12 @@ public class InteractionReadCache: NSObject {
         return cache.getValuesIfInCache(for: uniqueIds, transaction: transaction)
     }
 
+    /// Reads any of the interactions that aren't cached into the cache, so
+    /// that loading them soon (e.g. in the conversation view) is quick.
+    public func prefetchInteractions(uniqueIds: [String], transaction: SDSAnyReadTransaction) {
+        _ = cache.getValues(for: uniqueIds.map { adapter.cacheKey(forKey: $0) }, transaction: transaction)
+    }
+
     @objc(didRemoveInteraction:transaction:)
     public func didRemove(interaction: TSInteraction, transaction: SDSAnyWriteTransaction) {
         cache.didRemove(value: interaction, transaction: transaction)
@@ -820,6 +969,18 @@ public class AttachmentReadCache: NSObject {
         override func copy(value: ValueType) throws -> ValueType {
             return try DeepCopies.deepCopy(value)
         }
+
+        override func read(keys: [KeyType], transaction: SDSAnyReadTransaction) -> [ValueType?] {
+            return fetchModels(uniqueIds: keys, tableName: AttachmentRecord.databaseTableName, transaction: transaction) {
+                TSAttachment.grdbFetchCursor(sql: $0, arguments: $1, transaction: $2)
+            } ?? super.read(keys: keys, transaction: transaction)
+        }
+
+        override var tableName: String? { AttachmentRecord.databaseTableName }
+
+        override func keys(forRowIds rowIds: Set<Int64>, transaction: SDSAnyReadTransaction) -> [KeyType]? {
+            return fetchUniqueIds(tableName: AttachmentRecord.databaseTableName, rowIds: rowIds, transaction: transaction)
+        }
     }
 
     private let cache: ModelReadCache<KeyType, ValueType>
@@ -830,6 +991,8 @@ public class AttachmentReadCache: NSObject {
         cache = factory.create(mode: .read, adapter: adapter)
     }
 
+    public var counters: ModelReadCacheCounters { cache.counters }
+
     @objc(getAttachmentForUniqueId:transaction:)
     public func getAttachment(uniqueId: String, transaction: SDSAnyReadTransaction) -> TSAttachment? {
         let cacheKey = adapter.cacheKey(forKey: uniqueId)
@@ -875,7 +1038,20 @@ public class InstalledStickerCache: NSObject {
         }
 
         override func copy(value: ValueType) throws -> ValueType {
-            return try DeepCopies.deepCopy(value)
+            // InstalledSticker is immutable, so it's safe to share.
+            return value
+        }
+
+        override func read(keys: [KeyType], transaction: SDSAnyReadTransaction) -> [ValueType?] {
+            return fetchModels(uniqueIds: keys, tableName: InstalledStickerRecord.databaseTableName, transaction: transaction) {
+                InstalledSticker.grdbFetchCursor(sql: $0, arguments: $1, transaction: $2)
+            } ?? super.read(keys: keys, transaction: transaction)
+        }
+
+        override var tableName: String? { InstalledStickerRecord.databaseTableName }
+
+        override func keys(forRowIds rowIds: Set<Int64>, transaction: SDSAnyReadTransaction) -> [KeyType]? {
+            return fetchUniqueIds(tableName: InstalledStickerRecord.databaseTableName, rowIds: rowIds, transaction: transaction)
         }
     }
 
@@ -898,6 +1074,8 @@ public class InstalledStickerCache: NSObject {
         cache = factory.create(mode: .read, adapter: adapter)
     }
 
+    public var counters: ModelReadCacheCounters { cache.counters }
+
     @objc(getInstalledStickerForUniqueId:transaction:)
     public func getInstalledSticker(uniqueId: String, transaction: SDSAnyReadTransaction) -> InstalledSticker? {
         let cacheKey = adapter.cacheKey(forKey: uniqueId)
@@ -922,6 +1100,134 @@ public class InstalledStickerCache: NSObject {
 
 // MARK: -
 
+@objc
+public class RecipientIdentityReadCache: NSObject {
+    typealias KeyType = String
+    typealias ValueType = OWSRecipientIdentity
+
+    private class Adapter: ModelCacheAdapter<KeyType, ValueType> {
+        override func read(key: KeyType, transaction: SDSAnyReadTransaction) -> ValueType? {
+            return OWSRecipientIdentity.anyFetch(uniqueId: key,
+                                                 transaction: transaction,
+                                                 ignoreCache: true)
+        }
+
+        override func key(forValue value: ValueType) -> KeyType {
+            value.uniqueId
+        }
+
+        override func cacheKey(forKey key: KeyType) -> ModelCacheKey<KeyType> {
+            return ModelCacheKey(key: key)
+        }
+
+        override func copy(value: ValueType) throws -> ValueType {
+            // We don't need to use a deepCopy for OWSRecipientIdentity.
+            guard let modelCopy = value.copy() as? OWSRecipientIdentity else {
+                throw OWSAssertionError("Copy failed.")
+            }
+            return modelCopy
+        }
+
+        override func read(keys: [KeyType], transaction: SDSAnyReadTransaction) -> [ValueType?] {
+            return fetchModels(uniqueIds: keys, tableName: RecipientIdentityRecord.databaseTableName, transaction: transaction) {
+                OWSRecipientIdentity.grdbFetchCursor(sql: $0, arguments: $1, transaction: $2)
+            } ?? super.read(keys: keys, transaction: transaction)
+        }
+
+        override var tableName: String? { RecipientIdentityRecord.databaseTableName }
+
+        override func keys(forRowIds rowIds: Set<Int64>, transaction: SDSAnyReadTransaction) -> [KeyType]? {
+            return fetchUniqueIds(tableName: RecipientIdentityRecord.databaseTableName, rowIds: rowIds, transaction: transaction)
+        }
+    }
+
+    private let cache: ModelReadCache<KeyType, ValueType>
+    // Large enough to hold the members of a large group, so that sending to
+    // it doesn't read every member's identity from the database each time.
+    private let adapter = Adapter(cacheName: "OWSRecipientIdentity", cacheCountLimit: 1024, cacheCountLimitNSE: 32)
+
+    @objc
+    public init(_ factory: ModelReadCacheFactory) {
+        cache = factory.create(mode: .read, adapter: adapter)
+    }
+
+    public var counters: ModelReadCacheCounters { cache.counters }
+
+    /// Keyed by the uniqueId of the SignalRecipient, which is also the
+    /// uniqueId of its OWSRecipientIdentity.
+    @objc(getRecipientIdentityForUniqueId:transaction:)
+    public func getRecipientIdentity(uniqueId: String, transaction: SDSAnyReadTransaction) -> OWSRecipientIdentity? {
+        let cacheKey = adapter.cacheKey(forKey: uniqueId)
+        return cache.getValue(for: cacheKey, transaction: transaction)
+    }
+
+    @objc(didRemoveRecipientIdentity:transaction:)
+    public func didRemove(recipientIdentity: OWSRecipientIdentity, transaction: SDSAnyWriteTransaction) {
+        cache.didRemove(value: recipientIdentity, transaction: transaction)
+    }
+
+    @objc(didInsertOrUpdateRecipientIdentity:transaction:)
+    public func didInsertOrUpdate(recipientIdentity: OWSRecipientIdentity, transaction: SDSAnyWriteTransaction) {
+        cache.didInsertOrUpdate(value: recipientIdentity, transaction: transaction)
+    }
+
+    @objc
+    public func didReadRecipientIdentity(_ recipientIdentity: OWSRecipientIdentity, transaction: SDSAnyReadTransaction) {
+        cache.didRead(value: recipientIdentity, transaction: transaction)
+    }
+
+    @objc
+    public func leaseCacheSize(_ size: Int) -> ModelReadCacheSizeLease {
+        return ModelReadCacheSizeLease(size, model: cache)
+    }
+}
+
+// MARK: -
+
+/// Maps `rowIds` to the uniqueIds of the corresponding models, for caches keyed
+/// by uniqueId. Returns nil if the lookup fails.
+private func fetchUniqueIds(tableName: String, rowIds: Set<Int64>, transaction: SDSAnyReadTransaction) -> [String]? {
+    guard !rowIds.isEmpty else {
+        return []
+    }
+    let sql = "SELECT uniqueId FROM \(tableName) WHERE rowid IN (\(rowIds.map { String($0) }.joined(separator: ", ")))"
+    do {
+        return try String.fetchAll(transaction.unwrapGrdbRead.database, sql: sql)
+    } catch {
+        owsFailDebug("Couldn't fetch uniqueIds: \(error.grdbErrorForLogging)")
+        return nil
+    }
+}
+
+/// Fetches the models for `uniqueIds` from `tableName` with one query per
+/// chunk of keys, rather than one query per key. Returns nil if the lookup
+/// fails.
+private func fetchModels<Cursor: SDSCursor>(
+    uniqueIds: [String],
+    tableName: String,
+    transaction: SDSAnyReadTransaction,
+    fetchCursor: (String, StatementArguments, GRDBReadTransaction) -> Cursor
+) -> [Cursor.Model?]? {
+    // Stay well under SQLite's limit on the number of bound arguments.
+    let maxKeysPerQuery = 500
+    var modelsByUniqueId = [String: Cursor.Model]()
+    do {
+        for batch in uniqueIds.chunked(by: maxKeysPerQuery) {
+            let sql = "SELECT * FROM \(tableName) WHERE uniqueId IN (\(batch.lazy.map { _ in "?" }.joined(separator: ", ")))"
+            var cursor = fetchCursor(sql, StatementArguments(Array(batch)), transaction.unwrapGrdbRead)
+            while let model = try cursor.next() {
+                modelsByUniqueId[model.uniqueId] = model
+            }
+        }
+    } catch {
+        owsFailDebug("Couldn't fetch models: \(error.grdbErrorForLogging)")
+        return nil
+    }
+    return uniqueIds.map { modelsByUniqueId[$0] }
+}
+
+// MARK: -
+
 protocol CacheSizeLeasing: AnyObject {
     func add(lease: ModelReadCacheSizeLease)
     func remove(lease: ModelReadCacheSizeLease)
@@ -963,6 +1269,7 @@ public class ModelReadCaches: NSObject {
         interactionReadCache = InteractionReadCache(factory)
         attachmentReadCache = AttachmentReadCache(factory)
         installedStickerCache = InstalledStickerCache(factory)
+        recipientIdentityReadCache = RecipientIdentityReadCache(factory)
     }
 
     @objc
@@ -977,6 +1284,8 @@ public class ModelReadCaches: NSObject {
     public let attachmentReadCache: AttachmentReadCache
     @objc
     public let installedStickerCache: InstalledStickerCache
+    @objc
+    public let recipientIdentityReadCache: RecipientIdentityReadCache
 
     @objc
     fileprivate static let evacuateAllModelCaches = Notification.Name("EvacuateAllModelCaches")
@@ -985,6 +1294,22 @@ public class ModelReadCaches: NSObject {
     public func evacuateAllCaches() {
         NotificationCenter.default.post(name: Self.evacuateAllModelCaches, object: nil)
     }
+
+    @objc
+    public func logCounters() {
+        let countersByName: [(String, ModelReadCacheCounters)] = [
+            ("UserProfile", userProfileReadCache.counters),
+            ("SignalAccount", signalAccountReadCache.counters),
+            ("TSThread", threadReadCache.counters),
+            ("TSInteraction", interactionReadCache.counters),
+            ("TSAttachment", attachmentReadCache.counters),
+            ("InstalledSticker", installedStickerCache.counters),
+            ("OWSRecipientIdentity", recipientIdentityReadCache.counters),
+        ]
+        for (name, counters) in countersByName {
+            Logger.info("\(name): hits: \(counters.hits), misses: \(counters.misses), hitRate: \(String(format: "%.2f", counters.hitRate)), evictions: \(counters.evictions), fullEvacuations: \(counters.fullEvacuations)")
+        }
+    }
 }
 
 class TestableModelReadCache<KeyType: Hashable & Equatable, ValueType>: ModelReadCache<KeyType, ValueType> {
@@ -73,7 +73,7 @@ public class Preferences: NSObject {
     }
 
     private static let preferencesCollection = "SignalPreferences"
-    private let keyValueStore = SDSKeyValueStore(collection: Preferences.preferencesCollection)
+    private let keyValueStore = SDSKeyValueStore(collection: Preferences.preferencesCollection, cachesValues: true)
 
     public override init() {
         super.init()
@@ -23,6 +23,13 @@ import Foundation
 // * The flag can be used in various "queue modes". "App readiness"
 //   blocks should be enqueued and performed on the main thread.
 //   Other flags will want to do their work off the main thread.
+// * "Did become ready in background" blocks are performed on a
+//   concurrent background queue, alongside the main thread blocks.
+// * Blocks with a lower priority value are performed first; blocks
+//   with the same priority are performed in the order they were
+//   enqueued.
+// * Once every block enqueued before the flag was set has run, their
+//   durations are logged, slowest first.
 @objc
 public class ReadyFlag: NSObject {
 
@@ -40,11 +47,15 @@ public class ReadyFlag: NSObject {
             label ?? "unknown"
         }
 
+        /// Sorts by priority, keeping tasks with the same priority in the
+        /// order they were enqueued.
         static func sort(_ tasks: [ReadyTask]) -> [ReadyTask] {
-            tasks.sorted { (left, right) -> Bool in
-                // TODO: Verify correctness.
-                left.priority <= right.priority
-            }
+            tasks.enumerated().sorted { (left, right) -> Bool in
+                if left.element.priority != right.element.priority {
+                    return left.element.priority < right.element.priority
+                }
+                return left.offset < right.offset
+            }.map { $0.element }
         }
     }
 
@@ -54,6 +65,13 @@ public class ReadyFlag: NSObject {
 
     private static let blockLogDuration: TimeInterval = 0.01
     private static let groupLogDuration: TimeInterval = 0.1
+    private static let maxSummaryTaskCount = 10
+
+    private let backgroundQueue = DispatchQueue(
+        label: "org.signal.ready-flag.background",
+        qos: .utility,
+        attributes: .concurrent
+    )
 
     // This property should only be set with unfairLock.
     // It can be read from any queue.
@@ -68,6 +86,9 @@ public class ReadyFlag: NSObject {
     // This property should only be accessed with unfairLock.
     private var didBecomeReadyAsyncTasks = [ReadyTask]()
 
+    // This property should only be accessed with unfairLock.
+    private var didBecomeReadyBackgroundTasks = [ReadyTask]()
+
     @objc
     public init(name: String) {
         self.name = name
@@ -172,6 +193,33 @@ public class ReadyFlag: NSObject {
         }
     }
 
+    /// Performs `readyBlock` on a background queue, concurrently with other
+    /// blocks. It must not touch UIKit or any other main-thread-only state.
+    public func runNowOrWhenDidBecomeReadyInBackground(_ readyBlock: @escaping ReadyBlock,
+                                                       label: String? = nil,
+                                                       priority: Priority? = nil) {
+        AssertIsOnMainThread()
+
+        let priority = priority ?? Self.defaultPriority
+        let task = ReadyTask(label: label, priority: priority, block: readyBlock)
+
+        let didEnqueue: Bool = {
+            unfairLock.withLock {
+                guard !isSet else {
+                    return false
+                }
+                didBecomeReadyBackgroundTasks.append(task)
+                return true
+            }
+        }()
+
+        if !didEnqueue {
+            backgroundQueue.async {
+                self.perform(task, kind: "didBecomeReadyBackground", timings: nil)
+            }
+        }
+    }
+
     @objc
     public func setIsReady() {
         AssertIsOnMainThread()
@@ -185,19 +233,31 @@ public class ReadyFlag: NSObject {
         let willBecomeReadyTasks = ReadyTask.sort(tasksToPerform.willBecomeReadyTasks)
         let didBecomeReadySyncTasks = ReadyTask.sort(tasksToPerform.didBecomeReadySyncTasks)
         let didBecomeReadyAsyncTasks = ReadyTask.sort(tasksToPerform.didBecomeReadyAsyncTasks)
+        let didBecomeReadyBackgroundTasks = ReadyTask.sort(tasksToPerform.didBecomeReadyBackgroundTasks)
+
+        let timings = TaskTimings(
+            expectedCount: (
+                willBecomeReadyTasks.count
+                + didBecomeReadySyncTasks.count
+                + didBecomeReadyAsyncTasks.count
+                + didBecomeReadyBackgroundTasks.count
+            )
+        )
+
+        // Start the background blocks first so that they overlap with the
+        // main thread blocks.
+        for task in didBecomeReadyBackgroundTasks {
+            backgroundQueue.async {
+                self.perform(task, kind: "didBecomeReadyBackground", timings: timings)
+            }
+        }
 
         // We bench the blocks individually and as a group.
         BenchManager.bench(title: self.name + ".willBecomeReady group",
                            logIfLongerThan: Self.groupLogDuration,
                            logInProduction: true) {
             for task in willBecomeReadyTasks {
-                BenchManager.bench(title: self.name + ".willBecomeReady " + task.displayLabel,
-                                   logIfLongerThan: Self.blockLogDuration,
-                                   logInProduction: true) {
-                    autoreleasepool {
-                        task.block()
-                    }
-                }
+                perform(task, kind: "willBecomeReady", timings: timings)
             }
         }
 
@@ -205,23 +265,74 @@ public class ReadyFlag: NSObject {
                            logIfLongerThan: Self.groupLogDuration,
                            logInProduction: true) {
             for task in didBecomeReadySyncTasks {
-                BenchManager.bench(title: self.name + ".didBecomeReady " + task.displayLabel,
-                                   logIfLongerThan: Self.blockLogDuration,
-                                   logInProduction: true) {
-                    autoreleasepool {
-                        task.block()
-                    }
-                }
+                perform(task, kind: "didBecomeReady", timings: timings)
+            }
+        }
+
+        self.performDidBecomeReadyAsyncTasks(didBecomeReadyAsyncTasks, timings: timings)
+    }
+
+    private func perform(_ task: ReadyTask, kind: String, timings: TaskTimings?) {
+        let startTime = CACurrentMediaTime()
+        BenchManager.bench(title: self.name + "." + kind + " " + task.displayLabel,
+                           logIfLongerThan: Self.blockLogDuration,
+                           logInProduction: true) {
+            autoreleasepool {
+                task.block()
             }
         }
+        guard let timings, let summary = timings.record(label: task.displayLabel, duration: CACurrentMediaTime() - startTime) else {
+            return
+        }
+        logSummary(summary)
+    }
+
+    private func logSummary(_ summary: TaskTimings.Summary) {
+        let slowestTasks = summary.durations
+            .sorted { $0.duration > $1.duration }
+            .prefix(Self.maxSummaryTaskCount)
+            .map { String(format: "%@ %.1fms", $0.label, $0.duration * 1000) }
+        Logger.info(String(
+            format: "%@: ran %d blocks in %.1fms (%.1fms total); slowest: %@",
+            self.name,
+            summary.durations.count,
+            summary.elapsed * 1000,
+            summary.durations.reduce(0) { $0 + $1.duration } * 1000,
+            slowestTasks.joined(separator: ", ")
+        ))
+    }
+
+    /// Collects the durations of the blocks that were waiting when the flag
+    /// was set, so they can be logged together once the last has run.
+    private final class TaskTimings {
+        struct Summary {
+            let durations: [(label: String, duration: TimeInterval)]
+            let elapsed: TimeInterval
+        }
+
+        private let expectedCount: Int
+        private let startTime = CACurrentMediaTime()
+        private let durations = AtomicValue<[(label: String, duration: TimeInterval)]>([], lock: .init())
+
+        init(expectedCount: Int) {
+            self.expectedCount = expectedCount
+        }
 
-        self.performDidBecomeReadyAsyncTasks(didBecomeReadyAsyncTasks)
+        /// Returns the summary when this is the last block to finish.
+        func record(label: String, duration: TimeInterval) -> Summary? {
+            let durations: [(label: String, duration: TimeInterval)]? = self.durations.update { durations in
+                durations.append((label, duration))
+                return durations.count == expectedCount ? durations : nil
+            }
+            return durations.map { Summary(durations: $0, elapsed: CACurrentMediaTime() - startTime) }
+        }
     }
 
     private struct TasksToPerform {
         let willBecomeReadyTasks: [ReadyTask]
         let didBecomeReadySyncTasks: [ReadyTask]
         let didBecomeReadyAsyncTasks: [ReadyTask]
+        let didBecomeReadyBackgroundTasks: [ReadyTask]
     }
 
     private func tryToSetFlag() -> TasksToPerform? {
@@ -232,20 +343,23 @@ public class ReadyFlag: NSObject {
                 owsAssertDebug(willBecomeReadyTasks.isEmpty)
                 owsAssertDebug(didBecomeReadySyncTasks.isEmpty)
                 owsAssertDebug(didBecomeReadyAsyncTasks.isEmpty)
+                owsAssertDebug(didBecomeReadyBackgroundTasks.isEmpty)
                 return nil
             }
 
             let tasksToPerform = TasksToPerform(willBecomeReadyTasks: self.willBecomeReadyTasks,
                                                 didBecomeReadySyncTasks: self.didBecomeReadySyncTasks,
-                                                didBecomeReadyAsyncTasks: self.didBecomeReadyAsyncTasks)
+                                                didBecomeReadyAsyncTasks: self.didBecomeReadyAsyncTasks,
+                                                didBecomeReadyBackgroundTasks: self.didBecomeReadyBackgroundTasks)
             self.willBecomeReadyTasks = []
             self.didBecomeReadySyncTasks = []
             self.didBecomeReadyAsyncTasks = []
+            self.didBecomeReadyBackgroundTasks = []
             return tasksToPerform
         }
     }
 
-    private func performDidBecomeReadyAsyncTasks(_ tasks: [ReadyTask]) {
+    private func performDidBecomeReadyAsyncTasks(_ tasks: [ReadyTask], timings: TaskTimings) {
         DispatchQueue.main.asyncAfter(deadline: DispatchTime.now() + 0.025) { [weak self] in
             guard let self = self else {
                 return
@@ -253,13 +367,10 @@ public class ReadyFlag: NSObject {
             guard let task = tasks.first else {
                 return
             }
-            BenchManager.bench(title: self.name + ".didBecomeReadyPolite " + task.displayLabel,
-                               logIfLongerThan: Self.blockLogDuration,
-                               logInProduction: true,
-                               block: task.block)
+            self.perform(task, kind: "didBecomeReadyPolite", timings: timings)
 
             let remainder = Array(tasks.suffix(from: 1))
-            self.performDidBecomeReadyAsyncTasks(remainder)
+            self.performDidBecomeReadyAsyncTasks(remainder, timings: timings)
         }
     }
 }
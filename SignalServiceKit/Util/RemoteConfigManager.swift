@@ -7,6 +7,12 @@ import CryptoKit
 import Foundation
 import LibSignalClient
 
+/// An immutable snapshot of the remote config.
+///
+/// A snapshot is built each time the config is loaded or fetched, and every
+/// flag is parsed then, so reading one is a field load rather than a
+/// dictionary lookup and string parsing. Callers that read several flags (or
+/// read them in a loop) can hold on to `RemoteConfig.current`.
 public class RemoteConfig {
 
     public static var current: RemoteConfig {
@@ -34,6 +40,45 @@ public class RemoteConfig {
     public let sepaEnabledRegions: PhoneNumberRegions
     public let idealEnabledRegions: PhoneNumberRegions
 
+    public let groupsV2MaxGroupSizeRecommended: UInt
+    public let groupsV2MaxGroupSizeHardLimit: UInt
+    public let cdsSyncInterval: TimeInterval
+    public let automaticSessionResetKillSwitch: Bool
+    public let automaticSessionResetAttemptInterval: TimeInterval
+    public let reactiveProfileKeyAttemptInterval: TimeInterval
+    public let paymentsResetKillSwitch: Bool
+    public let canDonateOneTimeWithApplePay: Bool
+    public let canDonateGiftWithApplePay: Bool
+    public let canDonateMonthlyWithApplePay: Bool
+    public let canDonateOneTimeWithCreditOrDebitCard: Bool
+    public let canDonateGiftWithCreditOrDebitCard: Bool
+    public let canDonateMonthlyWithCreditOrDebitCard: Bool
+    public let canDonateOneTimeWithPaypal: Bool
+    public let canDonateGiftWithPayPal: Bool
+    public let canDonateMonthlyWithPaypal: Bool
+    public let messageResendKillSwitch: Bool
+    public let replaceableInteractionExpiration: TimeInterval
+    public let messageSendLogEntryLifetime: TimeInterval
+    public let maxGroupCallRingSize: UInt
+    public let enableAutoAPNSRotation: Bool
+    /// The minimum length for a valid nickname, in Unicode codepoints.
+    public let minNicknameLength: UInt32
+    /// The maximum length for a valid nickname, in Unicode codepoints.
+    public let maxNicknameLength: UInt32
+    public let maxAttachmentDownloadSizeBytes: UInt
+    public let enableGifSearch: Bool
+    public let shouldCheckForServiceExtensionFailures: Bool
+    public let backgroundRefreshInterval: TimeInterval
+    public let experimentalTransportShadowingHigh: Bool
+    public let cdsiLookupWithLibsignal: Bool
+    /// The time a linked device may be offline before it expires and is
+    /// unlinked.
+    public let linkedDeviceLifespan: TimeInterval
+    public let callLinkJoin: Bool
+
+    /// The `<calling-code>:<value>` pairs of `standardMediaQualityLevel`.
+    private let standardMediaQualityLevels: [String: String]
+
     init(
         clockSkew: TimeInterval,
         isEnabledFlags: [String: Bool],
@@ -50,12 +95,62 @@ public class RemoteConfig {
         self.paypalDisabledRegions = Self.parsePhoneNumberRegions(valueFlags: valueFlags, flag: .paypalDisabledRegions)
         self.sepaEnabledRegions = Self.parsePhoneNumberRegions(valueFlags: valueFlags, flag: .sepaEnabledRegions)
         self.idealEnabledRegions = Self.parsePhoneNumberRegions(valueFlags: valueFlags, flag: .idealEnabledRegions)
-    }
 
-    fileprivate static var emptyConfig: RemoteConfig {
-        RemoteConfig(clockSkew: 0, isEnabledFlags: [:], valueFlags: [:], timeGatedFlags: [:])
+        func isEnabled(_ flag: IsEnabledFlag, defaultValue: Bool = false) -> Bool {
+            return isEnabledFlags[flag.rawValue] ?? defaultValue
+        }
+        func value<V: LosslessStringConvertible>(_ flag: ValueFlag, defaultValue: V) -> V {
+            return RemoteConfig.parseValue(valueFlags: valueFlags, flag: flag, defaultValue: defaultValue)
+        }
+        func interval(_ flag: ValueFlag, defaultInterval: TimeInterval) -> TimeInterval {
+            guard let intervalString = valueFlags[flag.rawValue], let interval = TimeInterval(intervalString) else {
+                return defaultInterval
+            }
+            return interval
+        }
+
+        self.groupsV2MaxGroupSizeRecommended = value(.groupsV2MaxGroupSizeRecommended, defaultValue: 151)
+        self.groupsV2MaxGroupSizeHardLimit = value(.groupsV2MaxGroupSizeHardLimit, defaultValue: 1001)
+        self.cdsSyncInterval = interval(.cdsSyncInterval, defaultInterval: kDayInterval * 2)
+        self.automaticSessionResetKillSwitch = isEnabled(.automaticSessionResetKillSwitch)
+        self.automaticSessionResetAttemptInterval = interval(.automaticSessionResetAttemptInterval, defaultInterval: kHourInterval)
+        self.reactiveProfileKeyAttemptInterval = interval(.reactiveProfileKeyAttemptInterval, defaultInterval: kHourInterval)
+        self.paymentsResetKillSwitch = isEnabled(.paymentsResetKillSwitch)
+        self.canDonateOneTimeWithApplePay = !isEnabled(.applePayOneTimeDonationKillSwitch)
+        self.canDonateGiftWithApplePay = !isEnabled(.applePayGiftDonationKillSwitch)
+        self.canDonateMonthlyWithApplePay = !isEnabled(.applePayMonthlyDonationKillSwitch)
+        self.canDonateOneTimeWithCreditOrDebitCard = !isEnabled(.cardOneTimeDonationKillSwitch)
+        self.canDonateGiftWithCreditOrDebitCard = !isEnabled(.cardGiftDonationKillSwitch)
+        self.canDonateMonthlyWithCreditOrDebitCard = !isEnabled(.cardMonthlyDonationKillSwitch)
+        self.canDonateOneTimeWithPaypal = !isEnabled(.paypalOneTimeDonationKillSwitch)
+        self.canDonateGiftWithPayPal = !isEnabled(.paypalGiftDonationKillSwitch)
+        self.canDonateMonthlyWithPaypal = !isEnabled(.paypalMonthlyDonationKillSwitch)
+        self.messageResendKillSwitch = isEnabled(.messageResendKillSwitch)
+        self.replaceableInteractionExpiration = interval(.replaceableInteractionExpiration, defaultInterval: kHourInterval)
+        self.messageSendLogEntryLifetime = interval(.messageSendLogEntryLifetime, defaultInterval: 2 * kWeekInterval)
+        self.maxGroupCallRingSize = value(.maxGroupCallRingSize, defaultValue: 16)
+        self.enableAutoAPNSRotation = isEnabled(.enableAutoAPNSRotation, defaultValue: false)
+        self.minNicknameLength = value(.minNicknameLength, defaultValue: 3)
+        self.maxNicknameLength = value(.maxNicknameLength, defaultValue: 32)
+        self.maxAttachmentDownloadSizeBytes = value(.maxAttachmentDownloadSizeBytes, defaultValue: 100 * 1024 * 1024)
+        self.enableGifSearch = isEnabled(.enableGifSearch, defaultValue: true)
+        self.shouldCheckForServiceExtensionFailures = !isEnabled(.serviceExtensionFailureKillSwitch)
+        self.backgroundRefreshInterval = TimeInterval(value(.backgroundRefreshInterval, defaultValue: UInt(kDayInterval)))
+        self.experimentalTransportShadowingHigh = isEnabled(.experimentalTransportShadowingHigh, defaultValue: false)
+        self.cdsiLookupWithLibsignal = isEnabled(.cdsiLookupWithLibsignal, defaultValue: true)
+        self.linkedDeviceLifespan = interval(.linkedDeviceLifespanInterval, defaultInterval: kMonthInterval)
+        self.callLinkJoin = (
+            FeatureBuild.current == .dev
+            || FeatureBuild.current == .internal && isEnabled(.callLinkJoin)
+        )
+        self.standardMediaQualityLevels = RemoteConfig.parseCountryCodeValues(
+            csvString: valueFlags[ValueFlag.standardMediaQualityLevel.rawValue] ?? "",
+            csvDescription: ValueFlag.standardMediaQualityLevel.rawValue
+        )
     }
 
+    fileprivate static let emptyConfig = RemoteConfig(clockSkew: 0, isEnabledFlags: [:], valueFlags: [:], timeGatedFlags: [:])
+
     fileprivate func mergingHotSwappableFlags(from newConfig: RemoteConfig) -> RemoteConfig {
         var isEnabledFlags = self.isEnabledFlags
         for flag in IsEnabledFlag.allCases {
@@ -80,79 +175,13 @@ public class RemoteConfig {
         )
     }
 
-    public var groupsV2MaxGroupSizeRecommended: UInt {
-        getUIntValue(forFlag: .groupsV2MaxGroupSizeRecommended, defaultValue: 151)
-    }
-
-    public var groupsV2MaxGroupSizeHardLimit: UInt {
-        getUIntValue(forFlag: .groupsV2MaxGroupSizeHardLimit, defaultValue: 1001)
-    }
-
     public var groupsV2MaxBannedMembers: UInt {
         groupsV2MaxGroupSizeHardLimit
     }
 
-    public var cdsSyncInterval: TimeInterval {
-        interval(.cdsSyncInterval, defaultInterval: kDayInterval * 2)
-    }
-
-    public var automaticSessionResetKillSwitch: Bool {
-        return isEnabled(.automaticSessionResetKillSwitch)
-    }
-
-    public var automaticSessionResetAttemptInterval: TimeInterval {
-        interval(.automaticSessionResetAttemptInterval, defaultInterval: kHourInterval)
-    }
-
-    public var reactiveProfileKeyAttemptInterval: TimeInterval {
-        interval(.reactiveProfileKeyAttemptInterval, defaultInterval: kHourInterval)
-    }
-
-    public var paymentsResetKillSwitch: Bool {
-        isEnabled(.paymentsResetKillSwitch)
-    }
-
-    public var canDonateOneTimeWithApplePay: Bool {
-        !isEnabled(.applePayOneTimeDonationKillSwitch)
-    }
-
-    public var canDonateGiftWithApplePay: Bool {
-        !isEnabled(.applePayGiftDonationKillSwitch)
-    }
-
-    public var canDonateMonthlyWithApplePay: Bool {
-        !isEnabled(.applePayMonthlyDonationKillSwitch)
-    }
-
-    public var canDonateOneTimeWithCreditOrDebitCard: Bool {
-        !isEnabled(.cardOneTimeDonationKillSwitch)
-    }
-
-    public var canDonateGiftWithCreditOrDebitCard: Bool {
-        !isEnabled(.cardGiftDonationKillSwitch)
-    }
-
-    public var canDonateMonthlyWithCreditOrDebitCard: Bool {
-        !isEnabled(.cardMonthlyDonationKillSwitch)
-    }
-
-    public var canDonateOneTimeWithPaypal: Bool {
-        !isEnabled(.paypalOneTimeDonationKillSwitch)
-    }
-
-    public var canDonateGiftWithPayPal: Bool {
-        !isEnabled(.paypalGiftDonationKillSwitch)
-    }
-
-    public var canDonateMonthlyWithPaypal: Bool {
-        !isEnabled(.paypalMonthlyDonationKillSwitch)
-    }
-
     public func standardMediaQualityLevel(localPhoneNumber: String?) -> ImageQualityLevel? {
-        let rawValue: String = ValueFlag.standardMediaQualityLevel.rawValue
         guard
-            let csvString = valueFlags[rawValue],
-            let stringValue = Self.countryCodeValue(csvString: csvString, csvDescription: rawValue, localPhoneNumber: localPhoneNumber),
+            let stringValue = Self.countryCodeValue(standardMediaQualityLevels, localPhoneNumber: localPhoneNumber),
             let uintValue = UInt(stringValue),
             let defaultMediaQuality = ImageQualityLevel(rawValue: uintValue)
         else {
@@ -169,124 +198,27 @@ public class RemoteConfig {
         return PhoneNumberRegions(fromRemoteConfig: valueList)
     }
 
-    public var messageResendKillSwitch: Bool {
-        isEnabled(.messageResendKillSwitch)
-    }
-
-    public var replaceableInteractionExpiration: TimeInterval {
-        interval(.replaceableInteractionExpiration, defaultInterval: kHourInterval)
-    }
-
-    public var messageSendLogEntryLifetime: TimeInterval {
-        interval(.messageSendLogEntryLifetime, defaultInterval: 2 * kWeekInterval)
-    }
-
-    public var maxGroupCallRingSize: UInt {
-        getUIntValue(forFlag: .maxGroupCallRingSize, defaultValue: 16)
-    }
-
-    public var enableAutoAPNSRotation: Bool {
-        return isEnabled(.enableAutoAPNSRotation, defaultValue: false)
-    }
-
-    /// The minimum length for a valid nickname, in Unicode codepoints.
-    public var minNicknameLength: UInt32 {
-        getUInt32Value(forFlag: .minNicknameLength, defaultValue: 3)
-    }
-
-    /// The maximum length for a valid nickname, in Unicode codepoints.
-    public var maxNicknameLength: UInt32 {
-        getUInt32Value(forFlag: .maxNicknameLength, defaultValue: 32)
-    }
-
-    public var maxAttachmentDownloadSizeBytes: UInt {
-        return getUIntValue(forFlag: .maxAttachmentDownloadSizeBytes, defaultValue: 100 * 1024 * 1024)
-    }
-
     // Hardcoded value (but lives alongside `maxAttachmentDownloadSizeBytes`).
-    public var maxMediaTierThumbnailDownloadSizeBytes: UInt = 1024 * 8
-
-    public var enableGifSearch: Bool {
-        return isEnabled(.enableGifSearch, defaultValue: true)
-    }
-
-    public var shouldCheckForServiceExtensionFailures: Bool {
-        return !isEnabled(.serviceExtensionFailureKillSwitch)
-    }
-
-    public var backgroundRefreshInterval: TimeInterval {
-        return TimeInterval(getUIntValue(
-            forFlag: .backgroundRefreshInterval,
-            defaultValue: UInt(kDayInterval)
-        ))
-    }
+    public let maxMediaTierThumbnailDownloadSizeBytes: UInt = 1024 * 8
 
     @available(*, unavailable, message: "cached in UserDefaults by ChatConnectionManager")
     public var experimentalTransportUseLibsignal: Bool {
         return false
     }
 
-    public var experimentalTransportShadowingHigh: Bool {
-        return isEnabled(.experimentalTransportShadowingHigh, defaultValue: false)
-    }
-
     @available(*, unavailable, message: "cached in UserDefaults by ChatConnectionManager")
     public var experimentalTransportShadowingEnabled: Bool {
         return false
     }
 
-    public var cdsiLookupWithLibsignal: Bool {
-        return isEnabled(.cdsiLookupWithLibsignal, defaultValue: true)
-    }
-
-    /// The time a linked device may be offline before it expires and is
-    /// unlinked.
-    public var linkedDeviceLifespan: TimeInterval {
-        return interval(
-            .linkedDeviceLifespanInterval,
-            defaultInterval: kMonthInterval
-        )
-    }
-
-    public var callLinkJoin: Bool {
-        return (
-            FeatureBuild.current == .dev
-            || FeatureBuild.current == .internal && isEnabled(.callLinkJoin)
-        )
-    }
-
-    // MARK: UInt values
+    // MARK: Parsing values
 
-    private func getUIntValue(
-        forFlag flag: ValueFlag,
-        defaultValue: UInt
-    ) -> UInt {
-        getStringConvertibleValue(
-            forFlag: flag,
-            defaultValue: defaultValue
-        )
-    }
-
-    private func getUInt32Value(
-        forFlag flag: ValueFlag,
-        defaultValue: UInt32
-    ) -> UInt32 {
-        getStringConvertibleValue(
-            forFlag: flag,
-            defaultValue: defaultValue
-        )
-    }
-
-    private func getStringConvertibleValue<V>(
-        forFlag flag: ValueFlag,
+    private static func parseValue<V>(
+        valueFlags: [String: String],
+        flag: ValueFlag,
         defaultValue: V
     ) -> V where V: LosslessStringConvertible {
-        guard AppReadiness.isAppReady else {
-            owsFailDebug("Storage is not yet ready.")
-            return defaultValue
-        }
-
-        guard let stringValue: String = value(flag) else {
+        guard let stringValue = valueFlags[flag.rawValue] else {
             return defaultValue
         }
 
@@ -326,14 +258,20 @@ public class RemoteConfig {
     /// Given a CSV of `<country-code>:<value>` pairs, extract the `<value>`
     /// corresponding to the current user's country.
     private static func countryCodeValue(csvString: String, csvDescription: String, localPhoneNumber: String?) -> String? {
-        guard !csvString.isEmpty else { return nil }
+        let callingCodeToValueMap = parseCountryCodeValues(csvString: csvString, csvDescription: csvDescription)
+        return countryCodeValue(callingCodeToValueMap, localPhoneNumber: localPhoneNumber)
+    }
+
+    /// Parses a CSV of `<country-code>:<value>` pairs.
+    private static func parseCountryCodeValues(csvString: String, csvDescription: String) -> [String: String] {
+        guard !csvString.isEmpty else { return [:] }
 
         // The value should always be a comma-separated list of country codes
         // colon-separated from a value. There all may be an optional be a wildcard
         // "*" country code that any unspecified country codes should use. If
         // neither the local country code or the wildcard is specified, we assume
         // the value is not set.
-        let callingCodeToValueMap = csvString
+        return csvString
             .components(separatedBy: ",")
             .reduce(into: [String: String]()) { result, value in
                 let components = value.components(separatedBy: ":")
@@ -342,7 +280,9 @@ public class RemoteConfig {
                 let countryValue = components[1]
                 result[callingCode] = countryValue
             }
+    }
 
+    private static func countryCodeValue(_ callingCodeToValueMap: [String: String], localPhoneNumber: String?) -> String? {
         guard !callingCodeToValueMap.isEmpty else { return nil }
 
         guard
@@ -380,17 +320,6 @@ public class RemoteConfig {
 
     // MARK: -
 
-    private func interval(_ flag: ValueFlag, defaultInterval: TimeInterval) -> TimeInterval {
-        guard let intervalString: String = value(flag), let interval = TimeInterval(intervalString) else {
-            return defaultInterval
-        }
-        return interval
-    }
-
-    private func isEnabled(_ flag: IsEnabledFlag, defaultValue: Bool = false) -> Bool {
-        return isEnabledFlags[flag.rawValue] ?? defaultValue
-    }
-
     private func isEnabled(_ flag: TimeGatedFlag, defaultValue: Bool = false) -> Bool {
         guard let dateThreshold = timeGatedFlags[flag.rawValue] else {
             return defaultValue
@@ -399,10 +328,6 @@ public class RemoteConfig {
         return correctedDate >= dateThreshold
     }
 
-    private func value(_ flag: ValueFlag) -> String? {
-        return valueFlags[flag.rawValue]
-    }
-
     public func debugDescriptions() -> [String: String] {
         var result = [String: String]()
         for (key, value) in isEnabledFlags {
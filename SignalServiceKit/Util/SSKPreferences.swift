@@ -9,7 +9,7 @@ import GRDB
 @objc
 public class SSKPreferences: NSObject {
 
-    public static let store = SDSKeyValueStore(collection: "SSKPreferences")
+    public static let store = SDSKeyValueStore(collection: "SSKPreferences", cachesValues: true)
 
     private var store: SDSKeyValueStore {
         return SSKPreferences.store
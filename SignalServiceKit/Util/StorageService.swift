@@ -455,32 +455,32 @@ public struct StorageService: Dependencies {
 
             let keyToIdentifier = Dictionary(uniqueKeysWithValues: keys.map { ($0.data, $0) })
 
-            return try itemsProto.items.map { item in
-                let encryptedItemData = item.value
-                guard let itemIdentifier = keyToIdentifier[item.key] else {
-                    owsFailDebug("missing identifier for fetched item")
-                    throw StorageError.assertion
-                }
-                let itemDecryptionResult = self.databaseStorage.read(block: { tx in
-                    return DependenciesBridge.shared.svr.decrypt(
+            // Decrypt the whole batch in one read rather than opening a read per item.
+            return try self.databaseStorage.read { tx in
+                return try itemsProto.items.map { item in
+                    let encryptedItemData = item.value
+                    guard let itemIdentifier = keyToIdentifier[item.key] else {
+                        owsFailDebug("missing identifier for fetched item")
+                        throw StorageError.assertion
+                    }
+                    let itemDecryptionResult = DependenciesBridge.shared.svr.decrypt(
                         keyType: .storageServiceRecord(identifier: itemIdentifier),
                         encryptedData: encryptedItemData,
                         transaction: tx.asV2Read
                     )
-                })
-                switch itemDecryptionResult {
-                case .success(let itemData):
-                    do {
-                        let record = try StorageServiceProtoStorageRecord(serializedData: itemData)
-                        return StorageItem(identifier: itemIdentifier, record: record)
-                    } catch {
-                        Logger.error("Failed to deserialize item proto after decryption succeeded")
-                        throw StorageError.itemProtoDeserializationFailed(identifier: itemIdentifier)
+                    switch itemDecryptionResult {
+                    case .success(let itemData):
+                        do {
+                            let record = try StorageServiceProtoStorageRecord(serializedData: itemData)
+                            return StorageItem(identifier: itemIdentifier, record: record)
+                        } catch {
+                            Logger.error("Failed to deserialize item proto after decryption succeeded")
+                            throw StorageError.itemProtoDeserializationFailed(identifier: itemIdentifier)
+                        }
+                    case .masterKeyMissing, .cryptographyError:
+                        throw StorageError.itemDecryptionFailed(identifier: itemIdentifier)
                     }
-                case .masterKeyMissing, .cryptographyError:
-                    throw StorageError.itemDecryptionFailed(identifier: itemIdentifier)
                 }
-
             }
         }
     }
@@ -23,12 +23,35 @@ public class GzipStreamTransform: StreamTransform, FinalizableStreamTransform {
         case finalizeFailed
     }
 
-    private enum Constants {
-        static let BufferSize: Int = 32_768
+    /// Tunables for compression; decompression only uses `bufferSize` and
+    /// `windowBits` (which must be at least the value used to compress).
+    public struct Configuration {
+        /// 1 (fastest) through 9 (smallest output).
+        public var compressionLevel: Int32
+        /// Log2 of the history window size, 9 through 15.
+        public var windowBits: Int32
+        /// 1 through 9; higher levels use more memory for faster compression.
+        public var memoryLevel: Int32
+        /// Size of each chunk of output handed back by the transform.
+        public var bufferSize: Int
+
+        public init(
+            compressionLevel: Int32 = Z_BEST_COMPRESSION,
+            windowBits: Int32 = MAX_WBITS,
+            memoryLevel: Int32 = MAX_MEM_LEVEL,
+            bufferSize: Int = 32_768
+        ) {
+            self.compressionLevel = compressionLevel
+            self.windowBits = windowBits
+            self.memoryLevel = memoryLevel
+            self.bufferSize = bufferSize
+        }
 
-        // Use the maximum memory window (32K) for compressing the data
-        static let MaxWindowBits = MAX_WBITS
+        /// The smallest output, with the maximum window (32K), as used for backups.
+        public static let `default` = Configuration()
+    }
 
+    private enum Constants {
         // adding 16 to the window bits will signal the gzip header should be written
         static let GzipDeflateHeaderWindowBits: Int32 = 16
 
@@ -42,9 +65,11 @@ public class GzipStreamTransform: StreamTransform, FinalizableStreamTransform {
 
     private var stream: z_stream
     private let operation: Operation
+    private let bufferSize: Int
 
-    init(_ operation: Operation) throws {
+    init(_ operation: Operation, configuration: Configuration = .default) throws {
         self.operation = operation
+        self.bufferSize = configuration.bufferSize
         self.stream = z_stream()
 
         var status = Z_OK
@@ -52,10 +77,10 @@ public class GzipStreamTransform: StreamTransform, FinalizableStreamTransform {
         case .compress:
             status = deflateInit2_(
                 &stream,
-                Z_BEST_COMPRESSION,
+                configuration.compressionLevel,
                 Z_DEFLATED,
-                Constants.MaxWindowBits + Constants.GzipDeflateHeaderWindowBits,
-                MAX_MEM_LEVEL,
+                configuration.windowBits + Constants.GzipDeflateHeaderWindowBits,
+                configuration.memoryLevel,
                 Z_DEFAULT_STRATEGY,
                 ZLIB_VERSION,
                 Int32(MemoryLayout<z_stream>.size)
@@ -63,14 +88,14 @@ public class GzipStreamTransform: StreamTransform, FinalizableStreamTransform {
         case .decompress:
             status = inflateInit2_(
                 &stream,
-                Constants.MaxWindowBits + Constants.GzipInflateHeaderWindowBits,
+                configuration.windowBits + Constants.GzipInflateHeaderWindowBits,
                 ZLIB_VERSION,
                 Int32(MemoryLayout<z_stream>.size)
             )
         }
 
         // Set the amount of space available to start processing
-        stream.avail_out = UInt32(Constants.BufferSize)
+        stream.avail_out = UInt32(bufferSize)
 
         guard status == Z_OK else {
             throw GzipError.initializeFailed
@@ -90,7 +115,7 @@ public class GzipStreamTransform: StreamTransform, FinalizableStreamTransform {
         var status: Int32 = Z_OK
 
         var returnData = Data()
-        var buffer = Data(count: Constants.BufferSize)
+        var buffer = Data(count: bufferSize)
         var bufferWritten: UInt = 0
 
         data.withUnsafeBytes { (ptr: UnsafeRawBufferPointer) in
@@ -110,9 +135,9 @@ public class GzipStreamTransform: StreamTransform, FinalizableStreamTransform {
                 // If this is encountered, move the current buffer into `returnData` and reset to an empty buffer
                 if stream.avail_out == 0 {
                     returnData.append(buffer)
-                    buffer = Data(count: Constants.BufferSize)
+                    buffer = Data(count: bufferSize)
                     bufferWritten = 0
-                    stream.avail_out = UInt32(Constants.BufferSize)
+                    stream.avail_out = UInt32(bufferSize)
                 }
 
                 buffer.withUnsafeMutableBytes { (outputPtr: UnsafeMutableRawBufferPointer) in
@@ -131,8 +156,8 @@ public class GzipStreamTransform: StreamTransform, FinalizableStreamTransform {
                         status = inflate(&stream, flags)
                     }
 
-                    // stream.avail_out should never be greater than Constants.BufferSize, but clamp just to be sure.
-                    bufferWritten = UInt(clamping: Constants.BufferSize - Int(stream.avail_out))
+                    // stream.avail_out should never be greater than bufferSize, but clamp just to be sure.
+                    bufferWritten = UInt(clamping: bufferSize - Int(stream.avail_out))
                     stream.next_out = nil
                 }
 
@@ -169,9 +194,9 @@ public class GzipStreamTransform: StreamTransform, FinalizableStreamTransform {
 
         // Append the remaining buffer to the return data and reset the stream field.
         returnData.append(buffer.subdata(in: 0..<Int(clamping: bufferWritten)))
-        buffer = Data(count: Constants.BufferSize)
+        buffer = Data(count: bufferSize)
         bufferWritten = 0
-        stream.avail_out = UInt32(Constants.BufferSize)
+        stream.avail_out = UInt32(bufferSize)
 
         outputCount += returnData.count
         return returnData
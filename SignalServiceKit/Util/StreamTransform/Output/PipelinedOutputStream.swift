@@ -0,0 +1,103 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// Wrapper around an OutputStreamable that performs writes on a background
+/// queue, so that the caller can keep producing data while earlier writes
+/// (and any transforms in the wrapped stream, e.g. compression and
+/// encryption) run on another core.
+///
+/// Writes are batched, then handed to a serial queue in order; each write
+/// reaches the wrapped stream as a separate `write(data:)` call, so
+/// per-write transforms (like chunking) see the same boundaries. At most
+/// `maxPendingBatchCount` batches are in flight; beyond that, `write(data:)`
+/// blocks until the queue catches up.
+///
+/// A failed write is reported by the next `write(data:)` or by `close()`.
+/// The wrapped stream is only closed from `close()`, on the calling thread.
+public final class PipelinedOutputStream: OutputStreamable {
+
+    private let outputStream: OutputStreamable
+    private let maxBatchByteCount: Int
+
+    private let writeQueue = DispatchQueue(label: "org.signal.pipelined-output-stream")
+    private let pendingBatchSemaphore: DispatchSemaphore
+
+    private var batch = [Data]()
+    private var batchByteCount = 0
+
+    private let errorLock = UnfairLock()
+    private var writeError: Error?
+
+    public init(
+        outputStream: OutputStreamable,
+        maxBatchByteCount: Int = 256 * 1024,
+        maxPendingBatchCount: Int = 8
+    ) {
+        self.outputStream = outputStream
+        self.maxBatchByteCount = maxBatchByteCount
+        self.pendingBatchSemaphore = DispatchSemaphore(value: maxPendingBatchCount)
+    }
+
+    public func write(data: Data) throws {
+        try throwWriteErrorIfNeeded()
+
+        batch.append(data)
+        batchByteCount += data.count
+        if batchByteCount >= maxBatchByteCount {
+            flushBatch()
+        }
+    }
+
+    private func flushBatch() {
+        guard !batch.isEmpty else {
+            return
+        }
+        let batch = self.batch
+        self.batch = []
+        self.batchByteCount = 0
+
+        pendingBatchSemaphore.wait()
+        writeQueue.async {
+            defer { self.pendingBatchSemaphore.signal() }
+            guard self.errorLock.withLock({ self.writeError }) == nil else {
+                // Drop anything after a failed write.
+                return
+            }
+            do {
+                for data in batch {
+                    try self.outputStream.write(data: data)
+                }
+            } catch {
+                self.errorLock.withLock { self.writeError = error }
+            }
+        }
+    }
+
+    private func throwWriteErrorIfNeeded() throws {
+        if let writeError = errorLock.withLock({ writeError }) {
+            throw writeError
+        }
+    }
+
+    public func close() throws {
+        flushBatch()
+        // Wait for every pending write.
+        writeQueue.sync {}
+        try throwWriteErrorIfNeeded()
+        try outputStream.close()
+    }
+
+    // MARK: - OutputStreamable passthrough
+
+    public func remove(from runLoop: RunLoop, forMode mode: RunLoop.Mode) {
+        outputStream.remove(from: runLoop, forMode: mode)
+    }
+
+    public func schedule(in runLoop: RunLoop, forMode mode: RunLoop.Mode) {
+        outputStream.schedule(in: runLoop, forMode: mode)
+    }
+}
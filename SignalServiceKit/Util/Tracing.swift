@@ -0,0 +1,118 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+import os
+
+/// Signpost-based tracing for multi-step pipelines (e.g. receiving or
+/// sending a message).
+///
+/// Intervals appear in Instruments' os_signpost instrument and are captured
+/// in sysdiagnose traces, so end-to-end latency can be profiled without
+/// grepping for `Bench` output. When nothing is recording, beginning and
+/// ending an interval is cheap and metadata closures aren't evaluated.
+///
+///     let interval = Tracing.beginInterval(.messageSending, "Send", metadata: "\(timestamp)")
+///     defer { interval.end() }
+///
+/// Metadata is recorded as public, so it must never contain user content or
+/// identifiers (timestamps and counts are fine).
+public enum Tracing {
+    public enum Category: String, CaseIterable {
+        case messageProcessing = "MessageProcessing"
+        case messageSending = "MessageSending"
+        case conversationView = "ConversationView"
+        case launch = "Launch"
+    }
+
+    private static let signposters: [Category: OSSignposter] = {
+        let subsystem = Bundle.main.bundleIdentifier ?? "org.whispersystems.signal"
+        var result = [Category: OSSignposter]()
+        for category in Category.allCases {
+            result[category] = OSSignposter(subsystem: subsystem, category: category.rawValue)
+        }
+        return result
+    }()
+
+    fileprivate static func signposter(for category: Category) -> OSSignposter {
+        return signposters[category]!
+    }
+
+    /// Starts an interval; the caller must `end()` it exactly once, possibly
+    /// on another thread.
+    public static func beginInterval(
+        _ category: Category,
+        _ name: StaticString,
+        metadata: @autoclosure () -> String = ""
+    ) -> TraceInterval {
+        let signposter = signposter(for: category)
+        guard signposter.isEnabled else {
+            return TraceInterval(signposter: signposter, name: name, state: nil)
+        }
+        let id = signposter.makeSignpostID()
+        let metadata = metadata()
+        let state = signposter.beginInterval(name, id: id, "\(metadata, privacy: .public)")
+        return TraceInterval(signposter: signposter, name: name, state: state)
+    }
+
+    public static func withInterval<T>(
+        _ category: Category,
+        _ name: StaticString,
+        metadata: @autoclosure () -> String = "",
+        block: () throws -> T
+    ) rethrows -> T {
+        let interval = beginInterval(category, name, metadata: metadata())
+        defer { interval.end() }
+        return try block()
+    }
+
+    public static func withInterval<T>(
+        _ category: Category,
+        _ name: StaticString,
+        metadata: @autoclosure () -> String = "",
+        block: () async throws -> T
+    ) async rethrows -> T {
+        let interval = beginInterval(category, name, metadata: metadata())
+        defer { interval.end() }
+        return try await block()
+    }
+
+    /// Marks a point in time, e.g. an envelope arriving.
+    public static func emitEvent(
+        _ category: Category,
+        _ name: StaticString,
+        metadata: @autoclosure () -> String = ""
+    ) {
+        let signposter = signposter(for: category)
+        guard signposter.isEnabled else {
+            return
+        }
+        let metadata = metadata()
+        signposter.emitEvent(name, "\(metadata, privacy: .public)")
+    }
+}
+
+// MARK: -
+
+public struct TraceInterval {
+    private let signposter: OSSignposter
+    private let name: StaticString
+    /// Nil if the signposter wasn't enabled when the interval began.
+    private let state: OSSignpostIntervalState?
+
+    fileprivate init(signposter: OSSignposter, name: StaticString, state: OSSignpostIntervalState?) {
+        self.signposter = signposter
+        self.name = name
+        self.state = state
+    }
+
+    public func end(metadata: @autoclosure () -> String = "") {
+        guard let state else {
+            return
+        }
+        let metadata = metadata()
+        signposter.endInterval(name, state, "\(metadata, privacy: .public)")
+    }
+}
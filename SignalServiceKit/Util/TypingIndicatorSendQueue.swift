@@ -0,0 +1,96 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+
+/// Decides which outgoing typing indicators are sent, and when.
+///
+/// Indicators are coalesced per thread: only the latest action for a thread
+/// waits to be sent, a "stopped" that cancels an unsent "started" sends
+/// nothing, and a "stopped" is only sent if the thread's last indicator was
+/// a "started". Sends across all threads are spaced by at least
+/// `minimumSendInterval`, since in a large group each one is a fan-out.
+struct TypingIndicatorSendQueue {
+    static let minimumSendInterval: TimeInterval = 1
+
+    struct Item: Equatable {
+        let threadUniqueId: String
+        let action: TypingIndicatorAction
+    }
+
+    /// Threads with an action waiting to be sent, oldest first.
+    private var pendingThreadUniqueIds = [String]()
+    private var pendingActions = [String: TypingIndicatorAction]()
+    private var lastSentActions = [String: TypingIndicatorAction]()
+    private var lastSendDate: Date?
+
+    var isEmpty: Bool { pendingThreadUniqueIds.isEmpty }
+
+    mutating func enqueue(_ action: TypingIndicatorAction, threadUniqueId: String) {
+        let isRedundant: Bool = {
+            switch action {
+            case .started:
+                return false
+            case .stopped:
+                return lastSentActions[threadUniqueId] != .started
+            }
+        }()
+        guard !isRedundant else {
+            removePendingAction(threadUniqueId: threadUniqueId)
+            return
+        }
+        if pendingActions.updateValue(action, forKey: threadUniqueId) == nil {
+            pendingThreadUniqueIds.append(threadUniqueId)
+        }
+    }
+
+    /// When the next indicator may be sent, or nil if none are waiting.
+    func nextSendDate(now: Date) -> Date? {
+        guard !isEmpty else {
+            return nil
+        }
+        guard let lastSendDate else {
+            return now
+        }
+        return max(now, lastSendDate.addingTimeInterval(Self.minimumSendInterval))
+    }
+
+    /// Takes the oldest waiting indicator, if it may be sent now, and records
+    /// it as sent.
+    mutating func dequeue(now: Date) -> Item? {
+        guard let nextSendDate = nextSendDate(now: now), nextSendDate <= now else {
+            return nil
+        }
+        let threadUniqueId = pendingThreadUniqueIds.removeFirst()
+        guard let action = pendingActions.removeValue(forKey: threadUniqueId) else {
+            owsFailDebug("Missing pending action.")
+            return nil
+        }
+        lastSentActions[threadUniqueId] = action
+        lastSendDate = now
+        return Item(threadUniqueId: threadUniqueId, action: action)
+    }
+
+    /// Forgets that `item` was sent, e.g. because it was dropped or the send
+    /// failed, so a "stopped" isn't sent after a "started" that never was.
+    mutating func didNotSend(_ item: Item) {
+        if lastSentActions[item.threadUniqueId] == item.action {
+            lastSentActions[item.threadUniqueId] = nil
+        }
+    }
+
+    /// Recipients stop showing us typing when they get a message from us, so
+    /// nothing needs to be sent for the thread.
+    mutating func didSendMessage(threadUniqueId: String) {
+        removePendingAction(threadUniqueId: threadUniqueId)
+        lastSentActions[threadUniqueId] = nil
+    }
+
+    private mutating func removePendingAction(threadUniqueId: String) {
+        if pendingActions.removeValue(forKey: threadUniqueId) != nil {
+            pendingThreadUniqueIds.removeAll { $0 == threadUniqueId }
+        }
+    }
+}
@@ -213,12 +213,12 @@ public class TypingIndicatorsImpl: NSObject, TypingIndicators {
     // A sendPause timer
     // A sendRefresh timer
     private class OutgoingIndicators {
-        private weak var delegate: TypingIndicators?
+        private weak var delegate: TypingIndicatorsImpl?
         private let threadUniqueId: String
         private var sendPauseTimer: Timer?
         private var sendRefreshTimer: Timer?
 
-        init(delegate: TypingIndicators, thread: TSThread) {
+        init(delegate: TypingIndicatorsImpl, thread: TSThread) {
             self.delegate = delegate
             self.threadUniqueId = thread.uniqueId
         }
@@ -276,6 +276,8 @@ public class TypingIndicatorsImpl: NSObject, TypingIndicators {
 
             sendPauseTimer?.invalidate()
             sendPauseTimer = nil
+
+            delegate?.didSendOutgoingMessage(threadUniqueId: threadUniqueId)
         }
 
         private func sendTypingMessageIfNecessary(for threadUniqueId: String, action: TypingIndicatorAction) {
@@ -287,27 +289,93 @@ public class TypingIndicatorsImpl: NSObject, TypingIndicators {
             // or show typing indicators for other users.
             guard delegate.areTypingIndicatorsEnabled() else { return }
 
-            SDSDatabaseStorage.shared.write(.promise) { transaction in
-                guard let thread = TSThread.anyFetch(uniqueId: threadUniqueId, transaction: transaction) else {
-                    return Promise<Void>.value(())
-                }
+            delegate.enqueueTypingMessage(threadUniqueId: threadUniqueId, action: action)
+        }
+    }
+
+    // MARK: - Sending
+
+    // Outgoing typing messages from every thread go through one queue, which
+    // coalesces them and limits how often they're sent. They're sent one at
+    // a time, as online-only messages, which the chat connection sends at
+    // low priority so they don't hold up real messages.
+    private var sendQueue = TypingIndicatorSendQueue()
+    private var sendTimer: Timer?
+    private var isSendingTypingMessage = false
+
+    fileprivate func enqueueTypingMessage(threadUniqueId: String, action: TypingIndicatorAction) {
+        AssertIsOnMainThread()
+
+        sendQueue.enqueue(action, threadUniqueId: threadUniqueId)
+        scheduleNextTypingMessageIfNecessary()
+    }
+
+    fileprivate func didSendOutgoingMessage(threadUniqueId: String) {
+        AssertIsOnMainThread()
+
+        sendQueue.didSendMessage(threadUniqueId: threadUniqueId)
+    }
 
-                let message = TypingIndicatorMessage(thread: thread, action: action, transaction: transaction)
-                let preparedMessage = PreparedOutgoingMessage.preprepared(
-                    transientMessageWithoutAttachments: message
-                )
-
-                return SSKEnvironment.shared.messageSenderJobQueueRef.add(
-                    .promise,
-                    message: preparedMessage,
-                    limitToCurrentProcessLifetime: true,
-                    transaction: transaction
-                )
-            }.then(on: SyncScheduler()) { messageSendPromise in
-                return messageSendPromise
-            }.catch { error in
-                Logger.error("Error: \(error)")
+    private func scheduleNextTypingMessageIfNecessary() {
+        AssertIsOnMainThread()
+
+        guard !isSendingTypingMessage, sendTimer == nil else {
+            return
+        }
+        guard let nextSendDate = sendQueue.nextSendDate(now: Date()) else {
+            return
+        }
+        sendTimer = Timer.scheduledTimer(withTimeInterval: max(0, nextSendDate.timeIntervalSinceNow), repeats: false) { [weak self] _ in
+            self?.sendTimerDidFire()
+        }
+    }
+
+    private func sendTimerDidFire() {
+        AssertIsOnMainThread()
+
+        sendTimer = nil
+        guard let item = sendQueue.dequeue(now: Date()) else {
+            scheduleNextTypingMessageIfNecessary()
+            return
+        }
+        // A late "started" isn't worth waiting in line for. Drop it rather
+        // than queue it behind other low priority requests.
+        if item.action == .started, DependenciesBridge.shared.chatConnectionManager.hasRequestBackpressure(priority: .low) {
+            sendQueue.didNotSend(item)
+            scheduleNextTypingMessageIfNecessary()
+            return
+        }
+
+        isSendingTypingMessage = true
+        sendTypingMessage(item).done(on: DispatchQueue.main) {
+            self.isSendingTypingMessage = false
+            self.scheduleNextTypingMessageIfNecessary()
+        }
+    }
+
+    /// Never fails; failures are logged and forgotten.
+    private func sendTypingMessage(_ item: TypingIndicatorSendQueue.Item) -> Guarantee<Void> {
+        return SDSDatabaseStorage.shared.write(.promise) { transaction in
+            guard let thread = TSThread.anyFetch(uniqueId: item.threadUniqueId, transaction: transaction) else {
+                return Promise<Void>.value(())
             }
+
+            let message = TypingIndicatorMessage(thread: thread, action: item.action, transaction: transaction)
+            let preparedMessage = PreparedOutgoingMessage.preprepared(
+                transientMessageWithoutAttachments: message
+            )
+
+            return SSKEnvironment.shared.messageSenderJobQueueRef.add(
+                .promise,
+                message: preparedMessage,
+                limitToCurrentProcessLifetime: true,
+                transaction: transaction
+            )
+        }.then(on: SyncScheduler()) { messageSendPromise in
+            return messageSendPromise
+        }.recover(on: DispatchQueue.main) { error in
+            Logger.error("Error: \(error)")
+            self.sendQueue.didNotSend(item)
         }
     }
 
@@ -168,4 +168,34 @@ class OWSRecipientIdentityTest: SSKBaseTest {
             XCTAssertFalse(identityManager.groupContainsUnverifiedMember(groupThread.uniqueId, tx: tx.asV2Read))
         }
     }
+
+    func testCachedIdentityReflectsWrites() {
+        let address = SignalServiceAddress(aliceAci)
+        let hitsBefore = modelReadCaches.recipientIdentityReadCache.counters.hits
+        read { tx in
+            XCTAssertEqual(identityManager.recipientIdentity(for: address, tx: tx.asV2Read)?.verificationState, .default)
+            XCTAssertEqual(identityManager.recipientIdentity(for: address, tx: tx.asV2Read)?.identityKey, identityKey(aliceAci))
+        }
+        XCTAssertGreaterThan(modelReadCaches.recipientIdentityReadCache.counters.hits, hitsBefore)
+
+        write { tx in
+            _ = identityManager.setVerificationState(
+                .verified,
+                of: identityKey(aliceAci),
+                for: address,
+                isUserInitiatedChange: true,
+                tx: tx.asV2Write
+            )
+        }
+        read { tx in
+            XCTAssertEqual(identityManager.recipientIdentity(for: address, tx: tx.asV2Read)?.verificationState, .verified)
+        }
+
+        write { tx in
+            identityManager.recipientIdentity(for: address, tx: tx.asV2Write)?.anyRemove(transaction: tx)
+        }
+        read { tx in
+            XCTAssertNil(identityManager.recipientIdentity(for: address, tx: tx.asV2Read))
+        }
+    }
 }
@@ -0,0 +1,59 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+import XCTest
+
+@testable import SignalServiceKit
+
+class ThreadSummaryAccumulatorTest: SSKBaseTest {
+    func testBurstOfMessagesIsMergedIntoThread() {
+        var thread: TSContactThread!
+        write { transaction in
+            thread = ContactThreadFactory().create(transaction: transaction)
+            ThreadAssociatedData
+                .fetchOrDefault(for: thread, transaction: transaction)
+                .updateWith(isArchived: true, isMarkedUnread: true, updateStorageService: false, transaction: transaction)
+        }
+
+        var messages = [TSIncomingMessage]()
+        write { transaction in
+            let messageFactory = IncomingMessageFactory()
+            messageFactory.threadCreator = { _ in return thread }
+            messages = messageFactory.create(count: 16, transaction: transaction)
+        }
+
+        read { transaction in
+            let latestThread = TSContactThread.anyFetchContactThread(uniqueId: thread.uniqueId, transaction: transaction)!
+            XCTAssertTrue(latestThread.shouldThreadBeVisible)
+            XCTAssertEqual(latestThread.lastInteractionRowId, messages.last!.sortId)
+
+            let associatedData = ThreadAssociatedData.fetchOrDefault(for: latestThread, transaction: transaction)
+            XCTAssertFalse(associatedData.isArchived)
+            XCTAssertFalse(associatedData.isMarkedUnread)
+        }
+    }
+
+    func testRemovalAfterInsertInSameTransaction() {
+        var thread: TSContactThread!
+        var messages = [TSIncomingMessage]()
+        write { transaction in
+            thread = ContactThreadFactory().create(transaction: transaction)
+            let messageFactory = IncomingMessageFactory()
+            messageFactory.threadCreator = { _ in return thread }
+            messages = messageFactory.create(count: 3, transaction: transaction)
+            DependenciesBridge.shared.interactionDeleteManager.delete(
+                messages.last!,
+                sideEffects: .default(),
+                tx: transaction.asV2Write
+            )
+        }
+
+        read { transaction in
+            let latestThread = TSContactThread.anyFetchContactThread(uniqueId: thread.uniqueId, transaction: transaction)!
+            XCTAssertEqual(latestThread.lastInteractionRowId, messages[1].sortId)
+        }
+    }
+}
@@ -121,6 +121,35 @@ class GroupModelsTest: SSKBaseTest {
         XCTAssertEqual(membership4, membership5)
     }
 
+    func testGroupMembershipAccessors() {
+        var builder = GroupMembership.Builder()
+        builder.addFullMember(.aci1, role: .administrator)
+        builder.addFullMember(.aci2, role: .normal)
+        builder.addInvitedMember(Aci.aci3, role: .administrator, addedByAci: .aci1)
+        let membership = builder.build()
+
+        let address1 = SignalServiceAddress(Aci.aci1)
+        let address2 = SignalServiceAddress(Aci.aci2)
+        let address3 = SignalServiceAddress(Aci.aci3)
+        XCTAssertEqual(membership.fullMembers, [address1, address2])
+        XCTAssertEqual(Set(membership.fullMembersArray), [address1, address2])
+        XCTAssertEqual(membership.fullMemberAdministrators, [address1])
+        XCTAssertEqual(membership.invitedMembers, [address3])
+        XCTAssertEqual(membership.fullOrInvitedMembers, [address1, address2, address3])
+        XCTAssertEqual(membership.allMembersOfAnyKindServiceIds, [Aci.aci1, Aci.aci2, Aci.aci3])
+
+        XCTAssertTrue(membership.isFullMemberAndAdministrator(Aci.aci1))
+        XCTAssertFalse(membership.isFullMemberAndAdministrator(Aci.aci2))
+        XCTAssertTrue(membership.isFullOrInvitedAdministrator(Aci.aci3))
+        XCTAssertTrue(membership.isInvitedMember(Aci.aci3))
+        XCTAssertFalse(membership.isFullMember(Aci.aci3))
+        XCTAssertFalse(membership.isMemberOfAnyKind(Aci.randomForTesting()))
+        XCTAssertEqual(membership.role(for: Aci.aci2), .normal)
+
+        XCTAssertEqual(membership.fullMembers(excluding: address1), [address2])
+        XCTAssertEqual(Set(membership.fullMembers(excluding: nil)), [address1, address2])
+    }
+
     func testTSGroupModelBackwardsCompatibleDeserialization() throws {
         let groupIdLength = 16 // Taken from kGroupIdLength at the time of archiving.
         let expectedGroupId = Data(repeating: 8, count: groupIdLength)
@@ -0,0 +1,49 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+
+@testable import SignalServiceKit
+
+class GroupOperationLanesTest: XCTestCase {
+
+    func testSameGroupRunsInOrder() {
+        let lanes = GroupOperationLanes(name: "test", maxConcurrentOperationCount: 4)
+        let groupId = Data(repeating: 1, count: 32)
+        let events = AtomicValue<[Int]>([], lock: UnfairLock())
+        let expectations = (0..<8).map { expectation(description: "\($0)") }
+        for index in 0..<8 {
+            lanes.addOperation(BlockOperation {
+                events.update { $0.append(index) }
+                // Give later operations a chance to overtake, were they allowed to.
+                Thread.sleep(forTimeInterval: 0.01)
+                expectations[index].fulfill()
+            }, groupId: groupId)
+        }
+        wait(for: expectations, timeout: 5)
+        XCTAssertEqual(events.get(), Array(0..<8))
+    }
+
+    func testDifferentGroupsRunConcurrently() {
+        let lanes = GroupOperationLanes(name: "test", maxConcurrentOperationCount: 4)
+        let blockedGroupId = Data(repeating: 1, count: 32)
+        let otherGroupId = Data(repeating: 2, count: 32)
+        let unblock = DispatchSemaphore(value: 0)
+        let blockedExpectation = expectation(description: "blocked")
+        let otherExpectation = expectation(description: "other")
+
+        lanes.addOperation(BlockOperation {
+            unblock.wait()
+            blockedExpectation.fulfill()
+        }, groupId: blockedGroupId)
+        lanes.addOperation(BlockOperation {
+            otherExpectation.fulfill()
+        }, groupId: otherGroupId)
+
+        wait(for: [otherExpectation], timeout: 5)
+        unblock.signal()
+        wait(for: [blockedExpectation], timeout: 5)
+    }
+}
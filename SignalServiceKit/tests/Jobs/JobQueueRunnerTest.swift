@@ -56,6 +56,38 @@ final class JobQueueRunnerTest: XCTestCase {
         XCTAssertEqual(executedJobs[3], "C")
     }
 
+    func testConcurrencyLimit() async throws {
+        let limitedRunner = JobQueueRunner(
+            canExecuteJobsConcurrently: true,
+            maxConcurrentJobCount: 2,
+            db: mockDb,
+            jobFinder: jobFinder,
+            jobRunnerFactory: jobRunnerFactory
+        )
+        limitedRunner.start(shouldRestartExistingJobs: false)
+
+        // Jobs waiting to retry keep their slots.
+        for legacyAttachmentId in ["A", "B", "C"] {
+            let job = IncomingGroupSyncJobRecord(legacyAttachmentId: legacyAttachmentId)
+            jobFinder.addJob(job)
+            limitedRunner.addPersistedJob(job, runner: jobRunnerFactory.buildRunner(retryInterval: kHourInterval))
+        }
+        while jobRunnerFactory.executedJobs.count < 2 {
+            try await Task.sleep(nanoseconds: NSEC_PER_USEC)
+        }
+        try await Task.sleep(nanoseconds: 10 * NSEC_PER_MSEC)
+        XCTAssertEqual(Set(jobRunnerFactory.executedJobs.get()), ["A", "B"])
+        XCTAssertEqual(limitedRunner.metrics.runningJobCount, 2)
+        XCTAssertEqual(limitedRunner.metrics.queueDepth, 1)
+
+        while limitedRunner.metrics.startedJobCount < 3 || limitedRunner.metrics.runningJobCount > 0 {
+            limitedRunner.retryWaitingJobs()
+            try await Task.sleep(nanoseconds: NSEC_PER_USEC)
+        }
+        XCTAssertEqual(jobRunnerFactory.executedJobs.count, 6)
+        XCTAssertEqual(limitedRunner.metrics.queueDepth, 0)
+    }
+
     func testEnqueuedWhileStarting() async throws {
         // Add an old job.
         do {
@@ -0,0 +1,102 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+@testable import SignalServiceKit
+
+final class MessageBackupReadAheadProtoInputStreamTests: XCTestCase {
+
+    func testFramesArriveInOrder() {
+        let inputStream = FakeProtoInputStream(frameCount: 1000)
+        let readAheadStream = MessageBackupReadAheadProtoInputStream(
+            inputStream: inputStream,
+            maxBufferedFrameCount: 4
+        )
+
+        guard case .success(_, moreBytesAvailable: true) = readAheadStream.readHeader() else {
+            return XCTFail("Missing header")
+        }
+        var chatIds = [UInt64]()
+        var hasMoreFrames = true
+        while hasMoreFrames {
+            guard case let .success(frame, moreBytesAvailable) = readAheadStream.readFrame() else {
+                return XCTFail("Missing frame")
+            }
+            chatIds.append(frame.chat.id)
+            hasMoreFrames = moreBytesAvailable
+        }
+        readAheadStream.closeFileStream()
+
+        XCTAssertEqual(chatIds, Array(0..<1000))
+        XCTAssertTrue(inputStream.isClosed)
+    }
+
+    func testStopsReadingAheadAfterError() {
+        let inputStream = FakeProtoInputStream(frameCount: 10)
+        inputStream.failingFrameIndex = 3
+        let readAheadStream = MessageBackupReadAheadProtoInputStream(inputStream: inputStream)
+
+        _ = readAheadStream.readHeader()
+        for _ in 0..<3 {
+            guard case .success = readAheadStream.readFrame() else {
+                return XCTFail("Missing frame")
+            }
+        }
+        guard case .protoDeserializationError = readAheadStream.readFrame() else {
+            return XCTFail("Missing error")
+        }
+        readAheadStream.closeFileStream()
+
+        XCTAssertEqual(inputStream.readFrameCount, 4)
+    }
+
+    func testCloseWhileReadingAhead() {
+        let inputStream = FakeProtoInputStream(frameCount: 1000)
+        let readAheadStream = MessageBackupReadAheadProtoInputStream(
+            inputStream: inputStream,
+            maxBufferedFrameCount: 4
+        )
+
+        _ = readAheadStream.readHeader()
+        _ = readAheadStream.readFrame()
+        readAheadStream.closeFileStream()
+
+        XCTAssertTrue(inputStream.isClosed)
+        XCTAssertLessThan(inputStream.readFrameCount, 1000)
+    }
+
+    private class FakeProtoInputStream: MessageBackupProtoInputStream {
+        let frameCount: Int
+        var failingFrameIndex: Int?
+        private(set) var readFrameCount = 0
+        private(set) var isClosed = false
+
+        init(frameCount: Int) {
+            self.frameCount = frameCount
+        }
+
+        func readHeader() -> MessageBackup.ProtoInputStreamReadResult<BackupProto_BackupInfo> {
+            return .success(BackupProto_BackupInfo(), moreBytesAvailable: frameCount > 0)
+        }
+
+        func readFrame() -> MessageBackup.ProtoInputStreamReadResult<BackupProto_Frame> {
+            XCTAssertFalse(isClosed)
+            let index = readFrameCount
+            readFrameCount += 1
+            if index == failingFrameIndex {
+                return .protoDeserializationError(OWSGenericError("Failed to parse frame"))
+            }
+            var chat = BackupProto_Chat()
+            chat.id = UInt64(index)
+            var frame = BackupProto_Frame()
+            frame.chat = chat
+            return .success(frame, moreBytesAvailable: index + 1 < frameCount)
+        }
+
+        func closeFileStream() {
+            isClosed = true
+        }
+    }
+}
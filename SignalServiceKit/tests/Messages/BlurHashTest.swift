@@ -0,0 +1,48 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+@testable import SignalServiceKit
+
+final class BlurHashTest: XCTestCase {
+    func testSolidColorRoundTrip() throws {
+        let width = 20
+        let height = 16
+        var pixels = [UInt8]()
+        for _ in 0..<(width * height) {
+            pixels += [200, 100, 50, 255]
+        }
+        let blurHash = try XCTUnwrap(pixels.withUnsafeBufferPointer {
+            BlurHashCodec.encode(rgbaPixels: $0, width: width, height: height, bytesPerRow: width * 4, componentsX: 4, componentsY: 3)
+        })
+        XCTAssertTrue(BlurHash.isValidBlurHash(blurHash))
+        XCTAssertEqual(blurHash.count, 4 + 2 * 4 * 3)
+
+        let image = try XCTUnwrap(BlurHashCodec.decode(blurHash, width: 8, height: 8))
+        let decodedPixels = try XCTUnwrap(image.dataProvider?.data as Data?)
+        for offset in stride(from: 0, to: decodedPixels.count, by: 4) {
+            XCTAssertEqual(Int(decodedPixels[offset]), 200, accuracy: 1)
+            XCTAssertEqual(Int(decodedPixels[offset + 1]), 100, accuracy: 1)
+            XCTAssertEqual(Int(decodedPixels[offset + 2]), 50, accuracy: 1)
+        }
+    }
+
+    func testDecode() throws {
+        // From https://github.com/woltapp/blurhash
+        let image = try XCTUnwrap(BlurHashCodec.decode("LEHV6nWB2yk8pyo0adR*.7kCMdnj", width: 32, height: 32))
+        XCTAssertEqual(image.width, 32)
+        XCTAssertEqual(image.height, 32)
+
+        XCTAssertNotNil(BlurHash.image(for: "LEHV6nWB2yk8pyo0adR*.7kCMdnj"))
+    }
+
+    func testDecodeInvalid() {
+        XCTAssertNil(BlurHashCodec.decode("", width: 16, height: 16))
+        // Too short for its size flag.
+        XCTAssertNil(BlurHashCodec.decode("LEHV6nWB2yk8pyo0adR*.7kCMdn", width: 16, height: 16))
+        // Not base 83.
+        XCTAssertNil(BlurHashCodec.decode("LEHV6nWB2yk8pyo0adR*.7kCMd!j", width: 16, height: 16))
+    }
+}
@@ -0,0 +1,51 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import LibSignalClient
+import XCTest
+
+@testable import SignalServiceKit
+
+final class HydratedMessageBodyCacheTest: SSKBaseTest {
+
+    func testCachesUntilMentionedNameChanges() {
+        let cache = HydratedMessageBodyCache()
+        let mentionedAci = Aci.randomForTesting()
+        let otherAci = Aci.randomForTesting()
+        let messageBody = MessageBody(
+            text: "Hi \(MessageBody.mentionPlaceholder)",
+            ranges: MessageBodyRanges(
+                mentions: [NSRange(location: 3, length: 1): mentionedAci],
+                styles: []
+            )
+        )
+
+        func hydrate() -> HydratedMessageBody {
+            var result: HydratedMessageBody!
+            read { tx in result = cache.hydratedBody(for: messageBody, tx: tx.asV2Read) }
+            return result
+        }
+        func postProfileChange(for aci: Aci) {
+            NotificationCenter.default.post(
+                name: UserProfileNotifications.otherUsersProfileDidChange,
+                object: nil,
+                userInfo: [UserProfileNotifications.profileAddressKey: SignalServiceAddress(aci)]
+            )
+        }
+
+        let first = hydrate()
+        XCTAssertTrue(hydrate() === first)
+
+        // Someone who isn't mentioned doesn't affect the entry...
+        postProfileChange(for: otherAci)
+        XCTAssertTrue(hydrate() === first)
+
+        // ...but the mentioned user does.
+        postProfileChange(for: mentionedAci)
+        let second = hydrate()
+        XCTAssertFalse(second === first)
+        XCTAssertEqual(second, first)
+    }
+}
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: AGPL-3.0-only
 //
 
+import GRDB
 import LibSignalClient
 import XCTest
 
@@ -330,4 +331,19 @@ final class DisappearingMessageFinderTest: SSKBaseTest {
         )
         XCTAssertEqual(now - 1000, try XCTUnwrap(nextExpirationTimestamp()))
     }
+
+    func testFailedToStartExpiringUsesPartialIndex() {
+        var queryPlan: String?
+        read { tx in
+            queryPlan = try? Row.fetchAll(
+                tx.unwrapGrdbRead.database,
+                sql: "EXPLAIN QUERY PLAN \(InteractionFinder.messageUniqueIdsWhichFailedToStartExpiringSQL)"
+            ).map { row -> String in row["detail"] }.joined()
+        }
+        XCTAssertEqual(
+            queryPlan,
+            "SCAN \(InteractionRecord.databaseTableName) "
+            + "USING INDEX index_interactions_on_threadUniqueId_storedShouldStartExpireTimer_and_expiresAt"
+        )
+    }
 }
@@ -0,0 +1,48 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+
+@testable import SignalServiceKit
+
+final class DisappearingMessagesExpirationSchedulerTest: XCTestCase {
+    private let queue = DispatchQueue(label: "DisappearingMessagesExpirationSchedulerTest")
+
+    func testNeedsSeed() {
+        let scheduler = DisappearingMessagesExpirationScheduler(queue: queue, handleExpiration: {})
+        queue.sync {
+            XCTAssertTrue(scheduler.needsSeed)
+
+            scheduler.seed(expirationTimestamps: [], isComplete: true)
+            XCTAssertFalse(scheduler.needsSeed)
+
+            // A truncated seed needs to be reloaded once later expirations are all
+            // that's left.
+            let now = Date.ows_millisecondTimestamp()
+            scheduler.seed(expirationTimestamps: [NSNumber(value: now + 60_000)], isComplete: false)
+            XCTAssertFalse(scheduler.needsSeed)
+        }
+    }
+
+    func testFiresAfterExpiration() {
+        let expectation = self.expectation(description: "fired")
+        let scheduler = DisappearingMessagesExpirationScheduler(queue: queue, handleExpiration: {
+            expectation.fulfill()
+        })
+        scheduler.setIsEnabled(true)
+        scheduler.schedule(expirationTimestamp: Date.ows_millisecondTimestamp())
+        waitForExpectations(timeout: 5)
+    }
+
+    func testDoesNotFireWhileDisabled() {
+        let expectation = self.expectation(description: "fired")
+        expectation.isInverted = true
+        let scheduler = DisappearingMessagesExpirationScheduler(queue: queue, handleExpiration: {
+            expectation.fulfill()
+        })
+        scheduler.schedule(expirationTimestamp: Date.ows_millisecondTimestamp())
+        waitForExpectations(timeout: 2)
+    }
+}
@@ -201,6 +201,26 @@ final class DisplayableGroupUpdateItemCopyTest: XCTestCase {
             XCTAssertFalse(example.localizedText.string.contains("(null)"))
         }
     }
+
+    func testCacheFindsReferencedAddresses() {
+        let cases: [(DisplayableGroupUpdateItem, [SignalServiceAddress])] = [
+            (.genericUpdateByLocalUser, []),
+            (.otherUsersInvitedAfterMigration(count: 2), []),
+            (.otherUserJoined(userName: .otherUser1, userAddress: .otherUser1), [.otherUser1]),
+            (
+                .otherUserAddedByOtherUser(
+                    updaterName: .otherUser1,
+                    updaterAddress: .otherUser1,
+                    userName: .otherUser2,
+                    userAddress: .otherUser2
+                ),
+                [.otherUser1, .otherUser2]
+            ),
+        ]
+        for (item, expectedAddresses) in cases {
+            XCTAssertEqual(DisplayableGroupUpdateItemCache.addresses(referencedBy: item), expectedAddresses)
+        }
+    }
 }
 
 // MARK: - Mock data
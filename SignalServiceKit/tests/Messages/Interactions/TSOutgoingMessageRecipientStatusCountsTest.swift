@@ -0,0 +1,68 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+
+@testable import SignalServiceKit
+
+final class TSOutgoingMessageRecipientStatusCountsTest: XCTestCase {
+    func testCountsFollowStatusChanges() {
+        let states: [TSOutgoingMessageRecipientState] = [
+            TSOutgoingMessageRecipientState(status: .sending),
+            TSOutgoingMessageRecipientState(status: .sending),
+            TSOutgoingMessageRecipientState(status: .skipped),
+        ]
+        let counts = TSOutgoingMessageRecipientStatusCounts(recipientStates: states)
+        XCTAssertEqual(counts.messageState, .sending)
+        XCTAssertEqual(counts.sentCount, 0)
+
+        states[0].updateStatus(.sent)
+        XCTAssertEqual(counts.messageState, .sending)
+        XCTAssertEqual(counts.sentCount, 1)
+
+        states[1].updateStatus(.failed)
+        XCTAssertEqual(counts.messageState, .failed)
+
+        states[1].updateStatus(.pending)
+        XCTAssertEqual(counts.messageState, .pending)
+
+        states[1].updateStatus(.delivered)
+        states[0].updateStatus(.read)
+        XCTAssertEqual(counts.messageState, .sent)
+        XCTAssertEqual(counts.sentCount, 2)
+        XCTAssertEqual(counts.deliveredCount, 2)
+        XCTAssertEqual(counts.readCount, 1)
+        XCTAssertEqual(counts.viewedCount, 0)
+        XCTAssertEqual(counts.count(of: .skipped), 1)
+    }
+
+    func testMatchesMessageStateForRecipientStates() {
+        let statuses: [OWSOutgoingMessageRecipientStatus] = [.failed, .skipped, .sent, .delivered, .read, .viewed]
+        for status in statuses {
+            let states = [
+                TSOutgoingMessageRecipientState(status: .sent),
+                TSOutgoingMessageRecipientState(status: status),
+            ]
+            XCTAssertEqual(
+                TSOutgoingMessageRecipientStatusCounts(recipientStates: states).messageState,
+                TSOutgoingMessage.messageStateForRecipientStates(states)
+            )
+        }
+        XCTAssertEqual(TSOutgoingMessageRecipientStatusCounts(recipientStates: []).messageState, .sent)
+    }
+
+    func testSharedStatesInvalidatePreviousCounts() {
+        let state = TSOutgoingMessageRecipientState(status: .sending)
+        let firstCounts = TSOutgoingMessageRecipientStatusCounts(recipientStates: [state])
+        XCTAssertTrue(firstCounts.isValid)
+
+        let secondCounts = TSOutgoingMessageRecipientStatusCounts(recipientStates: [state])
+        XCTAssertFalse(firstCounts.isValid)
+        XCTAssertTrue(secondCounts.isValid)
+
+        state.updateStatus(.sent)
+        XCTAssertEqual(secondCounts.messageState, .sent)
+    }
+}
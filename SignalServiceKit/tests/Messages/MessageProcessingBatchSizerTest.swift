@@ -0,0 +1,48 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+
+@testable import SignalServiceKit
+
+class MessageProcessingBatchSizerTest: XCTestCase {
+    func testStartsAtMinimum() {
+        let sizer = MessageProcessingBatchSizer()
+        XCTAssertEqual(sizer.nextBatchSize(policy: .foreground), 1)
+        XCTAssertEqual(sizer.nextBatchSize(policy: .background), 1)
+    }
+
+    func testGrowsGraduallyWhenCheap() {
+        var sizer = MessageProcessingBatchSizer()
+        var batchSizes = [Int]()
+        for _ in 0..<10 {
+            let batchSize = sizer.nextBatchSize(policy: .foreground)
+            batchSizes.append(batchSize)
+            // 0.1ms per envelope.
+            sizer.recordBatch(envelopeCount: batchSize, duration: 0.0001 * Double(batchSize))
+        }
+        XCTAssertEqual(Array(batchSizes.prefix(5)), [1, 2, 4, 8, 16])
+        XCTAssertEqual(batchSizes.last, MessageProcessingBatchSizer.Policy.foreground.maxBatchSize)
+    }
+
+    func testShrinksWhenExpensive() {
+        var sizer = MessageProcessingBatchSizer()
+        sizer.recordBatch(envelopeCount: 64, duration: 0.01)
+        XCTAssertEqual(sizer.nextBatchSize(policy: .foreground), 128)
+        for _ in 0..<20 {
+            // 10ms per envelope.
+            sizer.recordBatch(envelopeCount: 8, duration: 0.08)
+        }
+        XCTAssertEqual(sizer.nextBatchSize(policy: .foreground), 5)
+    }
+
+    func testBackgroundPolicyIsCapped() {
+        var sizer = MessageProcessingBatchSizer()
+        sizer.recordBatch(envelopeCount: 16, duration: 0)
+        XCTAssertEqual(sizer.nextBatchSize(policy: .background), MessageProcessingBatchSizer.Policy.background.maxBatchSize)
+        sizer.recordBatch(envelopeCount: 16, duration: 0.0001)
+        XCTAssertEqual(sizer.nextBatchSize(policy: .background), MessageProcessingBatchSizer.Policy.background.maxBatchSize)
+    }
+}
@@ -44,6 +44,42 @@ class MessageSendLogTests: SSKBaseTest {
         }
     }
 
+    func testLargePayloadIsCompressed() throws {
+        try databaseStorage.write { writeTx in
+            let newMessage = createOutgoingMessage(transaction: writeTx)
+            let payloadData = String(repeating: CommonGenerator.sentence, count: 100).data(using: .utf8)!
+            let payloadId = try XCTUnwrap(messageSendLog.recordPayload(payloadData, for: newMessage, tx: writeTx))
+
+            let serviceId = Aci.randomForTesting()
+            messageSendLog.recordPendingDelivery(
+                payloadId: payloadId,
+                recipientAci: serviceId,
+                recipientDeviceId: 1,
+                message: newMessage,
+                tx: writeTx
+            )
+
+            let row = try XCTUnwrap(Row.fetchOne(
+                writeTx.unwrapGrdbRead.database,
+                sql: "SELECT length(plaintextContent) AS storedLength, isCompressed FROM MessageSendLog_Payload WHERE payloadId = ?",
+                arguments: [payloadId]
+            ))
+            XCTAssertEqual(row["isCompressed"] as Bool, true)
+            XCTAssertLessThan(row["storedLength"] as Int, payloadData.count)
+
+            let fetchedPayload = try XCTUnwrap(messageSendLog.fetchPayload(
+                recipientAci: serviceId,
+                recipientDeviceId: 1,
+                timestamp: newMessage.timestamp,
+                tx: writeTx
+            ))
+            XCTAssertEqual(fetchedPayload.plaintextContent, payloadData)
+
+            // Re-recording the same payload must still match it.
+            XCTAssertEqual(messageSendLog.recordPayload(payloadData, for: newMessage, tx: writeTx), payloadId)
+        }
+    }
+
     func testStoreAndRetrievePayloadForInvalidRecipient() throws {
         try databaseStorage.write { writeTx in
             // Create and save the message payload
@@ -477,6 +513,24 @@ class MessageSendLogTests: SSKBaseTest {
         }
     }
 
+    func testCleanupExpiredPayloadsInChunks() throws {
+        let oldIds = try databaseStorage.write { writeTx in
+            return try (0..<600).map { index in
+                let oldMessage = createOutgoingMessage(date: Date(timeIntervalSince1970: 1000 + TimeInterval(index)), transaction: writeTx)
+                let oldData = CommonGenerator.sentence.data(using: .utf8)!
+                return try XCTUnwrap(messageSendLog.recordPayload(oldData, for: oldMessage, tx: writeTx))
+            }
+        }
+
+        try messageSendLog.cleanUpExpiredEntries()
+
+        databaseStorage.read { tx in
+            for oldId in oldIds {
+                XCTAssertFalse(isPayloadAlive(index: oldId, transaction: tx))
+            }
+        }
+    }
+
     func testTimestampMismatch() throws {
         // IOS-1762: Greyson reported an issue where a resent message would have a timestamp mismatch on the outside vs
         // inside of the envelope. In his case, the outside had a timestamp of 1629210680139 versus the inside
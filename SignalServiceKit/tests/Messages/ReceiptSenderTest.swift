@@ -53,4 +53,23 @@ class ReceiptSenderTest: XCTestCase {
         XCTAssertEqual(receiptSets[1].identifier, aci.serviceIdUppercaseString)
         XCTAssertEqual(receiptSets[1].receiptSet.timestamps, [1234])
     }
+
+    func testCollectionWindowIsSkippedWhenReceiptsPileUp() {
+        var sendingState = ReceiptSender.SendingState()
+        XCTAssertFalse(sendingState.shouldSkipCollectionWindow)
+
+        for _ in 1..<ReceiptSender.maxEnqueuedReceiptCount {
+            XCTAssertFalse(sendingState.didEnqueueReceipt())
+        }
+        XCTAssertTrue(sendingState.didEnqueueReceipt())
+        XCTAssertTrue(sendingState.shouldSkipCollectionWindow)
+
+        sendingState.didCloseCollectionWindow()
+        XCTAssertFalse(sendingState.shouldSkipCollectionWindow)
+
+        sendingState.isFlushRequested = true
+        XCTAssertTrue(sendingState.shouldSkipCollectionWindow)
+        sendingState.didCloseCollectionWindow()
+        XCTAssertFalse(sendingState.shouldSkipCollectionWindow)
+    }
 }
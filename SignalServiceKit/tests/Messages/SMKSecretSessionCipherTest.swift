@@ -84,6 +84,57 @@ class SMKSecretSessionCipherTest: XCTestCase {
         XCTAssertEqual(bobPlaintext.senderE164, aliceMockClient.phoneNumber.stringValue)
     }
 
+    func testUnsealThenDecrypt() throws {
+        initializeSessions(aliceMockClient: aliceMockClient, bobMockClient: bobMockClient)
+
+        let trustRoot = IdentityKeyPair.generate()
+        let senderCertificate = Self.createCertificateFor(
+            trustRoot: trustRoot,
+            senderAddress: aliceMockClient.sealedSenderAddress,
+            identityKey: aliceMockClient.identityKeyPair.publicKey,
+            expirationTimestamp: 31337
+        )
+
+        let aliceCipher: SMKSecretSessionCipher = try aliceMockClient.createSecretSessionCipher()
+        let ciphertext = try aliceCipher.encryptMessage(
+            for: bobMockClient.aci,
+            deviceId: bobMockClient.deviceId,
+            paddedPlaintext: "smert za smert".data(using: .utf8)!,
+            contentHint: .default,
+            groupId: nil,
+            senderCertificate: senderCertificate,
+            protocolContext: NullContext()
+        )
+
+        // Unsealing needs only Bob's identity key, and checks the certificate.
+        XCTAssertThrowsError(try SMKSecretSessionCipher.unsealMessage(
+            trustRoot: IdentityKeyPair.generate().publicKey,
+            cipherTextData: ciphertext,
+            timestamp: 31335,
+            identityKeyPair: bobMockClient.identityKeyPair
+        ))
+        let unsealedMessage = try SMKSecretSessionCipher.unsealMessage(
+            trustRoot: trustRoot.publicKey,
+            cipherTextData: ciphertext,
+            timestamp: 31335,
+            identityKeyPair: bobMockClient.identityKeyPair
+        )
+
+        let bobCipher: SMKSecretSessionCipher = try bobMockClient.createSecretSessionCipher()
+        let bobPlaintext = try bobCipher.decryptMessage(
+            trustRoot: trustRoot.publicKey,
+            cipherTextData: ciphertext,
+            timestamp: 31335,
+            localIdentifiers: bobMockClient.localIdentifiers,
+            localDeviceId: bobMockClient.deviceId,
+            unsealedMessage: unsealedMessage,
+            protocolContext: nil
+        )
+        XCTAssertEqual(String(data: bobPlaintext.paddedPayload, encoding: .utf8), "smert za smert")
+        XCTAssertEqual(bobPlaintext.senderDeviceId, aliceMockClient.deviceId)
+        XCTAssertEqual(bobPlaintext.senderAci, aliceMockClient.aci)
+    }
+
     // public void testEncryptDecryptUntrusted() throws Exception {
     func testEncryptDecryptUntrusted() {
         // TestInMemorySignalProtocolStore aliceStore = new TestInMemorySignalProtocolStore();
@@ -0,0 +1,148 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+@testable import SignalServiceKit
+
+final class ThumbnailImageCacheTest: XCTestCase {
+    private func makeThumbnail() -> OWSLoadedThumbnail {
+        let image = UIGraphicsImageRenderer(size: CGSize(width: 4, height: 4)).image { context in
+            UIColor.red.setFill()
+            context.fill(CGRect(x: 0, y: 0, width: 4, height: 4))
+        }
+        return OWSLoadedThumbnail(image: image, data: Data())
+    }
+
+    func testCoalescesAndCaches() {
+        let cache = ThumbnailImageCache(byteLimit: 1024 * 1024)
+        let thumbnail = makeThumbnail()
+
+        let loaderCount = AtomicUInt(0, lock: .sharedGlobal)
+        let loaderStarted = expectation(description: "loader started")
+        let finishLoad = DispatchSemaphore(value: 0)
+        let loader: ThumbnailImageCache.Loader = { success, _ in
+            loaderCount.increment()
+            loaderStarted.fulfill()
+            finishLoad.wait()
+            success(thumbnail)
+        }
+
+        let bothLoaded = expectation(description: "both loaded")
+        bothLoaded.expectedFulfillmentCount = 2
+        for _ in 0..<2 {
+            let request = cache.loadThumbnail(
+                forKey: "a",
+                priority: .normal,
+                loader: loader,
+                success: { XCTAssertIdentical($0, thumbnail); bothLoaded.fulfill() },
+                failure: { XCTFail("Unexpected failure") }
+            )
+            XCTAssertNotNil(request)
+        }
+        wait(for: [loaderStarted], timeout: 5)
+        finishLoad.signal()
+        wait(for: [bothLoaded], timeout: 5)
+
+        XCTAssertEqual(loaderCount.get(), 1)
+
+        // Now it's cached, so success is synchronous.
+        var didHit = false
+        let request = cache.loadThumbnail(
+            forKey: "a",
+            priority: .normal,
+            loader: { _, _ in XCTFail("Unexpected load") },
+            success: { _ in didHit = true },
+            failure: { XCTFail("Unexpected failure") }
+        )
+        XCTAssertNil(request)
+        XCTAssertTrue(didHit)
+        XCTAssertIdentical(cache.cachedThumbnail(forKey: "a"), thumbnail)
+
+        let counters = cache.counters
+        XCTAssertEqual(counters.misses, 2)
+        XCTAssertEqual(counters.coalescedLoads, 1)
+        XCTAssertEqual(counters.hits, 2)
+        XCTAssertEqual(counters.hitRate, 0.5)
+
+        cache.removeThumbnail(forKey: "a")
+        XCTAssertNil(cache.cachedThumbnail(forKey: "a"))
+    }
+
+    func testCancellingBeforeLoadStarts() {
+        let cache = ThumbnailImageCache(byteLimit: 1024 * 1024, maxConcurrentLoadCount: 1)
+
+        // Occupy the only slot so that the next load stays queued.
+        let blockerStarted = expectation(description: "blocker started")
+        let finishBlocker = DispatchSemaphore(value: 0)
+        cache.loadThumbnail(
+            forKey: "blocker",
+            priority: .normal,
+            loader: { _, failure in
+                blockerStarted.fulfill()
+                finishBlocker.wait()
+                failure()
+            },
+            success: { _ in },
+            failure: {}
+        )
+        wait(for: [blockerStarted], timeout: 5)
+
+        let cancelled = expectation(description: "cancelled")
+        let request = cache.loadThumbnail(
+            forKey: "b",
+            priority: .normal,
+            loader: { _, _ in XCTFail("Cancelled loads shouldn't run") },
+            success: { _ in XCTFail("Unexpected success") },
+            failure: { cancelled.fulfill() }
+        )
+        request?.cancel()
+        wait(for: [cancelled], timeout: 5)
+        XCTAssertEqual(cache.counters.cancellations, 1)
+
+        let blockerFinished = expectation(description: "blocker finished")
+        cache.loadThumbnail(
+            forKey: "c",
+            priority: .normal,
+            loader: { _, failure in failure() },
+            success: { _ in },
+            failure: { blockerFinished.fulfill() }
+        )
+        finishBlocker.signal()
+        wait(for: [blockerFinished], timeout: 5)
+    }
+
+    func testCancellingOneOfSeveralWaiters() {
+        let cache = ThumbnailImageCache(byteLimit: 1024 * 1024)
+        let thumbnail = makeThumbnail()
+
+        let finishLoad = DispatchSemaphore(value: 0)
+        let loader: ThumbnailImageCache.Loader = { success, _ in
+            finishLoad.wait()
+            success(thumbnail)
+        }
+
+        let cancelled = expectation(description: "cancelled")
+        let loaded = expectation(description: "loaded")
+        let cancelledRequest = cache.loadThumbnail(
+            forKey: "a",
+            priority: .low,
+            loader: loader,
+            success: { _ in XCTFail("Unexpected success") },
+            failure: { cancelled.fulfill() }
+        )
+        cache.loadThumbnail(
+            forKey: "a",
+            priority: .high,
+            loader: loader,
+            success: { _ in loaded.fulfill() },
+            failure: { XCTFail("Unexpected failure") }
+        )
+        cancelledRequest?.cancel()
+        wait(for: [cancelled], timeout: 5)
+
+        finishLoad.signal()
+        wait(for: [loaded], timeout: 5)
+    }
+}
@@ -0,0 +1,84 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+
+@testable import SignalServiceKit
+
+class ChatRequestSchedulerTest: XCTestCase {
+
+    private let limits = ChatRequestScheduler.Limits(
+        maxInFlightCount: 3,
+        maxInFlightCountPerPriority: [.low: 1, .default: 2, .high: 3]
+    )
+
+    func testPerPriorityLimit() async {
+        let scheduler = ChatRequestScheduler(limits: limits)
+
+        let lowSlot = await scheduler.waitForSlot(priority: .low)
+        XCTAssertTrue(scheduler.hasBackpressure(priority: .low))
+        XCTAssertFalse(scheduler.hasBackpressure(priority: .default))
+        XCTAssertFalse(scheduler.hasBackpressure(priority: .high))
+
+        scheduler.releaseSlot(lowSlot, roundTripDuration: 5)
+        XCTAssertFalse(scheduler.hasBackpressure(priority: .low))
+        XCTAssertEqual(scheduler.stats(priority: .low).requestCount, 1)
+        XCTAssertEqual(scheduler.stats(priority: .low).totalRoundTripDuration, 5)
+    }
+
+    func testHighPriorityStartsFirst() async {
+        let scheduler = ChatRequestScheduler(limits: limits)
+
+        let slots = [
+            await scheduler.waitForSlot(priority: .high),
+            await scheduler.waitForSlot(priority: .high),
+            await scheduler.waitForSlot(priority: .high),
+        ]
+        XCTAssertTrue(scheduler.hasBackpressure(priority: .default))
+
+        let startOrder = AtomicArray<ChatRequestPriority>(lock: .sharedGlobal)
+        let lowTask = Task {
+            let slot = await scheduler.waitForSlot(priority: .low)
+            startOrder.append(.low)
+            return slot
+        }
+        while scheduler.queuedRequestCount(priority: .low) == 0 {
+            await Task.yield()
+        }
+        let highTask = Task {
+            let slot = await scheduler.waitForSlot(priority: .high)
+            startOrder.append(.high)
+            return slot
+        }
+        while scheduler.queuedRequestCount(priority: .high) == 0 {
+            await Task.yield()
+        }
+
+        // Only one slot frees up; it goes to the high priority request even
+        // though the low priority one has been waiting longer.
+        scheduler.releaseSlot(slots[0], roundTripDuration: 0)
+        let highSlot = await highTask.value
+        XCTAssertEqual(startOrder.get(), [.high])
+
+        scheduler.releaseSlot(slots[1], roundTripDuration: 0)
+        let lowSlot = await lowTask.value
+        XCTAssertEqual(startOrder.get(), [.high, .low])
+        XCTAssertGreaterThan(lowSlot.queueDuration, 0)
+
+        for slot in [slots[2], highSlot, lowSlot] {
+            scheduler.releaseSlot(slot, roundTripDuration: 0)
+        }
+        XCTAssertFalse(scheduler.hasBackpressure(priority: .low))
+    }
+
+    func testLowerPrioritiesLeaveRoomForHigh() async {
+        let scheduler = ChatRequestScheduler(limits: limits)
+
+        _ = await scheduler.waitForSlot(priority: .low)
+        _ = await scheduler.waitForSlot(priority: .default)
+        XCTAssertTrue(scheduler.hasBackpressure(priority: .low))
+        XCTAssertFalse(scheduler.hasBackpressure(priority: .high))
+    }
+}
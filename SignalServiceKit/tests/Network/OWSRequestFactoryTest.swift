@@ -67,6 +67,7 @@ class OWSRequestFactoryTest: SSKBaseTest {
         XCTAssertEqual(request.parameters["urgent"] as? Bool, false)
         XCTAssertEqual(try queryItemsAsDictionary(url: url), ["story": "false"])
         XCTAssertEqual(request.allHTTPHeaderFields?["Unidentified-Access-Key"], udAccessKey.keyData.base64EncodedString())
+        XCTAssertEqual(request.priority, .low)
     }
 
     func testSubmitMultiRecipientMessageRequest() throws {
@@ -89,6 +90,7 @@ class OWSRequestFactoryTest: SSKBaseTest {
         XCTAssertEqual(request.allHTTPHeaderFields?["Content-Type"], "application/vnd.signal-messenger.mrm")
         XCTAssertEqual(request.allHTTPHeaderFields?["Unidentified-Access-Key"], udAccessKey.keyData.base64EncodedString())
         XCTAssertEqual(request.httpBody, ciphertext)
+        XCTAssertEqual(request.priority, .low)
     }
 
     // MARK: - Donations
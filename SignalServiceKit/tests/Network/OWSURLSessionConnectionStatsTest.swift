@@ -0,0 +1,43 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+
+@testable import SignalServiceKit
+
+class OWSURLSessionConnectionStatsTest: XCTestCase {
+
+    func testAdd() {
+        var stats = OWSURLSessionConnectionStats()
+        stats.add(.init(isReusedConnection: false, domainLookupDuration: 10, connectDuration: 20, secureConnectionDuration: 30))
+        stats.add(.init(isReusedConnection: false, domainLookupDuration: nil, connectDuration: 5, secureConnectionDuration: 50))
+        stats.add(.init(isReusedConnection: true, domainLookupDuration: nil, connectDuration: nil, secureConnectionDuration: nil))
+        stats.add(.init(isReusedConnection: true, domainLookupDuration: nil, connectDuration: nil, secureConnectionDuration: nil))
+
+        XCTAssertEqual(stats.requestCount, 4)
+        XCTAssertEqual(stats.reusedConnectionCount, 2)
+        XCTAssertEqual(stats.newConnectionCount, 2)
+        XCTAssertEqual(stats.totalDomainLookupDuration, 10)
+        XCTAssertEqual(stats.totalConnectDuration, 25)
+        XCTAssertEqual(stats.totalSecureConnectionDuration, 80)
+        XCTAssertEqual(stats.maxSecureConnectionDuration, 50)
+        XCTAssertEqual(stats.reusedConnectionRatio, 0.5)
+    }
+
+    func testRecordIsPerHost() {
+        let host = "cdn.example.\(UUID().uuidString)"
+        OWSURLSessionConnectionStats.record(
+            .init(isReusedConnection: false, domainLookupDuration: 1, connectDuration: 2, secureConnectionDuration: 3),
+            host: host
+        )
+        OWSURLSessionConnectionStats.record(
+            .init(isReusedConnection: true, domainLookupDuration: nil, connectDuration: nil, secureConnectionDuration: nil),
+            host: host
+        )
+        XCTAssertEqual(OWSURLSessionConnectionStats.stats(host: host).requestCount, 2)
+        XCTAssertEqual(OWSURLSessionConnectionStats.stats(host: host).reusedConnectionCount, 1)
+        XCTAssertEqual(OWSURLSessionConnectionStats.stats(host: "other.\(host)"), OWSURLSessionConnectionStats())
+    }
+}
@@ -28,9 +28,9 @@ class _Upload_AttachmentEncrypterMock: Upload.Shims.AttachmentEncrypter {
         return encryptAttachmentBlock!(unencryptedUrl, encryptedUrl)
     }
 
-    var decryptAttachmentBlock: ((URL, EncryptionMetadata, URL) -> Void)?
-    func decryptAttachment(at encryptedUrl: URL, metadata: EncryptionMetadata, output: URL) throws {
-        return decryptAttachmentBlock!(encryptedUrl, metadata, output)
+    var reencryptAttachmentBlock: ((URL, EncryptionMetadata, URL) -> EncryptionMetadata)?
+    func reencryptAttachment(at encryptedUrl: URL, metadata: EncryptionMetadata, output: URL) throws -> EncryptionMetadata {
+        return reencryptAttachmentBlock!(encryptedUrl, metadata, output)
     }
 }
 
@@ -39,6 +39,8 @@ class _Upload_FileSystemMock: Upload.Shims.FileSystem {
 
     func temporaryFileUrl() -> URL { return URL(string: "file://")! }
 
+    func pendingUploadFileUrl() -> URL { return URL(string: "file://")! }
+
     func deleteFile(url: URL) throws { }
 
     func createTempFileSlice(url: URL, start: Int) throws -> (URL, Int) {
@@ -84,6 +86,7 @@ class _AttachmentUploadManager_ChatConnectionManagerMock: ChatConnectionManager
     func waitForIdentifiedConnectionToOpen() async throws { }
     func canMakeRequests(connectionType: OWSChatConnectionType) -> Bool { true }
     func makeRequest(_ request: TSRequest) async throws -> HTTPResponse { fatalError() }
+    func hasRequestBackpressure(priority: ChatRequestPriority) -> Bool { false }
     func didReceivePush() { }
 }
 
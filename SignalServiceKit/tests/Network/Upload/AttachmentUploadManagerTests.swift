@@ -254,14 +254,10 @@ class AttachmentUploadManagerTests: XCTestCase {
             mockAttachment: attachment
         )
 
-        var didDecrypt = false
-        helper.mockAttachmentEncrypter.decryptAttachmentBlock = { _, encryptionMetadata, _ in
-            didDecrypt = true
+        var didReencrypt = false
+        helper.mockAttachmentEncrypter.reencryptAttachmentBlock = { _, encryptionMetadata, _ in
+            didReencrypt = true
             XCTAssertEqual(encryptionMetadata.key, attachment.encryptionKey)
-        }
-        var didEncrypt = false
-        helper.mockAttachmentEncrypter.encryptAttachmentBlock = { _, _ in
-            didEncrypt = true
             return EncryptionMetadata(
                 key: Data(),
                 digest: Data(),
@@ -294,8 +290,7 @@ class AttachmentUploadManagerTests: XCTestCase {
             XCTAssertEqual(request.allHTTPHeaderFields!["Content-Length"], "\(encryptedSize)")
         } else { XCTFail("Unexpected request encountered.") }
 
-        XCTAssertTrue(didDecrypt)
-        XCTAssertTrue(didEncrypt)
+        XCTAssertTrue(didReencrypt)
     }
 
     func testUseRotatedEncryptionInfo_MediaTierInfoExists() async throws {
@@ -314,14 +309,10 @@ class AttachmentUploadManagerTests: XCTestCase {
             mockAttachment: attachment
         )
 
-        var didDecrypt = false
-        helper.mockAttachmentEncrypter.decryptAttachmentBlock = { _, encryptionMetadata, _ in
-            didDecrypt = true
+        var didReencrypt = false
+        helper.mockAttachmentEncrypter.reencryptAttachmentBlock = { _, encryptionMetadata, _ in
+            didReencrypt = true
             XCTAssertEqual(encryptionMetadata.key, attachment.encryptionKey)
-        }
-        var didEncrypt = false
-        helper.mockAttachmentEncrypter.encryptAttachmentBlock = { _, _ in
-            didEncrypt = true
             return EncryptionMetadata(
                 key: Data(),
                 digest: Data(),
@@ -354,7 +345,6 @@ class AttachmentUploadManagerTests: XCTestCase {
             XCTAssertEqual(request.allHTTPHeaderFields!["Content-Length"], "\(encryptedSize)")
         } else { XCTFail("Unexpected request encountered.") }
 
-        XCTAssertTrue(didDecrypt)
-        XCTAssertTrue(didEncrypt)
+        XCTAssertTrue(didReencrypt)
     }
 }
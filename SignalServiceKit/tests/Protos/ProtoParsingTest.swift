@@ -11,4 +11,32 @@ final class ProtoParsingTest: XCTestCase {
         XCTAssertThrowsError(try SSKProtoEnvelope(serializedData: Data()))
         XCTAssertThrowsError(try SSKProtoEnvelope(serializedData: Data([1, 2, 3])))
     }
+
+    func testNestedWrappersAreBuiltOnceOnAccess() throws {
+        let groupV2Builder = SSKProtoGroupContextV2.builder()
+        groupV2Builder.setMasterKey(Data(repeating: 1, count: 32))
+        groupV2Builder.setRevision(7)
+
+        let bodyRangeBuilder = SSKProtoBodyRange.builder()
+        bodyRangeBuilder.setStart(1)
+        bodyRangeBuilder.setLength(2)
+        bodyRangeBuilder.setStyle(.bold)
+
+        let dataMessageBuilder = SSKProtoDataMessage.builder()
+        dataMessageBuilder.setBody("body")
+        dataMessageBuilder.setGroupV2(groupV2Builder.buildInfallibly())
+        dataMessageBuilder.addBodyRanges(bodyRangeBuilder.buildInfallibly())
+
+        let dataMessage = try SSKProtoDataMessage(serializedData: try dataMessageBuilder.buildSerializedData())
+
+        let groupV2 = try XCTUnwrap(dataMessage.groupV2)
+        XCTAssertEqual(groupV2.revision, 7)
+        XCTAssertIdentical(dataMessage.groupV2, groupV2)
+
+        XCTAssertEqual(dataMessage.bodyRanges.map { $0.start }, [1])
+        XCTAssertIdentical(dataMessage.bodyRanges.first, dataMessage.bodyRanges.first)
+
+        XCTAssertNil(dataMessage.storyContext)
+        XCTAssertEqual(dataMessage.attachments.count, 0)
+    }
 }
@@ -0,0 +1,105 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+@testable import SignalServiceKit
+
+final class CrossProcessChangeJournalTest: XCTestCase {
+    private var fileUrl: URL!
+
+    override func setUp() {
+        super.setUp()
+        fileUrl = URL(fileURLWithPath: OWSFileSystem.temporaryFilePath(fileExtension: "json"))
+    }
+
+    override func tearDown() {
+        try? FileManager.default.removeItem(at: fileUrl)
+        super.tearDown()
+    }
+
+    func testRowIdRanges() {
+        let changes = CrossProcessTableChanges(rowIds: [1, 2, 3, 7, 9, 10])
+        XCTAssertEqual(changes.rowIdRanges, [1...3, 7...7, 9...10])
+        XCTAssertEqual(changes.rowIdCount, 6)
+        XCTAssertTrue(changes.contains(rowId: 2))
+        XCTAssertFalse(changes.contains(rowId: 8))
+
+        let merged = changes.merging(CrossProcessTableChanges(rowIds: [4, 8], hasDeletions: true))
+        XCTAssertEqual(merged.rowIdRanges, [1...4, 7...10])
+        XCTAssertTrue(merged.hasDeletions)
+    }
+
+    func testRowIdRangesAreCapped() {
+        let rowIds = Set((0..<1000).map { Int64($0 * 2) })
+        let changes = CrossProcessTableChanges(rowIds: rowIds)
+        XCTAssertEqual(changes.rowIdRanges.count, CrossProcessTableChanges.maxRowIdRangeCount)
+        for rowId in rowIds {
+            XCTAssertTrue(changes.contains(rowId: rowId))
+        }
+    }
+
+    func testChangesFromOtherProcesses() {
+        let extensionJournal = CrossProcessChangeJournal(fileUrl: fileUrl, pid: 1)
+        let mainAppJournal = CrossProcessChangeJournal(fileUrl: fileUrl, pid: 2)
+
+        XCTAssertEqual(mainAppJournal.lastSequenceNumber(), 0)
+
+        extensionJournal.append(tableChanges: ["model_TSInteraction": CrossProcessTableChanges(rowIds: [5, 6])])
+        extensionJournal.append(tableChanges: [
+            "model_TSInteraction": CrossProcessTableChanges(rowIds: [7]),
+            "model_TSThread": CrossProcessTableChanges(rowIds: [1]),
+        ])
+        mainAppJournal.append(tableChanges: ["model_OWSUserProfile": CrossProcessTableChanges(rowIds: [3])])
+
+        let (changes, lastSequenceNumber) = mainAppJournal.changes(after: 0)
+        XCTAssertEqual(lastSequenceNumber, 3)
+        XCTAssertEqual(changes?.tableNames, ["model_TSInteraction", "model_TSThread"])
+        XCTAssertEqual(changes?.updatedRowIds(tableName: "model_TSInteraction", limit: 100), [5, 6, 7])
+        XCTAssertEqual(changes?.updatedRowIds(tableName: "model_TSInteraction", limit: 2), nil)
+        XCTAssertEqual(changes?.updatedRowIds(tableName: "model_TSAttachment", limit: 100), [])
+
+        let (laterChanges, laterSequenceNumber) = mainAppJournal.changes(after: lastSequenceNumber)
+        XCTAssertEqual(laterSequenceNumber, 3)
+        XCTAssertEqual(laterChanges?.tableNames, [])
+    }
+
+    func testDeletions() {
+        let journal = CrossProcessChangeJournal(fileUrl: fileUrl, pid: 1)
+        journal.append(tableChanges: ["model_TSInteraction": CrossProcessTableChanges(hasDeletions: true)])
+
+        let changes = CrossProcessChangeJournal(fileUrl: fileUrl, pid: 2).changes(after: 0).changes
+        XCTAssertEqual(changes?.didUpdate(tableName: "model_TSInteraction"), true)
+        XCTAssertEqual(changes?.updatedRowIds(tableName: "model_TSInteraction", limit: 100), nil)
+    }
+
+    func testFallingBehind() {
+        let journal = CrossProcessChangeJournal(fileUrl: fileUrl, pid: 1)
+        for rowId in 0..<(CrossProcessChangeJournal.maxEntryCount + 1) {
+            journal.append(tableChanges: ["model_TSInteraction": CrossProcessTableChanges(rowIds: [Int64(rowId)])])
+        }
+        let reader = CrossProcessChangeJournal(fileUrl: fileUrl, pid: 2)
+
+        // The first entry has been dropped.
+        let (changes, lastSequenceNumber) = reader.changes(after: 0)
+        XCTAssertNil(changes)
+        XCTAssertEqual(lastSequenceNumber, UInt64(CrossProcessChangeJournal.maxEntryCount + 1))
+
+        // But the rest are still available.
+        XCTAssertNotNil(reader.changes(after: 1).changes)
+    }
+
+    func testReset() {
+        let journal = CrossProcessChangeJournal(fileUrl: fileUrl, pid: 1)
+        journal.append(tableChanges: ["model_TSInteraction": CrossProcessTableChanges(rowIds: [1])])
+        journal.append(tableChanges: ["model_TSInteraction": CrossProcessTableChanges(rowIds: [2])])
+
+        try! FileManager.default.removeItem(at: fileUrl)
+        journal.append(tableChanges: ["model_TSInteraction": CrossProcessTableChanges(rowIds: [3])])
+
+        let (changes, lastSequenceNumber) = CrossProcessChangeJournal(fileUrl: fileUrl, pid: 2).changes(after: 2)
+        XCTAssertNil(changes)
+        XCTAssertEqual(lastSequenceNumber, 1)
+    }
+}
@@ -0,0 +1,53 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+
+@testable import SignalServiceKit
+
+class DatabaseReadLanesTest: XCTestCase {
+
+    func testHistogramBuckets() {
+        var histogram = DatabaseReadLanes.WaitTimeHistogram()
+        histogram.record(waitTimeMs: 0.5)
+        histogram.record(waitTimeMs: 1)
+        histogram.record(waitTimeMs: 3)
+        histogram.record(waitTimeMs: 5000)
+        XCTAssertEqual(histogram.totalCount, 4)
+        XCTAssertEqual(histogram.counts.first, 2)
+        XCTAssertEqual(histogram.counts[2], 1)
+        XCTAssertEqual(histogram.counts.last, 1)
+    }
+
+    func testBackgroundLaneIsCapped() {
+        let readLanes = DatabaseReadLanes(maximumBackgroundReaderCount: 2)
+        let activeCount = AtomicValue(0, lock: UnfairLock())
+        let maximumActiveCount = AtomicValue(0, lock: UnfairLock())
+        let readExpectations = (0..<6).map { expectation(description: "\($0)") }
+
+        for readExpectation in readExpectations {
+            DispatchQueue.global(qos: .utility).async {
+                let ticket = readLanes.enter()
+                readLanes.didAcquireReader(ticket)
+                let count = activeCount.update { $0 += 1; return $0 }
+                maximumActiveCount.update { $0 = max($0, count) }
+                Thread.sleep(forTimeInterval: 0.02)
+                activeCount.update { $0 -= 1 }
+                readLanes.leave(ticket)
+                readExpectation.fulfill()
+            }
+        }
+
+        // Interactive reads aren't held back by background ones.
+        let interactiveTicket = readLanes.enter()
+        readLanes.didAcquireReader(interactiveTicket)
+        readLanes.leave(interactiveTicket)
+
+        wait(for: readExpectations, timeout: 5)
+        XCTAssertLessThanOrEqual(maximumActiveCount.get(), 2)
+        XCTAssertEqual(readLanes.waitTimeHistogram(for: .background).totalCount, 6)
+        XCTAssertEqual(readLanes.waitTimeHistogram(for: .interactive).totalCount, 1)
+    }
+}
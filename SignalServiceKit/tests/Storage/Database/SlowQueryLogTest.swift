@@ -0,0 +1,43 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import GRDB
+import XCTest
+
+@testable import SignalServiceKit
+
+class SlowQueryLogTest: XCTestCase {
+
+    func testKeepsSlowestStatements() {
+        let slowQueryLog = SlowQueryLog(slowThreshold: 0.01, maxEntryCount: 2)
+        slowQueryLog.record(sql: "fast", duration: 0.001)
+        slowQueryLog.record(sql: "a", duration: 0.02)
+        slowQueryLog.record(sql: "a", duration: 0.04)
+        slowQueryLog.record(sql: "b", duration: 0.03)
+        slowQueryLog.record(sql: "c", duration: 0.05)
+        slowQueryLog.record(sql: "d", duration: 0.011)
+
+        let statements = slowQueryLog.slowestStatements
+        XCTAssertEqual(statements.map { $0.sql }, ["c", "a"])
+        XCTAssertEqual(statements[1].count, 2)
+        XCTAssertEqual(statements[1].totalDuration, 0.06, accuracy: 0.0001)
+    }
+
+    func testReportIncludesQueryPlan() throws {
+        let slowQueryLog = SlowQueryLog(slowThreshold: 0.01)
+        let databaseQueue = DatabaseQueue()
+        try databaseQueue.write { db in
+            try db.execute(sql: "CREATE TABLE t (id INTEGER PRIMARY KEY, value TEXT)")
+        }
+        slowQueryLog.record(sql: "SELECT * FROM t WHERE value = ?", duration: 0.5)
+        slowQueryLog.record(sql: "COMMIT TRANSACTION", duration: 0.2)
+
+        let lines = databaseQueue.read { slowQueryLog.reportLines(db: $0) }
+        XCTAssertEqual(lines.count, 3)
+        XCTAssertTrue(lines[0].hasPrefix("#1: max 500.0ms"))
+        XCTAssertTrue(lines[1].contains("SCAN"))
+        XCTAssertTrue(lines[2].hasPrefix("#2: max 200.0ms"))
+    }
+}
@@ -92,6 +92,66 @@ class InteractionFinderTest: SSKBaseTest {
             XCTAssertEqual(unarchivedCount, unreadCount)
         }
     }
+
+    func testFirstInteractionAtOrAroundSortId() {
+        let thread = TSContactThread(contactAddress: SignalServiceAddress(phoneNumber: "+13213334444"))
+        let messages = ["one", "two", "three"].map { TSOutgoingMessage(in: thread, messageBody: $0) }
+        write { transaction in
+            thread.anyInsert(transaction: transaction)
+            messages.forEach { $0.anyInsert(transaction: transaction) }
+        }
+
+        let finder = InteractionFinder(threadUniqueId: thread.uniqueId)
+        func interactionId(around message: TSMessage) -> String? {
+            var result: String?
+            read { result = finder.firstInteraction(atOrAroundSortId: message.sortId, transaction: $0)?.uniqueId }
+            return result
+        }
+
+        XCTAssertEqual(interactionId(around: messages[1]), messages[1].uniqueId)
+
+        // If the interaction is gone, prefer the one before it...
+        write { transaction in
+            DependenciesBridge.shared.interactionDeleteManager.delete(messages[1], sideEffects: .default(), tx: transaction.asV2Write)
+        }
+        XCTAssertEqual(interactionId(around: messages[1]), messages[0].uniqueId)
+
+        // ...then the one after it.
+        write { transaction in
+            DependenciesBridge.shared.interactionDeleteManager.delete(messages[0], sideEffects: .default(), tx: transaction.asV2Write)
+        }
+        XCTAssertEqual(interactionId(around: messages[0]), messages[2].uniqueId)
+    }
+
+    func testUnreadCountIsMaintained() {
+        var thread: TSContactThread!
+        var messages = [TSIncomingMessage]()
+        write { transaction in
+            thread = ContactThreadFactory().create(transaction: transaction)
+            let messageFactory = IncomingMessageFactory()
+            messageFactory.threadCreator = { _ in return thread }
+            messages = messageFactory.create(count: 4, transaction: transaction)
+        }
+
+        let finder = InteractionFinder(threadUniqueId: thread.uniqueId)
+        read { XCTAssertEqual(finder.unreadCount(transaction: $0), 4) }
+
+        write { transaction in
+            messages[0].debugonly_markAsReadNow(transaction: transaction)
+            DependenciesBridge.shared.interactionDeleteManager.delete(messages[1], sideEffects: .default(), tx: transaction.asV2Write)
+        }
+        read { XCTAssertEqual(finder.unreadCount(transaction: $0), 2) }
+
+        // Counts that drift are corrected by the repair pass.
+        write { transaction in
+            try! transaction.unwrapGrdbWrite.database.execute(
+                sql: "UPDATE \(ThreadUnreadCounts.tableName) SET \(ThreadUnreadCounts.unreadCountColumn) = 7"
+            )
+            XCTAssertEqual(try! ThreadUnreadCounts.repair(tx: transaction), 1)
+            XCTAssertEqual(try! ThreadUnreadCounts.repair(tx: transaction), 0)
+        }
+        read { XCTAssertEqual(finder.unreadCount(transaction: $0), 2) }
+    }
 }
 
 // MARK: -
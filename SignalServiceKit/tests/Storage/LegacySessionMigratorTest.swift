@@ -0,0 +1,80 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import LibSignalClient
+import XCTest
+
+@testable import SignalServiceKit
+
+class LegacySessionMigratorTest: SSKBaseTest {
+    private func makeMigrator() -> LegacySessionMigrator {
+        return LegacySessionMigrator(
+            appContext: CurrentAppContext(),
+            db: DependenciesBridge.shared.db,
+            keyValueStoreFactory: DependenciesBridge.shared.keyValueStoreFactory
+        )
+    }
+
+    private func sessionKeyValueStore(for identity: OWSIdentity) -> KeyValueStore {
+        return DependenciesBridge.shared.keyValueStoreFactory.keyValueStore(collection: SSKSessionStore.collection(for: identity))
+    }
+
+    private func makeLegacySessionRecord() -> LegacySessionRecord {
+        let state = LegacySessionState()
+        state.version = 3
+        state.localIdentityKey = ECKeyPair.generateKeyPair().publicKey
+        state.remoteIdentityKey = ECKeyPair.generateKeyPair().publicKey
+        state.rootKey = LegacyRootKey(data: Randomness.generateRandomBytes(32))
+        state.setSenderChain(ECKeyPair.generateKeyPair(), chainKey: LegacyChainKey(data: Randomness.generateRandomBytes(32), index: 0))
+        state.remoteRegistrationId = 1234
+        state.localRegistrationId = 5678
+        let record = LegacySessionRecord()
+        record.setState(state)
+        return record
+    }
+
+    func testConvertsLegacySessions() async throws {
+        let aciRecords = (0..<3).map { _ in makeLegacySessionRecord() }
+        let pniRecord = makeLegacySessionRecord()
+        let serializedSession = Data(try SessionRecord(bytes: pniRecord.serializeProto()).serialize())
+
+        let db = DependenciesBridge.shared.db
+        db.write { tx in
+            let aciStore = sessionKeyValueStore(for: .aci)
+            for (index, record) in aciRecords.enumerated() {
+                aciStore.setObject([Int32(1): record] as [Int32: AnyObject], key: "aci-\(index)", transaction: tx)
+            }
+            aciStore.setObject([Int32(1): serializedSession as NSData] as [Int32: AnyObject], key: "aci-current", transaction: tx)
+            sessionKeyValueStore(for: .pni).setObject([Int32(2): pniRecord] as [Int32: AnyObject], key: "pni-0", transaction: tx)
+        }
+
+        // The first batch covers all the ACI sessions.
+        let firstResult = try await makeMigrator().runNextBatch()
+        XCTAssertEqual(firstResult.visitedCount, 4)
+        XCTAssertFalse(firstResult.isComplete)
+
+        // A new migrator resumes where the last one left off.
+        let secondResult = try await makeMigrator().runNextBatch()
+        XCTAssertEqual(secondResult.visitedCount, 1)
+        XCTAssertFalse(secondResult.isComplete)
+
+        let lastResult = try await makeMigrator().runNextBatch()
+        XCTAssertTrue(lastResult.isComplete)
+
+        try db.read { tx in
+            let aciStore = sessionKeyValueStore(for: .aci)
+            for (index, record) in aciRecords.enumerated() {
+                let sessions = try XCTUnwrap(aciStore.getObject(forKey: "aci-\(index)", transaction: tx) as? [Int32: AnyObject])
+                XCTAssertEqual(sessions[1] as? Data, try record.serializeProto())
+            }
+            let currentSessions = try XCTUnwrap(aciStore.getObject(forKey: "aci-current", transaction: tx) as? [Int32: AnyObject])
+            XCTAssertEqual(currentSessions[1] as? Data, serializedSession)
+
+            let pniSessions = try XCTUnwrap(sessionKeyValueStore(for: .pni).getObject(forKey: "pni-0", transaction: tx) as? [Int32: AnyObject])
+            let pniData = try XCTUnwrap(pniSessions[2] as? Data)
+            XCTAssertEqual(Data(try SessionRecord(bytes: pniData).serialize()), serializedSession)
+        }
+    }
+}
@@ -30,6 +30,14 @@ private class FakeAdapter: ModelCacheAdapter<OWSUserProfile.Address, OWSUserProf
     }
 }
 
+private class CopyingFakeAdapter: FakeAdapter {
+    override func copy(value: ValueType) throws -> ValueType {
+        return value.shallowCopy()
+    }
+
+    override var storesOwnCopies: Bool { true }
+}
+
 class ModelReadCacheTest: SSKBaseTest {
     private lazy var adapter = { FakeAdapter(cacheName: "fake", cacheCountLimit: 1024, cacheCountLimitNSE: 1024) }()
 
@@ -334,4 +342,46 @@ class ModelReadCacheTest: SSKBaseTest {
             }
         }
     }
+
+    func testCounters() {
+        let cachedAddress: OWSUserProfile.Address = .otherUser(SignalServiceAddress.randomForTesting())
+        let uncachedAddress: OWSUserProfile.Address = .otherUser(SignalServiceAddress.randomForTesting())
+        adapter.storage[cachedAddress] = OWSUserProfile(address: cachedAddress)
+        adapter.storage[uncachedAddress] = OWSUserProfile(address: uncachedAddress)
+        read { [unowned self] transaction in
+            let cache = TestableModelReadCache(mode: .read, adapter: adapter)
+            cache.writeToCache(
+                cacheKey: adapter.cacheKey(forKey: cachedAddress),
+                value: adapter.storage[cachedAddress]!
+            )
+
+            let keys = [cachedAddress, uncachedAddress].map { adapter.cacheKey(forKey: $0) }
+            _ = cache.getValues(for: keys, transaction: transaction)
+            XCTAssertEqual(cache.counters, ModelReadCacheCounters(hits: 1, misses: 1))
+
+            _ = cache.getValuesIfInCache(for: [cachedAddress, uncachedAddress], transaction: transaction)
+            XCTAssertEqual(cache.counters, ModelReadCacheCounters(hits: 2, misses: 2))
+            XCTAssertEqual(cache.counters.hitRate, 0.5)
+        }
+    }
+
+    func testReadOnlyValuesAreSharedButNotWithWriters() {
+        let adapter = CopyingFakeAdapter(cacheName: "fake", cacheCountLimit: 1024, cacheCountLimitNSE: 1024)
+        let alice: OWSUserProfile.Address = .otherUser(SignalServiceAddress.randomForTesting())
+        let writtenProfile = OWSUserProfile(address: alice)
+        read { transaction in
+            let cache = TestableModelReadCache(mode: .read, adapter: adapter)
+            let key = adapter.cacheKey(forKey: alice)
+            cache.writeToCache(cacheKey: key, value: writtenProfile)
+
+            let readOnly1 = cache.getValues(for: [key], transaction: transaction, copiesValues: false)[0]
+            let readOnly2 = cache.getValues(for: [key], transaction: transaction, copiesValues: false)[0]
+            let copied = cache.getValues(for: [key], transaction: transaction)[0]
+            XCTAssertNotNil(readOnly1)
+            XCTAssertTrue(readOnly1 === readOnly2)
+            XCTAssertFalse(readOnly1 === writtenProfile)
+            XCTAssertFalse(readOnly1 === copied)
+            XCTAssertEqual(copied, writtenProfile)
+        }
+    }
 }
@@ -0,0 +1,65 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import GRDB
+import XCTest
+@testable import SignalServiceKit
+
+class PaymentModelKeysTest: SSKBaseTest {
+    private func buildPaymentModel(incomingTransactionPublicKeys: [Data], spentKeyImages: [Data]) -> TSPaymentModel {
+        let mobileCoin = MobileCoinPayment(recipientPublicAddressData: nil,
+                                           transactionData: nil,
+                                           receiptData: nil,
+                                           incomingTransactionPublicKeys: incomingTransactionPublicKeys,
+                                           spentKeyImages: spentKeyImages,
+                                           outputPublicKeys: nil,
+                                           ledgerBlockTimestamp: 0,
+                                           ledgerBlockIndex: 7,
+                                           feeAmount: nil)
+        return TSPaymentModel(paymentType: .incomingUnidentified,
+                              paymentState: .incomingComplete,
+                              paymentAmount: TSPaymentAmount(currency: .mobileCoin, picoMob: 1000),
+                              createdDate: Date(),
+                              senderOrRecipientAci: nil,
+                              memoMessage: nil,
+                              isUnread: false,
+                              interactionUniqueId: nil,
+                              mobileCoin: mobileCoin)
+    }
+
+    func testLookups() {
+        let publicKey = Randomness.generateRandomBytes(32)
+        let keyImage = Randomness.generateRandomBytes(32)
+        let paymentModel = buildPaymentModel(incomingTransactionPublicKeys: [publicKey], spentKeyImages: [keyImage])
+
+        write { tx in
+            paymentModel.anyInsert(transaction: tx)
+        }
+
+        read { tx in
+            let byPublicKey = PaymentModelKeys.paymentModels(withKey: publicKey, kind: .incomingTransactionPublicKey, tx: tx)
+            XCTAssertEqual(byPublicKey.map { $0.uniqueId }, [paymentModel.uniqueId])
+
+            let byKeyImage = PaymentModelKeys.paymentModels(withKey: keyImage, kind: .spentKeyImage, tx: tx)
+            XCTAssertEqual(byKeyImage.map { $0.uniqueId }, [paymentModel.uniqueId])
+
+            // Keys only match models that have them as the same kind.
+            XCTAssertEqual(PaymentModelKeys.paymentModels(withKey: publicKey, kind: .outputPublicKey, tx: tx).count, 0)
+        }
+
+        write { tx in
+            paymentModel.anyRemove(transaction: tx)
+        }
+
+        read { tx in
+            XCTAssertEqual(PaymentModelKeys.paymentModels(withKey: publicKey, kind: .incomingTransactionPublicKey, tx: tx).count, 0)
+            let keyCount = try! Int.fetchOne(
+                tx.unwrapGrdbRead.database,
+                sql: "SELECT COUNT(*) FROM \(PaymentModelKeys.tableName)"
+            )
+            XCTAssertEqual(keyCount, 0)
+        }
+    }
+}
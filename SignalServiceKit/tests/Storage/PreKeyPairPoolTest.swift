@@ -0,0 +1,30 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import LibSignalClient
+import XCTest
+
+@testable import SignalServiceKit
+
+class PreKeyPairPoolTest: XCTestCase {
+
+    func testTakeReturnsDistinctKeyPairs() {
+        let pool = PreKeyPairPool(targetCount: 4)
+        pool.prepare()
+
+        // Whether or not the pool has filled yet, we get as many as we asked for.
+        let ecKeyPairs = pool.takeECKeyPairs(count: 10)
+        XCTAssertEqual(ecKeyPairs.count, 10)
+        XCTAssertEqual(Set(ecKeyPairs.map { $0.publicKey }).count, 10)
+
+        let kemKeyPairs = pool.takeKEMKeyPairs(count: 10)
+        XCTAssertEqual(kemKeyPairs.count, 10)
+        XCTAssertEqual(Set(kemKeyPairs.map { Data($0.publicKey.serialize()) }).count, 10)
+
+        // Key pairs are never handed out twice.
+        let moreEcKeyPairs = pool.takeECKeyPairs(count: 10)
+        XCTAssertTrue(Set(ecKeyPairs.map { $0.publicKey }).isDisjoint(with: moreEcKeyPairs.map { $0.publicKey }))
+    }
+}
@@ -159,6 +159,41 @@ class SDSDatabaseStorageObservationTest: SSKBaseTest {
         XCTAssertEqual(mockObserver.lastChange?.didUpdate(interaction: unsavedMessage), false)
     }
 
+    func testInteractionChangesByThread() {
+        let (thread, otherThread) = self.write { transaction in
+            return (
+                TSContactThread.getOrCreateThread(withContactAddress: SignalServiceAddress(phoneNumber: "+12345678900"), transaction: transaction),
+                TSContactThread.getOrCreateThread(withContactAddress: SignalServiceAddress(phoneNumber: "+15551234567"), transaction: transaction)
+            )
+        }
+        waitForRunLoop()
+
+        let mockObserver = MockObserver()
+        databaseStorage.appendDatabaseChangeDelegate(mockObserver)
+
+        let message = self.write { transaction in
+            let message = TSOutgoingMessage(in: thread, messageBody: "Hello Alice")
+            message.anyInsert(transaction: transaction)
+            self.databaseStorage.touch(thread: otherThread, shouldReindex: false, transaction: transaction)
+            return message
+        }
+        waitForRunLoop()
+
+        let changesByThread = mockObserver.lastChange?.interactionChangesByThreadUniqueId
+        XCTAssertEqual(changesByThread?[thread.uniqueId]?.insertedInteractionUniqueIds, [message.uniqueId])
+        XCTAssertEqual(changesByThread?[thread.uniqueId]?.isSummaryOnly, false)
+        XCTAssertEqual(changesByThread?[otherThread.uniqueId]?.isSummaryOnly, true)
+
+        mockObserver.clear()
+
+        self.write { transaction in
+            message.update(withHasSyncedTranscript: true, transaction: transaction)
+        }
+        waitForRunLoop()
+
+        XCTAssertEqual(mockObserver.lastChange?.interactionChangesByThreadUniqueId?[thread.uniqueId]?.updatedInteractionUniqueIds, [message.uniqueId])
+    }
+
     private func waitForRunLoop() {
         let expectation = self.expectation(description: "waiting for run loop")
         DispatchQueue.main.async { expectation.fulfill() }
@@ -164,6 +164,42 @@ class SDSDatabaseStorageTest: SSKBaseTest {
         XCTAssertEqual(1, TSThread.anyFetchAll(databaseStorage: storage).count)
         XCTAssertEqual(0, TSInteraction.anyFetchAll(databaseStorage: storage).count)
     }
+
+    func test_coalescedWrites() {
+        let storage = SDSDatabaseStorage.shared
+        let keyValueStore = SDSKeyValueStore(collection: "SDSDatabaseStorageTest")
+        struct TestError: Error {}
+
+        let transactions = AtomicValue<[ObjectIdentifier]>([], lock: UnfairLock())
+        let results = AtomicValue<[String: Result<Void, Error>]>([:], lock: UnfairLock())
+        let completionExpectations = ["a", "b", "c"].map { expectation(description: $0) }
+        for (key, completionExpectation) in zip(["a", "b", "c"], completionExpectations) {
+            storage.coalescedAsyncWrite(
+                block: { tx in
+                    transactions.update { $0.append(ObjectIdentifier(tx)) }
+                    keyValueStore.setBool(true, key: key, transaction: tx)
+                    if key == "b" {
+                        throw TestError()
+                    }
+                },
+                completion: { result in
+                    results.update { $0[key] = result }
+                    completionExpectation.fulfill()
+                }
+            )
+        }
+        wait(for: completionExpectations, timeout: 5)
+
+        XCTAssertEqual(Set(transactions.get()).count, 1)
+        XCTAssertNotNil(try? results.get()["a"]?.get())
+        XCTAssertNil(try? results.get()["b"]?.get())
+        XCTAssertNotNil(try? results.get()["c"]?.get())
+        storage.read { tx in
+            XCTAssertEqual(keyValueStore.getBool("a", transaction: tx), true)
+            XCTAssertNil(keyValueStore.getBool("b", transaction: tx))
+            XCTAssertEqual(keyValueStore.getBool("c", transaction: tx), true)
+        }
+    }
 }
 
 // MARK: -
@@ -217,4 +217,36 @@ class SDSKeyValueStoreTest: SSKBaseTest {
             XCTAssertEqual(0, store.numberOfKeys(transaction: transaction))
         }
     }
+
+    func test_cachedValues() {
+        let cachedStore = SDSKeyValueStore(collection: "test_cachedValues", cachesValues: true)
+        let uncachedStore = SDSKeyValueStore(collection: "test_cachedValues")
+
+        self.write { transaction in
+            cachedStore.setString("a", key: "string", transaction: transaction)
+            XCTAssertEqual(cachedStore.getString("string", transaction: transaction), "a")
+        }
+        self.read { transaction in
+            XCTAssertEqual(cachedStore.getString("string", transaction: transaction), "a")
+            XCTAssertTrue(cachedStore.hasValue(forKey: "string", transaction: transaction))
+            XCTAssertFalse(cachedStore.hasValue(forKey: "missing", transaction: transaction))
+        }
+
+        // Writes through any store for the collection invalidate the cache.
+        self.write { transaction in
+            uncachedStore.setString("b", key: "string", transaction: transaction)
+            XCTAssertEqual(cachedStore.getString("string", transaction: transaction), "b")
+        }
+        self.read { transaction in
+            XCTAssertEqual(cachedStore.getString("string", transaction: transaction), "b")
+        }
+
+        self.write { transaction in
+            uncachedStore.removeAll(transaction: transaction)
+        }
+        self.read { transaction in
+            XCTAssertNil(cachedStore.getString("string", transaction: transaction))
+            XCTAssertFalse(cachedStore.hasValue(forKey: "string", transaction: transaction))
+        }
+    }
 }
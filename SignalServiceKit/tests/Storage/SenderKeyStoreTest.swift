@@ -0,0 +1,54 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import LibSignalClient
+import XCTest
+
+@testable import SignalServiceKit
+
+class SenderKeyStoreTest: SSKBaseTest {
+    override func setUp() {
+        super.setUp()
+        databaseStorage.write { tx in
+            (DependenciesBridge.shared.registrationStateChangeManager as! RegistrationStateChangeManagerImpl).registerForTests(
+                localIdentifiers: .forUnitTests,
+                tx: tx.asV2Write
+            )
+        }
+    }
+
+    func testStoredKeysArePersistedAndReset() throws {
+        let senderKeyStore = SenderKeyStore()
+        let sender = ProtocolAddress(Aci.randomForTesting(), deviceId: 1)
+        let distributionId = UUID()
+
+        let storedRecord = try databaseStorage.write { tx -> Data? in
+            _ = try SenderKeyDistributionMessage(from: sender, distributionId: distributionId, store: senderKeyStore, context: tx)
+            // The write is pending until the transaction is finalized, but
+            // it's visible to the transaction that made it.
+            let record = try senderKeyStore.loadSenderKey(from: sender, distributionId: distributionId, context: tx)
+            return record.map { Data($0.serialize()) }
+        }
+        XCTAssertNotNil(storedRecord)
+
+        // A new store has nothing cached, so it has to find it in the database.
+        for store in [senderKeyStore, SenderKeyStore()] {
+            let record = try databaseStorage.read { tx in
+                try store.loadSenderKey(from: sender, distributionId: distributionId, context: tx)
+            }
+            XCTAssertEqual(record.map { Data($0.serialize()) }, storedRecord)
+        }
+
+        databaseStorage.write { tx in
+            senderKeyStore.resetSenderKeyStore(transaction: tx)
+        }
+        for store in [senderKeyStore, SenderKeyStore()] {
+            let record = try databaseStorage.read { tx in
+                try store.loadSenderKey(from: sender, distributionId: distributionId, context: tx)
+            }
+            XCTAssertNil(record)
+        }
+    }
+}
@@ -32,4 +32,25 @@ final class CRC32Test: XCTestCase {
         crc = crc.update(with: Data([4, 5, 6]))
         XCTAssertEqual(crc.value, 2180413220)
     }
+
+    func testBufferMatchesData() {
+        let data = Randomness.generateRandomBytes(100_000)
+        let expectedValue = CRC32().update(with: data).value
+
+        data.withUnsafeBytes { bytes in
+            XCTAssertEqual(CRC32().update(with: bytes).value, expectedValue)
+
+            // Streaming in pieces gives the same result.
+            var crc = CRC32()
+            var offset = 0
+            while offset < bytes.count {
+                let end = min(offset + 4093, bytes.count)
+                crc = crc.update(with: UnsafeRawBufferPointer(rebasing: bytes[offset..<end]))
+                offset = end
+            }
+            XCTAssertEqual(crc.value, expectedValue)
+
+            XCTAssertEqual(crc.update(with: UnsafeRawBufferPointer(rebasing: bytes[0..<0])).value, expectedValue)
+        }
+    }
 }
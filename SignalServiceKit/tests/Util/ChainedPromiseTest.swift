@@ -78,6 +78,31 @@ public class ChainedPromiseTest: XCTestCase {
         expectSuccess(secondResultPromise, description: "", timeout: 1)
     }
 
+    func testChainingPromiseExpiredDeadline() throws {
+        let chainedPromise = ChainedPromise<Void>()
+
+        let (firstPromise, firstFuture) = Promise<Void>.pending()
+        _ = chainedPromise.enqueue {
+            return firstPromise
+        }
+
+        // The deadline passes while the second block waits its turn.
+        let deadline = WorkDeadline(secondsFromNow: 0.05)
+        let secondResultPromise = chainedPromise.enqueue(deadline: deadline) { () -> Promise<Void> in
+            XCTFail("Shouldn't run expired work.")
+            return .value(())
+        }
+        let thirdResultPromise = chainedPromise.enqueue {
+            return .value(())
+        }
+
+        Thread.sleep(forTimeInterval: 0.1)
+        firstFuture.resolve(())
+
+        expectFailure(secondResultPromise, description: "expired", timeout: 1)
+        expectSuccess(thirdResultPromise, description: "", timeout: 1)
+    }
+
     func testChainingPromiseChainedValue() throws {
         let chainedPromise = ChainedPromise<Int>(initialValue: 1)
 
@@ -0,0 +1,64 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+import XCTest
+
+@testable import SignalServiceKit
+
+class DedupingRingQueueTest: XCTestCase {
+    func testFifoOrder() {
+        var queue = DedupingRingQueue<String, Int>(initialCapacity: 2)
+        for value in 0..<10 {
+            XCTAssertNil(queue.enqueue(value, key: "\(value)"))
+        }
+        XCTAssertEqual(queue.count, 10)
+        XCTAssertEqual(queue.prefix(3), [0, 1, 2])
+        queue.removeFirst(3)
+        XCTAssertEqual(queue.prefix(100), [3, 4, 5, 6, 7, 8, 9])
+    }
+
+    func testReplacementPreservesPosition() {
+        var queue = DedupingRingQueue<String, Int>()
+        XCTAssertNil(queue.enqueue(1, key: "a"))
+        XCTAssertNil(queue.enqueue(2, key: "b"))
+        XCTAssertNil(queue.enqueue(3, key: "c"))
+        XCTAssertEqual(queue.enqueue(20, key: "b"), 2)
+        XCTAssertEqual(queue.count, 3)
+        XCTAssertEqual(queue.prefix(3), [1, 20, 3])
+    }
+
+    func testRemovedKeysCanBeEnqueuedAgain() {
+        var queue = DedupingRingQueue<String, Int>()
+        XCTAssertNil(queue.enqueue(1, key: "a"))
+        queue.removeFirst(1)
+        XCTAssertTrue(queue.isEmpty)
+        XCTAssertNil(queue.enqueue(2, key: "a"))
+        XCTAssertEqual(queue.prefix(1), [2])
+    }
+
+    func testNilKeysAreNeverDuplicates() {
+        var queue = DedupingRingQueue<String, Int>()
+        XCTAssertNil(queue.enqueue(1, key: nil))
+        XCTAssertNil(queue.enqueue(2, key: nil))
+        XCTAssertEqual(queue.prefix(2), [1, 2])
+    }
+
+    func testReplacementAfterWrapAndGrowth() {
+        var queue = DedupingRingQueue<String, Int>(initialCapacity: 4)
+        for value in 0..<3 {
+            XCTAssertNil(queue.enqueue(value, key: "\(value)"))
+        }
+        queue.removeFirst(2)
+        // The head is now in the middle of the buffer; force a wrap and a grow.
+        for value in 3..<9 {
+            XCTAssertNil(queue.enqueue(value, key: "\(value)"))
+        }
+        XCTAssertEqual(queue.enqueue(50, key: "5"), 5)
+        XCTAssertEqual(queue.enqueue(20, key: "2"), 2)
+        XCTAssertEqual(queue.prefix(100), [20, 3, 4, 50, 6, 7, 8])
+        XCTAssertNil(queue.enqueue(0, key: "0"))
+    }
+}
@@ -0,0 +1,120 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import ImageIO
+import UniformTypeIdentifiers
+import XCTest
+
+@testable import SignalServiceKit
+
+class ImageHeaderProbeTest: XCTestCase {
+
+    private func fixture(_ name: String, _ fileExtension: String) -> Data {
+        let url = Bundle(for: Self.self).url(forResource: name, withExtension: fileExtension)!
+        return try! Data(contentsOf: url)
+    }
+
+    private func encode(_ image: UIImage, type: UTType, frameCount: Int = 1, properties: [CFString: Any] = [:]) -> Data {
+        let data = NSMutableData()
+        let destination = CGImageDestinationCreateWithData(data, type.identifier as CFString, frameCount, nil)!
+        for _ in 0..<frameCount {
+            CGImageDestinationAddImage(destination, image.cgImage!, properties as CFDictionary)
+        }
+        XCTAssertTrue(CGImageDestinationFinalize(destination))
+        return data as Data
+    }
+
+    func testPng() throws {
+        let data = UIImage.image(color: .red, size: CGSize(width: 3, height: 5)).pngData()!
+        let probe = try XCTUnwrap(try ImageHeaderProbe.probe(data, imageFormat: .png))
+        XCTAssertEqual(probe.pixelSize, CGSize(width: 3, height: 5))
+        XCTAssertEqual(probe.bitDepth, 8)
+        XCTAssertEqual(probe.frameCount, 1)
+        XCTAssertTrue(probe.hasSupportedColorModel)
+    }
+
+    func testApng() throws {
+        let probe = try XCTUnwrap(try ImageHeaderProbe.probe(fixture("test-apng", "png"), imageFormat: .png))
+        XCTAssertGreaterThan(try XCTUnwrap(probe.frameCount), 1)
+        XCTAssertTrue(fixture("test-apng", "png").imageMetadata(withPath: nil, mimeType: nil).isAnimated)
+        XCTAssertFalse(fixture("test-png", "png").imageMetadata(withPath: nil, mimeType: nil).isAnimated)
+    }
+
+    func testJpeg() throws {
+        let image = UIImage.image(color: .blue, size: CGSize(width: 7, height: 2))
+        let data = image.jpegData(compressionQuality: 0.8)!
+        let probe = try XCTUnwrap(try ImageHeaderProbe.probe(data, imageFormat: .jpeg))
+        XCTAssertEqual(probe.pixelSize, CGSize(width: 7, height: 2))
+        XCTAssertFalse(probe.hasAlpha)
+        XCTAssertTrue(probe.hasSupportedColorModel)
+    }
+
+    func testJpegOrientation() throws {
+        let image = UIImage.image(color: .blue, size: CGSize(width: 7, height: 2))
+        let data = encode(image, type: .jpeg, properties: [
+            kCGImagePropertyOrientation: CGImagePropertyOrientation.right.rawValue,
+        ])
+        let probe = try XCTUnwrap(try ImageHeaderProbe.probe(data, imageFormat: .jpeg))
+        XCTAssertEqual(probe.pixelSize, CGSize(width: 2, height: 7))
+    }
+
+    func testGif() throws {
+        let image = UIImage.image(color: .green, size: CGSize(width: 4, height: 6))
+        let data = encode(image, type: .gif, frameCount: 2)
+        let probe = try XCTUnwrap(try ImageHeaderProbe.probe(data, imageFormat: .gif))
+        XCTAssertEqual(probe.pixelSize, CGSize(width: 4, height: 6))
+        XCTAssertNil(probe.frameCount)
+    }
+
+    func testWebp() throws {
+        let data = fixture("sample-sticker", "webp")
+        let probe = try XCTUnwrap(try ImageHeaderProbe.probe(data, imageFormat: .webp))
+        XCTAssertGreaterThan(probe.pixelSize.width, 0)
+        XCTAssertGreaterThan(probe.pixelSize.height, 0)
+        XCTAssertEqual(probe.frameCount, 1)
+    }
+
+    func testMatchesImageIO() throws {
+        let image = UIImage.image(color: .red, size: CGSize(width: 9, height: 4))
+        let samples: [(Data, ImageFormat)] = [
+            (image.pngData()!, .png),
+            (image.jpegData(compressionQuality: 0.5)!, .jpeg),
+            (encode(image, type: .gif), .gif),
+            (fixture("test-png", "png"), .png),
+        ]
+        for (data, imageFormat) in samples {
+            let probe = try XCTUnwrap(try ImageHeaderProbe.probe(data, imageFormat: imageFormat))
+            let imageSource = CGImageSourceCreateWithData(data as CFData, nil)!
+            let properties = CGImageSourceCopyPropertiesAtIndex(imageSource, 0, nil) as! [CFString: Any]
+            XCTAssertEqual(probe.pixelSize.width, properties[kCGImagePropertyPixelWidth] as? CGFloat)
+            XCTAssertEqual(probe.pixelSize.height, properties[kCGImagePropertyPixelHeight] as? CGFloat)
+        }
+    }
+
+    func testFileMetadataMatchesData() throws {
+        let data = UIImage.image(color: .red, size: CGSize(width: 9, height: 4)).jpegData(compressionQuality: 0.5)!
+        let fileUrl = OWSFileSystem.temporaryFileUrl(fileExtension: "jpg")
+        try data.write(to: fileUrl)
+        defer { try? FileManager.default.removeItem(at: fileUrl) }
+
+        let fileMetadata = Data.imageMetadata(withPath: fileUrl.path, mimeType: MimeType.imageJpeg.rawValue)
+        XCTAssertTrue(fileMetadata.isValid)
+        XCTAssertEqual(fileMetadata.pixelSize, CGSize(width: 9, height: 4))
+        XCTAssertEqual(Data.imageSize(forFilePath: fileUrl.path, mimeType: nil), CGSize(width: 9, height: 4))
+    }
+
+    func testTruncated() {
+        let data = UIImage.image(color: .red, size: CGSize(width: 3, height: 5)).jpegData(compressionQuality: 0.5)!
+        for imageFormat in [ImageFormat.png, .jpeg, .gif, .webp] {
+            XCTAssertThrowsError(try ImageHeaderProbe.probe(data.prefix(3), imageFormat: imageFormat))
+        }
+        XCTAssertFalse(data.prefix(3).imageMetadata(withPath: nil, mimeType: nil).isValid)
+    }
+
+    func testUnprobedFormats() throws {
+        XCTAssertNil(try ImageHeaderProbe.probe(Data(count: 64), imageFormat: .heic))
+        XCTAssertNil(try ImageHeaderProbe.probe(Data(count: 64), imageFormat: .tiff))
+    }
+}
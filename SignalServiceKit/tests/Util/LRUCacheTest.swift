@@ -126,4 +126,44 @@ class LRUCacheTest: SSKBaseTest {
         XCTAssertNil(cache.get(key: key2))
         XCTAssertNil(cache.get(key: key3))
     }
+
+    func testCostTracking() {
+        let budget = LRUCacheMemoryBudget(byteLimit: 1000)
+        let cache = LRUCache<String, String>(maxSize: 16, memoryBudget: budget)
+
+        cache.set(key: "a", value: "a", cost: 30)
+        cache.set(key: "b", value: "b", cost: 40)
+        cache.set(key: "c", value: "c")
+        XCTAssertEqual(cache.totalCost, 70)
+        XCTAssertEqual(cache.count, 3)
+        XCTAssertEqual(budget.totalCost, 70)
+
+        // Replacing an entry replaces its cost.
+        cache.set(key: "a", value: "a", cost: 10)
+        XCTAssertEqual(cache.totalCost, 50)
+        XCTAssertEqual(cache.count, 3)
+
+        cache.remove(key: "b")
+        XCTAssertEqual(cache.totalCost, 10)
+        XCTAssertEqual(cache.count, 2)
+        XCTAssertEqual(budget.totalCost, 10)
+
+        cache.clear()
+        XCTAssertEqual(cache.totalCost, 0)
+        XCTAssertEqual(cache.count, 0)
+        XCTAssertEqual(budget.totalCost, 0)
+    }
+
+    func testBudgetClearsLargestCache() {
+        let budget = LRUCacheMemoryBudget(byteLimit: 100)
+        let largeCache = LRUCache<String, String>(maxSize: 16, memoryBudget: budget)
+        let smallCache = LRUCache<String, String>(maxSize: 16, memoryBudget: budget)
+
+        largeCache.set(key: "a", value: "a", cost: 80)
+        smallCache.set(key: "b", value: "b", cost: 30)
+
+        XCTAssertNil(largeCache.get(key: "a"))
+        XCTAssertEqual(smallCache.get(key: "b"), "b")
+        XCTAssertEqual(budget.totalCost, 30)
+    }
 }
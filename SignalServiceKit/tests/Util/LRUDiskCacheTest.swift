@@ -0,0 +1,68 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+
+@testable import SignalServiceKit
+
+class LRUDiskCacheTest: XCTestCase {
+
+    private var directoryUrl: URL!
+
+    override func setUp() {
+        super.setUp()
+        directoryUrl = OWSFileSystem.temporaryFileUrl(isAvailableWhileDeviceLocked: true)
+    }
+
+    override func tearDown() {
+        try? OWSFileSystem.deleteFileIfExists(url: directoryUrl)
+        super.tearDown()
+    }
+
+    func testStoreAndLookup() throws {
+        let cache = LRUDiskCache(directoryUrl: directoryUrl, maxSize: 1024 * 1024)
+        let key = "https://media.giphy.com/media/abc/200w.mp4"
+        XCTAssertNil(cache.cachedFileUrl(key: key, fileExtension: "mp4"))
+
+        let data = Data(repeating: 7, count: 100)
+        let fileUrl = try cache.store(data, key: key, fileExtension: "mp4")
+        XCTAssertEqual(cache.cachedFileUrl(key: key, fileExtension: "mp4"), fileUrl)
+        XCTAssertEqual(try Data(contentsOf: fileUrl), data)
+
+        // Another cache over the same directory, e.g. in another process.
+        let otherCache = LRUDiskCache(directoryUrl: directoryUrl, maxSize: 1024 * 1024)
+        XCTAssertEqual(otherCache.cachedFileUrl(key: key, fileExtension: "mp4"), fileUrl)
+        XCTAssertNil(otherCache.cachedFileUrl(key: "https://media.giphy.com/media/def/200w.mp4", fileExtension: "mp4"))
+    }
+
+    func testTrimEvictsLeastRecentlyUsed() throws {
+        let cache = LRUDiskCache(directoryUrl: directoryUrl, maxSize: 24 * 1024, minRetainedAge: 60)
+        let keys = (0..<4).map { "https://media.giphy.com/media/\($0)/200w.gif" }
+        let now = Date()
+        for (index, key) in keys.enumerated() {
+            let fileUrl = try cache.store(Data(repeating: 1, count: 10 * 1024), key: key, fileExtension: "gif")
+            // keys[0] is the least recently used; keys[3] was just used.
+            let modificationDate = index == 3 ? now : now.addingTimeInterval(-Double(100 * (4 - index)))
+            try FileManager.default.setAttributes([.modificationDate: modificationDate], ofItemAtPath: fileUrl.path)
+        }
+
+        cache.trim()
+
+        XCTAssertNil(cache.cachedFileUrl(key: keys[0], fileExtension: "gif"))
+        XCTAssertNil(cache.cachedFileUrl(key: keys[1], fileExtension: "gif"))
+        XCTAssertNotNil(cache.cachedFileUrl(key: keys[2], fileExtension: "gif"))
+        XCTAssertNotNil(cache.cachedFileUrl(key: keys[3], fileExtension: "gif"))
+    }
+
+    func testTrimKeepsRecentlyUsed() throws {
+        let cache = LRUDiskCache(directoryUrl: directoryUrl, maxSize: 1, minRetainedAge: 60)
+        let key = "https://media.giphy.com/media/abc/200w.gif"
+        _ = try cache.store(Data(repeating: 1, count: 10 * 1024), key: key, fileExtension: "gif")
+
+        cache.trim()
+
+        XCTAssertNotNil(cache.cachedFileUrl(key: key, fileExtension: "gif"))
+    }
+}
@@ -0,0 +1,38 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+
+@testable import SignalServiceKit
+
+class LaunchTimelineTest: XCTestCase {
+
+    func testReportIndentsContainedSteps() {
+        let launchTimeline = LaunchTimeline()
+        launchTimeline.start(launchStartedAt: 100)
+        launchTimeline.record(name: "Warm caches", startedAt: 100.010, endedAt: 100.030)
+        launchTimeline.record(name: "Open database", startedAt: 100.001, endedAt: 100.005)
+        launchTimeline.record(name: "ProfileManager", startedAt: 100.012, endedAt: 100.020)
+        launchTimeline.record(name: "Set app ready", startedAt: 100.040, endedAt: 100.050)
+
+        XCTAssertEqual(launchTimeline.reportLines(), [
+            "+1.0ms Open database: 4.0ms",
+            "+10.0ms Warm caches: 20.0ms",
+            "  +12.0ms ProfileManager: 8.0ms",
+            "+40.0ms Set app ready: 10.0ms",
+        ])
+    }
+
+    func testStepsEndingAfterReportAreDropped() {
+        let launchTimeline = LaunchTimeline()
+        launchTimeline.start(launchStartedAt: CACurrentMediaTime())
+        launchTimeline.measure("Before") {}
+        let step = launchTimeline.beginStep("After")
+        launchTimeline.logReport()
+        step.end()
+
+        XCTAssertEqual(launchTimeline.steps.map { $0.name }, ["Before"])
+    }
+}
@@ -0,0 +1,39 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+@testable import SignalServiceKit
+
+final class MainThreadSchedulerTest: XCTestCase {
+    func testLanesAndCoalescing() {
+        let scheduler = MainThreadScheduler()
+        var events = [String]()
+        let done = expectation(description: "done")
+
+        scheduler.schedule(.deferrable) { events.append("deferrable") }
+        scheduler.schedule(.normal, coalescingKey: "reload") { events.append("reload 1") }
+        scheduler.schedule(.normal, coalescingKey: "reload") { events.append("reload 2") }
+        scheduler.schedule(.userInteractive) { events.append("tap") }
+        scheduler.schedule(.deferrable) { done.fulfill() }
+
+        wait(for: [done], timeout: 5)
+        XCTAssertEqual(events, ["tap", "reload 2", "deferrable"])
+        XCTAssertEqual(scheduler.executionStats()["reload"]?.count, 1)
+    }
+
+    func testCoalescingPromotesToHigherLane() {
+        let scheduler = MainThreadScheduler()
+        var events = [String]()
+        let done = expectation(description: "done")
+
+        scheduler.schedule(.normal) { events.append("normal") }
+        scheduler.schedule(.deferrable, coalescingKey: "reload") { events.append("reload 1") }
+        scheduler.schedule(.userInteractive, coalescingKey: "reload") { events.append("reload 2") }
+        scheduler.schedule(.deferrable) { done.fulfill() }
+
+        wait(for: [done], timeout: 5)
+        XCTAssertEqual(events, ["reload 2", "normal"])
+    }
+}
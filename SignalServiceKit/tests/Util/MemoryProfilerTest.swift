@@ -0,0 +1,39 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+
+@testable import SignalServiceKit
+
+class MemoryProfilerTest: SSKBaseTest {
+    func testRingBufferKeepsNewestSamples() {
+        let profiler = MemoryProfiler(capacity: 3)
+        for index in 0..<5 {
+            profiler.recordSample(reason: "\(index)")
+        }
+        XCTAssertEqual(profiler.orderedSamples().map { $0.reason }, ["2", "3", "4"])
+    }
+
+    func testCacheSizesAndScreens() {
+        let profiler = MemoryProfiler(capacity: 8)
+        var cache: LRUCache<String, String>? = LRUCache(maxSize: 16)
+        cache!.set(key: "a", value: "a", cost: 10)
+        cache!.set(key: "b", value: "b")
+        profiler.registerCache(cache!, named: "Test")
+        profiler.screenDidAppear("TestScreen")
+
+        profiler.recordSample(reason: nil)
+        let size = profiler.orderedSamples().last?.cacheSizes.first { $0.name == "Test" }?.size
+        XCTAssertEqual(size?.count, 2)
+        XCTAssertEqual(size?.cost, 10)
+        XCTAssertEqual(profiler.orderedSamples().last?.screen, "TestScreen")
+        XCTAssertTrue(profiler.report().contains("TestScreen"))
+
+        // Released caches are no longer reported.
+        cache = nil
+        profiler.recordSample(reason: nil)
+        XCTAssertEqual(profiler.orderedSamples().last?.cacheSizes.count, 0)
+    }
+}
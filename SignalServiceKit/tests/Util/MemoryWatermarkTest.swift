@@ -0,0 +1,25 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+
+@testable import SignalServiceKit
+
+class MemoryWatermarkTest: XCTestCase {
+    func testThresholds() {
+        let megabyte: UInt64 = 1024 * 1024
+        XCTAssertEqual(MemoryWatermark(bytesRemaining: 0), .normal)
+        XCTAssertEqual(MemoryWatermark(bytesRemaining: 1), .critical)
+        XCTAssertEqual(MemoryWatermark(bytesRemaining: 5 * megabyte - 1), .critical)
+        XCTAssertEqual(MemoryWatermark(bytesRemaining: 5 * megabyte), .elevated)
+        XCTAssertEqual(MemoryWatermark(bytesRemaining: 10 * megabyte - 1), .elevated)
+        XCTAssertEqual(MemoryWatermark(bytesRemaining: 10 * megabyte), .normal)
+    }
+
+    func testOrdering() {
+        XCTAssertLessThan(MemoryWatermark.normal, .elevated)
+        XCTAssertLessThan(MemoryWatermark.elevated, .critical)
+    }
+}
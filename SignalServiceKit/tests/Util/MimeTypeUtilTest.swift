@@ -0,0 +1,36 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+
+@testable import SignalServiceKit
+
+class MimeTypeUtilTest: XCTestCase {
+
+    func testClassifyMatchesTables() {
+        let tables: [(MimeTypeUtil.Classification, [String: String])] = [
+            (.video, MimeTypeUtil.supportedVideoMimeTypesToExtensionTypes),
+            (.audio, MimeTypeUtil.supportedAudioMimeTypesToExtensionTypes),
+            (.image, MimeTypeUtil.supportedImageMimeTypesToExtensionTypes),
+            (.definitelyAnimated, MimeTypeUtil.supportedDefinitelyAnimatedMimeTypesToExtensionTypes),
+            (.maybeAnimated, MimeTypeUtil.supportedMaybeAnimatedMimeTypesToExtensionTypes),
+            (.binaryData, MimeTypeUtil.supportedBinaryDataMimeTypesToExtensionTypes),
+        ]
+        let allMimeTypes = Set(tables.flatMap { $0.1.keys }).union(["text/plain", "IMAGE/PNG", ""])
+        for mimeType in allMimeTypes {
+            let classification = MimeTypeUtil.classify(mimeType)
+            for (flag, table) in tables {
+                XCTAssertEqual(classification.contains(flag), table[mimeType] != nil, mimeType)
+            }
+        }
+    }
+
+    func testClassifyAnimatedImages() {
+        XCTAssertEqual(MimeTypeUtil.classify(MimeType.imageGif.rawValue), [.definitelyAnimated, .maybeAnimated])
+        XCTAssertEqual(MimeTypeUtil.classify(MimeType.imagePng.rawValue), [.image, .maybeAnimated])
+        XCTAssertTrue(MimeTypeUtil.isSupportedVisualMediaMimeType(MimeType.imageGif.rawValue))
+        XCTAssertFalse(MimeTypeUtil.isSupportedVisualMediaMimeType(MimeType.applicationPdf.rawValue))
+    }
+}
@@ -0,0 +1,42 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+
+@testable import SignalServiceKit
+
+class MinHeapTest: XCTestCase {
+    func testEmpty() {
+        var heap = MinHeap<Int>()
+        XCTAssertTrue(heap.isEmpty)
+        XCTAssertNil(heap.min)
+        XCTAssertNil(heap.popMin())
+    }
+
+    func testPopsInOrder() {
+        let values = (0..<200).map { _ in Int.random(in: 0..<50) }
+        var heap = MinHeap(values)
+        XCTAssertEqual(heap.count, values.count)
+        var popped = [Int]()
+        while let value = heap.popMin() {
+            popped.append(value)
+        }
+        XCTAssertEqual(popped, values.sorted())
+    }
+
+    func testInterleavedInsertAndPop() {
+        var heap = MinHeap<Int>()
+        heap.insert(5)
+        heap.insert(3)
+        XCTAssertEqual(heap.popMin(), 3)
+        heap.insert(1)
+        heap.insert(4)
+        XCTAssertEqual(heap.min, 1)
+        XCTAssertEqual(heap.popMin(), 1)
+        XCTAssertEqual(heap.popMin(), 4)
+        XCTAssertEqual(heap.popMin(), 5)
+        XCTAssertTrue(heap.isEmpty)
+    }
+}
@@ -0,0 +1,37 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+
+@testable import SignalServiceKit
+
+class NotificationCoalescerTest: XCTestCase {
+    func testFlushAllGroupsByKey() {
+        let flushed = AtomicValue<[String: [Int]]>([:], lock: .init())
+        let coalescer = NotificationCoalescer<String, Int>(window: 60) { key, values in
+            flushed.update { $0[key] = values }
+        }
+        coalescer.add(1, for: "a")
+        coalescer.add(2, for: "b")
+        coalescer.add(3, for: "a")
+        XCTAssertEqual(coalescer.pendingValues(for: "a"), [1, 3])
+
+        coalescer.flushAll()
+        XCTAssertEqual(flushed.get(), ["a": [1, 3], "b": [2]])
+        XCTAssertEqual(coalescer.pendingValues(for: "a"), [])
+    }
+
+    func testFlushesWhenWindowCloses() {
+        let expectation = expectation(description: "flushed")
+        let coalescer = NotificationCoalescer<String, Int>(window: 0.01) { key, values in
+            XCTAssertEqual(key, "a")
+            XCTAssertEqual(values, [1, 2])
+            expectation.fulfill()
+        }
+        coalescer.add(1, for: "a")
+        coalescer.add(2, for: "a")
+        wait(for: [expectation], timeout: 5)
+    }
+}
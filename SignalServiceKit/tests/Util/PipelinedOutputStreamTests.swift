@@ -0,0 +1,64 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+@testable import SignalServiceKit
+
+final class PipelinedOutputStreamTests: XCTestCase {
+
+    func testWritesArriveInOrderWithTheirBoundaries() throws {
+        let outputStream = RecordingOutputStream()
+        let pipelinedStream = PipelinedOutputStream(
+            outputStream: outputStream,
+            maxBatchByteCount: 10,
+            maxPendingBatchCount: 2
+        )
+        let writes = (0..<1000).map { Data("\($0)".utf8) }
+        for data in writes {
+            try pipelinedStream.write(data: data)
+        }
+        try pipelinedStream.close()
+
+        XCTAssertEqual(outputStream.writes, writes)
+        XCTAssertTrue(outputStream.isClosed)
+    }
+
+    func testWriteErrorIsReported() throws {
+        let outputStream = RecordingOutputStream()
+        outputStream.failAfterWriteCount = 5
+        let pipelinedStream = PipelinedOutputStream(
+            outputStream: outputStream,
+            maxBatchByteCount: 1
+        )
+        for i in 0..<10 {
+            // Later writes may or may not see the error, depending on timing.
+            try? pipelinedStream.write(data: Data([UInt8(i)]))
+        }
+        XCTAssertThrowsError(try pipelinedStream.close())
+        XCTAssertEqual(outputStream.writes.count, 5)
+        XCTAssertFalse(outputStream.isClosed)
+    }
+
+    private class RecordingOutputStream: OutputStreamable {
+        var writes = [Data]()
+        var failAfterWriteCount: Int?
+        var isClosed = false
+
+        func write(data: Data) throws {
+            if let failAfterWriteCount, writes.count >= failAfterWriteCount {
+                throw OWSGenericError("Write failed")
+            }
+            writes.append(data)
+        }
+
+        func close() throws {
+            isClosed = true
+        }
+
+        func remove(from: RunLoop, forMode: RunLoop.Mode) { }
+
+        func schedule(in: RunLoop, forMode: RunLoop.Mode) { }
+    }
+}
@@ -0,0 +1,56 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+import XCTest
+
+@testable import SignalServiceKit
+
+class ReadWriteLockTest: XCTestCase {
+
+    func testWritesAreExclusive() {
+        let lock = ReadWriteLock()
+        var sharedVal = 0
+
+        DispatchQueue.concurrentPerform(iterations: 1000) { i in
+            if i % 4 == 0 {
+                lock.withWriteLock { sharedVal += 1 }
+            } else {
+                let val = lock.withReadLock { sharedVal }
+                XCTAssertLessThanOrEqual(val, 250)
+            }
+        }
+
+        XCTAssertEqual(lock.withReadLock { sharedVal }, 250)
+    }
+
+    func testReadsAreShared() {
+        let lock = ReadWriteLock()
+        let bothReading = DispatchGroup()
+        bothReading.enter()
+        bothReading.enter()
+
+        // Each reader waits, holding the read lock, until the other is in too.
+        let readersDone = DispatchGroup()
+        for _ in 0..<2 {
+            DispatchQueue.global().async(group: readersDone) {
+                lock.withReadLock {
+                    bothReading.leave()
+                    XCTAssertEqual(bothReading.wait(timeout: .now() + 5), .success)
+                }
+            }
+        }
+        XCTAssertEqual(readersDone.wait(timeout: .now() + 10), .success)
+    }
+
+    func testThrowingClosureReleasesLock() {
+        let lock = ReadWriteLock()
+        let toThrow = NSError(domain: "ReadWriteLockTest", code: 1, userInfo: nil)
+
+        XCTAssertThrowsError(try lock.withWriteLock { throw toThrow })
+
+        XCTAssertTrue(lock.withWriteLock { true })
+    }
+}
@@ -0,0 +1,43 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+
+@testable import SignalServiceKit
+
+class ReadyFlagTest: XCTestCase {
+
+    func testBlocksRunByPriorityThenRegistrationOrder() {
+        let readyFlag = ReadyFlag(name: "test")
+        var events = [String]()
+        readyFlag.runNowOrWhenDidBecomeReadySync({ events.append("a") })
+        readyFlag.runNowOrWhenDidBecomeReadySync({ events.append("low") }, priority: 1)
+        readyFlag.runNowOrWhenDidBecomeReadySync({ events.append("b") })
+        readyFlag.runNowOrWhenDidBecomeReadySync({ events.append("ui") }, priority: -1)
+        readyFlag.runNowOrWhenDidBecomeReadySync({ events.append("c") })
+
+        readyFlag.setIsReady()
+
+        XCTAssertEqual(events, ["ui", "a", "b", "c", "low"])
+    }
+
+    func testBackgroundBlocksRunOffMainThread() {
+        let readyFlag = ReadyFlag(name: "test")
+        let beforeReady = expectation(description: "before ready")
+        readyFlag.runNowOrWhenDidBecomeReadyInBackground {
+            XCTAssertFalse(Thread.isMainThread)
+            beforeReady.fulfill()
+        }
+
+        readyFlag.setIsReady()
+
+        let afterReady = expectation(description: "after ready")
+        readyFlag.runNowOrWhenDidBecomeReadyInBackground {
+            XCTAssertFalse(Thread.isMainThread)
+            afterReady.fulfill()
+        }
+        wait(for: [beforeReady, afterReady], timeout: 5)
+    }
+}
@@ -0,0 +1,93 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+@testable import SignalServiceKit
+
+/// Benchmarks for SignalServiceKit hot paths.
+///
+/// Record baselines from Xcode's test report (they're stored per device in
+/// the scheme's xcbaselines) so that regressions fail the test.
+final class SignalServiceKitPerformanceTest: SSKBaseTest {
+    private let metrics: [XCTMetric] = [XCTClockMetric(), XCTCPUMetric(), XCTMemoryMetric()]
+
+    // MARK: - Interactions
+
+    func testInteractionInsertPerformance() {
+        let messageCount: UInt = 500
+        measure(metrics: metrics) {
+            write { tx in
+                let thread = ContactThreadFactory().create(transaction: tx)
+                let messageFactory = OutgoingMessageFactory()
+                messageFactory.threadCreator = { _ in thread }
+                _ = messageFactory.create(count: messageCount, transaction: tx)
+            }
+        }
+    }
+
+    func testInteractionFinderPaginationPerformance() throws {
+        let pageSize = 50
+        let thread: TSContactThread = write { tx in
+            let threadFactory = ContactThreadFactory()
+            threadFactory.messageCount = 2000
+            return threadFactory.create(transaction: tx)
+        }
+        let finder = InteractionFinder(threadUniqueId: thread.uniqueId)
+
+        measure(metrics: metrics) {
+            read { tx in
+                // Page from the newest interaction back to the oldest, loading
+                // each page the way the conversation view does.
+                var rowIdFilter: InteractionFinder.RowIdFilter = .newest
+                while true {
+                    let uniqueIds = try! finder.fetchUniqueIdsForConversationView(rowIdFilter: rowIdFilter, limit: pageSize, tx: tx)
+                    let interactions = InteractionFinder.interactions(withInteractionIds: Set(uniqueIds), transaction: tx)
+                    guard let oldestRowId = interactions.compactMap({ $0.sqliteRowId }).min() else {
+                        break
+                    }
+                    rowIdFilter = .before(oldestRowId)
+                }
+            }
+        }
+    }
+
+    // MARK: - Attachments
+
+    private static let attachmentByteCount = 8 * 1024 * 1024
+
+    private func writeRandomPlaintextFile() throws -> URL {
+        let url = OWSFileSystem.temporaryFileUrl()
+        try Randomness.generateRandomBytes(UInt(Self.attachmentByteCount)).write(to: url)
+        addTeardownBlock { try? FileManager.default.removeItem(at: url) }
+        return url
+    }
+
+    func testEncryptAttachmentPerformance() throws {
+        let plaintextUrl = try writeRandomPlaintextFile()
+        let encryptedUrl = OWSFileSystem.temporaryFileUrl()
+        addTeardownBlock { try? FileManager.default.removeItem(at: encryptedUrl) }
+
+        measure(metrics: metrics) {
+            try? FileManager.default.removeItem(at: encryptedUrl)
+            _ = try! Cryptography.encryptAttachment(at: plaintextUrl, output: encryptedUrl)
+        }
+    }
+
+    func testDecryptFilePerformance() throws {
+        let plaintextUrl = try writeRandomPlaintextFile()
+        let encryptedUrl = OWSFileSystem.temporaryFileUrl()
+        let decryptedUrl = OWSFileSystem.temporaryFileUrl()
+        addTeardownBlock {
+            try? FileManager.default.removeItem(at: encryptedUrl)
+            try? FileManager.default.removeItem(at: decryptedUrl)
+        }
+        let metadata = try Cryptography.encryptAttachment(at: plaintextUrl, output: encryptedUrl)
+
+        measure(metrics: metrics) {
+            try? FileManager.default.removeItem(at: decryptedUrl)
+            try! Cryptography.decryptFile(at: encryptedUrl, metadata: metadata, output: decryptedUrl)
+        }
+    }
+}
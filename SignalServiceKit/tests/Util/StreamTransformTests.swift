@@ -4,6 +4,7 @@
 //
 
 import XCTest
+import zlib
 @testable import SignalServiceKit
 
 final class ChunkedStreamTransformTests: XCTestCase {
@@ -179,6 +180,169 @@ final class GzipStreamTransformTests: XCTestCase {
 
         XCTAssertEqual(data1, roundTripData)
     }
+
+    func testRoundtripWithConfiguration() throws {
+        let configuration = GzipStreamTransform.Configuration(
+            compressionLevel: 1,
+            windowBits: 10,
+            memoryLevel: 4,
+            bufferSize: 1024
+        )
+        let outputStream = try GzipStreamTransform(.compress, configuration: configuration)
+        let inputStream = try GzipStreamTransform(.decompress, configuration: configuration)
+
+        let data1 = String(repeating: "abcdefghijklmnopqrstuv", count: 1600).data(using: .utf8)!
+
+        var transformedData = try outputStream.transform(data: data1)
+        transformedData.append(try outputStream.finalize())
+
+        var roundTripData = try inputStream.transform(data: transformedData)
+        roundTripData.append(try inputStream.finalize())
+
+        XCTAssertEqual(data1, roundTripData)
+    }
+}
+
+final class AppleCompressionStreamTransformTests: XCTestCase {
+    private let algorithms: [AppleCompressionStreamTransform.Algorithm] = [.lzfse, .lz4, .zlib, .lzma]
+
+    func testRoundtrip() throws {
+        let data1 = String(repeating: "abcdefghijklmnopqrstuv", count: 1600).data(using: .utf8)!
+        let data2 = Randomness.generateRandomBytes(68000)
+
+        for algorithm in algorithms {
+            let outputStream = try AppleCompressionStreamTransform(.compress, algorithm: algorithm, bufferSize: 1024)
+            let inputStream = try AppleCompressionStreamTransform(.decompress, algorithm: algorithm, bufferSize: 1024)
+
+            var transformedData = try outputStream.transform(data: data1)
+            transformedData.append(try outputStream.transform(data: data2))
+            transformedData.append(try outputStream.finalize())
+
+            // Feed it back in pieces smaller than the buffer.
+            var roundTripData = Data()
+            var offset = 0
+            while offset < transformedData.count {
+                let end = min(offset + 500, transformedData.count)
+                roundTripData.append(try inputStream.transform(data: transformedData.subdata(in: offset..<end)))
+                offset = end
+            }
+            roundTripData.append(try inputStream.finalize())
+
+            XCTAssertEqual(data1 + data2, roundTripData, "\(algorithm)")
+        }
+    }
+
+    func testTruncatedInputFails() throws {
+        let outputStream = try AppleCompressionStreamTransform(.compress, algorithm: .lzfse)
+        let inputStream = try AppleCompressionStreamTransform(.decompress, algorithm: .lzfse)
+
+        var transformedData = try outputStream.transform(data: Randomness.generateRandomBytes(4096))
+        transformedData.append(try outputStream.finalize())
+
+        _ = try inputStream.transform(data: transformedData.prefix(transformedData.count / 2))
+        XCTAssertThrowsError(try inputStream.finalize())
+    }
+}
+
+/// Compares compression engines on backup frames, to pick the trade-off for
+/// backup export and import. Logs the ratio of each; `measure` reports time.
+final class CompressionBenchmarkTests: XCTestCase {
+
+    /// About 10MB of chunked chat item frames, as written by backup export.
+    private lazy var backupData: Data = {
+        let chunkingTransform = ChunkedOutputStreamTransform()
+        var result = Data()
+        for i in 0..<50_000 {
+            var text = BackupProto_Text()
+            text.body = "Message \(i): " + String(repeating: "see you at \(i % 24):00? ", count: 1 + i % 8)
+            var standardMessage = BackupProto_StandardMessage()
+            standardMessage.text = text
+            var chatItem = BackupProto_ChatItem()
+            chatItem.chatID = UInt64(i % 50)
+            chatItem.authorID = UInt64(i % 7)
+            chatItem.dateSent = 1_700_000_000_000 + UInt64(i) * 60_000
+            chatItem.standardMessage = standardMessage
+            var frame = BackupProto_Frame()
+            frame.chatItem = chatItem
+            result.append(try! chunkingTransform.transform(data: try! frame.serializedData()))
+        }
+        return result
+    }()
+
+    private func benchmark(
+        compress: () throws -> StreamTransform & FinalizableStreamTransform,
+        decompress: () throws -> StreamTransform & FinalizableStreamTransform
+    ) throws {
+        let backupData = self.backupData
+        var compressedData = Data()
+        measure {
+            do {
+                let outputStream = try compress()
+                compressedData = Data()
+                var offset = 0
+                // Export writes each frame separately, but they're batched
+                // (see PipelinedOutputStream); use similar sizes here.
+                while offset < backupData.count {
+                    let end = min(offset + 256 * 1024, backupData.count)
+                    compressedData.append(try outputStream.transform(data: backupData.subdata(in: offset..<end)))
+                    offset = end
+                }
+                compressedData.append(try outputStream.finalize())
+
+                let inputStream = try decompress()
+                var roundTripData = try inputStream.transform(data: compressedData)
+                roundTripData.append(try inputStream.finalize())
+                XCTAssertEqual(roundTripData.count, backupData.count)
+            } catch {
+                XCTFail("\(error)")
+            }
+        }
+        Logger.info("\(name): \(backupData.count) -> \(compressedData.count) bytes")
+    }
+
+    func testGzipBestCompression() throws {
+        try benchmark(
+            compress: { try GzipStreamTransform(.compress) },
+            decompress: { try GzipStreamTransform(.decompress) }
+        )
+    }
+
+    func testGzipDefaultCompression() throws {
+        let configuration = GzipStreamTransform.Configuration(compressionLevel: Z_DEFAULT_COMPRESSION, bufferSize: 65_536)
+        try benchmark(
+            compress: { try GzipStreamTransform(.compress, configuration: configuration) },
+            decompress: { try GzipStreamTransform(.decompress, configuration: configuration) }
+        )
+    }
+
+    func testGzipFastestCompression() throws {
+        let configuration = GzipStreamTransform.Configuration(compressionLevel: Z_BEST_SPEED, bufferSize: 65_536)
+        try benchmark(
+            compress: { try GzipStreamTransform(.compress, configuration: configuration) },
+            decompress: { try GzipStreamTransform(.decompress, configuration: configuration) }
+        )
+    }
+
+    func testLzfse() throws {
+        try benchmark(
+            compress: { try AppleCompressionStreamTransform(.compress, algorithm: .lzfse) },
+            decompress: { try AppleCompressionStreamTransform(.decompress, algorithm: .lzfse) }
+        )
+    }
+
+    func testLz4() throws {
+        try benchmark(
+            compress: { try AppleCompressionStreamTransform(.compress, algorithm: .lz4) },
+            decompress: { try AppleCompressionStreamTransform(.decompress, algorithm: .lz4) }
+        )
+    }
+
+    func testAppleZlib() throws {
+        try benchmark(
+            compress: { try AppleCompressionStreamTransform(.compress, algorithm: .zlib) },
+            decompress: { try AppleCompressionStreamTransform(.decompress, algorithm: .zlib) }
+        )
+    }
 }
 
 final class EncryptionStreamTransformTests: XCTestCase {
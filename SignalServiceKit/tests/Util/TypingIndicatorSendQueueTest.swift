@@ -0,0 +1,95 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import XCTest
+
+@testable import SignalServiceKit
+
+class TypingIndicatorSendQueueTest: XCTestCase {
+    private typealias Item = TypingIndicatorSendQueue.Item
+
+    private let now = Date()
+
+    private func drain(_ queue: inout TypingIndicatorSendQueue, from date: Date) -> [Item] {
+        var items = [Item]()
+        var date = date
+        while let nextSendDate = queue.nextSendDate(now: date) {
+            date = nextSendDate
+            if let item = queue.dequeue(now: date) {
+                items.append(item)
+            }
+        }
+        return items
+    }
+
+    func testCoalescesPerThread() {
+        var queue = TypingIndicatorSendQueue()
+        queue.enqueue(.started, threadUniqueId: "a")
+        queue.enqueue(.started, threadUniqueId: "b")
+        queue.enqueue(.started, threadUniqueId: "a")
+
+        XCTAssertEqual(drain(&queue, from: now), [
+            Item(threadUniqueId: "a", action: .started),
+            Item(threadUniqueId: "b", action: .started),
+        ])
+    }
+
+    func testStoppedCancelsUnsentStarted() {
+        var queue = TypingIndicatorSendQueue()
+        queue.enqueue(.started, threadUniqueId: "a")
+        queue.enqueue(.stopped, threadUniqueId: "a")
+
+        XCTAssertTrue(queue.isEmpty)
+        XCTAssertNil(queue.nextSendDate(now: now))
+    }
+
+    func testStoppedOnlySentAfterStarted() {
+        var queue = TypingIndicatorSendQueue()
+        queue.enqueue(.stopped, threadUniqueId: "a")
+        XCTAssertTrue(queue.isEmpty)
+
+        queue.enqueue(.started, threadUniqueId: "a")
+        XCTAssertEqual(queue.dequeue(now: now), Item(threadUniqueId: "a", action: .started))
+        queue.enqueue(.stopped, threadUniqueId: "a")
+        XCTAssertEqual(
+            drain(&queue, from: now),
+            [Item(threadUniqueId: "a", action: .stopped)]
+        )
+    }
+
+    func testSpacesSends() {
+        var queue = TypingIndicatorSendQueue()
+        queue.enqueue(.started, threadUniqueId: "a")
+        queue.enqueue(.started, threadUniqueId: "b")
+
+        XCTAssertEqual(queue.dequeue(now: now)?.threadUniqueId, "a")
+        XCTAssertNil(queue.dequeue(now: now))
+        let nextSendDate = now.addingTimeInterval(TypingIndicatorSendQueue.minimumSendInterval)
+        XCTAssertEqual(queue.nextSendDate(now: now), nextSendDate)
+        XCTAssertEqual(queue.dequeue(now: nextSendDate)?.threadUniqueId, "b")
+    }
+
+    func testUnsentStartedIsForgotten() {
+        var queue = TypingIndicatorSendQueue()
+        queue.enqueue(.started, threadUniqueId: "a")
+        let item = queue.dequeue(now: now)!
+        queue.didNotSend(item)
+
+        queue.enqueue(.stopped, threadUniqueId: "a")
+        XCTAssertTrue(queue.isEmpty)
+    }
+
+    func testSendingMessageClearsThread() {
+        var queue = TypingIndicatorSendQueue()
+        queue.enqueue(.started, threadUniqueId: "a")
+        _ = queue.dequeue(now: now)
+        queue.enqueue(.started, threadUniqueId: "a")
+        queue.didSendMessage(threadUniqueId: "a")
+        XCTAssertTrue(queue.isEmpty)
+
+        queue.enqueue(.stopped, threadUniqueId: "a")
+        XCTAssertTrue(queue.isEmpty)
+    }
+}
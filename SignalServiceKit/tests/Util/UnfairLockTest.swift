@@ -222,6 +222,31 @@ class UnfairLockTest: XCTestCase {
         XCTAssertTrue(didReacquireLock)
     }
 
+    // MARK: - Contention Stats
+
+    func testContentionStats() {
+        // Setup
+        let label = "UnfairLockTest.\(UUID().uuidString)"
+        let lock = UnfairLock(label: label, recordsContention: true)
+        var sharedVal = 0
+
+        // Test
+        fanout(1000) {
+            lock.withLock {
+                sharedVal += 1
+            }
+        }
+        XCTAssertTrue(lock.tryLock())
+        lock.unlock()
+
+        // Verify
+        let snapshot = LockContentionStats.stats(forLabel: label).snapshot()
+        XCTAssertEqual(sharedVal, 1000)
+        XCTAssertEqual(snapshot.acquireCount, 1001)
+        XCTAssertLessThanOrEqual(snapshot.contendedCount, 1000)
+        XCTAssertGreaterThanOrEqual(snapshot.totalHoldNanoseconds, snapshot.maxHoldNanoseconds)
+    }
+
     // MARK: - Test Helpers
 
     func fanout(_ iterations: Int, _ block: () -> Void) {
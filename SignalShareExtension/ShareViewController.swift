@@ -674,16 +674,29 @@ public class ShareViewController: UIViewController, ShareViewDelegate, SAEFailed
     }
 
     nonisolated private func buildAttachments(for typedItemProviders: [TypedItemProvider]) async throws -> [SignalAttachment] {
-
-        // FIXME: does not use a task group because SignalAttachment likes to load things into RAM and resize them; doing this in parallel can exhaust available RAM
-        var result: [SignalAttachment] = []
-        for typedItemProvider in typedItemProviders {
-            result.append(try await self.buildAttachment(for: typedItemProvider))
+        // Items are copied to disk as they load, but preparing them (decoding
+        // images, transcoding videos) can take a lot of memory, and the share
+        // extension has much less of it than the app. So items are prepared
+        // in parallel only while their estimated cost fits in the budget.
+        let memoryBudget = ShareItemMemoryBudget(watermark: Self.preparationMemoryWatermark)
+        return try await withThrowingTaskGroup(of: (Int, SignalAttachment).self) { taskGroup in
+            for (index, typedItemProvider) in typedItemProviders.enumerated() {
+                taskGroup.addTask {
+                    return (index, try await self.buildAttachment(for: typedItemProvider, memoryBudget: memoryBudget))
+                }
+            }
+            var result = [SignalAttachment?](repeating: nil, count: typedItemProviders.count)
+            for try await (index, attachment) in taskGroup {
+                result[index] = attachment
+            }
+            return result.compacted()
         }
-        return result
     }
 
-    nonisolated private func buildAttachment(for typedItemProvider: TypedItemProvider) async throws -> SignalAttachment {
+    /// How much memory items being prepared may use at once, in bytes.
+    private static let preparationMemoryWatermark: UInt64 = 64 * 1024 * 1024
+
+    nonisolated private func buildAttachment(for typedItemProvider: TypedItemProvider, memoryBudget: ShareItemMemoryBudget) async throws -> SignalAttachment {
         let itemProvider = typedItemProvider.itemProvider
         switch typedItemProvider.itemType {
         case .image:
@@ -694,18 +707,21 @@ public class ShareViewController: UIViewController, ShareViewDelegate, SAEFailed
             //   2) try to load a UIImage directly in the case that is what was sent over
             //   3) try to NSKeyedUnarchive NSData directly into a UIImage
             do {
-                return try await self.buildFileAttachment(fromItemProvider: itemProvider, forTypeIdentifier: typedItemProvider.itemType.typeIdentifier)
+                return try await self.buildFileAttachment(fromItemProvider: itemProvider, forTypeIdentifier: typedItemProvider.itemType.typeIdentifier, memoryBudget: memoryBudget)
             } catch SignalAttachmentError.couldNotParseImage, ShareViewControllerError.fileUrlWasBplist {
                 Logger.warn("failed to parse image directly from file; checking for loading UIImage directly")
-                let image: UIImage = try await Self.loadObjectWithKeyedUnarchiverFallback(fromItemProvider: itemProvider, forTypeIdentifier: typedItemProvider.itemType.typeIdentifier, cannotLoadError: .cannotLoadUIImageObject, failedLoadError: .loadUIImageObjectFailed)
-                return try Self.createAttachment(withImage: image)
+                // We can't tell how large the image is until it's loaded, so load it on its own.
+                return try await memoryBudget.withReservation(Self.preparationMemoryWatermark) {
+                    let image: UIImage = try await Self.loadObjectWithKeyedUnarchiverFallback(fromItemProvider: itemProvider, forTypeIdentifier: typedItemProvider.itemType.typeIdentifier, cannotLoadError: .cannotLoadUIImageObject, failedLoadError: .loadUIImageObjectFailed)
+                    return try Self.createAttachment(withImage: image)
+                }
             }
         case .movie, .pdf, .data:
-            return try await self.buildFileAttachment(fromItemProvider: itemProvider, forTypeIdentifier: typedItemProvider.itemType.typeIdentifier)
+            return try await self.buildFileAttachment(fromItemProvider: itemProvider, forTypeIdentifier: typedItemProvider.itemType.typeIdentifier, memoryBudget: memoryBudget)
         case .fileUrl:
             let url: NSURL = try await Self.loadObjectWithKeyedUnarchiverFallback(fromItemProvider: itemProvider, forTypeIdentifier: typedItemProvider.itemType.typeIdentifier, cannotLoadError: .cannotLoadURLObject, failedLoadError: .loadURLObjectFailed)
-            let attachment = try Self.copyAttachment(fromUrl: url as URL)
-            return try await self.compressVideo(attachment: attachment)
+            let fileUrl = try Self.copyToTemporaryFile(fromUrl: url as URL)
+            return try await self.prepareAttachment(fromTemporaryFileUrl: fileUrl, sourceFilename: (url as URL).lastPathComponent, memoryBudget: memoryBudget)
         case .webUrl:
             let url: NSURL = try await Self.loadObjectWithKeyedUnarchiverFallback(fromItemProvider: itemProvider, forTypeIdentifier: typedItemProvider.itemType.typeIdentifier, cannotLoadError: .cannotLoadURLObject, failedLoadError: .loadURLObjectFailed)
             return try Self.createAttachment(withText: (url as URL).absoluteString)
@@ -733,17 +749,59 @@ public class ShareViewController: UIViewController, ShareViewDelegate, SAEFailed
         }
     }
 
-    nonisolated private static func copyAttachment(fromUrl url: URL, defaultTypeIdentifier: String = UTType.data.identifier) throws -> SignalAttachment {
-        guard let dataSource = try? DataSourcePath(fileUrl: url, shouldDeleteOnDeallocation: false) else {
+    /// Copies a shared file into our own temporary file, since the shared
+    /// file may only be readable for a short time. This is a file-to-file
+    /// copy, so it doesn't load the file into memory.
+    nonisolated private static func copyToTemporaryFile(fromUrl url: URL) throws -> URL {
+        guard url.isFileURL else {
             throw ShareViewControllerError.nonFileUrl
         }
-        dataSource.sourceFilename = url.lastPathComponent
-        let utiType = MimeTypeUtil.utiTypeForFileExtension(url.pathExtension) ?? defaultTypeIdentifier
-        let attachment = SignalAttachment.attachment(dataSource: dataSource, dataUTI: utiType)
-        if let attachmentError = attachment.error {
-            throw attachmentError
+        let temporaryFileUrl = OWSFileSystem.temporaryFileUrl(fileExtension: url.pathExtension)
+        try FileManager.default.copyItem(at: url, to: temporaryFileUrl)
+        return temporaryFileUrl
+    }
+
+    /// Builds an attachment from a file we own, converting images and
+    /// transcoding videos once there's room in `memoryBudget`.
+    nonisolated private func prepareAttachment(
+        fromTemporaryFileUrl fileUrl: URL,
+        sourceFilename: String,
+        defaultTypeIdentifier: String = UTType.data.identifier,
+        memoryBudget: ShareItemMemoryBudget
+    ) async throws -> SignalAttachment {
+        let dataSource = try DataSourcePath(fileUrl: fileUrl, shouldDeleteOnDeallocation: true)
+        dataSource.sourceFilename = sourceFilename
+        let utiType = MimeTypeUtil.utiTypeForFileExtension(fileUrl.pathExtension) ?? defaultTypeIdentifier
+
+        let memoryCost = Self.estimatedPreparationMemoryCost(dataSource: dataSource, utiType: utiType)
+        return try await memoryBudget.withReservation(memoryCost) {
+            let attachment = SignalAttachment.attachment(dataSource: dataSource, dataUTI: utiType)
+            if let attachmentError = attachment.error {
+                throw attachmentError
+            }
+            return try await self.compressVideo(attachment: attachment)
+        }
+    }
+
+    nonisolated private static func estimatedPreparationMemoryCost(dataSource: DataSource, utiType: String) -> UInt64 {
+        guard let type = UTType(utiType) else {
+            return 0
         }
-        return try attachment.cloneAttachment()
+        if type.conforms(to: .audiovisualContent) {
+            // Transcoding streams from file to file, but uses a lot of memory
+            // while it runs, and only one can report progress, so videos are
+            // prepared on their own.
+            return preparationMemoryWatermark
+        }
+        if type.conforms(to: .image) {
+            // Converting an image decodes it into a bitmap.
+            let imageMetadata = dataSource.imageMetadata
+            guard imageMetadata.isValid else {
+                return 0
+            }
+            return UInt64(imageMetadata.pixelSize.width * imageMetadata.pixelSize.height) * 4
+        }
+        return 0
     }
 
     nonisolated private func compressVideo(attachment: SignalAttachment) async throws -> SignalAttachment {
@@ -766,8 +824,8 @@ public class ShareViewController: UIViewController, ShareViewDelegate, SAEFailed
         }
     }
 
-    nonisolated private func buildFileAttachment(fromItemProvider itemProvider: NSItemProvider, forTypeIdentifier typeIdentifier: String) async throws -> SignalAttachment {
-        let attachment: SignalAttachment = try await withCheckedThrowingContinuation { continuation in
+    nonisolated private func buildFileAttachment(fromItemProvider itemProvider: NSItemProvider, forTypeIdentifier typeIdentifier: String, memoryBudget: ShareItemMemoryBudget) async throws -> SignalAttachment {
+        let (fileUrl, sourceFilename): (URL, String) = try await withCheckedThrowingContinuation { continuation in
             _ = itemProvider.loadInPlaceFileRepresentation(forTypeIdentifier: typeIdentifier, completionHandler: { fileUrl, _, error in
                 if let error {
                     continuation.resume(throwing: error)
@@ -776,8 +834,9 @@ public class ShareViewController: UIViewController, ShareViewDelegate, SAEFailed
                         continuation.resume(throwing: ShareViewControllerError.fileUrlWasBplist)
                     } else {
                         do {
-                            // NOTE: Compression here rather than creating an additional temp file would be nice but blocking this completion handler for video encoding is probably not a good way to go.
-                            continuation.resume(returning: try Self.copyAttachment(fromUrl: fileUrl, defaultTypeIdentifier: typeIdentifier))
+                            // The in-place file is only valid during this completion handler; take a
+                            // copy, and prepare it once there's room in the memory budget.
+                            continuation.resume(returning: (try Self.copyToTemporaryFile(fromUrl: fileUrl), fileUrl.lastPathComponent))
                         } catch {
                             continuation.resume(throwing: error)
                         }
@@ -788,11 +847,12 @@ public class ShareViewController: UIViewController, ShareViewDelegate, SAEFailed
             })
         }
 
-        if let attachmentError = attachment.error {
-            throw attachmentError
-        }
-
-        return try await self.compressVideo(attachment: attachment)
+        return try await self.prepareAttachment(
+            fromTemporaryFileUrl: fileUrl,
+            sourceFilename: sourceFilename,
+            defaultTypeIdentifier: typeIdentifier,
+            memoryBudget: memoryBudget
+        )
     }
 
     nonisolated private static func loadDataRepresentation(fromItemProvider itemProvider: NSItemProvider, forTypeIdentifier typeIdentifier: String) async throws -> Data {
@@ -854,7 +914,10 @@ public class ShareViewController: UIViewController, ShareViewDelegate, SAEFailed
             throw ShareViewControllerError.uiImageMissingOrCorruptImageData
         }
         let type = UTType.png
-        let dataSource = DataSourceValue(imagePng, utiType: type.identifier)
+        // Keep the encoded image on disk rather than in memory until it's sent.
+        let fileUrl = OWSFileSystem.temporaryFileUrl(fileExtension: "png")
+        try imagePng.write(to: fileUrl)
+        let dataSource = try DataSourcePath(fileUrl: fileUrl, shouldDeleteOnDeallocation: true)
         let attachment = SignalAttachment.attachment(dataSource: dataSource, dataUTI: type.identifier)
         if let attachmentError = attachment.error {
             throw attachmentError
@@ -902,6 +965,58 @@ extension ShareViewController: UINavigationControllerDelegate {
     }
 }
 
+// MARK: -
+
+/// Limits how much memory the items being prepared for sharing may use at
+/// once. An item that costs more than the whole watermark is prepared on
+/// its own.
+private actor ShareItemMemoryBudget {
+    private let watermark: UInt64
+    private var inFlightCost: UInt64 = 0
+    private var queue = [(cost: UInt64, continuation: CheckedContinuation<Void, Never>)]()
+
+    init(watermark: UInt64) {
+        self.watermark = watermark
+    }
+
+    func acquire(_ cost: UInt64) async {
+        await withCheckedContinuation { continuation in
+            queue.append((cost, continuation))
+            runNextIfPossible()
+        }
+    }
+
+    func release(_ cost: UInt64) {
+        inFlightCost -= cost
+        runNextIfPossible()
+    }
+
+    nonisolated func withReservation<T>(_ cost: UInt64, _ block: () async throws -> T) async throws -> T {
+        await acquire(cost)
+        do {
+            let result = try await block()
+            await release(cost)
+            return result
+        } catch {
+            await release(cost)
+            throw error
+        }
+    }
+
+    private func runNextIfPossible() {
+        // Items start in the order they asked, so a large item isn't starved
+        // by a stream of small ones.
+        while let next = queue.first {
+            guard inFlightCost == 0 || inFlightCost + next.cost <= watermark else {
+                return
+            }
+            queue.removeFirst()
+            inFlightCost += next.cost
+            next.continuation.resume()
+        }
+    }
+}
+
 // Exposes a Progress object, whose progress is updated by polling the return of a given block
 private class ProgressPoller: NSObject {
 
@@ -252,6 +252,9 @@ public class AudioPlayer: NSObject {
             name: AVPlayerItem.didPlayToEndTimeNotification,
             object: audioPlayer.currentItem
         )
+        // The audio is always local, so there's nothing to gain by buffering
+        // before starting to play.
+        audioPlayer.automaticallyWaitsToMinimizeStalling = false
         audioPlayer.rate = playbackRate
         // Pause it; it starts off playing.
         audioPlayer.pause()
@@ -262,6 +265,15 @@ public class AudioPlayer: NSObject {
         }
     }
 
+    /// Sets up the player and starts loading the audio, so that playing it
+    /// later starts right away.
+    public func preload() {
+        AssertIsOnMainThread()
+
+        setupAudioPlayer()
+        audioPlayer?.currentItem?.asset.loadValuesAsynchronously(forKeys: ["playable", "duration"])
+    }
+
     public func stop() {
         delegate?.audioPlaybackState = .stopped
 
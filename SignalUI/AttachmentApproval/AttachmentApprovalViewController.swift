@@ -271,6 +271,8 @@ public class AttachmentApprovalViewController: UIPageViewController, UIPageViewC
         bottomToolViewBottomConstraint = bottomToolView.autoPinEdge(toSuperviewEdge: .bottom)
 
         OWSTableViewController2.removeBackButtonText(viewController: self)
+
+        updateSpeculativeOutputs()
     }
 
     public override func viewWillAppear(_ animated: Bool) {
@@ -432,6 +434,7 @@ public class AttachmentApprovalViewController: UIPageViewController, UIPageViewC
 
         attachmentApprovalItemCollection.remove(item: attachmentApprovalItem)
         approvalDelegate?.attachmentApproval(self, didRemoveAttachment: attachmentApprovalItem.attachment)
+        updateSpeculativeOutputs()
 
         // If media rail needs to be hidden, do it immediately.
         if attachmentApprovalItems.count < 2 {
@@ -642,6 +645,15 @@ public class AttachmentApprovalViewController: UIPageViewController, UIPageViewC
         var promises = [Promise<SignalAttachment>]()
         for attachmentApprovalItem in attachmentApprovalItems {
             let outputQualityLevel = self.outputQualityLevel
+            if
+                !hasEdits(attachmentApprovalItem),
+                let speculativeOutput = speculativeOutputs[ObjectIdentifier(attachmentApprovalItem.attachment)],
+                speculativeOutput.attachment === attachmentApprovalItem.attachment,
+                speculativeOutput.qualityLevel == outputQualityLevel
+            {
+                promises.append(speculativeOutput.promise)
+                continue
+            }
             promises.append(outputAttachmentPromise(for: attachmentApprovalItem).map(on: DispatchQueue.global()) { attachment in
                 attachment.preparedForOutput(qualityLevel: outputQualityLevel)
             })
@@ -649,6 +661,80 @@ public class AttachmentApprovalViewController: UIPageViewController, UIPageViewC
         return Promise.when(fulfilled: promises)
     }
 
+    // MARK: - Speculative Output
+
+    /// Unedited attachments are prepared for output (e.g. images are
+    /// recompressed at the output quality) while the user is still adding a
+    /// caption, so that tapping "send" doesn't have to wait for them.
+    ///
+    /// Edited attachments are rendered when "send" is tapped, since they may
+    /// change until then. (The video editor already starts each trim's render
+    /// as soon as it's made.)
+    private struct SpeculativeOutput {
+        let attachment: SignalAttachment
+        let qualityLevel: ImageQualityLevel
+        let promise: Promise<SignalAttachment>
+        let isCancelled: AtomicBool
+    }
+
+    /// Keyed by the `ObjectIdentifier` of each item's attachment. Only
+    /// accessed on the main thread.
+    private var speculativeOutputs = [ObjectIdentifier: SpeculativeOutput]()
+
+    /// Serial, so that preparing many attachments at once doesn't compete
+    /// with the UI for every core.
+    private let speculativeOutputQueue = DispatchQueue(label: "org.signal.attachment-approval.speculative-output", qos: .userInitiated)
+
+    private func hasEdits(_ attachmentApprovalItem: AttachmentApprovalItem) -> Bool {
+        if let imageEditorModel = attachmentApprovalItem.imageEditorModel, imageEditorModel.isDirty() {
+            return true
+        }
+        if let videoEditorModel = attachmentApprovalItem.videoEditorModel, videoEditorModel.needsRender {
+            return true
+        }
+        return false
+    }
+
+    /// Starts preparing any attachment that isn't being prepared at the
+    /// current output quality, and discards the rest (e.g. after the quality
+    /// changes or an item is removed).
+    private func updateSpeculativeOutputs() {
+        AssertIsOnMainThread()
+
+        let qualityLevel = outputQualityLevel
+        var newSpeculativeOutputs = [ObjectIdentifier: SpeculativeOutput]()
+        for attachmentApprovalItem in attachmentApprovalItems {
+            let attachment = attachmentApprovalItem.attachment
+            let key = ObjectIdentifier(attachment)
+            if
+                let speculativeOutput = speculativeOutputs.removeValue(forKey: key),
+                speculativeOutput.attachment === attachment,
+                speculativeOutput.qualityLevel == qualityLevel
+            {
+                newSpeculativeOutputs[key] = speculativeOutput
+                continue
+            }
+            let isCancelled = AtomicBool(false, lock: .sharedGlobal)
+            let promise = firstly(on: speculativeOutputQueue) { () -> SignalAttachment in
+                guard !isCancelled.get() else {
+                    // The result won't be used.
+                    return attachment
+                }
+                return attachment.preparedForOutput(qualityLevel: qualityLevel)
+            }
+            newSpeculativeOutputs[key] = SpeculativeOutput(
+                attachment: attachment,
+                qualityLevel: qualityLevel,
+                promise: promise,
+                isCancelled: isCancelled
+            )
+        }
+        for staleSpeculativeOutput in speculativeOutputs.values {
+            staleSpeculativeOutput.isCancelled.set(true)
+        }
+        speculativeOutputs = newSpeculativeOutputs
+    }
+
     // For any attachments edited with an editor, returns a
     // new SignalAttachment that reflects those changes.  Otherwise,
     // returns the original attachment.
@@ -1061,6 +1147,7 @@ extension AttachmentApprovalViewController {
         selectionControl.callback = { [weak self, weak actionSheet] qualityLevel in
             self?.outputQualityLevel = qualityLevel
             self?.updateBottomToolView(animated: false)
+            self?.updateSpeculativeOutputs()
 
             if UIAccessibility.isVoiceOverRunning {
                 // Dismissing immediately and without animation prevents VoiceOver engine from reading accessibilityLabel again.
@@ -332,7 +332,24 @@ public class CVText {
 
     // MARK: - CVTextLabel
 
-    private static let bodyTextLabelCache = LRUCache<CacheKey, CVTextLabel.Measurement>(maxSize: cacheSize)
+    // Body text measurements are reused across loads of the conversation
+    // view, including the reloads for theme changes, which don't affect the
+    // cache key. The key contains the whole message body, so the cache is
+    // bounded by the size of its keys as well as their number: a few
+    // long-text messages shouldn't evict the measurements of every short one,
+    // nor hold on to megabytes of text.
+    private static let bodyTextLabelCacheSize: Int = 2000
+    private static let bodyTextLabelCacheMaxCost: Int = 2 * 1024 * 1024
+    private static let bodyTextLabelCache = LRUCache<CacheKey, CVTextLabel.Measurement>(
+        maxSize: bodyTextLabelCacheSize,
+        maxCost: bodyTextLabelCacheMaxCost
+    )
+
+    /// An estimate of the memory used by a body text cache entry.
+    private static func bodyTextLabelCacheCost(cacheKey: CacheKey) -> Int {
+        let measurementSize = 64
+        return cacheKey.utf8.count + measurementSize
+    }
 
     public static func measureBodyTextLabel(config: CVTextLabel.Config, maxWidth: CGFloat) -> CVTextLabel.Measurement {
         let cacheKey = buildCacheKey(configKey: config.cacheKey, maxWidth: maxWidth)
@@ -347,7 +364,11 @@ public class CVText {
         owsAssertDebug(measurement.size == measurement.size.ceil)
 
         if cacheMeasurements {
-            bodyTextLabelCache.set(key: cacheKey, value: measurement)
+            bodyTextLabelCache.set(
+                key: cacheKey,
+                value: measurement,
+                cost: bodyTextLabelCacheCost(cacheKey: cacheKey)
+            )
         }
 
         return measurement
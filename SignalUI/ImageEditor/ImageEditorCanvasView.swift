@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: AGPL-3.0-only
 //
 
+import ImageIO
 import SignalServiceKit
 
 // MARK: - ImageEditorItemBackground
@@ -236,6 +237,15 @@ class ImageEditorCanvasView: UIView {
 
     private var imageLayer = CALayer()
 
+    /// The largest dimension of the copy of the source image that the
+    /// `imageLayer` is showing, or 0 if it isn't showing one yet.
+    ///
+    /// Photos can be far larger than the screen (e.g. 48MP), and compositing
+    /// the full image on every frame makes drawing over it lag, so the canvas
+    /// shows a copy that's only as large as the current transform needs. The
+    /// full image is only used for output.
+    private var displayedImageMaxPixelDimension: CGFloat = 0
+
     func setCornerRadius(_ cornerRadius: CGFloat, animationDuration: TimeInterval = 0) {
         guard cornerRadius != clipView.layer.cornerRadius else { return }
 
@@ -263,11 +273,6 @@ class ImageEditorCanvasView: UIView {
         }
         addSubview(clipView)
 
-        if let srcImage = loadSrcImage() {
-            imageLayer.contents = srcImage.cgImage
-            imageLayer.contentsScale = srcImage.scale
-        }
-
         contentView.isOpaque = false
         contentView.layer.addSublayer(imageLayer)
         contentView.layoutCallback = { [weak self] (_) in
@@ -326,10 +331,6 @@ class ImageEditorCanvasView: UIView {
         return constraints
     }
 
-    private func loadSrcImage() -> UIImage? {
-        return ImageEditorCanvasView.loadSrcImage(model: model)
-    }
-
     class func loadSrcImage(model: ImageEditorModel) -> UIImage? {
         let srcImageData: Data
         do {
@@ -354,6 +355,30 @@ class ImageEditorCanvasView: UIView {
         return srcImage.normalized()
     }
 
+    /// Loads the source image scaled down so that neither dimension exceeds
+    /// `maxPixelDimension`, without decoding it at full size.
+    class func loadSrcImage(model: ImageEditorModel, maxPixelDimension: CGFloat) -> UIImage? {
+        let srcImageSizePixels = model.srcImageSizePixels
+        guard maxPixelDimension < max(srcImageSizePixels.width, srcImageSizePixels.height) else {
+            return loadSrcImage(model: model)
+        }
+        let srcImageUrl = URL(fileURLWithPath: model.srcImagePath)
+        guard
+            let imageSource = CGImageSourceCreateWithURL(srcImageUrl as CFURL, nil),
+            let cgImage = CGImageSourceCreateThumbnailAtIndex(imageSource, 0, [
+                kCGImageSourceCreateThumbnailFromImageAlways: true,
+                // Like normalized(), apply the orientation to the pixels.
+                kCGImageSourceCreateThumbnailWithTransform: true,
+                kCGImageSourceShouldCacheImmediately: true,
+                kCGImageSourceThumbnailMaxPixelSize: maxPixelDimension,
+            ] as CFDictionary)
+        else {
+            owsFailDebug("Couldn't load scaled background image.")
+            return loadSrcImage(model: model)
+        }
+        return UIImage(cgImage: cgImage, scale: 1.0, orientation: .up)
+    }
+
     // MARK: - Text Selection Frame
 
     private var selectedTextFrameLayer: TextFrameLayer?
@@ -604,10 +629,32 @@ class ImageEditorCanvasView: UIView {
 
     private func updateImageLayer() {
         let viewSize = clipView.bounds.size
+        let transform = model.currentTransform()
         ImageEditorCanvasView.updateImageLayer(imageLayer: imageLayer,
                                                viewSize: viewSize,
                                                imageSize: model.srcImageSizePixels,
-                                               transform: model.currentTransform())
+                                               transform: transform)
+        updateDisplayedImageIfNecessary(viewSize: viewSize, transform: transform)
+    }
+
+    /// Loads a larger copy of the source image if the current transform
+    /// shows it at more pixels than the displayed copy has.
+    private func updateDisplayedImageIfNecessary(viewSize: CGSize, transform: ImageEditorTransform) {
+        let srcImageSizePixels = model.srcImageSizePixels
+        let imageFrame = ImageEditorCanvasView.imageFrame(forViewSize: viewSize, imageSize: srcImageSizePixels, transform: transform)
+        let requiredPixelDimension = min(
+            max(srcImageSizePixels.width, srcImageSizePixels.height),
+            (max(imageFrame.width, imageFrame.height) * transform.scaling * UIScreen.main.scale).rounded(.up)
+        )
+        guard requiredPixelDimension > displayedImageMaxPixelDimension else {
+            return
+        }
+        guard let displayedImage = ImageEditorCanvasView.loadSrcImage(model: model, maxPixelDimension: requiredPixelDimension) else {
+            return
+        }
+        imageLayer.contents = displayedImage.cgImage
+        imageLayer.contentsScale = displayedImage.scale
+        displayedImageMaxPixelDimension = requiredPixelDimension
     }
 
     class func updateImageLayer(imageLayer: CALayer, viewSize: CGSize, imageSize: CGSize, transform: ImageEditorTransform) {
@@ -1216,14 +1263,15 @@ class ImageEditorCanvasView: UIView {
     // MARK: - Blur
 
     private func prepareBlurredImage() {
-        guard let srcImage = loadSrcImage() else {
+        let blurMaxPixelDimension: CGFloat = 300
+        guard let srcImage = ImageEditorCanvasView.loadSrcImage(model: model, maxPixelDimension: blurMaxPixelDimension) else {
             return owsFailDebug("Could not load src image.")
         }
 
         // we use a very strong blur radius to ensure adequate coverage of large and small faces
         srcImage.cgImageWithGaussianBlurPromise(
             radius: 25,
-            resizeToMaxPixelDimension: 300
+            resizeToMaxPixelDimension: blurMaxPixelDimension
         ).done(on: DispatchQueue.main) { [weak self] blurredImage in
             guard let self = self else { return }
             self.model.blurredSourceImage = blurredImage
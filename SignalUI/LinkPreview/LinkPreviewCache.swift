@@ -0,0 +1,132 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import CryptoKit
+import Foundation
+import SignalServiceKit
+
+/// Link previews fetched recently, so that a link that's typed again (or
+/// that the user edits around) or shared again shows its preview right
+/// away instead of fetching and parsing the page again.
+///
+/// Entries are kept in memory and in the shared container, so the share
+/// extension sees previews fetched in the main app, and expire after `ttl`.
+///
+/// This class is thread-safe.
+final class LinkPreviewCache {
+
+    private struct Entry: Codable {
+        let title: String?
+        let previewDescription: String?
+        let date: Date?
+        let imageData: Data?
+        let imageMimeType: String?
+        let fetchDate: Date
+    }
+
+    private let directoryUrl: URL
+    private let ttl: TimeInterval
+    private let maxEntryCount: Int
+    private let dateProvider: DateProvider
+
+    private let memoryCache = LRUCache<String, Entry>(maxSize: 16)
+
+    static let defaultTtl: TimeInterval = kDayInterval
+
+    init(
+        directoryUrl: URL,
+        ttl: TimeInterval = LinkPreviewCache.defaultTtl,
+        maxEntryCount: Int = 32,
+        dateProvider: @escaping DateProvider = { Date() }
+    ) {
+        self.directoryUrl = directoryUrl
+        self.ttl = ttl
+        self.maxEntryCount = maxEntryCount
+        self.dateProvider = dateProvider
+    }
+
+    private static func cacheKey(url: URL) -> String {
+        return Data(SHA256.hash(data: Data(url.absoluteString.utf8))).hexadecimalString
+    }
+
+    private func fileUrl(cacheKey: String) -> URL {
+        return directoryUrl.appendingPathComponent(cacheKey)
+    }
+
+    private func isExpired(_ entry: Entry) -> Bool {
+        return abs(dateProvider().timeIntervalSince(entry.fetchDate)) > ttl
+    }
+
+    /// Returns a new draft each time, so callers may modify it.
+    func linkPreviewDraft(for url: URL) -> OWSLinkPreviewDraft? {
+        let cacheKey = Self.cacheKey(url: url)
+        let entry: Entry
+        if let memoryEntry = memoryCache.get(key: cacheKey) {
+            entry = memoryEntry
+        } else if
+            let data = try? Data(contentsOf: fileUrl(cacheKey: cacheKey)),
+            let diskEntry = try? PropertyListDecoder().decode(Entry.self, from: data)
+        {
+            entry = diskEntry
+            memoryCache.set(key: cacheKey, value: entry)
+        } else {
+            return nil
+        }
+
+        guard !isExpired(entry) else {
+            memoryCache.remove(key: cacheKey)
+            try? OWSFileSystem.deleteFileIfExists(url: fileUrl(cacheKey: cacheKey))
+            return nil
+        }
+
+        let draft = OWSLinkPreviewDraft(url: url, title: entry.title, imageData: entry.imageData, imageMimeType: entry.imageMimeType)
+        draft.previewDescription = entry.previewDescription
+        draft.date = entry.date
+        return draft
+    }
+
+    func store(_ draft: OWSLinkPreviewDraft) {
+        let cacheKey = Self.cacheKey(url: draft.url)
+        let entry = Entry(
+            title: draft.title,
+            previewDescription: draft.previewDescription,
+            date: draft.date,
+            imageData: draft.imageData,
+            imageMimeType: draft.imageMimeType,
+            fetchDate: dateProvider()
+        )
+        memoryCache.set(key: cacheKey, value: entry)
+
+        do {
+            try FileManager.default.createDirectory(at: directoryUrl, withIntermediateDirectories: true)
+            let encoder = PropertyListEncoder()
+            encoder.outputFormat = .binary
+            try encoder.encode(entry).write(to: fileUrl(cacheKey: cacheKey), options: .atomic)
+        } catch {
+            Logger.warn("Couldn't persist link preview: \(error)")
+            return
+        }
+        trim()
+    }
+
+    /// Deletes the least recently stored entries beyond `maxEntryCount`.
+    /// Expired entries are deleted when they're looked up.
+    private func trim() {
+        let fileUrls = (try? FileManager.default.contentsOfDirectory(
+            at: directoryUrl,
+            includingPropertiesForKeys: [.contentModificationDateKey]
+        )) ?? []
+        guard fileUrls.count > maxEntryCount else {
+            return
+        }
+        let sortedFileUrls = fileUrls.map { fileUrl in
+            let modificationDate = (try? fileUrl.resourceValues(forKeys: [.contentModificationDateKey]))?.contentModificationDate
+            return (fileUrl: fileUrl, modificationDate: modificationDate ?? .distantPast)
+        }.sorted(by: { $0.modificationDate > $1.modificationDate })
+        for (fileUrl, _) in sortedFileUrls.dropFirst(maxEntryCount) {
+            try? OWSFileSystem.deleteFileIfExists(url: fileUrl)
+        }
+    }
+}
@@ -0,0 +1,88 @@
+//
+// Copyright 2024 Signal Messenger, LLC
+// SPDX-License-Identifier: AGPL-3.0-only
+//
+
+import Foundation
+@testable import SignalServiceKit
+@testable import SignalUI
+import XCTest
+
+class LinkPreviewCacheTest: XCTestCase {
+
+    private var directoryUrl: URL!
+
+    override func setUp() {
+        super.setUp()
+        directoryUrl = OWSFileSystem.temporaryFileUrl(isAvailableWhileDeviceLocked: true)
+    }
+
+    override func tearDown() {
+        try? OWSFileSystem.deleteFileIfExists(url: directoryUrl)
+        super.tearDown()
+    }
+
+    private func draft(_ urlString: String) -> OWSLinkPreviewDraft {
+        let draft = OWSLinkPreviewDraft(
+            url: URL(string: urlString)!,
+            title: "Title",
+            imageData: Data(repeating: 1, count: 32),
+            imageMimeType: MimeType.imageJpeg.rawValue
+        )
+        draft.previewDescription = "Description"
+        draft.date = Date(millisecondsSince1970: 1_700_000_000_000)
+        return draft
+    }
+
+    func testStoreAndLookup() throws {
+        let cache = LinkPreviewCache(directoryUrl: directoryUrl)
+        let url = URL(string: "https://signal.org/blog")!
+        XCTAssertNil(cache.linkPreviewDraft(for: url))
+
+        cache.store(draft(url.absoluteString))
+
+        // A separate instance only has what's on disk.
+        for cache in [cache, LinkPreviewCache(directoryUrl: directoryUrl)] {
+            let cachedDraft = try XCTUnwrap(cache.linkPreviewDraft(for: url))
+            XCTAssertEqual(cachedDraft.url, url)
+            XCTAssertEqual(cachedDraft.title, "Title")
+            XCTAssertEqual(cachedDraft.previewDescription, "Description")
+            XCTAssertEqual(cachedDraft.date, Date(millisecondsSince1970: 1_700_000_000_000))
+            XCTAssertEqual(cachedDraft.imageData, Data(repeating: 1, count: 32))
+            XCTAssertEqual(cachedDraft.imageMimeType, MimeType.imageJpeg.rawValue)
+        }
+        XCTAssertNil(cache.linkPreviewDraft(for: URL(string: "https://signal.org/donate")!))
+    }
+
+    func testExpiry() {
+        var now = Date()
+        let cache = LinkPreviewCache(directoryUrl: directoryUrl, ttl: 60, dateProvider: { now })
+        let url = URL(string: "https://signal.org/blog")!
+        cache.store(draft(url.absoluteString))
+
+        now.addTimeInterval(59)
+        XCTAssertNotNil(cache.linkPreviewDraft(for: url))
+
+        now.addTimeInterval(2)
+        XCTAssertNil(cache.linkPreviewDraft(for: url))
+        XCTAssertNil(LinkPreviewCache(directoryUrl: directoryUrl, dateProvider: { now }).linkPreviewDraft(for: url))
+    }
+
+    func testTrim() throws {
+        let cache = LinkPreviewCache(directoryUrl: directoryUrl, maxEntryCount: 2)
+        let urlStrings = ["https://signal.org/1", "https://signal.org/2", "https://signal.org/3"]
+        cache.store(draft(urlStrings[0]))
+        cache.store(draft(urlStrings[1]))
+        let fileUrls = try FileManager.default.contentsOfDirectory(at: directoryUrl, includingPropertiesForKeys: nil)
+        for (index, fileUrl) in fileUrls.enumerated() {
+            try FileManager.default.setAttributes([.modificationDate: Date(timeIntervalSinceNow: -Double(100 * (index + 1)))], ofItemAtPath: fileUrl.path)
+        }
+        let oldestFileUrl = fileUrls.last!
+
+        cache.store(draft(urlStrings[2]))
+
+        let remainingFileUrls = try FileManager.default.contentsOfDirectory(at: directoryUrl, includingPropertiesForKeys: nil)
+        XCTAssertEqual(remainingFileUrls.count, 2)
+        XCTAssertFalse(remainingFileUrls.map(\.lastPathComponent).contains(oldestFileUrl.lastPathComponent))
+    }
+}
@@ -32,18 +32,46 @@ public class LinkPreviewFetcherImpl: LinkPreviewFetcher {
     private let linkPreviewSettingStore: LinkPreviewSettingStore
     private let tsAccountManager: any TSAccountManager
 
-    public init(
+    private let linkPreviewCache: LinkPreviewCache
+
+    /// Fetches of generic URLs, so that asking again for a URL that's still
+    /// being fetched (e.g. because the user edited around it) waits for the
+    /// same fetch.
+    private let inFlightFetches = AtomicValue<[URL: Task<OWSLinkPreviewDraft, Error>]>([:], lock: UnfairLock())
+
+    public convenience init(
         authCredentialManager: any AuthCredentialManager,
         db: any DB,
         groupsV2: any GroupsV2,
         linkPreviewSettingStore: LinkPreviewSettingStore,
         tsAccountManager: any TSAccountManager
+    ) {
+        self.init(
+            authCredentialManager: authCredentialManager,
+            db: db,
+            groupsV2: groupsV2,
+            linkPreviewSettingStore: linkPreviewSettingStore,
+            tsAccountManager: tsAccountManager,
+            linkPreviewCache: LinkPreviewCache(
+                directoryUrl: OWSFileSystem.appSharedDataDirectoryURL().appendingPathComponent("LinkPreviewCache", isDirectory: true)
+            )
+        )
+    }
+
+    init(
+        authCredentialManager: any AuthCredentialManager,
+        db: any DB,
+        groupsV2: any GroupsV2,
+        linkPreviewSettingStore: LinkPreviewSettingStore,
+        tsAccountManager: any TSAccountManager,
+        linkPreviewCache: LinkPreviewCache
     ) {
         self.authCredentialManager = authCredentialManager
         self.db = db
         self.groupsV2 = groupsV2
         self.linkPreviewSettingStore = linkPreviewSettingStore
         self.tsAccountManager = tsAccountManager
+        self.linkPreviewCache = linkPreviewCache
     }
 
     public func fetchLinkPreview(for url: URL) async throws -> OWSLinkPreviewDraft {
@@ -62,7 +90,7 @@ public class LinkPreviewFetcherImpl: LinkPreviewFetcher {
             linkPreviewDraft = OWSLinkPreviewDraft(url: url, title: linkName)
             linkPreviewDraft.previewDescription = linkDescription
         } else {
-            linkPreviewDraft = try await self.fetchLinkPreview(forGenericUrl: url)
+            linkPreviewDraft = try await self.cachedLinkPreview(forGenericUrl: url)
         }
         guard linkPreviewDraft.isValid() else {
             throw LinkPreviewError.noPreview
@@ -70,6 +98,34 @@ public class LinkPreviewFetcherImpl: LinkPreviewFetcher {
         return linkPreviewDraft
     }
 
+    /// Only generic URLs are cached; the others either are cheap to build
+    /// or describe state (e.g. a group's title) that can change at any time.
+    private func cachedLinkPreview(forGenericUrl url: URL) async throws -> OWSLinkPreviewDraft {
+        if let linkPreviewDraft = linkPreviewCache.linkPreviewDraft(for: url) {
+            return linkPreviewDraft
+        }
+        let fetchTask = inFlightFetches.update { inFlightFetches in
+            if let fetchTask = inFlightFetches[url] {
+                return fetchTask
+            }
+            // Not tied to the caller's task, so that a caller that stops
+            // waiting doesn't cancel the fetch for everyone else.
+            let fetchTask = Task {
+                defer { self.inFlightFetches.update { _ = $0.removeValue(forKey: url) } }
+                let linkPreviewDraft = try await self.fetchLinkPreview(forGenericUrl: url)
+                if linkPreviewDraft.isValid() {
+                    self.linkPreviewCache.store(linkPreviewDraft)
+                }
+                return linkPreviewDraft
+            }
+            inFlightFetches[url] = fetchTask
+            return fetchTask
+        }
+        let linkPreviewDraft = try await fetchTask.value
+        // Every waiter gets a draft of its own.
+        return linkPreviewCache.linkPreviewDraft(for: url) ?? linkPreviewDraft
+    }
+
     private func fetchLinkPreview(forGenericUrl url: URL) async throws -> OWSLinkPreviewDraft {
         let (respondingUrl, rawHtml) = try await self.fetchStringResource(from: url)
 
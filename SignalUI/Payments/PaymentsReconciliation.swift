@@ -97,6 +97,13 @@ public class PaymentsReconciliation: Dependencies {
     private static let lastKnownBlockCountKey = "lastKnownBlockCountKey"
     private static let lastKnownReceivedTXOCountKey = "lastKnownReceivedTXOCountKey"
     private static let lastKnownSpentTXOCountKey = "lastKnownSpentTXOCountKey"
+    // The highest ledger block index with account activity that has been
+    // reconciled. Later passes only reconcile blocks after this one, and
+    // the payment models in them. It's cleared (along with the rest of the
+    // scheduling store) by scheduleReconciliationNow(), e.g. when culling
+    // unidentified payments in an older block, so that the next pass is a
+    // full one.
+    private static let reconciledBlockIndexKey = "reconciledBlockIndexKey"
 
     private static func shouldReconcileByDateWithSneakyTransaction() -> Bool {
         Self.databaseStorage.read { transaction in
@@ -146,6 +153,10 @@ public class PaymentsReconciliation: Dependencies {
         return false
     }
 
+    private static func reconciledBlockIndex(transaction: SDSAnyReadTransaction) -> UInt64? {
+        Self.schedulingStore.getUInt64(Self.reconciledBlockIndexKey, transaction: transaction)
+    }
+
     private static func reconciliationDidSucceed(transaction: SDSAnyWriteTransaction,
                                                  transactionHistory: MCTransactionHistory) {
         // TODO: Until reconciliation testing is complete, don't mark reconciliation as complete.
@@ -166,6 +177,15 @@ public class PaymentsReconciliation: Dependencies {
         Self.schedulingStore.setInt(receivedItemsCount,
                                     key: Self.lastKnownReceivedTXOCountKey,
                                     transaction: transaction)
+
+        let blockIndices = transactionHistory.safeItems.flatMap { item in
+            [item.receivedBlockIndex, item.spentBlock?.index].compactMap { $0 }
+        }
+        if let reconciledBlockIndex = blockIndices.max() {
+            Self.schedulingStore.setUInt64(reconciledBlockIndex,
+                                           key: Self.reconciledBlockIndexKey,
+                                           transaction: transaction)
+        }
         #endif
     }
 
@@ -205,13 +225,16 @@ public class PaymentsReconciliation: Dependencies {
         // necessary.
         do {
             try databaseStorage.read { transaction in
-                let databaseState = Self.buildPaymentsDatabaseState(transaction: transaction)
+                let reconciledBlockIndex = Self.reconciledBlockIndex(transaction: transaction)
+                let databaseState = Self.buildPaymentsDatabaseState(reconciledBlockIndex: reconciledBlockIndex,
+                                                                    transaction: transaction)
 
                 try reconcile(transactionHistory: transactionHistory,
                               databaseState: databaseState,
+                              reconciledBlockIndex: reconciledBlockIndex,
                               transaction: transaction)
 
-                try cleanUpDatabase(transaction: transaction)
+                try cleanUpDatabase(reconciledBlockIndex: reconciledBlockIndex, transaction: transaction)
             }
             databaseStorage.write { transaction in
                 reconciliationDidSucceed(transaction: transaction,
@@ -223,13 +246,16 @@ public class PaymentsReconciliation: Dependencies {
 
                 do {
                     try databaseStorage.write { transaction in
-                        let databaseState = Self.buildPaymentsDatabaseState(transaction: transaction)
+                        let reconciledBlockIndex = Self.reconciledBlockIndex(transaction: transaction)
+                        let databaseState = Self.buildPaymentsDatabaseState(reconciledBlockIndex: reconciledBlockIndex,
+                                                                            transaction: transaction)
 
                         try reconcile(transactionHistory: transactionHistory,
                                       databaseState: databaseState,
+                                      reconciledBlockIndex: reconciledBlockIndex,
                                       transaction: transaction)
 
-                        try cleanUpDatabase(transaction: transaction)
+                        try cleanUpDatabase(reconciledBlockIndex: reconciledBlockIndex, transaction: transaction)
 
                         reconciliationDidSucceed(transaction: transaction,
                                                  transactionHistory: transactionHistory)
@@ -280,8 +306,13 @@ public class PaymentsReconciliation: Dependencies {
     //   group all "unaccounted for" outgoing TXOs into a single payment.
     //
     // NOTE: There's no reliable way to identify defrag transactions.
+    //
+    // If reconciledBlockIndex is set, blocks up to and including it have
+    // already been reconciled, so only later blocks are reviewed and
+    // databaseState only needs to include their payment models.
     internal static func reconcile(transactionHistory: MCTransactionHistory,
                                    databaseState: PaymentsDatabaseState,
+                                   reconciledBlockIndex: UInt64? = nil,
                                    transaction: SDSAnyReadTransaction) throws {
 
         Logger.info("")
@@ -307,6 +338,13 @@ public class PaymentsReconciliation: Dependencies {
             }
         }
         let blockActivities = Array(blockActivityMap.values).sortedByBlockIndex(descending: false)
+        // All block activities are still used to guesstimate block timestamps.
+        let unreconciledBlockActivities = blockActivities.filter { blockActivity in
+            guard let reconciledBlockIndex else {
+                return true
+            }
+            return blockActivity.blockIndex > reconciledBlockIndex
+        }
 
         // 2. Fill in missing unidentified transactions.
         //
@@ -337,7 +375,7 @@ public class PaymentsReconciliation: Dependencies {
         // If we later learn of identified activity in that block (via sync
         // message), we'll recover by discarding all "unidentified" payments
         // in the block and re-reconcile.
-        for blockActivity in blockActivities {
+        for blockActivity in unreconciledBlockActivities {
             // For each ledger block, we first try to identify any blocks with
             // any outgoing/spent TXOs which are not already "accounted for".
             //
@@ -443,7 +481,7 @@ public class PaymentsReconciliation: Dependencies {
         }
 
         // 3. Fill in missing ledger timestamps.
-        for blockActivity in blockActivities {
+        for blockActivity in unreconciledBlockActivities {
             // If we know the ledger block timestamp for a given block...
             guard let ledgerBlockTimestamp = blockActivity.blockTimestamp else {
                 continue
@@ -633,11 +671,15 @@ public class PaymentsReconciliation: Dependencies {
         return timestampUpperBound - 1
     }
 
-    private static func cleanUpDatabase(transaction: SDSAnyReadTransaction) throws {
-        try cleanUpDatabaseMobileCoin(transaction: transaction)
+    private static func cleanUpDatabase(reconciledBlockIndex: UInt64?,
+                                        transaction: SDSAnyReadTransaction) throws {
+        try cleanUpDatabaseMobileCoin(reconciledBlockIndex: reconciledBlockIndex, transaction: transaction)
     }
 
-    private static func cleanUpDatabaseMobileCoin(transaction: SDSAnyReadTransaction) throws {
+    // Payment models in reconciled blocks were cleaned up when they were
+    // reconciled, so only newer payment models need to be reviewed.
+    private static func cleanUpDatabaseMobileCoin(reconciledBlockIndex: UInt64?,
+                                                  transaction: SDSAnyReadTransaction) throws {
 
         var unidentifiedPaymentModelsToCull = [String: TSPaymentModel]()
 
@@ -674,8 +716,9 @@ public class PaymentsReconciliation: Dependencies {
         let spentKeyImagesMap = MultiMap<Data, TSPaymentModel>()
         let outputPublicKeys = MultiMap<Data, TSPaymentModel>()
 
-        let allPaymentModels = TSPaymentModel.anyFetchAll(transaction: transaction)
-        for paymentModel in allPaymentModels {
+        let paymentModels = Self.paymentModelsToReconcile(reconciledBlockIndex: reconciledBlockIndex,
+                                                          transaction: transaction)
+        for paymentModel in paymentModels {
             owsAssertDebug(paymentModel.isFailed == (paymentModel.mobileCoin == nil))
             guard !paymentModel.isFailed,
                   let mobileCoin = paymentModel.mobileCoin else {
@@ -804,12 +847,30 @@ public class PaymentsReconciliation: Dependencies {
 
     // MARK: -
 
-    internal static func buildPaymentsDatabaseState(transaction: SDSAnyReadTransaction) -> PaymentsDatabaseState {
+    private static func paymentModelsToReconcile(reconciledBlockIndex: UInt64?,
+                                                 transaction: SDSAnyReadTransaction) -> [TSPaymentModel] {
+        guard let reconciledBlockIndex else {
+            return TSPaymentModel.anyFetchAll(transaction: transaction)
+        }
+        return PaymentFinder.paymentModels(afterMcLedgerBlockIndex: reconciledBlockIndex,
+                                           transaction: transaction)
+    }
+
+    internal static func buildPaymentsDatabaseState(reconciledBlockIndex: UInt64? = nil,
+                                                    transaction: SDSAnyReadTransaction) -> PaymentsDatabaseState {
         let databaseState = PaymentsDatabaseState()
 
-        TSPaymentModel.anyEnumerate(transaction: transaction,
-                                    batchSize: 100) { (paymentModel, _) in
-            databaseState.add(paymentModel: paymentModel)
+        if let reconciledBlockIndex {
+            let paymentModels = PaymentFinder.paymentModels(afterMcLedgerBlockIndex: reconciledBlockIndex,
+                                                            transaction: transaction)
+            for paymentModel in paymentModels {
+                databaseState.add(paymentModel: paymentModel)
+            }
+        } else {
+            TSPaymentModel.anyEnumerate(transaction: transaction,
+                                        batchSize: 100) { (paymentModel, _) in
+                databaseState.add(paymentModel: paymentModel)
+            }
         }
 
         DependenciesBridge.shared.archivedPaymentStore.enumerateAll(tx: transaction.asV2Read) { (archivedPayment, _) in
@@ -158,10 +158,10 @@ public class ChatListInfo: Dependencies {
                                                              transaction: transaction) else {
                 return nil
             }
-            return draftMessageBody
-                .hydrating(
-                    mentionHydrator: ContactsMentionHydrator.mentionHydrator(transaction: transaction.asV2Read)
-                )
+            return HydratedMessageBodyCache.shared.hydratedBody(
+                for: draftMessageBody,
+                tx: transaction.asV2Read
+            )
         }
         func hasVoiceMemoDraft() -> Bool {
             VoiceMessageInterruptedDraftStore.hasDraft(for: thread, transaction: transaction)
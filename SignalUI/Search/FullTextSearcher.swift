@@ -238,10 +238,14 @@ public class MessageSearchResult: NSObject, Comparable {
 
     public let messageId: String
     public let sortId: UInt64
+    /// The matching text, with matches wrapped in `FullTextSearchIndexer.matchTag`.
+    /// Nil for messages that match by mention.
+    public let snippet: String?
 
-    init(messageId: String, sortId: UInt64) {
+    init(messageId: String, sortId: UInt64, snippet: String? = nil) {
         self.messageId = messageId
         self.sortId = sortId
+        self.snippet = snippet
     }
 
     // MARK: - Comparable
@@ -287,6 +291,15 @@ public class FullTextSearcher: NSObject {
 
     public static let kDefaultMaxResults: Int = 500
 
+    /// Message results are the most expensive to build (each needs a styled
+    /// snippet), and the best-ranked ones are the ones worth showing, so home
+    /// screen search only builds this many.
+    public static let kDefaultMaxMessageResults: Int = 100
+
+    /// While matching messages, partial results are reported after every
+    /// this many.
+    private static let partialResultMessageBatchSize = 20
+
     public static let shared: FullTextSearcher = FullTextSearcher()
 
     public func searchForRecipients(
@@ -391,17 +404,31 @@ public class FullTextSearcher: NSObject {
         return .none
     }
 
+    /// Searches chats, contacts, and messages.
+    ///
+    /// Chat and contact results are cheap and come first, so they're passed
+    /// to `onPartialResults` (if set) before messages are searched, and the
+    /// results so far are passed again as batches of messages are matched.
+    /// Partial results are reported on the calling thread and are never
+    /// empty. When the search completes, the full results are returned.
+    ///
+    /// Returns nil if `isCanceled` returns true, which is checked between
+    /// each step and for every message match.
     public func searchForHomeScreen(
         searchText: String,
         maxResults: Int = kDefaultMaxResults,
+        maxMessageResults: Int = kDefaultMaxMessageResults,
         isCanceled: () -> Bool,
+        onPartialResults: ((HomeScreenSearchResultSet) -> Void)? = nil,
         transaction: SDSAnyReadTransaction
     ) -> HomeScreenSearchResultSet? {
         do {
             return try _searchForHomeScreen(
                 searchText: searchText,
                 maxResults: maxResults,
+                maxMessageResults: maxMessageResults,
                 isCanceled: isCanceled,
+                onPartialResults: onPartialResults,
                 transaction: transaction
             )
         } catch is CancellationError {
@@ -415,7 +442,9 @@ public class FullTextSearcher: NSObject {
     private func _searchForHomeScreen(
         searchText: String,
         maxResults: Int,
+        maxMessageResults: Int,
         isCanceled: () -> Bool,
+        onPartialResults: ((HomeScreenSearchResultSet) -> Void)?,
         transaction: SDSAnyReadTransaction
     ) throws -> HomeScreenSearchResultSet? {
         var contactResults = [ContactSearchResult]()
@@ -556,6 +585,33 @@ public class FullTextSearcher: NSObject {
             return max(0, maxResults - (groupResults.count + contactResults.count + contactThreadResults.count + messages.count))
         }
 
+        func remainingMessageResultCount() -> Int {
+            return min(remainingResultCount(), max(0, maxMessageResults - messages.count))
+        }
+
+        func buildResultSet() -> HomeScreenSearchResultSet {
+            // Order the conversation and message results in reverse chronological order.
+            // Order "Other Contacts" by name.
+            return HomeScreenSearchResultSet(
+                searchText: searchText,
+                contactThreadResults: contactThreadResults.sorted(by: >),
+                groupThreadResults: groupResults.sorted(by: >),
+                contactResults: contactResults.sorted(by: <),
+                messageResults: messages.values.sorted(by: >)
+            )
+        }
+
+        func reportPartialResults() {
+            guard let onPartialResults, !isCanceled() else {
+                return
+            }
+            let resultSet = buildResultSet()
+            guard !resultSet.isEmpty else {
+                return
+            }
+            onPartialResults(resultSet)
+        }
+
         // We search for each type of result independently. The order here matters
         // – we want to give priority to chat and contact results above message
         // results. This makes sure if I search for a string like "Matthew" the
@@ -623,15 +679,25 @@ public class FullTextSearcher: NSObject {
             return nil
         }
 
+        reportPartialResults()
+
+        // FTS returns matches best-ranked first, so this keeps the top
+        // `maxMessageResults` of them.
+        var unreportedMessageCount = 0
         FullTextSearchIndexer.search(
             for: searchText,
-            maxResults: remainingResultCount(),
+            maxResults: remainingMessageResultCount(),
             tx: transaction
         ) { (message: TSMessage, snippet: String?, stop) in
-            if isCanceled() || remainingResultCount() == 0 {
+            if isCanceled() || remainingMessageResultCount() == 0 {
                 stop = true
                 return
             }
+            if unreportedMessageCount >= Self.partialResultMessageBatchSize {
+                unreportedMessageCount = 0
+                reportPartialResults()
+            }
+            unreportedMessageCount += 1
             let styledSnippet: CVTextValue? = { () -> CVTextValue? in
                 guard let snippet else {
                     return nil
@@ -671,16 +737,7 @@ public class FullTextSearcher: NSObject {
             return nil
         }
 
-        // Order the conversation and message results in reverse chronological order.
-        // Order "Other Contacts" by name.
-
-        return HomeScreenSearchResultSet(
-            searchText: searchText,
-            contactThreadResults: contactThreadResults.sorted(by: >),
-            groupThreadResults: groupResults.sorted(by: >),
-            contactResults: contactResults.sorted(by: <),
-            messageResults: messages.values.sorted(by: >)
-        )
+        return buildResultSet()
     }
 
     public func searchWithinConversation(
@@ -692,23 +749,26 @@ public class FullTextSearcher: NSObject {
         var messages: [UInt64: MessageSearchResult] = [:]
 
         func appendMessage(_ message: TSMessage) {
+            guard messages[message.sortId] == nil else {
+                return
+            }
             let messageId = message.uniqueId
             let searchResult = MessageSearchResult(messageId: messageId, sortId: message.sortId)
             messages[message.sortId] = searchResult
         }
 
-        FullTextSearchIndexer.search(
+        let matches = FullTextSearchIndexer.searchWithinThread(
             for: searchText,
+            threadUniqueId: thread.uniqueId,
             maxResults: maxResults,
             tx: transaction
-        ) { message, _, stop in
-            guard messages.count < maxResults else {
-                stop = true
-                return
-            }
-            if message.uniqueThreadId == thread.uniqueId {
-                appendMessage(message)
-            }
+        )
+        for match in matches {
+            messages[match.sortId] = MessageSearchResult(
+                messageId: match.messageUniqueId,
+                sortId: match.sortId,
+                snippet: match.snippet
+            )
         }
 
         let canSearchForMentions: Bool = thread is TSGroupThread
@@ -53,26 +53,21 @@ public class StickerView {
         return stickerView
     }
 
+    /// Parsed sticker images, shared by every view that shows the same
+    /// sticker (e.g. the picker, the keyboard and sticker suggestions), so
+    /// that each is read and parsed once. The views decode their frames
+    /// from the shared image as they animate.
+    private static let stickerImageCache = LRUCache<String, YYImage>(maxSize: 64, shouldEvacuateInBackground: true)
+
     static func stickerView(
         stickerInfo: StickerInfo,
         stickerType: StickerType,
         stickerMetadata: any StickerMetadata
     ) -> UIView? {
-        guard let stickerData = try? stickerMetadata.readStickerData() else {
-            Logger.warn("Sticker data does not exist.")
-            return nil
-        }
-
-        guard stickerMetadata.isValidImage() else {
-            owsFailDebug("Invalid sticker")
-            return nil
-        }
-
         let stickerView: UIView
         switch stickerType {
         case .webp, .apng, .gif:
-            guard let stickerImage = YYImage(data: stickerData) else {
-                owsFailDebug("Sticker could not be parsed.")
+            guard let stickerImage = loadStickerImage(stickerInfo: stickerInfo, stickerMetadata: stickerMetadata) else {
                 return nil
             }
             let yyView = YYAnimatedImageView()
@@ -83,6 +78,30 @@ public class StickerView {
         }
         return stickerView
     }
+
+    private static func loadStickerImage(stickerInfo: StickerInfo, stickerMetadata: any StickerMetadata) -> YYImage? {
+        let cacheKey = stickerInfo.asKey()
+        if let stickerImage = stickerImageCache.get(key: cacheKey) {
+            return stickerImage
+        }
+
+        guard let stickerData = try? stickerMetadata.readStickerData() else {
+            Logger.warn("Sticker data does not exist.")
+            return nil
+        }
+
+        guard stickerMetadata.isValidImage() else {
+            owsFailDebug("Invalid sticker")
+            return nil
+        }
+
+        guard let stickerImage = YYImage(data: stickerData) else {
+            owsFailDebug("Sticker could not be parsed.")
+            return nil
+        }
+        stickerImageCache.set(key: cacheKey, value: stickerImage)
+        return stickerImage
+    }
 }
 
 public class StickerPlaceholderView: UIView {
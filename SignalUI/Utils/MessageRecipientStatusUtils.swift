@@ -122,10 +122,10 @@ public class MessageRecipientStatusUtils {
                                          comment: "message status while message is sending."))
             }
         case .sent:
-            if outgoingMessage.viewedRecipientAddresses().count > 0 {
+            if outgoingMessage.wasViewedByAnyRecipient {
                 return (.viewed, OWSLocalizedString("MESSAGE_STATUS_VIEWED", comment: "status message for viewed messages"))
             }
-            if outgoingMessage.readRecipientAddresses().count > 0 {
+            if outgoingMessage.wasReadByAnyRecipient {
                 return (.read, OWSLocalizedString("MESSAGE_STATUS_READ", comment: "status message for read messages"))
             }
             if outgoingMessage.wasDeliveredToAnyRecipient {
@@ -315,9 +315,9 @@ extension TSPaymentState {
         case .sent, .delivered:
             // Compute "read"/"viewed" status if available.
             switch message {
-            case _ where message.viewedRecipientAddresses().count > 0:
+            case _ where message.wasViewedByAnyRecipient:
                 return .viewed
-            case _ where message.readRecipientAddresses().count > 0:
+            case _ where message.wasReadByAnyRecipient:
                 return .read
             case _ where message.wasDeliveredToAnyRecipient:
                 return .delivered
@@ -172,6 +172,8 @@ open class OWSViewController: UIViewController {
 
         self.lifecycle = .appeared
 
+        MemoryProfiler.shared.screenDidAppear(String(describing: type(of: self)))
+
         #if DEBUG
         ensureNavbarAccessibilityIds()
         #endif
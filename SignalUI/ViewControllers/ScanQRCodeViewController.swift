@@ -22,7 +22,8 @@ public protocol QRCodeSampleBufferScannerDelegate: AnyObject {
 }
 
 public class QRCodeSampleBufferScanner: NSObject {
-    private weak var delegate: QRCodeSampleBufferScannerDelegate?
+    /// Read when sample buffers are captured, so only set it while they aren't.
+    public weak var delegate: QRCodeSampleBufferScannerDelegate?
 
     public init(delegate: QRCodeSampleBufferScannerDelegate?) {
         self.delegate = delegate
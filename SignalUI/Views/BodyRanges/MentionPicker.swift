@@ -22,9 +22,23 @@ class MentionPicker: UIView {
     struct MentionableUser {
         let address: SignalServiceAddress
         let displayName: String
+
+        /// The lowercased words of `displayName`, followed by the whole name
+        /// without spaces, computed once rather than on every keystroke.
+        fileprivate let namesToCheck: [String]
+
+        init(address: SignalServiceAddress, displayName: String) {
+            self.address = address
+            self.displayName = displayName
+
+            var namesToCheck = displayName.components(separatedBy: " ").map { $0.lowercased() }
+            namesToCheck.append(displayName.replacingOccurrences(of: " ", with: "").lowercased())
+            self.namesToCheck = namesToCheck
+        }
     }
 
     lazy private(set) var filteredMentionableUsers = mentionableUsers
+    private var lastMentionText: String?
 
     typealias Style = MentionPickerStyle
 
@@ -146,21 +160,21 @@ class MentionPicker: UIView {
         // starts with the mention text. e.g. "Alice Bob" would show up
         // if you typed @al or @bo. We also allow typing through spaces,
         // so @alicebo would show "Alice Bob"
+        //
+        // Typing usually extends the previous mention text, in which case
+        // only users that matched before can still match.
+
+        let lowercasedMentionText = mentionText.lowercased()
+        let candidates: [MentionableUser]
+        if let lastMentionText, lowercasedMentionText.hasPrefix(lastMentionText) {
+            candidates = filteredMentionableUsers
+        } else {
+            candidates = mentionableUsers
+        }
+        lastMentionText = lowercasedMentionText
 
-        filteredMentionableUsers = mentionableUsers.filter { user in
-            let mentionText = mentionText.lowercased()
-
-            var namesToCheck = user.displayName.components(separatedBy: " ").map { $0.lowercased() }
-
-            let concatenatedDisplayName = user.displayName.replacingOccurrences(of: " ", with: "").lowercased()
-            namesToCheck.append(concatenatedDisplayName)
-
-            for name in namesToCheck {
-                guard name.hasPrefix(mentionText) else { continue }
-                return true
-            }
-
-            return false
+        filteredMentionableUsers = candidates.filter { user in
+            return user.namesToCheck.contains(where: { $0.hasPrefix(lowercasedMentionText) })
         }
 
         guard !filteredMentionableUsers.isEmpty else { return false }
@@ -146,7 +146,14 @@ public class WallpaperView {
     }
 
     private func addBlurProvider(contentView: UIView) {
-        self.blurProvider = WallpaperBlurProviderImpl(contentView: contentView)
+        let photo: UIImage?
+        switch mode {
+        case .colorView:
+            photo = nil
+        case .imageView(let image):
+            photo = image
+        }
+        self.blurProvider = WallpaperBlurProviderImpl(contentView: contentView, photo: photo)
     }
 }
 
@@ -187,10 +194,39 @@ public protocol WallpaperBlurProvider: AnyObject {
 public class WallpaperBlurProviderImpl: NSObject, WallpaperBlurProvider {
     private let contentView: UIView
 
+    /// The photo shown by `contentView`, if it shows one.
+    private let photo: UIImage?
+
     private var cachedState: WallpaperBlurState?
 
-    init(contentView: UIView) {
+    private struct PhotoBlurKey: Hashable {
+        let photo: ObjectIdentifier
+        let contentWidth: CGFloat
+        let contentHeight: CGFloat
+        let isDarkThemeEnabled: Bool
+    }
+
+    private final class PhotoBlur {
+        /// Kept so that `PhotoBlurKey.photo` can't be reused by another image
+        /// while this is cached.
+        let photo: UIImage
+        let blurredImage: UIImage
+
+        init(photo: UIImage, blurredImage: UIImage) {
+            self.photo = photo
+            self.blurredImage = blurredImage
+        }
+    }
+
+    /// Blurred photo wallpapers, shared by every conversation that shows the
+    /// same photo, so that opening a conversation doesn't render and blur
+    /// its wallpaper again. `WallpaperImageStore` returns the same image each
+    /// time a wallpaper is loaded.
+    private static let photoBlurCache = LRUCache<PhotoBlurKey, PhotoBlur>(maxSize: 4)
+
+    init(contentView: UIView, photo: UIImage? = nil) {
         self.contentView = contentView
+        self.photo = photo
     }
 
     @available(swift, obsoleted: 1.0)
@@ -215,6 +251,22 @@ public class WallpaperBlurProviderImpl: NSObject, WallpaperBlurProvider {
 
         self.cachedState = nil
 
+        let photoBlurKey = photo.map {
+            PhotoBlurKey(
+                photo: ObjectIdentifier($0),
+                contentWidth: bounds.width,
+                contentHeight: bounds.height,
+                isDarkThemeEnabled: isDarkThemeEnabled
+            )
+        }
+        if let photo, let photoBlurKey, let photoBlur = Self.photoBlurCache.get(key: photoBlurKey), photoBlur.photo === photo {
+            let state = WallpaperBlurState(image: photoBlur.blurredImage,
+                                           referenceView: contentView,
+                                           token: newToken)
+            self.cachedState = state
+            return state
+        }
+
         do {
             guard bounds.width > 0, bounds.height > 0 else {
                 return nil
@@ -231,6 +283,9 @@ public class WallpaperBlurProviderImpl: NSObject, WallpaperBlurProvider {
             }
             let blurRadius: CGFloat = 32 / Self.contentDownscalingFactor
             let blurredImage = try scaledImage.withGaussianBlur(radius: blurRadius, tintColor: tintColor)
+            if let photo, let photoBlurKey {
+                Self.photoBlurCache.set(key: photoBlurKey, value: PhotoBlur(photo: photo, blurredImage: blurredImage))
+            }
             let state = WallpaperBlurState(image: blurredImage,
                                            referenceView: contentView,
                                            token: newToken)